@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// Synthetic data of the operator benchmarks. The seed is fixed to make the runs comparable.
+class BenchmarkBlockGenerator {
+public:
+    explicit BenchmarkBlockGenerator(uint32_t seed = 42) : _rng(seed) {}
+
+    // `cardinality` distinct values uniformly distributed in the rows.
+    MutableColumnPtr int64_column(size_t rows, size_t cardinality) {
+        std::uniform_int_distribution<int64_t> dist(0, static_cast<int64_t>(cardinality) - 1);
+        auto column = ColumnInt64::create();
+        auto& data = column->get_data();
+        data.resize(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            data[i] = dist(_rng);
+        }
+        return column;
+    }
+
+    // Strings of `length` characters drawn from `cardinality` distinct values.
+    MutableColumnPtr string_column(size_t rows, size_t cardinality, size_t length) {
+        std::uniform_int_distribution<size_t> dist(0, cardinality - 1);
+        auto column = ColumnString::create();
+        for (size_t i = 0; i < rows; ++i) {
+            // Short strings keep a prefix of the value id, so they may have less distinct values.
+            auto value = std::to_string(dist(_rng));
+            value.resize(length, 'x');
+            column->insert_data(value.data(), value.size());
+        }
+        return column;
+    }
+
+    // Wraps `column` into a nullable column with about `null_ratio` of the rows being null.
+    MutableColumnPtr make_nullable(MutableColumnPtr column, double null_ratio) {
+        std::bernoulli_distribution dist(null_ratio);
+        auto null_map = ColumnUInt8::create(column->size(), 0);
+        auto& null_data = null_map->get_data();
+        for (size_t i = 0; i < null_data.size(); ++i) {
+            null_data[i] = dist(_rng);
+        }
+        return ColumnNullable::create(std::move(column), std::move(null_map));
+    }
+
+    // A filter keeping about `selectivity` of the rows.
+    IColumn::Filter filter(size_t rows, double selectivity) {
+        std::bernoulli_distribution dist(selectivity);
+        IColumn::Filter filter(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            filter[i] = dist(_rng);
+        }
+        return filter;
+    }
+
+    // A block of a nullable int64 column and a string column.
+    Block block(size_t rows, size_t cardinality, double null_ratio, size_t string_length) {
+        Block block;
+        block.insert({make_nullable(int64_column(rows, cardinality), null_ratio),
+                      vectorized::make_nullable(std::make_shared<DataTypeInt64>()), "k"});
+        block.insert({string_column(rows, cardinality, string_length),
+                      std::make_shared<DataTypeString>(), "s"});
+        return block;
+    }
+
+private:
+    std::mt19937 _rng;
+};
+
+} // namespace doris::vectorized
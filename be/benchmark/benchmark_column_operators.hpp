@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_block_generator.hpp"
+#include "vec/common/assert_cast.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
+
+namespace doris::vectorized {
+
+// Args: rows, selectivity of the filter in percent, null ratio in percent.
+static void BM_ColumnFilter(benchmark::State& state) {
+    BenchmarkBlockGenerator generator;
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto column = generator.make_nullable(generator.int64_column(rows, rows),
+                                          static_cast<double>(state.range(2)) / 100);
+    auto filter = generator.filter(rows, static_cast<double>(state.range(1)) / 100);
+    for (auto _ : state) {
+        auto result = column->filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Args: rows, string length, selectivity of the filter in percent.
+static void BM_StringColumnFilter(benchmark::State& state) {
+    BenchmarkBlockGenerator generator;
+    const auto rows = static_cast<size_t>(state.range(0));
+    auto column = generator.string_column(rows, rows, state.range(1));
+    auto filter = generator.filter(rows, static_cast<double>(state.range(2)) / 100);
+    for (auto _ : state) {
+        auto result = column->filter(filter, -1);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Args: rows, cardinality of the key, limit of the sort (0 for a full sort).
+static void BM_SortBlock(benchmark::State& state) {
+    BenchmarkBlockGenerator generator;
+    auto block = generator.block(state.range(0), state.range(1), 0.1, 16);
+    SortDescription description {SortColumnDescription(0, 1, 1), SortColumnDescription(1, 1, 1)};
+    for (auto _ : state) {
+        Block sorted = block;
+        sort_block(sorted, sorted, description, state.range(2));
+        benchmark::DoNotOptimize(sorted);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using BenchmarkAggHashMap = PHHashMap<Int64, char*, HashCRC32<Int64>>;
+
+// The lookup of the aggregation on a single int64 key. Args: rows, cardinality of the key.
+static void BM_AggHashMapEmplace(benchmark::State& state) {
+    BenchmarkBlockGenerator generator;
+    auto column = generator.int64_column(state.range(0), state.range(1));
+    const auto& keys = assert_cast<const ColumnInt64&>(*column).get_data();
+    for (auto _ : state) {
+        BenchmarkAggHashMap hash_map;
+        for (auto key : keys) {
+            BenchmarkAggHashMap::LookupResult it;
+            bool inserted = false;
+            hash_map.emplace(key, it, inserted);
+            benchmark::DoNotOptimize(it);
+        }
+        benchmark::DoNotOptimize(hash_map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ColumnFilter)->ArgsProduct({{1 << 16}, {1, 50, 99}, {0, 50}});
+BENCHMARK(BM_StringColumnFilter)->ArgsProduct({{1 << 16}, {8, 64}, {1, 50, 99}});
+BENCHMARK(BM_SortBlock)
+        ->ArgsProduct({{1 << 16, 1 << 20}, {1 << 10, 1 << 20}, {0, 100}})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AggHashMapEmplace)
+        ->ArgsProduct({{1 << 20}, {1 << 10, 1 << 16, 1 << 20}})
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris::vectorized
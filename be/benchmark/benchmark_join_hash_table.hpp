@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "benchmark_block_generator.hpp"
+#include "vec/common/assert_cast.h"
+#include "vec/common/hash_table/join_hash_table.h"
+
+namespace doris::vectorized {
+
+static constexpr int JOIN_BENCHMARK_BATCH_SIZE = 4096;
+
+using Int64JoinHashTable = JoinHashTable<int64_t>;
+
+// The first row of the build keys is not from the build side.
+static std::vector<int64_t> join_benchmark_keys(size_t rows, size_t cardinality) {
+    BenchmarkBlockGenerator generator;
+    auto column = generator.int64_column(rows, cardinality);
+    const auto& data = assert_cast<const ColumnInt64&>(*column).get_data();
+    std::vector<int64_t> keys(rows + 1);
+    std::copy(data.begin(), data.end(), keys.begin() + 1);
+    return keys;
+}
+
+static void join_benchmark_build(Int64JoinHashTable& hash_table, const std::vector<int64_t>& keys,
+                                 std::vector<uint32_t>& bucket_nums) {
+    auto num_elem = static_cast<uint32_t>(keys.size());
+    hash_table.prepare_build<TJoinOp::INNER_JOIN>(num_elem, JOIN_BENCHMARK_BATCH_SIZE, false);
+    bucket_nums.resize(num_elem);
+    for (uint32_t i = 0; i < num_elem; ++i) {
+        bucket_nums[i] = hash_table.hash(keys[i]) & (hash_table.get_bucket_size() - 1);
+    }
+    hash_table.build(keys.data(), bucket_nums.data(), num_elem, false);
+}
+
+// Args: build rows, cardinality of the build keys.
+static void BM_JoinHashTableBuild(benchmark::State& state) {
+    auto keys = join_benchmark_keys(state.range(0), state.range(1));
+    std::vector<uint32_t> bucket_nums;
+    for (auto _ : state) {
+        Int64JoinHashTable hash_table;
+        join_benchmark_build(hash_table, keys, bucket_nums);
+        benchmark::DoNotOptimize(hash_table.first.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Probes the table with as many rows as it is built with, the probe keys have the same
+// distribution as the build keys.
+static void BM_JoinHashTableProbe(benchmark::State& state) {
+    auto build_keys = join_benchmark_keys(state.range(0), state.range(1));
+    Int64JoinHashTable hash_table;
+    std::vector<uint32_t> build_bucket_nums;
+    join_benchmark_build(hash_table, build_keys, build_bucket_nums);
+
+    BenchmarkBlockGenerator generator(7);
+    auto probe_column = generator.int64_column(state.range(0), state.range(1));
+    const auto& probe_keys = assert_cast<const ColumnInt64&>(*probe_column).get_data();
+    const auto probe_rows = static_cast<int>(probe_keys.size());
+    DorisVector<uint32_t> probe_bucket_nums(probe_rows);
+    std::vector<uint32_t> probe_idxs(JOIN_BENCHMARK_BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(JOIN_BENCHMARK_BATCH_SIZE + 1);
+    size_t matched_rows = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < probe_rows; ++i) {
+            probe_bucket_nums[i] =
+                    hash_table.hash(probe_keys[i]) & (hash_table.get_bucket_size() - 1);
+        }
+        hash_table.pre_build_idxs(probe_bucket_nums);
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        while (probe_idx < probe_rows) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    hash_table.find_batch<TJoinOp::INNER_JOIN>(
+                            probe_keys.data(), nullptr, probe_bucket_nums.data(), probe_idx,
+                            build_idx, probe_rows, probe_idxs.data(), probe_visited,
+                            build_idxs.data(), nullptr, false, false, false);
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+            matched_rows += matched_cnt;
+        }
+    }
+    benchmark::DoNotOptimize(matched_rows);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_JoinHashTableBuild)
+        ->ArgsProduct({{1 << 16, 1 << 20}, {1 << 16, 1 << 20}})
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_JoinHashTableProbe)
+        ->ArgsProduct({{1 << 16, 1 << 20}, {1 << 16, 1 << 20}})
+        ->Unit(benchmark::kMicrosecond);
+
+} // namespace doris::vectorized
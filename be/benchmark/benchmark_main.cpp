@@ -18,7 +18,10 @@
 #include <benchmark/benchmark.h>
 
 #include "benchmark_bit_pack.hpp"
+#include "benchmark_column_operators.hpp"
 #include "benchmark_fastunion.hpp"
+#include "benchmark_join_hash_table.hpp"
+#include "benchmark_segment_page.hpp"
 #include "binary_cast_benchmark.hpp"
 #include "vec/columns/column_string.h"
 #include "vec/core/block.h"
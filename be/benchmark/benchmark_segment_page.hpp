@@ -0,0 +1,235 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/binary_dict_page.h"
+#include "olap/rowset/segment_v2/binary_plain_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/frame_of_reference_page.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "util/block_compression.h"
+#include "util/faststring.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::segment_v2 {
+
+// The pages hold at most this many values, which is about a default data page of int64.
+static constexpr size_t PAGE_BENCHMARK_ROWS = 8192;
+
+// `cardinality` distinct values in [0, cardinality), a small cardinality makes the values
+// compressible.
+template <typename T>
+static std::vector<T> page_benchmark_values(size_t rows, size_t cardinality) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> dist(0, static_cast<int64_t>(cardinality) - 1);
+    std::vector<T> values(rows);
+    for (auto& value : values) {
+        value = static_cast<T>(dist(rng));
+    }
+    return values;
+}
+
+template <typename Builder, typename T>
+static OwnedSlice page_benchmark_build(const std::vector<T>& values) {
+    PageBuilderOptions options;
+    options.data_page_size = values.size() * sizeof(T) * 2;
+    options.dict_page_size = options.data_page_size;
+    PageBuilder* raw_builder = nullptr;
+    CHECK(Builder::create(&raw_builder, options).ok());
+    std::unique_ptr<PageBuilder> builder(raw_builder);
+    size_t count = values.size();
+    CHECK(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+    CHECK_EQ(count, values.size());
+    OwnedSlice page;
+    CHECK(builder->finish(&page).ok());
+    return page;
+}
+
+static void page_benchmark_set_counters(benchmark::State& state, size_t rows, size_t page_bytes) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * rows));
+    state.counters["bytes_per_row"] = static_cast<double>(page_bytes) / static_cast<double>(rows);
+}
+
+// Args: cardinality of the values.
+template <FieldType Type>
+static void BM_BitshufflePageEncode(benchmark::State& state) {
+    using CppType = typename TypeTraits<Type>::CppType;
+    auto values = page_benchmark_values<CppType>(PAGE_BENCHMARK_ROWS, state.range(0));
+    size_t page_bytes = 0;
+    for (auto _ : state) {
+        auto page = page_benchmark_build<BitshufflePageBuilder<Type>>(values);
+        page_bytes = page.slice().size;
+        benchmark::DoNotOptimize(page_bytes);
+    }
+    page_benchmark_set_counters(state, values.size(), page_bytes);
+}
+
+// Decodes the page into a column as a column reader does, including the unshuffle and the
+// lz4 decompression of the pre decoder. Args: cardinality of the values.
+template <FieldType Type>
+static void BM_BitshufflePageDecode(benchmark::State& state) {
+    using CppType = typename TypeTraits<Type>::CppType;
+    auto values = page_benchmark_values<CppType>(PAGE_BENCHMARK_ROWS, state.range(0));
+    auto page = page_benchmark_build<BitshufflePageBuilder<Type>>(values);
+    BitShufflePagePreDecoder<false> pre_decoder;
+    for (auto _ : state) {
+        Slice page_slice = page.slice();
+        std::unique_ptr<DataPage> decoded_page;
+        CHECK(pre_decoder.decode(&decoded_page, &page_slice, 0, false, PageTypePB::DATA_PAGE)
+                      .ok());
+        BitShufflePageDecoder<Type> decoder(page_slice, PageDecoderOptions());
+        CHECK(decoder.init().ok());
+        vectorized::MutableColumnPtr column = vectorized::ColumnVector<CppType>::create();
+        size_t rows = values.size();
+        CHECK(decoder.next_batch(&rows, column).ok());
+        benchmark::DoNotOptimize(column);
+    }
+    page_benchmark_set_counters(state, values.size(), page.slice().size);
+}
+
+// Args: cardinality of the values.
+static void BM_FrameOfReferencePageDecode(benchmark::State& state) {
+    constexpr auto Type = FieldType::OLAP_FIELD_TYPE_BIGINT;
+    auto values = page_benchmark_values<int64_t>(PAGE_BENCHMARK_ROWS, state.range(0));
+    auto page = page_benchmark_build<FrameOfReferencePageBuilder<Type>>(values);
+    for (auto _ : state) {
+        FrameOfReferencePageDecoder<Type> decoder(page.slice(), PageDecoderOptions());
+        CHECK(decoder.init().ok());
+        vectorized::MutableColumnPtr column = vectorized::ColumnInt64::create();
+        size_t rows = values.size();
+        CHECK(decoder.next_batch(&rows, column).ok());
+        benchmark::DoNotOptimize(column);
+    }
+    page_benchmark_set_counters(state, values.size(), page.slice().size);
+}
+
+// Decodes a dictionary encoded page of strings into a string column, the dictionary page is
+// decoded once as a column reader does. Args: cardinality of the values, string length.
+static void BM_BinaryDictPageDecode(benchmark::State& state) {
+    auto ids = page_benchmark_values<int64_t>(PAGE_BENCHMARK_ROWS, state.range(0));
+    std::vector<std::string> strings;
+    std::vector<Slice> values;
+    strings.reserve(ids.size());
+    for (auto id : ids) {
+        strings.push_back(std::to_string(id));
+        strings.back().resize(state.range(1), 'x');
+        values.emplace_back(strings.back());
+    }
+
+    PageBuilderOptions options;
+    PageBuilder* raw_builder = nullptr;
+    CHECK(BinaryDictPageBuilder::create(&raw_builder, options).ok());
+    std::unique_ptr<PageBuilder> builder(raw_builder);
+    size_t count = values.size();
+    CHECK(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+    OwnedSlice page;
+    CHECK(builder->finish(&page).ok());
+    OwnedSlice dict_page;
+    CHECK(builder->get_dictionary_page(&dict_page).ok());
+
+    BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> dict_decoder(dict_page.slice());
+    CHECK(dict_decoder.init().ok());
+    std::vector<StringRef> dict_word_info(dict_decoder.count());
+    CHECK(dict_decoder.get_dict_word_info(dict_word_info.data()).ok());
+
+    BitShufflePagePreDecoder<true> pre_decoder;
+    for (auto _ : state) {
+        Slice page_slice = page.slice();
+        std::unique_ptr<DataPage> decoded_page;
+        CHECK(pre_decoder.decode(&decoded_page, &page_slice, 0, false, PageTypePB::DATA_PAGE)
+                      .ok());
+        BinaryDictPageDecoder decoder(page_slice, PageDecoderOptions());
+        CHECK(decoder.init().ok());
+        decoder.set_dict_decoder(&dict_decoder, dict_word_info.data());
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        size_t rows = values.size();
+        CHECK(decoder.next_batch(&rows, column).ok());
+        benchmark::DoNotOptimize(column);
+    }
+    page_benchmark_set_counters(state, values.size(), page.slice().size + dict_page.slice().size);
+}
+
+// The compression of the pages by PageIO. Args: compression type, cardinality of the values.
+static void BM_PageCompress(benchmark::State& state) {
+    BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(static_cast<CompressionTypePB>(state.range(0)), &codec)
+                  .ok());
+    auto values = page_benchmark_values<int64_t>(PAGE_BENCHMARK_ROWS, state.range(1));
+    Slice input(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int64_t));
+    faststring compressed;
+    for (auto _ : state) {
+        CHECK(codec->compress(input, &compressed).ok());
+        benchmark::DoNotOptimize(compressed.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input.size));
+    state.counters["ratio"] =
+            static_cast<double>(input.size) / static_cast<double>(compressed.size());
+}
+
+// Args: compression type, cardinality of the values.
+static void BM_PageDecompress(benchmark::State& state) {
+    BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(static_cast<CompressionTypePB>(state.range(0)), &codec)
+                  .ok());
+    auto values = page_benchmark_values<int64_t>(PAGE_BENCHMARK_ROWS, state.range(1));
+    Slice input(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int64_t));
+    faststring compressed;
+    CHECK(codec->compress(input, &compressed).ok());
+    std::vector<char> buffer(input.size);
+    for (auto _ : state) {
+        Slice output(buffer.data(), buffer.size());
+        CHECK(codec->decompress(Slice(compressed.data(), compressed.size()), &output).ok());
+        benchmark::DoNotOptimize(output.data);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * input.size));
+}
+
+BENCHMARK_TEMPLATE(BM_BitshufflePageEncode, FieldType::OLAP_FIELD_TYPE_INT)
+        ->Arg(16)
+        ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_BitshufflePageEncode, FieldType::OLAP_FIELD_TYPE_BIGINT)
+        ->Arg(16)
+        ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_BitshufflePageDecode, FieldType::OLAP_FIELD_TYPE_INT)
+        ->Arg(16)
+        ->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_BitshufflePageDecode, FieldType::OLAP_FIELD_TYPE_BIGINT)
+        ->Arg(16)
+        ->Arg(1 << 20);
+BENCHMARK(BM_FrameOfReferencePageDecode)->Arg(16)->Arg(1 << 20);
+BENCHMARK(BM_BinaryDictPageDecode)->ArgsProduct({{16, 1024}, {8, 64}});
+BENCHMARK(BM_PageCompress)
+        ->ArgsProduct({{CompressionTypePB::LZ4F, CompressionTypePB::ZSTD,
+                        CompressionTypePB::SNAPPY},
+                       {16, 1 << 20}});
+BENCHMARK(BM_PageDecompress)
+        ->ArgsProduct({{CompressionTypePB::LZ4F, CompressionTypePB::ZSTD,
+                        CompressionTypePB::SNAPPY},
+                       {16, 1 << 20}});
+
+} // namespace doris::segment_v2
@@ -111,9 +111,13 @@ void BeExecVersionManager::check_function_compatibility(int current_be_exec_vers
  * 7: start from doris 3.0.2
  *    a. window funnel logic change
 *     b. support const column in serialize/deserialize function: PR #41175
+ *
+ * 9: a. compress the columns of a serialized block in independent frames
+ *    b. percentile_approx does not serialize the cumulative weights of the t-digest
+ *    c. serialize the low-cardinality string columns as a dictionary and codes
  */
 
-const int BeExecVersionManager::max_be_exec_version = 8;
+const int BeExecVersionManager::max_be_exec_version = 9;
 const int BeExecVersionManager::min_be_exec_version = 0;
 std::map<std::string, std::set<int>> BeExecVersionManager::_function_change_map {};
 std::set<std::string> BeExecVersionManager::_function_restrict_map;
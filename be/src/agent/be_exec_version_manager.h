@@ -32,6 +32,10 @@ constexpr inline int AGGREGATION_2_1_VERSION =
         6; // some aggregation changed the data format after this version
 constexpr inline int USE_CONST_SERDE =
         8; // support const column in serialize/deserialize function: PR #41175
+constexpr inline int COLUMN_COMPRESSION_FRAMES =
+        9; // compress the columns of a serialized block in independent frames
+constexpr inline int STRING_DICTIONARY_SERDE =
+        9; // serialize the low-cardinality string columns as a dictionary and codes
 
 class BeExecVersionManager {
 public:
@@ -21,7 +21,21 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
+#include <set>
+#include <string_view>
+
+#if !defined(__APPLE__)
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
 
 #include "util/cgroup_util.h"
 #include "util/defer_op.h"
@@ -109,6 +123,17 @@ void CgroupCpuCtl::init_doris_cgroup_path() {
     std::string query_path_msg = _is_cgroup_query_path_valid ? "cgroup query path is valid"
                                                              : "cgroup query path is not valid";
     _cpu_core_num = CpuInfo::num_cores();
+#if !defined(__APPLE__)
+    // the threads not bound to a cpuset keep the cpus of the process
+    cpu_set_t process_cpu_set;
+    if (sched_getaffinity(0, sizeof(process_cpu_set), &process_cpu_set) == 0) {
+        for (int core = 0; core < CpuInfo::get_max_num_cores() && core < CPU_SETSIZE; ++core) {
+            if (CPU_ISSET(core, &process_cpu_set)) {
+                _process_cores.push_back(core);
+            }
+        }
+    }
+#endif
 
     std::string init_cg_v2_msg = "";
     if (_is_enable_cgroup_v2_in_env && _is_cgroup_query_path_valid) {
@@ -204,6 +229,139 @@ void CgroupCpuCtl::update_cpu_soft_limit(int cpu_shares) {
     }
 }
 
+void CgroupCpuCtl::update_cpuset(const std::string& cpuset) {
+    if (!_init_succ) {
+        return;
+    }
+    std::lock_guard<std::shared_mutex> w_lock(_lock_mutex);
+    if (_cpuset != cpuset) {
+        std::vector<int> cores;
+        Status ret = parse_cpuset(cpuset, &cores);
+        if (ret.ok()) {
+            ret = modify_cg_cpuset_no_lock(cores);
+        }
+        if (ret.ok()) {
+            _cpuset = cpuset;
+            _cpuset_cores = std::move(cores);
+        } else {
+            LOG(WARNING) << "update cpuset failed, cpuset: " << cpuset << ", error: " << ret;
+        }
+    }
+}
+
+Status CgroupCpuCtl::parse_cpuset(const std::string& cpuset, std::vector<int>* cores) {
+    cores->clear();
+    std::string_view spec = cpuset;
+    bool is_numa_nodes = spec.starts_with("numa:");
+    if (is_numa_nodes) {
+        spec.remove_prefix(strlen("numa:"));
+    }
+    if (spec.empty()) {
+        return is_numa_nodes ? Status::InvalidArgument<false>("invalid cpuset {}", cpuset)
+                             : Status::OK();
+    }
+    int id_limit =
+            is_numa_nodes ? CpuInfo::get_max_num_numa_nodes() : CpuInfo::get_max_num_cores();
+    std::set<int> ids;
+    while (!spec.empty()) {
+        std::string_view range = spec.substr(0, spec.find(','));
+        spec.remove_prefix(std::min(spec.size(), range.size() + 1));
+        const char* end = range.data() + range.size();
+        int first = -1;
+        auto res = std::from_chars(range.data(), end, first);
+        int last = first;
+        if (res.ec == std::errc() && res.ptr != end && *res.ptr == '-') {
+            res = std::from_chars(res.ptr + 1, end, last);
+        }
+        if (res.ec != std::errc() || res.ptr != end || first < 0 || first > last ||
+            last >= id_limit) {
+            return Status::InvalidArgument<false>("invalid cpuset {}", cpuset);
+        }
+        for (int id = first; id <= last; ++id) {
+            ids.insert(id);
+        }
+    }
+    if (!is_numa_nodes) {
+        cores->assign(ids.begin(), ids.end());
+        return Status::OK();
+    }
+    std::set<int> numa_cores;
+    for (int node : ids) {
+        const auto& node_cores = CpuInfo::get_cores_of_numa_node(node);
+        numa_cores.insert(node_cores.begin(), node_cores.end());
+    }
+    cores->assign(numa_cores.begin(), numa_cores.end());
+    return Status::OK();
+}
+
+#if !defined(__APPLE__)
+static void to_cpu_set(const std::vector<int>& cores, cpu_set_t* cpu_set) {
+    CPU_ZERO(cpu_set);
+    for (int core : cores) {
+        if (core < CPU_SETSIZE) {
+            CPU_SET(core, cpu_set);
+        }
+    }
+}
+
+// Prefers the memory of the numa nodes of `cores` for the allocations of the current thread, or
+// the default policy if they are all the nodes.
+static void prefer_numa_nodes_of_cores(const std::vector<int>& cores) {
+    int num_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (num_nodes <= 1 || num_nodes > 64) {
+        return;
+    }
+    uint64_t nodemask = 0;
+    for (int core : cores) {
+        nodemask |= 1ULL << CpuInfo::get_numa_node_of_core(core);
+    }
+    int mode = MPOL_DEFAULT;
+    if (nodemask != 0 && nodemask != (~0ULL >> (64 - num_nodes))) {
+#ifdef MPOL_PREFERRED_MANY
+        mode = std::popcount(nodemask) == 1 ? MPOL_PREFERRED : MPOL_PREFERRED_MANY;
+#else
+        mode = std::popcount(nodemask) == 1 ? MPOL_PREFERRED : MPOL_DEFAULT;
+#endif
+    }
+    const uint64_t* mask = mode == MPOL_DEFAULT ? nullptr : &nodemask;
+    auto max_node = static_cast<unsigned long>(mode == MPOL_DEFAULT ? 0 : num_nodes + 1);
+    if (syscall(SYS_set_mempolicy, mode, mask, max_node) != 0) {
+        LOG(WARNING) << "set memory policy failed, mode=" << mode << ", err=" << strerror(errno);
+    }
+}
+#endif
+
+Status CgroupCpuCtl::bind_cgroup_threads_to_cores(const std::string& task_file,
+                                                  const std::vector<int>& cores) {
+#if defined(__APPLE__)
+    //unsupported now
+    return Status::OK();
+#else
+    const auto& bound_cores = cores.empty() ? _process_cores : cores;
+    if (bound_cores.empty()) {
+        return Status::OK();
+    }
+    cpu_set_t cpu_set;
+    to_cpu_set(bound_cores, &cpu_set);
+    std::ifstream tasks(task_file);
+    if (!tasks.is_open()) {
+        return Status::InternalError<false>("open path failed, path={}", task_file);
+    }
+    // the memory policy of a thread can only be set by itself, so only the threads started
+    // afterwards allocate from the new numa nodes
+    pid_t tid = 0;
+    while (tasks >> tid) {
+        // ESRCH if the thread has exited since
+        if (sched_setaffinity(tid, sizeof(cpu_set), &cpu_set) != 0 && errno != ESRCH) {
+            return Status::InternalError<false>("bind thread {} to cpuset failed, err={}", tid,
+                                                strerror(errno));
+        }
+    }
+    LOG(INFO) << "bind threads of " << task_file << " to " << cores.size() << " cores success";
+    return Status::OK();
+#endif
+}
+
 Status CgroupCpuCtl::write_cg_sys_file(std::string file_path, std::string value, std::string msg,
                                        bool is_append) {
     int fd = open(file_path.c_str(), is_append ? O_RDWR | O_APPEND : O_RDWR);
@@ -240,7 +398,23 @@ Status CgroupCpuCtl::add_thread_to_cgroup(std::string task_path) {
     std::string msg =
             "add thread " + std::to_string(tid) + " to group" + " " + std::to_string(_wg_id);
     std::lock_guard<std::shared_mutex> w_lock(_lock_mutex);
-    return CgroupCpuCtl::write_cg_sys_file(task_path, std::to_string(tid), msg, true);
+    RETURN_IF_ERROR(CgroupCpuCtl::write_cg_sys_file(task_path, std::to_string(tid), msg, true));
+    if (config::workload_group_cpusets.empty() && _cpuset_cores.empty()) {
+        return Status::OK();
+    }
+    // a new thread inherits the cpus and memory policy of its creator, which may be a thread of
+    // another workload group, so they are always reset
+    const auto& cores = _cpuset_cores.empty() ? _process_cores : _cpuset_cores;
+    if (!cores.empty()) {
+        cpu_set_t cpu_set;
+        to_cpu_set(cores, &cpu_set);
+        if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+            return Status::InternalError<false>("bind thread {} to cpuset failed, err={}", tid,
+                                                strerror(errno));
+        }
+    }
+    prefer_numa_nodes_of_cores(_cpuset_cores);
+    return Status::OK();
 #endif
 }
 
@@ -349,6 +523,10 @@ Status CgroupV1CpuCtl::modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) {
     return CgroupCpuCtl::write_cg_sys_file(_cgroup_v1_cpu_tg_quota_file, str_val, msg, false);
 }
 
+Status CgroupV1CpuCtl::modify_cg_cpuset_no_lock(const std::vector<int>& cores) {
+    return CgroupCpuCtl::bind_cgroup_threads_to_cores(_cgroup_v1_cpu_tg_task_file, cores);
+}
+
 Status CgroupV1CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v1_cpu_tg_task_file);
 }
@@ -421,6 +599,10 @@ Status CgroupV2CpuCtl::modify_cg_cpu_soft_limit_no_lock(int cpu_weight) {
                                            false);
 }
 
+Status CgroupV2CpuCtl::modify_cg_cpuset_no_lock(const std::vector<int>& cores) {
+    return CgroupCpuCtl::bind_cgroup_threads_to_cores(_cgroup_v2_query_wg_thread_file, cores);
+}
+
 Status CgroupV2CpuCtl::add_thread_to_cgroup() {
     return CgroupCpuCtl::add_thread_to_cgroup(_cgroup_v2_query_wg_thread_file);
 }
@@ -21,6 +21,8 @@
 #include <unistd.h>
 
 #include <shared_mutex>
+#include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -41,6 +43,11 @@ public:
 
     void update_cpu_soft_limit(int cpu_shares);
 
+    // Binds the threads of the workload group to the cpus of `cpuset` and allocates the memory of
+    // the threads started afterwards from the numa nodes of these cpus, see
+    // config::workload_group_cpusets. An empty `cpuset` unbinds them.
+    void update_cpuset(const std::string& cpuset);
+
     // for log
     void get_cgroup_cpu_info(uint64_t* cpu_shares, int* cpu_hard_limit);
 
@@ -54,13 +61,22 @@ public:
 
     static uint64_t cpu_soft_limit_default_value();
 
+    // Parses a cpu list like "0-7,16" or the numa nodes like "numa:0,1" into sorted cores.
+    static Status parse_cpuset(const std::string& cpuset, std::vector<int>* cores);
+
 protected:
     virtual Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) = 0;
 
     virtual Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) = 0;
 
+    virtual Status modify_cg_cpuset_no_lock(const std::vector<int>& cores) = 0;
+
     Status add_thread_to_cgroup(std::string task_file);
 
+    // Binds the threads listed in the tasks file of the workload group to `cores`.
+    static Status bind_cgroup_threads_to_cores(const std::string& task_file,
+                                               const std::vector<int>& cores);
+
     static Status write_cg_sys_file(std::string file_path, std::string value, std::string msg,
                                     bool is_append);
 
@@ -75,6 +91,8 @@ protected:
     inline static bool _is_enable_cgroup_v1_in_env = false;
     inline static bool _is_enable_cgroup_v2_in_env = false;
     inline static bool _is_cgroup_query_path_valid = false;
+    // the cpus the process was started on
+    inline static std::vector<int> _process_cores;
 
     // cgroup v2 public file
     inline static std::string _doris_cgroup_cpu_path_subtree_ctl_file = "";
@@ -87,6 +105,9 @@ protected:
     bool _init_succ = false;
     uint64_t _wg_id = -1; // workload group id
     uint64_t _cpu_shares = 0;
+    std::string _cpuset;
+    // empty if the threads are not bound
+    std::vector<int> _cpuset_cores;
 };
 
 /*
@@ -121,6 +142,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::vector<int>& cores) override;
     Status add_thread_to_cgroup() override;
 
 private:
@@ -169,6 +191,7 @@ public:
     Status init() override;
     Status modify_cg_cpu_hard_limit_no_lock(int cpu_hard_limit) override;
     Status modify_cg_cpu_soft_limit_no_lock(int cpu_shares) override;
+    Status modify_cg_cpuset_no_lock(const std::vector<int>& cores) override;
     Status add_thread_to_cgroup() override;
 
 private:
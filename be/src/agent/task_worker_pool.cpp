@@ -46,6 +46,7 @@
 #include <vector>
 
 #include "agent/utils.h"
+#include "cloud/cloud_delete_bitmap_store.h"
 #include "cloud/cloud_delete_task.h"
 #include "cloud/cloud_engine_calc_delete_bitmap_task.h"
 #include "cloud/cloud_schema_change_job.h"
@@ -1859,6 +1860,9 @@ void drop_tablet_callback(CloudStorageEngine& engine, const TAgentTaskRequest& r
     }
 
     engine.tablet_mgr().erase_tablet(drop_tablet_req.tablet_id);
+    if (auto* store = engine.delete_bitmap_store(); store != nullptr) {
+        store->remove(drop_tablet_req.tablet_id);
+    }
     LOG(INFO) << "drop cloud tablet_id=" << drop_tablet_req.tablet_id
               << " and clean file cache first 10 rowsets {" << rowset_ids_stream.str() << "}, cost "
               << static_cast<double>(watch.elapsed_time()) / 1e9 << "(s)";
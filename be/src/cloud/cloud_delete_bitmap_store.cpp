@@ -0,0 +1,183 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "cloud/cloud_delete_bitmap_store.h"
+
+#include <bvar/bvar.h>
+#include <gen_cpp/olap_file.pb.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "cloud/cloud_tablet.h"
+#include "cloud/config.h"
+#include "common/logging.h"
+#include "util/crc32c.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+bvar::Adder<uint64_t> delete_bitmap_store_save_num("cloud_delete_bitmap_store", "save_num");
+bvar::Adder<uint64_t> delete_bitmap_store_load_num("cloud_delete_bitmap_store", "load_num");
+
+CloudDeleteBitmapStore::CloudDeleteBitmapStore(std::string root_path)
+        : _root_path(std::move(root_path)) {}
+
+Status CloudDeleteBitmapStore::init() {
+    std::error_code ec;
+    std::filesystem::create_directories(_root_path, ec);
+    if (ec) {
+        return Status::IOError("failed to create delete bitmap store dir {}: {}", _root_path,
+                               ec.message());
+    }
+    return Status::OK();
+}
+
+std::string CloudDeleteBitmapStore::_path(int64_t tablet_id) const {
+    return fmt::format("{}/{}.dbm", _root_path, tablet_id);
+}
+
+Status CloudDeleteBitmapStore::maybe_save(CloudTablet* tablet, bool force) {
+    const int64_t tablet_id = tablet->tablet_id();
+    auto now = std::chrono::steady_clock::now();
+    {
+        std::lock_guard lock(_mtx);
+        auto it = _last_save_time.find(tablet_id);
+        if (!force && it != _last_save_time.end() &&
+            now - it->second <
+                    std::chrono::seconds(config::cloud_delete_bitmap_store_save_interval_s)) {
+            return Status::OK();
+        }
+        _last_save_time[tablet_id] = now;
+    }
+
+    int64_t version = 0;
+    RowsetIdUnorderedSet rowset_ids;
+    {
+        std::shared_lock rlock(tablet->get_header_lock());
+        version = tablet->max_version_unlocked();
+        RETURN_IF_ERROR(tablet->get_all_rs_id_unlocked(version, &rowset_ids));
+    }
+    return save(tablet_id, version, rowset_ids,
+                tablet->tablet_meta()->delete_bitmap().snapshot());
+}
+
+// The file is the serialized DeleteBitmapPB followed by its crc32c. The covered rowsets are
+// recorded by entries of INVALID_SEGMENT_ID on the snapshot version with empty bitmaps.
+Status CloudDeleteBitmapStore::save(int64_t tablet_id, int64_t version,
+                                    const RowsetIdUnorderedSet& rowset_ids,
+                                    const DeleteBitmap& delete_bitmap) {
+    DeleteBitmapPB pb;
+    for (const auto& [key, bitmap] : delete_bitmap.delete_bitmap) {
+        const auto& [rowset_id, segment_id, ver] = key;
+        if (!rowset_ids.contains(rowset_id) || ver > version ||
+            segment_id == DeleteBitmap::INVALID_SEGMENT_ID) {
+            continue;
+        }
+        pb.add_rowset_ids(rowset_id.to_string());
+        pb.add_segment_ids(segment_id);
+        pb.add_versions(ver);
+        std::string bitmap_data(bitmap.getSizeInBytes(), '\0');
+        bitmap.write(bitmap_data.data());
+        *(pb.add_segment_delete_bitmaps()) = std::move(bitmap_data);
+    }
+    for (const auto& rowset_id : rowset_ids) {
+        pb.add_rowset_ids(rowset_id.to_string());
+        pb.add_segment_ids(DeleteBitmap::INVALID_SEGMENT_ID);
+        pb.add_versions(version);
+        pb.add_segment_delete_bitmaps();
+    }
+
+    std::string data;
+    if (!pb.SerializeToString(&data)) {
+        return Status::InternalError("failed to serialize delete bitmap of tablet {}", tablet_id);
+    }
+    uint32_t checksum = crc32c::Value(data.data(), data.size());
+    std::string path = _path(tablet_id);
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        out.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+        if (!out.good()) {
+            return Status::IOError("failed to write delete bitmap file {}", tmp_path);
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        return Status::IOError("failed to rename {} to {}", tmp_path, path);
+    }
+    delete_bitmap_store_save_num << 1;
+    return Status::OK();
+}
+
+Status CloudDeleteBitmapStore::load(int64_t tablet_id, int64_t* version,
+                                    RowsetIdUnorderedSet* rowset_ids,
+                                    DeleteBitmap* delete_bitmap) {
+    std::string path = _path(tablet_id);
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) {
+        return Status::NotFound("no delete bitmap file of tablet {}", tablet_id);
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    uint32_t checksum = 0;
+    if (data.size() < sizeof(checksum)) {
+        return Status::NotFound("truncated delete bitmap file {}", path);
+    }
+    memcpy(&checksum, data.data() + data.size() - sizeof(checksum), sizeof(checksum));
+    data.resize(data.size() - sizeof(checksum));
+    DeleteBitmapPB pb;
+    if (checksum != crc32c::Value(data.data(), data.size()) || !pb.ParseFromString(data) ||
+        pb.rowset_ids_size() != pb.segment_ids_size() ||
+        pb.rowset_ids_size() != pb.versions_size() ||
+        pb.rowset_ids_size() != pb.segment_delete_bitmaps_size()) {
+        LOG(WARNING) << "corrupted delete bitmap file " << path;
+        remove(tablet_id);
+        return Status::NotFound("corrupted delete bitmap file {}", path);
+    }
+
+    *version = -1;
+    for (int i = 0; i < pb.rowset_ids_size(); ++i) {
+        RowsetId rowset_id;
+        rowset_id.init(pb.rowset_ids(i));
+        if (pb.segment_ids(i) == DeleteBitmap::INVALID_SEGMENT_ID) {
+            rowset_ids->insert(rowset_id);
+            *version = pb.versions(i);
+            continue;
+        }
+        const auto& bitmap = pb.segment_delete_bitmaps(i);
+        delete_bitmap->merge({rowset_id, pb.segment_ids(i), pb.versions(i)},
+                             roaring::Roaring::readSafe(bitmap.data(), bitmap.size()));
+    }
+    if (rowset_ids->empty()) {
+        return Status::NotFound("empty delete bitmap file {}", path);
+    }
+    delete_bitmap_store_load_num << 1;
+    return Status::OK();
+}
+
+void CloudDeleteBitmapStore::remove(int64_t tablet_id) {
+    {
+        std::lock_guard lock(_mtx);
+        _last_save_time.erase(tablet_id);
+    }
+    std::error_code ec;
+    std::filesystem::remove(_path(tablet_id), ec);
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/tablet_meta.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+class CloudTablet;
+
+// Persists the delete bitmaps of the merge-on-write tablets on local disk, so that after a restart
+// the BE only syncs the delete bitmaps of the versions newer than the persisted ones from meta
+// service instead of the whole delete bitmaps of the tablets.
+//
+// A snapshot of a tablet records its delete bitmap of the rowsets up to a version. The delete
+// bitmap of a rowset on the versions not newer than the snapshot version does not change, except
+// that meta service may aggregate the versions, which keeps their union.
+class CloudDeleteBitmapStore {
+public:
+    explicit CloudDeleteBitmapStore(std::string root_path);
+
+    Status init();
+
+    // Saves the snapshot of the tablet if `force` or the last one is older than
+    // `cloud_delete_bitmap_store_save_interval_s`.
+    Status maybe_save(CloudTablet* tablet, bool force);
+
+    // Saves the delete bitmap of `rowset_ids` on the versions not newer than `version`.
+    Status save(int64_t tablet_id, int64_t version, const RowsetIdUnorderedSet& rowset_ids,
+                const DeleteBitmap& delete_bitmap);
+
+    // Loads the snapshot of the tablet, returns NOT_FOUND if there is no valid snapshot.
+    // `rowset_ids` are the rowsets the snapshot covers, whose delete bitmap on the versions not
+    // newer than `version` are in `delete_bitmap`.
+    Status load(int64_t tablet_id, int64_t* version, RowsetIdUnorderedSet* rowset_ids,
+                DeleteBitmap* delete_bitmap);
+
+    void remove(int64_t tablet_id);
+
+private:
+    std::string _path(int64_t tablet_id) const;
+
+    const std::string _root_path;
+    std::mutex _mtx;
+    // tablet id -> time of the last saved snapshot
+    std::unordered_map<int64_t, std::chrono::steady_clock::time_point> _last_save_time;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
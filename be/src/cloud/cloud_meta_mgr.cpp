@@ -37,6 +37,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "cloud/cloud_delete_bitmap_store.h"
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet.h"
 #include "cloud/config.h"
@@ -820,6 +821,16 @@ Status CloudMetaMgr::sync_tablet_rowsets_unlocked(CloudTablet* tablet,
             tablet->reset_approximate_stats(stats.num_rowsets(), stats.num_segments(),
                                             stats.num_rows(), stats.data_size());
         }
+        auto* store = ExecEnv::GetInstance()->storage_engine().to_cloud().delete_bitmap_store();
+        if (store != nullptr && options.sync_delete_bitmap &&
+            tablet->enable_unique_key_merge_on_write() &&
+            tablet->tablet_state() == TABLET_RUNNING && !resp.rowset_meta().empty()) {
+            // Always persist the delete bitmap synced on the first time
+            auto st = store->maybe_save(tablet, req.start_version() <= 1);
+            if (!st.ok()) {
+                LOG_WARNING("failed to persist delete bitmap, " + tablet_info).error(st);
+            }
+        }
         return Status::OK();
     }
 }
@@ -902,10 +913,49 @@ Status CloudMetaMgr::sync_tablet_delete_bitmap(CloudTablet* tablet, int64_t old_
     req.set_cumulative_compaction_cnt(stats.cumulative_compaction_cnt());
     req.set_cumulative_point(stats.cumulative_point());
     *(req.mutable_idx()) = idx;
+
+    // On the first sync after a restart, the delete bitmap of the rowsets covered by the local
+    // snapshot only needs the versions newer than the snapshot
+    int64_t stored_version = -1;
+    RowsetIdUnorderedSet stored_rowset_ids;
+    auto* store = ExecEnv::GetInstance()->storage_engine().to_cloud().delete_bitmap_store();
+    if (store != nullptr && old_max_version <= 0 && !full_sync) {
+        DeleteBitmap stored_delete_bitmap(tablet->tablet_id());
+        if (store->load(tablet->tablet_id(), &stored_version, &stored_rowset_ids,
+                        &stored_delete_bitmap)
+                    .ok()) {
+            for (const auto& rs_meta : rs_metas) {
+                RowsetId rowset_id;
+                rowset_id.init(rs_meta.rowset_id_v2());
+                if (!stored_rowset_ids.contains(rowset_id)) {
+                    continue;
+                }
+                stored_delete_bitmap.subset(
+                        {rowset_id, 0, 0},
+                        {rowset_id, std::numeric_limits<DeleteBitmap::SegmentId>::max(),
+                         std::numeric_limits<DeleteBitmap::Version>::max()},
+                        delete_bitmap);
+            }
+        } else {
+            stored_rowset_ids.clear();
+        }
+    }
+
     // New rowset sync all versions of delete bitmap
     for (const auto& rs_meta : rs_metas) {
+        int64_t begin_version = 0;
+        if (!stored_rowset_ids.empty()) {
+            RowsetId rowset_id;
+            rowset_id.init(rs_meta.rowset_id_v2());
+            if (stored_rowset_ids.contains(rowset_id)) {
+                begin_version = stored_version + 1;
+                if (begin_version > new_max_version) {
+                    continue;
+                }
+            }
+        }
         req.add_rowset_ids(rs_meta.rowset_id_v2());
-        req.add_begin_versions(0);
+        req.add_begin_versions(begin_version);
         req.add_end_versions(new_max_version);
     }
 
@@ -922,6 +972,9 @@ Status CloudMetaMgr::sync_tablet_delete_bitmap(CloudTablet* tablet, int64_t old_
     if (sync_stats) {
         sync_stats->get_remote_delete_bitmap_rowsets_num += req.rowset_ids_size();
     }
+    if (req.rowset_ids_size() == 0) {
+        return Status::OK();
+    }
 
     VLOG_DEBUG << "send GetDeleteBitmapRequest: " << req.ShortDebugString();
 
@@ -34,6 +34,7 @@
 #include "cloud/cloud_compaction_stop_token.h"
 #include "cloud/cloud_cumulative_compaction.h"
 #include "cloud/cloud_cumulative_compaction_policy.h"
+#include "cloud/cloud_delete_bitmap_store.h"
 #include "cloud/cloud_full_compaction.h"
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_snapshot_mgr.h"
@@ -215,6 +216,12 @@ Status CloudStorageEngine::open() {
                     : config::delete_bitmap_agg_cache_capacity);
     RETURN_IF_ERROR(_txn_delete_bitmap_cache->init());
 
+    if (!config::cloud_delete_bitmap_store_path.empty()) {
+        _delete_bitmap_store =
+                std::make_unique<CloudDeleteBitmapStore>(config::cloud_delete_bitmap_store_path);
+        RETURN_IF_ERROR(_delete_bitmap_store->init());
+    }
+
     _file_cache_block_downloader = std::make_unique<io::FileCacheBlockDownloader>(*this);
 
     _cloud_warm_up_manager = std::make_unique<CloudWarmUpManager>(*this);
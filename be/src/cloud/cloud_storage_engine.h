@@ -50,6 +50,7 @@ class TabletHotspot;
 class CloudWarmUpManager;
 class CloudCompactionStopToken;
 class CloudSnapshotMgr;
+class CloudDeleteBitmapStore;
 
 class CloudStorageEngine final : public BaseStorageEngine {
 public:
@@ -75,6 +76,8 @@ public:
     CloudSnapshotMgr& cloud_snapshot_mgr() { return *_cloud_snapshot_mgr; }
 
     CloudTxnDeleteBitmapCache& txn_delete_bitmap_cache() const { return *_txn_delete_bitmap_cache; }
+    // nullptr if `cloud_delete_bitmap_store_path` is empty
+    CloudDeleteBitmapStore* delete_bitmap_store() const { return _delete_bitmap_store.get(); }
     SchemaCloudDictionaryCache& get_schema_cloud_dictionary_cache() {
         return *_schema_cloud_dictionary_cache;
     }
@@ -179,6 +182,7 @@ private:
     std::unique_ptr<cloud::CloudMetaMgr> _meta_mgr;
     std::unique_ptr<CloudTabletMgr> _tablet_mgr;
     std::unique_ptr<CloudTxnDeleteBitmapCache> _txn_delete_bitmap_cache;
+    std::unique_ptr<CloudDeleteBitmapStore> _delete_bitmap_store;
     std::unique_ptr<ThreadPool> _calc_tablet_delete_bitmap_task_thread_pool;
     std::unique_ptr<SchemaCloudDictionaryCache> _schema_cloud_dictionary_cache;
 
@@ -169,6 +169,9 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
         }
     }
 
+    // The syncs started before this request can not see the rowsets committed after it arrived.
+    const int64_t arrival = _sync_rowsets_started.load(std::memory_order_acquire);
+
     // serially execute sync to reduce unnecessary network overhead
     std::unique_lock lock(_sync_meta_lock);
     if (options.query_version > 0) {
@@ -178,10 +181,23 @@ Status CloudTablet::sync_rowsets(const SyncOptions& options, SyncRowsetStats* st
         }
     }
 
+    // Concurrent requests of the same tablet (e.g. many scanners of a query) queue up on
+    // `_sync_meta_lock`, a plain sync which completed after starting later than this request
+    // arrived has fetched everything this request would, so it does not go to meta service.
+    const bool coalescible =
+            !options.full_sync && !options.warmup_delta_data && !options.merge_schema;
+    if (coalescible && _covering_sync_rowsets_start > arrival) {
+        return Status::OK();
+    }
+
+    const int64_t start = _sync_rowsets_started.fetch_add(1, std::memory_order_acq_rel) + 1;
     auto st = _engine.meta_mgr().sync_tablet_rowsets_unlocked(this, lock, options, stats);
     if (st.is<ErrorCode::NOT_FOUND>()) {
         clear_cache();
     }
+    if (st.ok() && options.sync_delete_bitmap) {
+        _covering_sync_rowsets_start = start;
+    }
 
     return st;
 }
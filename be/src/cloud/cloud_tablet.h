@@ -297,6 +297,11 @@ private:
     // this mutex MUST ONLY be used when sync meta
     bthread::Mutex _sync_meta_lock;
     // ATTENTION: lock order should be: _sync_meta_lock -> _meta_lock
+    // Number of the syncs of rowsets which have been started
+    std::atomic<int64_t> _sync_rowsets_started {0};
+    // Sequence number of the last successful sync whose result covers the plain syncs arrived
+    // before it started, guarded by `_sync_meta_lock`
+    int64_t _covering_sync_rowsets_start = -1;
 
     std::atomic<int64_t> _cumulative_point {-1};
     std::atomic<int64_t> _approximate_num_rowsets {-1};
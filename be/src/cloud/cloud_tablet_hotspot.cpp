@@ -20,6 +20,8 @@
 #include <chrono>
 #include <mutex>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_warm_up_manager.h"
 #include "cloud/config.h"
 #include "olap/tablet_fwd.h"
 #include "runtime/exec_env.h"
@@ -39,7 +41,15 @@ void TabletHotspot::count(const BaseTablet& tablet) {
         counter = iter->second;
     }
     counter->last_access_time = std::chrono::system_clock::now();
-    counter->cur_counter++;
+    uint64_t cur_counter = ++counter->cur_counter;
+    // The tablet turns hot when its queries of the last day reach the threshold, which happens
+    // once until the tablet cools down since the number only decreases at the hourly dot points.
+    if (config::enable_hot_tablet_warm_up &&
+        counter->day_history_counter + cur_counter ==
+                static_cast<uint64_t>(config::hot_tablet_warm_up_query_threshold)) {
+        auto& engine = ExecEnv::GetInstance()->storage_engine().to_cloud();
+        engine.cloud_warm_up_manager().warm_up_hot_tablet(tablet.tablet_id());
+    }
 }
 
 TabletHotspot::TabletHotspot() {
@@ -26,6 +26,7 @@
 
 #include "cloud/cloud_tablet_mgr.h"
 #include "common/logging.h"
+#include "cpp/s3_rate_limiter.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/segment_v2/inverted_index_desc.h"
@@ -36,9 +37,17 @@
 namespace doris {
 
 bvar::Adder<uint64_t> file_cache_warm_up_failed_task_num("file_cache_warm_up", "failed_task_num");
+bvar::Adder<uint64_t> hot_tablet_warm_up_tablet_num("file_cache_warm_up", "hot_tablet_num");
+bvar::Adder<uint64_t> hot_tablet_warm_up_submitted_bytes("file_cache_warm_up",
+                                                         "hot_tablet_submitted_bytes");
+bvar::Adder<int64_t> hot_tablet_warm_up_throttled_ns("file_cache_warm_up",
+                                                     "hot_tablet_throttled_ns");
+bvar::Adder<int64_t> hot_tablet_warm_up_throttled_num("file_cache_warm_up",
+                                                      "hot_tablet_throttled_num");
 
 CloudWarmUpManager::CloudWarmUpManager(CloudStorageEngine& engine) : _engine(engine) {
     _download_thread = std::thread(&CloudWarmUpManager::handle_jobs, this);
+    _hot_tablet_thread = std::thread(&CloudWarmUpManager::handle_hot_tablets, this);
 }
 
 CloudWarmUpManager::~CloudWarmUpManager() {
@@ -47,9 +56,13 @@ CloudWarmUpManager::~CloudWarmUpManager() {
         _closed = true;
     }
     _cond.notify_all();
+    _hot_tablet_cond.notify_all();
     if (_download_thread.joinable()) {
         _download_thread.join();
     }
+    if (_hot_tablet_thread.joinable()) {
+        _hot_tablet_thread.join();
+    }
 }
 
 std::unordered_map<std::string, RowsetMetaSharedPtr> snapshot_rs_metas(BaseTablet* tablet) {
@@ -65,7 +78,8 @@ std::unordered_map<std::string, RowsetMetaSharedPtr> snapshot_rs_metas(BaseTable
 void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
                                                io::FileSystemSPtr file_system,
                                                int64_t expiration_time,
-                                               std::shared_ptr<bthread::CountdownEvent> wait) {
+                                               std::shared_ptr<bthread::CountdownEvent> wait,
+                                               S3RateLimiterHolder* limiter) {
     if (file_size < 0) {
         auto st = file_system->file_size(path, &file_size);
         if (!st.ok()) [[unlikely]] {
@@ -81,6 +95,11 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
 
     while (remaining_size > 0) {
         int64_t current_chunk_size = std::min(chunk_size, remaining_size);
+        if (limiter != nullptr) {
+            // Sleeps until the bandwidth allows the chunk
+            limiter->add(current_chunk_size);
+            hot_tablet_warm_up_submitted_bytes << current_chunk_size;
+        }
         wait->add_count();
 
         _engine.file_cache_block_downloader().submit_download_task(io::DownloadFileMeta {
@@ -108,6 +127,60 @@ void CloudWarmUpManager::submit_download_tasks(io::Path path, int64_t file_size,
     }
 }
 
+void CloudWarmUpManager::warm_up_rowset(RowsetMeta& rs, int64_t ttl_seconds,
+                                        std::shared_ptr<bthread::CountdownEvent> wait,
+                                        S3RateLimiterHolder* limiter) {
+    for (int64_t seg_id = 0; seg_id < rs.num_segments(); seg_id++) {
+        auto storage_resource = rs.remote_storage_resource();
+        if (!storage_resource) {
+            LOG(WARNING) << storage_resource.error();
+            continue;
+        }
+
+        int64_t expiration_time = ttl_seconds == 0 || rs.newest_write_timestamp() <= 0
+                                          ? 0
+                                          : rs.newest_write_timestamp() + ttl_seconds;
+        if (expiration_time <= UnixSeconds()) {
+            expiration_time = 0;
+        }
+
+        // 1st. download segment files
+        submit_download_tasks(storage_resource.value()->remote_segment_path(rs, seg_id),
+                              rs.segment_file_size(seg_id), storage_resource.value()->fs,
+                              expiration_time, wait, limiter);
+
+        // 2nd. download inverted index files
+        int64_t file_size = -1;
+        auto schema_ptr = rs.tablet_schema();
+        auto idx_version = schema_ptr->get_inverted_index_storage_format();
+        const auto& idx_file_info = rs.inverted_index_file_info(seg_id);
+        if (idx_version == InvertedIndexStorageFormatPB::V1) {
+            for (const auto& index : schema_ptr->inverted_indexes()) {
+                auto idx_path = storage_resource.value()->remote_idx_v1_path(
+                        rs, seg_id, index->index_id(), index->get_index_suffix());
+                if (idx_file_info.index_info_size() > 0) {
+                    for (const auto& idx_info : idx_file_info.index_info()) {
+                        if (index->index_id() == idx_info.index_id() &&
+                            index->get_index_suffix() == idx_info.index_suffix()) {
+                            file_size = idx_info.index_file_size();
+                            break;
+                        }
+                    }
+                }
+                submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
+                                      expiration_time, wait, limiter);
+            }
+        } else {
+            if (schema_ptr->has_inverted_index()) {
+                auto idx_path = storage_resource.value()->remote_idx_v2_path(rs, seg_id);
+                file_size = idx_file_info.has_index_size() ? idx_file_info.index_size() : -1;
+                submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
+                                      expiration_time, wait, limiter);
+            }
+        }
+    }
+}
+
 void CloudWarmUpManager::handle_jobs() {
 #ifndef BE_TEST
     constexpr int WAIT_TIME_SECONDS = 600;
@@ -148,62 +221,9 @@ void CloudWarmUpManager::handle_jobs() {
                 continue;
             }
 
-            auto tablet_meta = tablet->tablet_meta();
             auto rs_metas = snapshot_rs_metas(tablet.get());
             for (auto& [_, rs] : rs_metas) {
-                for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
-                    auto storage_resource = rs->remote_storage_resource();
-                    if (!storage_resource) {
-                        LOG(WARNING) << storage_resource.error();
-                        continue;
-                    }
-
-                    int64_t expiration_time =
-                            tablet_meta->ttl_seconds() == 0 || rs->newest_write_timestamp() <= 0
-                                    ? 0
-                                    : rs->newest_write_timestamp() + tablet_meta->ttl_seconds();
-                    if (expiration_time <= UnixSeconds()) {
-                        expiration_time = 0;
-                    }
-
-                    // 1st. download segment files
-                    submit_download_tasks(
-                            storage_resource.value()->remote_segment_path(*rs, seg_id),
-                            rs->segment_file_size(seg_id), storage_resource.value()->fs,
-                            expiration_time, wait);
-
-                    // 2nd. download inverted index files
-                    int64_t file_size = -1;
-                    auto schema_ptr = rs->tablet_schema();
-                    auto idx_version = schema_ptr->get_inverted_index_storage_format();
-                    const auto& idx_file_info = rs->inverted_index_file_info(seg_id);
-                    if (idx_version == InvertedIndexStorageFormatPB::V1) {
-                        for (const auto& index : schema_ptr->inverted_indexes()) {
-                            auto idx_path = storage_resource.value()->remote_idx_v1_path(
-                                    *rs, seg_id, index->index_id(), index->get_index_suffix());
-                            if (idx_file_info.index_info_size() > 0) {
-                                for (const auto& idx_info : idx_file_info.index_info()) {
-                                    if (index->index_id() == idx_info.index_id() &&
-                                        index->get_index_suffix() == idx_info.index_suffix()) {
-                                        file_size = idx_info.index_file_size();
-                                        break;
-                                    }
-                                }
-                            }
-                            submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
-                                                  expiration_time, wait);
-                        }
-                    } else {
-                        if (schema_ptr->has_inverted_index()) {
-                            auto idx_path =
-                                    storage_resource.value()->remote_idx_v2_path(*rs, seg_id);
-                            file_size = idx_file_info.has_index_size() ? idx_file_info.index_size()
-                                                                       : -1;
-                            submit_download_tasks(idx_path, file_size, storage_resource.value()->fs,
-                                                  expiration_time, wait);
-                        }
-                    }
-                }
+                warm_up_rowset(*rs, tablet->tablet_meta()->ttl_seconds(), wait);
             }
         }
 
@@ -227,6 +247,69 @@ void CloudWarmUpManager::handle_jobs() {
 #endif
 }
 
+void CloudWarmUpManager::warm_up_hot_tablet(int64_t tablet_id) {
+    // Bounds the memory of the pending tablets, a hot tablet is counted again later.
+    constexpr size_t MAX_PENDING_HOT_TABLETS = 10000;
+    {
+        std::lock_guard lock(_mtx);
+        if (_pending_hot_tablets.size() >= MAX_PENDING_HOT_TABLETS ||
+            !_pending_hot_tablets.insert(tablet_id).second) {
+            return;
+        }
+        _hot_tablets.push_back(tablet_id);
+    }
+    _hot_tablet_cond.notify_all();
+}
+
+void CloudWarmUpManager::handle_hot_tablets() {
+#ifndef BE_TEST
+    constexpr int WAIT_TIME_SECONDS = 600;
+    int64_t bytes_per_second = 0;
+    std::unique_ptr<S3RateLimiterHolder> limiter;
+    while (true) {
+        int64_t tablet_id = 0;
+        {
+            std::unique_lock lock(_mtx);
+            _hot_tablet_cond.wait(lock, [this]() { return _closed || !_hot_tablets.empty(); });
+            if (_closed) break;
+            tablet_id = _hot_tablets.front();
+            _hot_tablets.pop_front();
+        }
+
+        if (int64_t limit = std::max<int64_t>(1, config::hot_tablet_warm_up_bytes_per_second);
+            limit != bytes_per_second) {
+            bytes_per_second = limit;
+            limiter = std::make_unique<S3RateLimiterHolder>(
+                    bytes_per_second, bytes_per_second, 0,
+                    metric_func_factory(hot_tablet_warm_up_throttled_ns,
+                                        hot_tablet_warm_up_throttled_num));
+        }
+
+        auto wait = std::make_shared<bthread::CountdownEvent>(0);
+        auto res = _engine.tablet_mgr().get_tablet(tablet_id);
+        if (res.has_value()) {
+            auto tablet = res.value();
+            hot_tablet_warm_up_tablet_num << 1;
+            for (auto& [_, rs] : snapshot_rs_metas(tablet.get())) {
+                warm_up_rowset(*rs, tablet->tablet_meta()->ttl_seconds(), wait, limiter.get());
+            }
+        } else {
+            LOG_WARNING("Warm up hot tablet error").tag("tablet_id", tablet_id).error(res.error());
+        }
+
+        timespec time;
+        time.tv_sec = UnixSeconds() + WAIT_TIME_SECONDS;
+        time.tv_nsec = 0;
+        if (wait->timed_wait(time)) {
+            LOG_WARNING("Warm up hot tablet {} takes a long time", tablet_id);
+        }
+        // The tablet can be warmed up again after its downloads finish.
+        std::lock_guard lock(_mtx);
+        _pending_hot_tablets.erase(tablet_id);
+    }
+#endif
+}
+
 JobMeta::JobMeta(const TJobMeta& meta)
         : be_ip(meta.be_ip), brpc_port(meta.brpc_port), tablet_ids(meta.tablet_ids) {
     switch (meta.download_type) {
@@ -24,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "cloud/cloud_storage_engine.h"
@@ -31,6 +32,7 @@
 #include "gen_cpp/BackendService.h"
 
 namespace doris {
+class S3RateLimiterHolder;
 
 enum class DownloadType {
     BE,
@@ -69,11 +71,21 @@ public:
     // Cancel the job
     Status clear_job(int64_t job_id);
 
+    // Download the rowsets of the tablet which turns hot into the file cache in background, the
+    // download bandwidth is limited by `hot_tablet_warm_up_bytes_per_second`
+    void warm_up_hot_tablet(int64_t tablet_id);
+
 private:
     void handle_jobs();
+    void handle_hot_tablets();
+    // Submit the download tasks of the segments and the inverted indexes of the rowset
+    void warm_up_rowset(RowsetMeta& rs, int64_t ttl_seconds,
+                        std::shared_ptr<bthread::CountdownEvent> wait,
+                        S3RateLimiterHolder* limiter = nullptr);
     void submit_download_tasks(io::Path path, int64_t file_size, io::FileSystemSPtr file_system,
                                int64_t expiration_time,
-                               std::shared_ptr<bthread::CountdownEvent> wait);
+                               std::shared_ptr<bthread::CountdownEvent> wait,
+                               S3RateLimiterHolder* limiter = nullptr);
     std::mutex _mtx;
     std::condition_variable _cond;
     int64_t _cur_job_id {0};
@@ -82,6 +94,11 @@ private:
     std::vector<std::shared_ptr<JobMeta>> _finish_job;
     std::thread _download_thread;
     bool _closed {false};
+    // The hot tablets to warm up and the set of them, guarded by `_mtx`
+    std::deque<int64_t> _hot_tablets;
+    std::unordered_set<int64_t> _pending_hot_tablets;
+    std::condition_variable _hot_tablet_cond;
+    std::thread _hot_tablet_thread;
     // the attribute for compile in ut
     [[maybe_unused]] CloudStorageEngine& _engine;
 };
@@ -91,5 +91,15 @@ DEFINE_mInt32(meta_service_conflict_error_retry_times, "10");
 
 DEFINE_Bool(enable_check_storage_vault, "true");
 
+DEFINE_mBool(enable_hot_tablet_warm_up, "false");
+
+DEFINE_mInt64(hot_tablet_warm_up_query_threshold, "1000");
+
+DEFINE_mInt64(hot_tablet_warm_up_bytes_per_second, "104857600");
+
+DEFINE_String(cloud_delete_bitmap_store_path, "");
+
+DEFINE_mInt64(cloud_delete_bitmap_store_save_interval_s, "600");
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
@@ -127,5 +127,17 @@ DECLARE_mInt32(meta_service_conflict_error_retry_times);
 
 DECLARE_Bool(enable_check_storage_vault);
 
+// Whether to download the rowsets of a tablet into the file cache when it turns hot
+DECLARE_mBool(enable_hot_tablet_warm_up);
+// A tablet turns hot when it is queried this many times in the last day on this BE
+DECLARE_mInt64(hot_tablet_warm_up_query_threshold);
+// The max bytes per second downloaded by the warm up of the hot tablets
+DECLARE_mInt64(hot_tablet_warm_up_bytes_per_second);
+// The dir persisting the delete bitmaps of the merge-on-write tablets, so that only the delete
+// bitmaps of the new versions are synced from meta service after a restart. Empty to disable.
+DECLARE_String(cloud_delete_bitmap_store_path);
+// The min interval of persisting the delete bitmap of a tablet
+DECLARE_mInt64(cloud_delete_bitmap_store_save_interval_s);
+
 #include "common/compile_check_end.h"
 } // namespace doris::config
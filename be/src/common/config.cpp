@@ -138,6 +138,17 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+// The max bytes of the freed column buffers that a pipeline task keeps to reuse for its following
+// allocations of the same sizes while it runs on a thread, 0 to disable.
+DEFINE_mInt64(column_buffer_pool_bytes_per_task, "67108864");
+
+// Whether the allocations of at least huge_page_alloc_threshold_bytes, e.g. the buffers of the
+// hash tables of join and aggregation and the large columns, are aligned to 2MB and advised to be
+// backed by transparent huge pages (madvise), to reduce their TLB misses.
+DEFINE_mBool(enable_huge_page_for_large_alloc, "false");
+// The min bytes of an allocation to be backed by transparent huge pages.
+DEFINE_mInt64(huge_page_alloc_threshold_bytes, "8388608");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -146,6 +157,11 @@ DEFINE_mInt32(max_fill_rate, "2");
 
 DEFINE_mInt32(double_resize_threshold, "23");
 
+// Once the buckets of a join hash table exceed this size, the table is built partition by
+// partition, each partition covering this many bytes of buckets, and the probe prefetches the
+// bucket chains, to save the cache misses of big build sides. 0 means disable.
+DEFINE_mInt64(hash_join_cache_partition_bytes, "1048576");
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -257,6 +273,10 @@ DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 DEFINE_mInt32(download_low_speed_time, "300");
 // whether to download small files in batch
 DEFINE_mBool(enable_batch_download, "true");
+// the count of thread to download the file batches of clone tasks concurrently
+DEFINE_Int32(clone_download_thread_num, "16");
+// the max number of file batches of a clone task downloaded concurrently
+DEFINE_mInt32(clone_download_parallelism, "4");
 // whether to check md5sum when download
 DEFINE_mBool(enable_download_md5sum_check, "false");
 // download binlog meta timeout, default 30s
@@ -293,6 +313,11 @@ DEFINE_Int32(be_service_threads, "64");
 // The pipeline task has a high concurrency, therefore reducing its report frequency
 DEFINE_mInt32(pipeline_status_report_interval, "10");
 DEFINE_mInt32(pipeline_task_exec_time_slice, "100");
+DEFINE_mBool(enable_numa_aware_task_steal, "true");
+DEFINE_mInt32(pipeline_task_cross_numa_steal_delay_ms, "5");
+DEFINE_Bool(enable_lock_free_pipeline_task_queue, "false");
+DEFINE_mInt32(pipeline_task_core_affinity_max_queue_size, "16");
+DEFINE_mBool(enable_pipeline_task_perf_counters, "false");
 
 // task executor min concurrency per task
 DEFINE_Int32(task_executor_min_concurrency_per_task, "1");
@@ -349,12 +374,17 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 // single read execute fragment max run time millseconds
 DEFINE_mInt32(doris_scanner_max_run_time_ms, "1000");
+DEFINE_mBool(enable_adaptive_parallel_scan_split, "true");
+DEFINE_mInt32(parallel_scan_split_target_ms, "500");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+// the max number of rowsets of a tablet converted concurrently by a schema change job, which
+// share the memory limitation of the job
+DEFINE_mInt32(schema_change_convert_rowset_parallelism, "4");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "60");
@@ -404,6 +434,8 @@ DEFINE_Int32(storage_page_cache_shard_size, "256");
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DEFINE_Int32(index_page_cache_percentage, "10");
+DEFINE_String(lru_cache_tiny_lfu_admission_types, "");
+DEFINE_String(lru_cache_clock_read_types, "");
 // whether to disable page cache feature in storage
 DEFINE_mBool(disable_storage_page_cache, "false");
 // whether to disable row cache feature in storage
@@ -656,10 +688,15 @@ DEFINE_Int32(min_buffer_size, "1024"); // 1024, The minimum read buffer size (in
 
 // for pprof
 DEFINE_String(pprof_profile_dir, "${DORIS_HOME}/log");
+DEFINE_Bool(enable_cpu_sampler, "false");
+DEFINE_Int32(cpu_sampler_frequency, "10");
+DEFINE_Int32(cpu_sampler_capacity, "262144");
+DEFINE_mInt32(lock_contention_hold_sample_interval, "64");
 // for jeprofile in jemalloc
 DEFINE_mString(jeprofile_dir, "${DORIS_HOME}/log");
 DEFINE_mBool(enable_je_purge_dirty_pages, "true");
 DEFINE_mInt32(je_dirty_decay_ms, "5000");
+DEFINE_Bool(enable_workload_group_je_arena, "false");
 
 // to forward compatibility, will be removed later
 DEFINE_mBool(enable_token_check, "true");
@@ -686,6 +723,7 @@ DEFINE_mInt32(memory_gc_sleep_time_ms, "500");
 DEFINE_mInt64(write_buffer_size, "209715200");
 // max buffer size used in memtable for the aggregated table, default 400MB
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
+DEFINE_mBool(enable_memtable_hash_aggregation, "true");
 
 DEFINE_mInt64(min_write_buffer_size_for_partial_update, "1048576");
 // max parallel flush task per memtable writer
@@ -740,6 +778,9 @@ DEFINE_Bool(enable_metric_calculator, "true");
 // max consumer num in one data consumer group, for routine load
 DEFINE_mInt32(max_consumer_num_per_group, "3");
 
+// max number of kafka messages a consumer puts into the queue of its group at a time
+DEFINE_mInt32(routine_load_consume_batch_size, "64");
+
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
 DEFINE_Int32(max_routine_load_thread_pool_size, "1024");
@@ -790,6 +831,8 @@ DEFINE_Int32(high_priority_flush_thread_num_per_store, "6");
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DEFINE_Int32(max_flush_thread_num_per_cpu, "4");
+DEFINE_mInt32(flush_column_encode_parallelism, "4");
+DEFINE_mInt32(flush_column_encode_min_columns, "64");
 
 // config for tablet meta checkpoint
 DEFINE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num, "10");
@@ -840,6 +883,10 @@ DEFINE_Int32(query_cache_elasticity_size_mb, "128");
 // Maximum number of cache partitions corresponding to a SQL
 DEFINE_Int32(query_cache_max_partition_count, "1024");
 
+// Keep the build block of a hash join in the query cache if FE sets the query cache param on the
+// join node, a repeated query then skips the scan of its build side.
+DEFINE_mBool(enable_hash_join_build_cache, "false");
+
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
 // This is to avoid too many version num.
@@ -883,6 +930,13 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
+// The max length that the batch of the untracked memory of a thread grows to. The batch starts
+// from mem_tracker_consume_min_size_bytes and doubles at each consumption while the limiter of the
+// thread and the process are far from their limits, and is reset to the min when they are near.
+DEFINE_mInt32(mem_tracker_consume_max_size_bytes, "4194304");
+// The max bytes that the limit checks of the allocations of a thread pass without checking its
+// MemTrackerLimiter, leased from the headroom of the limiter. 0 to check the limiter every time.
+DEFINE_mInt64(mem_tracker_limit_check_lease_bytes, "8388608");
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -915,6 +969,9 @@ DEFINE_Int32(load_stream_max_wait_flush_token_time_ms, "600000");
 DEFINE_Int32(send_batch_thread_pool_thread_num, "64");
 // number of send batch thread pool queue size
 DEFINE_Int32(send_batch_thread_pool_queue_size, "102400");
+// number of threads compressing the column frames of the blocks sent by exchange in parallel,
+// 0 means the frames are compressed by the sending thread only
+DEFINE_Int32(block_compression_thread_pool_thread_num, "16");
 
 // Limit the number of segment of a newly created rowset.
 // The newly created rowset may to be compacted after loading,
@@ -997,6 +1054,7 @@ DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
+DEFINE_mBool(enable_adaptive_remote_read_size, "true");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -1005,6 +1063,16 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 
 // Perform the always_true check at intervals determined by runtime_filter_sampling_frequency
 DEFINE_mInt32(runtime_filter_sampling_frequency, "64");
+// Size the bloom filters built by runtime size from an HLL estimate of the distinct build keys
+// instead of the number of build rows.
+DEFINE_mBool(enable_runtime_filter_ndv_sizing, "true");
+// Shorten the wait for a runtime filter from the outcome of the previous filters of the same
+// expressions: skip it if it was useless lately, or wait a few times its usual latency.
+DEFINE_mBool(enable_adaptive_runtime_filter_wait, "true");
+// The shortest wait for a runtime filter derived from its usual latency.
+DEFINE_mInt32(runtime_filter_adaptive_min_wait_time_ms, "10");
+// The fewest probe rows for the selectivity of a runtime filter to be recorded.
+DEFINE_mInt64(runtime_filter_adaptive_min_input_rows, "4096");
 DEFINE_mInt32(execution_max_rpc_timeout_sec, "3600");
 DEFINE_mBool(execution_ignore_eovercrowded, "true");
 // cooldown task configs
@@ -1073,6 +1141,10 @@ DEFINE_Int64(segcompaction_task_max_bytes, "157286400");
 // Global segcompaction thread pool size.
 DEFINE_mInt32(segcompaction_num_threads, "5");
 
+// Max number of segment groups compacted concurrently by a single segcompaction task, each
+// group is compacted into one segment.
+DEFINE_mInt32(segcompaction_task_max_groups, "4");
+
 DEFINE_mInt32(segcompaction_wait_for_dbm_task_timeout_s, "3600"); // 1h
 
 // enable java udf and jdbc scannode
@@ -1123,6 +1195,11 @@ DEFINE_mInt64(file_cache_evict_in_advance_batch_bytes, "31457280"); // 30MB
 DEFINE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold, "1000");
 
 DEFINE_mBool(enable_read_cache_file_directly, "false");
+// Whether the blocks of the file cache on disk are compressed by LZ4, and decompressed when
+// they are read. A block is kept uncompressed if its compression ratio is lower than
+// file_cache_block_compression_min_ratio.
+DEFINE_mBool(enable_file_cache_block_compression, "false");
+DEFINE_mDouble(file_cache_block_compression_min_ratio, "1.5");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "true");
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
@@ -1161,6 +1238,7 @@ DEFINE_Int32(inverted_index_query_cache_shards, "256");
 
 // inverted index match bitmap cache size
 DEFINE_String(inverted_index_query_cache_limit, "10%");
+DEFINE_mInt64(inverted_index_query_cache_admission_min_us, "50");
 
 // inverted index
 DEFINE_mDouble(inverted_index_ram_buffer_size, "512");
@@ -1185,6 +1263,9 @@ DEFINE_Int32(num_broadcast_buffer, "32");
 
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
+// Whether the identical subexpressions of the projections of an operator are executed once
+// per block.
+DEFINE_mBool(enable_projection_common_subexpr_elimination, "true");
 
 // Report a tablet as bad when io errors occurs more than this value.
 DEFINE_mInt64(max_tablet_io_errors, "-1");
@@ -1195,6 +1276,7 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt64(s3_file_buffer_pool_max_bytes, "104857600");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1220,7 +1302,14 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "20000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "28800");
+DEFINE_mBool(enable_hdfs_hedged_read, "false");
+DEFINE_mInt32(hdfs_hedged_read_thread_num, "128");
+DEFINE_mInt32(hdfs_hedged_read_threshold_ms, "0");
+DEFINE_mDouble(hdfs_hedged_read_latency_percentile, "95");
+DEFINE_mString(hdfs_short_circuit_domain_socket_path, "");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+// The memory the parsed parquet footers and the orc file tails in the file meta cache take at most.
+DEFINE_Int64(max_external_file_meta_cache_bytes, "1073741824");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1309,6 +1398,8 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mInt32(group_commit_adaptive_interval_ratio, "1");
+DEFINE_mBool(enable_group_commit_wal_compression, "true");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1320,6 +1411,10 @@ DEFINE_Bool(enable_flush_file_cache_async, "true");
 
 // cgroup
 DEFINE_String(doris_cgroup_cpu_path, "");
+// Binds the threads of workload groups to cpus, as `<workload group name>:<cpus>` separated by
+// ';', where <cpus> is a cpu list like "0-7,16-23" or the numa nodes like "numa:1". The memory of
+// the threads is allocated from the numa nodes of their cpus. Needs doris_cgroup_cpu_path.
+DEFINE_mString(workload_group_cpusets, "");
 
 DEFINE_mBool(enable_be_proc_monitor, "false");
 DEFINE_mInt32(be_proc_monitor_interval_ms, "10000");
@@ -1347,6 +1442,32 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+// Whether local exchange sinks push blocks into a lock-free ring per sink and source pair
+DEFINE_mBool(enable_local_exchange_ring_matrix, "false");
+// Capacity of each ring used by local exchange. Blocks go to the shared queue if a ring is full
+DEFINE_mInt32(local_exchange_ring_capacity, "16");
+DEFINE_Validator(local_exchange_ring_capacity, [](const int config) -> bool { return config > 0; });
+// Whether exchange sink chooses the compression of each destination instance by the observed
+// throughput of its RPCs
+DEFINE_mBool(enable_exchange_adaptive_compression, "false");
+// Number of RPCs of one instance between two adaptive compression decisions
+DEFINE_mInt32(exchange_adaptive_compression_window_rpcs, "16");
+// Links faster than this use LZ4 or no compression
+DEFINE_mInt64(exchange_adaptive_compression_fast_link_mb_per_sec, "1024");
+// Links slower than this use ZSTD
+DEFINE_mInt64(exchange_adaptive_compression_slow_link_mb_per_sec, "128");
+// Minimum compression ratio to keep compressing on a fast link
+DEFINE_mDouble(exchange_adaptive_compression_min_ratio, "2.0");
+// Send the column values of exchange blocks in the brpc attachment without copying them into
+// the request. All backends of the cluster must support it before turning it on.
+DEFINE_mBool(exchange_transmit_block_by_attachment, "false");
+// Send broadcast exchange blocks once per destination backend, which hands them to all its
+// instances. All backends of the cluster must support it before turning it on.
+DEFINE_mBool(exchange_broadcast_once_per_host, "false");
+// Merge the small blocks already queued in the exchange receiver into blocks of batch size rows,
+// at most exchange_receiver_coalesce_bytes bytes. It never waits for more blocks to arrive.
+DEFINE_mBool(enable_exchange_receiver_coalesce_blocks, "false");
+DEFINE_mInt64(exchange_receiver_coalesce_bytes, "8388608");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1383,6 +1504,23 @@ DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
 // paused query in queue timeout(ms) will be resumed or canceled
 DEFINE_Int64(spill_in_paused_queue_timeout_ms, "60000");
 
+// A spilled hash join partition whose build side is larger than this is split again by a hash
+// with another seed instead of being built in memory, up to spill_hash_join_max_repartition_level.
+DEFINE_mInt64(spill_hash_join_repartition_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_max_repartition_level, "3");
+// The bytes of the following blocks of a spill file that the kernel is asked to read ahead into
+// the page cache while a spilled block is deserialized and processed, 0 to disable.
+DEFINE_mInt64(spill_read_ahead_bytes, "8388608");
+// When the process memory reaches this percent of the soft memory limit, the queries are paused
+// to spill their revocable memory before their reservations fail, the queries of the workload
+// groups of lower cpu share first. 0 to disable.
+DEFINE_mInt32(proactive_spill_soft_mem_limit_percent, "0");
+// Whether a spill stream is written to the object storage of the latest storage vault (cloud mode
+// only) when all of the local spill storage paths reach their limits.
+DEFINE_mBool(enable_spill_to_remote_storage, "false");
+// The limit of the bytes that the spill streams of a BE can write to the remote spill storage.
+DEFINE_mInt64(spill_remote_storage_limit_bytes, "1099511627776");
+
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
 DEFINE_mBool(force_azure_blob_global_endpoint, "false");
@@ -1390,6 +1528,17 @@ DEFINE_mBool(force_azure_blob_global_endpoint, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 DEFINE_mInt32(s3_read_base_wait_time_ms, "100");
 DEFINE_mInt32(s3_read_max_wait_time_ms, "800");
+// A read of an s3 file of at least 2 parts of s3_read_parallel_part_bytes is split into
+// parts, at most s3_read_max_parallel_parts, which are read by parallel GETs. 0 disables it.
+DEFINE_mInt64(s3_read_parallel_part_bytes, "8388608");
+DEFINE_mInt32(s3_read_max_parallel_parts, "8");
+// A read of an s3 file of at most s3_small_read_bytes shares the GET of a concurrent read of
+// the file which covers it, if enable_s3_small_read_coalescing is true. If its GET is not done
+// in s3_read_hedge_delay_ms, another GET of it is issued, and the first done serves the read.
+// 0 disables the hedged GETs.
+DEFINE_mInt64(s3_small_read_bytes, "1048576");
+DEFINE_mBool(enable_s3_small_read_coalescing, "true");
+DEFINE_mInt32(s3_read_hedge_delay_ms, "0");
 DEFINE_mBool(enable_s3_object_check_after_upload, "true");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
@@ -1429,9 +1578,18 @@ DEFINE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_
               "15728640"); // 15MB
 // Maximum processed partition nums of per writer when partition writing
 DEFINE_mInt32(table_sink_partition_write_max_partition_nums_per_writer, "128");
+// Whether a local hash shuffle in front of a partial aggregation spreads hot partitions
+// over several instances
+DEFINE_mBool(enable_local_shuffle_skew_rebalance, "false");
+// Minimum data processed to trigger skewed partition rebalancing in local shuffle
+DEFINE_mInt64(local_shuffle_min_data_processed_rebalance_threshold, "67108864"); // 64MB
+// Minimum partition data processed to rebalance a partition in local shuffle
+DEFINE_mInt64(local_shuffle_min_partition_data_processed_rebalance_threshold,
+              "16777216"); // 16MB
 
 /** Hive sink configurations **/
 DEFINE_mInt64(hive_sink_max_file_size, "1073741824"); // 1GB
+DEFINE_mInt64(hive_sink_sort_buffer_bytes, "0");
 
 /** Iceberg sink configurations **/
 DEFINE_mInt64(iceberg_sink_max_file_size, "1073741824"); // 1GB
@@ -1454,6 +1612,31 @@ DEFINE_mInt64(string_overflow_size, "4294967295"); // std::numic_limits<uint32_t
 DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_min_thread, "16");
 // The max thread num for BufferedReaderPrefetchThreadPool
 DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread, "64");
+// The min thread num for SegmentPagePrefetchThreadPool
+DEFINE_Int64(num_segment_page_prefetch_thread_pool_min_thread, "16");
+// The max thread num for SegmentPagePrefetchThreadPool
+DEFINE_Int64(num_segment_page_prefetch_thread_pool_max_thread, "64");
+// Whether a segment iterator reads the next data pages of its predicate columns ahead on
+// SegmentPagePrefetchThreadPool into the page cache, to hide the latency of remote storage.
+DEFINE_mBool(enable_segment_page_prefetch, "false");
+// The max number of data pages read ahead per predicate column of a segment iterator.
+DEFINE_mInt32(segment_page_prefetch_depth, "4");
+// The min thread num for FileCacheReadThreadPool
+DEFINE_Int64(num_file_cache_read_thread_pool_min_thread, "16");
+// The max thread num for FileCacheReadThreadPool
+DEFINE_Int64(num_file_cache_read_thread_pool_max_thread, "64");
+// Whether a read of the file cache which covers several downloaded blocks reads them
+// concurrently on FileCacheReadThreadPool.
+DEFINE_mBool(enable_file_cache_parallel_read, "true");
+// The bytes a cached remote file reader reads ahead into the file cache in the background when
+// the reads of a file are sequential, 0 disables the read ahead.
+DEFINE_mInt64(file_cache_read_ahead_bytes, "4194304");
+// The min thread num for SegmentLoadThreadPool
+DEFINE_Int64(num_segment_load_thread_pool_min_thread, "16");
+// The max thread num for SegmentLoadThreadPool
+DEFINE_Int64(num_segment_load_thread_pool_max_thread, "64");
+DEFINE_mBool(enable_parallel_segment_load, "true");
+DEFINE_mInt32(segment_footer_tail_read_bytes, "65536");
 // The min thread num for S3FileUploadThreadPool
 DEFINE_Int64(num_s3_file_upload_thread_pool_min_thread, "16");
 // The max thread num for S3FileUploadThreadPool
@@ -1482,6 +1665,8 @@ DEFINE_Bool(enable_jvm_monitor, "false");
 
 DEFINE_Int32(load_data_dirs_threads, "-1");
 
+DEFINE_Int32(load_tablet_metas_threads_per_data_dir, "4");
+
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DEFINE_mBool(skip_loading_stale_rowset_meta, "false");
 
@@ -1489,6 +1674,11 @@ DEFINE_Bool(enable_file_logger, "true");
 
 // The minimum row group size when exporting Parquet files. default 128MB
 DEFINE_Int64(min_row_group_size, "134217728");
+// The threads encoding and compressing the column chunks of the exported Parquet files, shared by
+// the writers. The column chunks of a row group are encoded in parallel on them, and written in
+// order when the row group is closed. -1 means the number of cores, 0 or 1 encodes the chunks one
+// by one on the sink thread.
+DEFINE_Int32(parquet_writer_encode_thread_num, "-1");
 
 DEFINE_mInt64(compaction_memory_bytes_limit, "1073741824");
 
@@ -1499,12 +1689,35 @@ DEFINE_mInt64(compaction_batch_size, "-1");
 // filter wrong data.
 DEFINE_mBool(enable_parquet_page_index, "true");
 
+// Whether to convert late-arrival IN and MINMAX runtime filters into column value ranges, so that
+// parquet and orc readers can skip row groups, pages and stripes by statistics.
+DEFINE_mBool(enable_runtime_filter_file_pruning, "true");
+
 DEFINE_mBool(ignore_not_found_file_in_external_table, "true");
 
 DEFINE_mBool(enable_hdfs_mem_limiter, "true");
 
 DEFINE_mInt16(topn_agg_limit_multiplier, "2");
 
+// The aggregation hash table of serialized or fixed keys is converted into a two-level one of
+// 256 sub tables once it holds more keys than this, so a resize only rehashes one sub table.
+// -1 means never convert.
+DEFINE_mInt64(two_level_aggregation_hash_table_threshold, "1048576");
+
+// The streaming pre-aggregation samples the reduction ratio (input rows / new groups) of every
+// window of this many input rows, and passes the input through without aggregating it when the
+// ratio is below streaming_agg_min_reduction_ratio. A non-positive value disables the sampling.
+DEFINE_mInt64(streaming_agg_reduction_window_rows, "262144");
+// The minimum reduction ratio of a window for the streaming pre-aggregation to keep aggregating.
+DEFINE_mDouble(streaming_agg_min_reduction_ratio, "1.2");
+// How many rows the streaming pre-aggregation passes through before it samples the reduction
+// ratio of a window again. A negative value means it never samples again.
+DEFINE_mInt64(streaming_agg_pass_through_probe_rows, "4194304");
+
+// Whether the sort keys of multiple integer (and date) columns are encoded into normalized binary
+// keys, so the rows are compared by memcmp in the sort of a block and the merge of sorted runs.
+DEFINE_mBool(enable_sort_normalized_keys, "true");
+
 // Tablet meta size limit after serialization, 1.5GB
 DEFINE_mInt64(tablet_meta_serialize_size_limit, "1610612736");
 // Protobuf supports a maximum of 2GB, so the size of the tablet meta after serialization must be less than 2GB
@@ -1521,6 +1734,7 @@ DEFINE_mBool(enable_pipeline_task_leakage_detect, "false");
 DEFINE_mInt32(check_score_rounds_num, "1000");
 
 DEFINE_Int32(query_cache_size, "512");
+DEFINE_mBool(enable_query_cache_incremental_reuse, "true");
 
 // Enable validation to check the correctness of table size.
 DEFINE_Bool(enable_table_size_correctness_check, "false");
@@ -1546,6 +1760,32 @@ DEFINE_mBool(enable_prune_delete_sign_when_base_compaction, "true");
 DEFINE_mBool(enable_mow_verbose_log, "false");
 
 DEFINE_mInt32(tablet_sched_delay_time_ms, "5000");
+// The max bytes per second of the background reads, i.e. compaction, schema change and checksum,
+// of a local data dir. -1 means no limit.
+DEFINE_mInt64(local_background_read_bytes_per_second_per_disk, "-1");
+// Whether the compaction, schema change and checksum reads of the segment data, and the query
+// reads of at least local_direct_read_min_bytes, read the local files with O_DIRECT. They bypass
+// the page cache, so they don't evict the hot index pages, nor cache the pages cached by the
+// StoragePageCache again. Falls back to the buffered reads if the file system lacks O_DIRECT.
+DEFINE_mBool(enable_local_direct_read, "false");
+DEFINE_mInt64(local_direct_read_min_bytes, "1048576");
+// The direct reads of a file are read ahead in a window of this size.
+DEFINE_mInt64(local_direct_read_ahead_bytes, "1048576");
+// The max bytes of the freed read ahead windows kept for the next direct readers.
+DEFINE_mInt64(local_direct_read_buffer_pool_max_bytes, "67108864");
+// At most so many reads of a local data dir, and of the remote storage, run at once, 0 means no
+// limit. The waiting reads are granted in turn to the workload group which has read the fewest
+// bytes per cpu share, or to a read whose query is about to time out, so the reads of a large
+// scan don't starve the short queries of another workload group.
+DEFINE_mInt32(io_scheduler_max_concurrent_local_reads, "0");
+DEFINE_mInt32(io_scheduler_max_concurrent_remote_reads, "0");
+// The weight of the reads which are not in a workload group, like the compaction reads.
+DEFINE_mInt32(io_scheduler_background_weight, "128");
+// A waiting read whose query times out in so many milliseconds goes before the other reads.
+DEFINE_mInt64(io_scheduler_deadline_slack_ms, "5000");
+// The compaction score of a tablet is multiplied by (1 + weight * scans per second of the tablet)
+// in cumulative compaction scheduling, at most 10 times. 0 means only the score is used.
+DEFINE_mDouble(compaction_score_scan_frequency_weight, "0.1");
 DEFINE_mInt32(load_trigger_compaction_version_percent, "66");
 DEFINE_mInt64(base_compaction_interval_seconds_since_last_operation, "86400");
 DEFINE_mBool(enable_compaction_pause_on_high_memory, "true");
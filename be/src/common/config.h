@@ -172,6 +172,17 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// The max bytes of the freed column buffers that a pipeline task keeps to reuse for its following
+// allocations of the same sizes while it runs on a thread, 0 to disable.
+DECLARE_mInt64(column_buffer_pool_bytes_per_task);
+
+// Whether the allocations of at least huge_page_alloc_threshold_bytes, e.g. the buffers of the
+// hash tables of join and aggregation and the large columns, are aligned to 2MB and advised to be
+// backed by transparent huge pages (madvise), to reduce their TLB misses.
+DECLARE_mBool(enable_huge_page_for_large_alloc);
+// The min bytes of an allocation to be backed by transparent huge pages.
+DECLARE_mInt64(huge_page_alloc_threshold_bytes);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -181,6 +192,11 @@ DECLARE_mInt32(max_fill_rate);
 
 DECLARE_mInt32(double_resize_threshold);
 
+// Once the buckets of a join hash table exceed this size, the table is built partition by
+// partition, each partition covering this many bytes of buckets, and the probe prefetches the
+// bucket chains, to save the cache misses of big build sides. 0 means disable.
+DECLARE_mInt64(hash_join_cache_partition_bytes);
+
 // The maximum low water mark of the system `/proc/meminfo/MemAvailable`, Unit byte, default -1.
 // if it is -1, then low water mark = min(MemTotal - MemLimit, MemTotal * 5%), which is 3.2G on a 64G machine.
 // Turn up max. more memory buffers will be reserved for Memory GC.
@@ -301,6 +317,10 @@ DECLARE_mInt32(download_low_speed_limit_kbps);
 DECLARE_mInt32(download_low_speed_time);
 // whether to download small files in batch.
 DECLARE_mBool(enable_batch_download);
+// the count of thread to download the file batches of clone tasks concurrently
+DECLARE_Int32(clone_download_thread_num);
+// the max number of file batches of a clone task downloaded concurrently
+DECLARE_mInt32(clone_download_parallelism);
 // whether to check md5sum when download
 DECLARE_mBool(enable_download_md5sum_check);
 // download binlog meta timeout
@@ -340,6 +360,20 @@ DECLARE_Int32(be_service_threads);
 DECLARE_mInt32(pipeline_status_report_interval);
 // Time slice for pipeline task execution (ms)
 DECLARE_mInt32(pipeline_task_exec_time_slice);
+// Whether pipeline workers steal tasks from cores of the same NUMA node before other nodes
+DECLARE_mBool(enable_numa_aware_task_steal);
+// How long (ms) an idle pipeline worker keeps stealing only from its own NUMA node
+// before it starts to steal tasks from other NUMA nodes
+DECLARE_mInt32(pipeline_task_cross_numa_steal_delay_ms);
+// Use lock-free sub queues in the multilevel feedback queue of pipeline workers, so that
+// push/take of a task does not need to lock the queue in the common case
+DECLARE_Bool(enable_lock_free_pipeline_task_queue);
+// A runnable pipeline task is put back to the task queue of the worker which ran it last time,
+// unless that queue already has more tasks than this threshold. -1 means no core affinity.
+DECLARE_mInt32(pipeline_task_core_affinity_max_queue_size);
+// Read the hardware counters (cycles, instructions, LLC misses and branch misses) of the
+// worker thread around each execution of a pipeline task and add them to the task profile.
+DECLARE_mBool(enable_pipeline_task_perf_counters);
 
 // task executor min concurrency per task
 DECLARE_mInt32(task_executor_min_concurrency_per_task);
@@ -378,12 +412,20 @@ DECLARE_mInt32(doris_scanner_row_num);
 DECLARE_mInt32(doris_scanner_row_bytes);
 // single read execute fragment max run time millseconds
 DECLARE_mInt32(doris_scanner_max_run_time_ms);
+// Whether the scanners built by ParallelScannerBuilder take the rows of their tablet in splits
+// sized by the scan speed, so an idle scanner reads the rows left instead of a slow one.
+DECLARE_mBool(enable_adaptive_parallel_scan_split);
+// The target scan time of one split of the adaptive parallel scan
+DECLARE_mInt32(parallel_scan_split_target_ms);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
 
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// the max number of rowsets of a tablet converted concurrently by a schema change job, which
+// share the memory limitation of the job
+DECLARE_mInt32(schema_change_convert_rowset_parallelism);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
@@ -435,6 +477,14 @@ DECLARE_Int32(storage_page_cache_shard_size);
 // Percentage for index page cache
 // all storage page cache will be divided into data_page_cache and index_page_cache
 DECLARE_Int32(index_page_cache_percentage);
+// The names of the caches, separated by comma, e.g. "DataPageCache,IndexPageCache", which admit
+// a new entry only if it is accessed more frequently than the entry it evicts, estimated by a
+// TinyLFU frequency sketch per shard. It keeps large scans from flushing the hot entries.
+DECLARE_String(lru_cache_tiny_lfu_admission_types);
+// The names of the caches, separated by comma, whose lookup only takes the shard lock shared
+// and does not reorder the LRU list, the entries are evicted by CLOCK instead of strict LRU.
+// It reduces the lock contention of the hot caches on the machines with many cores.
+DECLARE_String(lru_cache_clock_read_types);
 // whether to disable page cache feature in storage
 // TODO delete it. Divided into Data page, Index page, pk index page
 DECLARE_Bool(disable_storage_page_cache);
@@ -679,12 +729,26 @@ DECLARE_Int32(min_buffer_size); // 1024, The minimum read buffer size (in bytes)
 
 // for pprof
 DECLARE_String(pprof_profile_dir);
+// Sample the stacks of the threads with the query and the workload group of their tasks all the
+// time, the samples are served by /pprof/cpu_samples. The objects of the process must be loaded
+// before the sampler starts, which is after the JVM is loaded.
+DECLARE_Bool(enable_cpu_sampler);
+// The samples per second of the CPU time of the process.
+DECLARE_Int32(cpu_sampler_frequency);
+// The number of the latest samples kept.
+DECLARE_Int32(cpu_sampler_capacity);
+// One of every n exclusive acquisitions of the instrumented hot mutexes records its hold
+// time into the lock contention bvars, 0 to disable. The waits are always recorded.
+DECLARE_mInt32(lock_contention_hold_sample_interval);
 // for jeprofile in jemalloc
 DECLARE_mString(jeprofile_dir);
 // Purge all unused dirty pages for all arenas.
 DECLARE_mBool(enable_je_purge_dirty_pages);
 // Jemalloc `arenas.dirty_decay_ms`, equal to `dirty_decay_ms` in JEMALLOC_CONF in be.conf.
 DECLARE_mInt32(je_dirty_decay_ms);
+// Whether each workload group allocates from its own jemalloc arena, so that the dirty pages of
+// a group can be purged independently and the fragmentation of groups is isolated.
+DECLARE_Bool(enable_workload_group_je_arena);
 
 // to forward compatibility, will be removed later
 DECLARE_mBool(enable_token_check);
@@ -711,6 +775,9 @@ DECLARE_mInt32(memory_gc_sleep_time_ms);
 DECLARE_mInt64(write_buffer_size);
 // max buffer size used in memtable for the aggregated table, default 400MB
 DECLARE_mInt64(write_buffer_size_for_agg);
+// Whether to combine the rows of the same keys of an aggregate key table when they are inserted
+// into a memtable, so only the rows of distinct keys are sorted when it is aggregated.
+DECLARE_mBool(enable_memtable_hash_aggregation);
 
 DECLARE_mInt64(min_write_buffer_size_for_partial_update);
 // max parallel flush task per memtable writer
@@ -765,6 +832,9 @@ DECLARE_Bool(enable_metric_calculator);
 // max consumer num in one data consumer group, for routine load
 DECLARE_mInt32(max_consumer_num_per_group);
 
+// max number of kafka messages a consumer puts into the queue of its group at a time
+DECLARE_mInt32(routine_load_consume_batch_size);
+
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
 DECLARE_Int32(max_routine_load_thread_pool_size);
@@ -812,6 +882,12 @@ DECLARE_Int32(high_priority_flush_thread_num_per_store);
 // number of threads = min(flush_thread_num_per_store * num_store,
 //                         max_flush_thread_num_per_cpu * num_cpu)
 DECLARE_Int32(max_flush_thread_num_per_cpu);
+// The max number of value columns of a segment encoded at the same time when a memtable is
+// flushed, the columns are encoded one by one if it is not larger than 1.
+DECLARE_mInt32(flush_column_encode_parallelism);
+// The min number of columns of a table whose value columns are encoded in parallel on flush,
+// the tables with inverted indexes are encoded in parallel whatever their number of columns.
+DECLARE_mInt32(flush_column_encode_min_columns);
 
 // config for tablet meta checkpoint
 DECLARE_mInt32(tablet_meta_checkpoint_min_new_rowsets_num);
@@ -865,6 +941,10 @@ DECLARE_Int32(query_cache_elasticity_size_mb);
 // Maximum number of cache partitions corresponding to a SQL
 DECLARE_Int32(query_cache_max_partition_count);
 
+// Keep the build block of a hash join in the query cache if FE sets the query cache param on the
+// join node, a repeated query then skips the scan of its build side.
+DECLARE_mBool(enable_hash_join_build_cache);
+
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
 // This is to avoid too many version num.
@@ -904,6 +984,13 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
+// The max length that the batch of the untracked memory of a thread grows to. The batch starts
+// from mem_tracker_consume_min_size_bytes and doubles at each consumption while the limiter of the
+// thread and the process are far from their limits, and is reset to the min when they are near.
+DECLARE_mInt32(mem_tracker_consume_max_size_bytes);
+// The max bytes that the limit checks of the allocations of a thread pass without checking its
+// MemTrackerLimiter, leased from the headroom of the limiter. 0 to check the limiter every time.
+DECLARE_mInt64(mem_tracker_limit_check_lease_bytes);
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -936,6 +1023,9 @@ DECLARE_Int32(load_stream_max_wait_flush_token_time_ms);
 DECLARE_Int32(send_batch_thread_pool_thread_num);
 // number of send batch thread pool queue size
 DECLARE_Int32(send_batch_thread_pool_queue_size);
+// number of threads compressing the column frames of the blocks sent by exchange in parallel,
+// 0 means the frames are compressed by the sending thread only
+DECLARE_Int32(block_compression_thread_pool_thread_num);
 
 // Limit the number of segment of a newly created rowset.
 // The newly created rowset may to be compacted after loading,
@@ -1023,6 +1113,10 @@ DECLARE_mDouble(max_amplified_read_ratio);
 // 1MB for oss, 8KB for hdfs
 DECLARE_mInt32(merged_oss_min_io_size);
 DECLARE_mInt32(merged_hdfs_min_io_size);
+// Learn the equivalent IO size of S3, HDFS and the file cache from the latency and the bandwidth
+// of the finished reads, and use it instead of the merged min IO sizes to merge small IO, and to
+// size the prefetch buffers of remote files.
+DECLARE_mBool(enable_adaptive_remote_read_size);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -1030,6 +1124,16 @@ DECLARE_mInt64(big_column_size_buffer);
 DECLARE_mInt64(small_column_size_buffer);
 
 DECLARE_mInt32(runtime_filter_sampling_frequency);
+// Size the bloom filters built by runtime size from an HLL estimate of the distinct build keys
+// instead of the number of build rows.
+DECLARE_mBool(enable_runtime_filter_ndv_sizing);
+// Shorten the wait for a runtime filter from the outcome of the previous filters of the same
+// expressions: skip it if it was useless lately, or wait a few times its usual latency.
+DECLARE_mBool(enable_adaptive_runtime_filter_wait);
+// The shortest wait for a runtime filter derived from its usual latency.
+DECLARE_mInt32(runtime_filter_adaptive_min_wait_time_ms);
+// The fewest probe rows for the selectivity of a runtime filter to be recorded.
+DECLARE_mInt64(runtime_filter_adaptive_min_input_rows);
 DECLARE_mInt32(execution_max_rpc_timeout_sec);
 DECLARE_mBool(execution_ignore_eovercrowded);
 
@@ -1105,6 +1209,10 @@ DECLARE_Int32(segcompaction_wait_for_dbm_task_timeout_s);
 // Global segcompaction thread pool size.
 DECLARE_mInt32(segcompaction_num_threads);
 
+// Max number of segment groups compacted concurrently by a single segcompaction task, each
+// group is compacted into one segment.
+DECLARE_mInt32(segcompaction_task_max_groups);
+
 // enable java udf and jdbc scannode
 DECLARE_Bool(enable_java_support);
 
@@ -1143,6 +1251,11 @@ DECLARE_mInt32(file_cache_evict_in_advance_interval_ms);
 DECLARE_mInt64(file_cache_evict_in_advance_batch_bytes);
 DECLARE_mInt64(file_cache_evict_in_advance_recycle_keys_num_threshold);
 DECLARE_mBool(enable_read_cache_file_directly);
+// Whether the blocks of the file cache on disk are compressed by LZ4, and decompressed when
+// they are read. A block is kept uncompressed if its compression ratio is lower than
+// file_cache_block_compression_min_ratio.
+DECLARE_mBool(enable_file_cache_block_compression);
+DECLARE_mDouble(file_cache_block_compression_min_ratio);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
 // If true, evict the ttl cache using LRU when full.
 // Otherwise, only expiration can evict ttl and new data won't add to cache when full.
@@ -1190,6 +1303,9 @@ DECLARE_Int32(inverted_index_query_cache_shards);
 
 // inverted index match bitmap cache size
 DECLARE_String(inverted_index_query_cache_limit);
+// The query results of the inverted index computed in less time are not put into the query cache,
+// they are cheaper to compute again than the cache entries they would evict.
+DECLARE_mInt64(inverted_index_query_cache_admission_min_us);
 
 // inverted index
 DECLARE_mDouble(inverted_index_ram_buffer_size);
@@ -1212,6 +1328,9 @@ DECLARE_Int32(num_broadcast_buffer);
 
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
+// Whether the identical subexpressions of the projections of an operator are executed once
+// per block.
+DECLARE_mBool(enable_projection_common_subexpr_elimination);
 
 // Report a tablet as bad when io errors occurs more than this value.
 DECLARE_mInt64(max_tablet_io_errors);
@@ -1222,6 +1341,9 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The max bytes of the freed s3 file buffers kept for the next buffers, to save allocating and
+// faulting in the pages of a buffer for every part of the files written to s3. 0 to disable it.
+DECLARE_mInt64(s3_file_buffer_pool_max_bytes);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1250,9 +1372,22 @@ DECLARE_Bool(enable_set_in_bitmap_value);
 // max number of hdfs file handle in cache
 DECLARE_Int64(max_hdfs_file_handle_cache_num);
 DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
+// Whether to hedge the slow preads of the hdfs files with another read of a different replica,
+// unless the hedged read confs are set in the hdfs properties. Only for the hadoop libhdfs.
+DECLARE_mBool(enable_hdfs_hedged_read);
+// The threads of the hedged reads of an hdfs client.
+DECLARE_mInt32(hdfs_hedged_read_thread_num);
+// A read is hedged after it takes this long. If it is not positive, the threshold of a new hdfs
+// connection is the hdfs_hedged_read_latency_percentile of the recent reads of the name node.
+DECLARE_mInt32(hdfs_hedged_read_threshold_ms);
+DECLARE_mDouble(hdfs_hedged_read_latency_percentile);
+// The domain socket shared with the local DataNode to read its blocks directly (short-circuit
+// read), unless the short-circuit read confs are set in the hdfs properties. Empty to disable it.
+DECLARE_mString(hdfs_short_circuit_domain_socket_path);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+DECLARE_Int64(max_external_file_meta_cache_bytes);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1365,6 +1500,13 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// The commit interval of a group commit load adapts to the arrival rate of the table between
+// group_commit_interval_ms / ratio and group_commit_interval_ms * ratio, so a commit collects
+// about group_commit_data_bytes, and it's not shorter than 2 times of the commit latency.
+// The interval is fixed to group_commit_interval_ms if it's 1.
+DECLARE_mInt32(group_commit_adaptive_interval_ratio);
+// Whether to compress the blocks written to the WAL of group commit with LZ4.
+DECLARE_mBool(enable_group_commit_wal_compression);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1381,6 +1523,10 @@ DECLARE_mBool(exit_on_exception);
 
 // cgroup
 DECLARE_String(doris_cgroup_cpu_path);
+// Binds the threads of workload groups to cpus, as `<workload group name>:<cpus>` separated by
+// ';', where <cpus> is a cpu list like "0-7,16-23" or the numa nodes like "numa:1". The memory of
+// the threads is allocated from the numa nodes of their cpus. Needs doris_cgroup_cpu_path.
+DECLARE_mString(workload_group_cpusets);
 DECLARE_mBool(enable_be_proc_monitor);
 DECLARE_mInt32(be_proc_monitor_interval_ms);
 DECLARE_Int32(workload_group_metrics_interval_ms);
@@ -1409,6 +1555,31 @@ DECLARE_Bool(enable_snapshot_action);
 DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// Whether local exchange sinks push blocks into a lock-free ring per sink and source pair
+DECLARE_mBool(enable_local_exchange_ring_matrix);
+// Capacity of each ring used by local exchange. Blocks go to the shared queue if a ring is full
+DECLARE_mInt32(local_exchange_ring_capacity);
+// Whether exchange sink chooses the compression of each destination instance by the observed
+// throughput of its RPCs
+DECLARE_mBool(enable_exchange_adaptive_compression);
+// Number of RPCs of one instance between two adaptive compression decisions
+DECLARE_mInt32(exchange_adaptive_compression_window_rpcs);
+// Links faster than this use LZ4 or no compression
+DECLARE_mInt64(exchange_adaptive_compression_fast_link_mb_per_sec);
+// Links slower than this use ZSTD
+DECLARE_mInt64(exchange_adaptive_compression_slow_link_mb_per_sec);
+// Minimum compression ratio to keep compressing on a fast link
+DECLARE_mDouble(exchange_adaptive_compression_min_ratio);
+// Send the column values of exchange blocks in the brpc attachment without copying them into
+// the request. All backends of the cluster must support it before turning it on.
+DECLARE_mBool(exchange_transmit_block_by_attachment);
+// Send broadcast exchange blocks once per destination backend, which hands them to all its
+// instances. All backends of the cluster must support it before turning it on.
+DECLARE_mBool(exchange_broadcast_once_per_host);
+// Merge the small blocks already queued in the exchange receiver into blocks of batch size rows,
+// at most exchange_receiver_coalesce_bytes bytes. It never waits for more blocks to arrive.
+DECLARE_mBool(enable_exchange_receiver_coalesce_blocks);
+DECLARE_mInt64(exchange_receiver_coalesce_bytes);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1440,6 +1611,22 @@ DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_Int64(spill_in_paused_queue_timeout_ms);
+// A spilled hash join partition whose build side is larger than this is split again by a hash
+// with another seed instead of being built in memory, up to spill_hash_join_max_repartition_level.
+DECLARE_mInt64(spill_hash_join_repartition_bytes);
+DECLARE_mInt32(spill_hash_join_max_repartition_level);
+// The bytes of the following blocks of a spill file that the kernel is asked to read ahead into
+// the page cache while a spilled block is deserialized and processed, 0 to disable.
+DECLARE_mInt64(spill_read_ahead_bytes);
+// When the process memory reaches this percent of the soft memory limit, the queries are paused
+// to spill their revocable memory before their reservations fail, the queries of the workload
+// groups of lower cpu share first. 0 to disable.
+DECLARE_mInt32(proactive_spill_soft_mem_limit_percent);
+// Whether a spill stream is written to the object storage of the latest storage vault (cloud mode
+// only) when all of the local spill storage paths reach their limits.
+DECLARE_mBool(enable_spill_to_remote_storage);
+// The limit of the bytes that the spill streams of a BE can write to the remote spill storage.
+DECLARE_mInt64(spill_remote_storage_limit_bytes);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1464,6 +1651,17 @@ DECLARE_mInt32(max_s3_client_retry);
 // and the max retry time is max_s3_client_retry
 DECLARE_mInt32(s3_read_base_wait_time_ms);
 DECLARE_mInt32(s3_read_max_wait_time_ms);
+// A read of an s3 file of at least 2 parts of s3_read_parallel_part_bytes is split into
+// parts, at most s3_read_max_parallel_parts, which are read by parallel GETs. 0 disables it.
+DECLARE_mInt64(s3_read_parallel_part_bytes);
+DECLARE_mInt32(s3_read_max_parallel_parts);
+// A read of an s3 file of at most s3_small_read_bytes shares the GET of a concurrent read of
+// the file which covers it, if enable_s3_small_read_coalescing is true. If its GET is not done
+// in s3_read_hedge_delay_ms, another GET of it is issued, and the first done serves the read.
+// 0 disables the hedged GETs.
+DECLARE_mInt64(s3_small_read_bytes);
+DECLARE_mBool(enable_s3_small_read_coalescing);
+DECLARE_mInt32(s3_read_hedge_delay_ms);
 DECLARE_mBool(enable_s3_object_check_after_upload);
 
 // write as inverted index tmp directory
@@ -1484,9 +1682,20 @@ DECLARE_mInt64(table_sink_partition_write_min_data_processed_rebalance_threshold
 DECLARE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_threshold);
 // Maximum processed partition nums of per writer when partition writing
 DECLARE_mInt32(table_sink_partition_write_max_partition_nums_per_writer);
+// Whether a local hash shuffle in front of a partial aggregation spreads hot partitions
+// over several instances
+DECLARE_mBool(enable_local_shuffle_skew_rebalance);
+// Minimum data processed to trigger skewed partition rebalancing in local shuffle
+DECLARE_mInt64(local_shuffle_min_data_processed_rebalance_threshold);
+// Minimum partition data processed to rebalance a partition in local shuffle
+DECLARE_mInt64(local_shuffle_min_partition_data_processed_rebalance_threshold);
 
 /** Hive sink configurations **/
 DECLARE_mInt64(hive_sink_max_file_size);
+// If > 0, each hive partition writer buffers up to this many bytes of rows and sorts them by
+// the leading comparable columns before writing, so the row groups or stripes have narrow
+// min/max ranges that readers can prune. 0 writes the rows in arrival order.
+DECLARE_mInt64(hive_sink_sort_buffer_bytes);
 
 /** Iceberg sink configurations **/
 DECLARE_mInt64(iceberg_sink_max_file_size);
@@ -1507,6 +1716,35 @@ DECLARE_mInt64(string_overflow_size);
 DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_min_thread);
 // The max thread num for BufferedReaderPrefetchThreadPool
 DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread);
+// The min thread num for SegmentPagePrefetchThreadPool
+DECLARE_Int64(num_segment_page_prefetch_thread_pool_min_thread);
+// The max thread num for SegmentPagePrefetchThreadPool
+DECLARE_Int64(num_segment_page_prefetch_thread_pool_max_thread);
+// Whether a segment iterator reads the next data pages of its predicate columns ahead on
+// SegmentPagePrefetchThreadPool into the page cache, to hide the latency of remote storage.
+DECLARE_mBool(enable_segment_page_prefetch);
+// The max number of data pages read ahead per predicate column of a segment iterator.
+DECLARE_mInt32(segment_page_prefetch_depth);
+// The min thread num for FileCacheReadThreadPool
+DECLARE_Int64(num_file_cache_read_thread_pool_min_thread);
+// The max thread num for FileCacheReadThreadPool
+DECLARE_Int64(num_file_cache_read_thread_pool_max_thread);
+// Whether a read of the file cache which covers several downloaded blocks reads them
+// concurrently on FileCacheReadThreadPool.
+DECLARE_mBool(enable_file_cache_parallel_read);
+// The bytes a cached remote file reader reads ahead into the file cache in the background when
+// the reads of a file are sequential, 0 disables the read ahead.
+DECLARE_mInt64(file_cache_read_ahead_bytes);
+// The min thread num for SegmentLoadThreadPool
+DECLARE_Int64(num_segment_load_thread_pool_min_thread);
+// The max thread num for SegmentLoadThreadPool
+DECLARE_Int64(num_segment_load_thread_pool_max_thread);
+// Whether SegmentLoader opens the segments of a rowset concurrently on SegmentLoadThreadPool,
+// which reads their footers and indexes in parallel when they are not in the segment cache.
+DECLARE_mBool(enable_parallel_segment_load);
+// The bytes read from the tail of a segment file to get its footer, the footer is parsed from
+// the tail without another read if it fits, which saves a round trip on remote storage.
+DECLARE_mInt32(segment_footer_tail_read_bytes);
 // The min thread num for S3FileUploadThreadPool
 DECLARE_Int64(num_s3_file_upload_thread_pool_min_thread);
 // The max thread num for S3FileUploadThreadPool
@@ -1537,6 +1775,9 @@ DECLARE_Bool(enable_jvm_monitor);
 // Num threads to load data dirs, default value -1 indicates the same number of threads as the number of data dirs
 DECLARE_Int32(load_data_dirs_threads);
 
+// Num threads of a data dir to load its tablet metas, 1 loads them serially
+DECLARE_Int32(load_tablet_metas_threads_per_data_dir);
+
 // Skip loading stale rowset meta when initializing `TabletMeta` from protobuf
 DECLARE_mBool(skip_loading_stale_rowset_meta);
 // Whether to use file to record log. When starting BE with --console,
@@ -1547,6 +1788,8 @@ DECLARE_Bool(enable_file_logger);
 
 // The minimum row group size when exporting Parquet files.
 DECLARE_Int64(min_row_group_size);
+// The threads encoding the column chunks of the exported Parquet files in parallel.
+DECLARE_Int32(parquet_writer_encode_thread_num);
 
 DECLARE_mInt64(compaction_memory_bytes_limit);
 
@@ -1554,6 +1797,10 @@ DECLARE_mInt64(compaction_batch_size);
 
 DECLARE_mBool(enable_parquet_page_index);
 
+// Whether to convert late-arrival IN and MINMAX runtime filters into column value ranges, so that
+// parquet and orc readers can skip row groups, pages and stripes by statistics.
+DECLARE_mBool(enable_runtime_filter_file_pruning);
+
 // Wheather to ignore not found file in external teble(eg, hive)
 // Default is true, if set to false, the not found file will result in query failure.
 DECLARE_mBool(ignore_not_found_file_in_external_table);
@@ -1564,6 +1811,25 @@ DECLARE_mBool(enable_hdfs_mem_limiter);
 // we should do agg limit opt
 DECLARE_mInt16(topn_agg_limit_multiplier);
 
+// The aggregation hash table of serialized or fixed keys is converted into a two-level one of
+// 256 sub tables once it holds more keys than this, so a resize only rehashes one sub table.
+// -1 means never convert.
+DECLARE_mInt64(two_level_aggregation_hash_table_threshold);
+
+// The streaming pre-aggregation samples the reduction ratio (input rows / new groups) of every
+// window of this many input rows, and passes the input through without aggregating it when the
+// ratio is below streaming_agg_min_reduction_ratio. A non-positive value disables the sampling.
+DECLARE_mInt64(streaming_agg_reduction_window_rows);
+// The minimum reduction ratio of a window for the streaming pre-aggregation to keep aggregating.
+DECLARE_mDouble(streaming_agg_min_reduction_ratio);
+// How many rows the streaming pre-aggregation passes through before it samples the reduction
+// ratio of a window again. A negative value means it never samples again.
+DECLARE_mInt64(streaming_agg_pass_through_probe_rows);
+
+// Whether the sort keys of multiple integer (and date) columns are encoded into normalized binary
+// keys, so the rows are compared by memcmp in the sort of a block and the merge of sorted runs.
+DECLARE_mBool(enable_sort_normalized_keys);
+
 DECLARE_mInt64(tablet_meta_serialize_size_limit);
 
 DECLARE_mInt64(pipeline_task_leakage_detect_period_secs);
@@ -1577,6 +1843,9 @@ DECLARE_mInt32(check_score_rounds_num);
 
 // MB
 DECLARE_Int32(query_cache_size);
+// Reuse the query cache entry of an older version of a duplicate key tablet by combining it with
+// the partial result of the rowsets newer than it, if the rowsets have no delete predicate.
+DECLARE_mBool(enable_query_cache_incremental_reuse);
 DECLARE_Bool(force_regenerate_rowsetid_on_start_error);
 
 // Enable validation to check the correctness of table size.
@@ -1599,6 +1868,16 @@ DECLARE_mBool(enable_prune_delete_sign_when_base_compaction);
 DECLARE_mBool(enable_mow_verbose_log);
 
 DECLARE_mInt32(tablet_sched_delay_time_ms);
+DECLARE_mDouble(compaction_score_scan_frequency_weight);
+DECLARE_mInt64(local_background_read_bytes_per_second_per_disk);
+DECLARE_mBool(enable_local_direct_read);
+DECLARE_mInt64(local_direct_read_min_bytes);
+DECLARE_mInt64(local_direct_read_ahead_bytes);
+DECLARE_mInt64(local_direct_read_buffer_pool_max_bytes);
+DECLARE_mInt32(io_scheduler_max_concurrent_local_reads);
+DECLARE_mInt32(io_scheduler_max_concurrent_remote_reads);
+DECLARE_mInt32(io_scheduler_background_weight);
+DECLARE_mInt64(io_scheduler_deadline_slack_ms);
 DECLARE_mInt32(load_trigger_compaction_version_percent);
 DECLARE_mInt64(base_compaction_interval_seconds_since_last_operation);
 DECLARE_mBool(enable_compaction_pause_on_high_memory);
@@ -353,11 +353,14 @@ void Daemon::memory_maintenance_thread() {
         // step 7: handle paused queries(caused by memory insufficient)
         doris::ExecEnv::GetInstance()->workload_group_mgr()->handle_paused_queries();
 
-        // step 8. Flush memtable
+        // step 8: spill the revocable memory of queries before the process memory is exceeded
+        doris::ExecEnv::GetInstance()->workload_group_mgr()->revoke_memory_proactively();
+
+        // step 9. Flush memtable
         doris::GlobalMemoryArbitrator::notify_memtable_memory_refresh();
         // TODO notify flush memtable
 
-        // step 9. Reset Jemalloc dirty page decay.
+        // step 10. Reset Jemalloc dirty page decay.
         je_reset_dirty_decay();
     }
 }
@@ -54,6 +54,8 @@ inline thread_local uint64_t query_id_hi;
 inline thread_local uint64_t query_id_lo;
 inline thread_local int64_t tablet_id = 0;
 inline thread_local bool is_nereids = false;
+// The workload group of the task attached to the thread, 0 if none.
+inline thread_local uint64_t workload_group_id = 0;
 
 namespace {
 
@@ -449,6 +451,10 @@ struct SignalTaskIdKeeper {
     ~SignalTaskIdKeeper() { set_signal_task_id(PUniqueId {}); }
 };
 
+inline void set_signal_workload_group_id(uint64_t workload_group_id_arg) {
+    workload_group_id = workload_group_id_arg;
+}
+
 inline void set_signal_is_nereids(bool is_nereids_arg) {
     is_nereids = is_nereids_arg;
 }
@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -47,6 +48,7 @@
 #include "common/exception.h"
 #include "common/signal_handler.h"
 #include "exec/tablet_info.h" // DorisNodesInfo
+#include "olap/iterators.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/storage_engine.h"
@@ -339,6 +341,69 @@ struct IteratorItem {
     SegmentSharedPtr segment;
 };
 
+// The slot id of the row store column in the iterator map, no slot uses a negative id.
+static constexpr int ROW_STORE_SLOT_ID = -1;
+
+// Reads the row store cell of the row into `buffer`. The iterator of the row store column is
+// created by the first read of the segment and reused by the following rows.
+static Status read_row_store_cell(const TabletSchema& tablet_schema,
+                                  const SegmentSharedPtr& segment, uint32_t row_id,
+                                  OlapReaderStatistics& stats, IteratorItem& iterator_item,
+                                  std::string& buffer) {
+    if (iterator_item.iterator == nullptr) {
+        const auto& column = *DORIS_TRY(tablet_schema.column(BeConsts::ROW_STORE_COL));
+        StorageReadOptions storage_read_opt;
+        storage_read_opt.stats = &stats;
+        storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
+        RETURN_IF_ERROR(
+                segment->new_column_iterator(column, &iterator_item.iterator, &storage_read_opt));
+        segment_v2::ColumnIteratorOptions opt {
+                .use_page_cache = !config::disable_storage_page_cache,
+                .file_reader = segment->file_reader().get(),
+                .stats = &stats,
+                .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY,
+                                         .file_cache_stats = &stats.file_cache_stats},
+        };
+        RETURN_IF_ERROR(iterator_item.iterator->init(opt));
+        iterator_item.segment = segment;
+    }
+    vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+    RETURN_IF_ERROR(iterator_item.iterator->read_by_rowids(&row_id, 1, column));
+    DCHECK_EQ(column->size(), 1);
+    buffer = column->get_data_at(0).to_string();
+    return Status::OK();
+}
+
+// Returns the unique ids of the slots covered by the partial row store of the schema, which
+// groups the columns usually fetched together. It is empty if the schema has no partial row
+// store or the row store covers only one slot, which is cheaper to read from its own column.
+static const std::unordered_set<int>& get_row_store_slot_uids(
+        const TabletSchema& tablet_schema, const std::vector<SlotDescriptor>& slots,
+        RowStoreReadStruct& row_store_read_struct) {
+    auto [it, inserted] = row_store_read_struct.row_store_slot_uids.try_emplace(&tablet_schema);
+    auto& slot_uids = it->second;
+    if (!inserted || tablet_schema.row_columns_uids().empty() ||
+        !tablet_schema.have_column(BeConsts::ROW_STORE_COL)) {
+        return slot_uids;
+    }
+    const auto& row_columns_uids = tablet_schema.row_columns_uids();
+    for (int i = 0; i < slots.size(); ++i) {
+        int uid = slots[i].col_unique_id();
+        // The sub columns of variant are not encoded in the row store.
+        if (uid < 0 || !slots[i].column_paths().empty() ||
+            row_store_read_struct.col_uid_to_idx.at(uid) != static_cast<uint32_t>(i) ||
+            std::find(row_columns_uids.begin(), row_columns_uids.end(), uid) ==
+                    row_columns_uids.end()) {
+            continue;
+        }
+        slot_uids.insert(uid);
+    }
+    if (slot_uids.size() < 2) {
+        slot_uids.clear();
+    }
+    return slot_uids;
+}
+
 Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                           PMultiGetResponse* response) {
     // read from storage engine row id by row id
@@ -624,15 +689,29 @@ Status RowIdStorageReader::read_batch_doris_format_row(
     std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
     std::string row_store_buffer;
     RowStoreReadStruct row_store_read_struct(row_store_buffer);
-    if (request_block_desc.fetch_row_store()) {
-        for (int i = 0; i < request_block_desc.slots_size(); ++i) {
-            row_store_read_struct.serdes.emplace_back(slots[i].get_data_type_ptr()->get_serde());
-            row_store_read_struct.col_uid_to_idx[slots[i].col_unique_id()] = i;
-            row_store_read_struct.default_values.emplace_back(slots[i].col_default_value());
-        }
+    // The serdes are also used to decode the slots covered by a partial row store.
+    row_store_read_struct.fetch_row_store = request_block_desc.fetch_row_store();
+    for (int i = 0; i < request_block_desc.slots_size(); ++i) {
+        row_store_read_struct.serdes.emplace_back(slots[i].get_data_type_ptr()->get_serde());
+        row_store_read_struct.col_uid_to_idx.try_emplace(slots[i].col_unique_id(), i);
+        row_store_read_struct.default_values.emplace_back(slots[i].col_default_value());
     }
 
-    for (int j = 0; j < request_block_desc.row_id_size(); ++j) {
+    // The rows are read grouped by segment and in row id order, so that the column iterators only
+    // seek forward and the rows in the same page are decoded from the page they already hold. The
+    // result is permuted back to the requested order afterwards.
+    const size_t num_rows = request_block_desc.row_id_size();
+    std::vector<uint32_t> read_order(num_rows);
+    std::iota(read_order.begin(), read_order.end(), 0);
+    const bool reorder = result_block.rows() == 0;
+    if (reorder) {
+        std::sort(read_order.begin(), read_order.end(), [&](uint32_t lhs, uint32_t rhs) {
+            return std::make_pair(request_block_desc.file_id(lhs), request_block_desc.row_id(lhs)) <
+                   std::make_pair(request_block_desc.file_id(rhs), request_block_desc.row_id(rhs));
+        });
+    }
+
+    for (auto j : read_order) {
         auto file_id = request_block_desc.file_id(j);
         auto file_mapping = id_file_map->get_file_mapping(file_id);
         if (!file_mapping) {
@@ -646,6 +725,16 @@ Status RowIdStorageReader::read_batch_doris_format_row(
                 row_store_read_struct, stats, acquire_tablet_ms, acquire_rowsets_ms,
                 acquire_segments_ms, lookup_row_data_ms, iterator_map, result_block));
     }
+
+    if (reorder && !std::is_sorted(read_order.begin(), read_order.end())) {
+        vectorized::IColumn::Permutation permutation(num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            permutation[read_order[i]] = i;
+        }
+        for (auto& column : result_block) {
+            column.column = column.column->permute(permutation, num_rows);
+        }
+    }
     return Status::OK();
 }
 
@@ -1021,15 +1110,18 @@ Status RowIdStorageReader::read_doris_format_row(
     }
     segment_v2::SegmentSharedPtr segment = *it;
 
-    // if row_store_read_struct not empty, means the line we should read from row_store
-    if (!row_store_read_struct.default_values.empty()) {
+    const TabletSchema& tablet_schema = *rowset->tablet_schema();
+    IteratorKey row_store_key {.tablet_id = tablet_id,
+                               .rowset_id = rowset_id,
+                               .segment_id = segment_id,
+                               .slot_id = ROW_STORE_SLOT_ID};
+    if (row_store_read_struct.fetch_row_store) {
         CHECK(tablet->tablet_schema()->has_row_store_for_all_columns());
-        RowLocation loc(rowset_id, segment->id(), cast_set<uint32_t>(row_id));
-        row_store_read_struct.row_store_buffer.clear();
         RETURN_IF_ERROR(scope_timer_run(
                 [&]() {
-                    return tablet->lookup_row_data({}, loc, rowset, stats,
-                                                   row_store_read_struct.row_store_buffer);
+                    return read_row_store_cell(tablet_schema, segment, cast_set<uint32_t>(row_id),
+                                               stats, iterator_map[row_store_key],
+                                               row_store_read_struct.row_store_buffer);
                 },
                 lookup_row_data_ms));
 
@@ -1037,23 +1129,44 @@ Status RowIdStorageReader::read_doris_format_row(
                 row_store_read_struct.serdes, row_store_read_struct.row_store_buffer.data(),
                 row_store_read_struct.row_store_buffer.size(), row_store_read_struct.col_uid_to_idx,
                 result_block, row_store_read_struct.default_values, {}));
-    } else {
-        for (int x = 0; x < slots.size(); ++x) {
-            vectorized::MutableColumnPtr column =
-                    result_block.get_by_position(x).column->assume_mutable();
-            IteratorKey iterator_key {.tablet_id = tablet_id,
-                                      .rowset_id = rowset_id,
-                                      .segment_id = segment_id,
-                                      .slot_id = slots[x].id()};
-            IteratorItem& iterator_item = iterator_map[iterator_key];
-            if (iterator_item.segment == nullptr) {
-                iterator_map[iterator_key].segment = segment;
-            }
-            segment = iterator_item.segment;
-            RETURN_IF_ERROR(segment->seek_and_read_by_rowid(full_read_schema, &slots[x],
-                                                            cast_set<uint32_t>(row_id), column,
-                                                            stats, iterator_item.iterator));
+        return Status::OK();
+    }
+
+    // The slots covered by the partial row store are decoded from one cell of it, which must be
+    // done before reading the other slots since the missing cells are padded by the row count.
+    const auto& row_store_slot_uids =
+            get_row_store_slot_uids(tablet_schema, slots, row_store_read_struct);
+    if (!row_store_slot_uids.empty()) {
+        RETURN_IF_ERROR(scope_timer_run(
+                [&]() {
+                    return read_row_store_cell(tablet_schema, segment, cast_set<uint32_t>(row_id),
+                                               stats, iterator_map[row_store_key],
+                                               row_store_read_struct.row_store_buffer);
+                },
+                lookup_row_data_ms));
+        RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
+                row_store_read_struct.serdes, row_store_read_struct.row_store_buffer.data(),
+                row_store_read_struct.row_store_buffer.size(), row_store_read_struct.col_uid_to_idx,
+                result_block, row_store_read_struct.default_values, row_store_slot_uids));
+    }
+    for (int x = 0; x < slots.size(); ++x) {
+        if (row_store_slot_uids.contains(slots[x].col_unique_id())) {
+            continue;
+        }
+        vectorized::MutableColumnPtr column =
+                result_block.get_by_position(x).column->assume_mutable();
+        IteratorKey iterator_key {.tablet_id = tablet_id,
+                                  .rowset_id = rowset_id,
+                                  .segment_id = segment_id,
+                                  .slot_id = slots[x].id()};
+        IteratorItem& iterator_item = iterator_map[iterator_key];
+        if (iterator_item.segment == nullptr) {
+            iterator_map[iterator_key].segment = segment;
         }
+        segment = iterator_item.segment;
+        RETURN_IF_ERROR(segment->seek_and_read_by_rowid(full_read_schema, &slots[x],
+                                                        cast_set<uint32_t>(row_id), column, stats,
+                                                        iterator_item.iterator));
     }
 
     return Status::OK();
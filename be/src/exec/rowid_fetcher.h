@@ -22,6 +22,8 @@
 #include <gen_cpp/internal_service.pb.h>
 
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -82,6 +84,11 @@ struct RowStoreReadStruct {
     vectorized::DataTypeSerDeSPtrs serdes;
     std::unordered_map<uint32_t, uint32_t> col_uid_to_idx;
     std::vector<std::string> default_values;
+    // Whether all the slots are read from the full row store of the tablet.
+    bool fetch_row_store = false;
+    // The unique ids of the slots covered by the partial row store of each schema. These slots
+    // are decoded from one row store cell instead of being read column by column.
+    std::unordered_map<const TabletSchema*, std::unordered_set<int>> row_store_slot_uids;
 };
 
 class RowIdStorageReader {
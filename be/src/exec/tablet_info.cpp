@@ -48,6 +48,8 @@
 #include "util/string_parser.hpp"
 #include "util/string_util.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_factory.hpp"
 // NOLINTNEXTLINE(unused-includes)
@@ -538,6 +540,7 @@ Status VOlapTablePartitionParam::init() {
         }
     }
 
+    _build_range_index();
     _mem_usage = _partition_block.allocated_bytes();
     _mem_tracker->consume(_mem_usage);
     return Status::OK();
@@ -552,6 +555,115 @@ bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
            || !comparator(key, std::tuple {part->start_key.first, part->start_key.second, false});
 }
 
+namespace {
+// Calls `func` with the data of `column` if it's a column of the types whose values are compared
+// by their integer values, returns false otherwise.
+template <PrimitiveType... Types, typename Func>
+bool visit_integer_key_column(const vectorized::IColumn& column, Func&& func) {
+    auto visit = [&]<PrimitiveType Type>() {
+        const auto* typed_column = check_and_get_column<vectorized::ColumnVector<Type>>(column);
+        if (typed_column != nullptr) {
+            func(typed_column->get_data());
+        }
+        return typed_column != nullptr;
+    };
+    return (visit.template operator()<Types>() || ...);
+}
+
+template <typename Func>
+bool visit_partition_key_column(const vectorized::IColumn& column, Func&& func) {
+    return visit_integer_key_column<TYPE_TINYINT, TYPE_SMALLINT, TYPE_INT, TYPE_BIGINT,
+                                    TYPE_LARGEINT, TYPE_DATE, TYPE_DATETIME, TYPE_DATEV2,
+                                    TYPE_DATETIMEV2>(column, std::forward<Func>(func));
+}
+} // namespace
+
+void VOlapTablePartitionParam::_build_range_index() {
+    _has_range_index = false;
+    _range_end_keys.clear();
+    _range_start_keys.clear();
+    _range_has_start_keys.clear();
+    _range_partitions.clear();
+    if (_is_in_partition || _partition_slot_locs.size() != 1) {
+        return;
+    }
+    const auto& key_column = *_partition_block.get_by_position(_partition_slot_locs[0]).column;
+    const auto* nested_column = &key_column;
+    if (const auto* nullable_column =
+                check_and_get_column<vectorized::ColumnNullable>(key_column)) {
+        if (nullable_column->has_null()) {
+            return;
+        }
+        nested_column = &nullable_column->get_nested_column();
+    }
+    VOlapTablePartition* max_value_partition = nullptr;
+    bool is_integer_key = visit_partition_key_column(*nested_column, [&](const auto& keys) {
+        auto add_partition = [&](VOlapTablePartition* part) {
+            bool has_start_key = part->start_key.second != -1;
+            _range_has_start_keys.push_back(has_start_key);
+            _range_start_keys.push_back(
+                    has_start_key ? vectorized::Int128(keys[part->start_key.second]) : 0);
+            _range_partitions.push_back(part);
+        };
+        // the end keys are in the order of the comparator, the end key of MAXVALUE is the last.
+        for (const auto& [end_key, part] : *_partitions_map) {
+            if (std::get<1>(end_key) == -1) {
+                max_value_partition = part;
+                continue;
+            }
+            _range_end_keys.push_back(vectorized::Int128(keys[std::get<1>(end_key)]));
+            add_partition(part);
+        }
+        if (max_value_partition != nullptr) {
+            add_partition(max_value_partition);
+        } else {
+            _range_has_start_keys.push_back(false);
+            _range_start_keys.push_back(0);
+            _range_partitions.push_back(nullptr);
+        }
+    });
+    _has_range_index = is_integer_key;
+}
+
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    if (_has_range_index) {
+        auto key_loc = _transformed_slot_locs.empty() ? _partition_slot_locs[0]
+                                                      : _transformed_slot_locs[0];
+        const auto& key_column = *block->get_by_position(key_loc).column;
+        const auto* nested_column = &key_column;
+        const uint8_t* null_map = nullptr;
+        if (const auto* nullable_column =
+                    check_and_get_column<vectorized::ColumnNullable>(key_column)) {
+            nested_column = &nullable_column->get_nested_column();
+            null_map = nullable_column->get_null_map_data().data();
+        }
+        bool found = visit_partition_key_column(*nested_column, [&](const auto& keys) {
+            for (int row = 0; row < rows; ++row) {
+                if (null_map != nullptr && null_map[row]) {
+                    find_partition(block, row, partitions[row]);
+                    continue;
+                }
+                auto key = vectorized::Int128(keys[row]);
+                // the first partition whose end key is larger than the key, as upper_bound of
+                // _partitions_map, then check its start key as _part_contains.
+                auto i = std::upper_bound(_range_end_keys.begin(), _range_end_keys.end(), key) -
+                         _range_end_keys.begin();
+                auto* part = _range_partitions[i];
+                if (part != nullptr && (!_range_has_start_keys[i] || key >= _range_start_keys[i])) {
+                    partitions[row] = part;
+                }
+            }
+        });
+        if (found) {
+            return;
+        }
+    }
+    for (int row = 0; row < rows; ++row) {
+        find_partition(block, row, partitions[row]);
+    }
+}
+
 // insert value into _partition_block's column
 // NOLINTBEGIN(readability-function-size)
 static Status _create_partition_key(const TExprNode& t_expr, BlockRow* part_key, uint16_t pos) {
@@ -788,6 +900,7 @@ Status VOlapTablePartitionParam::add_partitions(
                                      part);
         }
     }
+    _build_range_index();
 
     return Status::OK();
 }
@@ -873,6 +986,7 @@ Status VOlapTablePartitionParam::replace_partitions(
             it++;
         }
     }
+    _build_range_index();
 
     return Status::OK();
 }
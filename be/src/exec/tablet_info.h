@@ -222,16 +222,38 @@ public:
         return (partition != nullptr);
     }
 
+    // Finds the partitions of the first `rows` rows of the block like find_partition, the
+    // partition of a row is not changed if no partition contains it. The range partitions of a
+    // single integer or date column are found by a binary search over their raw end keys.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
             std::vector<uint32_t>& tablet_indexes /*result*/,
             /*TODO: check if flat hash map will be better*/
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
+        if (!_distributed_slot_locs.empty() && partition_tablets_buffer == nullptr) {
+            // hash the distribution columns column by column, it's the same hash as the one of
+            // compute_function below.
+            std::vector<uint32_t> hashes(block->rows(), 0);
+            for (auto slot_loc : _distributed_slot_locs) {
+                auto column =
+                        block->get_by_position(slot_loc).column->convert_to_full_column_if_const();
+                column->update_crcs_with_value(hashes.data(),
+                                               _slots[slot_loc]->type()->get_primitive_type(),
+                                               static_cast<uint32_t>(hashes.size()), 0, nullptr);
+            }
+            for (auto index : indexes) {
+                tablet_indexes[index] =
+                        static_cast<uint32_t>(hashes[index] % partitions[index]->num_buckets);
+            }
+            return;
+        }
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
         if (!_distributed_slot_locs.empty()) {
-            //TODO: refactor by saving the hash values. then we can calculate in columnwise.
             compute_function = [this](vectorized::Block* block, uint32_t row,
                                       const VOlapTablePartition& partition) -> uint32_t {
                 uint32_t hash_val = 0;
@@ -312,6 +334,9 @@ private:
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
+    // rebuild the range index of find_partitions after the partitions are changed.
+    void _build_range_index();
+
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
     TOlapTablePartitionParam _t_param;
@@ -332,6 +357,16 @@ private:
             std::map<BlockRowWithIndicator, VOlapTablePartition*, VOlapTablePartKeyComparator>>
             _partitions_map;
 
+    // The range index of the range partitions of a single integer or date column, in the order
+    // of _partitions_map. _range_partitions[i] is the partition whose end key is
+    // _range_end_keys[i], the last one is the partition of MAXVALUE, or nullptr if there's none.
+    // _range_start_keys[i] is its start key if _range_has_start_keys[i].
+    bool _has_range_index = false;
+    std::vector<vectorized::Int128> _range_end_keys;
+    std::vector<vectorized::Int128> _range_start_keys;
+    std::vector<uint8_t> _range_has_start_keys;
+    std::vector<VOlapTablePartition*> _range_partitions;
+
     bool _is_in_partition = false;
     size_t _mem_usage = 0;
     // only works when using list partition, the resource is owned by _partitions
@@ -212,6 +212,31 @@ public:
         return new_size;
     }
 
+    // Same as above, but the filter is tested once per dict word and the result is cached in
+    // `dict_flags`, which must be reset when the dictionary changes.
+    template <bool is_nullable>
+    uint16_t find_dict_olap_engine(const vectorized::ColumnDictI32* column, const uint8_t* nullmap,
+                                   uint16_t* offsets, int number,
+                                   std::vector<vectorized::UInt8>& dict_flags) {
+        if (dict_flags.size() != column->dict_size()) {
+            column->find_codes_by_hash([&](uint32_t hash) { return _bloom_filter->test(hash); },
+                                       dict_flags);
+        }
+        const auto& codes = column->get_data();
+        uint16_t new_size = 0;
+        for (uint16_t i = 0; i < number; i++) {
+            uint16_t idx = offsets[i];
+            offsets[new_size] = idx;
+            if constexpr (is_nullable) {
+                new_size += nullmap[idx] && _bloom_filter->contain_null();
+                new_size += !nullmap[idx] && dict_flags[codes[idx]];
+            } else {
+                new_size += dict_flags[codes[idx]] != 0;
+            }
+        }
+        return new_size;
+    }
+
     uint16_t find_fixed_len_olap_engine(const char* data, const uint8_t* nullmap, uint16_t* offsets,
                                         int number, bool is_parse_column) override {
         if (_enable_fixed_len_to_uint32_v2) {
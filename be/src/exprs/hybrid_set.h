@@ -19,6 +19,12 @@
 
 #include <gen_cpp/internal_service.pb.h>
 
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 #include "common/object_pool.h"
 #include "exprs/filter_base.h"
 #include "runtime/primitive_type.h"
@@ -164,8 +170,15 @@ struct IsFixedContainer : std::false_type {};
 template <typename T, size_t N>
 struct IsFixedContainer<FixedContainer<T, N>> : std::true_type {};
 
+// The max number of bits of the bitmap of a DynamicContainer of integers, 128KB.
+constexpr uint64_t DYNAMIC_CONTAINER_MAX_BITMAP_BITS = 1ULL << 20;
+
 /**
  * Dynamic Container uses phmap::flat_hash_set.
+ * The integers in a range which is small compared with their number, e.g. the ids of an IN list,
+ * are also kept in a bitmap, so that find is a subtraction and a bit test instead of hashing.
+ * For strings, a mask of the lengths of the elements rejects most of the absent values without
+ * hashing them.
  * @tparam T Element Type
  */
 template <typename T>
@@ -178,13 +191,44 @@ public:
     DynamicContainer() = default;
     ~DynamicContainer() = default;
 
-    void insert(const T& value) { _set.insert(value); }
+    void insert(const T& value) {
+        if (!_set.insert(value).second) {
+            return;
+        }
+        if constexpr (use_bitmap) {
+            _insert_to_bitmap(value);
+        } else if constexpr (use_length_mask) {
+            _length_mask |= _length_bit(value);
+        }
+    }
 
-    void insert(Iterator begin, Iterator end) { _set.insert(begin, end); }
+    void insert(Iterator begin, Iterator end) {
+        for (auto iter = begin; iter != end; ++iter) {
+            insert(*iter);
+        }
+    }
 
-    bool find(const T& value) const { return _set.contains(value); }
+    bool find(const T& value) const {
+        if constexpr (use_bitmap) {
+            if (_num_bits > 0) {
+                const uint64_t offset = static_cast<uint64_t>(value) - _base;
+                return offset < _num_bits && ((_bitmap[offset >> 6] >> (offset & 63)) & 1);
+            }
+        } else if constexpr (use_length_mask) {
+            if (!(_length_mask & _length_bit(value))) {
+                return false;
+            }
+        }
+        return _set.contains(value);
+    }
 
-    void clear() { _set.clear(); }
+    void clear() {
+        _set.clear();
+        _bitmap.clear();
+        _num_bits = 0;
+        _next_bitmap_size = 0;
+        _length_mask = 0;
+    }
 
     Iterator begin() { return _set.begin(); }
 
@@ -193,7 +237,74 @@ public:
     size_t size() const { return _set.size(); }
 
 private:
+    static constexpr bool use_bitmap =
+            std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= sizeof(int64_t);
+    static constexpr bool use_length_mask =
+            std::is_same_v<T, std::string> || std::is_same_v<T, StringRef>;
+
+    // The lengths >= 63 share the last bit.
+    static uint64_t _length_bit(const T& value) {
+        size_t length = 0;
+        if constexpr (std::is_same_v<T, std::string>) {
+            length = value.size();
+        } else {
+            length = value.size;
+        }
+        return 1ULL << std::min<size_t>(length, 63);
+    }
+
+    void _insert_to_bitmap(const T& value) {
+        if (_set.size() == 1) {
+            _min = value;
+            _max = value;
+        } else {
+            _min = std::min(_min, value);
+            _max = std::max(_max, value);
+        }
+        const uint64_t offset = static_cast<uint64_t>(value) - _base;
+        if (offset < _num_bits) {
+            _bitmap[offset >> 6] |= 1ULL << (offset & 63);
+        } else if (_num_bits > 0 || _set.size() >= _next_bitmap_size) {
+            _build_bitmap();
+        }
+    }
+
+    // Covers [_min, _max] with half of the range as slack on both sides, so that the bitmap of a
+    // growing range is rebuilt O(log(range)) times. Without a bitmap, the values are checked again
+    // when their number doubles.
+    void _build_bitmap() {
+        const uint64_t span = static_cast<uint64_t>(_max) - static_cast<uint64_t>(_min);
+        const uint64_t max_bits = std::min<uint64_t>(DYNAMIC_CONTAINER_MAX_BITMAP_BITS,
+                                                     std::max<uint64_t>(_set.size(), 256) * 64);
+        if (span >= max_bits / 2) {
+            _bitmap.clear();
+            _bitmap.shrink_to_fit();
+            _num_bits = 0;
+            _next_bitmap_size = _set.size() * 2;
+            return;
+        }
+        const uint64_t headroom = static_cast<uint64_t>(_min) -
+                                  static_cast<uint64_t>(std::numeric_limits<T>::min());
+        _base = static_cast<uint64_t>(_min) - std::min(span / 2 + 32, headroom);
+        _num_bits = (2 * (span + 1) + 64 + 63) / 64 * 64;
+        _bitmap.assign(_num_bits / 64, 0);
+        for (const auto& element : _set) {
+            const uint64_t offset = static_cast<uint64_t>(element) - _base;
+            _bitmap[offset >> 6] |= 1ULL << (offset & 63);
+        }
+    }
+
     vectorized::flat_hash_set<T> _set;
+
+    // the bit of value v is at v - _base, the bitmap is not used if _num_bits is 0
+    std::vector<uint64_t> _bitmap;
+    uint64_t _base = 0;
+    uint64_t _num_bits = 0;
+    size_t _next_bitmap_size = 0;
+    std::conditional_t<use_bitmap, T, uint8_t> _min {};
+    std::conditional_t<use_bitmap, T, uint8_t> _max {};
+
+    uint64_t _length_mask = 0;
 };
 
 // TODO Maybe change void* parameter to template parameter better.
@@ -92,6 +92,7 @@ static void _show_delete_bitmap(DeleteBitmap& dm, bool verbose, std::string* jso
     root.AddMember("delete_bitmap_count", count, root.GetAllocator());
     root.AddMember("cardinality", cardinality, root.GetAllocator());
     root.AddMember("size", size, root.GetAllocator());
+    root.AddMember("agg_cache_size", dm.get_agg_cache_size(), root.GetAllocator());
     if (verbose) {
         std::string pre_rowset_id;
         int64_t pre_segment_id = -1;
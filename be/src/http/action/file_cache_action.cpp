@@ -39,6 +39,7 @@
 #include "olap/olap_define.h"
 #include "olap/tablet_meta.h"
 #include "util/easy_json.h"
+#include "util/url_coding.h"
 
 namespace doris {
 
@@ -55,6 +56,14 @@ constexpr static std::string_view RELEASE = "release";
 constexpr static std::string_view BASE_PATH = "base_path";
 constexpr static std::string_view RELEASED_ELEMENTS = "released_elements";
 constexpr static std::string_view VALUE = "value";
+constexpr static std::string_view RESIDENCY = "residency";
+constexpr static std::string_view BYTES = "bytes";
+constexpr static std::string_view HASHES = "hashes";
+constexpr static std::string_view BITSET = "bitset";
+constexpr static size_t DEFAULT_RESIDENCY_SUMMARY_BYTES = 1024 * 1024;
+constexpr static size_t MAX_RESIDENCY_SUMMARY_BYTES = 64 * 1024 * 1024;
+constexpr static int DEFAULT_RESIDENCY_SUMMARY_HASHES = 4;
+constexpr static int MAX_RESIDENCY_SUMMARY_HASHES = 16;
 
 Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metrics) {
     req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.data());
@@ -127,6 +136,41 @@ Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metri
                 *json_metrics = json.ToString();
             }
         }
+    } else if (operation == RESIDENCY) {
+        // A bloom filter of the cached files of external tables, which is used to assign the
+        // splits of the files to this backend.
+        size_t num_bytes = DEFAULT_RESIDENCY_SUMMARY_BYTES;
+        int num_hashes = DEFAULT_RESIDENCY_SUMMARY_HASHES;
+        const std::string& bytes = req->param(BYTES.data());
+        const std::string& hashes = req->param(HASHES.data());
+        try {
+            if (!bytes.empty()) {
+                num_bytes = std::stoull(bytes);
+            }
+            if (!hashes.empty()) {
+                num_hashes = std::stoi(hashes);
+            }
+        } catch (...) {
+            num_bytes = 0;
+        }
+        if (num_bytes == 0 || num_bytes > MAX_RESIDENCY_SUMMARY_BYTES || num_hashes <= 0 ||
+            num_hashes > MAX_RESIDENCY_SUMMARY_HASHES) {
+            st = Status::InvalidArgument(
+                    "The {} needs to be in the interval (0, {}] and the {} in the interval "
+                    "(0, {}], got {} and {}",
+                    BYTES, MAX_RESIDENCY_SUMMARY_BYTES, HASHES, MAX_RESIDENCY_SUMMARY_HASHES,
+                    bytes, hashes);
+        } else {
+            std::string summary =
+                    io::FileCacheFactory::instance()->get_residency_summary(num_bytes, num_hashes);
+            std::string encoded;
+            base64_encode(summary, &encoded);
+            EasyJson json;
+            json["num_bits"] = num_bytes * 8;
+            json[HASHES.data()] = num_hashes;
+            json[BITSET.data()] = encoded;
+            *json_metrics = json.ToString();
+        }
     } else {
         st = Status::InternalError("invalid operation: {}", operation);
     }
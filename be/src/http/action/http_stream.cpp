@@ -17,6 +17,7 @@
 
 #include "http/action/http_stream.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <future>
 #include <sstream>
@@ -67,6 +68,8 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(http_stream_requests_total, MetricUnit::REQ
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(http_stream_duration_ms, MetricUnit::MILLISECONDS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(http_stream_current_processing, MetricUnit::REQUESTS);
 
+static constexpr size_t MAX_BODY_CHUNK_SIZE = 128 * 1024;
+
 HttpStreamAction::HttpStreamAction(ExecEnv* exec_env) : _exec_env(exec_env) {
     _http_stream_entity =
             DorisMetrics::instance()->metric_registry()->register_entity("http_stream");
@@ -254,7 +257,10 @@ void HttpStreamAction::on_chunk_data(HttpRequest* req) {
     }
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        st = ByteBuffer::allocate(128 * 1024, &bb);
+        // a chunk smaller than the max size gets a buffer of its own size, the pipe only counts
+        // the bytes in a buffer against its limit, not the capacity
+        st = ByteBuffer::allocate(
+                std::min(evbuffer_get_length(evbuf), MAX_BODY_CHUNK_SIZE), &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -45,7 +45,10 @@
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/bfd_parser.h"
+#include "util/cpu_sampler.h"
 #include "util/pprof_utils.h" // IWYU pragma: keep
+#include "util/time.h"
+#include "util/uid_util.h"
 
 namespace doris {
 
@@ -207,6 +210,48 @@ void ProfileAction::handle(HttpRequest* req) {
 #endif
 }
 
+// The folded stacks of the samples of the cpu sampler, filtered by the optional params query_id
+// and workload_group_id, of the latest `seconds`.
+class CpuSamplesAction : public HttpHandlerWithAuth {
+public:
+    CpuSamplesAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
+
+    ~CpuSamplesAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+void CpuSamplesAction::handle(HttpRequest* req) {
+    if (!CpuSampler::instance()->started()) {
+        HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE,
+                                "cpu sampler is not started, check enable_cpu_sampler");
+        return;
+    }
+    CpuSampler::Filter filter;
+    const auto& query_id_str = req->param("query_id");
+    if (!query_id_str.empty()) {
+        TUniqueId query_id;
+        if (!parse_id(query_id_str, &query_id)) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    "invalid query_id: " + query_id_str);
+            return;
+        }
+        filter.query_id = query_id;
+    }
+    const auto& workload_group_id_str = req->param("workload_group_id");
+    if (!workload_group_id_str.empty()) {
+        filter.workload_group_id = std::strtoull(workload_group_id_str.c_str(), nullptr, 10);
+    }
+    int seconds = kPprofDefaultSampleSecs;
+    const auto& seconds_str = req->param(SECOND_KEY);
+    if (!seconds_str.empty()) {
+        seconds = std::atoi(seconds_str.c_str());
+    }
+    filter.end_time_ms = UnixMillis();
+    filter.start_time_ms = filter.end_time_ms - seconds * 1000L;
+    HttpChannel::send_reply(req, CpuSampler::instance()->folded_stacks(filter));
+}
+
 class PmuProfileAction : public HttpHandlerWithAuth {
 public:
     PmuProfileAction(ExecEnv* exec_env) : HttpHandlerWithAuth(exec_env) {}
@@ -315,6 +360,8 @@ Status PprofActions::setup(ExecEnv* exec_env, EvHttpServer* http_server, ObjectP
                                   pool.add(new GrowthAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/profile",
                                   pool.add(new ProfileAction(exec_env)));
+    http_server->register_handler(HttpMethod::GET, "/pprof/cpu_samples",
+                                  pool.add(new CpuSamplesAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/pmuprofile",
                                   pool.add(new PmuProfileAction(exec_env)));
     http_server->register_handler(HttpMethod::GET, "/pprof/contention",
@@ -29,6 +29,7 @@
 #include <sys/time.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <ctime>
@@ -81,6 +82,7 @@ bvar::LatencyRecorder g_stream_load_commit_and_publish_latency_ms("stream_load",
                                                                   "commit_and_publish_ms");
 
 static constexpr size_t MIN_CHUNK_SIZE = 64 * 1024;
+static constexpr size_t MAX_BODY_CHUNK_SIZE = 128 * 1024;
 static const std::string CHUNK = "chunked";
 
 #ifdef BE_TEST
@@ -360,7 +362,10 @@ void StreamLoadAction::on_chunk_data(HttpRequest* req) {
     int64_t start_read_data_time = MonotonicNanos();
     while (evbuffer_get_length(evbuf) > 0) {
         ByteBufferPtr bb;
-        Status st = ByteBuffer::allocate(128 * 1024, &bb);
+        // a chunk smaller than the max size gets a buffer of its own size, the pipe only counts
+        // the bytes in a buffer against its limit, not the capacity
+        Status st = ByteBuffer::allocate(
+                std::min(evbuffer_get_length(evbuf), MAX_BODY_CHUNK_SIZE), &bb);
         if (!st.ok()) {
             ctx->status = st;
             return;
@@ -634,7 +634,10 @@ FileBlocks BlockFileCache::split_range_into_cells(const UInt128Wrapper& hash,
     while (current_pos < end_pos_non_included) {
         current_size = std::min(remaining_size, _max_file_block_size);
         remaining_size -= current_size;
-        state = try_reserve(hash, context, current_pos, current_size, cache_lock)
+        // the file of the block evicted before is not removed yet
+        bool is_removing =
+                !_removing_files.empty() && _removing_files.contains({hash, current_pos});
+        state = !is_removing && try_reserve(hash, context, current_pos, current_size, cache_lock)
                         ? state
                         : FileBlock::State::SKIP_CACHE;
         if (state == FileBlock::State::SKIP_CACHE) [[unlikely]] {
@@ -736,12 +739,14 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
     DCHECK(stats != nullptr);
     MonotonicStopWatch sw;
     sw.start();
-    std::lock_guard cache_lock(_mutex);
-    stats->lock_wait_timer += sw.elapsed_time();
     FileBlocks file_blocks;
+    std::vector<FileCacheKey> evicted_keys;
     int64_t duration = 0;
     {
+        std::lock_guard cache_lock(_mutex);
+        stats->lock_wait_timer += sw.elapsed_time();
         SCOPED_RAW_TIMER(&duration);
+        _evicted_keys = &evicted_keys;
         if (auto iter = _key_to_time.find(hash);
             context.cache_type == FileCacheType::INDEX && iter != _key_to_time.end()) {
             context.cache_type = FileCacheType::TTL;
@@ -769,11 +774,34 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
                 *_num_hit_blocks << 1;
             }
         }
+        _evicted_keys = nullptr;
     }
     *_get_or_set_latency_us << (duration / 1000);
+    if (!evicted_keys.empty()) {
+        remove_evicted_files(evicted_keys);
+    }
     return FileBlocksHolder(std::move(file_blocks));
 }
 
+void BlockFileCache::remove_evicted_files(const std::vector<FileCacheKey>& keys) {
+    for (const auto& key : keys) {
+        int64_t duration_ns = 0;
+        Status st;
+        {
+            SCOPED_RAW_TIMER(&duration_ns);
+            st = _storage->remove(key);
+        }
+        *_storage_sync_remove_latency_us << (duration_ns / 1000);
+        if (!st.ok()) {
+            LOG_WARNING("").error(st);
+        }
+    }
+    SCOPED_CACHE_LOCK(_mutex, this);
+    for (const auto& key : keys) {
+        _removing_files.erase({key.hash, key.offset});
+    }
+}
+
 BlockFileCache::FileBlockCell* BlockFileCache::add_cell(const UInt128Wrapper& hash,
                                                         const CacheContext& context, size_t offset,
                                                         size_t size, FileBlock::State state,
@@ -1409,7 +1437,11 @@ void BlockFileCache::remove(FileBlockSPtr file_block, T& cache_lock, U& block_lo
         key.offset = offset;
         key.meta.type = type;
         key.meta.expiration_time = expiration_time;
-        if (sync) {
+        if (sync && _evicted_keys != nullptr) {
+            // removed by get_or_set after the cache lock is released
+            _removing_files.insert({hash, offset});
+            _evicted_keys->push_back(key);
+        } else if (sync) {
             int64_t duration_ns = 0;
             Status st;
             {
@@ -2218,6 +2250,32 @@ std::map<size_t, FileBlockSPtr> BlockFileCache::get_blocks_by_key(const UInt128W
     return offset_to_block;
 }
 
+bool BlockFileCache::has_downloaded_blocks(const UInt128Wrapper& hash) {
+    SCOPED_CACHE_LOCK(_mutex, this);
+    auto iter = _files.find(hash);
+    if (iter == _files.end()) {
+        return false;
+    }
+    return std::any_of(iter->second.begin(), iter->second.end(), [](const auto& offset_and_cell) {
+        return offset_and_cell.second.file_block->state() == FileBlock::State::DOWNLOADED;
+    });
+}
+
+std::vector<UInt128Wrapper> BlockFileCache::get_cached_file_hashes() {
+    std::vector<UInt128Wrapper> hashes;
+    SCOPED_CACHE_LOCK(_mutex, this);
+    hashes.reserve(_files.size());
+    for (const auto& [hash, blocks] : _files) {
+        for (const auto& [_, cell] : blocks) {
+            if (cell.file_block->state() == FileBlock::State::DOWNLOADED) {
+                hashes.push_back(hash);
+                break;
+            }
+        }
+    }
+    return hashes;
+}
+
 void BlockFileCache::update_ttl_atime(const UInt128Wrapper& hash) {
     SCOPED_CACHE_LOCK(_mutex, this);
     if (auto iter = _files.find(hash); iter != _files.end()) {
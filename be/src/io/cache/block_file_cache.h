@@ -25,6 +25,8 @@
 #include <mutex>
 #include <optional>
 #include <thread>
+#include <unordered_set>
+#include <vector>
 
 #include "io/cache/cache_lru_dumper.h"
 #include "io/cache/file_block.h"
@@ -160,6 +162,10 @@ public:
     std::string reset_capacity(size_t new_capacity);
 
     std::map<size_t, FileBlockSPtr> get_blocks_by_key(const UInt128Wrapper& hash);
+    // Whether any block of the file is downloaded.
+    bool has_downloaded_blocks(const UInt128Wrapper& hash);
+    // The keys of the files which have downloaded blocks.
+    std::vector<UInt128Wrapper> get_cached_file_hashes();
     /// For debug and UT
     std::string dump_structure(const UInt128Wrapper& hash);
     std::string dump_single_cache_type(const UInt128Wrapper& hash, size_t offset);
@@ -356,6 +362,9 @@ private:
                                       size_t offset, size_t size, FileBlock::State state,
                                       std::lock_guard<std::mutex>& cache_lock);
 
+    // Removes the files of the blocks evicted by get_or_set without the cache lock.
+    void remove_evicted_files(const std::vector<FileCacheKey>& keys);
+
     std::string dump_structure_unlocked(const UInt128Wrapper& hash,
                                         std::lock_guard<std::mutex>& cache_lock);
 
@@ -471,6 +480,12 @@ private:
 
     // keys for async remove
     RecycleFileCacheKeys _recycle_keys;
+    // The blocks evicted by get_or_set are removed from the cache under the cache lock, but their
+    // files are removed after the lock is released, before get_or_set returns. The keys are
+    // collected in _evicted_keys while get_or_set holds the lock, and kept in _removing_files
+    // until their files are removed, the blocks of these keys are not cached in the meantime.
+    std::vector<FileCacheKey>* _evicted_keys = nullptr;
+    std::unordered_set<AccessKeyAndOffset, KeyAndOffsetHash> _removing_files;
 
     std::unique_ptr<LRUQueueRecorder> _lru_recorder;
     std::unique_ptr<CacheLRUDumper> _lru_dumper;
@@ -132,6 +132,38 @@ std::vector<std::string> FileCacheFactory::get_cache_file_by_path(const UInt128W
     return ret;
 }
 
+std::string FileCacheFactory::get_residency_summary(size_t num_bytes, int num_hashes) {
+    std::string summary(num_bytes, '\0');
+    const uint64_t num_bits = num_bytes * 8;
+    if (num_bits == 0) {
+        return summary;
+    }
+    for (const auto& cache : _caches) {
+        for (const auto& hash : cache->get_cached_file_hashes()) {
+            for (int i = 0; i < num_hashes; ++i) {
+                uint64_t bit = (hash.low() + i * hash.high()) % num_bits;
+                summary[bit / 8] |= static_cast<char>(1 << (bit % 8));
+            }
+        }
+    }
+    return summary;
+}
+
+bool FileCacheFactory::residency_summary_contains(const std::string& summary, int num_hashes,
+                                                  const UInt128Wrapper& hash) {
+    const uint64_t num_bits = summary.size() * 8;
+    if (num_bits == 0) {
+        return false;
+    }
+    for (int i = 0; i < num_hashes; ++i) {
+        uint64_t bit = (hash.low() + i * hash.high()) % num_bits;
+        if ((summary[bit / 8] & (1 << (bit % 8))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
 BlockFileCache* FileCacheFactory::get_by_path(const UInt128Wrapper& key) {
     // dont need lock mutex because _caches is immutable after create_file_cache
     return _caches[KeyHash()(key) % _caches.size()].get();
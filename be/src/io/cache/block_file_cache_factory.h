@@ -90,6 +90,20 @@ public:
 
     void get_cache_stats_block(vectorized::Block* block);
 
+    /**
+     * Summarizes the files which have downloaded blocks in the file cache instances into a
+     * bloom filter, so that the splits of external tables can be assigned to the backends
+     * caching their files. For the cache key h of a file, the bits
+     * (h.low() + i * h.high()) % (num_bytes * 8) for i in [0, num_hashes) are set.
+     *
+     * @return the bitset of the bloom filter
+     */
+    std::string get_residency_summary(size_t num_bytes, int num_hashes);
+
+    // Whether the file of the cache key may be in the summary made by get_residency_summary.
+    static bool residency_summary_contains(const std::string& summary, int num_hashes,
+                                           const UInt128Wrapper& hash);
+
     FileCacheFactory() = default;
     FileCacheFactory& operator=(const FileCacheFactory&) = delete;
     FileCacheFactory(const FileCacheFactory&) = delete;
@@ -60,6 +60,29 @@ void FileCacheMetrics::update_metrics_callback() {
             stats->num_io_bytes_read_from_cache + stats->num_io_bytes_read_from_remote);
 }
 
+namespace {
+
+// Adds the counters of a latency histogram, e.g. RemoteIOLatency and its bucket
+// RemoteIOLatencyUnder10ms.
+void add_latency_counters(RuntimeProfile* profile, const std::string& name,
+                          FileCacheProfileReporter::LatencyCounters* counters) {
+    counters->total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, name, TUnit::UNIT, "FileCache", 2);
+    for (size_t i = 0; i < IOLatencyHistogram::NUM_BUCKETS; ++i) {
+        counters->buckets[i] = ADD_CHILD_COUNTER_WITH_LEVEL(
+                profile, name + IOLatencyHistogram::BUCKET_NAMES[i], TUnit::UNIT, name, 2);
+    }
+}
+
+void update_latency_counters(const FileCacheProfileReporter::LatencyCounters& counters,
+                             const IOLatencyHistogram& histogram) {
+    for (size_t i = 0; i < IOLatencyHistogram::NUM_BUCKETS; ++i) {
+        COUNTER_UPDATE(counters.total, histogram.counts[i]);
+        COUNTER_UPDATE(counters.buckets[i], histogram.counts[i]);
+    }
+}
+
+} // namespace
+
 FileCacheProfileReporter::FileCacheProfileReporter(RuntimeProfile* profile) {
     static const char* cache_profile = "FileCache";
     ADD_TIMER_WITH_LEVEL(profile, cache_profile, 1);
@@ -75,6 +98,19 @@ FileCacheProfileReporter::FileCacheProfileReporter(RuntimeProfile* profile) {
                                                           TUnit::BYTES, cache_profile, 1);
     num_skip_cache_io_total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumSkipCacheIOTotal",
                                                            TUnit::UNIT, cache_profile, 1);
+    num_files_with_cached_blocks = ADD_CHILD_COUNTER_WITH_LEVEL(
+            profile, "NumFilesWithCachedBlocks", TUnit::UNIT, cache_profile, 1);
+    num_files_without_cached_blocks = ADD_CHILD_COUNTER_WITH_LEVEL(
+            profile, "NumFilesWithoutCachedBlocks", TUnit::UNIT, cache_profile, 1);
+    num_local_disk_io_total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumLocalDiskIOTotal",
+                                                           TUnit::UNIT, cache_profile, 1);
+    bytes_scanned_from_local_disk = ADD_CHILD_COUNTER_WITH_LEVEL(
+            profile, "BytesScannedFromLocalDisk", TUnit::BYTES, cache_profile, 1);
+    local_disk_io_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile, "LocalDiskIOUseTimer", cache_profile, 1);
+    add_latency_counters(profile, "CacheHitIOLatency", &cache_hit_io_latency);
+    add_latency_counters(profile, "RemoteIOLatency", &remote_io_latency);
+    add_latency_counters(profile, "LocalDiskIOLatency", &local_disk_io_latency);
     bytes_scanned_from_cache = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromCache",
                                                             TUnit::BYTES, cache_profile, 1);
     bytes_scanned_from_remote = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromRemote",
@@ -111,6 +147,14 @@ void FileCacheProfileReporter::update(const FileCacheStatistics* statistics) con
     COUNTER_UPDATE(write_cache_io_timer, statistics->write_cache_io_timer);
     COUNTER_UPDATE(bytes_write_into_cache, statistics->bytes_write_into_cache);
     COUNTER_UPDATE(num_skip_cache_io_total, statistics->num_skip_cache_io_total);
+    COUNTER_UPDATE(num_files_with_cached_blocks, statistics->num_files_with_cached_blocks);
+    COUNTER_UPDATE(num_files_without_cached_blocks, statistics->num_files_without_cached_blocks);
+    COUNTER_UPDATE(num_local_disk_io_total, statistics->num_local_disk_io_total);
+    COUNTER_UPDATE(bytes_scanned_from_local_disk, statistics->bytes_read_from_local_disk);
+    COUNTER_UPDATE(local_disk_io_timer, statistics->local_disk_io_timer);
+    update_latency_counters(cache_hit_io_latency, statistics->cache_hit_io_latency);
+    update_latency_counters(remote_io_latency, statistics->remote_io_latency);
+    update_latency_counters(local_disk_io_latency, statistics->local_disk_io_latency);
     COUNTER_UPDATE(bytes_scanned_from_cache, statistics->bytes_read_from_local);
     COUNTER_UPDATE(bytes_scanned_from_remote, statistics->bytes_read_from_remote);
     COUNTER_UPDATE(read_cache_file_directly_timer, statistics->read_cache_file_directly_timer);
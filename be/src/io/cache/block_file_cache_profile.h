@@ -19,6 +19,7 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <memory>
@@ -73,6 +74,19 @@ struct FileCacheProfileReporter {
     RuntimeProfile::Counter* write_cache_io_timer = nullptr;
     RuntimeProfile::Counter* bytes_write_into_cache = nullptr;
     RuntimeProfile::Counter* num_skip_cache_io_total = nullptr;
+    RuntimeProfile::Counter* num_files_with_cached_blocks = nullptr;
+    RuntimeProfile::Counter* num_files_without_cached_blocks = nullptr;
+    RuntimeProfile::Counter* num_local_disk_io_total = nullptr;
+    RuntimeProfile::Counter* bytes_scanned_from_local_disk = nullptr;
+    RuntimeProfile::Counter* local_disk_io_timer = nullptr;
+    // the number of the IOs and its buckets by latency
+    struct LatencyCounters {
+        RuntimeProfile::Counter* total = nullptr;
+        std::array<RuntimeProfile::Counter*, IOLatencyHistogram::NUM_BUCKETS> buckets {};
+    };
+    LatencyCounters cache_hit_io_latency;
+    LatencyCounters remote_io_latency;
+    LatencyCounters local_disk_io_latency;
     RuntimeProfile::Counter* read_cache_file_directly_timer = nullptr;
     RuntimeProfile::Counter* cache_get_or_set_timer = nullptr;
     RuntimeProfile::Counter* lock_wait_timer = nullptr;
@@ -36,9 +36,12 @@
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
+#include "runtime/exec_env.h"
 #include "util/bit_util.h"
+#include "util/countdown_latch.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -47,10 +50,72 @@ bvar::LatencyRecorder g_skip_cache_num("cached_remote_reader_skip_cache_num");
 bvar::Adder<uint64_t> g_skip_cache_sum("cached_remote_reader_skip_cache_sum");
 bvar::Adder<uint64_t> g_skip_local_cache_io_sum_bytes(
         "cached_remote_reader_skip_local_cache_io_sum_bytes");
+bvar::Adder<uint64_t> g_read_ahead_bytes("cached_remote_reader_read_ahead_bytes");
+
+namespace {
+
+// The number of consecutive sequential or strided reads of a file before it is read ahead.
+constexpr int64_t READ_AHEAD_MIN_MATCHES = 2;
+
+// Downloads the empty blocks of [offset, offset + size) of the file into the cache.
+void read_ahead_into_cache(BlockFileCache* cache, const FileReaderSPtr& remote_file_reader,
+                           const UInt128Wrapper& cache_hash, CacheContext cache_context,
+                           size_t offset, size_t size) {
+    if (remote_file_reader->closed()) {
+        return;
+    }
+    ReadStatistics stats;
+    cache_context.stats = &stats;
+    auto [align_left, align_size] =
+            CachedRemoteFileReader::s_align_size(offset, size, remote_file_reader->size());
+    FileBlocksHolder holder = cache->get_or_set(cache_hash, align_left, align_size, cache_context);
+    std::vector<FileBlockSPtr> empty_blocks;
+    for (auto& block : holder.file_blocks) {
+        if (block->state() == FileBlock::State::EMPTY) {
+            block->get_or_set_downloader();
+            if (block->is_downloader()) {
+                empty_blocks.push_back(block);
+            }
+        }
+    }
+    // the contiguous empty blocks are downloaded by one remote read
+    size_t i = 0;
+    while (i < empty_blocks.size()) {
+        size_t j = i + 1;
+        while (j < empty_blocks.size() &&
+               empty_blocks[j]->range().left == empty_blocks[j - 1]->range().right + 1) {
+            ++j;
+        }
+        size_t start = empty_blocks[i]->range().left;
+        size_t read_size = empty_blocks[j - 1]->range().right - start + 1;
+        std::unique_ptr<char[]> buffer(new char[read_size]);
+        s3_read_counter << 1;
+        Status st = remote_file_reader->read_at(start, Slice(buffer.get(), read_size), &read_size);
+        // the blocks which are not finalized are left empty for the next reader
+        for (; st.ok() && i < j; ++i) {
+            auto& block = empty_blocks[i];
+            st = block->append(Slice(buffer.get() + block->range().left - start,
+                                     block->range().size()));
+            if (st.ok()) {
+                st = block->finalize();
+            }
+            if (st.ok()) {
+                g_read_ahead_bytes << block->range().size();
+            }
+        }
+        if (!st.ok()) {
+            LOG_EVERY_N(WARNING, 100) << "Read ahead into file cache failed. err=" << st.msg();
+            return;
+        }
+    }
+}
+
+} // namespace
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
-        : _remote_file_reader(std::move(remote_file_reader)) {
+        : _remote_file_reader(std::move(remote_file_reader)),
+          _read_ahead_running(std::make_shared<std::atomic<bool>>(false)) {
     _is_doris_table = opts.is_doris_table;
     if (_is_doris_table) {
         _cache_hash = BlockFileCache::hash(path().filename().native());
@@ -74,6 +139,7 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
                 _cache = FileCacheFactory::instance()->get_by_path(_cache_hash);
             }
         }
+        _has_cached_blocks = _cache->has_downloaded_blocks(_cache_hash);
     }
 }
 
@@ -131,6 +197,13 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         if (io_ctx->file_cache_stats && !is_dryrun) {
             // update stats in io_ctx, for query profile
             _update_stats(stats, io_ctx->file_cache_stats, io_ctx->is_inverted_index);
+            if (!_is_doris_table && !_cache_locality_reported.exchange(true)) {
+                if (_has_cached_blocks) {
+                    io_ctx->file_cache_stats->num_files_with_cached_blocks++;
+                } else {
+                    io_ctx->file_cache_stats->num_files_without_cached_blocks++;
+                }
+            }
             // update stats increment in this reading procedure for file cache metrics
             FileCacheStatistics fcache_stats_increment;
             _update_stats(stats, &fcache_stats_increment, io_ctx->is_inverted_index);
@@ -139,6 +212,9 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
     };
     std::unique_ptr<int, decltype(defer_func)> defer((int*)0x01, std::move(defer_func));
     stats.bytes_read += bytes_req;
+    if (config::file_cache_read_ahead_bytes > 0 && !is_dryrun) {
+        _read_ahead(offset, bytes_req, io_ctx);
+    }
     if (config::enable_read_cache_file_directly) {
         // read directly
         SCOPED_RAW_TIMER(&stats.read_cache_file_directly_timer);
@@ -256,6 +332,19 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         }
     }
 
+    auto read_from_remote = [&](size_t read_offset, size_t read_size) -> Status {
+        size_t remote_bytes_read {0};
+        stats.hit_cache = false;
+        s3_read_counter << 1;
+        SCOPED_RAW_TIMER(&stats.remote_read_timer);
+        RETURN_IF_ERROR(_remote_file_reader->read_at(
+                read_offset, Slice(result.data + (read_offset - offset), read_size),
+                &remote_bytes_read));
+        DCHECK(remote_bytes_read == read_size);
+        return Status::OK();
+    };
+    // the downloaded blocks are read after all the blocks are checked
+    std::vector<LocalBlockRead> local_reads;
     size_t current_offset = offset;
     size_t end_offset = offset + bytes_req - 1;
     *bytes_read = 0;
@@ -292,43 +381,142 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         if (wait_time == max_wait_time) [[unlikely]] {
             LOG_WARNING("Waiting too long for the download to complete");
         }
-        {
-            Status st;
-            /*
-             * If block_state == EMPTY, the thread reads the data from remote.
-             * If block_state == DOWNLOADED, when the cache file is deleted by the other process,
-             * the thread reads the data from remote too.
-             */
-            if (block_state == FileBlock::State::DOWNLOADED) {
-                if (is_dryrun) [[unlikely]] {
-                    g_skip_local_cache_io_sum_bytes << read_size;
-                } else {
-                    size_t file_offset = current_offset - left;
-                    SCOPED_RAW_TIMER(&stats.local_read_timer);
-                    st = block->read(Slice(result.data + (current_offset - offset), read_size),
-                                     file_offset);
-                }
-            }
-            if (!st || block_state != FileBlock::State::DOWNLOADED) {
-                LOG(WARNING) << "Read data failed from file cache downloaded by others. err="
-                             << st.msg() << ", block state=" << block_state;
-                size_t bytes_read {0};
-                stats.hit_cache = false;
-                s3_read_counter << 1;
-                SCOPED_RAW_TIMER(&stats.remote_read_timer);
-                RETURN_IF_ERROR(_remote_file_reader->read_at(
-                        current_offset, Slice(result.data + (current_offset - offset), read_size),
-                        &bytes_read));
-                DCHECK(bytes_read == read_size);
+        /*
+         * If block_state == EMPTY, the thread reads the data from remote.
+         * If block_state == DOWNLOADED, when the cache file is deleted by the other process,
+         * the thread reads the data from remote too.
+         */
+        if (block_state == FileBlock::State::DOWNLOADED) {
+            if (is_dryrun) [[unlikely]] {
+                g_skip_local_cache_io_sum_bytes << read_size;
+            } else {
+                local_reads.push_back({block, current_offset, read_size, Status::OK()});
             }
+        } else {
+            LOG(WARNING) << "Read data failed from file cache downloaded by others. block state="
+                         << block_state;
+            RETURN_IF_ERROR(read_from_remote(current_offset, read_size));
         }
         *bytes_read += read_size;
         current_offset = right + 1;
     }
+    if (!local_reads.empty()) {
+        SCOPED_RAW_TIMER(&stats.local_read_timer);
+        _read_downloaded_blocks(local_reads, offset, result);
+    }
+    for (const auto& local_read : local_reads) {
+        if (!local_read.status.ok()) {
+            LOG(WARNING) << "Read data failed from file cache downloaded by others. err="
+                         << local_read.status.msg();
+            RETURN_IF_ERROR(read_from_remote(local_read.offset, local_read.size));
+        }
+    }
     DCHECK(*bytes_read == bytes_req);
     return Status::OK();
 }
 
+std::pair<size_t, size_t> CachedRemoteFileReader::_next_read_ahead_range(size_t offset,
+                                                                         size_t size) {
+    const auto max_size = static_cast<size_t>(config::file_cache_read_ahead_bytes);
+    const size_t end = offset + size;
+    std::lock_guard lock(_read_pattern_mtx);
+    auto& pattern = _read_pattern;
+    bool sequential = false;
+    size_t ahead_offset = 0;
+    size_t ahead_size = 0;
+    if (offset >= pattern.last_end &&
+        offset - pattern.last_end <= static_cast<size_t>(config::file_cache_each_block_size)) {
+        // the read starts at, or a little after, the end of the last read
+        sequential = true;
+        ahead_offset = end;
+        ahead_size = max_size;
+    } else if (pattern.stride > 0 && offset > pattern.last_offset &&
+               offset - pattern.last_offset == pattern.stride) {
+        // the read skips the same distance as the last read, e.g. the chunks of a column
+        ahead_offset = offset + pattern.stride;
+        ahead_size = std::min(size, max_size);
+    }
+    if (ahead_size > 0) {
+        ++pattern.matches;
+    } else {
+        pattern.matches = 0;
+        pattern.read_ahead_end = 0;
+    }
+    pattern.stride = offset > pattern.last_offset ? offset - pattern.last_offset : 0;
+    pattern.last_offset = offset;
+    pattern.last_end = end;
+
+    const size_t ahead_end = std::min(ahead_offset + ahead_size, this->size());
+    if (pattern.matches < READ_AHEAD_MIN_MATCHES || ahead_end <= pattern.read_ahead_end) {
+        return {0, 0};
+    }
+    // a sequential read ahead is issued again when less than half of its range is left
+    if (sequential && pattern.read_ahead_end >= end + max_size / 2) {
+        return {0, 0};
+    }
+    ahead_offset = std::max(ahead_offset, pattern.read_ahead_end);
+    if (ahead_offset >= ahead_end || _read_ahead_running->exchange(true)) {
+        return {0, 0};
+    }
+    pattern.read_ahead_end = ahead_end;
+    return {ahead_offset, ahead_end - ahead_offset};
+}
+
+void CachedRemoteFileReader::_read_ahead(size_t offset, size_t size, const IOContext* io_ctx) {
+    auto* thread_pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    if (thread_pool == nullptr) {
+        return;
+    }
+    auto [ahead_offset, ahead_size] = _next_read_ahead_range(offset, size);
+    if (ahead_size == 0) {
+        return;
+    }
+    // The task does not refer to this reader which may be closed before it runs. The blocks
+    // are reserved with the query id of the read, so the read ahead of a query is bounded by
+    // its limit of the cache.
+    auto st = thread_pool->submit_func([cache = _cache, remote_file_reader = _remote_file_reader,
+                                        cache_hash = _cache_hash,
+                                        cache_context = CacheContext(io_ctx),
+                                        running = _read_ahead_running, ahead_offset, ahead_size] {
+        read_ahead_into_cache(cache, remote_file_reader, cache_hash, cache_context, ahead_offset,
+                              ahead_size);
+        running->store(false);
+    });
+    if (!st.ok()) {
+        _read_ahead_running->store(false);
+    }
+}
+
+void CachedRemoteFileReader::_read_downloaded_blocks(std::vector<LocalBlockRead>& reads,
+                                                     size_t offset, Slice result) {
+    auto read_block = [&](LocalBlockRead& read) {
+        read.status = read.block->read(Slice(result.data + (read.offset - offset), read.size),
+                                       read.offset - read.block->range().left);
+    };
+    auto* thread_pool = ExecEnv::GetInstance()->file_cache_read_thread_pool();
+    if (reads.size() == 1 || thread_pool == nullptr || !config::enable_file_cache_parallel_read) {
+        for (auto& read : reads) {
+            read_block(read);
+        }
+        return;
+    }
+    // The blocks are different files, so their reads are issued at once to keep the queue of
+    // the cache disk busy. This thread reads the first block.
+    CountDownLatch latch(static_cast<int>(reads.size() - 1));
+    for (size_t i = 1; i < reads.size(); ++i) {
+        auto st = thread_pool->submit_func([&, i] {
+            read_block(reads[i]);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            read_block(reads[i]);
+            latch.count_down();
+        }
+    }
+    read_block(reads[0]);
+    latch.wait();
+}
+
 void CachedRemoteFileReader::_update_stats(const ReadStatistics& read_stats,
                                            FileCacheStatistics* statis,
                                            bool is_inverted_index) const {
@@ -344,6 +532,12 @@ void CachedRemoteFileReader::_update_stats(const ReadStatistics& read_stats,
     }
     statis->remote_io_timer += read_stats.remote_read_timer;
     statis->local_io_timer += read_stats.local_read_timer;
+    if (read_stats.local_read_timer > 0) {
+        statis->cache_hit_io_latency.add(read_stats.local_read_timer);
+    }
+    if (read_stats.remote_read_timer > 0) {
+        statis->remote_io_latency.add(read_stats.remote_read_timer);
+    }
     statis->num_skip_cache_io_total += read_stats.skip_cache;
     statis->bytes_write_into_cache += read_stats.bytes_write_into_file_cache;
     statis->write_cache_io_timer += read_stats.local_write_timer;
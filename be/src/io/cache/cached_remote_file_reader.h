@@ -17,11 +17,15 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "io/cache/block_file_cache.h"
@@ -59,13 +63,51 @@ protected:
                         const IOContext* io_ctx) override;
 
 private:
+    // A read of [offset, offset + size) of the file from a downloaded block.
+    struct LocalBlockRead {
+        FileBlockSPtr block;
+        size_t offset;
+        size_t size;
+        Status status;
+    };
+
+    // The pattern of the recent reads of the file, which decides what is read ahead.
+    struct ReadPattern {
+        size_t last_offset = 0;
+        size_t last_end = 0;
+        // the distance between the offsets of the last two reads
+        size_t stride = 0;
+        // the number of consecutive reads which are sequential or strided
+        int64_t matches = 0;
+        // the end of the range read ahead last time
+        size_t read_ahead_end = 0;
+    };
+
     void _insert_file_reader(FileBlockSPtr file_block);
+    // Records the read of [offset, offset + size) in the read pattern, and reads the next range
+    // of a sequential or strided pattern into the cache in the background.
+    void _read_ahead(size_t offset, size_t size, const IOContext* io_ctx);
+    // Returns the range to read ahead after the read of [offset, offset + size), the size is 0
+    // if the reads are random, or the range is read ahead already.
+    std::pair<size_t, size_t> _next_read_ahead_range(size_t offset, size_t size);
+    // Reads the downloaded blocks into `result` which starts at `offset` of the file, the
+    // failed reads are recorded in their status.
+    void _read_downloaded_blocks(std::vector<LocalBlockRead>& reads, size_t offset,
+                                 Slice result);
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
     BlockFileCache* _cache;
     std::shared_mutex _mtx;
     std::map<size_t, FileBlockSPtr> _cache_file_readers;
+    std::mutex _read_pattern_mtx;
+    ReadPattern _read_pattern;
+    // Whether a read ahead of the file is running, at most one runs at a time.
+    std::shared_ptr<std::atomic<bool>> _read_ahead_running;
+    // Whether the file of an external table had downloaded blocks when it was opened, which is
+    // reported to the query profile by the first read.
+    bool _has_cached_blocks = false;
+    std::atomic<bool> _cache_locality_reported {false};
 
     void _update_stats(const ReadStatistics& stats, FileCacheStatistics* state,
                        bool is_inverted_index) const;
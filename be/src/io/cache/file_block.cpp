@@ -162,7 +162,14 @@ Status FileBlock::finalize() {
 }
 
 Status FileBlock::read(Slice buffer, size_t read_offset) {
-    return _mgr->_storage->read(_key, read_offset, buffer);
+    Status st = _mgr->_storage->read(_key, read_offset, buffer);
+    if (st.is<ErrorCode::NOT_FOUND>()) {
+        // The block is restored from the lru dump but its file is gone, it is removed when it
+        // is released, and downloaded again by the next reader.
+        std::lock_guard block_lock(_mutex);
+        _is_deleting = true;
+    }
+    return st;
 }
 
 Status FileBlock::change_cache_type_between_ttl_and_others(FileCacheType new_type) {
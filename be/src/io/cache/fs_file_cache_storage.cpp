@@ -19,8 +19,10 @@
 
 #include <filesystem>
 #include <mutex>
+#include <string_view>
 #include <system_error>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "cpp/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -33,6 +35,8 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/block_compression.h"
+#include "util/coding.h"
 #include "vec/common/hex.h"
 
 namespace doris::io {
@@ -47,6 +51,11 @@ struct BatchLoadArgs {
     bool is_tmp;
 };
 
+// The suffix of the name of a compressed block file. The file is the size of the block as a
+// fixed64, followed by the block compressed by LZ4.
+static constexpr std::string_view COMPRESSED_FILE_SUFFIX = "_lz4";
+static constexpr size_t COMPRESSED_FILE_HEADER_SIZE = sizeof(uint64_t);
+
 FDCache* FDCache::instance() {
     return ExecEnv::GetInstance()->file_cache_open_fd_cache();
 }
@@ -174,9 +183,96 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
     }
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string true_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
+    if (config::enable_file_cache_block_compression) {
+        bool compressed = false;
+        RETURN_IF_ERROR(compress_block_file(file_writer->path(), true_file, &compressed));
+        if (compressed) {
+            return Status::OK();
+        }
+    }
     return fs->rename(file_writer->path(), true_file);
 }
 
+Status FSFileCacheStorage::compress_block_file(const Path& tmp_file, const std::string& true_file,
+                                               bool* compressed) const {
+    *compressed = false;
+    FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(fs->open_file(tmp_file, &file_reader));
+    size_t size = file_reader->size();
+    std::string data(size, '\0');
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(data.data(), size), &bytes_read));
+    RETURN_IF_ERROR(file_reader->close());
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(segment_v2::CompressionTypePB::LZ4, &codec));
+    faststring compressed_data;
+    RETURN_IF_ERROR(codec->compress(Slice(data), &compressed_data));
+    // the block is kept as it is if the compression saves little, it is not worth decompressing
+    size_t compressed_size = COMPRESSED_FILE_HEADER_SIZE + compressed_data.size();
+    if (static_cast<double>(compressed_size) * config::file_cache_block_compression_min_ratio >
+        static_cast<double>(size)) {
+        return Status::OK();
+    }
+    uint8_t header[COMPRESSED_FILE_HEADER_SIZE];
+    encode_fixed64_le(header, size);
+    // the compressed file is written as a tmp file too, which is removed when the cache is loaded
+    std::string compressed_tmp_file = tmp_file.native() + std::string(COMPRESSED_FILE_SUFFIX);
+    FileWriterPtr file_writer;
+    FileWriterOptions opts {.sync_file_data = false};
+    RETURN_IF_ERROR(fs->create_file(compressed_tmp_file, &file_writer, &opts));
+    std::vector<Slice> slices = {Slice(header, COMPRESSED_FILE_HEADER_SIZE),
+                                 Slice(compressed_data.data(), compressed_data.size())};
+    RETURN_IF_ERROR(file_writer->appendv(slices.data(), slices.size()));
+    RETURN_IF_ERROR(file_writer->close());
+    RETURN_IF_ERROR(
+            fs->rename(compressed_tmp_file, true_file + std::string(COMPRESSED_FILE_SUFFIX)));
+    *compressed = true;
+    return fs->delete_file(tmp_file);
+}
+
+Status FSFileCacheStorage::read_compressed(const FileReaderSPtr& file_reader, size_t value_offset,
+                                           Slice buffer) const {
+    size_t file_size = file_reader->size();
+    if (file_size < COMPRESSED_FILE_HEADER_SIZE) {
+        return Status::InternalError("compressed file cache block is too small, file={}",
+                                     file_reader->path().native());
+    }
+    std::unique_ptr<char[]> file_data(new char[file_size]);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(file_data.get(), file_size), &bytes_read));
+    size_t size = decode_fixed64_le(reinterpret_cast<const uint8_t*>(file_data.get()));
+    if (value_offset + buffer.get_size() > size) {
+        return Status::InternalError(
+                "read out of the compressed file cache block, file={}, size={}, offset={}, "
+                "bytes={}",
+                file_reader->path().native(), size, value_offset, buffer.get_size());
+    }
+    BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(segment_v2::CompressionTypePB::LZ4, &codec));
+    Slice compressed_data(file_data.get() + COMPRESSED_FILE_HEADER_SIZE,
+                          file_size - COMPRESSED_FILE_HEADER_SIZE);
+    // the whole block is decompressed, directly into the buffer if it is read at all
+    if (value_offset == 0 && buffer.get_size() == size) {
+        return codec->decompress(compressed_data, &buffer);
+    }
+    std::unique_ptr<char[]> data(new char[size]);
+    Slice decompressed(data.get(), size);
+    RETURN_IF_ERROR(codec->decompress(compressed_data, &decompressed));
+    memcpy(buffer.data, data.get() + value_offset, buffer.get_size());
+    return Status::OK();
+}
+
+Status FSFileCacheStorage::read_uncompressed_size(const Path& file, size_t* size) const {
+    FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(fs->open_file(file, &file_reader));
+    uint8_t header[COMPRESSED_FILE_HEADER_SIZE];
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(header, COMPRESSED_FILE_HEADER_SIZE),
+                                         &bytes_read));
+    *size = decode_fixed64_le(header);
+    return file_reader->close();
+}
+
 Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
     AccessKeyAndOffset fd_key = std::make_pair(key.hash, key.offset);
     FileReaderSPtr file_reader = FDCache::instance()->get_file_reader(fd_key);
@@ -194,6 +290,8 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
         } else if (!s.ok() && s.is<ErrorCode::NOT_FOUND>()) { // but handle NOT_FOUND error
             auto candidates = get_path_in_local_cache_all_candidates(
                     get_path_in_local_cache(key.hash, key.meta.expiration_time), key.offset);
+            // the block may be compressed
+            candidates.insert(candidates.begin(), file + std::string(COMPRESSED_FILE_SUFFIX));
             for (auto& candidate : candidates) {
                 s = fs->open_file(candidate, &file_reader);
                 if (s.ok()) {
@@ -208,6 +306,14 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
 
         FDCache::instance()->insert_file_reader(fd_key, file_reader);
     }
+    if (file_reader->path().native().ends_with(COMPRESSED_FILE_SUFFIX)) {
+        auto s = read_compressed(file_reader, value_offset, buffer);
+        if (!s.ok()) {
+            LOG(WARNING) << "read compressed file failed, file=" << file_reader->path()
+                         << ", error=" << s.to_string();
+        }
+        return s;
+    }
     size_t bytes_read = 0;
     auto s = file_reader->read_at(value_offset, buffer, &bytes_read);
     if (!s.ok()) {
@@ -224,6 +330,7 @@ Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
     FDCache::instance()->remove_file_reader(std::make_pair(key.hash, key.offset));
     RETURN_IF_ERROR(fs->delete_file(file));
+    RETURN_IF_ERROR(fs->delete_file(file + std::string(COMPRESSED_FILE_SUFFIX)));
     // return OK not means the file is deleted, it may be not exist
     // So for TTL, we make sure the old format will be removed well
     if (key.meta.type == FileCacheType::TTL) {
@@ -261,6 +368,13 @@ Status FSFileCacheStorage::change_key_meta_type(const FileCacheKey& key, const F
         std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
         std::string original_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
         std::string new_file = get_path_in_local_cache(dir, key.offset, type);
+        bool exists = true;
+        RETURN_IF_ERROR(fs->exists(original_file, &exists));
+        if (!exists) {
+            // the block is compressed
+            original_file += COMPRESSED_FILE_SUFFIX;
+            new_file += COMPRESSED_FILE_SUFFIX;
+        }
         RETURN_IF_ERROR(fs->rename(original_file, new_file));
     }
     return Status::OK();
@@ -589,9 +703,14 @@ std::string FSFileCacheStorage::get_version_path() const {
 
 Status FSFileCacheStorage::parse_filename_suffix_to_cache_type(
         const std::shared_ptr<LocalFileSystem>& fs, const Path& file_path, long expiration_time,
-        size_t size, size_t* offset, bool* is_tmp, FileCacheType* cache_type) const {
+        size_t size, size_t* offset, bool* is_tmp, FileCacheType* cache_type,
+        bool* is_compressed) const {
     std::error_code ec;
     std::string offset_with_suffix = file_path.native();
+    *is_compressed = offset_with_suffix.ends_with(COMPRESSED_FILE_SUFFIX);
+    if (*is_compressed) {
+        offset_with_suffix.resize(offset_with_suffix.size() - COMPRESSED_FILE_SUFFIX.size());
+    }
     auto delim_pos1 = offset_with_suffix.find('_');
     bool parsed = true;
 
@@ -706,10 +825,15 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
                 size_t size = offset_it->file_size(ec);
                 size_t offset = 0;
                 bool is_tmp = false;
+                bool is_compressed = false;
                 FileCacheType cache_type = FileCacheType::NORMAL;
                 if (!parse_filename_suffix_to_cache_type(fs, offset_it->path().filename().native(),
                                                          expiration_time, size, &offset, &is_tmp,
-                                                         &cache_type)) {
+                                                         &cache_type, &is_compressed)) {
+                    continue;
+                }
+                if (is_compressed && !is_tmp &&
+                    !read_uncompressed_size(offset_it->path(), &size).ok()) {
                     continue;
                 }
                 context.cache_type = cache_type;
@@ -803,10 +927,14 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
         size_t size = check_it->file_size(ec);
         size_t offset = 0;
         bool is_tmp = false;
+        bool is_compressed = false;
         FileCacheType cache_type = FileCacheType::NORMAL;
         if (!parse_filename_suffix_to_cache_type(fs, check_it->path().filename().native(),
                                                  context_original.expiration_time, size, &offset,
-                                                 &is_tmp, &cache_type)) {
+                                                 &is_tmp, &cache_type, &is_compressed)) {
+            continue;
+        }
+        if (is_compressed && !is_tmp && !read_uncompressed_size(check_it->path(), &size).ok()) {
             continue;
         }
         if (!mgr->_files.contains(key.hash) || !mgr->_files[key.hash].contains(offset)) {
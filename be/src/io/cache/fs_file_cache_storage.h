@@ -101,7 +101,20 @@ private:
     Status parse_filename_suffix_to_cache_type(const std::shared_ptr<LocalFileSystem>& fs,
                                                const Path& file_path, long expiration_time,
                                                size_t size, size_t* offset, bool* is_tmp,
-                                               FileCacheType* cache_type) const;
+                                               FileCacheType* cache_type,
+                                               bool* is_compressed) const;
+
+    // Writes the tmp file of a block compressed as the block file, if the compression ratio is
+    // at least file_cache_block_compression_min_ratio.
+    Status compress_block_file(const Path& tmp_file, const std::string& true_file,
+                               bool* compressed) const;
+
+    // Reads [value_offset, value_offset + buffer.size) of a compressed block.
+    Status read_compressed(const FileReaderSPtr& file_reader, size_t value_offset,
+                           Slice buffer) const;
+
+    // Reads the size of a block from the header of its compressed file.
+    Status read_uncompressed_size(const Path& file, size_t* size) const;
 
     Status write_file_cache_version() const;
 
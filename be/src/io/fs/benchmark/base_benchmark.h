@@ -20,15 +20,18 @@
 #include <benchmark/benchmark.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <ctime>
 #include <iostream>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "common/status.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/io_common.h"
 #include "util/slice.h"
 
 namespace doris::io {
@@ -155,6 +158,99 @@ public:
         return status;
     }
 
+    // The offsets of the reads of the access pattern, "sequential" reads the file from the
+    // beginning like the scan of the column chunks, "random" reads `read_count` random pages of
+    // the file like the lookup of pages by an index.
+    std::vector<size_t> get_read_offsets(benchmark::State& state, size_t file_size,
+                                         size_t read_size) {
+        std::string pattern = _conf_map.contains("access_pattern") ? _conf_map["access_pattern"]
+                                                                    : "sequential";
+        std::vector<size_t> offsets;
+        if (pattern == "random") {
+            size_t read_count = _conf_map.contains("read_count")
+                                        ? std::stol(_conf_map["read_count"])
+                                        : 1000L;
+            std::mt19937_64 rng(state.thread_index());
+            size_t num_pages = std::max(1UL, file_size / read_size);
+            std::uniform_int_distribution<size_t> dist(0, num_pages - 1);
+            for (size_t i = 0; i < read_count; ++i) {
+                offsets.push_back(dist(rng) * read_size);
+            }
+        } else {
+            for (size_t offset = 0; offset < file_size; offset += read_size) {
+                offsets.push_back(offset);
+            }
+        }
+        return offsets;
+    }
+
+    // Reads the file by the access pattern of the conf, reports the throughput, the latency
+    // percentiles of the reads and the file cache statistics of `io_ctx`.
+    Status read_by_pattern(benchmark::State& state, FileReaderSPtr reader,
+                           const std::vector<size_t>& offsets, size_t read_size,
+                           const IOContext* io_ctx) {
+        bm_log("begin to read {} by pattern, thread: {}, reads: {}", _name, state.thread_index(),
+               offsets.size());
+        std::vector<char> buffer(read_size);
+        std::vector<double> latencies;
+        latencies.reserve(offsets.size());
+        size_t total_bytes = 0;
+        Status status;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (size_t offset : offsets) {
+            size_t bytes_read = 0;
+            Slice data(buffer.data(), std::min(read_size, reader->size() - offset));
+            auto read_start = std::chrono::high_resolution_clock::now();
+            status = reader->read_at(offset, data, &bytes_read, io_ctx);
+            auto read_end = std::chrono::high_resolution_clock::now();
+            if (!status.ok()) {
+                bm_log("reader read_at error: {}", status.to_string());
+                break;
+            }
+            latencies.push_back(
+                    std::chrono::duration<double, std::micro>(read_end - read_start).count());
+            total_bytes += bytes_read;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+                std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+        state.counters["ReadRate(B/S)"] =
+                benchmark::Counter(total_bytes, benchmark::Counter::kIsRate);
+        state.counters["ReadTotal(B)"] = total_bytes;
+        if (!latencies.empty()) {
+            std::sort(latencies.begin(), latencies.end());
+            auto percentile = [&](double p) {
+                return latencies[std::min(latencies.size() - 1,
+                                          static_cast<size_t>(p * latencies.size()))];
+            };
+            state.counters["LatencyP50(us)"] = percentile(0.5);
+            state.counters["LatencyP99(us)"] = percentile(0.99);
+            state.counters["LatencyMax(us)"] = latencies.back();
+        }
+        if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr) {
+            const auto* stats = io_ctx->file_cache_stats;
+            int64_t cache_bytes = stats->bytes_read_from_local + stats->bytes_read_from_remote;
+            state.counters["CacheHitRate"] =
+                    cache_bytes == 0 ? 0
+                                     : static_cast<double>(stats->bytes_read_from_local) /
+                                               static_cast<double>(cache_bytes);
+            state.counters["CacheLockWait(S)"] = static_cast<double>(stats->lock_wait_timer) / 1e9;
+            state.counters["RemoteIOTime(S)"] = static_cast<double>(stats->remote_io_timer) / 1e9;
+        }
+
+        if (status.ok() && reader != nullptr) {
+            status = reader->close();
+        }
+        bm_log("finish to read {} by pattern, thread: {}, size {}, seconds: {}, status: {}",
+               _name, state.thread_index(), total_bytes, elapsed_seconds.count(), status);
+        return status;
+    }
+
+    size_t get_read_size() {
+        return _conf_map.contains("read_size") ? std::stol(_conf_map["read_size"]) : 65536L;
+    }
+
     Status write(benchmark::State& state, FileWriter* writer) {
         bm_log("begin to write {}, thread: {}, size: {}", _name, state.thread_index(), _file_size);
         size_t write_size = _file_size;
@@ -21,8 +21,12 @@
 #include <string>
 #include <vector>
 
+#include "io/cache/block_file_cache_factory.h"
+#include "io/cache/fs_file_cache_storage.h"
 #include "io/fs/benchmark/hdfs_benchmark.hpp"
 #include "io/fs/benchmark/s3_benchmark.hpp"
+#include "olap/options.h"
+#include "runtime/exec_env.h"
 
 namespace doris::io {
 
@@ -46,6 +50,10 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
             *bm = new S3SingleReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "prefetch_read") {
             *bm = new S3PrefetchReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "cached_read") {
+            *bm = new S3CachedReadBenchmark(threads, iterations, file_size, conf_map);
+        } else if (op_type == "merge_range_read") {
+            *bm = new S3MergeRangeReadBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "rename") {
             *bm = new S3RenameBenchmark(threads, iterations, file_size, conf_map);
         } else if (op_type == "exists") {
@@ -101,6 +109,14 @@ public:
             return Status::Error<INTERNAL_ERROR>("error read config file.");
         }
         doris::CpuInfo::init();
+        if (doris::config::enable_file_cache) {
+            // The file cache of the cached reads, set up as the BE does.
+            auto* exec_env = ExecEnv::GetInstance();
+            exec_env->_file_cache_factory = new FileCacheFactory();
+            exec_env->_file_cache_open_fd_cache = std::make_unique<FDCache>();
+            std::vector<CachePath> cache_paths;
+            exec_env->init_file_cache_factory(cache_paths);
+        }
         Status status = Status::OK();
         if (doris::config::enable_java_support) {
             // Init jni
@@ -26,7 +26,8 @@
 
 DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs");
 DEFINE_string(operation, "create_write",
-              "Supported Operations: create_write, open_read, open, rename, delete, exists");
+              "Supported Operations: create_write, open_read, open, rename, delete, exists, "
+              "cached_read, merge_range_read");
 DEFINE_string(threads, "1", "Number of threads");
 DEFINE_string(iterations, "1", "Number of runs of each thread");
 DEFINE_string(repetitions, "1", "Number of iterations");
@@ -48,6 +49,8 @@ std::string get_usage(const std::string& progname) {
     ss << "\nop_type:\n";
     ss << "     read\n";
     ss << "     write\n";
+    ss << "     cached_read (s3 only, read through the file cache)\n";
+    ss << "     merge_range_read (s3 only, read through the merge range reader)\n";
     ss << "\nthreads:\n";
     ss << "     num of threads\n";
     ss << "\niterations:\n";
@@ -56,6 +59,11 @@ std::string get_usage(const std::string& progname) {
     ss << "     Number of iterations\n";
     ss << "\nfile_size:\n";
     ss << "     File size for read/write opertions\n";
+    ss << "\nconf of cached_read and merge_range_read:\n";
+    ss << "     file_path: the file to read\n";
+    ss << "     access_pattern: sequential or random pages, default sequential\n";
+    ss << "     read_size: bytes of each read, default 65536\n";
+    ss << "     read_count: number of random reads of each thread, default 1000\n";
     ss << "\nExample:\n";
     ss << progname
        << " --conf my.conf --fs_type=hdfs --operation=create_write --threads=2 --iterations=100 "
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include "io/cache/block_file_cache_factory.h"
+#include "io/cache/cached_remote_file_reader.h"
 #include "io/file_factory.h"
 #include "io/fs/benchmark/base_benchmark.h"
 #include "io/fs/buffered_reader.h"
@@ -25,6 +27,7 @@
 #include "io/fs/s3_file_reader.h"
 #include "io/fs/s3_file_system.h"
 #include "runtime/exec_env.h"
+#include "util/runtime_profile.h"
 #include "util/s3_uri.h"
 #include "util/slice.h"
 
@@ -122,6 +125,83 @@ public:
     }
 };
 
+// Read a single specified file through the file cache by the access pattern of the conf
+class S3CachedReadBenchmark : public S3Benchmark {
+public:
+    S3CachedReadBenchmark(int threads, int iterations, size_t file_size,
+                          const std::map<std::string, std::string>& conf_map)
+            : S3Benchmark("S3CachedReadBenchmark", threads, iterations, file_size, conf_map) {}
+    virtual ~S3CachedReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+
+    Status run(benchmark::State& state) override {
+        if (ExecEnv::GetInstance()->file_cache_factory() == nullptr ||
+            FileCacheFactory::instance()->get_cache_instance_size() == 0) {
+            return Status::InternalError("file cache is not enabled, check enable_file_cache");
+        }
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+
+        io::FileReaderSPtr remote_reader;
+        RETURN_IF_ERROR(fs->open_file(file_path, &remote_reader));
+        io::FileReaderOptions reader_opts;
+        reader_opts.cache_type = io::FileCachePolicy::FILE_BLOCK_CACHE;
+        reader_opts.file_size = remote_reader->size();
+        auto reader = std::make_shared<CachedRemoteFileReader>(remote_reader, reader_opts);
+
+        FileCacheStatistics stats;
+        IOContext io_ctx;
+        io_ctx.file_cache_stats = &stats;
+        size_t read_size = get_read_size();
+        return read_by_pattern(state, reader, get_read_offsets(state, reader->size(), read_size),
+                               read_size, &io_ctx);
+    }
+};
+
+// Read the pages of a single specified file by the merge range reader, which merges the small
+// random reads into larger requests
+class S3MergeRangeReadBenchmark : public S3Benchmark {
+public:
+    S3MergeRangeReadBenchmark(int threads, int iterations, size_t file_size,
+                              const std::map<std::string, std::string>& conf_map)
+            : S3Benchmark("S3MergeRangeReadBenchmark", threads, iterations, file_size, conf_map) {
+    }
+    virtual ~S3MergeRangeReadBenchmark() = default;
+
+    virtual std::string get_file_path(benchmark::State& state) override {
+        std::string file_path = _conf_map["file_path"];
+        bm_log("file_path: {}", file_path);
+        return file_path;
+    }
+
+    Status run(benchmark::State& state) override {
+        auto file_path = get_file_path(state);
+        std::shared_ptr<io::S3FileSystem> fs;
+        RETURN_IF_ERROR(get_fs(file_path, &fs));
+
+        io::FileReaderSPtr remote_reader;
+        RETURN_IF_ERROR(fs->open_file(file_path, &remote_reader));
+        size_t read_size = get_read_size();
+        // The ranges of the merge range reader are sorted and read in order.
+        auto offsets = get_read_offsets(state, remote_reader->size(), read_size);
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+        std::vector<PrefetchRange> ranges;
+        for (size_t offset : offsets) {
+            ranges.emplace_back(offset, std::min(offset + read_size, remote_reader->size()));
+        }
+        RuntimeProfile profile("S3MergeRangeReadBenchmark");
+        auto reader = std::make_shared<MergeRangeFileReader>(&profile, remote_reader, ranges);
+        return read_by_pattern(state, reader, offsets, read_size, nullptr);
+    }
+};
+
 class S3CreateWriteBenchmark : public S3Benchmark {
 public:
     S3CreateWriteBenchmark(int threads, int iterations, size_t file_size,
@@ -28,6 +28,7 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/status.h"
+#include "io/fs/hdfs_file_reader.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "runtime/workload_management/io_throttle.h"
@@ -45,6 +46,95 @@ bvar::PerSecond<bvar::Adder<uint64_t>> g_bytes_downloaded_per_second("buffered_r
                                                                      "bytes_downloaded_per_second",
                                                                      &g_bytes_downloaded, 60);
 
+RemoteReadCostModel* RemoteReadCostModel::get(const io::FileReader* reader) {
+    static RemoteReadCostModel s3_model;
+    static RemoteReadCostModel hdfs_model;
+    static RemoteReadCostModel file_cache_model;
+    auto* file_reader = const_cast<io::FileReader*>(reader);
+    if (typeid_cast<io::S3FileReader*>(file_reader) != nullptr) {
+        return &s3_model;
+    }
+    if (typeid_cast<io::HdfsFileReader*>(file_reader) != nullptr) {
+        return &hdfs_model;
+    }
+    if (typeid_cast<io::CachedRemoteFileReader*>(file_reader) != nullptr) {
+        return &file_cache_model;
+    }
+    return nullptr;
+}
+
+void RemoteReadCostModel::update(size_t bytes, int64_t time_ns) {
+    if (bytes == 0 || time_ns <= 0) {
+        return;
+    }
+    const double size = static_cast<double>(bytes) / 1024 / 1024;
+    const double time = static_cast<double>(time_ns) / 1000 / 1000;
+    std::lock_guard l(_lock);
+    _weight = _weight * DECAY + 1;
+    _sum_size = _sum_size * DECAY + size;
+    _sum_time = _sum_time * DECAY + time;
+    _sum_size_square = _sum_size_square * DECAY + size * size;
+    _sum_size_time = _sum_size_time * DECAY + size * time;
+}
+
+size_t RemoteReadCostModel::equivalent_io_size() const {
+    std::lock_guard l(_lock);
+    if (_weight < MIN_WEIGHT) {
+        return 0;
+    }
+    const double mean_size = _sum_size / _weight;
+    const double mean_time = _sum_time / _weight;
+    const double variance = _sum_size_square / _weight - mean_size * mean_size;
+    // The reads of about the same size can not tell the latency from the bandwidth.
+    if (variance <= 1e-6 * _sum_size_square / _weight) {
+        return 0;
+    }
+    // ms per MB and ms
+    const double slope = (_sum_size_time / _weight - mean_size * mean_time) / variance;
+    const double latency = mean_time - slope * mean_size;
+    if (slope <= 0 || latency <= 0) {
+        return 0;
+    }
+    return static_cast<size_t>(latency / slope * 1024 * 1024);
+}
+
+void MergeRangeFileReader::_choose_read_sizes() {
+    // Equivalent min size of each IO that can reach the maximum storage speed limit:
+    // 1MB for oss, 8KB for hdfs
+    _equivalent_io_size =
+            _is_oss ? config::merged_oss_min_io_size : config::merged_hdfs_min_io_size;
+    _max_merge_gap = SMALL_IO;
+    if (!config::enable_adaptive_remote_read_size) {
+        return;
+    }
+    _cost_model = RemoteReadCostModel::get(_reader.get());
+    if (_cost_model == nullptr) {
+        return;
+    }
+    const size_t learned_size = _cost_model->equivalent_io_size();
+    if (learned_size > 0) {
+        _equivalent_io_size = std::clamp<size_t>(learned_size, 4096, READ_SLICE_SIZE);
+        _max_merge_gap = std::clamp<size_t>(learned_size, BOX_SIZE / 16, READ_SLICE_SIZE);
+    }
+}
+
+Status MergeRangeFileReader::_read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                                               const IOContext* io_ctx) {
+    int64_t read_time = 0;
+    Status st;
+    {
+        SCOPED_RAW_TIMER(&read_time);
+        st = _reader->read_at(offset, result, bytes_read, io_ctx);
+    }
+    _statistics.read_time += read_time;
+    _statistics.merged_io++;
+    _statistics.merged_bytes += *bytes_read;
+    if (st.ok() && _cost_model != nullptr) {
+        _cost_model->update(*bytes_read, read_time);
+    }
+    return st;
+}
+
 Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                           const IOContext* io_ctx) {
     _statistics.request_io++;
@@ -54,11 +144,8 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     }
     const int range_index = _search_read_range(offset, offset + result.size);
     if (range_index < 0) {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
-        Status st = _reader->read_at(offset, result, bytes_read, io_ctx);
-        _statistics.merged_io++;
+        Status st = _read_from_reader(offset, result, bytes_read, io_ctx);
         _statistics.request_bytes += *bytes_read;
-        _statistics.merged_bytes += *bytes_read;
         return st;
     }
     if (offset + result.size > _random_access_ranges[range_index].end_offset) {
@@ -88,14 +175,11 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
 
     size_t to_read = result.size - has_read;
     if (to_read >= SMALL_IO || to_read >= _remaining) {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read, Slice(result.data + has_read, to_read),
+                                          &read_size, io_ctx));
         *bytes_read = has_read + read_size;
-        _statistics.merged_io++;
         _statistics.request_bytes += read_size;
-        _statistics.merged_bytes += read_size;
         return Status::OK();
     }
 
@@ -137,7 +221,7 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
         if (merge_index < _random_access_ranges.size() - 1 && merge_start < merge_end) {
             size_t gap = _random_access_ranges[merge_index + 1].start_offset -
                          _random_access_ranges[merge_index].end_offset;
-            if ((content_size + hollow_size) > SMALL_IO && gap >= SMALL_IO) {
+            if ((content_size + hollow_size) > SMALL_IO && gap >= _max_merge_gap) {
                 // too large gap
                 break;
             }
@@ -183,14 +267,11 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
 
     if (best_merged_size == to_read) {
         // read directly to avoid copy operation
-        SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read, Slice(result.data + has_read, to_read),
+                                          &read_size, io_ctx));
         *bytes_read = has_read + read_size;
-        _statistics.merged_io++;
         _statistics.request_bytes += read_size;
-        _statistics.merged_bytes += read_size;
         return Status::OK();
     }
 
@@ -314,13 +395,8 @@ Status MergeRangeFileReader::_fill_box(int range_index, size_t start_offset, siz
     }
 
     *bytes_read = 0;
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
-        RETURN_IF_ERROR(_reader->read_at(start_offset, Slice(_read_slice->data(), to_read),
-                                         bytes_read, io_ctx));
-        _statistics.merged_io++;
-        _statistics.merged_bytes += *bytes_read;
-    }
+    RETURN_IF_ERROR(_read_from_reader(start_offset, Slice(_read_slice->data(), to_read),
+                                      bytes_read, io_ctx));
 
     SCOPED_RAW_TIMER(&_statistics.copy_time);
     size_t copy_start = start_offset;
@@ -456,10 +532,15 @@ void PrefetchBuffer::prefetch_buffer() {
     _len = 0;
     Status s;
 
+    int64_t read_time = 0;
     {
-        SCOPED_RAW_TIMER(&_statis.read_time);
+        SCOPED_RAW_TIMER(&read_time);
         s = _reader->read_at(_offset, Slice {_buf.get(), buf_size}, &_len, _io_ctx);
     }
+    _statis.read_time += read_time;
+    if (s.ok() && _cost_model != nullptr) {
+        _cost_model->update(_len, read_time);
+    }
     if (UNLIKELY(s.ok() && buf_size != _len)) {
         // This indicates that the data size returned by S3 object storage is smaller than what we requested,
         // which seems to be a violation of the S3 protocol since our request range was valid.
@@ -558,7 +639,7 @@ Status PrefetchBuffer::read_buffer(size_t off, const char* out, size_t buf_len,
     auto start = std::chrono::steady_clock::now();
     // The baseline time is calculated by dividing the size of each buffer by MB/s.
     // If it exceeds this value, it is considered a slow I/O operation.
-    constexpr auto read_time_baseline = std::chrono::seconds(s_max_pre_buffer_size / 1024 / 1024);
+    const auto read_time_baseline = std::chrono::seconds(std::max<size_t>(_size / 1024 / 1024, 1));
     {
         std::unique_lock lck {_lock};
         // buffer must be prefetched or it's closed
@@ -637,9 +718,23 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
         buffer_size = config::remote_storage_read_buffer_mb * 1024 * 1024;
     }
     _size = _reader->size();
-    _whole_pre_buffer_size = buffer_size;
     _file_range.end_offset = std::min(_file_range.end_offset, _size);
-    int buffer_num = buffer_size > s_max_pre_buffer_size ? buffer_size / s_max_pre_buffer_size : 1;
+    _pre_buffer_size = s_max_pre_buffer_size;
+    RemoteReadCostModel* cost_model = nullptr;
+    if (config::enable_adaptive_remote_read_size) {
+        cost_model = RemoteReadCostModel::get(_reader.get());
+    }
+    if (cost_model != nullptr) {
+        const auto learned_size = static_cast<int64_t>(cost_model->equivalent_io_size());
+        if (learned_size > 0) {
+            // A few times of the equivalent IO size wastes little time on the fixed cost of IOs,
+            // the rest of the buffer memory prefetches ahead.
+            _pre_buffer_size = std::clamp<int64_t>(learned_size * 4, s_max_pre_buffer_size / 4,
+                                                   s_max_pre_buffer_size * 4);
+        }
+    }
+    int buffer_num = buffer_size > _pre_buffer_size ? buffer_size / _pre_buffer_size : 1;
+    _whole_pre_buffer_size = buffer_num * _pre_buffer_size;
     std::function<void(PrefetchBuffer&)> sync_buffer = nullptr;
     if (profile != nullptr) {
         const char* prefetch_buffered_reader = "PrefetchBufferedReader";
@@ -654,6 +749,12 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
                 ADD_CHILD_COUNTER(profile, "RequestIO", TUnit::UNIT, prefetch_buffered_reader);
         auto request_bytes =
                 ADD_CHILD_COUNTER(profile, "RequestBytes", TUnit::BYTES, prefetch_buffered_reader);
+        COUNTER_SET(ADD_CHILD_COUNTER(profile, "PrefetchBufferSize", TUnit::BYTES,
+                                      prefetch_buffered_reader),
+                    _pre_buffer_size);
+        COUNTER_SET(ADD_CHILD_COUNTER(profile, "PrefetchBufferNum", TUnit::UNIT,
+                                      prefetch_buffered_reader),
+                    static_cast<int64_t>(buffer_num));
         sync_buffer = [=](PrefetchBuffer& buf) {
             COUNTER_UPDATE(copy_time, buf._statis.copy_time);
             COUNTER_UPDATE(read_time, buf._statis.read_time);
@@ -667,8 +768,9 @@ PrefetchBufferedReader::PrefetchBufferedReader(RuntimeProfile* profile, io::File
     // to make sure the buffer reader will start to read at right position.
     for (int i = 0; i < buffer_num; i++) {
         _pre_buffers.emplace_back(std::make_shared<PrefetchBuffer>(
-                _file_range, s_max_pre_buffer_size, _whole_pre_buffer_size, _reader.get(), _io_ctx,
+                _file_range, _pre_buffer_size, _whole_pre_buffer_size, _reader.get(), _io_ctx,
                 sync_buffer));
+        _pre_buffers.back()->_cost_model = cost_model;
     }
 }
 
@@ -196,6 +196,39 @@ private:
      */
 };
 
+/**
+ * Learns the cost of the IOs of a kind of remote storage (S3, HDFS or the file cache) from the
+ * size and the time of the finished reads, by fitting time = latency + size / bandwidth to the
+ * recent reads with least squares. latency * bandwidth is the equivalent IO size: reading that
+ * many more bytes costs as much as issuing another IO. MergeRangeFileReader merges the ranges
+ * whose gaps are smaller than it, and PrefetchBufferedReader prefetches a few times of it in an IO,
+ * so both trade the wasted bytes against the number of IOs by the measured cost of the storage.
+ */
+class RemoteReadCostModel {
+public:
+    // The model of the storage kind of `reader`, nullptr if the cost of the reader is not learned.
+    static RemoteReadCostModel* get(const io::FileReader* reader);
+
+    void update(size_t bytes, int64_t time_ns);
+
+    // The equivalent IO size in bytes, 0 if there are not enough reads of different sizes to
+    // estimate it, or the reads show no fixed cost.
+    size_t equivalent_io_size() const;
+
+private:
+    // The weight of a read is halved after about 700 reads.
+    static constexpr double DECAY = 0.999;
+    static constexpr double MIN_WEIGHT = 32;
+
+    mutable std::mutex _lock;
+    // The decayed sums of the reads, the size is in MB and the time is in ms.
+    double _weight = 0;
+    double _sum_size = 0;
+    double _sum_time = 0;
+    double _sum_size_square = 0;
+    double _sum_size_time = 0;
+};
+
 /**
  * A FileReader that efficiently supports random access format like parquet and orc.
  * In order to merge small IO in parquet and orc, the random access ranges should be generated
@@ -212,6 +245,9 @@ private:
  * and use a reference counter to record how many ranges are cached in the box. If reference counter
  * equals zero, the box can be release or reused by other ranges. When there is no empty box for a new
  * read operation, the read operation will do directly.
+ *
+ * When config::enable_adaptive_remote_read_size is set, the equivalent IO size and the largest gap
+ * to merge are learned by the RemoteReadCostModel of the storage instead of the fixed configs.
  */
 class MergeRangeFileReader : public io::FileReader {
 public:
@@ -284,10 +320,7 @@ public:
         _remaining = TOTAL_BUFFER_SIZE;
         _is_oss = typeid_cast<io::S3FileReader*>(_reader.get()) != nullptr;
         _max_amplified_ratio = config::max_amplified_read_ratio;
-        // Equivalent min size of each IO that can reach the maximum storage speed limit:
-        // 1MB for oss, 8KB for hdfs
-        _equivalent_io_size =
-                _is_oss ? config::merged_oss_min_io_size : config::merged_hdfs_min_io_size;
+        _choose_read_sizes();
         for (const PrefetchRange& range : _random_access_ranges) {
             _statistics.apply_bytes += range.end_offset - range.start_offset;
         }
@@ -306,6 +339,12 @@ public:
                                                          random_profile, 1);
             _apply_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "ApplyBytes", TUnit::BYTES,
                                                         random_profile, 1);
+            _equivalent_io_size_counter = ADD_CHILD_COUNTER_WITH_LEVEL(
+                    _profile, "EquivalentIOSize", TUnit::BYTES, random_profile, 1);
+            _max_merge_gap_counter = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "MaxMergeGap",
+                                                                  TUnit::BYTES, random_profile, 1);
+            _amplified_ratio = ADD_CHILD_COUNTER_WITH_LEVEL(
+                    _profile, "AmplifiedRatio", TUnit::DOUBLE_VALUE, random_profile, 1);
         }
     }
 
@@ -349,6 +388,14 @@ protected:
             COUNTER_UPDATE(_request_bytes, _statistics.request_bytes);
             COUNTER_UPDATE(_merged_bytes, _statistics.merged_bytes);
             COUNTER_UPDATE(_apply_bytes, _statistics.apply_bytes);
+            COUNTER_SET(_equivalent_io_size_counter, static_cast<int64_t>(_equivalent_io_size));
+            COUNTER_SET(_max_merge_gap_counter, static_cast<int64_t>(_max_merge_gap));
+            // The bytes read from the storage per byte read by the callers, of all the readers
+            // of the profile.
+            if (_request_bytes->value() > 0) {
+                COUNTER_SET(_amplified_ratio, static_cast<double>(_merged_bytes->value()) /
+                                                      static_cast<double>(_request_bytes->value()));
+            }
             if (_reader != nullptr) {
                 _reader->collect_profile_before_close();
             }
@@ -363,7 +410,13 @@ private:
     RuntimeProfile::Counter* _request_bytes = nullptr;
     RuntimeProfile::Counter* _merged_bytes = nullptr;
     RuntimeProfile::Counter* _apply_bytes = nullptr;
+    RuntimeProfile::Counter* _equivalent_io_size_counter = nullptr;
+    RuntimeProfile::Counter* _max_merge_gap_counter = nullptr;
+    RuntimeProfile::Counter* _amplified_ratio = nullptr;
 
+    void _choose_read_sizes();
+    Status _read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                             const IOContext* io_ctx);
     int _search_read_range(size_t start_offset, size_t end_offset);
     void _clean_cached_data(RangeCachedData& cached_data);
     void _read_in_box(RangeCachedData& cached_data, size_t offset, Slice result,
@@ -388,6 +441,9 @@ private:
     bool _is_oss;
     double _max_amplified_ratio;
     size_t _equivalent_io_size;
+    // The ranges are not merged over a gap larger than it.
+    size_t _max_merge_gap;
+    RemoteReadCostModel* _cost_model = nullptr;
 
     Statistics _statistics;
 };
@@ -433,7 +489,8 @@ struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public Pro
               _reader(other._reader),
               _io_ctx(other._io_ctx),
               _buf(std::move(other._buf)),
-              _sync_profile(std::move(other._sync_profile)) {}
+              _sync_profile(std::move(other._sync_profile)),
+              _cost_model(other._cost_model) {}
 
     ~PrefetchBuffer() = default;
 
@@ -455,6 +512,7 @@ struct PrefetchBuffer : std::enable_shared_from_this<PrefetchBuffer>, public Pro
     Status _prefetch_status {Status::OK()};
     std::atomic_bool _exceed = false;
     std::function<void(PrefetchBuffer&)> _sync_profile;
+    RemoteReadCostModel* _cost_model = nullptr;
     struct Statistics {
         int64_t copy_time {0};
         int64_t read_time {0};
@@ -506,6 +564,9 @@ constexpr int64_t s_max_pre_buffer_size = 4 * 1024 * 1024; // 4MB
  *
  * When random_access_ranges is empty:
  * The data is prefetched sequentially until the underlying buffers(4 * 4M as default) are full.
+ * When config::enable_adaptive_remote_read_size is set, the size of a buffer is a few times of the
+ * equivalent IO size learned by the RemoteReadCostModel of the storage, and the number of buffers
+ * is the buffer memory divided by it.
  * When a buffer is read out, it will fetch data backward in daemon, so the underlying reader should be
  * thread-safe, and the access mode of data needs to be sequential.
  *
@@ -544,14 +605,14 @@ protected:
 private:
     Status _close_internal();
     size_t get_buffer_pos(int64_t position) const {
-        return (position % _whole_pre_buffer_size) / s_max_pre_buffer_size;
+        return (position % _whole_pre_buffer_size) / _pre_buffer_size;
     }
     size_t get_buffer_offset(int64_t position) const {
-        return (position / s_max_pre_buffer_size) * s_max_pre_buffer_size;
+        return (position / _pre_buffer_size) * _pre_buffer_size;
     }
     void reset_all_buffer(size_t position) {
         for (int64_t i = 0; i < _pre_buffers.size(); i++) {
-            int64_t cur_pos = position + i * s_max_pre_buffer_size;
+            int64_t cur_pos = position + i * _pre_buffer_size;
             int cur_buf_pos = get_buffer_pos(cur_pos);
             // reset would do all the prefetch work
             _pre_buffers[cur_buf_pos]->reset_offset(get_buffer_offset(cur_pos));
@@ -563,6 +624,7 @@ private:
     const std::vector<PrefetchRange>* _random_access_ranges = nullptr;
     const IOContext* _io_ctx = nullptr;
     std::vector<std::shared_ptr<PrefetchBuffer>> _pre_buffers;
+    int64_t _pre_buffer_size;
     int64_t _whole_pre_buffer_size;
     bool _initialized = false;
     bool _closed = false;
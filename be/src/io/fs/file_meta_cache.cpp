@@ -33,10 +33,61 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     } else {
         vectorized::FileMetaData* meta = nullptr;
         RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
-        _cache.insert({cache_key}, meta, handle);
+        _cache.insert({cache_key}, meta, handle, meta->get_mem_size());
     }
 
     return Status::OK();
 }
 
+static std::string orc_file_tail_key(const std::string& path, int64_t mtime) {
+    return "orc_tail_" + path + "_" + std::to_string(mtime);
+}
+
+bool FileMetaCache::lookup_orc_file_tail(const std::string& path, int64_t mtime,
+                                         ObjLRUCache::CacheHandle* handle) {
+    return _cache.lookup({orc_file_tail_key(path, mtime)}, handle);
+}
+
+void FileMetaCache::insert_orc_file_tail(const std::string& path, int64_t mtime,
+                                         std::string file_tail, ObjLRUCache::CacheHandle* handle) {
+    size_t mem_size = sizeof(std::string) + file_tail.capacity();
+    _cache.insert({orc_file_tail_key(path, mtime)}, new std::string(std::move(file_tail)), handle,
+                  mem_size);
+}
+
+static std::string parquet_bloom_filter_key(const std::string& path, int64_t mtime,
+                                            int64_t offset) {
+    return "parquet_bf_" + path + "_" + std::to_string(mtime) + "_" + std::to_string(offset);
+}
+
+bool FileMetaCache::lookup_parquet_bloom_filter(const std::string& path, int64_t mtime,
+                                                int64_t offset, ObjLRUCache::CacheHandle* handle) {
+    return _cache.lookup({parquet_bloom_filter_key(path, mtime, offset)}, handle);
+}
+
+void FileMetaCache::insert_parquet_bloom_filter(const std::string& path, int64_t mtime,
+                                                int64_t offset, std::string bitset,
+                                                ObjLRUCache::CacheHandle* handle) {
+    size_t mem_size = sizeof(std::string) + bitset.capacity();
+    _cache.insert({parquet_bloom_filter_key(path, mtime, offset)},
+                  new std::string(std::move(bitset)), handle, mem_size);
+}
+
+static std::string deletion_vector_key(const std::string& path, int64_t offset) {
+    return "deletion_vector_" + path + "_" + std::to_string(offset);
+}
+
+bool FileMetaCache::lookup_deletion_vector(const std::string& path, int64_t offset,
+                                           ObjLRUCache::CacheHandle* handle) {
+    return _cache.lookup({deletion_vector_key(path, offset)}, handle);
+}
+
+void FileMetaCache::insert_deletion_vector(const std::string& path, int64_t offset,
+                                           std::vector<int64_t> positions,
+                                           ObjLRUCache::CacheHandle* handle) {
+    size_t mem_size = sizeof(std::vector<int64_t>) + positions.capacity() * sizeof(int64_t);
+    _cache.insert({deletion_vector_key(path, offset)},
+                  new std::vector<int64_t>(std::move(positions)), handle, mem_size);
+}
+
 } // namespace doris
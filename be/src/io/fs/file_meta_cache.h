@@ -17,17 +17,26 @@
 
 #pragma once
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
 
 // A file meta cache depends on a LRU cache.
-// Such as parsed parquet footer.
-// The capacity will limit the number of cache entries in cache.
+// Such as parsed parquet footer, parquet bloom filters, serialized orc file tail and decoded
+// deletion vectors, they are immutable once cached and shared by the readers of the file.
+// The entries are charged by the memory they take, the capacity limits both the memory and the
+// number of cache entries in cache.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    FileMetaCache(int64_t capacity_bytes, int64_t max_num)
+            : _cache(max_num > 0 ? capacity_bytes : 0, LRUCacheType::SIZE,
+                     DEFAULT_LRU_CACHE_NUM_SHARDS,
+                     static_cast<uint32_t>(std::max<int64_t>(max_num, 0))) {}
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
@@ -37,10 +46,26 @@ public:
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
-    Status get_orc_footer() {
-        // TODO: implement
-        return Status::OK();
-    }
+    // The serialized tail of an orc file, its postscript, footer and metadata. The orc reader
+    // takes it instead of reading them from the file.
+    bool lookup_orc_file_tail(const std::string& path, int64_t mtime,
+                              ObjLRUCache::CacheHandle* handle);
+    void insert_orc_file_tail(const std::string& path, int64_t mtime, std::string file_tail,
+                              ObjLRUCache::CacheHandle* handle);
+
+    // The bitset of the bloom filter of a parquet column chunk, `offset` is the offset of the
+    // bloom filter in the file. An empty bitset is cached for the chunks without bloom filter.
+    bool lookup_parquet_bloom_filter(const std::string& path, int64_t mtime, int64_t offset,
+                                     ObjLRUCache::CacheHandle* handle);
+    void insert_parquet_bloom_filter(const std::string& path, int64_t mtime, int64_t offset,
+                                     std::string bitset, ObjLRUCache::CacheHandle* handle);
+
+    // The sorted positions of the deleted rows of the deletion vector at `offset` of a paimon
+    // deletion file. A deletion file is never modified once written.
+    bool lookup_deletion_vector(const std::string& path, int64_t offset,
+                                ObjLRUCache::CacheHandle* handle);
+    void insert_deletion_vector(const std::string& path, int64_t offset,
+                                std::vector<int64_t> positions, ObjLRUCache::CacheHandle* handle);
 
 private:
     ObjLRUCache _cache;
@@ -32,9 +32,11 @@
 #include "io/fs/err_utils.h"
 #include "io/hdfs_util.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_scheduler.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
+#include "util/stopwatch.hpp"
 
 namespace doris::io {
 #include "common/compile_check_begin.h"
@@ -77,6 +79,7 @@ HdfsFileReader::HdfsFileReader(Path path, std::string fs_name, FileHandleCache::
           _accessor(std::move(accessor)),
           _profile(profile) {
     _handle = _accessor.get();
+    _read_latency = hdfs_read_latency_of(_fs_name);
 
     DorisMetrics::instance()->hdfs_file_open_reading->increment(1);
     DorisMetrics::instance()->hdfs_file_reader_total->increment(1);
@@ -136,7 +139,10 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     }
 
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    IOSchedulerSlot io_slot(IOScheduler::remote(), bytes_read);
 
+    MonotonicStopWatch watch;
+    watch.start();
     size_t has_read = 0;
     while (has_read < bytes_req) {
         int64_t max_to_read = bytes_req - has_read;
@@ -164,6 +170,9 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
         }
         has_read += loop_read;
     }
+    const auto latency_us = static_cast<int64_t>(watch.elapsed_time() / 1000);
+    hdfs_bvar::hdfs_read_latency << latency_us;
+    *_read_latency << latency_us;
     *bytes_read = has_read;
     hdfs_bytes_read_total << *bytes_read;
     hdfs_bytes_per_read << *bytes_read;
@@ -205,7 +214,10 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     }
 
     LIMIT_REMOTE_SCAN_IO(bytes_read);
+    IOSchedulerSlot io_slot(IOScheduler::remote(), bytes_read);
 
+    MonotonicStopWatch watch;
+    watch.start();
     size_t has_read = 0;
     while (has_read < bytes_req) {
         int64_t loop_read = hdfsRead(_handle->fs(), _handle->file(), to + has_read,
@@ -226,6 +238,9 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
         }
         has_read += loop_read;
     }
+    const auto latency_us = static_cast<int64_t>(watch.elapsed_time() / 1000);
+    hdfs_bvar::hdfs_read_latency << latency_us;
+    *_read_latency << latency_us;
     *bytes_read = has_read;
     hdfs_bytes_read_total << *bytes_read;
     hdfs_bytes_per_read << *bytes_read;
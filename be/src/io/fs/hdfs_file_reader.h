@@ -32,6 +32,10 @@
 #include "io/fs/path.h"
 #include "util/slice.h"
 
+namespace bvar {
+class LatencyRecorder;
+} // namespace bvar
+
 namespace doris::io {
 struct IOContext;
 
@@ -83,6 +87,8 @@ private:
     CachedHdfsFileHandle* _handle = nullptr; // owned by _cached_file_handle
     std::atomic<bool> _closed = false;
     RuntimeProfile* _profile = nullptr;
+    // The read latency of the name node, which sizes the hedged read threshold of its connections.
+    bvar::LatencyRecorder* _read_latency = nullptr;
 #ifdef USE_HADOOP_HDFS
     HDFSProfile _hdfs_profile;
 #endif
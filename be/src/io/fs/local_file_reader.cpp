@@ -21,33 +21,148 @@
 // IWYU pragma: no_include <bthread/errno.h>
 #include <bvar/bvar.h>
 #include <errno.h> // IWYU pragma: keep
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
 #include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "cpp/sync_point.h"
 #include "io/fs/err_utils.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/options.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_scheduler.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/async_io.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
 
 std::vector<doris::DataDirInfo> BeConfDataDirReader::be_config_data_dir_list;
 
+namespace {
+
+// The throttle of the background reads of a data dir, so compaction and schema change don't
+// saturate the disk which the queries read too. The limit is
+// config::local_background_read_bytes_per_second_per_disk.
+class BackgroundIOThrottle {
+public:
+    explicit BackgroundIOThrottle(const std::string& metric_name)
+            : _read_bytes("doris_background_read_bytes", metric_name),
+              _read_bytes_per_second("doris_background_read_bytes_per_second", metric_name,
+                                     &_read_bytes, 60) {}
+
+    void acquire() {
+        _throttle.set_io_bytes_per_second(config::local_background_read_bytes_per_second_per_disk);
+        _throttle.acquire(-1);
+    }
+
+    void update(size_t bytes) {
+        _throttle.update_next_io_time(bytes);
+        _read_bytes << bytes;
+    }
+
+private:
+    IOThrottle _throttle;
+    bvar::Adder<size_t> _read_bytes;
+    bvar::PerSecond<bvar::Adder<size_t>> _read_bytes_per_second;
+};
+
+// data dir path -> throttle, built when the data dirs are initialized.
+std::unordered_map<std::string, std::unique_ptr<BackgroundIOThrottle>> g_background_io_throttles;
+
+constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+bvar::Adder<int64_t> g_direct_read_bytes("local_file_reader", "direct_read_bytes");
+bvar::Adder<int64_t> g_direct_read_pooled_bytes("local_file_reader", "direct_read_pooled_bytes");
+
+// Recycles the aligned read ahead windows of the direct reads, keeping up to
+// config::local_direct_read_buffer_pool_max_bytes of them.
+class DirectReadWindowPool {
+public:
+    // nullptr if the memory is exhausted.
+    char* allocate(size_t size) {
+        {
+            std::lock_guard l(_lock);
+            if (size == _window_size && !_windows.empty()) {
+                char* window = _windows.back();
+                _windows.pop_back();
+                g_direct_read_pooled_bytes << -static_cast<int64_t>(size);
+                return window;
+            }
+        }
+        return static_cast<char*>(std::aligned_alloc(DIRECT_IO_ALIGNMENT, size));
+    }
+
+    void deallocate(char* window, size_t size) {
+        std::vector<char*> stale_windows;
+        {
+            std::lock_guard l(_lock);
+            if (size != _window_size) {
+                // local_direct_read_ahead_bytes is changed.
+                g_direct_read_pooled_bytes << -static_cast<int64_t>(_window_size * _windows.size());
+                stale_windows.swap(_windows);
+                _window_size = size;
+            }
+            if ((_windows.size() + 1) * size <=
+                static_cast<size_t>(config::local_direct_read_buffer_pool_max_bytes)) {
+                _windows.push_back(window);
+                g_direct_read_pooled_bytes << static_cast<int64_t>(size);
+                window = nullptr;
+            }
+        }
+        for (char* stale_window : stale_windows) {
+            std::free(stale_window);
+        }
+        std::free(window);
+    }
+
+private:
+    std::mutex _lock;
+    size_t _window_size = 0;
+    std::vector<char*> _windows;
+};
+
+DirectReadWindowPool g_direct_read_window_pool;
+
+BackgroundIOThrottle* get_background_io_throttle(const std::string& data_dir,
+                                                 const IOContext* io_ctx) {
+    if (io_ctx == nullptr) {
+        return nullptr;
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_ALTER_TABLE:
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_CHECKSUM:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION: {
+        auto it = g_background_io_throttles.find(data_dir);
+        return it == g_background_io_throttles.end() ? nullptr : it->second.get();
+    }
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
 void BeConfDataDirReader::get_data_dir_by_file_path(io::Path* file_path,
                                                     std::string* data_dir_arg) {
     for (const auto& data_dir_info : be_config_data_dir_list) {
@@ -71,6 +186,9 @@ void BeConfDataDirReader::init_be_conf_data_dir(
         data_dir_info.storage_medium = store_paths[i].storage_medium;
         data_dir_info.data_dir_type = DataDirType::OLAP_DATA_DIR;
         data_dir_info.metric_name = "local_data_dir_" + std::to_string(i);
+        g_background_io_throttles.try_emplace(
+                data_dir_info.path,
+                std::make_unique<BackgroundIOThrottle>(data_dir_info.metric_name));
         be_config_data_dir_list.push_back(data_dir_info);
     }
 
@@ -115,6 +233,7 @@ Status LocalFileReader::close() {
     if (_closed.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
         DorisMetrics::instance()->local_file_open_reading->increment(-1);
         DCHECK(bthread_self() == 0);
+        _close_direct();
         if (-1 == ::close(_fd)) {
             std::string err = errno_to_str();
             return localfs_error(errno, fmt::format("failed to close {}", _path.native()));
@@ -124,8 +243,122 @@ Status LocalFileReader::close() {
     return Status::OK();
 }
 
+void LocalFileReader::advise_will_need(size_t offset, size_t size) const {
+#ifndef __APPLE__
+    if (!closed() && size > 0) {
+        (void)::posix_fadvise(_fd, static_cast<off_t>(offset), static_cast<off_t>(size),
+                              POSIX_FADV_WILLNEED);
+    }
+#endif
+}
+
+void LocalFileReader::_close_direct() {
+    std::lock_guard l(_direct_lock);
+    if (_direct_fd != -1) {
+        ::close(_direct_fd);
+        _direct_fd = -1;
+    }
+    if (_window != nullptr) {
+        g_direct_read_window_pool.deallocate(_window, _window_size);
+        _window = nullptr;
+        _window_len = 0;
+    }
+}
+
+bool LocalFileReader::_use_direct_io(size_t bytes_req, const IOContext* io_ctx) const {
+    if (!config::enable_local_direct_read || io_ctx == nullptr || io_ctx->is_index_data) {
+        return false;
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_ALTER_TABLE:
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_CHECKSUM:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        return true;
+    case ReaderType::READER_QUERY:
+        return bytes_req >= static_cast<size_t>(config::local_direct_read_min_bytes);
+    default:
+        return false;
+    }
+}
+
+Status LocalFileReader::_read_direct(size_t offset, char* to, size_t bytes_req,
+                                     size_t* bytes_read) {
+    std::lock_guard l(_direct_lock);
+    if (_direct_io_unsupported) {
+        return Status::OK();
+    }
+    if (_direct_fd == -1) {
+#ifdef O_DIRECT
+        _direct_fd = ::open(_path.c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC);
+#endif
+        if (_direct_fd == -1) {
+            LOG(INFO) << "read " << _path.native() << " without O_DIRECT: " << errno_to_str();
+            _direct_io_unsupported = true;
+            return Status::OK();
+        }
+        const auto window_size = std::max<size_t>(config::local_direct_read_ahead_bytes, 1);
+        _window_size = (window_size + DIRECT_IO_ALIGNMENT - 1) & ~(DIRECT_IO_ALIGNMENT - 1);
+        _window = g_direct_read_window_pool.allocate(_window_size);
+        if (_window == nullptr) {
+            _direct_io_unsupported = true;
+            return Status::OK();
+        }
+    }
+    while (bytes_req != 0) {
+        if (_window_offset <= offset && offset < _window_offset + _window_len) {
+            size_t copy_size = std::min(bytes_req, _window_offset + _window_len - offset);
+            memcpy(to, _window + (offset - _window_offset), copy_size);
+            to += copy_size;
+            offset += copy_size;
+            bytes_req -= copy_size;
+            *bytes_read += copy_size;
+            continue;
+        }
+        // The large aligned reads skip the window.
+        const bool read_to_result = offset % DIRECT_IO_ALIGNMENT == 0 &&
+                                    reinterpret_cast<uintptr_t>(to) % DIRECT_IO_ALIGNMENT == 0 &&
+                                    bytes_req >= _window_size;
+        const size_t read_offset = offset & ~(DIRECT_IO_ALIGNMENT - 1);
+        ssize_t res = -1;
+        do {
+            res = read_to_result ? ::pread(_direct_fd, to, bytes_req & ~(DIRECT_IO_ALIGNMENT - 1),
+                                           offset)
+                                 : ::pread(_direct_fd, _window, _window_size, read_offset);
+        } while (res == -1 && errno == EINTR);
+        if (res == -1) {
+            if (errno == EINVAL) {
+                // The file system doesn't support O_DIRECT.
+                _direct_io_unsupported = true;
+                return Status::OK();
+            }
+            return localfs_error(errno, fmt::format("failed to read {}", _path.native()));
+        }
+        g_direct_read_bytes << res;
+        if (read_to_result) {
+            if (res == 0) {
+                break;
+            }
+            to += res;
+            offset += res;
+            bytes_req -= res;
+            *bytes_read += res;
+            continue;
+        }
+        _window_offset = read_offset;
+        _window_len = res;
+        if (read_offset + res <= offset) {
+            // EOF, left to the buffered reads
+            break;
+        }
+    }
+    return Status::OK();
+}
+
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -143,7 +376,24 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     *bytes_read = 0;
 
     LIMIT_LOCAL_SCAN_IO(get_data_dir_path(), bytes_read);
+    auto* background_io_throttle = get_background_io_throttle(_data_dir_path, io_ctx);
+    if (background_io_throttle != nullptr) {
+        background_io_throttle->acquire();
+    }
+    int64_t start_ns = MonotonicNanos();
+    IOSchedulerSlot io_slot(IOScheduler::local(_data_dir_path), bytes_read);
+    Defer update_background_io {[&]() {
+        if (background_io_throttle != nullptr) {
+            background_io_throttle->update(*bytes_read);
+        }
+    }};
 
+    if (_use_direct_io(bytes_req, io_ctx)) {
+        RETURN_IF_ERROR(_read_direct(offset, to, bytes_req, bytes_read));
+        to += *bytes_read;
+        offset += *bytes_read;
+        bytes_req -= *bytes_read;
+    }
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
                                                 "LocalFileReader::pread", _fd, to);
@@ -169,6 +419,13 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
             *bytes_read += res;
         }
     }
+    if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr) {
+        int64_t io_ns = MonotonicNanos() - start_ns;
+        io_ctx->file_cache_stats->num_local_disk_io_total++;
+        io_ctx->file_cache_stats->bytes_read_from_local_disk += *bytes_read;
+        io_ctx->file_cache_stats->local_disk_io_timer += io_ns;
+        io_ctx->file_cache_stats->local_disk_io_latency.add(io_ns);
+    }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
     return Status::OK();
 }
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/fs/file_reader.h"
@@ -62,16 +63,36 @@ public:
 
     const std::string& get_data_dir_path() override { return _data_dir_path; }
 
+    // Asks the kernel to read [offset, offset + size) into the page cache in the background,
+    // it is only a hint and never fails.
+    void advise_will_need(size_t offset, size_t size) const;
+
 private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    bool _use_direct_io(size_t bytes_req, const IOContext* io_ctx) const;
+    // Reads a prefix of [offset, offset + bytes_req) with O_DIRECT, the rest is read by the
+    // buffered reads, e.g. if the file system doesn't support O_DIRECT.
+    Status _read_direct(size_t offset, char* to, size_t bytes_req, size_t* bytes_read);
+    void _close_direct();
+
 private:
     int _fd = -1; // owned
     Path _path;
     size_t _file_size;
     std::atomic<bool> _closed = false;
     std::string _data_dir_path; // be conf's data dir path
+
+    // The direct reads go through a file descriptor opened with O_DIRECT, and are served from an
+    // aligned window read ahead of them.
+    std::mutex _direct_lock;
+    int _direct_fd = -1; // owned
+    bool _direct_io_unsupported = false;
+    char* _window = nullptr;
+    size_t _window_size = 0;
+    size_t _window_offset = 0;
+    size_t _window_len = 0;
 };
 
 } // namespace doris::io
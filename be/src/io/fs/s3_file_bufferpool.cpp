@@ -31,6 +31,7 @@
 #include "io/cache/file_cache_common.h"
 #include "io/fs/s3_common.h"
 #include "runtime/exec_env.h"
+#include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
 #include "util/slice.h"
@@ -40,32 +41,100 @@ namespace doris {
 namespace io {
 
 bvar::Adder<uint64_t> s3_file_buffer_allocated("s3_file_buffer_allocated");
+bvar::Adder<int64_t> s3_file_buffer_pool_cached_bytes("s3_file_buffer_pool_cached_bytes");
+bvar::Adder<int64_t> s3_file_buffer_pool_in_use_bytes("s3_file_buffer_pool_in_use_bytes");
+bvar::Adder<uint64_t> s3_file_buffer_pool_hit("s3_file_buffer_pool_hit");
+bvar::Adder<uint64_t> s3_file_buffer_pool_miss("s3_file_buffer_pool_miss");
+// The share of the memory of the pool which is used by the file buffers.
+bvar::PassiveStatus<double> s3_file_buffer_pool_utilization(
+        "s3_file_buffer_pool_utilization",
+        [](void*) {
+            const auto in_use = s3_file_buffer_pool_in_use_bytes.get_value();
+            const auto total = in_use + s3_file_buffer_pool_cached_bytes.get_value();
+            return total <= 0 ? 0.0 : static_cast<double>(in_use) / static_cast<double>(total);
+        },
+        nullptr);
 
-template <typename Allocator = Allocator<false>>
-struct Memory : boost::noncopyable, Allocator {
-    Memory() = default;
+FileBufferPool* FileBufferPool::instance() {
+    static FileBufferPool pool;
+    return &pool;
+}
+
+char* FileBufferPool::allocate(size_t size) {
+    char* data = nullptr;
+    {
+        std::lock_guard l(_lock);
+        if (size == _buffer_size && !_buffers.empty()) {
+            data = _buffers.back();
+            _buffers.pop_back();
+        }
+    }
+    if (data != nullptr) {
+        s3_file_buffer_pool_cached_bytes << -static_cast<int64_t>(size);
+        s3_file_buffer_pool_hit << 1;
+    } else {
+        data = static_cast<char*>(Allocator<false>().alloc(size, 0));
+        s3_file_buffer_pool_miss << 1;
+    }
+    s3_file_buffer_pool_in_use_bytes << static_cast<int64_t>(size);
+    return data;
+}
+
+void FileBufferPool::deallocate(char* data, size_t size) {
+    s3_file_buffer_pool_in_use_bytes << -static_cast<int64_t>(size);
+    std::vector<char*> stale_buffers;
+    size_t stale_size = 0;
+    {
+        std::lock_guard l(_lock);
+        if (size != _buffer_size) {
+            // s3_write_buffer_size is changed, the buffers of the old size are not used anymore.
+            stale_buffers.swap(_buffers);
+            stale_size = _buffer_size;
+            s3_file_buffer_pool_cached_bytes << -static_cast<int64_t>(stale_size *
+                                                                      stale_buffers.size());
+            _buffer_size = size;
+        }
+        if ((_buffers.size() + 1) * size <=
+                    static_cast<size_t>(config::s3_file_buffer_pool_max_bytes) &&
+            !GlobalMemoryArbitrator::is_exceed_soft_mem_limit()) {
+            _buffers.push_back(data);
+            s3_file_buffer_pool_cached_bytes << static_cast<int64_t>(size);
+            data = nullptr;
+        }
+    }
+    _free_buffers(&stale_buffers, stale_size);
+    if (data != nullptr) {
+        Allocator<false>().free(data, size);
+    }
+}
+
+size_t FileBufferPool::cached_bytes() const {
+    std::lock_guard l(_lock);
+    return _buffer_size * _buffers.size();
+}
+
+void FileBufferPool::_free_buffers(std::vector<char*>* buffers, size_t size) {
+    for (char* data : *buffers) {
+        Allocator<false>().free(data, size);
+    }
+    buffers->clear();
+}
+
+struct Memory : boost::noncopyable {
     explicit Memory(size_t size) : _size(size) {
-        alloc(size);
+        _data = FileBufferPool::instance()->allocate(size);
         s3_file_buffer_allocated << 1;
     }
     ~Memory() {
-        dealloc();
+        FileBufferPool::instance()->deallocate(_data, _size);
         s3_file_buffer_allocated << -1;
     }
-    void alloc(size_t size) { _data = static_cast<char*>(Allocator::alloc(size, 0)); }
-    void dealloc() {
-        if (_data == nullptr) {
-            return;
-        }
-        Allocator::free(_data, _size);
-        _data = nullptr;
-    }
     size_t _size;
     char* _data;
 };
 
 struct FileBuffer::PartData {
-    Memory<> _memory;
+    Memory _memory;
     PartData() : _memory(config::s3_write_buffer_size) {}
     ~PartData() = default;
     [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
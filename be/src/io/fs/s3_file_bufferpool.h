@@ -24,6 +24,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "common/status.h"
 #include "io/cache/file_block.h"
@@ -75,6 +76,35 @@ struct OperationState {
     bool _fail_after_sync = false;
 };
 
+/**
+ * Recycles the memory of the file buffers. Every part of a file written to S3 takes a buffer of
+ * s3_write_buffer_size bytes, so the heavy loads and compactions allocate and free a 5MB buffer
+ * for every part, and fault in its pages again once the allocator returned them to the OS. The
+ * pool keeps up to s3_file_buffer_pool_max_bytes of the freed buffers, whose pages are resident
+ * and backed by the huge pages if enable_huge_page_for_large_alloc is set, for the next buffers.
+ * The pooled buffers stay accounted to the s3 file buffer memory tracker.
+ */
+class FileBufferPool {
+public:
+    static FileBufferPool* instance();
+
+    // Takes a pooled buffer of `size` bytes, or allocates one if there is none.
+    char* allocate(size_t size);
+
+    // Pools the buffer, or frees it if the pool is full or the memory is short.
+    void deallocate(char* data, size_t size);
+
+    size_t cached_bytes() const;
+
+private:
+    void _free_buffers(std::vector<char*>* buffers, size_t size);
+
+    mutable std::mutex _lock;
+    // The size of the pooled buffers, the buffers of other sizes are not pooled.
+    size_t _buffer_size = 0;
+    std::vector<char*> _buffers;
+};
+
 struct FileBuffer {
     FileBuffer(BufferType type, std::function<FileBlocksHolderPtr()> alloc_holder, size_t offset,
                OperationState state);
@@ -29,18 +29,28 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_management/io_scheduler.h"
 #include "runtime/workload_management/io_throttle.h"
 #include "util/bvar_helper.h"
+#include "util/defer_op.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -49,6 +59,8 @@ bvar::Adder<uint64_t> s3_file_reader_total("s3_file_reader", "total_num");
 bvar::Adder<uint64_t> s3_bytes_read_total("s3_file_reader", "bytes_read");
 bvar::Adder<uint64_t> s3_file_being_read("s3_file_reader", "file_being_read");
 bvar::Adder<uint64_t> s3_file_reader_too_many_request_counter("s3_file_reader", "too_many_request");
+bvar::Adder<uint64_t> s3_file_reader_coalesced_read_counter("s3_file_reader", "coalesced_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_counter("s3_file_reader", "hedged_read");
 bvar::LatencyRecorder s3_bytes_per_read("s3_file_reader", "bytes_per_read"); // also QPS
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3_read_throughput",
                                                            &s3_bytes_read_total);
@@ -73,13 +85,105 @@ Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolde
                                           file_size, profile);
 }
 
+namespace {
+
+// A small read of an object, whose GET may be shared by the concurrent reads of the object it
+// covers, and raced by a hedged GET.
+struct SmallRead {
+    const size_t offset;
+    const size_t size;
+
+    std::mutex lock;
+    std::condition_variable cond;
+    bool done = false;
+    Status status;
+    // the bytes of the range, which are set when the first GET of the range is done
+    std::string data;
+
+    SmallRead(size_t offset_, size_t size_) : offset(offset_), size(size_) {}
+
+    // Sets the result of a GET of the range, returns false if another GET is done first.
+    bool finish(const char* bytes, Status st) {
+        std::lock_guard l(lock);
+        if (done) {
+            return false;
+        }
+        done = true;
+        if (st.ok()) {
+            data.assign(bytes, size);
+        }
+        status = std::move(st);
+        cond.notify_all();
+        return true;
+    }
+
+    Status wait_and_copy(size_t read_offset, char* to, size_t bytes) {
+        std::unique_lock l(lock);
+        cond.wait(l, [this] { return done; });
+        if (status.ok()) {
+            memcpy(to, data.data() + (read_offset - offset), bytes);
+        }
+        return status;
+    }
+};
+
+// The small reads being issued, by the paths of their objects.
+class SmallReadRegistry {
+public:
+    static SmallReadRegistry* instance() {
+        static SmallReadRegistry registry;
+        return &registry;
+    }
+
+    // Returns the read being issued which covers [offset, offset + size) of the object, or adds
+    // a read of the range and sets `added`.
+    std::shared_ptr<SmallRead> find_or_add(const std::string& path, size_t offset, size_t size,
+                                           bool* added) {
+        std::lock_guard l(_lock);
+        auto& reads = _reads[path];
+        for (const auto& read : reads) {
+            if (read->offset <= offset && offset + size <= read->offset + read->size) {
+                *added = false;
+                return read;
+            }
+        }
+        *added = true;
+        return reads.emplace_back(std::make_shared<SmallRead>(offset, size));
+    }
+
+    void remove(const std::string& path, const std::shared_ptr<SmallRead>& read) {
+        std::lock_guard l(_lock);
+        auto it = _reads.find(path);
+        DCHECK(it != _reads.end());
+        std::erase(it->second, read);
+        if (it->second.empty()) {
+            _reads.erase(it);
+        }
+    }
+
+private:
+    std::mutex _lock;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<SmallRead>>> _reads;
+};
+
+} // namespace
+
+void S3FileReader::S3Statistics::merge(const S3Statistics& other) {
+    total_get_request_counter += other.total_get_request_counter;
+    too_many_request_err_counter += other.too_many_request_err_counter;
+    too_many_request_sleep_time_ms += other.too_many_request_sleep_time_ms;
+    total_bytes_read += other.total_bytes_read;
+}
+
 S3FileReader::S3FileReader(std::shared_ptr<const ObjClientHolder> client, std::string bucket,
                            std::string key, size_t file_size, RuntimeProfile* profile)
-        : _path(fmt::format("s3://{}/{}", bucket, key)),
-          _file_size(file_size),
-          _bucket(std::move(bucket)),
-          _key(std::move(key)),
-          _client(std::move(client)),
+        : _object(std::make_shared<const Object>(Object {
+                  .path = fmt::format("s3://{}/{}", bucket, key),
+                  .file_size = file_size,
+                  .bucket = std::move(bucket),
+                  .key = std::move(key),
+                  .client = std::move(client),
+          })),
           _profile(profile) {
     DorisMetrics::instance()->s3_file_open_reading->increment(1);
     DorisMetrics::instance()->s3_file_reader_total->increment(1);
@@ -105,20 +209,41 @@ Status S3FileReader::close() {
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                   const IOContext* /*io_ctx*/) {
     DCHECK(!closed());
-    if (offset > _file_size) {
+    const size_t file_size = _object->file_size;
+    if (offset > file_size) {
         return Status::InternalError(
-                "offset exceeds file size(offset: {}, file size: {}, path: {})", offset, _file_size,
-                _path.native());
+                "offset exceeds file size(offset: {}, file size: {}, path: {})", offset, file_size,
+                path().native());
     }
     size_t bytes_req = result.size;
     char* to = result.data;
-    bytes_req = std::min(bytes_req, _file_size - offset);
+    bytes_req = std::min(bytes_req, file_size - offset);
+    *bytes_read = 0;
     if (UNLIKELY(bytes_req == 0)) {
-        *bytes_read = 0;
         return Status::OK();
     }
 
-    auto client = _client->get();
+    LIMIT_REMOTE_SCAN_IO(bytes_read);
+    IOSchedulerSlot io_slot(IOScheduler::remote(), bytes_read);
+
+    const auto part_size = static_cast<size_t>(config::s3_read_parallel_part_bytes);
+    Status st;
+    if (part_size > 0 && bytes_req >= 2 * part_size) {
+        st = _get_object_in_parts(offset, to, bytes_req);
+    } else if (bytes_req <= static_cast<size_t>(config::s3_small_read_bytes)) {
+        st = _get_small_object_range(offset, to, bytes_req);
+    } else {
+        st = _get_object(*_object, offset, to, bytes_req, &_s3_stats);
+    }
+    if (st.ok()) {
+        *bytes_read = bytes_req;
+    }
+    return st;
+}
+
+Status S3FileReader::_get_object(const Object& object, size_t offset, char* to, size_t bytes_req,
+                                 S3Statistics* stats) {
+    auto client = object.client->get();
     if (!client) {
         return Status::InternalError("init s3 client error");
     }
@@ -128,17 +253,16 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     const int max_wait_time = config::s3_read_max_wait_time_ms; // Maximum wait time in milliseconds
     const int max_retries = config::max_s3_client_retry; // wait 1s, 2s, 4s, 8s for each backoff
 
-    LIMIT_REMOTE_SCAN_IO(bytes_read);
-
+    size_t bytes_read = 0;
     int total_sleep_time = 0;
     while (retry_count <= max_retries) {
-        *bytes_read = 0;
+        bytes_read = 0;
         s3_file_reader_read_counter << 1;
         // clang-format off
-        auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-                to, offset, bytes_req, bytes_read);
+        auto resp = client->get_object( { .bucket = object.bucket, .key = object.key, },
+                to, offset, bytes_req, &bytes_read);
         // clang-format on
-        _s3_stats.total_get_request_counter++;
+        stats->total_get_request_counter++;
         if (resp.status.code != ErrorCode::OK) {
             if (resp.http_code ==
                 static_cast<int>(Aws::Http::HttpResponseCode::TOO_MANY_REQUESTS)) {
@@ -147,8 +271,8 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
                 int wait_time = std::min(base_wait_time * (1 << retry_count),
                                          max_wait_time); // Exponential backoff
                 std::this_thread::sleep_for(std::chrono::milliseconds(wait_time));
-                _s3_stats.too_many_request_err_counter++;
-                _s3_stats.too_many_request_sleep_time_ms += wait_time;
+                stats->too_many_request_err_counter++;
+                stats->too_many_request_sleep_time_ms += wait_time;
                 total_sleep_time += wait_time;
                 continue;
             } else {
@@ -157,32 +281,159 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
                                          .append("failed to read"));
             }
         }
-        if (*bytes_read != bytes_req) {
+        if (bytes_read != bytes_req) {
             std::string msg = fmt::format(
                     "failed to get object, path={} offset={} bytes_req={} bytes_read={} "
                     "file_size={} tries={}",
-                    _path.native(), offset, bytes_req, *bytes_read, _file_size, (retry_count + 1));
+                    object.path.native(), offset, bytes_req, bytes_read, object.file_size,
+                    (retry_count + 1));
             LOG(WARNING) << msg;
             return Status::InternalError(msg);
         }
-        _s3_stats.total_bytes_read += bytes_req;
+        stats->total_bytes_read += bytes_req;
         s3_bytes_read_total << bytes_req;
         s3_bytes_per_read << bytes_req;
         DorisMetrics::instance()->s3_bytes_read_total->increment(bytes_req);
         if (retry_count > 0) {
             LOG(INFO) << fmt::format("read s3 file {} succeed after {} times with {} ms sleeping",
-                                     _path.native(), retry_count, total_sleep_time);
+                                     object.path.native(), retry_count, total_sleep_time);
         }
         return Status::OK();
     }
     std::string msg = fmt::format(
             "failed to get object, path={} offset={} bytes_req={} bytes_read={} file_size={} "
             "tries={}",
-            _path.native(), offset, bytes_req, *bytes_read, _file_size, (max_retries + 1));
+            object.path.native(), offset, bytes_req, bytes_read, object.file_size,
+            (max_retries + 1));
     LOG(WARNING) << msg;
     return Status::InternalError(msg);
 }
 
+Status S3FileReader::_get_object_in_parts(size_t offset, char* to, size_t bytes_req) {
+    auto* thread_pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    const auto max_part_size = static_cast<size_t>(config::s3_read_parallel_part_bytes);
+    const size_t num_parts =
+            std::min((bytes_req + max_part_size - 1) / max_part_size,
+                     static_cast<size_t>(std::max(config::s3_read_max_parallel_parts, 1)));
+    if (thread_pool == nullptr || num_parts < 2) {
+        return _get_object(*_object, offset, to, bytes_req, &_s3_stats);
+    }
+    const size_t part_size = (bytes_req + num_parts - 1) / num_parts;
+
+    // The parts are read by this thread and the helpers submitted to the thread pool. This
+    // thread only waits for the parts which are being read, a helper which starts after all the
+    // parts are taken exits at once, so the helpers queued behind other tasks never block it.
+    struct PartsState {
+        std::mutex lock;
+        std::condition_variable cond;
+        size_t num_parts = 0;
+        size_t next_part = 0;
+        size_t num_running = 0;
+        Status status;
+        S3Statistics stats;
+    };
+    auto state = std::make_shared<PartsState>();
+    state->num_parts = num_parts;
+    auto read_next_parts = [state, object = _object, offset, to, bytes_req, part_size]() {
+        while (true) {
+            size_t i = 0;
+            {
+                std::lock_guard l(state->lock);
+                if (state->next_part == state->num_parts || !state->status.ok()) {
+                    return;
+                }
+                i = state->next_part++;
+                ++state->num_running;
+            }
+            size_t part_offset = i * part_size;
+            S3Statistics stats;
+            Status st = _get_object(*object, offset + part_offset, to + part_offset,
+                                    std::min(part_size, bytes_req - part_offset), &stats);
+            std::lock_guard l(state->lock);
+            state->stats.merge(stats);
+            if (!st.ok() && state->status.ok()) {
+                state->status = std::move(st);
+            }
+            --state->num_running;
+            state->cond.notify_all();
+        }
+    };
+    for (size_t i = 1; i < num_parts; ++i) {
+        if (!thread_pool->submit_func(read_next_parts).ok()) {
+            // this thread reads the parts left
+            break;
+        }
+    }
+    read_next_parts();
+    std::unique_lock l(state->lock);
+    state->cond.wait(l, [&] {
+        return state->num_running == 0 &&
+               (state->next_part == state->num_parts || !state->status.ok());
+    });
+    _s3_stats.merge(state->stats);
+    return state->status;
+}
+
+Status S3FileReader::_get_small_object_range(size_t offset, char* to, size_t bytes_req) {
+    const std::string& path = _object->path.native();
+    const bool coalescing = config::enable_s3_small_read_coalescing;
+    std::shared_ptr<SmallRead> read;
+    if (coalescing) {
+        bool added = false;
+        read = SmallReadRegistry::instance()->find_or_add(path, offset, bytes_req, &added);
+        if (!added) {
+            s3_file_reader_coalesced_read_counter << 1;
+            if (read->wait_and_copy(offset, to, bytes_req).ok()) {
+                return Status::OK();
+            }
+            // the shared GET failed, this read retries on its own
+            return _get_object(*_object, offset, to, bytes_req, &_s3_stats);
+        }
+    } else {
+        read = std::make_shared<SmallRead>(offset, bytes_req);
+    }
+    Defer defer {[&] {
+        if (coalescing) {
+            SmallReadRegistry::instance()->remove(path, read);
+        }
+    }};
+
+    auto* thread_pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    const int hedge_delay_ms = config::s3_read_hedge_delay_ms;
+    if (hedge_delay_ms <= 0 || thread_pool == nullptr ||
+        !thread_pool
+                 ->submit_func([read, object = _object] {
+                     std::string data(read->size, '\0');
+                     S3Statistics stats;
+                     Status st = _get_object(*object, read->offset, data.data(), read->size,
+                                             &stats);
+                     read->finish(data.data(), std::move(st));
+                 })
+                 .ok()) {
+        Status st = _get_object(*_object, offset, to, bytes_req, &_s3_stats);
+        if (coalescing) {
+            read->finish(to, st);
+        }
+        return st;
+    }
+    {
+        std::unique_lock l(read->lock);
+        if (read->cond.wait_for(l, std::chrono::milliseconds(hedge_delay_ms),
+                                [&] { return read->done; })) {
+            l.unlock();
+            return read->wait_and_copy(offset, to, bytes_req);
+        }
+    }
+    // The first GET is slow, the GET which is done first serves the read.
+    s3_file_reader_hedged_read_counter << 1;
+    Status st = _get_object(*_object, offset, to, bytes_req, &_s3_stats);
+    if (st.ok()) {
+        read->finish(to, st);
+        return st;
+    }
+    return read->wait_and_copy(offset, to, bytes_req);
+}
+
 void S3FileReader::_collect_profile_before_close() {
     if (_profile != nullptr) {
         const char* s3_profile_name = "S3Profile";
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -47,9 +49,9 @@ public:
 
     Status close() override;
 
-    const Path& path() const override { return _path; }
+    const Path& path() const override { return _object->path; }
 
-    size_t size() const override { return _file_size; }
+    size_t size() const override { return _object->file_size; }
 
     bool closed() const override { return _closed.load(std::memory_order_acquire); }
 
@@ -65,13 +67,31 @@ private:
         int64_t too_many_request_err_counter = 0;
         int64_t too_many_request_sleep_time_ms = 0;
         int64_t total_bytes_read = 0;
+
+        void merge(const S3Statistics& other);
+    };
+
+    // The object read by the reader. It is shared with the GETs running in the background,
+    // which may outlive the reader.
+    struct Object {
+        Path path;
+        size_t file_size;
+        std::string bucket;
+        std::string key;
+        std::shared_ptr<const ObjClientHolder> client;
     };
-    Path _path;
-    size_t _file_size;
 
-    std::string _bucket;
-    std::string _key;
-    std::shared_ptr<const ObjClientHolder> _client;
+    // Reads [offset, offset + bytes_req) of the object into `to` by one GET, and retries when
+    // the GET is throttled.
+    static Status _get_object(const Object& object, size_t offset, char* to, size_t bytes_req,
+                              S3Statistics* stats);
+    // Reads a large range by GETs of its parts in parallel.
+    Status _get_object_in_parts(size_t offset, char* to, size_t bytes_req);
+    // Reads a small range. It shares the GET of a concurrent read of the object which covers
+    // the range, and issues a hedged GET if the first one is slow.
+    Status _get_small_object_range(size_t offset, char* to, size_t bytes_req);
+
+    std::shared_ptr<const Object> _object;
 
     std::atomic<bool> _closed = false;
 
@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdlib>
 #include <utility>
@@ -32,6 +33,7 @@
 #include "hadoop_hdfs/hdfs.h"
 #endif
 #include "io/fs/hdfs.h"
+#include "io/hdfs_util.h"
 #include "runtime/exec_env.h"
 #include "util/string_util.h"
 
@@ -145,6 +147,36 @@ void HDFSCommonBuilder::set_hdfs_conf_to_hdfs_builder() {
     }
 }
 
+void HDFSCommonBuilder::set_hdfs_read_conf() {
+    if (config::enable_hdfs_hedged_read) {
+        int64_t threshold_ms = config::hdfs_hedged_read_threshold_ms;
+        if (threshold_ms <= 0) {
+            // Hedge the reads slower than most of the recent reads of the name node.
+            constexpr int64_t MIN_READS = 100;
+            constexpr int64_t DEFAULT_THRESHOLD_MS = 500;
+            constexpr int64_t MIN_THRESHOLD_MS = 10;
+            auto* read_latency = io::hdfs_read_latency_of(fs_name);
+            threshold_ms = DEFAULT_THRESHOLD_MS;
+            if (read_latency->count() >= MIN_READS) {
+                threshold_ms = std::max(
+                        read_latency->latency_percentile(
+                                config::hdfs_hedged_read_latency_percentile / 100) /
+                                1000,
+                        MIN_THRESHOLD_MS);
+            }
+        }
+        hdfs_conf.try_emplace("dfs.client.hedged.read.threadpool.size",
+                              std::to_string(config::hdfs_hedged_read_thread_num));
+        hdfs_conf.try_emplace("dfs.client.hedged.read.threshold.millis",
+                              std::to_string(threshold_ms));
+    }
+    if (!config::hdfs_short_circuit_domain_socket_path.empty()) {
+        hdfs_conf.try_emplace("dfs.client.read.shortcircuit", "true");
+        hdfs_conf.try_emplace("dfs.domain.socket.path",
+                              config::hdfs_short_circuit_domain_socket_path);
+    }
+}
+
 // This method is deprecated, will be removed later
 Status HDFSCommonBuilder::set_kerberos_ticket_cache() {
     // kerberos::KerberosConfig config;
@@ -215,8 +247,9 @@ Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_
                 auth_type = conf.value;
             }
         }
-        builder->set_hdfs_conf_to_hdfs_builder();
     }
+    builder->set_hdfs_read_conf();
+    builder->set_hdfs_conf_to_hdfs_builder();
 
     if (auth_type == "kerberos") {
         // set kerberos conf
@@ -65,6 +65,9 @@ public:
     void set_hdfs_conf(const std::string& key, const std::string& val);
     std::string get_hdfs_conf_value(const std::string& key, const std::string& default_val) const;
     void set_hdfs_conf_to_hdfs_builder();
+    // Adds the hedged read and the short-circuit read confs of the BE configs, unless they are
+    // set by the user.
+    void set_hdfs_read_conf();
 
 private:
     hdfsBuilder* hdfs_builder = nullptr;
@@ -22,6 +22,7 @@
 #include <bvar/latency_recorder.h>
 #include <gen_cpp/cloud.pb.h>
 
+#include <mutex>
 #include <ostream>
 #include <thread>
 
@@ -43,6 +44,17 @@ bvar::LatencyRecorder hdfs_hflush_latency("hdfs_hflush");
 bvar::LatencyRecorder hdfs_hsync_latency("hdfs_hsync");
 }; // namespace hdfs_bvar
 
+bvar::LatencyRecorder* hdfs_read_latency_of(const std::string& fs_name) {
+    static std::mutex lock;
+    static std::unordered_map<std::string, std::unique_ptr<bvar::LatencyRecorder>> recorders;
+    std::lock_guard l(lock);
+    auto& recorder = recorders[fs_name];
+    if (recorder == nullptr) {
+        recorder = std::make_unique<bvar::LatencyRecorder>("hdfs_read", fs_name);
+    }
+    return recorder.get();
+}
+
 Path convert_path(const Path& path, const std::string& namenode) {
     std::string fs_path;
     if (path.native().find(namenode) != std::string::npos) {
@@ -82,6 +82,9 @@ extern bvar::LatencyRecorder hdfs_hflush_latency;
 extern bvar::LatencyRecorder hdfs_hsync_latency;
 }; // namespace hdfs_bvar
 
+// The latency of the reads of the files on the name node `fs_name`, in us.
+bvar::LatencyRecorder* hdfs_read_latency_of(const std::string& fs_name);
+
 // if the format of path is hdfs://ip:port/path, replace it to /path.
 // path like hdfs://ip:port/path can't be used by libhdfs3.
 Path convert_path(const Path& path, const std::string& namenode);
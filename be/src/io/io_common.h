@@ -19,6 +19,9 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <array>
+#include <cstdint>
+
 namespace doris {
 
 enum class ReaderType : uint8_t {
@@ -42,6 +45,25 @@ struct FileReaderStats {
     size_t read_rows = 0;
 };
 
+// The number of the IOs by latency, the upper bounds of the buckets are 100us, 1ms, 10ms, 100ms,
+// 1s and infinity.
+struct IOLatencyHistogram {
+    static constexpr size_t NUM_BUCKETS = 6;
+    static constexpr std::array<const char*, NUM_BUCKETS> BUCKET_NAMES = {
+            "Under100us", "Under1ms", "Under10ms", "Under100ms", "Under1s", "Over1s"};
+
+    void add(int64_t latency_ns) {
+        size_t bucket = 0;
+        for (int64_t bound = 100'000; bucket + 1 < NUM_BUCKETS && latency_ns >= bound;
+             bound *= 10) {
+            ++bucket;
+        }
+        ++counts[bucket];
+    }
+
+    std::array<int64_t, NUM_BUCKETS> counts {};
+};
+
 struct FileCacheStatistics {
     int64_t num_local_io_total = 0;
     int64_t num_remote_io_total = 0;
@@ -57,6 +79,18 @@ struct FileCacheStatistics {
     int64_t lock_wait_timer = 0;
     int64_t get_timer = 0;
     int64_t set_timer = 0;
+    // the number of the opened files of external tables which have or have no downloaded
+    // blocks in the file cache, that is the cache locality of the splits assigned to the backend
+    int64_t num_files_with_cached_blocks = 0;
+    int64_t num_files_without_cached_blocks = 0;
+    // the reads of the segments on the local disks, which are not cached in the file cache
+    int64_t num_local_disk_io_total = 0;
+    int64_t bytes_read_from_local_disk = 0;
+    int64_t local_disk_io_timer = 0;
+    // the latencies of the reads from the file cache, the remote storage and the local disks
+    IOLatencyHistogram cache_hit_io_latency;
+    IOLatencyHistogram remote_io_latency;
+    IOLatencyHistogram local_disk_io_latency;
 
     int64_t inverted_index_num_local_io_total = 0;
     int64_t inverted_index_num_remote_io_total = 0;
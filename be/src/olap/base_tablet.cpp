@@ -74,11 +74,9 @@ bvar::LatencyRecorder g_tablet_update_delete_bitmap_latency("doris_pk", "update_
 
 static bvar::Adder<size_t> g_total_tablet_num("doris_total_tablet_num");
 
-Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t segid,
-                                    const TabletColumn& target_column,
-                                    SegmentCacheHandle* segment_cache_handle,
-                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
-                                    OlapReaderStatistics* stats) {
+Status _get_segment(const BetaRowsetSharedPtr& rowset, uint32_t segid,
+                    SegmentCacheHandle* segment_cache_handle,
+                    segment_v2::SegmentSharedPtr* segment) {
     RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(rowset, segment_cache_handle, true));
     // find segment
     auto it = std::find_if(
@@ -89,7 +87,14 @@ Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t
         return Status::NotFound(fmt::format("rowset {} 's segemnt not found, seg_id {}",
                                             rowset->rowset_id().to_string(), segid));
     }
-    segment_v2::SegmentSharedPtr segment = *it;
+    *segment = *it;
+    return Status::OK();
+}
+
+Status _new_segment_column_iterator(const segment_v2::SegmentSharedPtr& segment,
+                                    const TabletColumn& target_column,
+                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
+                                    OlapReaderStatistics* stats) {
     StorageReadOptions opts;
     opts.stats = stats;
     RETURN_IF_ERROR(segment->new_column_iterator(target_column, column_iterator, &opts));
@@ -104,6 +109,16 @@ Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t
     return Status::OK();
 }
 
+Status _get_segment_column_iterator(const BetaRowsetSharedPtr& rowset, uint32_t segid,
+                                    const TabletColumn& target_column,
+                                    SegmentCacheHandle* segment_cache_handle,
+                                    std::unique_ptr<segment_v2::ColumnIterator>* column_iterator,
+                                    OlapReaderStatistics* stats) {
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(_get_segment(rowset, segid, segment_cache_handle, &segment));
+    return _new_segment_column_iterator(segment, target_column, column_iterator, stats);
+}
+
 } // namespace
 
 extern MetricPrototype METRIC_query_scan_bytes;
@@ -460,6 +475,20 @@ Status BaseTablet::lookup_row_data(const Slice& encoded_key, const RowLocation&
     return Status::OK();
 }
 
+Status BaseTablet::lookup_row_data_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                             const std::vector<uint32_t>& rowids,
+                                             OlapReaderStatistics& stats,
+                                             vectorized::MutableColumnPtr& values) {
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    SegmentCacheHandle segment_cache_handle;
+    std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+    const auto& column = *DORIS_TRY(rowset->tablet_schema()->column(BeConsts::ROW_STORE_COL));
+    RETURN_IF_ERROR(_get_segment_column_iterator(rowset, segid, column, &segment_cache_handle,
+                                                 &column_iterator, &stats));
+    return column_iterator->read_by_rowids(rowids.data(), rowids.size(), values);
+}
+
 Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest_schema,
                                   bool with_seq_col,
                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
@@ -513,8 +542,11 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, TabletSchema* latest
         DCHECK_EQ(segments.size(), num_segments);
 
         for (auto id : picked_segments) {
+            // The keys of a load are looked up in order, so the pk index iterator of the segment
+            // is kept in `segment_caches` to reuse its data page.
             Status s = segments[id]->lookup_row_key(encoded_key, schema, with_seq_col, with_rowid,
-                                                    &loc, stats, encoded_seq_value);
+                                                    &loc, stats, encoded_seq_value,
+                                                    segment_caches[i]->pk_index_iterator(id));
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -640,6 +672,13 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     RETURN_IF_ERROR(seg->load_pk_index_and_bf(nullptr)); // We need index blocks to iterate
     const auto* pk_idx = seg->get_primary_key_index();
     int64_t total = pk_idx->num_rows();
+    // Only the rowsets which have a segment overlapping the key range of this segment are
+    // looked up, so the lookup of a key doesn't go through all the rowsets of the tablet.
+    std::vector<RowsetSharedPtr> overlapping_rowsets;
+    if (total > 0) {
+        _get_overlapping_rowsets(seg->min_key(), seg->max_key(), specified_rowsets,
+                                 &overlapping_rowsets);
+    }
     uint32_t row_id = 0;
     int64_t remaining = total;
     bool exact_match = false;
@@ -648,7 +687,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
-    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(overlapping_rowsets.size());
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter, nullptr));
@@ -720,10 +759,10 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
             RowsetSharedPtr rowset_find;
             Status st = Status::OK();
             if (tablet_delete_bitmap == nullptr) {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, overlapping_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find);
             } else {
-                st = lookup_row_key(key, rowset_schema.get(), true, specified_rowsets, &loc,
+                st = lookup_row_key(key, rowset_schema.get(), true, overlapping_rowsets, &loc,
                                     dummy_version.first - 1, segment_caches, &rowset_find, true,
                                     nullptr, nullptr, tablet_delete_bitmap);
             }
@@ -856,7 +895,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         LOG(INFO) << "calc segment delete bitmap, tablet: " << tablet_id()
                   << " rowset: " << rowset_id << " seg_id: " << seg->id()
                   << " dummy_version: " << end_version + 1 << " rows: " << seg->num_rows()
-                  << " conflict rows: " << conflict_rows
+                  << " overlapping rowsets: " << overlapping_rowsets.size() << "/"
+                  << specified_rowsets.size() << " conflict rows: " << conflict_rows
                   << " bitmap num: " << delete_bitmap->get_delete_bitmap_count()
                   << " bitmap cardinality: " << delete_bitmap->cardinality() << " cost: " << cost_us
                   << "(us)";
@@ -864,6 +904,25 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     return Status::OK();
 }
 
+void BaseTablet::_get_overlapping_rowsets(const std::string& min_key, const std::string& max_key,
+                                          const std::vector<RowsetSharedPtr>& rowsets,
+                                          std::vector<RowsetSharedPtr>* overlapping_rowsets) {
+    std::vector<KeyBoundsPB> segments_key_bounds;
+    for (const auto& rs : rowsets) {
+        segments_key_bounds.clear();
+        rs->rowset_meta()->get_segments_key_bounds(&segments_key_bounds);
+        bool truncated = rs->rowset_meta()->is_segments_key_bounds_truncated();
+        if (std::any_of(segments_key_bounds.begin(), segments_key_bounds.end(),
+                        [&](const KeyBoundsPB& key_bounds) {
+                            return !key_range_is_not_in_segment(min_key, max_key, key_bounds,
+                                                                truncated);
+                        })) {
+            // keep the order of the rowsets, the newer ones are looked up first
+            overlapping_rowsets->push_back(rs);
+        }
+    }
+}
+
 Status BaseTablet::sort_block(vectorized::Block& in_block, vectorized::Block& output_block) {
     vectorized::MutableBlock mutable_input_block =
             vectorized::MutableBlock::build_mutable_block(&in_block);
@@ -965,6 +1024,36 @@ Status BaseTablet::fetch_value_by_rowids(RowsetSharedPtr input_rowset, uint32_t
     return Status::OK();
 }
 
+Status BaseTablet::fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                          const std::vector<uint32_t>& rowids,
+                                          const TabletSchema& tablet_schema,
+                                          const std::vector<uint32_t>& cids,
+                                          vectorized::MutableColumns& dsts) {
+    DCHECK_EQ(cids.size(), dsts.size());
+    MonotonicStopWatch watch;
+    watch.start();
+    Defer _defer([&]() {
+        LOG_EVERY_N(INFO, 500) << "fetch_values_by_rowids, cost(us):"
+                               << watch.elapsed_time() / 1000
+                               << ", row_batch_size:" << rowids.size()
+                               << ", columns:" << cids.size();
+    });
+
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    SegmentCacheHandle segment_cache_handle;
+    segment_v2::SegmentSharedPtr segment;
+    RETURN_IF_ERROR(_get_segment(rowset, segid, &segment_cache_handle, &segment));
+    OlapReaderStatistics stats;
+    for (size_t i = 0; i < cids.size(); ++i) {
+        std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+        RETURN_IF_ERROR(_new_segment_column_iterator(segment, tablet_schema.column(cids[i]),
+                                                     &column_iterator, &stats));
+        RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), dsts[i]));
+    }
+    return Status::OK();
+}
+
 const signed char* BaseTablet::get_delete_sign_column_data(const vectorized::Block& block,
                                                            size_t rows_at_least) {
     if (const vectorized::ColumnWithTypeAndName* delete_sign_column =
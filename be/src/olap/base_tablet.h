@@ -158,6 +158,12 @@ public:
     Status lookup_row_data(const Slice& encoded_key, const RowLocation& row_location,
                            RowsetSharedPtr rowset, OlapReaderStatistics& stats, std::string& values,
                            bool write_to_cache = false);
+    // Reads the row store values of the ascending `rowids` in a segment of the rowset into
+    // `values`, which is a ColumnString.
+    Status lookup_row_data_by_rowids(RowsetSharedPtr rowset, uint32_t segid,
+                                     const std::vector<uint32_t>& rowids,
+                                     OlapReaderStatistics& stats,
+                                     vectorized::MutableColumnPtr& values);
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
@@ -245,6 +251,15 @@ public:
                                         const TabletColumn& tablet_column,
                                         vectorized::MutableColumnPtr& dst);
 
+    // Same as fetch_value_by_rowids, but reads the columns `cids` of `tablet_schema` into `dsts`
+    // with the segment loaded once. `rowids` should be ascending, so the rows in a page are read
+    // in one batch.
+    static Status fetch_values_by_rowids(RowsetSharedPtr input_rowset, uint32_t segid,
+                                         const std::vector<uint32_t>& rowids,
+                                         const TabletSchema& tablet_schema,
+                                         const std::vector<uint32_t>& cids,
+                                         vectorized::MutableColumns& dsts);
+
     virtual Result<std::unique_ptr<RowsetWriter>> create_transient_rowset_writer(
             const Rowset& rowset, std::shared_ptr<PartialUpdateInfo> partial_update_info,
             int64_t txn_expiration = 0) = 0;
@@ -346,6 +361,11 @@ protected:
                                        const RowsetIdUnorderedSet& pre,
                                        RowsetIdUnorderedSet* to_add, RowsetIdUnorderedSet* to_del);
 
+    // The rowsets of `rowsets` which have a segment whose key bounds overlap [min_key, max_key].
+    static void _get_overlapping_rowsets(const std::string& min_key, const std::string& max_key,
+                                         const std::vector<RowsetSharedPtr>& rowsets,
+                                         std::vector<RowsetSharedPtr>* overlapping_rowsets);
+
     Status _capture_consistent_rowsets_unlocked(const std::vector<Version>& version_path,
                                                 std::vector<RowsetSharedPtr>* rowsets) const;
 
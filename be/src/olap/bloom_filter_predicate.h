@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <map>
+
 #include "exprs/bloom_filter_func.h"
 #include "olap/column_predicate.h"
 #include "runtime/primitive_type.h"
@@ -72,8 +74,11 @@ private:
         uint16_t new_size = 0;
         if (column.is_column_dictionary()) {
             const auto* dict_col = assert_cast<const vectorized::ColumnDictI32*>(&column);
+            // Every segment has its own dictionary.
+            auto& dict_flags =
+                    _segment_id_to_value_in_dict_flags[dict_col->get_rowset_segment_id()];
             new_size = _specific_filter->template find_dict_olap_engine<is_nullable>(
-                    dict_col, null_map, sel, size);
+                    dict_col, null_map, sel, size, dict_flags);
         } else {
             const auto& data =
                     assert_cast<const vectorized::PredicateColumnType<PredicateEvaluateType<T>>*>(
@@ -89,6 +94,8 @@ private:
 
     std::shared_ptr<BloomFilterFuncBase> _filter;
     SpecificFilter* _specific_filter; // owned by _filter
+    mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
+            _segment_id_to_value_in_dict_flags;
 };
 
 template <PrimitiveType T>
@@ -25,6 +25,7 @@
 #include "olap/rowset/segment_v2/inverted_index_cache.h" // IWYU pragma: keep
 #include "olap/rowset/segment_v2/inverted_index_reader.h"
 #include "olap/wrapper_field.h"
+#include "util/simd/bits.h"
 #include "vec/columns/column_dictionary.h"
 
 namespace doris {
@@ -593,6 +594,11 @@ private:
                             vectorized::PredicateColumnType<PredicateEvaluateType<Type>>>(column)
                             ->get_data();
             auto pred_col_data = pred_col.data();
+            if constexpr (!std::is_same_v<T, StringRef>) {
+                if (pred_col.size() == size) {
+                    return _base_evaluate_dense<is_nullable>(pred_col_data, null_map, sel, size);
+                }
+            }
             uint16_t new_size = 0;
 #define EVALUATE_WITH_NULL_IMPL(IDX) \
     _opposite ^ (!null_map[IDX] && _operator(pred_col_data[IDX], _value))
@@ -604,6 +610,51 @@ private:
         }
     }
 
+    // Evaluates the predicate on a dense column, i.e. sel is 0..size-1, block by block: the flags
+    // of a block are computed without branches so that the compiler vectorizes the comparisons,
+    // then turned into a bit mask to emit the selected rows.
+    template <bool is_nullable, typename TArray>
+    uint16_t _base_evaluate_dense(const TArray* __restrict data_array,
+                                  const uint8_t* __restrict null_map, uint16_t* sel,
+                                  uint16_t size) const {
+        static constexpr size_t SIMD_BYTES = simd::bits_mask_length();
+        uint8_t flags[SIMD_BYTES];
+        uint16_t new_size = 0;
+        uint16_t pos = 0;
+        const uint16_t end_simd = size / SIMD_BYTES * SIMD_BYTES;
+        for (; pos < end_simd; pos += SIMD_BYTES) {
+            for (size_t i = 0; i < SIMD_BYTES; i++) {
+                if constexpr (is_nullable) {
+                    flags[i] = _opposite ^
+                               (!null_map[pos + i] & _operator(data_array[pos + i], _value));
+                } else {
+                    flags[i] = _opposite ^ _operator(data_array[pos + i], _value);
+                }
+            }
+            auto mask = simd::bytes_mask_to_bits_mask(flags);
+            if (simd::bits_mask_all() == mask) {
+                for (uint16_t i = 0; i < SIMD_BYTES; i++) {
+                    sel[new_size++] = pos + i;
+                }
+            } else if (mask != 0) {
+                simd::iterate_through_bits_mask(
+                        [&](const uint16_t bit_pos) { sel[new_size++] = pos + bit_pos; }, mask);
+            }
+        }
+        for (; pos < size; pos++) {
+            if constexpr (is_nullable) {
+                if (_opposite ^ (!null_map[pos] && _operator(data_array[pos], _value))) {
+                    sel[new_size++] = pos;
+                }
+            } else {
+                if (_opposite ^ _operator(data_array[pos], _value)) {
+                    sel[new_size++] = pos;
+                }
+            }
+        }
+        return new_size;
+    }
+
     int32_t __attribute__((flatten))
     _find_code_from_dictionary_column(const vectorized::ColumnDictI32& column) const {
         int32_t code = 0;
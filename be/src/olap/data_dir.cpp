@@ -62,9 +62,11 @@
 #include "olap/tablet_meta_manager.h"
 #include "olap/txn_manager.h"
 #include "olap/utils.h" // for check_dir_existed
+#include "runtime/thread_context.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -421,11 +423,12 @@ Status DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta";
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_lock;
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_lock](
+                               int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard lock(tablet_ids_lock);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -448,11 +451,50 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+
+    // Deserializing the tablet metas dominates the loading of a data dir with many tablets, so
+    // the headers are loaded by a thread pool in batches, which bounds the headers held in memory.
+    constexpr size_t LOAD_TABLET_BATCH_SIZE = 4096;
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_metas_threads_per_data_dir > 1) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("load_tablet_meta")
+                                .set_min_threads(config::load_tablet_metas_threads_per_data_dir)
+                                .set_max_threads(config::load_tablet_metas_threads_per_data_dir)
+                                .build(&load_tablet_pool));
+    }
+    std::vector<std::tuple<int64_t, int32_t, std::string>> headers;
+    auto load_headers = [&]() {
+        for (const auto& header : headers) {
+            auto st = load_tablet_pool->submit_func([&load_tablet, &header]() {
+                SCOPED_INIT_THREAD_CONTEXT();
+                load_tablet(std::get<0>(header), std::get<1>(header), std::get<2>(header));
+            });
+            if (!st.ok()) {
+                load_tablet(std::get<0>(header), std::get<1>(header), std::get<2>(header));
+            }
+        }
+        load_tablet_pool->wait();
+        headers.clear();
+    };
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash,
+                                std::string_view value) -> bool {
+        if (load_tablet_pool == nullptr) {
+            load_tablet(tablet_id, schema_hash, value);
+            return true;
+        }
+        headers.emplace_back(tablet_id, schema_hash, value);
+        if (headers.size() >= LOAD_TABLET_BATCH_SIZE) {
+            load_headers();
+        }
         return true;
     };
     MonotonicStopWatch tablet_timer;
     tablet_timer.start();
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    if (!headers.empty()) {
+        load_headers();
+    }
     tablet_timer.stop();
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
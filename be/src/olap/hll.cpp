@@ -17,9 +17,12 @@
 
 #include "olap/hll.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
+#include <memory>
 #include <ostream>
+#include <vector>
 
 #include "common/logging.h"
 #include "util/coding.h"
@@ -37,13 +40,11 @@ HyperLogLog::HyperLogLog(const Slice& src) {
     }
 }
 
-// Convert explicit values to register format, and clear explicit values.
-// NOTE: this function won't modify _type.
-void HyperLogLog::_convert_explicit_to_register() {
+// Convert explicit values to sparse registers, and clear explicit values.
+void HyperLogLog::_convert_explicit_to_sparse() {
     DCHECK(_type == HLL_DATA_EXPLICIT)
             << "_type(" << _type << ") should be explicit(" << HLL_DATA_EXPLICIT << ")";
-    _registers = new uint8_t[HLL_REGISTERS_COUNT];
-    memset(_registers, 0, HLL_REGISTERS_COUNT);
+    _type = HLL_DATA_SPARSE;
     for (auto value : _hash_set) {
         _update_registers(value);
     }
@@ -51,8 +52,22 @@ void HyperLogLog::_convert_explicit_to_register() {
     vectorized::flat_hash_set<uint64_t>().swap(_hash_set);
 }
 
-// Change HLL_DATA_EXPLICIT to HLL_DATA_FULL directly, because HLL_DATA_SPARSE
-// is implemented in the same way in memory with HLL_DATA_FULL.
+void HyperLogLog::_convert_sparse_to_full() {
+    DCHECK(_type == HLL_DATA_SPARSE)
+            << "_type(" << _type << ") should be sparse(" << HLL_DATA_SPARSE << ")";
+    _registers = new uint8_t[HLL_REGISTERS_COUNT];
+    memset(_registers, 0, HLL_REGISTERS_COUNT);
+    _fill_registers(_registers);
+    vectorized::flat_hash_map<uint16_t, uint8_t>().swap(_sparse_registers);
+    _type = HLL_DATA_FULL;
+}
+
+void HyperLogLog::_fill_registers(uint8_t* registers) const {
+    for (const auto& [idx, value] : _sparse_registers) {
+        registers[idx] = value;
+    }
+}
+
 void HyperLogLog::update(uint64_t hash_value) {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -64,8 +79,7 @@ void HyperLogLog::update(uint64_t hash_value) {
             _hash_set.insert(hash_value);
             break;
         }
-        _convert_explicit_to_register();
-        _type = HLL_DATA_FULL;
+        _convert_explicit_to_sparse();
         // fall through
     case HLL_DATA_SPARSE:
     case HLL_DATA_FULL:
@@ -79,63 +93,48 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     if (other._type == HLL_DATA_EMPTY) {
         return;
     }
-    switch (_type) {
-    case HLL_DATA_EMPTY: {
-        // _type must change
-        _type = other._type;
-        switch (other._type) {
-        case HLL_DATA_EXPLICIT:
-            _hash_set = other._hash_set;
-            break;
-        case HLL_DATA_SPARSE:
-        case HLL_DATA_FULL:
-            _registers = new uint8_t[HLL_REGISTERS_COUNT];
-            memcpy(_registers, other._registers, HLL_REGISTERS_COUNT);
-            break;
-        default:
-            break;
-        }
-        break;
+    if (_type == HLL_DATA_EMPTY) {
+        *this = other;
+        return;
     }
-    case HLL_DATA_EXPLICIT: {
-        switch (other._type) {
-        case HLL_DATA_EXPLICIT: {
+    if (_type == HLL_DATA_EXPLICIT) {
+        if (other._type == HLL_DATA_EXPLICIT) {
             // Merge other's explicit values first, then check if the number is exceed
             // HLL_EXPLICIT_INT64_NUM. This is OK because the max value is 2 * 160.
             _hash_set.insert(other._hash_set.begin(), other._hash_set.end());
             if (_hash_set.size() > HLL_EXPLICIT_INT64_NUM) {
-                _convert_explicit_to_register();
-                _type = HLL_DATA_FULL;
+                _convert_explicit_to_sparse();
             }
-        } break;
-        case HLL_DATA_SPARSE:
-        case HLL_DATA_FULL:
-            _convert_explicit_to_register();
-            _merge_registers(other._registers);
-            _type = HLL_DATA_FULL;
-            break;
-        default:
-            break;
+            return;
         }
-        break;
+        _convert_explicit_to_sparse();
     }
+
+    // this is sparse or full
+    switch (other._type) {
+    case HLL_DATA_EXPLICIT:
+        for (auto hash_value : other._hash_set) {
+            _update_registers(hash_value);
+        }
+        break;
     case HLL_DATA_SPARSE:
-    case HLL_DATA_FULL: {
-        switch (other._type) {
-        case HLL_DATA_EXPLICIT:
-            for (auto hash_value : other._hash_set) {
-                _update_registers(hash_value);
-            }
-            break;
-        case HLL_DATA_SPARSE:
-        case HLL_DATA_FULL:
-            _merge_registers(other._registers);
-            break;
-        default:
-            break;
+        if (_type == HLL_DATA_SPARSE &&
+            _sparse_registers.size() + other._sparse_registers.size() >
+                    HLL_SPARSE_MEMORY_THRESHOLD) {
+            _convert_sparse_to_full();
+        }
+        for (const auto& [idx, value] : other._sparse_registers) {
+            _update_register(idx, value);
         }
         break;
-    }
+    case HLL_DATA_FULL:
+        if (_type == HLL_DATA_SPARSE) {
+            _convert_sparse_to_full();
+        }
+        _merge_registers(other._registers);
+        break;
+    default:
+        break;
     }
 }
 
@@ -147,6 +146,7 @@ size_t HyperLogLog::max_serialized_size() const {
     case HLL_DATA_EXPLICIT:
         return 2 + _hash_set.size() * 8;
     case HLL_DATA_SPARSE:
+        return 1 + 4 + 3 * _sparse_registers.size();
     case HLL_DATA_FULL:
         return 1 + HLL_REGISTERS_COUNT;
     }
@@ -174,7 +174,21 @@ size_t HyperLogLog::serialize(uint8_t* dst) const {
         }
         break;
     }
-    case HLL_DATA_SPARSE:
+    case HLL_DATA_SPARSE: {
+        // The registers are encoded by index, so that the same registers have the same binary.
+        std::vector<std::pair<uint16_t, uint8_t>> registers(_sparse_registers.begin(),
+                                                            _sparse_registers.end());
+        std::sort(registers.begin(), registers.end());
+        *ptr++ = HLL_DATA_SPARSE;
+        encode_fixed32_le(ptr, static_cast<uint32_t>(registers.size()));
+        ptr += 4;
+        for (const auto& [idx, value] : registers) {
+            encode_fixed16_le(ptr, idx);
+            ptr += 2;
+            *ptr++ = value;
+        }
+        break;
+    }
     case HLL_DATA_FULL: {
         uint32_t num_non_zero_registers = 0;
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
@@ -284,17 +298,27 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         break;
     }
     case HLL_DATA_SPARSE: {
-        _registers = new uint8_t[HLL_REGISTERS_COUNT];
-        memset(_registers, 0, HLL_REGISTERS_COUNT);
         // 2-5(4 byte): number of registers
         uint32_t num_registers = decode_fixed32_le(ptr);
         ptr += 4;
+        if (num_registers > HLL_SPARSE_MEMORY_THRESHOLD) {
+            _type = HLL_DATA_FULL;
+            _registers = new uint8_t[HLL_REGISTERS_COUNT];
+            memset(_registers, 0, HLL_REGISTERS_COUNT);
+        } else {
+            _sparse_registers.reserve(num_registers);
+        }
         for (uint32_t i = 0; i < num_registers; ++i) {
             // 2 bytes: register index
             // 1 byte: register value
             uint16_t register_idx = decode_fixed16_le(ptr);
             ptr += 2;
-            _registers[register_idx] = *ptr++;
+            uint8_t value = *ptr++;
+            if (_type == HLL_DATA_FULL) {
+                _registers[register_idx] = value;
+            } else if (value != 0) {
+                _sparse_registers[register_idx] = value;
+            }
         }
         break;
     }
@@ -334,13 +358,22 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213F / (1 + 1.079F / num_streams);
     }
 
+    const uint8_t* registers = _registers;
+    std::unique_ptr<uint8_t[]> sparse_registers;
+    if (_type == HLL_DATA_SPARSE) {
+        // Sum the registers in the same order as the full ones, for the same estimate.
+        sparse_registers.reset(new uint8_t[HLL_REGISTERS_COUNT]());
+        _fill_registers(sparse_registers.get());
+        registers = sparse_registers.get();
+    }
+
     float harmonic_mean = 0;
     int num_zero_registers = 0;
 
     for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0F, -_registers[i]);
+        harmonic_mean += powf(2.0F, -registers[i]);
 
-        if (_registers[i] == 0) {
+        if (registers[i] == 0) {
             ++num_zero_registers;
         }
     }
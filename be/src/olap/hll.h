@@ -37,6 +37,9 @@ inline const int HLL_COLUMN_PRECISION = 14;
 inline const int HLL_ZERO_COUNT_BITS = (64 - HLL_COLUMN_PRECISION);
 inline const int HLL_EXPLICIT_INT64_NUM = 160;
 inline const int HLL_SPARSE_THRESHOLD = 4096;
+// In memory, the registers are kept in a hash map while there are not more non-zero registers
+// than this, which takes less than half the memory of the full registers.
+inline const size_t HLL_SPARSE_MEMORY_THRESHOLD = 1024;
 inline const uint16_t HLL_REGISTERS_COUNT = 16 * 1024;
 // maximum size in byte of serialized HLL: type(1) + registers (2^14)
 inline const int HLL_COLUMN_DEFAULT_LEN = HLL_REGISTERS_COUNT + 1;
@@ -69,7 +72,9 @@ inline const int HLL_EMPTY_SIZE = 1;
 // HLL_DATA_FULL: most space-consuming, store all registers
 //
 // A HLL value will change in the sequence empty -> explicit -> sparse -> full, and not
-// allow reverse.
+// allow reverse. In memory, a sparse value keeps its non-zero registers in a hash map while
+// there are at most HLL_SPARSE_MEMORY_THRESHOLD of them, so the mid cardinality values are
+// small and cheap to merge.
 //
 // NOTE: This values are persisted in storage devices, so don't change exist
 // enum values.
@@ -97,7 +102,10 @@ public:
             this->_hash_set = other._hash_set;
             break;
         }
-        case HLL_DATA_SPARSE:
+        case HLL_DATA_SPARSE: {
+            this->_sparse_registers = other._sparse_registers;
+            break;
+        }
         case HLL_DATA_FULL: {
             _registers = new uint8_t[HLL_REGISTERS_COUNT];
             memcpy(_registers, other._registers, HLL_REGISTERS_COUNT);
@@ -118,7 +126,11 @@ public:
             other._type = HLL_DATA_EMPTY;
             break;
         }
-        case HLL_DATA_SPARSE:
+        case HLL_DATA_SPARSE: {
+            this->_sparse_registers = std::move(other._sparse_registers);
+            other._type = HLL_DATA_EMPTY;
+            break;
+        }
         case HLL_DATA_FULL: {
             this->_registers = other._registers;
             other._registers = nullptr;
@@ -132,11 +144,7 @@ public:
 
     HyperLogLog& operator=(HyperLogLog&& other) noexcept {
         if (this != &other) {
-            if (_registers != nullptr) {
-                delete[] _registers;
-                _registers = nullptr;
-            }
-
+            clear();
             this->_type = other._type;
             switch (other._type) {
             case HLL_DATA_EMPTY:
@@ -146,7 +154,11 @@ public:
                 other._type = HLL_DATA_EMPTY;
                 break;
             }
-            case HLL_DATA_SPARSE:
+            case HLL_DATA_SPARSE: {
+                this->_sparse_registers = std::move(other._sparse_registers);
+                other._type = HLL_DATA_EMPTY;
+                break;
+            }
             case HLL_DATA_FULL: {
                 this->_registers = other._registers;
                 other._registers = nullptr;
@@ -162,11 +174,7 @@ public:
 
     HyperLogLog& operator=(const HyperLogLog& other) {
         if (this != &other) {
-            if (_registers != nullptr) {
-                delete[] _registers;
-                _registers = nullptr;
-            }
-
+            clear();
             this->_type = other._type;
             switch (other._type) {
             case HLL_DATA_EMPTY:
@@ -175,7 +183,10 @@ public:
                 this->_hash_set = other._hash_set;
                 break;
             }
-            case HLL_DATA_SPARSE:
+            case HLL_DATA_SPARSE: {
+                this->_sparse_registers = other._sparse_registers;
+                break;
+            }
             case HLL_DATA_FULL: {
                 _registers = new uint8_t[HLL_REGISTERS_COUNT];
                 memcpy(_registers, other._registers, HLL_REGISTERS_COUNT);
@@ -192,6 +203,7 @@ public:
     void clear() {
         _type = HLL_DATA_EMPTY;
         _hash_set.clear();
+        _sparse_registers.clear();
         delete[] _registers;
         _registers = nullptr;
     }
@@ -214,7 +226,10 @@ public:
         size_t size = sizeof(*this);
         if (_type == HLL_DATA_EXPLICIT) {
             size += _hash_set.size() * sizeof(uint64_t);
-        } else if (_type == HLL_DATA_SPARSE || _type == HLL_DATA_FULL) {
+        } else if (_type == HLL_DATA_SPARSE) {
+            // a slot and a control byte per bucket
+            size += _sparse_registers.capacity() * (sizeof(std::pair<uint16_t, uint8_t>) + 1);
+        } else if (_type == HLL_DATA_FULL) {
             size += HLL_REGISTERS_COUNT;
         }
         return size;
@@ -260,18 +275,40 @@ public:
     }
 
 private:
-    void _convert_explicit_to_register();
-
-    // update one hash value into this registers
-    void _update_registers(uint64_t hash_value) {
-        // Use the lower bits to index into the number of streams and then
-        // find the first 1 bit after the index bits.
-        int idx = hash_value % HLL_REGISTERS_COUNT;
+    void _convert_explicit_to_sparse();
+    void _convert_sparse_to_full();
+    // Writes the sparse registers into `registers`, which must be zeroed.
+    void _fill_registers(uint8_t* registers) const;
+
+    // Use the lower bits to index into the number of streams and then
+    // find the first 1 bit after the index bits.
+    static uint16_t _register_index(uint64_t hash_value) {
+        return static_cast<uint16_t>(hash_value % HLL_REGISTERS_COUNT);
+    }
+    static uint8_t _register_value(uint64_t hash_value) {
         hash_value >>= HLL_COLUMN_PRECISION;
         // make sure max first_one_bit is HLL_ZERO_COUNT_BITS + 1
         hash_value |= ((uint64_t)1 << HLL_ZERO_COUNT_BITS);
-        auto first_one_bit = uint8_t(__builtin_ctzl(hash_value) + 1);
-        _registers[idx] = (_registers[idx] < first_one_bit ? first_one_bit : _registers[idx]);
+        return uint8_t(__builtin_ctzl(hash_value) + 1);
+    }
+
+    // Raises the register to `value`, the sparse registers are converted to the full ones when
+    // there are too many of them.
+    void _update_register(uint16_t idx, uint8_t value) {
+        if (_type == HLL_DATA_FULL) {
+            _registers[idx] = (_registers[idx] < value ? value : _registers[idx]);
+            return;
+        }
+        auto& reg = _sparse_registers[idx];
+        reg = (reg < value ? value : reg);
+        if (_sparse_registers.size() > HLL_SPARSE_MEMORY_THRESHOLD) {
+            _convert_sparse_to_full();
+        }
+    }
+
+    // update one hash value into this registers
+    void _update_registers(uint64_t hash_value) {
+        _update_register(_register_index(hash_value), _register_value(hash_value));
     }
 
     // absorb other registers into this registers
@@ -298,6 +335,9 @@ private:
     HllDataType _type = HLL_DATA_EMPTY;
     vectorized::flat_hash_set<uint64_t> _hash_set;
 
+    // The non-zero registers of HLL_DATA_SPARSE.
+    vectorized::flat_hash_map<uint16_t, uint8_t> _sparse_registers;
+
     // This field is much space consuming(HLL_REGISTERS_COUNT), we create
     // it only when it is really needed.
     uint8_t* _registers = nullptr;
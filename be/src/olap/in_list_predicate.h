@@ -306,50 +306,10 @@ public:
             if (bf->is_ngram_bf()) {
                 return true;
             }
-            HybridSetBase::IteratorBase* iter = _values->begin();
-            while (iter->has_next()) {
-                if constexpr (std::is_same_v<T, StringRef>) {
-                    const auto* value = (const StringRef*)iter->get_value();
-                    if (bf->test_bytes(value->data, value->size)) {
-                        return true;
-                    }
-                } else if constexpr (Type == PrimitiveType::TYPE_DECIMALV2) {
-                    // DecimalV2 using decimal12_t in bloom filter in storage layer,
-                    // should convert value to decimal12_t
-                    // Datev1/DatetimeV1 using VecDatetimeValue in bloom filter, NO need to convert.
-                    const T* value = (const T*)(iter->get_value());
-                    decimal12_t decimal12_t_val(value->int_value(), value->frac_value());
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&decimal12_t_val)),
-                                sizeof(decimal12_t))) {
-                        return true;
-                    }
-                } else if constexpr (Type == PrimitiveType::TYPE_DATE) {
-                    const T* value = (const T*)(iter->get_value());
-                    uint24_t date_value(uint32_t(value->to_olap_date()));
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&date_value)),
-                                sizeof(uint24_t))) {
-                        return true;
-                    }
-                    // DatetimeV1 using int64_t in bloom filter
-                } else if constexpr (Type == PrimitiveType::TYPE_DATETIME) {
-                    const T* value = (const T*)(iter->get_value());
-                    int64_t datetime_value(value->to_olap_datetime());
-                    if (bf->test_bytes(
-                                const_cast<char*>(reinterpret_cast<const char*>(&datetime_value)),
-                                sizeof(int64_t))) {
-                        return true;
-                    }
-                } else {
-                    const T* value = (const T*)(iter->get_value());
-                    if (bf->test_bytes(reinterpret_cast<const char*>(value), sizeof(*value))) {
-                        return true;
-                    }
-                }
-                iter->next();
+            if (!_bloom_filter_hashes_inited) {
+                _init_bloom_filter_hashes(bf);
             }
-            return false;
+            return bf->test_any_hash(_bloom_filter_hashes.data(), _bloom_filter_hashes.size());
         } else {
             LOG(FATAL) << "Bloom filter is not supported by predicate type.";
             return true;
@@ -425,25 +385,21 @@ private:
                         << " rowsetid=" << segid.first << " segmentid=" << segid.second
                         << "dict_info" << nested_col_ptr->dict_debug_string();
 
+                // The values are resolved once per segment into a flag per dict code, so a row is
+                // selected by a lookup of its code, without branches and string comparisons.
+                constexpr vectorized::UInt8 flip =
+                        is_opposite != (PT == PredicateType::IN_LIST) ? 0 : 1;
+                const auto* codes = data_array.data();
+                const auto* code_flags = value_in_dict_flags.data();
+                const bool is_dense_column = data_array.size() == size;
                 for (uint16_t i = 0; i < size; i++) {
-                    uint16_t idx = sel[i];
+                    uint16_t idx = is_dense_column ? i : sel[i];
+                    sel[new_size] = idx;
                     if constexpr (is_nullable) {
-                        if ((*null_map)[idx]) {
-                            if constexpr (is_opposite) {
-                                sel[new_size++] = idx;
-                            }
-                            continue;
-                        }
-                    }
-
-                    if constexpr (is_opposite != (PT == PredicateType::IN_LIST)) {
-                        if (value_in_dict_flags[data_array[idx]]) {
-                            sel[new_size++] = idx;
-                        }
+                        // The code of a null row is not a valid index of the flags.
+                        new_size += (*null_map)[idx] ? is_opposite : code_flags[codes[idx]] ^ flip;
                     } else {
-                        if (!value_in_dict_flags[data_array[idx]]) {
-                            sel[new_size++] = idx;
-                        }
+                        new_size += code_flags[codes[idx]] ^ flip;
                     }
                 }
             } else {
@@ -554,6 +510,44 @@ private:
         return "InListPredicate(" + type_to_string(Type) + ", " + type_to_string(PT) + ")";
     }
 
+    // The values are hashed once instead of once for the bloom filter of every page.
+    void _init_bloom_filter_hashes(const segment_v2::BloomFilter* bf) const {
+        _bloom_filter_hashes.reserve(_values->size());
+        HybridSetBase::IteratorBase* iter = _values->begin();
+        while (iter->has_next()) {
+            if constexpr (std::is_same_v<T, StringRef>) {
+                const auto* value = (const StringRef*)iter->get_value();
+                _bloom_filter_hashes.push_back(bf->hash(value->data, value->size));
+            } else if constexpr (Type == PrimitiveType::TYPE_DECIMALV2) {
+                // DecimalV2 using decimal12_t in bloom filter in storage layer,
+                // should convert value to decimal12_t
+                // Datev1/DatetimeV1 using VecDatetimeValue in bloom filter, NO need to convert.
+                const T* value = (const T*)(iter->get_value());
+                decimal12_t decimal12_t_val(value->int_value(), value->frac_value());
+                _bloom_filter_hashes.push_back(
+                        bf->hash(reinterpret_cast<const char*>(&decimal12_t_val),
+                                 sizeof(decimal12_t)));
+            } else if constexpr (Type == PrimitiveType::TYPE_DATE) {
+                const T* value = (const T*)(iter->get_value());
+                uint24_t date_value(uint32_t(value->to_olap_date()));
+                _bloom_filter_hashes.push_back(
+                        bf->hash(reinterpret_cast<const char*>(&date_value), sizeof(uint24_t)));
+                // DatetimeV1 using int64_t in bloom filter
+            } else if constexpr (Type == PrimitiveType::TYPE_DATETIME) {
+                const T* value = (const T*)(iter->get_value());
+                int64_t datetime_value(value->to_olap_datetime());
+                _bloom_filter_hashes.push_back(
+                        bf->hash(reinterpret_cast<const char*>(&datetime_value), sizeof(int64_t)));
+            } else {
+                const T* value = (const T*)(iter->get_value());
+                _bloom_filter_hashes.push_back(
+                        bf->hash(reinterpret_cast<const char*>(value), sizeof(*value)));
+            }
+            iter->next();
+        }
+        _bloom_filter_hashes_inited = true;
+    }
+
     void _update_min_max(const T& value) {
         if (value > _max_value) {
             _max_value = value;
@@ -569,6 +563,10 @@ private:
     T _min_value;
     T _max_value;
 
+    // All the storage bloom filters are hashed by HASH_MURMUR3_X64_64 with the same seed.
+    mutable std::vector<uint64_t> _bloom_filter_hashes;
+    mutable bool _bloom_filter_hashes_inited = false;
+
     // temp string for char type column
     std::list<std::string> _temp_datas;
 };
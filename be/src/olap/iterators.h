@@ -117,6 +117,8 @@ public:
     int64_t tablet_id = 0;
     // slots that cast may be eliminated in storage layer
     std::map<std::string, PrimitiveType> target_cast_type_for_variants;
+    // the only sub columns read of the struct columns, the others are filled with defaults
+    std::map<ColumnId, std::vector<std::string>> struct_read_sub_columns;
     RowRanges row_ranges;
     size_t topn_limit = 0;
 
@@ -4,6 +4,7 @@
 
 #include "olap/lru_cache.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <mutex>
 #include <new>
@@ -27,6 +28,7 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS)
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_miss_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_stampede_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_admission_reject_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
@@ -164,6 +166,63 @@ uint32_t HandleTable::element_count() const {
     return _elems;
 }
 
+void FrequencySketch::ensure_capacity(size_t element_count) {
+    // One uint64_t (16 counters) per key, as each key is counted by 4 counters.
+    size_t table_size = std::min(std::max(element_count, size_t(64)), MAX_TABLE_SIZE);
+    table_size = size_t(1) << (64 - __builtin_clzll(table_size - 1));
+    if (table_size <= _table.size()) {
+        return;
+    }
+    _table.assign(table_size, 0);
+    _sample_size = table_size * 16 * 10;
+    _additions = 0;
+}
+
+size_t FrequencySketch::_counter_index(uint64_t spread, int i) const {
+    static constexpr uint64_t SEEDS[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                         0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+    uint64_t h = (spread + SEEDS[i]) * SEEDS[i];
+    h += h >> 32;
+    return h & (_table.size() * 16 - 1);
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    DCHECK(!_table.empty());
+    const uint64_t spread = uint64_t(hash) * 0x9e3779b97f4a7c15ULL;
+    bool added = false;
+    for (int i = 0; i < 4; i++) {
+        const size_t index = _counter_index(spread, i);
+        const int shift = int(index & 15) << 2;
+        uint64_t& word = _table[index >> 4];
+        if (((word >> shift) & 0xfULL) != 0xfULL) {
+            word += 1ULL << shift;
+            added = true;
+        }
+    }
+    if (added && ++_additions == _sample_size) {
+        _reset();
+    }
+}
+
+int FrequencySketch::frequency(uint32_t hash) const {
+    DCHECK(!_table.empty());
+    const uint64_t spread = uint64_t(hash) * 0x9e3779b97f4a7c15ULL;
+    int frequency = 0xf;
+    for (int i = 0; i < 4; i++) {
+        const size_t index = _counter_index(spread, i);
+        const int shift = int(index & 15) << 2;
+        frequency = std::min(frequency, int((_table[index >> 4] >> shift) & 0xfULL));
+    }
+    return frequency;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& word : _table) {
+        word = (word >> 1) & 0x7777777777777777ULL;
+    }
+    _additions /= 2;
+}
+
 LRUCache::LRUCache(LRUCacheType type, bool is_lru_k) : _type(type), _is_lru_k(is_lru_k) {
     // Make empty circular linked list
     _lru_normal.next = &_lru_normal;
@@ -215,6 +274,11 @@ uint64_t LRUCache::get_stampede_count() {
     return _stampede_count;
 }
 
+uint64_t LRUCache::get_admission_reject_count() {
+    std::lock_guard l(_mutex);
+    return _admission_reject_count;
+}
+
 uint64_t LRUCache::get_miss_count() {
     std::lock_guard l(_mutex);
     return _miss_count;
@@ -235,10 +299,26 @@ size_t LRUCache::get_element_count() {
     return _table.element_count();
 }
 
+bool LRUCache::set_clock_read(bool is_clock) {
+    std::lock_guard l(_mutex);
+    // The frequency sketch is updated by every lookup, and the timestamp sorted entries
+    // exclude the entries in use, both need the exclusive lock in lookup.
+    if (is_clock && (_is_tiny_lfu || _cache_value_check_timestamp)) {
+        return false;
+    }
+    DCHECK_EQ(_table.element_count(), 0);
+    _is_clock = is_clock;
+    return true;
+}
+
 bool LRUCache::_unref(LRUHandle* e) {
-    DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    DCHECK(__atomic_load_n(&e->refs, __ATOMIC_RELAXED) > 0);
+    return __atomic_sub_fetch(&e->refs, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+bool LRUCache::_evictable(const LRUHandle* e) const {
+    // Without CLOCK, the LRU list only contains the entries not in use.
+    return !_is_clock || __atomic_load_n(&e->refs, __ATOMIC_ACQUIRE) == 1;
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
@@ -289,7 +369,41 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
     }
 }
 
+Cache::Handle* LRUCache::_clock_lookup(const CacheKey& key, uint32_t hash) {
+    LRUHandle* e = nullptr;
+    {
+        std::shared_lock l(_mutex);
+        ++_lookup_count;
+        e = _table.lookup(key, hash);
+        if (e != nullptr) {
+            DCHECK(e->in_cache);
+            // The entry can not be evicted while the lock is held, so its reference of the
+            // cache is not dropped concurrently, but the other references may be.
+            __atomic_add_fetch(&e->refs, 1, __ATOMIC_RELAXED);
+            __atomic_store_n(&e->visited, true, __ATOMIC_RELAXED);
+            __atomic_store_n(&e->last_visit_time, UnixMillis(), __ATOMIC_RELAXED);
+            ++_hit_count;
+        } else {
+            ++_miss_count;
+        }
+    }
+
+    // A miss is usually followed by an insert, which takes the lock exclusively anyway.
+    if (e == nullptr && _is_lru_k) {
+        std::lock_guard l(_mutex);
+        auto it = _visits_lru_cache_map.find(hash);
+        if (it != _visits_lru_cache_map.end()) {
+            _visits_lru_cache_list.splice(_visits_lru_cache_list.begin(), _visits_lru_cache_list,
+                                          it->second);
+        }
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
+    if (_is_clock) {
+        return _clock_lookup(key, hash);
+    }
     std::lock_guard l(_mutex);
     ++_lookup_count;
     LRUHandle* e = _table.lookup(key, hash);
@@ -317,6 +431,11 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
                                           it->second);
         }
     }
+
+    if (_is_tiny_lfu) {
+        _frequency_sketch.ensure_capacity(_table.element_count());
+        _frequency_sketch.increment(hash);
+    }
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
@@ -325,6 +444,14 @@ void LRUCache::release(Cache::Handle* handle) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_is_clock) {
+        // The entry stays in the LRU list while it is in the cache, the cache holds a
+        // reference of it, so the last reference is only dropped after it is removed.
+        if (_unref(e)) {
+            e->free();
+        }
+        return;
+    }
     bool last_ref = false;
     {
         std::lock_guard l(_mutex);
@@ -386,7 +513,33 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
     }
 }
 
+void LRUCache::_evict_from_clock(LRUHandle* list, size_t total_size,
+                                 LRUHandle** to_remove_head) {
+    // Each entry is moved at most once when all entries are visited, and twice when they are
+    // in use, then the cache is over capacity until some of them are released.
+    size_t max_steps = 2 * size_t(_table.element_count());
+    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
+           list->next != list && max_steps-- > 0) {
+        LRUHandle* e = list->next;
+        // The lookups are excluded by the lock, only the reference count may change.
+        if (!_evictable(e) || e->visited) {
+            e->visited = false;
+            _lru_remove(e);
+            _lru_append(list, e);
+            continue;
+        }
+        _evict_one_entry(e);
+        e->next = *to_remove_head;
+        *to_remove_head = e;
+    }
+}
+
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
+    if (_is_clock) {
+        _evict_from_clock(&_lru_normal, total_size, to_remove_head);
+        _evict_from_clock(&_lru_durable, total_size, to_remove_head);
+        return;
+    }
     // 1. evict normal cache entries
     while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
            _lru_normal.next != &_lru_normal) {
@@ -414,16 +567,32 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
     bool removed = _table.remove(e);
     DCHECK(removed);
     e->in_cache = false;
-    _unref(e);
     // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
     // see the comment for old entry in `LRUCache::insert`.
     _usage -= e->total_size;
+    _unref(e);
 }
 
 bool LRUCache::_check_element_count_limit() {
     return _element_count_capacity != 0 && _table.element_count() >= _element_count_capacity;
 }
 
+// After cache is full, return true if the new entry is not more frequent than the least
+// recently used normal entry, which would be evicted first for it. An entry only accessed once,
+// e.g. a page read by a large scan, is rejected, and does not evict the frequently used entries.
+bool LRUCache::_tiny_lfu_reject(size_t total_size, uint32_t hash) {
+    _frequency_sketch.ensure_capacity(_table.element_count());
+    _frequency_sketch.increment(hash);
+    if (_usage + total_size <= _capacity && !_check_element_count_limit()) {
+        return false;
+    }
+    if (_lru_normal.next == &_lru_normal) {
+        // All normal entries are in use, nothing to be evicted for the new entry.
+        return false;
+    }
+    return _frequency_sketch.frequency(hash) <= _frequency_sketch.frequency(_lru_normal.next->hash);
+}
+
 // After cache is full,
 // 1.Return false. If key has been inserted into the visits list before,
 // key is allowed to be inserted into cache this time (this will trigger cache evict),
@@ -474,6 +643,7 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 1; // only one for the returned handle.
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->visited = false;
     e->priority = priority;
     e->type = _type;
     memcpy(e->key_data, key.data(), key.size());
@@ -487,6 +657,12 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             return reinterpret_cast<Cache::Handle*>(e);
         }
 
+        if (_is_tiny_lfu && priority == CachePriority::NORMAL &&
+            _tiny_lfu_reject(e->total_size, hash)) {
+            ++_admission_reject_count;
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+
         // Free the space following strict LRU policy until enough space
         // is freed or the lru list is empty
         if (_cache_value_check_timestamp) {
@@ -502,8 +678,16 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         e->in_cache = true;
         _usage += e->total_size;
         e->refs++; // one for the returned handle, one for LRUCache.
+        if (_is_clock) {
+            _lru_append(e->priority == CachePriority::NORMAL ? &_lru_normal : &_lru_durable, e);
+        }
         if (old != nullptr) {
             _stampede_count++;
+            if (_is_clock) {
+                // Must be removed before the reference of the cache is dropped, the handle
+                // may be freed by a concurrent release after that.
+                _lru_remove(old);
+            }
             old->in_cache = false;
             // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
             // Whether the reference of the old entry is 0, the cache usage is subtracted here,
@@ -516,7 +700,9 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
             if (_unref(old)) {
                 // old is on LRU because it's in cache and its reference count
                 // was just 1 (Unref returned 0)
-                _lru_remove(old);
+                if (!_is_clock) {
+                    _lru_remove(old);
+                }
                 old->next = to_remove_head;
                 to_remove_head = old;
             }
@@ -541,16 +727,25 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
-            last_ref = _unref(e);
-            // if last_ref is false or in_cache is false, e must not be in lru
-            if (last_ref && e->in_cache) {
-                // locate in free list
+            if (_is_clock) {
+                // e is in lru while it is in the cache, and may be freed by a concurrent
+                // release after the reference of the cache is dropped.
                 _lru_remove(e);
+                e->in_cache = false;
+                _usage -= e->total_size;
+                last_ref = _unref(e);
+            } else {
+                last_ref = _unref(e);
+                // if last_ref is false or in_cache is false, e must not be in lru
+                if (last_ref && e->in_cache) {
+                    // locate in free list
+                    _lru_remove(e);
+                }
+                e->in_cache = false;
+                // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
+                // see the comment for old entry in `LRUCache::insert`.
+                _usage -= e->total_size;
             }
-            e->in_cache = false;
-            // `entry->in_cache = false` and `_usage -= entry->total_size;` and `_unref(entry)` should appear together.
-            // see the comment for old entry in `LRUCache::insert`.
-            _usage -= e->total_size;
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -563,17 +758,17 @@ PrunedInfo LRUCache::prune() {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
+        for (LRUHandle* list : {&_lru_normal, &_lru_durable}) {
+            LRUHandle* p = list->next;
+            while (p != list) {
+                LRUHandle* next = p->next;
+                if (_evictable(p)) {
+                    _evict_one_entry(p);
+                    p->next = to_remove_head;
+                    to_remove_head = p;
+                }
+                p = next;
+            }
         }
     }
     int64_t pruned_count = 0;
@@ -595,7 +790,9 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
         LRUHandle* p = _lru_normal.next;
         while (p != &_lru_normal) {
             LRUHandle* next = p->next;
-            if (pred(p)) {
+            if (!_evictable(p)) {
+                // in use, only with CLOCK.
+            } else if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
                 to_remove_head = p;
@@ -608,7 +805,9 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
         p = _lru_durable.next;
         while (p != &_lru_durable) {
             LRUHandle* next = p->next;
-            if (pred(p)) {
+            if (!_evictable(p)) {
+                // in use, only with CLOCK.
+            } else if (pred(p)) {
                 _evict_one_entry(p);
                 p->next = to_remove_head;
                 to_remove_head = p;
@@ -676,6 +875,7 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
     INT_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_stampede_count);
     INT_COUNTER_METRIC_REGISTER(_entity, cache_miss_count);
+    INT_COUNTER_METRIC_REGISTER(_entity, cache_admission_reject_count);
     DOUBLE_GAUGE_METRIC_REGISTER(_entity, cache_hit_ratio);
 
     _hit_count_bvar.reset(new bvar::Adder<uint64_t>("doris_cache", _name));
@@ -699,6 +899,21 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t capacity, LRUCa
     }
 }
 
+void ShardedLRUCache::set_tiny_lfu_admission(bool is_tiny_lfu) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_tiny_lfu_admission(is_tiny_lfu);
+    }
+}
+
+bool ShardedLRUCache::set_clock_read(bool is_clock) {
+    for (int s = 0; s < _num_shards; s++) {
+        if (!_shards[s]->set_clock_read(is_clock)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ShardedLRUCache::~ShardedLRUCache() {
     _entity->deregister_hook(_name);
     DorisMetrics::instance()->metric_registry()->deregister_entity(_entity);
@@ -801,6 +1016,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_element_count = 0;
     size_t total_miss_count = 0;
     size_t total_stampede_count = 0;
+    size_t total_admission_reject_count = 0;
 
     for (int i = 0; i < _num_shards; i++) {
         capacity += _shards[i]->get_capacity();
@@ -810,6 +1026,7 @@ void ShardedLRUCache::update_cache_metrics() const {
         total_element_count += _shards[i]->get_element_count();
         total_miss_count += _shards[i]->get_miss_count();
         total_stampede_count += _shards[i]->get_stampede_count();
+        total_admission_reject_count += _shards[i]->get_admission_reject_count();
     }
 
     cache_capacity->set_value(capacity);
@@ -819,6 +1036,7 @@ void ShardedLRUCache::update_cache_metrics() const {
     cache_hit_count->set_value(total_hit_count);
     cache_miss_count->set_value(total_miss_count);
     cache_stampede_count->set_value(total_stampede_count);
+    cache_admission_reject_count->set_value(total_admission_reject_count);
     cache_usage_ratio->set_value(
             capacity == 0 ? 0 : (static_cast<double>(total_usage) / static_cast<double>(capacity)));
     cache_hit_ratio->set_value(total_lookup_count == 0 ? 0
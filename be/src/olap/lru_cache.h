@@ -17,11 +17,14 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "runtime/memory/lru_cache_value_base.h"
 #include "util/doris_metrics.h"
+#include "util/instrumented_mutex.h"
 #include "util/metrics.h"
 
 namespace doris {
@@ -231,6 +234,8 @@ struct LRUHandle {
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
     bool in_cache; // Whether entry is in the cache.
+    bool visited;  // Whether entry is looked up since the last CLOCK sweep, only used by CLOCK.
+    // Modified by atomic builtins, the CLOCK read path releases the handle without the lock.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -305,6 +310,30 @@ private:
 // because the begin element's timestamp is the oldest.
 using LRUHandleSortedSet = std::set<std::pair<int64_t, LRUHandle*>>;
 
+// Estimates the access frequency of the cache keys for the TinyLFU admission, a count-min
+// sketch of 4-bit counters, 16 counters packed in a uint64_t. All counters are halved after
+// the number of increments reaches 10 times the number of counters, so that the frequency
+// of the keys not accessed recently decays.
+class FrequencySketch {
+public:
+    // Grows the sketch to count about `element_count` keys accurately. The counters are
+    // reset when the sketch grows.
+    void ensure_capacity(size_t element_count);
+    void increment(uint32_t hash);
+    // The estimated frequency of the hash, at most 15.
+    int frequency(uint32_t hash) const;
+
+private:
+    size_t _counter_index(uint64_t spread, int i) const;
+    void _reset();
+
+    static constexpr size_t MAX_TABLE_SIZE = 1 << 20;
+
+    std::vector<uint64_t> _table;
+    size_t _sample_size = 0;
+    size_t _additions = 0;
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -323,6 +352,9 @@ public:
     void set_element_count_capacity(uint32_t element_count_capacity) {
         _element_count_capacity = element_count_capacity;
     }
+    void set_tiny_lfu_admission(bool is_tiny_lfu) { _is_tiny_lfu = is_tiny_lfu; }
+    // Returns false if CLOCK can not be used with the other options of the cache.
+    bool set_clock_read(bool is_clock);
 
     // Like Cache methods, but with an extra "hash" parameter.
     // Must call release on the returned handle pointer.
@@ -341,6 +373,7 @@ public:
     uint64_t get_hit_count();
     uint64_t get_miss_count();
     uint64_t get_stampede_count();
+    uint64_t get_admission_reject_count();
 
     size_t get_usage();
     size_t get_capacity();
@@ -351,10 +384,14 @@ private:
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
     void _evict_from_lru(size_t total_size, LRUHandle** to_remove_head);
+    void _evict_from_clock(LRUHandle* list, size_t total_size, LRUHandle** to_remove_head);
+    bool _evictable(const LRUHandle* e) const;
+    Cache::Handle* _clock_lookup(const CacheKey& key, uint32_t hash);
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
     bool _lru_k_insert_visits_list(size_t total_size, visits_lru_cache_key visits_key);
+    bool _tiny_lfu_reject(size_t total_size, uint32_t hash);
 
 private:
     LRUCacheType _type;
@@ -362,8 +399,8 @@ private:
     // Initialized before use.
     size_t _capacity = 0;
 
-    // _mutex protects the following state.
-    std::mutex _mutex;
+    // _mutex protects the following state. Only the CLOCK lookup takes it shared.
+    InstrumentedSharedMutex _mutex {"lru_cache_shard"};
     size_t _usage = 0;
 
     // Dummy head of LRU list.
@@ -375,9 +412,9 @@ private:
 
     HandleTable _table;
 
-    uint64_t _lookup_count = 0; // number of cache lookups
-    uint64_t _hit_count = 0;    // number of cache hits
-    uint64_t _miss_count = 0;   // number of cache misses
+    std::atomic<uint64_t> _lookup_count = 0; // number of cache lookups
+    std::atomic<uint64_t> _hit_count = 0;    // number of cache hits
+    std::atomic<uint64_t> _miss_count = 0;   // number of cache misses
     uint64_t _stampede_count = 0;
 
     CacheValueTimeExtractor _cache_value_time_extractor;
@@ -392,6 +429,18 @@ private:
     std::unordered_map<visits_lru_cache_key, std::list<visits_lru_cache_pair>::iterator>
             _visits_lru_cache_map;
     size_t _visits_lru_cache_usage = 0;
+
+    // TinyLFU admission, after the cache is full, a new normal entry is inserted only if
+    // it is more frequent than the least recently used normal entry.
+    bool _is_tiny_lfu = false;
+    FrequencySketch _frequency_sketch;
+    uint64_t _admission_reject_count = 0;
+
+    // CLOCK, the lookup only takes _mutex shared and marks the entry visited instead of
+    // moving it in the LRU list, the release does not take _mutex. The entries stay in the
+    // LRU list while they are in use, and the eviction gives the visited or in-use entries at
+    // the head of the list a second chance by moving them to the tail.
+    bool _is_clock = false;
 };
 
 class ShardedLRUCache : public Cache {
@@ -423,6 +472,9 @@ private:
                              bool cache_value_check_timestamp, uint32_t element_count_capacity,
                              bool is_lru_k);
 
+    void set_tiny_lfu_admission(bool is_tiny_lfu);
+    bool set_clock_read(bool is_clock);
+
     void update_cache_metrics() const;
 
 private:
@@ -448,6 +500,7 @@ private:
     IntCounter* cache_hit_count = nullptr;
     IntCounter* cache_miss_count = nullptr;
     IntCounter* cache_stampede_count = nullptr;
+    IntCounter* cache_admission_reject_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
     // bvars
     std::unique_ptr<bvar::Adder<uint64_t>> _hit_count_bvar;
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "bvar/bvar.h"
@@ -40,12 +41,106 @@
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 
 bvar::Adder<int64_t> g_memtable_cnt("memtable_cnt");
 
+namespace {
+
+// The value of a key column in a row as an order preserving unsigned integer, so the rows are
+// sorted by comparing integers instead of calling IColumn::compare_at for every pair of them.
+struct NormalizedKey {
+    // null is less than any value, as compare_at with nan_direction_hint -1.
+    uint8_t not_null;
+    uint64_t value;
+    // index of the row in the range to sort
+    uint32_t index;
+
+    // the index keeps the order of the equal rows
+    bool operator<(const NormalizedKey& rhs) const {
+        return std::tie(not_null, value, index) < std::tie(rhs.not_null, rhs.value, rhs.index);
+    }
+    bool operator==(const NormalizedKey& rhs) const {
+        return not_null == rhs.not_null && value == rhs.value;
+    }
+};
+
+template <typename T>
+uint64_t normalize_key(T value) {
+    if constexpr (std::is_signed_v<T>) {
+        // flip the sign bit, so negative values are less than positive ones
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t(1) << 63);
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template <typename ColumnType>
+void sort_by_normalized_key(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks, Tie& tie,
+                            const ColumnType& column, const uint8_t* null_map) {
+    const auto& data = column.get_data();
+    std::vector<NormalizedKey> keys;
+    DorisVector<std::shared_ptr<RowInBlock>> sorted_rows;
+    auto iter = tie.iter();
+    while (iter.next()) {
+        keys.clear();
+        for (size_t i = iter.left(); i < iter.right(); i++) {
+            const size_t pos = row_in_blocks[i]->_row_pos;
+            const bool is_null = null_map != nullptr && null_map[pos];
+            const uint64_t value = is_null ? 0 : normalize_key(data[pos]);
+            keys.push_back({static_cast<uint8_t>(!is_null), value,
+                            static_cast<uint32_t>(i - iter.left())});
+        }
+        pdqsort(keys.begin(), keys.end());
+
+        auto begin = std::next(row_in_blocks.begin(), iter.left());
+        sorted_rows.clear();
+        for (const auto& key : keys) {
+            sorted_rows.push_back(std::move(*std::next(begin, key.index)));
+        }
+        std::move(sorted_rows.begin(), sorted_rows.end(), begin);
+
+        tie[iter.left()] = 0;
+        for (size_t i = 1; i < keys.size(); i++) {
+            tie[iter.left() + i] = keys[i - 1] == keys[i];
+        }
+    }
+}
+
+template <typename... ColumnTypes>
+bool try_sort_by_normalized_key(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks,
+                                Tie& tie, const vectorized::IColumn& column) {
+    const vectorized::IColumn* nested_column = &column;
+    const uint8_t* null_map = nullptr;
+    if (const auto* nullable_column = check_and_get_column<vectorized::ColumnNullable>(column)) {
+        nested_column = &nullable_column->get_nested_column();
+        null_map = nullable_column->get_null_map_data().data();
+    }
+    return ([&] {
+        const auto* typed_column = check_and_get_column<ColumnTypes>(nested_column);
+        if (typed_column == nullptr) {
+            return false;
+        }
+        sort_by_normalized_key(row_in_blocks, tie, *typed_column, null_map);
+        return true;
+    }() || ...);
+}
+
+} // namespace
+
+bool sort_one_column_by_normalized_key(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks,
+                                       Tie& tie, const vectorized::IColumn& column) {
+    return try_sort_by_normalized_key<
+            vectorized::ColumnUInt8, vectorized::ColumnInt8, vectorized::ColumnInt16,
+            vectorized::ColumnInt32, vectorized::ColumnInt64, vectorized::ColumnDate,
+            vectorized::ColumnDateTime, vectorized::ColumnDateV2, vectorized::ColumnDateTimeV2,
+            vectorized::ColumnIPv4>(row_in_blocks, tie, column);
+}
+
 using namespace ErrorCode;
 
 MemTable::MemTable(int64_t tablet_id, std::shared_ptr<TabletSchema> tablet_schema,
@@ -236,8 +331,13 @@ Status MemTable::insert(const vectorized::Block* input_block,
     size_t cursor_in_mutableblock = _input_mutable_block.rows();
     RETURN_IF_ERROR(_input_mutable_block.add_rows(input_block, row_idxs.data(),
                                                   row_idxs.data() + num_rows, &_column_offset));
-    for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
+    if (_keys_type == KeysType::AGG_KEYS && config::enable_memtable_hash_aggregation) {
+        RETURN_IF_CATCH_EXCEPTION(
+                _insert_with_hash_aggregation(input_block, row_idxs, cursor_in_mutableblock));
+    } else {
+        for (int i = 0; i < num_rows; i++) {
+            _row_in_blocks->emplace_back(std::make_shared<RowInBlock>(cursor_in_mutableblock + i));
+        }
     }
 
     _stat.raw_rows += num_rows;
@@ -290,6 +390,33 @@ void MemTable::_aggregate_two_row_in_block(vectorized::MutableBlock& mutable_blo
         }
     }
 }
+void MemTable::_insert_with_hash_aggregation(const vectorized::Block* input_block,
+                                             const DorisVector<uint32_t>& row_idxs,
+                                             size_t cursor_in_mutableblock) {
+    // the comparator is set to a temporary block when the memtable is aggregated
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    for (size_t i = 0; i < row_idxs.size(); i++) {
+        uint64_t hash = 0;
+        for (size_t cid = 0; cid < _tablet_schema->num_key_columns(); ++cid) {
+            const auto& column = input_block->get_by_position(_column_offset[cid]).column;
+            column->update_xxHash_with_value(row_idxs[i], row_idxs[i] + 1, hash, nullptr);
+        }
+        auto row = std::make_shared<RowInBlock>(cursor_in_mutableblock + i);
+        auto [it, inserted] = _key_hash_to_row.try_emplace(hash, row.get());
+        // the rows of a hash collision are merged when the memtable is aggregated
+        if (!inserted && (*_vec_row_comparator)(it->second, row.get()) == 0) {
+            if (!it->second->has_init_agg()) {
+                _init_row_for_agg(it->second, _input_mutable_block);
+            }
+            _aggregate_two_row_in_block<false>(_input_mutable_block, row.get(), it->second);
+            _stat.merged_rows++;
+            _has_hash_aggregated_rows = true;
+            continue;
+        }
+        _row_in_blocks->push_back(std::move(row));
+    }
+}
+
 Status MemTable::_put_into_output(vectorized::Block& in_block) {
     SCOPED_RAW_TIMER(&_stat.put_into_output_ns);
     DorisVector<uint32_t> row_pos_vec;
@@ -309,6 +436,10 @@ size_t MemTable::_sort() {
     // sort new rows
     Tie tie = Tie(_last_sorted_pos, _row_in_blocks->size());
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+        if (sort_one_column_by_normalized_key(*_row_in_blocks, tie,
+                                              *_input_mutable_block.get_column_by_position(i))) {
+            continue;
+        }
         auto cmp = [&](RowInBlock* lhs, RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
         };
@@ -367,6 +498,10 @@ Status MemTable::_sort_by_cluster_keys() {
             return Status::InternalError("could not find cluster key column with unique_id=" +
                                          std::to_string(cid) + " in tablet schema");
         }
+        if (sort_one_column_by_normalized_key(row_in_blocks, tie,
+                                              *mutable_block.get_column_by_position(index))) {
+            continue;
+        }
         auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
             return mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, index, -1);
         };
@@ -404,7 +539,9 @@ void MemTable::_sort_one_column(DorisVector<std::shared_ptr<RowInBlock>>& row_in
     while (iter.next()) {
         pdqsort(std::next(row_in_blocks.begin(), static_cast<int>(iter.left())),
                 std::next(row_in_blocks.begin(), static_cast<int>(iter.right())),
-                [&cmp](auto lhs, auto rhs) -> bool { return cmp(lhs.get(), rhs.get()) < 0; });
+                [&cmp](const auto& lhs, const auto& rhs) -> bool {
+                    return cmp(lhs.get(), rhs.get()) < 0;
+                });
         tie[iter.left()] = 0;
         for (auto i = iter.left() + 1; i < iter.right(); i++) {
             tie[i] = (cmp(row_in_blocks[i - 1].get(), row_in_blocks[i].get()) == 0);
@@ -504,7 +641,18 @@ void MemTable::_aggregate() {
                     _init_row_for_agg(prev_row, mutable_block);
                 }
                 _stat.merged_rows++;
-                _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row, prev_row);
+                if (_keys_type == KeysType::AGG_KEYS && cur_row->has_init_agg()) {
+                    // the row has combined other rows when they were inserted
+                    for (size_t cid = _tablet_schema->num_key_columns(); cid < _num_columns;
+                         ++cid) {
+                        _agg_functions[cid]->merge(prev_row->agg_places(cid),
+                                                   cur_row->agg_places(cid), _arena);
+                    }
+                    _clear_row_agg(cur_row);
+                } else {
+                    _aggregate_two_row_in_block<has_skip_bitmap_col>(mutable_block, cur_row,
+                                                                     prev_row);
+                }
             } else {
                 prev_row = cur_row;
                 if (!temp_row_in_blocks.empty()) {
@@ -530,6 +678,9 @@ void MemTable::_aggregate() {
                                                                           temp_row_in_blocks);
         }
     }
+    // the rows of the map may be merged into others, and are at other positions
+    _key_hash_to_row.clear();
+    _has_hash_aggregated_rows = false;
     if constexpr (!is_final) {
         // if is not final, we collect the agg results to input_block and then continue to insert
         _input_mutable_block.swap(_output_mutable_block);
@@ -644,7 +795,7 @@ void MemTable::shrink_memtable_by_agg() {
         return;
     }
     size_t same_keys_num = _sort();
-    if (same_keys_num != 0) {
+    if (same_keys_num != 0 || _has_hash_aggregated_rows) {
         (_skip_bitmap_col_idx == -1) ? _aggregate<false, false>() : _aggregate<false, true>();
     }
 }
@@ -670,15 +821,28 @@ bool MemTable::need_agg() const {
 }
 
 size_t MemTable::get_flush_reserve_memory_size() const {
+    auto allocated_bytes = static_cast<double>(_input_mutable_block.allocated_bytes());
+    // The pages of the value columns encoded in parallel are held until they are written in
+    // column order, see VerticalSegmentWriter::write_batch.
+    double encode_bytes = 0;
+    auto num_columns = _tablet_schema->num_columns();
+    if (config::flush_column_encode_parallelism > 1 && num_columns > 0 &&
+        (num_columns >= static_cast<size_t>(std::max(config::flush_column_encode_min_columns, 0)) ||
+         _tablet_schema->has_inverted_index())) {
+        auto parallelism =
+                std::min(static_cast<size_t>(config::flush_column_encode_parallelism), num_columns);
+        encode_bytes = allocated_bytes * static_cast<double>(parallelism) /
+                       static_cast<double>(num_columns);
+    }
     if (_keys_type == KeysType::DUP_KEYS && _tablet_schema->num_key_columns() == 0) {
-        return 0; // no need to reserve
+        return static_cast<size_t>(encode_bytes); // no need to reserve for sorting
     }
-    return static_cast<size_t>(static_cast<double>(_input_mutable_block.allocated_bytes()) * 1.2);
+    return static_cast<size_t>(allocated_bytes * 1.2 + encode_bytes);
 }
 
 Status MemTable::_to_block(std::unique_ptr<vectorized::Block>* res) {
     size_t same_keys_num = _sort();
-    if (_keys_type == KeysType::DUP_KEYS || same_keys_num == 0) {
+    if (_keys_type == KeysType::DUP_KEYS || (same_keys_num == 0 && !_has_hash_aggregated_rows)) {
         if (_keys_type == KeysType::DUP_KEYS && _tablet_schema->num_key_columns() == 0) {
             _output_mutable_block.swap(_input_mutable_block);
         } else {
@@ -23,6 +23,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <parallel_hashmap/phmap.h>
 #include <vector>
 
 #include "common/status.h"
@@ -128,6 +129,12 @@ private:
     std::vector<uint8_t> _bits;
 };
 
+// Sorts the tied ranges of rows by an integer key column, comparing the values as order
+// preserving unsigned integers, and updates the tie. Returns false and does nothing if the
+// column is not an integer column.
+bool sort_one_column_by_normalized_key(DorisVector<std::shared_ptr<RowInBlock>>& row_in_blocks,
+                                       Tie& tie, const vectorized::IColumn& column);
+
 class RowInBlockComparator {
 public:
     RowInBlockComparator(std::shared_ptr<TabletSchema> tablet_schema)
@@ -273,6 +280,9 @@ private:
             DorisVector<std::shared_ptr<RowInBlock>>& temp_row_in_blocks);
 
     Status _put_into_output(vectorized::Block& in_block);
+    void _insert_with_hash_aggregation(const vectorized::Block* input_block,
+                                       const DorisVector<uint32_t>& row_idxs,
+                                       size_t cursor_in_mutableblock);
     bool _is_first_insertion;
 
     void _init_agg_functions(const vectorized::Block* block);
@@ -280,6 +290,12 @@ private:
     std::vector<size_t> _offsets_of_aggregate_states;
     size_t _total_size_of_aggregate_states;
     std::unique_ptr<DorisVector<std::shared_ptr<RowInBlock>>> _row_in_blocks;
+    // For aggregate key tables, the hash of the keys to the row the later rows of the same keys
+    // are combined into. Cleared when the memtable is aggregated.
+    phmap::flat_hash_map<uint64_t, RowInBlock*> _key_hash_to_row;
+    // Whether some rows are combined since the memtable was aggregated, the rows must be
+    // aggregated again to get the combined values even if there are no same keys to merge.
+    bool _has_hash_aggregated_rows = false;
 
     size_t _num_columns;
     int32_t _seq_col_idx_in_block {-1};
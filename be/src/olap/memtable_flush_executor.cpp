@@ -313,6 +313,11 @@ void MemTableFlushExecutor::init(int num_disk) {
                               .set_min_threads(min_threads)
                               .set_max_threads(max_threads)
                               .build(&_high_prio_flush_pool));
+
+    static_cast<void>(ThreadPoolBuilder("MemTableColumnEncodeThreadPool")
+                              .set_min_threads(1)
+                              .set_max_threads(std::max(1, num_cpus))
+                              .build(&_column_encode_pool));
 }
 
 // NOTE: we use SERIAL mode here to ensure all mem-tables from one tablet are flushed in order.
@@ -135,6 +135,7 @@ public:
     ~MemTableFlushExecutor() {
         _flush_pool->shutdown();
         _high_prio_flush_pool->shutdown();
+        _column_encode_pool->shutdown();
     }
 
     // init should be called after storage engine is opened,
@@ -163,9 +164,14 @@ public:
 
     ThreadPool* flush_pool() { return _flush_pool.get(); }
 
+    // The value columns of a segment are encoded in parallel by this pool when a memtable is
+    // flushed, it is separated from the flush pools so a flush task never waits for itself.
+    ThreadPool* column_encode_pool() { return _column_encode_pool.get(); }
+
 private:
     std::unique_ptr<ThreadPool> _flush_pool;
     std::unique_ptr<ThreadPool> _high_prio_flush_pool;
+    std::unique_ptr<ThreadPool> _column_encode_pool;
     std::atomic<int> _flushing_task_count = 0;
 };
 
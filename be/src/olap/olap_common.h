@@ -360,6 +360,12 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // the bytes of the pages found in the page cache
+    int64_t cached_pages_bytes = 0;
+    // the pages read ahead by the page prefetcher and found in the page cache
+    int64_t page_prefetch_hit_num = 0;
+    // the pages not found in the page cache while page prefetch is enabled
+    int64_t page_prefetch_miss_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
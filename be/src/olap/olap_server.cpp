@@ -345,6 +345,11 @@ Status StorageEngine::start_bg_threads(std::shared_ptr<WorkloadGroup> wg_sptr) {
                             .set_max_threads(config::tablet_publish_txn_max_thread)
                             .build(&_tablet_publish_txn_thread_pool));
 
+    // add clone download thread pool
+    RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownloadThreadPool")
+                            .set_max_threads(config::clone_download_thread_num)
+                            .build(&_clone_download_thread_pool));
+
     RETURN_IF_ERROR(Thread::create(
             "StorageEngine", "async_publish_version_thread",
             [this]() { this->_async_publish_callback(); }, &_async_publish_thread));
@@ -1254,22 +1259,23 @@ Status StorageEngine::submit_compaction_task(TabletSharedPtr tablet, CompactionT
 }
 
 Status StorageEngine::_handle_seg_compaction(std::shared_ptr<SegcompactionWorker> worker,
-                                             SegCompactionCandidatesSharedPtr segments,
+                                             SegCompactionGroups groups,
                                              uint64_t submission_time) {
     // note: be aware that worker->_writer maybe released when the task is cancelled
     uint64_t exec_queue_time = GetCurrentTimeMicros() - submission_time;
     LOG(INFO) << "segcompaction thread pool queue time(ms): " << exec_queue_time / 1000;
-    worker->compact_segments(segments);
+    worker->compact_segments(std::move(groups));
     // return OK here. error will be reported via BetaRowsetWriter::_segcompaction_status
     return Status::OK();
 }
 
 Status StorageEngine::submit_seg_compaction_task(std::shared_ptr<SegcompactionWorker> worker,
-                                                 SegCompactionCandidatesSharedPtr segments) {
+                                                 SegCompactionGroups groups) {
     uint64_t submission_time = GetCurrentTimeMicros();
-    return _seg_compaction_thread_pool->submit_func([this, worker, segments, submission_time] {
-        static_cast<void>(_handle_seg_compaction(worker, segments, submission_time));
-    });
+    return _seg_compaction_thread_pool->submit_func(
+            [this, worker, groups = std::move(groups), submission_time] {
+                static_cast<void>(_handle_seg_compaction(worker, groups, submission_time));
+            });
 }
 
 Status StorageEngine::process_index_change_task(const TAlterInvertedIndexReq& request) {
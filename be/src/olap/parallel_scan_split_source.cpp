@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/parallel_scan_split_source.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "common/config.h"
+#include "common/logging.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+ParallelScanSplitSource::ParallelScanSplitSource(
+        std::vector<RowsetReaderSharedPtr> rs_readers,
+        std::vector<RowsetMetaSharedPtr> delete_predicates, std::vector<Unit> units,
+        size_t num_scanners, size_t min_split_rows, size_t max_split_rows)
+        : _rs_readers(std::move(rs_readers)),
+          _delete_predicates(std::move(delete_predicates)),
+          _units(std::move(units)),
+          _num_scanners(std::max<size_t>(num_scanners, 1)),
+          _min_split_rows(std::max<size_t>(min_split_rows, 1)),
+          _max_split_rows(std::max(max_split_rows, _min_split_rows)) {
+    for (const auto& unit : _units) {
+        DCHECK_LT(unit.rs_index, _rs_readers.size());
+        DCHECK_LT(unit.from, unit.to);
+        _remaining_rows += static_cast<size_t>(unit.to - unit.from);
+    }
+}
+
+size_t ParallelScanSplitSource::_split_rows_target() const {
+    // The first splits cover about half of the rows.
+    size_t target = _max_split_rows / 2;
+    if (_finished_scan_ns > 0) {
+        double rows_per_ns =
+                static_cast<double>(_finished_rows) / static_cast<double>(_finished_scan_ns);
+        double rows = rows_per_ns * config::parallel_scan_split_target_ms * 1000 * 1000;
+        target = static_cast<size_t>(std::min(rows, static_cast<double>(_max_split_rows)));
+    }
+    // The rows left are shared by the scanners, so they end at about the same time.
+    target = std::min(target, _remaining_rows / _num_scanners);
+    return std::clamp(target, _min_split_rows, _max_split_rows);
+}
+
+bool ParallelScanSplitSource::next_split(TabletReader::ReadSource* read_source,
+                                         size_t* split_rows) {
+    std::lock_guard<std::mutex> l(_lock);
+    if (_next_unit == _units.size()) {
+        return false;
+    }
+    const size_t target = _split_rows_target();
+    read_source->rs_splits.clear();
+    read_source->delete_predicates = _delete_predicates;
+    size_t rows = 0;
+    size_t current_rs_index = _rs_readers.size();
+    while (_next_unit < _units.size() && rows < target) {
+        const Unit& unit = _units[_next_unit++];
+        if (unit.rs_index != current_rs_index) {
+            current_rs_index = unit.rs_index;
+            auto& new_split =
+                    read_source->rs_splits.emplace_back(_rs_readers[unit.rs_index]->clone());
+            new_split.segment_offsets = {unit.segment, unit.segment};
+        }
+        auto& split = read_source->rs_splits.back();
+        // The segments between the units have no rows to read.
+        while (split.segment_offsets.second <= unit.segment) {
+            split.segment_row_ranges.emplace_back();
+            split.segment_offsets.second++;
+        }
+        split.segment_row_ranges.back().add({unit.from, unit.to});
+        rows += static_cast<size_t>(unit.to - unit.from);
+    }
+    _remaining_rows -= rows;
+    *split_rows = rows;
+    return true;
+}
+
+void ParallelScanSplitSource::finish_split(size_t split_rows, int64_t scan_ns) {
+    std::lock_guard<std::mutex> l(_lock);
+    _finished_rows += split_rows;
+    _finished_scan_ns += scan_ns;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "olap/rowset/rowset_reader.h"
+#include "olap/tablet_reader.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// The rows of a tablet which are read by the scanners built by ParallelScannerBuilder.
+//
+// Instead of a fixed share of the tablet, a scanner takes a split of the rows left when it is
+// opened, and takes another one when the split is read. The splits are sized by the scan speed
+// of the finished splits, a split is scanned in about parallel_scan_split_target_ms, so the
+// splits of a selective scan, whose rows are mostly pruned by the zone maps, bloom filters or
+// short key index, are larger than the splits of a scan which reads and filters every row.
+// When few rows are left, they are shared by the scanners, so an idle scanner takes the rows a
+// slow scanner would read otherwise, and the scanners opened after all the rows are taken end
+// at once.
+class ParallelScanSplitSource {
+public:
+    // The rows [from, to) of a segment of a rowset.
+    struct Unit {
+        size_t rs_index;
+        int64_t segment;
+        int64_t from;
+        int64_t to;
+    };
+
+    // `units` are ordered by the rowset, segment and rows. A split has at least
+    // `min_split_rows` rows except the last one, and at most `max_split_rows` rows plus a unit.
+    ParallelScanSplitSource(std::vector<RowsetReaderSharedPtr> rs_readers,
+                            std::vector<RowsetMetaSharedPtr> delete_predicates,
+                            std::vector<Unit> units, size_t num_scanners, size_t min_split_rows,
+                            size_t max_split_rows);
+
+    // Takes the next split of rows, returns false if all the rows are taken.
+    bool next_split(TabletReader::ReadSource* read_source, size_t* split_rows);
+
+    // Called when a scanner finished reading a split, `scan_ns` is the time it spent on it.
+    void finish_split(size_t split_rows, int64_t scan_ns);
+
+    size_t remaining_rows() const {
+        std::lock_guard<std::mutex> l(_lock);
+        return _remaining_rows;
+    }
+
+private:
+    size_t _split_rows_target() const;
+
+    const std::vector<RowsetReaderSharedPtr> _rs_readers;
+    const std::vector<RowsetMetaSharedPtr> _delete_predicates;
+    const std::vector<Unit> _units;
+    const size_t _num_scanners;
+    const size_t _min_split_rows;
+    const size_t _max_split_rows;
+
+    mutable std::mutex _lock;
+    size_t _next_unit = 0;
+    size_t _remaining_rows = 0;
+    size_t _finished_rows = 0;
+    int64_t _finished_scan_ns = 0;
+};
+
+using ParallelScanSplitSourceSPtr = std::shared_ptr<ParallelScanSplitSource>;
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -22,6 +22,7 @@
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/segment_loader.h"
@@ -35,6 +36,9 @@ using namespace vectorized;
 Status ParallelScannerBuilder::build_scanners(std::list<ScannerSPtr>& scanners) {
     RETURN_IF_ERROR(_load());
     if (_is_dup_mow_key) {
+        if (config::enable_adaptive_parallel_scan_split) {
+            return _build_scanners_by_split_source(scanners);
+        }
         return _build_scanners_by_rowid(scanners);
     } else {
         // TODO: support to split by key range
@@ -159,6 +163,63 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<ScannerSPtr>&
     return Status::OK();
 }
 
+Status ParallelScannerBuilder::_build_scanners_by_split_source(std::list<ScannerSPtr>& scanners) {
+    DCHECK_GE(_rows_per_scanner, _min_rows_per_scanner);
+    // The rows of a segment are taken in units, a split has at least one unit.
+    const size_t unit_rows = std::max<size_t>(_min_rows_per_scanner / 8, 1024);
+
+    for (auto&& [tablet, version] : _tablets) {
+        DCHECK(_all_read_sources.contains(tablet->tablet_id()));
+        auto& entire_read_source = _all_read_sources[tablet->tablet_id()];
+
+        if (config::is_cloud_mode()) {
+            // FIXME(plat1ko): Avoid pointer cast
+            ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_hotspot().count(*tablet);
+        }
+
+        std::vector<RowsetReaderSharedPtr> rs_readers;
+        std::vector<ParallelScanSplitSource::Unit> units;
+        size_t tablet_rows = 0;
+        for (auto& rs_split : entire_read_source.rs_splits) {
+            auto rowset = rs_split.rs_reader->rowset();
+            if (rowset->num_rows() == 0) {
+                continue;
+            }
+            const auto& segments_rows = _all_segments_rows[rowset->rowset_id()];
+            for (size_t i = 0; i != segments_rows.size(); ++i) {
+                const auto rows_of_segment = static_cast<int64_t>(segments_rows[i]);
+                for (int64_t from = 0; from < rows_of_segment;) {
+                    auto to = std::min(from + static_cast<int64_t>(unit_rows), rows_of_segment);
+                    // Avoid a tiny unit at the end of the segment.
+                    if (static_cast<double>(rows_of_segment - to) < unit_rows * 0.1) {
+                        to = rows_of_segment;
+                    }
+                    units.push_back({rs_readers.size(), static_cast<int64_t>(i), from, to});
+                    from = to;
+                }
+                tablet_rows += segments_rows[i];
+            }
+            rs_readers.emplace_back(rs_split.rs_reader);
+        }
+        if (tablet_rows == 0) {
+            continue;
+        }
+
+        const size_t num_scanners = (tablet_rows + _rows_per_scanner - 1) / _rows_per_scanner;
+        auto split_source = std::make_shared<ParallelScanSplitSource>(
+                std::move(rs_readers), entire_read_source.delete_predicates, std::move(units),
+                num_scanners, unit_rows, _rows_per_scanner);
+        for (size_t i = 0; i != num_scanners; ++i) {
+            // The scanner takes its rows from `split_source` when it is opened.
+            scanners.emplace_back(_build_scanner(tablet, version, _key_ranges,
+                                                 {{}, entire_read_source.delete_predicates},
+                                                 split_source));
+        }
+    }
+
+    return Status::OK();
+}
+
 /**
  * Load rowsets of each tablet with specified version, segments of each rowset.
  */
@@ -194,9 +255,16 @@ Status ParallelScannerBuilder::_load() {
 
 std::shared_ptr<OlapScanner> ParallelScannerBuilder::_build_scanner(
         BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
-        TabletReader::ReadSource&& read_source) {
-    OlapScanner::Params params {_state,  _scanner_profile.get(), key_ranges, std::move(tablet),
-                                version, std::move(read_source), _limit,     _is_preaggregation};
+        TabletReader::ReadSource&& read_source, ParallelScanSplitSourceSPtr split_source) {
+    OlapScanner::Params params {_state,
+                                _scanner_profile.get(),
+                                key_ranges,
+                                std::move(tablet),
+                                version,
+                                std::move(read_source),
+                                _limit,
+                                _is_preaggregation,
+                                std::move(split_source)};
     return OlapScanner::create_shared(_parent, std::move(params));
 }
 
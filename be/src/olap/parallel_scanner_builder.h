@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "olap/parallel_scan_split_source.h"
 #include "olap/rowset/rowset_fwd.h"
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/segment_loader.h"
@@ -69,9 +70,13 @@ private:
 
     Status _build_scanners_by_rowid(std::list<ScannerSPtr>& scanners);
 
+    // The scanners of a tablet take the splits of its rows from a shared ParallelScanSplitSource.
+    Status _build_scanners_by_split_source(std::list<ScannerSPtr>& scanners);
+
     std::shared_ptr<vectorized::OlapScanner> _build_scanner(
             BaseTabletSPtr tablet, int64_t version, const std::vector<OlapScanRange*>& key_ranges,
-            TabletReader::ReadSource&& read_source);
+            TabletReader::ReadSource&& read_source,
+            ParallelScanSplitSourceSPtr split_source = nullptr);
 
     pipeline::OlapScanLocalState* _parent;
 
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/olap_file.pb.h>
 
+#include <algorithm>
 #include <cstdint>
 
 #include "common/consts.h"
@@ -294,6 +295,17 @@ void PartialUpdateInfo::_generate_default_values_for_missing_cids(
     CHECK_EQ(missing_cids.size(), default_values.size());
 }
 
+// ColumnIterator::read_by_rowids reads the rows of a page in one batch only if their row ids are
+// ascending, the rows of a segment may be planned in another order, e.g. with cluster keys.
+static std::vector<RidAndPos> sorted_by_rid(const std::vector<RidAndPos>& mappings) {
+    std::vector<RidAndPos> sorted(mappings);
+    auto rid_less = [](const RidAndPos& lhs, const RidAndPos& rhs) { return lhs.rid < rhs.rid; };
+    if (!std::is_sorted(sorted.begin(), sorted.end(), rid_less)) {
+        std::sort(sorted.begin(), sorted.end(), rid_less);
+    }
+    return sorted;
+}
+
 bool FixedReadPlan::empty() const {
     return plan.empty();
 }
@@ -327,7 +339,7 @@ Status FixedReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            for (auto [rid, pos] : sorted_by_rid(mappings)) {
                 if (cur_delete_signs && cur_delete_signs[pos]) {
                     continue;
                 }
@@ -343,15 +355,13 @@ Status FixedReadPlan::read_columns_by_plan(
                 }
                 continue;
             }
-            for (size_t cid = 0; cid < mutable_columns.size(); ++cid) {
-                TabletColumn tablet_column = tablet_schema.column(cids_to_read[cid]);
-                auto st = doris::BaseTablet::fetch_value_by_rowids(
-                        rowset_iter->second, segment_id, rids, tablet_column, mutable_columns[cid]);
-                // set read value to output block
-                if (!st.ok()) {
-                    LOG(WARNING) << "failed to fetch value";
-                    return st;
-                }
+            auto st = doris::BaseTablet::fetch_values_by_rowids(
+                    rowset_iter->second, segment_id, rids, tablet_schema, cids_to_read,
+                    mutable_columns);
+            // set read value to output block
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to fetch value";
+                return st;
             }
         }
     }
@@ -486,7 +496,7 @@ Status FlexibleReadPlan::read_columns_by_plan(
                 DCHECK_NE(cid, -1);
                 DCHECK_GE(cid, tablet_schema.num_key_columns());
                 std::vector<uint32_t> rids;
-                for (auto [rid, pos] : mappings) {
+                for (auto [rid, pos] : sorted_by_rid(mappings)) {
                     rids.emplace_back(rid);
                     (*read_index)[cid][static_cast<uint32_t>(pos)] = next_read_idx[cid]++;
                 }
@@ -515,7 +525,7 @@ Status FlexibleReadPlan::read_columns_by_plan(
             auto rowset_iter = rsid_to_rowset.find(rowset_id);
             CHECK(rowset_iter != rsid_to_rowset.end());
             std::vector<uint32_t> rids;
-            for (auto [rid, pos] : mappings) {
+            for (auto [rid, pos] : sorted_by_rid(mappings)) {
                 rids.emplace_back(rid);
                 (*read_index)[static_cast<uint32_t>(pos)] = read_idx++;
             }
@@ -76,13 +76,14 @@ Status BetaRowset::get_segment_num_rows(std::vector<uint32_t>* segment_rows) {
     RETURN_IF_ERROR(_load_segment_rows_once.call([this] {
         auto segment_count = num_segments();
         _segments_rows.resize(segment_count);
+        SegmentCacheHandle segment_cache_handle;
+        RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
+                std::static_pointer_cast<BetaRowset>(shared_from_this()), &segment_cache_handle,
+                false, false));
+        const auto& tmp_segments = segment_cache_handle.get_segments();
+        DCHECK_EQ(tmp_segments.size(), static_cast<size_t>(segment_count));
         for (int64_t i = 0; i != segment_count; ++i) {
-            SegmentCacheHandle segment_cache_handle;
-            RETURN_IF_ERROR(SegmentLoader::instance()->load_segment(
-                    std::static_pointer_cast<BetaRowset>(shared_from_this()), i,
-                    &segment_cache_handle, false, false));
-            const auto& tmp_segments = segment_cache_handle.get_segments();
-            _segments_rows[i] = tmp_segments[0]->num_rows();
+            _segments_rows[i] = tmp_segments[i]->num_rows();
         }
         return Status::OK();
     }));
@@ -401,74 +401,95 @@ Status BetaRowsetWriter::_load_noncompacted_segment(segment_v2::SegmentSharedPtr
  *     single small
  *  3. if the consecutive smalls end up with small, compact the smalls if the
  *     length is beyond (config::segcompaction_batch_size / 2)
+ *  4. the smalls after a group which is cut by the batch size or the task limits
+ *     are collected into the next group, up to config::segcompaction_task_max_groups
+ *     groups. The next groups are only taken if they are cut the same way, so the
+ *     groups are the same as the ones the next tasks would take.
  */
-Status BetaRowsetWriter::_find_longest_consecutive_small_segment(
-        SegCompactionCandidatesSharedPtr& segments) {
-    segments = std::make_shared<SegCompactionCandidates>();
+Status BetaRowsetWriter::_find_segcompaction_groups(SegCompactionGroups& groups) {
+    groups.clear();
     // skip last (maybe active) segment
     int32_t last_segment = _num_segment - 1;
-    size_t task_bytes = 0;
-    uint32_t task_rows = 0;
-    int32_t segid;
-    for (segid = _segcompacted_point;
-         segid < last_segment && segments->size() < config::segcompaction_batch_size; segid++) {
-        segment_v2::SegmentSharedPtr segment;
-        RETURN_IF_ERROR(_load_noncompacted_segment(segment, segid));
-        const auto segment_rows = segment->num_rows();
-        const auto segment_bytes = segment->file_reader()->size();
-        bool is_large_segment = segment_rows > config::segcompaction_candidate_max_rows ||
-                                segment_bytes > config::segcompaction_candidate_max_bytes;
-        if (is_large_segment) {
-            if (segid == _segcompacted_point) {
-                // skip large segments at the front
-                auto dst_seg_id = _num_segcompacted.load();
-                RETURN_IF_ERROR(_rename_compacted_segment_plain(_segcompacted_point++));
-                if (_segcompaction_worker->need_convert_delete_bitmap()) {
-                    RETURN_IF_ERROR(_segcompaction_worker->convert_segment_delete_bitmap(
-                            segment, _context.mow_context->delete_bitmap, segid, dst_seg_id));
+    int32_t segid = _segcompacted_point;
+    const auto max_groups = static_cast<size_t>(std::max(config::segcompaction_task_max_groups, 1));
+    while (groups.size() < max_groups) {
+        auto segments = std::make_shared<SegCompactionCandidates>();
+        size_t task_bytes = 0;
+        uint32_t task_rows = 0;
+        bool meet_large_segment = false;
+        for (; segid < last_segment && segments->size() < config::segcompaction_batch_size;
+             segid++) {
+            segment_v2::SegmentSharedPtr segment;
+            RETURN_IF_ERROR(_load_noncompacted_segment(segment, segid));
+            const auto segment_rows = segment->num_rows();
+            const auto segment_bytes = segment->file_reader()->size();
+            bool is_large_segment = segment_rows > config::segcompaction_candidate_max_rows ||
+                                    segment_bytes > config::segcompaction_candidate_max_bytes;
+            if (is_large_segment) {
+                if (segid == _segcompacted_point) {
+                    // skip large segments at the front
+                    auto dst_seg_id = _num_segcompacted.load();
+                    RETURN_IF_ERROR(_rename_compacted_segment_plain(_segcompacted_point++));
+                    if (_segcompaction_worker->need_convert_delete_bitmap()) {
+                        RETURN_IF_ERROR(_segcompaction_worker->convert_segment_delete_bitmap(
+                                segment, _context.mow_context->delete_bitmap, segid, dst_seg_id));
+                    }
+                    continue;
+                } else {
+                    // stop because we need consecutive segments
+                    meet_large_segment = true;
+                    break;
                 }
-                continue;
-            } else {
-                // stop because we need consecutive segments
+            }
+            bool is_task_full = task_rows + segment_rows > config::segcompaction_task_max_rows ||
+                                task_bytes + segment_bytes > config::segcompaction_task_max_bytes;
+            if (is_task_full) {
                 break;
             }
+            segments->push_back(segment);
+            task_rows += segment->num_rows();
+            task_bytes += segment->file_reader()->size();
         }
-        bool is_task_full = task_rows + segment_rows > config::segcompaction_task_max_rows ||
-                            task_bytes + segment_bytes > config::segcompaction_task_max_bytes;
-        if (is_task_full) {
+        size_t s = segments->size();
+        if (segid == last_segment &&
+            (groups.empty() ? s <= (config::segcompaction_batch_size / 2)
+                            : s < config::segcompaction_batch_size)) {
+            // we didn't collect enough segments, better to do it in next
+            // round to compact more at once
             break;
         }
-        segments->push_back(segment);
-        task_rows += segment->num_rows();
-        task_bytes += segment->file_reader()->size();
-    }
-    size_t s = segments->size();
-    if (segid == last_segment && s <= (config::segcompaction_batch_size / 2)) {
-        // we didn't collect enough segments, better to do it in next
-        // round to compact more at once
-        segments->clear();
-        return Status::OK();
-    }
-    if (s == 1) { // poor bachelor, let it go
-        VLOG_DEBUG << "only one candidate segment";
-        auto src_seg_id = _segcompacted_point.load();
-        auto dst_seg_id = _num_segcompacted.load();
-        segment_v2::SegmentSharedPtr segment;
-        RETURN_IF_ERROR(_load_noncompacted_segment(segment, src_seg_id));
-        RETURN_IF_ERROR(_rename_compacted_segment_plain(_segcompacted_point++));
-        if (_segcompaction_worker->need_convert_delete_bitmap()) {
-            RETURN_IF_ERROR(_segcompaction_worker->convert_segment_delete_bitmap(
-                    segment, _context.mow_context->delete_bitmap, src_seg_id, dst_seg_id));
+        if (s == 1 && groups.empty()) { // poor bachelor, let it go
+            VLOG_DEBUG << "only one candidate segment";
+            auto src_seg_id = _segcompacted_point.load();
+            auto dst_seg_id = _num_segcompacted.load();
+            segment_v2::SegmentSharedPtr segment;
+            RETURN_IF_ERROR(_load_noncompacted_segment(segment, src_seg_id));
+            RETURN_IF_ERROR(_rename_compacted_segment_plain(_segcompacted_point++));
+            if (_segcompaction_worker->need_convert_delete_bitmap()) {
+                RETURN_IF_ERROR(_segcompaction_worker->convert_segment_delete_bitmap(
+                        segment, _context.mow_context->delete_bitmap, src_seg_id, dst_seg_id));
+            }
+            break;
+        }
+        if (s <= 1) {
+            break;
+        }
+        groups.push_back(std::move(segments));
+        if (meet_large_segment) {
+            break;
         }
-        segments->clear();
-        return Status::OK();
     }
     if (VLOG_DEBUG_IS_ON) {
         vlog_buffer.clear();
-        for (auto& segment : (*segments.get())) {
-            fmt::format_to(vlog_buffer, "[id:{} num_rows:{}]", segment->id(), segment->num_rows());
+        for (const auto& segments : groups) {
+            fmt::format_to(vlog_buffer, "{{");
+            for (const auto& segment : *segments) {
+                fmt::format_to(vlog_buffer, "[id:{} num_rows:{}]", segment->id(),
+                               segment->num_rows());
+            }
+            fmt::format_to(vlog_buffer, "}}");
         }
-        VLOG_DEBUG << "candidate segments num:" << s
+        VLOG_DEBUG << "candidate groups num:" << groups.size()
                    << " list of candidates:" << fmt::to_string(vlog_buffer);
     }
     return Status::OK();
@@ -616,13 +637,14 @@ Status BetaRowsetWriter::_segcompaction_if_necessary() {
         status = _check_segment_number_limit(_num_segcompacted);
     }
     if (status.ok() && (_num_segment - _segcompacted_point) >= config::segcompaction_batch_size) {
-        SegCompactionCandidatesSharedPtr segments;
-        status = _find_longest_consecutive_small_segment(segments);
-        if (LIKELY(status.ok()) && (!segments->empty())) {
+        SegCompactionGroups groups;
+        status = _find_segcompaction_groups(groups);
+        if (LIKELY(status.ok()) && (!groups.empty())) {
             LOG(INFO) << "submit segcompaction task, tablet_id:" << _context.tablet_id
                       << " rowset_id:" << _context.rowset_id << " segment num:" << _num_segment
-                      << ", segcompacted_point:" << _segcompacted_point;
-            status = _engine.submit_seg_compaction_task(_segcompaction_worker, segments);
+                      << ", segcompacted_point:" << _segcompacted_point
+                      << ", group num:" << groups.size();
+            status = _engine.submit_seg_compaction_task(_segcompaction_worker, std::move(groups));
             if (status.ok()) {
                 return status;
             }
@@ -795,13 +817,6 @@ Status BetaRowsetWriter::_close_file_writers() {
         }
         RETURN_NOT_OK_STATUS_WITH_WARN(_segcompaction_rename_last_segments(),
                                        "rename last segments failed when build new rowset");
-        // segcompaction worker would do file wrier's close function in compact_segments
-        if (auto& seg_comp_file_writer = _segcompaction_worker->get_file_writer();
-            nullptr != seg_comp_file_writer &&
-            seg_comp_file_writer->state() != io::FileWriter::State::CLOSED) {
-            RETURN_NOT_OK_STATUS_WITH_WARN(seg_comp_file_writer->close(),
-                                           "close segment compaction worker failed");
-        }
         // process delete bitmap for mow table
         if (is_segcompacted() && _segcompaction_worker->need_convert_delete_bitmap()) {
             auto converted_delete_bitmap = _segcompaction_worker->get_converted_delete_bitmap();
@@ -1007,14 +1022,14 @@ Status BaseBetaRowsetWriter::create_index_file_writer(uint32_t segment_id,
 }
 
 Status BetaRowsetWriter::create_segment_writer_for_segcompaction(
-        std::unique_ptr<segment_v2::SegmentWriter>* writer, int64_t begin, int64_t end) {
+        std::unique_ptr<segment_v2::SegmentWriter>* writer, int64_t begin, int64_t end,
+        uint32_t segment_id, io::FileWriterPtr* file_writer,
+        IndexFileWriterPtr* index_file_writer) {
     DCHECK(begin >= 0 && end >= 0);
     std::string path = BetaRowset::local_segment_path_segcompacted(_context.tablet_path,
                                                                    _context.rowset_id, begin, end);
-    io::FileWriterPtr file_writer;
-    RETURN_IF_ERROR(_create_file_writer(path, file_writer));
+    RETURN_IF_ERROR(_create_file_writer(path, *file_writer));
 
-    IndexFileWriterPtr index_file_writer;
     if (_context.tablet_schema->has_inverted_index()) {
         io::FileWriterPtr idx_file_writer;
         std::string prefix(InvertedIndexDescriptor::get_index_file_path_prefix(path));
@@ -1023,8 +1038,8 @@ Status BetaRowsetWriter::create_segment_writer_for_segcompaction(
             std::string index_path = InvertedIndexDescriptor::get_index_file_path_v2(prefix);
             RETURN_IF_ERROR(_create_file_writer(index_path, idx_file_writer));
         }
-        index_file_writer = std::make_unique<IndexFileWriter>(
-                _context.fs(), prefix, _context.rowset_id.to_string(), _num_segcompacted,
+        *index_file_writer = std::make_unique<IndexFileWriter>(
+                _context.fs(), prefix, _context.rowset_id.to_string(), segment_id,
                 _context.tablet_schema->get_inverted_index_storage_format(),
                 std::move(idx_file_writer));
     }
@@ -1038,18 +1053,8 @@ Status BetaRowsetWriter::create_segment_writer_for_segcompaction(
     writer_options.mow_ctx = _context.mow_context;
 
     *writer = std::make_unique<segment_v2::SegmentWriter>(
-            file_writer.get(), _num_segcompacted, _context.tablet_schema, _context.tablet,
-            _context.data_dir, writer_options, index_file_writer.get());
-    if (auto& seg_writer = _segcompaction_worker->get_file_writer();
-        seg_writer != nullptr && seg_writer->state() != io::FileWriter::State::CLOSED) {
-        RETURN_IF_ERROR(_segcompaction_worker->get_file_writer()->close());
-    }
-    _segcompaction_worker->get_file_writer().reset(file_writer.release());
-    if (auto& idx_file_writer = _segcompaction_worker->get_inverted_index_file_writer();
-        idx_file_writer != nullptr) {
-        RETURN_IF_ERROR(idx_file_writer->close());
-    }
-    _segcompaction_worker->get_inverted_index_file_writer().reset(index_file_writer.release());
+            file_writer->get(), segment_id, _context.tablet_schema, _context.tablet,
+            _context.data_dir, writer_options, index_file_writer->get());
     return Status::OK();
 }
 
@@ -1127,9 +1132,9 @@ Status BetaRowsetWriter::add_segment(uint32_t segment_id, const SegmentStatistic
     return _segcompaction_if_necessary();
 }
 
-Status BetaRowsetWriter::flush_segment_writer_for_segcompaction(
+Status BetaRowsetWriter::finalize_segment_writer_for_segcompaction(
         std::unique_ptr<segment_v2::SegmentWriter>* writer, uint64_t index_size,
-        KeyBoundsPB& key_bounds) {
+        KeyBoundsPB& key_bounds, SegmentStatistics* segstat) {
     uint32_t segid = (*writer)->get_segment_id();
     uint32_t row_num = (*writer)->row_count();
     uint64_t segment_size;
@@ -1142,17 +1147,11 @@ Status BetaRowsetWriter::flush_segment_writer_for_segcompaction(
     int64_t inverted_index_file_size = 0;
     RETURN_IF_ERROR((*writer)->close_inverted_index(&inverted_index_file_size));
 
-    SegmentStatistics segstat;
-    segstat.row_num = row_num;
-    segstat.data_size = segment_size;
-    segstat.index_size = inverted_index_file_size;
-    segstat.key_bounds = key_bounds;
-    {
-        std::lock_guard<std::mutex> lock(_segid_statistics_map_mutex);
-        CHECK_EQ(_segid_statistics_map.find(segid) == _segid_statistics_map.end(), true);
-        _segid_statistics_map.emplace(segid, segstat);
-    }
-    VLOG_DEBUG << "_segid_statistics_map add new record. segid:" << segid << " row_num:" << row_num
+    segstat->row_num = row_num;
+    segstat->data_size = segment_size;
+    segstat->index_size = inverted_index_file_size;
+    segstat->key_bounds = key_bounds;
+    VLOG_DEBUG << "segcompaction finalize segment. segid:" << segid << " row_num:" << row_num
                << " data_size:" << segment_size << " index_size:" << index_size;
 
     writer->reset();
@@ -54,6 +54,7 @@ class SegmentWriter;
 
 using SegCompactionCandidates = std::vector<segment_v2::SegmentSharedPtr>;
 using SegCompactionCandidatesSharedPtr = std::shared_ptr<SegCompactionCandidates>;
+using SegCompactionGroups = std::vector<SegCompactionCandidatesSharedPtr>;
 
 class SegmentFileCollection {
 public:
@@ -283,11 +284,15 @@ public:
     Status add_segment(uint32_t segment_id, const SegmentStatistics& segstat,
                        TabletSchemaSPtr flush_schema) override;
 
-    Status flush_segment_writer_for_segcompaction(
+    Status finalize_segment_writer_for_segcompaction(
             std::unique_ptr<segment_v2::SegmentWriter>* writer, uint64_t index_size,
-            KeyBoundsPB& key_bounds);
+            KeyBoundsPB& key_bounds, SegmentStatistics* segstat);
+    // The segment compacted from [begin, end] is written to a temporary file, and renamed to
+    // `segment_id` when it is committed.
     Status create_segment_writer_for_segcompaction(
-            std::unique_ptr<segment_v2::SegmentWriter>* writer, int64_t begin, int64_t end);
+            std::unique_ptr<segment_v2::SegmentWriter>* writer, int64_t begin, int64_t end,
+            uint32_t segment_id, io::FileWriterPtr* file_writer,
+            IndexFileWriterPtr* index_file_writer);
 
     bool is_segcompacted() const { return _num_segcompacted > 0; }
 
@@ -301,7 +306,7 @@ private:
     Status _segcompaction_if_necessary();
     Status _segcompaction_rename_last_segments();
     Status _load_noncompacted_segment(segment_v2::SegmentSharedPtr& segment, int32_t segment_id);
-    Status _find_longest_consecutive_small_segment(SegCompactionCandidatesSharedPtr& segments);
+    Status _find_segcompaction_groups(SegCompactionGroups& groups);
     Status _rename_compacted_segments(int64_t begin, int64_t end);
     Status _rename_compacted_segment_plain(uint32_t seg_id);
     Status _rename_compacted_indices(int64_t begin, int64_t end, uint64_t seg_id);
@@ -82,6 +82,8 @@ struct RowsetReaderContext {
     RowsetId rowset_id;
     // slots that cast may be eliminated in storage layer
     std::map<std::string, PrimitiveType> target_cast_type_for_variants;
+    // the only sub columns read of the struct columns, the others are filled with defaults
+    std::map<ColumnId, std::vector<std::string>> struct_read_sub_columns;
     int64_t ttl_seconds = 0;
 
     std::map<ColumnId, vectorized::VExprContextSPtr> virtual_column_exprs;
@@ -59,6 +59,7 @@
 #include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/mem_info.h"
+#include "util/threadpool.h"
 #include "util/time.h"
 #include "vec/olap/vertical_block_reader.h"
 #include "vec/olap/vertical_merge_iterator.h"
@@ -83,12 +84,12 @@ void SegcompactionWorker::init_mem_tracker(const RowsetWriterContext& rowset_wri
 }
 
 Status SegcompactionWorker::_get_segcompaction_reader(
-        SegCompactionCandidatesSharedPtr segments, TabletSharedPtr tablet,
-        std::shared_ptr<Schema> schema, OlapReaderStatistics* stat,
-        vectorized::RowSourcesBuffer& row_sources_buf, bool is_key,
+        Group& group, TabletSharedPtr tablet, std::shared_ptr<Schema> schema,
+        OlapReaderStatistics* stat, vectorized::RowSourcesBuffer& row_sources_buf, bool is_key,
         std::vector<uint32_t>& return_columns, std::vector<uint32_t>& key_group_cluster_key_idxes,
         std::unique_ptr<vectorized::VerticalBlockReader>* reader) {
     const auto& ctx = _writer->_context;
+    const auto& segments = group.segments;
     bool record_rowids = need_convert_delete_bitmap() && is_key;
     StorageReadOptions read_options;
     read_options.stats = stat;
@@ -120,8 +121,8 @@ Status SegcompactionWorker::_get_segcompaction_reader(
         seg_iterators.push_back(std::move(iter));
         segment_rows.emplace(seg_ptr->id(), seg_ptr->num_rows());
     }
-    if (record_rowids && _rowid_conversion != nullptr) {
-        _rowid_conversion->reset_segment_map(segment_rows);
+    if (record_rowids && group.rowid_conversion != nullptr) {
+        group.rowid_conversion->reset_segment_map(segment_rows);
     }
 
     *reader = std::make_unique<vectorized::VerticalBlockReader>(&row_sources_buf);
@@ -140,20 +141,6 @@ Status SegcompactionWorker::_get_segcompaction_reader(
     return (*reader)->init(reader_params, nullptr);
 }
 
-std::unique_ptr<segment_v2::SegmentWriter> SegcompactionWorker::_create_segcompaction_writer(
-        uint32_t begin, uint32_t end) {
-    Status status;
-    std::unique_ptr<segment_v2::SegmentWriter> writer = nullptr;
-    status = _create_segment_writer_for_segcompaction(&writer, begin, end);
-    if (!status.ok() || writer == nullptr) {
-        LOG(ERROR) << "failed to create segment writer for begin:" << begin << " end:" << end
-                   << " status:" << status;
-        return nullptr;
-    } else {
-        return writer;
-    }
-}
-
 Status SegcompactionWorker::_delete_original_segments(uint32_t begin, uint32_t end) {
     DCHECK(_writer->rowset_meta()->is_local());
 
@@ -247,35 +234,26 @@ Status SegcompactionWorker::_check_correctness(OlapReaderStatistics& reader_stat
     return Status::OK();
 }
 
-Status SegcompactionWorker::_create_segment_writer_for_segcompaction(
-        std::unique_ptr<segment_v2::SegmentWriter>* writer, uint32_t begin, uint32_t end) {
-    return _writer->create_segment_writer_for_segcompaction(writer, begin, end);
-}
-
-Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPtr segments) {
-    DCHECK(_seg_compact_mem_tracker != nullptr);
-    SCOPED_ATTACH_TASK(_seg_compact_mem_tracker);
-    /* throttle segcompaction task if memory depleted */
-    if (GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE)) {
-        return Status::Error<FETCH_MEMORY_EXCEEDED>("skip segcompaction due to memory shortage");
-    }
-
-    uint32_t begin = (*(segments->begin()))->id();
-    uint32_t end = (*(segments->end() - 1))->id();
-    uint64_t begin_time = GetCurrentTimeMicros();
+Status SegcompactionWorker::_merge_group(Group& group) {
+    uint32_t begin = group.begin;
+    uint32_t end = group.end;
     uint64_t index_size = 0;
     uint64_t total_index_size = 0;
-    auto ctx = _writer->_context;
+    const auto& ctx = _writer->_context;
 
-    auto writer = _create_segcompaction_writer(begin, end);
-    if (UNLIKELY(writer == nullptr)) {
+    std::unique_ptr<segment_v2::SegmentWriter> writer;
+    auto st = _writer->create_segment_writer_for_segcompaction(
+            &writer, begin, end, group.dst_seg_id, &group.file_writer, &group.index_file_writer);
+    if (UNLIKELY(!st.ok() || writer == nullptr)) {
+        LOG(ERROR) << "failed to create segment writer for begin:" << begin << " end:" << end
+                   << " status:" << st;
         return Status::Error<SEGCOMPACTION_INIT_WRITER>("failed to get segcompaction writer");
     }
 
     DCHECK(ctx.tablet);
     auto tablet = std::static_pointer_cast<Tablet>(ctx.tablet);
-    if (need_convert_delete_bitmap() && _rowid_conversion == nullptr) {
-        _rowid_conversion = std::make_unique<SimpleRowIdConversion>(_writer->rowset_id());
+    if (need_convert_delete_bitmap()) {
+        group.rowid_conversion = std::make_unique<SimpleRowIdConversion>(_writer->rowset_id());
     }
 
     std::vector<std::vector<uint32_t>> column_groups;
@@ -299,9 +277,9 @@ Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPt
         auto schema = std::make_shared<Schema>(ctx.tablet_schema->columns(), column_ids);
         OlapReaderStatistics reader_stats;
         std::unique_ptr<vectorized::VerticalBlockReader> reader;
-        auto s =
-                _get_segcompaction_reader(segments, tablet, schema, &reader_stats, row_sources_buf,
-                                          is_key, column_ids, key_group_cluster_key_idxes, &reader);
+        auto s = _get_segcompaction_reader(group, tablet, schema, &reader_stats, row_sources_buf,
+                                           is_key, column_ids, key_group_cluster_key_idxes,
+                                           &reader);
         if (UNLIKELY(reader == nullptr || !s.ok())) {
             return Status::Error<SEGCOMPACTION_INIT_READER>(
                     "failed to get segcompaction reader. err: {}", s.to_string());
@@ -311,7 +289,7 @@ Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPt
         RETURN_IF_ERROR(Merger::vertical_compact_one_group(
                 tablet->tablet_id(), ReaderType::READER_SEGMENT_COMPACTION, *ctx.tablet_schema,
                 is_key, column_ids, &row_sources_buf, *reader, *writer, &merger_stats, &index_size,
-                key_bounds, _rowid_conversion.get()));
+                key_bounds, group.rowid_conversion.get()));
         total_index_size += index_size;
         if (is_key) {
             RETURN_IF_ERROR(row_sources_buf.flush());
@@ -326,26 +304,86 @@ Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPt
     RETURN_NOT_OK_STATUS_WITH_WARN(_check_correctness(key_reader_stats, key_merger_stats, begin,
                                                       end, is_mow_with_cluster_keys),
                                    "check correctness failed");
+    // The statistics are recorded when the group is committed, dst_seg_id may still be the id
+    // of a segment of the former groups.
+    RETURN_IF_ERROR(_writer->finalize_segment_writer_for_segcompaction(
+            &writer, total_index_size, key_bounds, &group.segstat));
+    if (group.file_writer->state() != io::FileWriter::State::CLOSED) {
+        RETURN_IF_ERROR(group.file_writer->close());
+    }
+    return Status::OK();
+}
+
+void SegcompactionWorker::_merge_groups(std::vector<Group>& groups) {
+    // The groups are taken by this thread and by the helpers submitted to the segcompaction
+    // thread pool. This thread only waits for the groups which are being merged, a helper
+    // which starts after all the groups are taken exits at once, so the helpers queued behind
+    // other tasks never block this task.
+    struct MergeState {
+        std::mutex lock;
+        std::condition_variable cond;
+        size_t num_groups = 0;
+        size_t next_group = 0;
+        size_t num_running = 0;
+    };
+    auto state = std::make_shared<MergeState>();
+    state->num_groups = groups.size();
+    auto merge_next_groups = [this, state, data = groups.data()]() {
+        while (true) {
+            size_t i = 0;
+            {
+                std::lock_guard l(state->lock);
+                if (state->next_group == state->num_groups) {
+                    return;
+                }
+                i = state->next_group++;
+                ++state->num_running;
+            }
+            data[i].status = _merge_group(data[i]);
+            std::lock_guard l(state->lock);
+            --state->num_running;
+            state->cond.notify_all();
+        }
+    };
+
+    auto* thread_pool = _writer->_engine.seg_compaction_thread_pool();
+    for (size_t i = 1; i < groups.size() && thread_pool != nullptr; ++i) {
+        auto st = thread_pool->submit_func([tracker = _seg_compact_mem_tracker, merge_next_groups] {
+            SCOPED_ATTACH_TASK(tracker);
+            merge_next_groups();
+        });
+        if (!st.ok()) {
+            // this thread merges the groups left
+            break;
+        }
+    }
+    merge_next_groups();
+    std::unique_lock l(state->lock);
+    state->cond.wait(l, [&] { return state->num_running == 0; });
+}
+
+Status SegcompactionWorker::_commit_group(Group& group) {
+    uint32_t begin = group.begin;
+    uint32_t end = group.end;
+    const auto& ctx = _writer->_context;
+    DCHECK_EQ(group.dst_seg_id, _writer->_num_segcompacted);
     {
         std::lock_guard<std::mutex> lock(_writer->_segid_statistics_map_mutex);
         _writer->_clear_statistics_for_deleting_segments_unsafe(begin, end);
-    }
-    RETURN_IF_ERROR(
-            _writer->flush_segment_writer_for_segcompaction(&writer, total_index_size, key_bounds));
-
-    if (_file_writer != nullptr && _file_writer->state() != io::FileWriter::State::CLOSED) {
-        RETURN_IF_ERROR(_file_writer->close());
+        CHECK_EQ(_writer->_segid_statistics_map.find(group.dst_seg_id) ==
+                         _writer->_segid_statistics_map.end(),
+                 true);
+        _writer->_segid_statistics_map.emplace(group.dst_seg_id, group.segstat);
     }
 
     RETURN_IF_ERROR(_delete_original_segments(begin, end));
-    if (_rowid_conversion != nullptr) {
-        RETURN_IF_ERROR(convert_segment_delete_bitmap(segments, ctx.mow_context->delete_bitmap,
-                                                      begin, end, _writer->_num_segcompacted));
+    if (group.rowid_conversion != nullptr) {
+        RETURN_IF_ERROR(convert_segment_delete_bitmap(group.segments, *group.rowid_conversion,
+                                                      ctx.mow_context->delete_bitmap, begin, end,
+                                                      group.dst_seg_id));
     }
     RETURN_IF_ERROR(_writer->_rename_compacted_segments(begin, end));
-    if (_index_file_writer != nullptr) {
-        _index_file_writer.reset();
-    }
+    group.index_file_writer.reset();
     if (VLOG_DEBUG_IS_ON) {
         _writer->vlog_buffer.clear();
         for (const auto& entry : std::filesystem::directory_iterator(ctx.tablet_path)) {
@@ -359,12 +397,57 @@ Status SegcompactionWorker::_do_compact_segments(SegCompactionCandidatesSharedPt
     }
 
     _writer->_segcompacted_point += (end - begin + 1);
+    return Status::OK();
+}
+
+Status SegcompactionWorker::_do_compact_segments(SegCompactionGroups groups) {
+    DCHECK(_seg_compact_mem_tracker != nullptr);
+    SCOPED_ATTACH_TASK(_seg_compact_mem_tracker);
+    /* throttle segcompaction task if memory depleted */
+    if (GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE)) {
+        return Status::Error<FETCH_MEMORY_EXCEEDED>("skip segcompaction due to memory shortage");
+    }
+
+    uint64_t begin_time = GetCurrentTimeMicros();
+    std::vector<Group> merge_groups(groups.size());
+    for (size_t i = 0; i < groups.size(); ++i) {
+        auto& group = merge_groups[i];
+        group.segments = groups[i];
+        group.begin = group.segments->front()->id();
+        group.end = group.segments->back()->id();
+        group.dst_seg_id = cast_set<uint32_t>(_writer->_num_segcompacted + i);
+    }
+    _merge_groups(merge_groups);
+
+    // The groups are committed in order, the groups after a failed one are dropped.
+    Status st;
+    size_t num_committed = 0;
+    for (; num_committed < merge_groups.size() && st.ok(); ++num_committed) {
+        st = merge_groups[num_committed].status;
+        if (st.ok()) {
+            st = _commit_group(merge_groups[num_committed]);
+        }
+    }
+    for (size_t i = num_committed; i < merge_groups.size(); ++i) {
+        auto& group = merge_groups[i];
+        if (group.file_writer != nullptr &&
+            group.file_writer->state() != io::FileWriter::State::CLOSED) {
+            WARN_IF_ERROR(group.file_writer->close(), "failed to close segcompaction file writer");
+        }
+        WARN_IF_ERROR(io::global_local_filesystem()->delete_file(
+                              BetaRowset::local_segment_path_segcompacted(
+                                      _writer->_context.tablet_path, _writer->_context.rowset_id,
+                                      group.begin, group.end)),
+                      "failed to delete uncommitted segcompaction output");
+    }
+    RETURN_IF_ERROR(st);
 
     uint64_t elapsed = GetCurrentTimeMicros() - begin_time;
-    LOG(INFO) << "segcompaction completed. tablet_id:" << ctx.tablet_id
-              << " rowset_id:" << ctx.rowset_id << " elapsed time:" << elapsed
+    LOG(INFO) << "segcompaction completed. tablet_id:" << _writer->_context.tablet_id
+              << " rowset_id:" << _writer->_context.rowset_id << " elapsed time:" << elapsed
               << "us. update segcompacted_point:" << _writer->_segcompacted_point
-              << " segment num:" << segments->size() << " begin:" << begin << " end:" << end;
+              << " group num:" << merge_groups.size()
+              << " begin:" << merge_groups.front().begin << " end:" << merge_groups.back().end;
 
     return Status::OK();
 }
@@ -384,10 +467,10 @@ Status SegcompactionWorker::_wait_calc_delete_bitmap(const SegCompactionCandidat
     return Status::OK();
 }
 
-void SegcompactionWorker::compact_segments(SegCompactionCandidatesSharedPtr segments) {
+void SegcompactionWorker::compact_segments(SegCompactionGroups groups) {
     Status status = Status::OK();
     if (_is_compacting_state_mutable.exchange(false)) {
-        status = _do_compact_segments(segments);
+        status = _do_compact_segments(std::move(groups));
     } else {
         // note: be aware that _writer maybe released when the task is cancelled
         LOG(INFO) << "segcompaction worker is cancelled, skipping segcompaction task";
@@ -450,10 +533,10 @@ Status SegcompactionWorker::convert_segment_delete_bitmap(segment_v2::SegmentSha
     return Status::OK();
 }
 
-Status SegcompactionWorker::convert_segment_delete_bitmap(SegCompactionCandidatesSharedPtr segments,
-                                                          DeleteBitmapPtr src_delete_bitmap,
-                                                          uint32_t src_begin, uint32_t src_end,
-                                                          uint32_t dst_seg_id) {
+Status SegcompactionWorker::convert_segment_delete_bitmap(
+        SegCompactionCandidatesSharedPtr segments, const SimpleRowIdConversion& rowid_conversion,
+        DeleteBitmapPtr src_delete_bitmap, uint32_t src_begin, uint32_t src_end,
+        uint32_t dst_seg_id) {
     // should wait until delete bitmaps on input segments are generated before converting them
     RETURN_IF_ERROR(_wait_calc_delete_bitmap(*segments));
     // lazy init
@@ -471,7 +554,7 @@ Status SegcompactionWorker::convert_segment_delete_bitmap(SegCompactionCandidate
         src.segment_id = seg_id;
         for (unsigned int row_id : *seg_map) {
             src.row_id = row_id;
-            auto dst_row_id = _rowid_conversion->get(src);
+            auto dst_row_id = rowid_conversion.get(src);
             if (dst_row_id < 0) {
                 continue;
             }
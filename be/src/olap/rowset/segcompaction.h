@@ -23,6 +23,7 @@
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "olap/merger.h"
+#include "olap/rowset/rowset_writer.h"
 #include "olap/simple_rowid_conversion.h"
 #include "olap/tablet.h"
 #include "segment_v2/index_file_writer.h"
@@ -42,6 +43,7 @@ struct OlapReaderStatistics;
 
 using SegCompactionCandidates = std::vector<segment_v2::SegmentSharedPtr>;
 using SegCompactionCandidatesSharedPtr = std::shared_ptr<SegCompactionCandidates>;
+using SegCompactionGroups = std::vector<SegCompactionCandidatesSharedPtr>;
 
 class BetaRowsetWriter;
 
@@ -51,15 +53,10 @@ class SegcompactionWorker {
 public:
     explicit SegcompactionWorker(BetaRowsetWriter* writer);
 
-    ~SegcompactionWorker() {
-        DCHECK(_seg_compact_mem_tracker != nullptr);
-        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_seg_compact_mem_tracker);
-        if (_rowid_conversion) {
-            _rowid_conversion.reset();
-        }
-    }
-
-    void compact_segments(SegCompactionCandidatesSharedPtr segments);
+    // Each group of consecutive segments is compacted into one segment. The groups are merged
+    // concurrently and committed in order, the compacted segments are numbered as if the groups
+    // were compacted one by one.
+    void compact_segments(SegCompactionGroups groups);
 
     bool need_convert_delete_bitmap();
 
@@ -67,45 +64,51 @@ public:
                                          DeleteBitmapPtr src_delete_bitmap, uint32_t src_seg_id,
                                          uint32_t dest_seg_id);
     Status convert_segment_delete_bitmap(SegCompactionCandidatesSharedPtr segments,
+                                         const SimpleRowIdConversion& rowid_conversion,
                                          DeleteBitmapPtr src_delete_bitmap, uint32_t src_begin,
                                          uint32_t src_end, uint32_t dest_seg_id);
     DeleteBitmapPtr get_converted_delete_bitmap() { return _converted_delete_bitmap; }
 
-    io::FileWriterPtr& get_file_writer() { return _file_writer; }
-    IndexFileWriterPtr& get_inverted_index_file_writer() { return _index_file_writer; }
-
     // set the cancel flag, tasks already started will not be cancelled.
     bool cancel();
 
     void init_mem_tracker(const RowsetWriterContext& rowset_writer_context);
 
 private:
-    Status _create_segment_writer_for_segcompaction(
-            std::unique_ptr<segment_v2::SegmentWriter>* writer, uint32_t begin, uint32_t end);
-    Status _get_segcompaction_reader(SegCompactionCandidatesSharedPtr segments,
-                                     TabletSharedPtr tablet, std::shared_ptr<Schema> schema,
-                                     OlapReaderStatistics* stat,
+    // A group of segments [begin, end] compacted into the segment dst_seg_id.
+    struct Group {
+        SegCompactionCandidatesSharedPtr segments;
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        uint32_t dst_seg_id = 0;
+        io::FileWriterPtr file_writer;
+        IndexFileWriterPtr index_file_writer;
+        // for unique key mow table
+        std::unique_ptr<SimpleRowIdConversion> rowid_conversion;
+        SegmentStatistics segstat;
+        Status status;
+    };
+
+    Status _get_segcompaction_reader(Group& group, TabletSharedPtr tablet,
+                                     std::shared_ptr<Schema> schema, OlapReaderStatistics* stat,
                                      vectorized::RowSourcesBuffer& row_sources_buf, bool is_key,
                                      std::vector<uint32_t>& return_columns,
                                      std::vector<uint32_t>& key_group_cluster_key_idxes,
                                      std::unique_ptr<vectorized::VerticalBlockReader>* reader);
-    std::unique_ptr<segment_v2::SegmentWriter> _create_segcompaction_writer(uint32_t begin,
-                                                                            uint32_t end);
     Status _delete_original_segments(uint32_t begin, uint32_t end);
     Status _check_correctness(OlapReaderStatistics& reader_stat, Merger::Statistics& merger_stat,
                               uint32_t begin, uint32_t end, bool is_mow_with_cluster_keys);
-    Status _do_compact_segments(SegCompactionCandidatesSharedPtr segments);
+    Status _do_compact_segments(SegCompactionGroups groups);
+    void _merge_groups(std::vector<Group>& groups);
+    Status _merge_group(Group& group);
+    Status _commit_group(Group& group);
     Status _wait_calc_delete_bitmap(const SegCompactionCandidates& segments);
 
 private:
     //TODO(zhengyu): current impl depends heavily on the access to feilds of BetaRowsetWriter
     // Currently cloud storage engine doesn't need segcompaction
     BetaRowsetWriter* _writer = nullptr;
-    io::FileWriterPtr _file_writer;
-    IndexFileWriterPtr _index_file_writer = nullptr;
 
-    // for unique key mow table
-    std::unique_ptr<SimpleRowIdConversion> _rowid_conversion = nullptr;
     DeleteBitmapPtr _converted_delete_bitmap;
     std::shared_ptr<MemTrackerLimiter> _seg_compact_mem_tracker = nullptr;
 
@@ -0,0 +1,440 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "common/cast_set.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+// Adaptive lossless floating-point (ALP) encoding of FLOAT and DOUBLE pages.
+//
+// Floats which are decimals with a few digits are multiplied by 10^e and divided by 10^f, and
+// stored as integers with frame-of-reference coding. One (e, f) pair is chosen for the page
+// by sampling its values. The values which do not round trip, e.g. NaN, -0.0 or values with
+// too many digits, are stored as exceptions with their positions.
+//
+// The page is stored in plain when it is not smaller with ALP, e.g. the values are random.
+//
+// Page layout:
+//   Header: Count(4) Mode(1) Exponent(1) Factor(1) Reserved(1) ExceptionCount(4) ForSize(4)
+//   ALP mode: ForData(ForSize) ExceptionPositions(4 * ExceptionCount)
+//             ExceptionValues(sizeof(CppType) * ExceptionCount)
+//   Plain mode: Values(sizeof(CppType) * Count)
+static const size_t ALP_PAGE_HEADER_SIZE = 16;
+static const uint8_t ALP_PAGE_MODE_ALP = 0;
+static const uint8_t ALP_PAGE_MODE_PLAIN = 1;
+static const size_t ALP_PAGE_SAMPLE_SIZE = 256;
+
+template <typename CppType>
+struct AlpConstants;
+
+template <>
+struct AlpConstants<double> {
+    static constexpr uint8_t MAX_EXPONENT = 18;
+    // Integers up to 2^52 are exactly representable and rounded correctly.
+    static constexpr double ENCODE_LIMIT = 4503599627370496.0;
+    static constexpr double EXP10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,
+                                       1e7,  1e8,  1e9,  1e10, 1e11, 1e12, 1e13,
+                                       1e14, 1e15, 1e16, 1e17, 1e18};
+    static constexpr double FRAC10[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                        1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                        1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+};
+
+template <>
+struct AlpConstants<float> {
+    static constexpr uint8_t MAX_EXPONENT = 10;
+    // Integers up to 2^22 are exactly representable and rounded correctly.
+    static constexpr float ENCODE_LIMIT = 4194304.0F;
+    static constexpr float EXP10[] = {1e0F, 1e1F, 1e2F, 1e3F, 1e4F, 1e5F,
+                                      1e6F, 1e7F, 1e8F, 1e9F, 1e10F};
+    static constexpr float FRAC10[] = {1e0F,  1e-1F, 1e-2F, 1e-3F, 1e-4F, 1e-5F,
+                                       1e-6F, 1e-7F, 1e-8F, 1e-9F, 1e-10F};
+};
+
+template <typename CppType>
+inline CppType alp_decode_value(int64_t encoded, uint8_t exponent, uint8_t factor) {
+    return static_cast<CppType>(encoded) * AlpConstants<CppType>::EXP10[factor] *
+           AlpConstants<CppType>::FRAC10[exponent];
+}
+
+// Returns false if the value is an exception, i.e. it is not restored bit by bit.
+template <typename CppType>
+inline bool alp_encode_value(CppType value, uint8_t exponent, uint8_t factor, int64_t* encoded) {
+    CppType scaled =
+            value * AlpConstants<CppType>::EXP10[exponent] * AlpConstants<CppType>::FRAC10[factor];
+    // Also false for NaN and infinity.
+    if (!(std::abs(scaled) <= AlpConstants<CppType>::ENCODE_LIMIT)) {
+        return false;
+    }
+    *encoded = static_cast<int64_t>(std::nearbyint(scaled));
+    CppType decoded = alp_decode_value<CppType>(*encoded, exponent, factor);
+    return memcmp(&decoded, &value, sizeof(CppType)) == 0;
+}
+
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilderHelper<AlpPageBuilder<Type>> {
+public:
+    using Self = AlpPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override {
+        _capacity = std::max<size_t>(1, _options.data_page_size / SIZE_OF_TYPE);
+        return reset();
+    }
+
+    bool is_page_full() override { return _values.size() >= _capacity; }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        size_t to_add = std::min(_capacity - std::min(_capacity, _values.size()), *count);
+        if (to_add > 0) {
+            auto new_vals = reinterpret_cast<const CppType*>(vals);
+            RETURN_IF_CATCH_EXCEPTION(_values.insert(_values.end(), new_vals, new_vals + to_add));
+        }
+        *count = to_add;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        _finished = true;
+        if (!_values.empty()) {
+            _first_value = _values.front();
+            _last_value = _values.back();
+        }
+        RETURN_IF_CATCH_EXCEPTION({
+            _encode();
+            *slice = _buffer.build();
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _values.clear();
+            _values.reserve(_capacity);
+            _buffer.clear();
+        });
+        _finished = false;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override {
+        return _finished ? _buffer.size() : ALP_PAGE_HEADER_SIZE + _values.size() * SIZE_OF_TYPE;
+    }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_first_value, SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_last_value, SIZE_OF_TYPE);
+        return Status::OK();
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_same_v<CppType, float> || std::is_same_v<CppType, double>,
+                  "ALP only encodes FLOAT and DOUBLE");
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+
+    explicit AlpPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    // Chooses the (exponent, factor) pair with the smallest estimated size on a sample of the
+    // values, the size is the bit width of the encoded integers plus the exceptions.
+    void _choose_exponent_and_factor(uint8_t* exponent, uint8_t* factor) const {
+        size_t stride = std::max<size_t>(1, _values.size() / ALP_PAGE_SAMPLE_SIZE);
+        uint64_t best_bits = std::numeric_limits<uint64_t>::max();
+        *exponent = 0;
+        *factor = 0;
+        for (uint8_t e = 0; e <= AlpConstants<CppType>::MAX_EXPONENT; ++e) {
+            for (uint8_t f = 0; f <= e; ++f) {
+                uint64_t exceptions = 0;
+                uint64_t samples = 0;
+                int64_t min_value = std::numeric_limits<int64_t>::max();
+                int64_t max_value = std::numeric_limits<int64_t>::min();
+                for (size_t i = 0; i < _values.size(); i += stride) {
+                    ++samples;
+                    int64_t encoded = 0;
+                    if (!alp_encode_value(_values[i], e, f, &encoded)) {
+                        ++exceptions;
+                        continue;
+                    }
+                    min_value = std::min(min_value, encoded);
+                    max_value = std::max(max_value, encoded);
+                }
+                uint64_t width = 0;
+                if (exceptions < samples) {
+                    width = static_cast<uint64_t>(
+                            std::bit_width(static_cast<uint64_t>(max_value - min_value)));
+                }
+                uint64_t bits =
+                        samples * width + exceptions * (sizeof(uint32_t) + SIZE_OF_TYPE) * 8;
+                if (bits < best_bits) {
+                    best_bits = bits;
+                    *exponent = e;
+                    *factor = f;
+                }
+            }
+        }
+    }
+
+    void _encode() {
+        size_t count = _values.size();
+        uint8_t exponent = 0;
+        uint8_t factor = 0;
+        std::vector<int64_t> encoded(count);
+        std::vector<uint32_t> exception_positions;
+        if (count > 0) {
+            _choose_exponent_and_factor(&exponent, &factor);
+            // The exceptions take the first encoded value, so they do not widen the frames.
+            bool has_fill_value = false;
+            int64_t fill_value = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (alp_encode_value(_values[i], exponent, factor, &encoded[i])) {
+                    if (!has_fill_value) {
+                        has_fill_value = true;
+                        fill_value = encoded[i];
+                        std::fill(encoded.begin(), encoded.begin() + i, fill_value);
+                    }
+                } else {
+                    exception_positions.push_back(cast_set<uint32_t>(i));
+                    encoded[i] = fill_value;
+                }
+            }
+        }
+
+        faststring for_buffer;
+        if (count > 0) {
+            ForEncoder<int64_t> encoder(&for_buffer);
+            encoder.put_batch(encoded.data(), count);
+            encoder.flush();
+        }
+        size_t exceptions = exception_positions.size();
+        size_t alp_size = for_buffer.size() + exceptions * (sizeof(uint32_t) + SIZE_OF_TYPE);
+        uint8_t mode = alp_size < count * SIZE_OF_TYPE ? ALP_PAGE_MODE_ALP : ALP_PAGE_MODE_PLAIN;
+
+        _buffer.clear();
+        put_fixed32_le(&_buffer, cast_set<uint32_t>(count));
+        uint8_t params[] = {mode, exponent, factor, 0};
+        _buffer.append(params, sizeof(params));
+        if (mode == ALP_PAGE_MODE_PLAIN) {
+            put_fixed32_le(&_buffer, 0);
+            put_fixed32_le(&_buffer, 0);
+            _buffer.append(_values.data(), count * SIZE_OF_TYPE);
+            return;
+        }
+        put_fixed32_le(&_buffer, cast_set<uint32_t>(exceptions));
+        put_fixed32_le(&_buffer, cast_set<uint32_t>(for_buffer.size()));
+        _buffer.append(for_buffer.data(), for_buffer.size());
+        for (uint32_t position : exception_positions) {
+            put_fixed32_le(&_buffer, position);
+        }
+        for (uint32_t position : exception_positions) {
+            _buffer.append(&_values[position], SIZE_OF_TYPE);
+        }
+    }
+
+    PageBuilderOptions _options;
+    size_t _capacity = 0;
+    bool _finished = false;
+    std::vector<CppType> _values;
+    faststring _buffer;
+    CppType _first_value;
+    CppType _last_value;
+};
+
+// Decodes the whole page in init(), the integers are restored in batches of a frame so the
+// multiplications are vectorized, and then the exceptions are patched.
+template <FieldType Type>
+class AlpPageDecoder : public PageDecoder {
+public:
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < ALP_PAGE_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for header in AlpPageDecoder: {}",
+                                      _data.size);
+        }
+        const auto* header = reinterpret_cast<const uint8_t*>(_data.data);
+        _num_elements = decode_fixed32_le(header);
+        uint8_t mode = header[4];
+        uint8_t exponent = header[5];
+        uint8_t factor = header[6];
+        uint32_t exceptions = decode_fixed32_le(header + 8);
+        uint32_t for_size = decode_fixed32_le(header + 12);
+        const uint8_t* body = header + ALP_PAGE_HEADER_SIZE;
+        size_t body_size = _data.size - ALP_PAGE_HEADER_SIZE;
+
+        RETURN_IF_CATCH_EXCEPTION(_values.reset(new CppType[_num_elements]));
+        if (mode == ALP_PAGE_MODE_PLAIN) {
+            if (body_size != size_t(_num_elements) * SIZE_OF_TYPE) {
+                return Status::Corruption("invalid plain size in AlpPageDecoder: {}, count: {}",
+                                          body_size, _num_elements);
+            }
+            memcpy(_values.get(), body, body_size);
+            _parsed = true;
+            return Status::OK();
+        }
+        if (mode != ALP_PAGE_MODE_ALP || exponent > AlpConstants<CppType>::MAX_EXPONENT ||
+            factor > exponent ||
+            body_size != for_size + size_t(exceptions) * (sizeof(uint32_t) + SIZE_OF_TYPE)) {
+            return Status::Corruption(
+                    "invalid header in AlpPageDecoder, mode: {}, exponent: {}, factor: {}, "
+                    "exceptions: {}, for size: {}, page size: {}",
+                    mode, exponent, factor, exceptions, for_size, _data.size);
+        }
+
+        if (_num_elements > 0) {
+            ForDecoder<int64_t> decoder(body, for_size);
+            if (!decoder.init() || decoder.count() != _num_elements) {
+                return Status::Corruption("The frame of reference data of alp page maybe broken");
+            }
+            int64_t encoded[DECODE_BATCH_SIZE];
+            for (size_t start = 0; start < _num_elements; start += DECODE_BATCH_SIZE) {
+                size_t batch = std::min<size_t>(DECODE_BATCH_SIZE, _num_elements - start);
+                if (!decoder.get_batch(encoded, batch)) {
+                    return Status::Corruption("not enough values in the alp page: {}",
+                                              _num_elements);
+                }
+                CppType* values = _values.get() + start;
+                for (size_t i = 0; i < batch; ++i) {
+                    values[i] = alp_decode_value<CppType>(encoded[i], exponent, factor);
+                }
+            }
+        }
+
+        const uint8_t* positions = body + for_size;
+        const uint8_t* exception_values = positions + size_t(exceptions) * sizeof(uint32_t);
+        for (uint32_t i = 0; i < exceptions; ++i) {
+            uint32_t position = decode_fixed32_le(positions + size_t(i) * sizeof(uint32_t));
+            if (position >= _num_elements) {
+                return Status::Corruption("invalid exception position in AlpPageDecoder: {}",
+                                          position);
+            }
+            memcpy(&_values[position], exception_values + size_t(i) * SIZE_OF_TYPE, SIZE_OF_TYPE);
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init()";
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<true>(n, dst);
+    }
+
+    template <bool forward_index>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_index >= _num_elements) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        dst->insert_many_fix_len_data(reinterpret_cast<const char*>(&_values[_cur_index]),
+                                      max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            return Status::OK();
+        }
+        auto total = *n;
+        size_t read_count = 0;
+        _buffer.resize(total);
+        for (size_t i = 0; i < total; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (ord >= _num_elements) [[unlikely]] {
+                break;
+            }
+            _buffer[read_count++] = _values[ord];
+        }
+        if (read_count > 0) [[likely]] {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    static constexpr size_t DECODE_BATCH_SIZE = 1024;
+
+    Slice _data;
+    bool _parsed = false;
+    uint32_t _num_elements = 0;
+    size_t _cur_index = 0;
+    std::unique_ptr<CppType[]> _values;
+    std::vector<CppType> _buffer;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -19,6 +19,10 @@
 
 #include <glog/logging.h>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace doris {
 namespace segment_v2 {
 
@@ -40,12 +44,25 @@ void BlockSplitBloomFilter::add_hash(uint64_t hash) {
     }
 }
 
-bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
+bool BlockSplitBloomFilter::_test_hash(uint64_t hash) const {
     // most significant 32 bit mod block size as block index(BTW:block size is
     // power of 2)
     const uint32_t bucket_index =
             static_cast<uint32_t>((hash >> 32) & (_num_bytes / BYTES_PER_BLOCK - 1));
     uint32_t key = static_cast<uint32_t>(hash);
+#ifdef __AVX2__
+    // The 8 masks of a block are computed and tested at once, the same as
+    // BlockBloomFilter::find_avx2 of the runtime filter.
+    static_assert(BYTES_PER_BLOCK == sizeof(__m256i));
+    const __m256i salt = _mm256_setr_epi32(SALT[0], SALT[1], SALT[2], SALT[3], SALT[4], SALT[5],
+                                           SALT[6], SALT[7]);
+    __m256i mask = _mm256_mullo_epi32(_mm256_set1_epi32(key), salt);
+    mask = _mm256_sllv_epi32(_mm256_set1_epi32(1), _mm256_srli_epi32(mask, 27));
+    // The data of the filter is not aligned to 32 bytes.
+    const __m256i bucket =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(_data) + bucket_index);
+    return _mm256_testc_si256(bucket, mask);
+#else
     uint32_t* bitset32 = reinterpret_cast<uint32_t*>(_data);
 
     // Calculate masks for bucket.
@@ -58,6 +75,16 @@ bool BlockSplitBloomFilter::test_hash(uint64_t hash) const {
         }
     }
     return true;
+#endif
+}
+
+bool BlockSplitBloomFilter::test_any_hash(const uint64_t* hashes, size_t num_hashes) const {
+    for (size_t i = 0; i < num_hashes; ++i) {
+        if (_test_hash(hashes[i])) {
+            return true;
+        }
+    }
+    return false;
 }
 
 } // namespace segment_v2
@@ -33,7 +33,9 @@ class BlockSplitBloomFilter : public BloomFilter {
 public:
     void add_hash(uint64_t hash) override;
 
-    bool test_hash(uint64_t hash) const override;
+    bool test_hash(uint64_t hash) const override { return _test_hash(hash); }
+
+    bool test_any_hash(const uint64_t* hashes, size_t num_hashes) const override;
 
 private:
     // Bytes in a tiny Bloom filter block.
@@ -50,6 +52,8 @@ private:
     };
 
 private:
+    bool _test_hash(uint64_t hash) const;
+
     void _set_masks(uint32_t key, BlockMask& block_mask) const {
         for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
             block_mask.item[i] = key * SALT[i];
@@ -52,6 +52,7 @@
 #include "olap/rowset/segment_v2/page_handle.h" // for PageHandle
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h" // for PagePointer
+#include "olap/rowset/segment_v2/page_prefetcher.h"
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "olap/rowset/segment_v2/zone_map_index.h"
@@ -941,9 +942,21 @@ StructFileColumnIterator::StructFileColumnIterator(
     }
 }
 
+void StructFileColumnIterator::set_read_sub_columns(std::vector<bool> read_sub_columns) {
+    auto first = std::find(read_sub_columns.begin(), read_sub_columns.end(), true);
+    if (read_sub_columns.size() != _sub_column_iterators.size() ||
+        first == read_sub_columns.end()) {
+        return;
+    }
+    _first_read_sub_column = first - read_sub_columns.begin();
+    _read_sub_columns = std::move(read_sub_columns);
+}
+
 Status StructFileColumnIterator::init(const ColumnIteratorOptions& opts) {
-    for (auto& column_iterator : _sub_column_iterators) {
-        RETURN_IF_ERROR(column_iterator->init(opts));
+    for (size_t i = 0; i < _sub_column_iterators.size(); i++) {
+        if (_need_read(i)) {
+            RETURN_IF_ERROR(_sub_column_iterators[i]->init(opts));
+        }
     }
     if (_struct_reader->is_nullable()) {
         RETURN_IF_ERROR(_null_iterator->init(opts));
@@ -959,6 +972,10 @@ Status StructFileColumnIterator::next_batch(size_t* n, vectorized::MutableColumn
     for (size_t i = 0; i < column_struct->tuple_size(); i++) {
         size_t num_read = *n;
         auto sub_column_ptr = column_struct->get_column(i).assume_mutable();
+        if (!_need_read(i)) {
+            sub_column_ptr->insert_many_defaults(num_read);
+            continue;
+        }
         bool column_has_null = false;
         RETURN_IF_ERROR(
                 _sub_column_iterators[i]->next_batch(&num_read, sub_column_ptr, &column_has_null));
@@ -988,8 +1005,10 @@ Status StructFileColumnIterator::next_batch(size_t* n, vectorized::MutableColumn
 }
 
 Status StructFileColumnIterator::seek_to_ordinal(ordinal_t ord) {
-    for (auto& column_iterator : _sub_column_iterators) {
-        RETURN_IF_ERROR(column_iterator->seek_to_ordinal(ord));
+    for (size_t i = 0; i < _sub_column_iterators.size(); i++) {
+        if (_need_read(i)) {
+            RETURN_IF_ERROR(_sub_column_iterators[i]->seek_to_ordinal(ord));
+        }
     }
     if (_struct_reader->is_nullable()) {
         RETURN_IF_ERROR(_null_iterator->seek_to_ordinal(ord));
@@ -1193,6 +1212,7 @@ Status FileColumnIterator::init(const ColumnIteratorOptions& opts) {
             _is_all_dict_encoding = dict_encoding_type == ColumnReader::ALL_DICT_ENCODING;
         }
     }
+    _prefetcher = PagePrefetcher::create(_reader, _opts);
     return Status::OK();
 }
 
@@ -1247,6 +1267,104 @@ Status FileColumnIterator::next_batch_of_zone_map(size_t* n, vectorized::Mutable
     return _reader->next_batch_of_zone_map(n, dst);
 }
 
+namespace {
+
+// Dispatches a column to `f` if it is one of `ColumnTypes`, which store their values in one
+// contiguous array.
+template <typename... ColumnTypes>
+struct FixedColumnDispatcher {
+    template <typename F>
+    static bool apply(vectorized::IColumn& column, F&& f) {
+        return ((typeid(column) == typeid(ColumnTypes) &&
+                 (f(assert_cast<ColumnTypes&, TypeCheckOnRelease::DISABLE>(column)), true)) ||
+                ...);
+    }
+};
+
+using NullableBulkColumns = FixedColumnDispatcher<
+        vectorized::ColumnUInt8, vectorized::ColumnInt8, vectorized::ColumnInt16,
+        vectorized::ColumnInt32, vectorized::ColumnInt64, vectorized::ColumnInt128,
+        vectorized::ColumnFloat32, vectorized::ColumnFloat64, vectorized::ColumnDate,
+        vectorized::ColumnDateTime, vectorized::ColumnDateV2, vectorized::ColumnDateTimeV2,
+        vectorized::ColumnIPv4, vectorized::ColumnIPv6, vectorized::ColumnDecimal32,
+        vectorized::ColumnDecimal64, vectorized::ColumnDecimal128V2,
+        vectorized::ColumnDecimal128V3, vectorized::ColumnDecimal256>;
+
+// Moves the `num_values` values at the beginning of `data` to the rows which are not null in
+// `null_map`, and sets the null rows to the default value. The rows are visited backwards, so
+// that a value is always moved to a row after it, and the loop has no branch.
+template <typename T>
+void expand_by_null_map(T* __restrict data, const uint8_t* __restrict null_map, size_t num_rows,
+                        size_t num_values) {
+    size_t value_index = num_values;
+    for (size_t i = num_rows; i-- > 0;) {
+        const bool is_null = null_map[i];
+        value_index -= static_cast<size_t>(!is_null);
+        // value_index is valid even for a null row, as num_values > 0.
+        const T value = data[value_index];
+        data[i] = is_null ? T() : value;
+    }
+    DCHECK_EQ(value_index, size_t(0));
+}
+
+} // namespace
+
+Status FileColumnIterator::_next_batch_nullable_bulk(size_t nrows,
+                                                     vectorized::MutableColumnPtr& column,
+                                                     bool* has_null, bool* done) {
+    *done = false;
+    auto* dst = vectorized::check_and_get_column<vectorized::ColumnNullable>(column.get());
+    if (dst == nullptr) {
+        return Status::OK();
+    }
+    auto& nested = const_cast<vectorized::IColumn&>(dst->get_nested_column());
+    if (!NullableBulkColumns::apply(nested, [](auto&) {})) {
+        return Status::OK();
+    }
+    *done = true;
+
+    // Decodes the null runs into the null map first.
+    auto& null_map = const_cast<vectorized::ColumnNullable*>(dst)->get_null_map_data();
+    const size_t old_size = null_map.size();
+    DCHECK_EQ(old_size, nested.size());
+    null_map.resize(old_size + nrows);
+    uint8_t* null_flags = null_map.data() + old_size;
+    size_t num_values = 0;
+    for (size_t offset = 0; offset < nrows;) {
+        bool is_null = false;
+        size_t this_run = _page.null_decoder.GetNextRun(&is_null, nrows - offset);
+        memset(null_flags + offset, is_null, this_run);
+        if (is_null) {
+            *has_null = true;
+        } else {
+            num_values += this_run;
+        }
+        offset += this_run;
+    }
+
+    // Then decodes all the values of the rows at once, and scatters them by the null map.
+    if (num_values > 0) {
+        auto nested_ptr = nested.assume_mutable();
+        size_t num_read = num_values;
+        RETURN_IF_ERROR(_page.data_decoder->next_batch(&num_read, nested_ptr));
+        DCHECK_EQ(num_values, num_read);
+    }
+    NullableBulkColumns::apply(nested, [&](auto& nested_column) {
+        using T = typename std::decay_t<decltype(nested_column)>::value_type;
+        auto& data = nested_column.get_data();
+        data.resize(old_size + nrows);
+        if (num_values > 0) {
+            expand_by_null_map(data.data() + old_size, null_flags, nrows, num_values);
+        } else {
+            std::fill(data.data() + old_size, data.data() + old_size + nrows, T());
+        }
+    });
+
+    _page.offset_in_page += nrows;
+    _current_ordinal += nrows;
+    return Status::OK();
+}
+
 Status FileColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr& dst,
                                       bool* has_null) {
     size_t curr_size = dst->byte_size();
@@ -1266,7 +1384,10 @@ Status FileColumnIterator::next_batch(size_t* n, vectorized::MutableColumnPtr& d
         size_t nrows_in_page = std::min(remaining, _page.remaining());
         size_t nrows_to_read = nrows_in_page;
         if (_page.has_null) {
-            while (nrows_to_read > 0) {
+            bool read_in_bulk = false;
+            RETURN_IF_ERROR(
+                    _next_batch_nullable_bulk(nrows_to_read, dst, has_null, &read_in_bulk));
+            while (!read_in_bulk && nrows_to_read > 0) {
                 bool is_null = false;
                 size_t this_run = _page.null_decoder.GetNextRun(&is_null, nrows_to_read);
                 // we use num_rows only for CHECK
@@ -1401,8 +1522,19 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
     Slice page_body;
     PageFooterPB footer;
     _opts.type = DATA_PAGE;
+    const bool prefetched = _prefetcher != nullptr && _prefetcher->consume(iter.page_index());
+    const int64_t cached_pages_num = _opts.stats->cached_pages_num;
     RETURN_IF_ERROR(
             _reader->read_page(_opts, iter.page(), &handle, &page_body, &footer, _compress_codec));
+    if (_prefetcher != nullptr) {
+        if (_opts.stats->cached_pages_num == cached_pages_num) {
+            // the iterator waited on the file for the page
+            _opts.stats->page_prefetch_miss_num++;
+        } else if (prefetched) {
+            _opts.stats->page_prefetch_hit_num++;
+        }
+        _prefetcher->prefetch_after(iter);
+    }
     // parse data page
     RETURN_IF_ERROR(ParsedPage::create(std::move(handle), page_body, footer.data_page_footer(),
                                        _reader->encoding_info(), iter.page(), iter.page_index(),
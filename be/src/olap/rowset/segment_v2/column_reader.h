@@ -352,6 +352,8 @@ protected:
 
 // This iterator is used to read column data from file
 // for scalar type
+class PagePrefetcher;
+
 class FileColumnIterator final : public ColumnIterator {
 public:
     explicit FileColumnIterator(ColumnReader* reader);
@@ -395,6 +397,10 @@ private:
     Status _seek_to_pos_in_page(ParsedPage* page, ordinal_t offset_in_page) const;
     Status _load_next_page(bool* eos);
     Status _read_data_page(const OrdinalPageIndexIterator& iter);
+    // Reads `nrows` rows of the current page, which has nulls, into `dst` with one decoder call.
+    // Returns false in `*done` if `dst` is not nullable or its nested column is not supported.
+    Status _next_batch_nullable_bulk(size_t nrows, vectorized::MutableColumnPtr& dst,
+                                     bool* has_null, bool* done);
     Status _read_dict_data();
 
     ColumnReader* _reader = nullptr;
@@ -423,6 +429,9 @@ private:
     bool _is_all_dict_encoding = false;
 
     std::unique_ptr<StringRef[]> _dict_word_info;
+
+    // reads the following pages ahead, nullptr if page prefetch is disabled for this column
+    std::unique_ptr<PagePrefetcher> _prefetcher;
 };
 
 class EmptyFileColumnIterator final : public ColumnIterator {
@@ -507,13 +516,22 @@ public:
     Status seek_to_ordinal(ordinal_t ord) override;
 
     ordinal_t get_current_ordinal() const override {
-        return _sub_column_iterators[0]->get_current_ordinal();
+        return _sub_column_iterators[_first_read_sub_column]->get_current_ordinal();
     }
 
+    // Only reads the sub columns flagged in `read_sub_columns`, the others are filled with
+    // defaults. Must be called before init.
+    void set_read_sub_columns(std::vector<bool> read_sub_columns);
+
 private:
+    bool _need_read(size_t i) const { return _read_sub_columns.empty() || _read_sub_columns[i]; }
+
     ColumnReader* _struct_reader = nullptr;
     std::unique_ptr<ColumnIterator> _null_iterator;
     std::vector<std::unique_ptr<ColumnIterator>> _sub_column_iterators;
+    // empty if all the sub columns are read
+    std::vector<bool> _read_sub_columns;
+    size_t _first_read_sub_column = 0;
 };
 
 class ArrayFileColumnIterator final : public ColumnIterator {
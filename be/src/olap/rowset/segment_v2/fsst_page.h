@@ -0,0 +1,403 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page encoding for strings with FSST compression.
+//
+// Every string is compressed on its own with a symbol table learned from the page, so a string
+// is decompressed without the others, and equality is evaluated on the compressed strings.
+// The strings are stored uncompressed and the symbol table is empty when the compression does
+// not make the page smaller.
+//
+// The page consists of:
+// Strings:
+//   compressed strings
+// Trailer
+//  Offsets:
+//    offsets pointing to the beginning of each compressed string
+//  SymbolTable (see FsstSymbolTable)
+//  symbol_table_size (32-bit fixed)
+//  num_elems (32-bit fixed)
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "common/cast_set.h"
+#include "common/logging.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/fsst_coding.h"
+
+namespace doris {
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+static const size_t FSST_PAGE_TRAILER_SIZE = 2 * sizeof(uint32_t);
+
+template <FieldType Type>
+class FsstPageBuilder : public PageBuilderHelper<FsstPageBuilder<Type>> {
+public:
+    using Self = FsstPageBuilder<Type>;
+    friend class PageBuilderHelper<Self>;
+
+    Status init() override { return reset(); }
+
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        size_t i = 0;
+        while (!is_page_full() && i < *count) {
+            const auto* src = reinterpret_cast<const Slice*>(vals);
+            _offsets.push_back(cast_set<uint32_t>(_buffer.size()));
+            RETURN_IF_CATCH_EXCEPTION(_buffer.append(src->data, src->size));
+            _size_estimate += src->size + sizeof(uint32_t);
+            i++;
+            vals += sizeof(Slice);
+        }
+        *count = i;
+        return Status::OK();
+    }
+
+    Status finish(OwnedSlice* slice) override {
+        DCHECK(!_finished);
+        _finished = true;
+        RETURN_IF_CATCH_EXCEPTION({
+            if (!_offsets.empty()) {
+                Slice first = _value_at(0);
+                _first_value.assign_copy(reinterpret_cast<const uint8_t*>(first.data), first.size);
+                Slice last = _value_at(_offsets.size() - 1);
+                _last_value.assign_copy(reinterpret_cast<const uint8_t*>(last.data), last.size);
+            }
+            _compress(slice);
+        });
+        return Status::OK();
+    }
+
+    Status reset() override {
+        RETURN_IF_CATCH_EXCEPTION({
+            _offsets.clear();
+            _buffer.clear();
+            _buffer.reserve(_options.data_page_size == 0 ? 1024 : _options.data_page_size);
+        });
+        _size_estimate = FSST_PAGE_TRAILER_SIZE;
+        _finished = false;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (_offsets.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+        return Status::OK();
+    }
+
+private:
+    explicit FsstPageBuilder(const PageBuilderOptions& options) : _options(options) {}
+
+    Slice _value_at(size_t idx) const {
+        size_t end = idx + 1 < _offsets.size() ? _offsets[idx + 1] : _buffer.size();
+        return Slice(&_buffer[_offsets[idx]], end - _offsets[idx]);
+    }
+
+    void _compress(OwnedSlice* slice) {
+        std::vector<Slice> values(_offsets.size());
+        for (size_t i = 0; i < _offsets.size(); ++i) {
+            values[i] = _value_at(i);
+        }
+        FsstSymbolTable table;
+        table.build(values.data(), values.size());
+        faststring table_buffer;
+        table.serialize(&table_buffer);
+
+        faststring page;
+        std::vector<uint32_t> offsets(_offsets.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            offsets[i] = cast_set<uint32_t>(page.size());
+            table.compress(values[i], &page);
+        }
+        if (page.size() + table_buffer.size() >= _buffer.size()) {
+            // Stored uncompressed with an empty symbol table.
+            page.clear();
+            page.append(_buffer.data(), _buffer.size());
+            offsets = _offsets;
+            table_buffer.clear();
+            FsstSymbolTable().serialize(&table_buffer);
+        }
+        for (uint32_t offset : offsets) {
+            put_fixed32_le(&page, offset);
+        }
+        page.append(table_buffer.data(), table_buffer.size());
+        put_fixed32_le(&page, cast_set<uint32_t>(table_buffer.size()));
+        put_fixed32_le(&page, cast_set<uint32_t>(offsets.size()));
+        *slice = page.build();
+    }
+
+    PageBuilderOptions _options;
+    // The uncompressed strings, they are compressed when the page is finished.
+    faststring _buffer;
+    std::vector<uint32_t> _offsets;
+    size_t _size_estimate = 0;
+    bool _finished = false;
+    faststring _first_value;
+    faststring _last_value;
+};
+
+template <FieldType Type>
+class FsstPageDecoder : public PageDecoder {
+public:
+    FsstPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < FSST_PAGE_TRAILER_SIZE) {
+            return Status::Corruption(
+                    "file corruption: not enough bytes for trailer in FsstPageDecoder, size: {}",
+                    _data.size);
+        }
+        const auto* trailer =
+                reinterpret_cast<const uint8_t*>(_data.data + _data.size - FSST_PAGE_TRAILER_SIZE);
+        uint32_t table_size = decode_fixed32_le(trailer);
+        _num_elems = decode_fixed32_le(trailer + sizeof(uint32_t));
+        size_t trailer_size = FSST_PAGE_TRAILER_SIZE + table_size + size_t(_num_elems) * 4;
+        if (trailer_size > _data.size) {
+            return Status::Corruption(
+                    "file corruption: trailer beyonds data size in FsstPageDecoder, size: {}, "
+                    "num_element: {}, symbol table size: {}",
+                    _data.size, _num_elems, table_size);
+        }
+        _offsets_pos = cast_set<uint32_t>(_data.size - trailer_size);
+        const auto* table = reinterpret_cast<const uint8_t*>(_data.data + _offsets_pos) +
+                            size_t(_num_elems) * sizeof(uint32_t);
+        size_t parsed_table_size = 0;
+        if (!_table.deserialize(table, table_size, &parsed_table_size) ||
+            parsed_table_size != table_size) {
+            return Status::Corruption("file corruption: invalid symbol table in FsstPageDecoder");
+        }
+        _compressed = _table.symbol_num() > 0;
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed);
+        if (pos > _num_elems) [[unlikely]] {
+            return Status::Error<ErrorCode::INTERNAL_ERROR, false>(
+                    "seek pos {} is larger than total elements  {}", pos, _num_elems);
+        }
+        _cur_idx = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0 || _cur_idx >= _num_elems) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+        const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        _offsets.resize(max_fetch + 1);
+        if (!_compressed) {
+            for (size_t i = 0; i <= max_fetch; ++i) {
+                _offsets[i] = _offset(_cur_idx + i);
+            }
+            dst->insert_many_continuous_binary_data(_data.data, _offsets.data(), max_fetch);
+        } else {
+            size_t compressed_size = _offset(_cur_idx + max_fetch) - _offset(_cur_idx);
+            RETURN_IF_CATCH_EXCEPTION(
+                    _decompressed.resize(FsstSymbolTable::decompress_bound(compressed_size)));
+            _offsets[0] = 0;
+            for (size_t i = 0; i < max_fetch; ++i) {
+                _offsets[i + 1] =
+                        _offsets[i] + _decompress_at(_cur_idx + i, _decompressed.data() + _offsets[i]);
+            }
+            dst->insert_many_continuous_binary_data(_decompressed.data(), _offsets.data(),
+                                                    max_fetch);
+        }
+        _cur_idx += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    // Only the strings of the rows are decompressed.
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (*n == 0) [[unlikely]] {
+            return Status::OK();
+        }
+        auto total = *n;
+        size_t read_count = 0;
+        size_t compressed_size = 0;
+        for (; read_count < total; ++read_count) {
+            ordinal_t ord = rowids[read_count] - page_first_ordinal;
+            if (ord >= _num_elems) [[unlikely]] {
+                break;
+            }
+            compressed_size += _offset(ord + 1) - _offset(ord);
+        }
+        if (read_count == 0) [[unlikely]] {
+            *n = 0;
+            return Status::OK();
+        }
+
+        _offsets.resize(read_count + 1);
+        _offsets[0] = 0;
+        size_t bound = _compressed ? FsstSymbolTable::decompress_bound(compressed_size)
+                                   : compressed_size;
+        RETURN_IF_CATCH_EXCEPTION(_decompressed.resize(bound));
+        for (size_t i = 0; i < read_count; ++i) {
+            size_t ord = rowids[i] - page_first_ordinal;
+            _offsets[i + 1] = _offsets[i] + _decompress_at(ord, _decompressed.data() + _offsets[i]);
+        }
+        dst->insert_many_continuous_binary_data(_decompressed.data(), _offsets.data(), read_count);
+        *n = read_count;
+        return Status::OK();
+    }
+
+    // Evaluates `row == value` for the next *n rows on the compressed strings, without
+    // decompressing them.
+    Status next_batch_equal(const Slice& value, size_t* n, uint8_t* matches) {
+        DCHECK(_parsed);
+        const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        Slice target = value;
+        if (_compressed) {
+            _compressed_value.clear();
+            _table.compress(value, &_compressed_value);
+            target = Slice(_compressed_value.data(), _compressed_value.size());
+        }
+        for (size_t i = 0; i < max_fetch; ++i) {
+            Slice row = _raw_at(_cur_idx + i);
+            matches[i] = row.size == target.size &&
+                         memcmp(row.data, target.data, target.size) == 0;
+        }
+        _cur_idx += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    // Evaluates whether the next *n rows start with `prefix`. A row whose compressed string
+    // starts with the compressed prefix matches without being decompressed, the others are
+    // decompressed since a symbol may cross the end of the prefix.
+    Status next_batch_prefix(const Slice& prefix, size_t* n, uint8_t* matches) {
+        DCHECK(_parsed);
+        const size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elems - _cur_idx));
+        Slice target = prefix;
+        if (_compressed) {
+            _compressed_value.clear();
+            _table.compress(prefix, &_compressed_value);
+            target = Slice(_compressed_value.data(), _compressed_value.size());
+        }
+        for (size_t i = 0; i < max_fetch; ++i) {
+            Slice row = _raw_at(_cur_idx + i);
+            matches[i] = row.size >= target.size &&
+                         memcmp(row.data, target.data, target.size) == 0;
+            if (!matches[i] && _compressed) {
+                RETURN_IF_CATCH_EXCEPTION(
+                        _decompressed.resize(FsstSymbolTable::decompress_bound(row.size)));
+                size_t size = _table.decompress(reinterpret_cast<const uint8_t*>(row.data),
+                                                row.size,
+                                                reinterpret_cast<uint8_t*>(_decompressed.data()));
+                matches[i] = size >= prefix.size &&
+                             memcmp(_decompressed.data(), prefix.data, prefix.size) == 0;
+            }
+        }
+        _cur_idx += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elems;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_idx;
+    }
+
+private:
+    uint32_t _offset(size_t idx) const {
+        if (idx >= _num_elems) {
+            return _offsets_pos;
+        }
+        return decode_fixed32_le(
+                reinterpret_cast<const uint8_t*>(&_data[_offsets_pos + idx * sizeof(uint32_t)]));
+    }
+
+    // The stored bytes of the string of the row.
+    Slice _raw_at(size_t idx) const {
+        uint32_t start = _offset(idx);
+        return Slice(&_data[start], _offset(idx + 1) - start);
+    }
+
+    // Writes the string of the row to `output`, returns its size.
+    uint32_t _decompress_at(size_t idx, char* output) const {
+        Slice row = _raw_at(idx);
+        if (!_compressed) {
+            memcpy(output, row.data, row.size);
+            return cast_set<uint32_t>(row.size);
+        }
+        return cast_set<uint32_t>(_table.decompress(reinterpret_cast<const uint8_t*>(row.data),
+                                                    row.size,
+                                                    reinterpret_cast<uint8_t*>(output)));
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    bool _compressed = false;
+    uint32_t _num_elems = 0;
+    uint32_t _offsets_pos = 0;
+    FsstSymbolTable _table;
+
+    std::vector<uint32_t> _offsets;
+    std::vector<char> _decompressed;
+    faststring _compressed_value;
+
+    // Index of the currently seeked element in the page.
+    size_t _cur_idx = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
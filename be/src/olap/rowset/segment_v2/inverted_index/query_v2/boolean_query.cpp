@@ -73,8 +73,15 @@ int64_t BooleanQuery::cost() const {
     return visit_node(_op, Cost {});
 }
 
+void BooleanQuery::read_bitmap(roaring::Roaring* result) const {
+    visit_node(_op, ReadBitmap {}, result);
+}
+
 bool BooleanQuery::should_use_skip() {
-    return visit_node(_op, Cost {});
+    if (const auto* op = std::get_if<ConjunctionOpPtr>(&_op)) {
+        return (*op)->should_use_skip();
+    }
+    return false;
 }
 
 void BooleanQuery::search_by_skiplist(const std::shared_ptr<roaring::Roaring>& result) {
@@ -86,6 +93,10 @@ void BooleanQuery::search_by_skiplist(const std::shared_ptr<roaring::Roaring>& r
     }
 }
 
-void BooleanQuery::search_by_bitmap(const std::shared_ptr<roaring::Roaring>& result) {}
+void BooleanQuery::search_by_bitmap(const std::shared_ptr<roaring::Roaring>& result) {
+    roaring::Roaring docs;
+    read_bitmap(&docs);
+    *result |= docs;
+}
 
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
@@ -35,6 +35,8 @@ public:
     int32_t advance(int32_t target) const;
     int64_t cost() const;
 
+    void read_bitmap(roaring::Roaring* result) const;
+
     class Builder {
     public:
         Status set_op(OperatorType type);
@@ -91,4 +91,26 @@ int64_t ConjunctionOp::cost() const {
     return visit_node(*_lead1, Cost {});
 }
 
+void ConjunctionOp::read_bitmap(roaring::Roaring* result) const {
+    visit_node(*_lead1, ReadBitmap {}, result);
+    auto intersect = [&](const Node& node) {
+        if (result->isEmpty()) {
+            return;
+        }
+        roaring::Roaring other;
+        visit_node(node, ReadBitmap {}, &other);
+        *result &= other;
+    };
+    intersect(*_lead2);
+    for (const auto* other : _others) {
+        intersect(*other);
+    }
+}
+
+bool ConjunctionOp::should_use_skip() const {
+    int64_t little = visit_node(*_lead1, Cost {});
+    int64_t big = visit_node(_childrens.back(), Cost {});
+    return little == 0 || big / little > SKIP_COST_RATIO;
+}
+
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
@@ -33,9 +33,18 @@ public:
     int32_t advance(int32_t target) const;
     int64_t cost() const;
 
+    // Reads the doc ids of the children as bitmaps and intersects them, from the cheapest one.
+    void read_bitmap(roaring::Roaring* result) const;
+    // Galloping over the skip lists is cheaper than reading every posting list when the
+    // cheapest child is far more selective than the most expensive one.
+    bool should_use_skip() const;
+
 private:
     int32_t do_next(int32_t doc) const;
 
+    // Same as the default inverted_index_conjunction_opt_threshold of the v1 conjunction query.
+    static constexpr int64_t SKIP_COST_RATIO = 1000;
+
     const Node* _lead1 = nullptr;
     const Node* _lead2 = nullptr;
     std::vector<const Node*> _others;
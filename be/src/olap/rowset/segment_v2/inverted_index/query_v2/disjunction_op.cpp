@@ -83,4 +83,12 @@ int64_t DisjunctionOp::cost() const {
     return _cost;
 }
 
+void DisjunctionOp::read_bitmap(roaring::Roaring* result) const {
+    for (const auto& child : _childrens) {
+        roaring::Roaring other;
+        visit_node(child, ReadBitmap {}, &other);
+        *result |= other;
+    }
+}
+
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
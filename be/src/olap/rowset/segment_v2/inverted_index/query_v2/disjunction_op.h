@@ -35,6 +35,8 @@ public:
     int32_t advance(int32_t target) const;
     int64_t cost() const;
 
+    void read_bitmap(roaring::Roaring* result) const;
+
 private:
     class DisiWrapper {
     public:
@@ -125,4 +125,11 @@ struct Cost {
     }
 };
 
+struct ReadBitmap {
+    template <typename T>
+    void operator()(const T& node, roaring::Roaring* result) const {
+        node->read_bitmap(result);
+    }
+};
+
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
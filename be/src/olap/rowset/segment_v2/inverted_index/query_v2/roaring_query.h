@@ -52,6 +52,8 @@ public:
 
     int64_t cost() const { return _roaring->cardinality(); }
 
+    void read_bitmap(roaring::Roaring* result) const { *result |= *_roaring; }
+
 private:
     mutable int32_t _doc = -1;
     std::shared_ptr<roaring::Roaring> _roaring;
@@ -33,4 +33,15 @@ TermQuery::TermQuery(const std::shared_ptr<lucene::search::IndexSearcher>& searc
                                  query_info.terms[0]);
 }
 
+void TermQuery::read_bitmap(roaring::Roaring* result) const {
+    DocRange doc_range;
+    while (_iter->read_range(&doc_range)) {
+        if (doc_range.type_ == DocRangeType::kMany) {
+            result->addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+        } else {
+            result->addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+        }
+    }
+}
+
 } // namespace doris::segment_v2::idx_query_v2
\ No newline at end of file
@@ -36,6 +36,9 @@ public:
     int32_t advance(int32_t target) const { return _iter->advance(target); }
     int64_t cost() const { return _iter->doc_freq(); }
 
+    // Reads the posting list by blocks of doc ids instead of one doc at a time.
+    void read_bitmap(roaring::Roaring* result) const;
+
 private:
     TermDocs* _term_docs = nullptr;
     TermIterPtr _iter;
@@ -141,4 +141,12 @@ void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roarin
     *handle = InvertedIndexQueryCacheHandle(this, lru_handle);
 }
 
+void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
+                                     InvertedIndexQueryCacheHandle* handle, int64_t compute_ns) {
+    if (compute_ns < config::inverted_index_query_cache_admission_min_us * 1000) {
+        return;
+    }
+    insert(key, std::move(bitmap), handle);
+}
+
 } // namespace doris::segment_v2
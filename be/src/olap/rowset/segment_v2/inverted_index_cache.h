@@ -235,6 +235,11 @@ public:
 
     void insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
                 InvertedIndexQueryCacheHandle* handle);
+
+    // Inserts the result of a query which took `compute_ns` to compute, the result is not
+    // cached if it is cheaper than inverted_index_query_cache_admission_min_us.
+    void insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
+                InvertedIndexQueryCacheHandle* handle, int64_t compute_ns);
 };
 
 class InvertedIndexQueryCacheHandle {
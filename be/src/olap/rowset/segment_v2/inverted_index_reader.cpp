@@ -54,6 +54,7 @@
 #include "runtime/runtime_state.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
 #include "vec/common/string_ref.h"
 
 namespace doris::segment_v2 {
@@ -381,6 +382,7 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
             return Status::OK();
         }
 
+        MonotonicStopWatch watch(true);
         InvertedIndexCacheHandle inverted_index_cache_handle;
         RETURN_IF_ERROR(
                 handle_searcher_cache(runtime_state, &inverted_index_cache_handle, io_ctx, stats));
@@ -391,7 +393,8 @@ Status FullTextIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatist
             RETURN_IF_ERROR(match_index_search(io_ctx, stats, runtime_state, query_type, query_info,
                                                *searcher_ptr, term_match_bitmap));
             term_match_bitmap->runOptimize();
-            cache->insert(cache_key, term_match_bitmap, &cache_handler);
+            cache->insert(cache_key, term_match_bitmap, &cache_handler,
+                          cast_set<int64_t>(watch.elapsed_time()));
             bit_map = term_match_bitmap;
         }
         return Status::OK();
@@ -451,6 +454,7 @@ Status StringTypeInvertedIndexReader::query(const io::IOContext* io_ctx,
             return Status::OK();
         }
 
+        MonotonicStopWatch watch(true);
         std::wstring column_name_ws = StringUtil::string_to_wstring(column_name);
 
         InvertedIndexQueryInfo query_info;
@@ -519,7 +523,7 @@ Status StringTypeInvertedIndexReader::query(const io::IOContext* io_ctx,
         }
         // add to cache
         result->runOptimize();
-        cache->insert(cache_key, result, &cache_handler);
+        cache->insert(cache_key, result, &cache_handler, cast_set<int64_t>(watch.elapsed_time()));
 
         bit_map = result;
         return Status::OK();
@@ -746,9 +750,10 @@ Status BkdIndexReader::query(const io::IOContext* io_ctx, OlapReaderStatistics*
             return Status::OK();
         }
 
+        MonotonicStopWatch watch(true);
         RETURN_IF_ERROR(invoke_bkd_query(io_ctx, stats, query_value, query_type, r, bit_map));
         bit_map->runOptimize();
-        cache->insert(cache_key, bit_map, &cache_handler);
+        cache->insert(cache_key, bit_map, &cache_handler, cast_set<int64_t>(watch.elapsed_time()));
 
         VLOG_DEBUG << "BKD index search column: " << column_name
                    << " result: " << bit_map->cardinality();
@@ -62,12 +62,12 @@ void NGramBloomFilter::add_bytes(const char* data, size_t len) {
 
 bool NGramBloomFilter::contains(const BloomFilter& bf_) const {
     const auto& bf = static_cast<const NGramBloomFilter&>(bf_);
+    // No early exit, the filter is small and the loop is vectorized.
+    UnderType missing = 0;
     for (size_t i = 0; i < words; ++i) {
-        if ((filter[i] & bf.filter[i]) != bf.filter[i]) {
-            return false;
-        }
+        missing |= ~filter[i] & bf.filter[i];
     }
-    return true;
+    return missing == 0;
 }
 } // namespace doris::segment_v2
 #include "common/compile_check_end.h"
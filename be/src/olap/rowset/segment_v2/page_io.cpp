@@ -141,6 +141,7 @@ Status PageIO::read_and_decompress_page_(const PageReadOptions& opts, PageHandle
         opts.stats->cached_pages_num++;
         // parse body and footer
         Slice page_slice = handle->data();
+        opts.stats->cached_pages_bytes += page_slice.size;
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         std::string footer_buf(page_slice.data + page_slice.size - 4 - footer_size, footer_size);
         if (!footer->ParseFromString(footer_buf)) {
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/page_prefetcher.h"
+
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <utility>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "io/io_common.h"
+#include "olap/olap_common.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/page_handle.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
+#include "util/block_compression.h"
+#include "util/threadpool.h"
+
+namespace doris::segment_v2 {
+#include "common/compile_check_begin.h"
+
+std::unique_ptr<PagePrefetcher> PagePrefetcher::create(ColumnReader* reader,
+                                                       const ColumnIteratorOptions& opts) {
+    if (!config::enable_segment_page_prefetch || config::segment_page_prefetch_depth <= 0 ||
+        !opts.is_predicate_column || !opts.use_page_cache ||
+        opts.io_ctx.reader_type != ReaderType::READER_QUERY ||
+        StoragePageCache::instance() == nullptr ||
+        ExecEnv::GetInstance()->segment_page_prefetch_thread_pool() == nullptr) {
+        return nullptr;
+    }
+    SCOPED_INIT_THREAD_CONTEXT();
+    if (!thread_context()->is_attach_task()) {
+        return nullptr;
+    }
+    return std::make_unique<PagePrefetcher>(reader, opts, thread_context()->resource_ctx());
+}
+
+PagePrefetcher::PagePrefetcher(ColumnReader* reader, const ColumnIteratorOptions& opts,
+                               std::shared_ptr<ResourceContext> resource_ctx)
+        : _reader(reader), _opts(opts), _resource_ctx(std::move(resource_ctx)) {
+    _opts.type = DATA_PAGE;
+}
+
+PagePrefetcher::~PagePrefetcher() {
+    std::unique_lock<std::mutex> l(_lock);
+    // The reads not started yet are skipped.
+    _stopped = true;
+    _cond.wait(l, [this]() { return _in_flight_pages.empty(); });
+}
+
+void PagePrefetcher::prefetch_after(const OrdinalPageIndexIterator& iter) {
+    auto* pool = ExecEnv::GetInstance()->segment_page_prefetch_thread_pool();
+    std::lock_guard<std::mutex> l(_lock);
+    // The pages before the current one are skipped by a seek and will not be consumed.
+    _issued_pages.erase(_issued_pages.begin(), _issued_pages.lower_bound(iter.page_index()));
+
+    OrdinalPageIndexIterator next = iter;
+    for (int32_t i = 0; i < config::segment_page_prefetch_depth; i++) {
+        next.next();
+        if (!next.valid()) {
+            break;
+        }
+        const int32_t page_index = next.page_index();
+        if (!_issued_pages.insert(page_index).second) {
+            continue;
+        }
+        _in_flight_pages.insert(page_index);
+        auto st = pool->submit_func([this, page_index, page_pointer = next.page()]() {
+            _read_page(page_index, page_pointer);
+        });
+        if (!st.ok()) {
+            // The pool is full, the iterator reads the page by itself.
+            _issued_pages.erase(page_index);
+            _in_flight_pages.erase(page_index);
+            break;
+        }
+    }
+}
+
+bool PagePrefetcher::consume(int32_t page_index) {
+    std::unique_lock<std::mutex> l(_lock);
+    _cond.wait(l, [&]() { return !_in_flight_pages.contains(page_index); });
+    return _issued_pages.erase(page_index) > 0;
+}
+
+void PagePrefetcher::_read_page(int32_t page_index, PagePointer page_pointer) {
+    bool stopped = false;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        stopped = _stopped;
+    }
+    if (!stopped) {
+        SCOPED_ATTACH_TASK(_resource_ctx);
+        // The statistics of the iterator are only updated by the iterator thread.
+        OlapReaderStatistics stats;
+        io::FileCacheStatistics file_cache_stats;
+        io::FileReaderStats file_reader_stats;
+        ColumnIteratorOptions opts = _opts;
+        opts.stats = &stats;
+        opts.io_ctx.file_cache_stats = &file_cache_stats;
+        opts.io_ctx.file_reader_stats = &file_reader_stats;
+
+        BlockCompressionCodec* codec = nullptr;
+        Status st = get_block_compression_codec(_reader->get_compression(), &codec);
+        if (st.ok()) {
+            PageHandle handle;
+            Slice page_body;
+            PageFooterPB footer;
+            st = _reader->read_page(opts, page_pointer, &handle, &page_body, &footer, codec);
+        }
+        if (!st.ok()) {
+            // The iterator reads the page again and reports the error.
+            LOG(WARNING) << "failed to prefetch page " << page_pointer << " of "
+                         << _opts.file_reader->path().native() << ": " << st;
+        }
+    }
+    std::lock_guard<std::mutex> l(_lock);
+    _in_flight_pages.erase(page_index);
+    _cond.notify_all();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::segment_v2
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/ordinal_page_index.h"
+#include "olap/rowset/segment_v2/page_pointer.h"
+
+namespace doris {
+class ResourceContext;
+
+namespace segment_v2 {
+#include "common/compile_check_begin.h"
+
+// Reads the data pages following the current page of a FileColumnIterator ahead on
+// SegmentPagePrefetchThreadPool. The pages are inserted into StoragePageCache, so the iterator
+// finds them in the cache when it reaches them instead of waiting on the file, which matters
+// when the file is on remote storage and not in the file cache.
+//
+// Only used by one iterator thread, the reads of the pool only touch the in-flight pages.
+class PagePrefetcher {
+public:
+    // Returns nullptr if the pages of the column can not be prefetched, e.g. the page cache is
+    // disabled or the current thread is not attached to a query.
+    static std::unique_ptr<PagePrefetcher> create(ColumnReader* reader,
+                                                  const ColumnIteratorOptions& opts);
+
+    PagePrefetcher(ColumnReader* reader, const ColumnIteratorOptions& opts,
+                   std::shared_ptr<ResourceContext> resource_ctx);
+
+    // Waits for the in-flight reads, they use the column reader and the file of the iterator.
+    ~PagePrefetcher();
+
+    // Issues the reads of the pages after `iter`, up to segment_page_prefetch_depth pages ahead,
+    // which are not issued yet.
+    void prefetch_after(const OrdinalPageIndexIterator& iter);
+
+    // Called before the iterator reads the page. Waits for the read of the page if it is in
+    // flight, and returns whether the page was read ahead.
+    bool consume(int32_t page_index);
+
+private:
+    void _read_page(int32_t page_index, PagePointer page_pointer);
+
+    ColumnReader* _reader = nullptr;
+    ColumnIteratorOptions _opts;
+    // The memory of the reads is tracked by the query of the iterator.
+    std::shared_ptr<ResourceContext> _resource_ctx;
+
+    std::mutex _lock;
+    std::condition_variable _cond;
+    // The pages issued and not consumed by the iterator yet.
+    std::set<int32_t> _issued_pages;
+    std::set<int32_t> _in_flight_pages;
+    bool _stopped = false;
+};
+
+#include "common/compile_check_end.h"
+} // namespace segment_v2
+} // namespace doris
@@ -21,11 +21,13 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <gen_cpp/segment_v2.pb.h>
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <utility>
 
 #include "cloud/config.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
@@ -289,9 +291,16 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         RETURN_IF_ERROR(load_index(read_options.stats));
     }
 
+    // The zone maps still hold the values of the rows deleted by the delete bitmap, only the
+    // count can be answered from the statistics of such a segment.
+    auto delete_bitmap_it = read_options.delete_bitmap.find(id());
+    const bool has_deleted_rows = delete_bitmap_it != read_options.delete_bitmap.end() &&
+                                  delete_bitmap_it->second != nullptr &&
+                                  !delete_bitmap_it->second->isEmpty();
     if (read_options.delete_condition_predicates->num_of_column_predicate() == 0 &&
         read_options.push_down_agg_type_opt != TPushAggOp::NONE &&
-        read_options.push_down_agg_type_opt != TPushAggOp::COUNT_ON_INDEX) {
+        read_options.push_down_agg_type_opt != TPushAggOp::COUNT_ON_INDEX &&
+        (!has_deleted_rows || read_options.push_down_agg_type_opt == TPushAggOp::COUNT)) {
         iter->reset(vectorized::new_vstatistics_iterator(this->shared_from_this(), *schema));
     } else {
         *iter = std::make_unique<SegmentIterator>(this->shared_from_this(), schema);
@@ -399,14 +408,21 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
                                   file_cache_key_str(_file_reader->path().native()));
     }
 
-    uint8_t fixed_buf[12];
+    // Read the tail of the file at once, which usually contains the footer PB as well.
+    const size_t tail_size = std::min(
+            file_size,
+            std::max(size_t(12), static_cast<size_t>(config::segment_footer_tail_read_bytes)));
+    std::string tail_buf;
+    tail_buf.resize(tail_size);
     size_t bytes_read = 0;
     // TODO(plat1ko): Support session variable `enable_file_cache`
     io::IOContext io_ctx {.is_index_data = true,
                           .file_cache_stats = stats ? &stats->file_cache_stats : nullptr};
     RETURN_IF_ERROR(
-            _file_reader->read_at(file_size - 12, Slice(fixed_buf, 12), &bytes_read, &io_ctx));
-    DCHECK_EQ(bytes_read, 12);
+            _file_reader->read_at(file_size - tail_size, tail_buf, &bytes_read, &io_ctx));
+    DCHECK_EQ(bytes_read, tail_size);
+    auto* fixed_buf = reinterpret_cast<uint8_t*>(tail_buf.data() + tail_size - 12);
+    bytes_read = 12;
     TEST_SYNC_POINT_CALLBACK("Segment::parse_footer:magic_number_corruption", fixed_buf);
     TEST_INJECTION_POINT_CALLBACK("Segment::parse_footer:magic_number_corruption_inj", fixed_buf);
     if (memcmp(fixed_buf + 8, k_segment_magic, k_segment_magic_length) != 0) {
@@ -435,10 +451,15 @@ Status Segment::_parse_footer(std::shared_ptr<SegmentFooterPB>& footer,
     }
 
     std::string footer_buf;
-    footer_buf.resize(footer_length);
-    RETURN_IF_ERROR(_file_reader->read_at(file_size - 12 - footer_length, footer_buf, &bytes_read,
-                                          &io_ctx));
-    DCHECK_EQ(bytes_read, footer_length);
+    if (12 + footer_length <= tail_size) {
+        footer_buf.assign(tail_buf.data() + tail_size - 12 - footer_length, footer_length);
+        bytes_read = footer_length;
+    } else {
+        footer_buf.resize(footer_length);
+        RETURN_IF_ERROR(_file_reader->read_at(file_size - 12 - footer_length, footer_buf,
+                                              &bytes_read, &io_ctx));
+        DCHECK_EQ(bytes_read, footer_length);
+    }
 
     // validate footer PB's checksum
     uint32_t expect_checksum = decode_fixed32_le(fixed_buf + 4);
@@ -977,7 +998,8 @@ Status Segment::new_index_iterator(const TabletColumn& tablet_column, const Tabl
 
 Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_schema,
                                bool with_seq_col, bool with_rowid, RowLocation* row_location,
-                               OlapReaderStatistics* stats, std::string* encoded_seq_value) {
+                               OlapReaderStatistics* stats, std::string* encoded_seq_value,
+                               std::unique_ptr<IndexedColumnIterator>* index_iterator_hint) {
     RETURN_IF_ERROR(load_pk_index_and_bf(stats));
     bool has_seq_col = latest_schema->has_sequence_col();
     bool has_rowid = !latest_schema->cluster_key_uids().empty();
@@ -996,8 +1018,14 @@ Status Segment::lookup_row_key(const Slice& key, const TabletSchema* latest_sche
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    std::unique_ptr<segment_v2::IndexedColumnIterator> owned_index_iterator;
+    auto& index_iterator =
+            index_iterator_hint != nullptr ? *index_iterator_hint : owned_index_iterator;
+    if (index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator, stats));
+    }
+    // The iterator keeps the data page of the last seek, a key in the same page is sought
+    // without reading and decoding the page again.
     auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
@@ -71,6 +71,7 @@ class Segment;
 class InvertedIndexIterator;
 class IndexFileReader;
 class IndexIterator;
+class IndexedColumnIterator;
 
 using SegmentSharedPtr = std::shared_ptr<Segment>;
 // A Segment is used to represent a segment in memory format. When segment is
@@ -140,9 +141,12 @@ public:
         return _pk_index_reader.get();
     }
 
+    // If `index_iterator_hint` is given, the pk index iterator is kept in it and reused by the
+    // next lookups, so the lookups of keys in order decode each pk index page once.
     Status lookup_row_key(const Slice& key, const TabletSchema* latest_schema, bool with_seq_col,
                           bool with_rowid, RowLocation* row_location, OlapReaderStatistics* stats,
-                          std::string* encoded_seq_value = nullptr);
+                          std::string* encoded_seq_value = nullptr,
+                          std::unique_ptr<IndexedColumnIterator>* index_iterator_hint = nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
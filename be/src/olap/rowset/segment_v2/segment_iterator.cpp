@@ -71,6 +71,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/string_util.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nothing.h"
@@ -701,28 +702,8 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
                                        condition_row_ranges);
 
         if (!_opts.topn_filter_source_node_ids.empty()) {
-            auto* query_ctx = _opts.runtime_state->get_query_ctx();
-            for (int id : _opts.topn_filter_source_node_ids) {
-                std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
-                        query_ctx->get_runtime_predicate(id).get_predicate(
-                                _opts.topn_filter_target_node_id);
-                if (_segment->can_apply_predicate_safely(runtime_predicate->column_id(),
-                                                         runtime_predicate.get(), *_schema,
-                                                         _opts.io_ctx.reader_type)) {
-                    AndBlockColumnPredicate and_predicate;
-                    and_predicate.add_column_predicate(
-                            SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-
-                    RowRanges column_rp_row_ranges = RowRanges::create_single(num_rows());
-                    RETURN_IF_ERROR(_column_iterators[runtime_predicate->column_id()]
-                                            ->get_row_ranges_by_zone_map(&and_predicate, nullptr,
-                                                                         &column_rp_row_ranges));
-
-                    // intersect different columns's row ranges to get final row ranges by zone map
-                    RowRanges::ranges_intersection(zone_map_row_ranges, column_rp_row_ranges,
-                                                   &zone_map_row_ranges);
-                }
-            }
+            _topn_filter_version = _get_topn_filter_version();
+            RETURN_IF_ERROR(_get_row_ranges_by_topn_filter(&zone_map_row_ranges));
         }
 
         size_t pre_size2 = condition_row_ranges->count();
@@ -735,6 +716,76 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
     return Status::OK();
 }
 
+uint64_t SegmentIterator::_get_topn_filter_version() const {
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    uint64_t version = 0;
+    for (int id : _opts.topn_filter_source_node_ids) {
+        version += query_ctx->get_runtime_predicate(id).version();
+    }
+    return version;
+}
+
+// intersect row_ranges with the row ranges whose zone maps may pass the topn filters.
+Status SegmentIterator::_get_row_ranges_by_topn_filter(RowRanges* row_ranges) {
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    for (int id : _opts.topn_filter_source_node_ids) {
+        std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
+                query_ctx->get_runtime_predicate(id).get_predicate(
+                        _opts.topn_filter_target_node_id);
+        if (_segment->can_apply_predicate_safely(runtime_predicate->column_id(),
+                                                 runtime_predicate.get(), *_schema,
+                                                 _opts.io_ctx.reader_type)) {
+            AndBlockColumnPredicate and_predicate;
+            and_predicate.add_column_predicate(
+                    SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
+
+            RowRanges column_rp_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[runtime_predicate->column_id()]
+                                    ->get_row_ranges_by_zone_map(&and_predicate, nullptr,
+                                                                 &column_rp_row_ranges));
+
+            // intersect different columns's row ranges to get final row ranges by zone map
+            RowRanges::ranges_intersection(*row_ranges, column_rp_row_ranges, row_ranges);
+        }
+    }
+    return Status::OK();
+}
+
+// The topn filters are tightened while the segment is read, as the topn sorters of the query see
+// more rows. Once they changed, the rows left to read are pruned again by the zone maps of the
+// pages, so the pages that can not pass the current threshold are never read.
+Status SegmentIterator::_prune_rows_by_topn_filter() {
+    // Only the non-key topn evaluates the topn filters on the rows, see
+    // _vec_init_lazy_materialization, the key topn only reads the first rows of the segment.
+    if (_opts.topn_filter_source_node_ids.empty() || _opts.read_orderby_key_reverse ||
+        (_opts.read_orderby_key_columns != nullptr && !_opts.read_orderby_key_columns->empty())) {
+        return Status::OK();
+    }
+    const uint64_t version = _get_topn_filter_version();
+    if (version == _topn_filter_version) {
+        return Status::OK();
+    }
+    _topn_filter_version = version;
+
+    SCOPED_RAW_TIMER(&_opts.stats->generate_row_ranges_by_zonemap_ns);
+    RowRanges zone_map_row_ranges = RowRanges::create_single(num_rows());
+    RETURN_IF_ERROR(_get_row_ranges_by_topn_filter(&zone_map_row_ranges));
+
+    roaring::Roaring remaining_rows = _row_bitmap;
+    remaining_rows.removeRange(0, _next_rowid_to_read);
+    const size_t pre_size = remaining_rows.cardinality();
+    remaining_rows &= RowRanges::ranges_to_roaring(zone_map_row_ranges);
+    const size_t filtered_rows = pre_size - remaining_rows.cardinality();
+    if (filtered_rows == 0) {
+        return Status::OK();
+    }
+    _opts.stats->rows_stats_rp_filtered += filtered_rows;
+    _opts.stats->rows_stats_filtered += filtered_rows;
+    _row_bitmap = std::move(remaining_rows);
+    _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
+    return Status::OK();
+}
+
 // filter rows by evaluating column predicates using bitmap indexes.
 // upon return, predicates that've been evaluated by bitmap indexes are removed from _col_predicates.
 Status SegmentIterator::_apply_bitmap_index() {
@@ -1115,6 +1166,10 @@ Status SegmentIterator::_init_return_column_iterators() {
         if (_column_iterators[cid] == nullptr) {
             RETURN_IF_ERROR(_segment->new_column_iterator(_opts.tablet_schema->column(cid),
                                                           &_column_iterators[cid], &_opts));
+            if (auto it = _opts.struct_read_sub_columns.find(cid);
+                it != _opts.struct_read_sub_columns.end()) {
+                _prune_struct_sub_columns(cid, it->second);
+            }
             ColumnIteratorOptions iter_opts {
                     .use_page_cache = _opts.use_page_cache,
                     // If the col is predicate column, then should read the last page to check
@@ -1142,6 +1197,24 @@ Status SegmentIterator::_init_return_column_iterators() {
     return Status::OK();
 }
 
+// Only the struct sub columns in `sub_column_names` are read by the iterator of the column, the
+// iterators of the missing or the default columns are not struct iterators and read everything.
+void SegmentIterator::_prune_struct_sub_columns(ColumnId cid,
+                                                const std::vector<std::string>& sub_column_names) {
+    auto* struct_iterator = dynamic_cast<StructFileColumnIterator*>(_column_iterators[cid].get());
+    if (struct_iterator == nullptr) {
+        return;
+    }
+    const auto& sub_columns = _opts.tablet_schema->column(cid).get_sub_columns();
+    std::vector<bool> read_sub_columns(sub_columns.size(), false);
+    for (size_t i = 0; i < sub_columns.size(); ++i) {
+        read_sub_columns[i] = std::any_of(
+                sub_column_names.begin(), sub_column_names.end(),
+                [&](const std::string& name) { return iequal(name, sub_columns[i]->name()); });
+    }
+    struct_iterator->set_read_sub_columns(std::move(read_sub_columns));
+}
+
 Status SegmentIterator::_init_bitmap_index_iterators() {
     SCOPED_RAW_TIMER(&_opts.stats->segment_iterator_init_bitmap_index_iterators_timer_ns);
     if (_cur_rowid >= num_rows()) {
@@ -1808,6 +1881,9 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->predicate_column_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0) {
+        _next_rowid_to_read = std::max(_next_rowid_to_read, _block_rowids[nrows_read - 1] + 1);
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
     VLOG_DEBUG << fmt::format(
@@ -2240,6 +2316,8 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
         }
     }
 
+    RETURN_IF_ERROR(_prune_rows_by_topn_filter());
+
     uint32_t nrows_read_limit = _opts.block_row_max;
     if (_can_opt_topn_reads()) {
         nrows_read_limit = std::min(static_cast<uint32_t>(_opts.topn_limit), nrows_read_limit);
@@ -167,6 +167,7 @@ private:
     [[nodiscard]] Status _lazy_init();
     [[nodiscard]] Status _init_impl(const StorageReadOptions& opts);
     [[nodiscard]] Status _init_return_column_iterators();
+    void _prune_struct_sub_columns(ColumnId cid, const std::vector<std::string>& sub_column_names);
     [[nodiscard]] Status _init_bitmap_index_iterators();
     [[nodiscard]] Status _init_index_iterators();
     // calculate row ranges that fall into requested key ranges using short key index
@@ -186,6 +187,9 @@ private:
     // calculate row ranges that satisfy requested column conditions using various column index
     [[nodiscard]] Status _get_row_ranges_by_column_conditions();
     [[nodiscard]] Status _get_row_ranges_from_conditions(RowRanges* condition_row_ranges);
+    [[nodiscard]] Status _get_row_ranges_by_topn_filter(RowRanges* row_ranges);
+    [[nodiscard]] Status _prune_rows_by_topn_filter();
+    uint64_t _get_topn_filter_version() const;
     [[nodiscard]] Status _apply_bitmap_index();
     [[nodiscard]] Status _apply_inverted_index();
     [[nodiscard]] Status _apply_inverted_index_on_column_predicate(
@@ -388,6 +392,10 @@ private:
     std::unique_ptr<BitmapRangeIterator> _range_iter;
     // the next rowid to read
     rowid_t _cur_rowid;
+    // the rows before it have been read, only kept for the forward reads
+    rowid_t _next_rowid_to_read = 0;
+    // the sum of the versions of the topn filters when the rows were last pruned by them
+    uint64_t _topn_filter_version = 0;
     // members related to lazy materialization read
     // --------------------------------------------
     // whether lazy materialization read should be used.
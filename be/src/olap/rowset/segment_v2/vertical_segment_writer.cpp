@@ -20,6 +20,7 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 #include <ostream>
@@ -40,6 +41,7 @@
 #include "olap/base_tablet.h"
 #include "olap/data_dir.h"
 #include "olap/key_coder.h"
+#include "olap/memtable_flush_executor.h"
 #include "olap/olap_common.h"
 #include "olap/partial_update_info.h"
 #include "olap/primary_key_index.h"
@@ -53,16 +55,20 @@
 #include "olap/rowset/segment_v2/page_pointer.h"
 #include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
+#include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
 #include "olap/utils.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
 #include "service/point_query_executor.h"
 #include "util/coding.h"
+#include "util/countdown_latch.h"
 #include "util/crc32c.h"
 #include "util/debug_points.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
@@ -1045,8 +1051,42 @@ Status VerticalSegmentWriter::write_batch() {
     vectorized::IOlapColumnDataAccessor* seq_column = nullptr;
     // the key is cluster key column unique id
     std::map<uint32_t, vectorized::IOlapColumnDataAccessor*> cid_to_column;
+    ThreadPool* encode_pool = _column_encode_pool();
+    const auto encode_parallelism =
+            static_cast<size_t>(std::max(config::flush_column_encode_parallelism, 1));
+    if (encode_pool != nullptr) {
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            RETURN_IF_ERROR(
+                    _create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+        }
+    }
     for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
-        RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+        if (encode_pool != nullptr && _can_encode_in_parallel(cid)) {
+            // The following value columns are encoded in parallel, at most
+            // flush_column_encode_parallelism columns at a time to bound the memory of the
+            // pages which are not written yet, and their pages are written in column order.
+            std::vector<uint32_t> cids;
+            while (cid < _tablet_schema->num_columns() && _can_encode_in_parallel(cid) &&
+                   cids.size() < encode_parallelism) {
+                cids.push_back(cid++);
+            }
+            --cid;
+            RETURN_IF_ERROR(_encode_value_columns_in_parallel(encode_pool, cids));
+            for (auto encoded_cid : cids) {
+                auto& writer = _column_writers[encoded_cid];
+                if (_data_dir != nullptr &&
+                    _data_dir->reach_capacity_limit(writer->estimate_buffer_size())) {
+                    return Status::Error<DISK_REACH_CAPACITY_LIMIT>(
+                            "disk {} exceed capacity limit.", _data_dir->path_hash());
+                }
+                RETURN_IF_ERROR(writer->write_data());
+            }
+            continue;
+        }
+        if (encode_pool == nullptr) {
+            RETURN_IF_ERROR(
+                    _create_column_writer(cid, _tablet_schema->column(cid), _tablet_schema));
+        }
         for (auto& data : _batched_blocks) {
             RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
                     data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
@@ -1106,6 +1146,90 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+ThreadPool* VerticalSegmentWriter::_column_encode_pool() const {
+    // Only the segments flushed from the memtables are encoded in parallel, the compaction and
+    // schema change tasks are already run in parallel by tablets. Building an inverted index
+    // costs much more than encoding a column, so the tables with inverted indexes are encoded in
+    // parallel whatever their width.
+    if (_opts.write_type != DataWriteType::TYPE_DIRECT ||
+        config::flush_column_encode_parallelism <= 1 ||
+        (_tablet_schema->num_columns() <
+                 static_cast<size_t>(std::max(config::flush_column_encode_min_columns, 0)) &&
+         !_tablet_schema->has_inverted_index())) {
+        return nullptr;
+    }
+    auto* flush_executor = ExecEnv::GetInstance()->storage_engine().memtable_flush_executor();
+    return flush_executor == nullptr ? nullptr : flush_executor->column_encode_pool();
+}
+
+bool VerticalSegmentWriter::_can_encode_in_parallel(uint32_t cid) const {
+    // The converted key, sequence and cluster key columns are used to build the key indexes.
+    // The inverted index of a value column is built into its own index directory, which is
+    // opened when the column writer is created and only written to the shared index file by
+    // _write_inverted_index, so it may be built by the encoding task.
+    const auto& column = _tablet_schema->column(cid);
+    if (cid < _tablet_schema->num_key_columns() ||
+        (_tablet_schema->has_sequence_col() && cid == _tablet_schema->sequence_col_idx()) ||
+        column.is_variant_type()) {
+        return false;
+    }
+    const auto& cluster_key_uids = _tablet_schema->cluster_key_uids();
+    return std::find(cluster_key_uids.begin(), cluster_key_uids.end(), column.unique_id()) ==
+           cluster_key_uids.end();
+}
+
+Status VerticalSegmentWriter::_encode_value_column(uint32_t cid) {
+    for (auto& data : _batched_blocks) {
+        RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+        auto [status, column] = _olap_data_convertor->convert_column_data(cid);
+        if (!status.ok()) {
+            return status;
+        }
+        RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
+                                                     data.num_rows));
+        _olap_data_convertor->clear_source_content(cid);
+    }
+    return _column_writers[cid]->finish();
+}
+
+Status VerticalSegmentWriter::_encode_value_columns_in_parallel(ThreadPool* pool,
+                                                                const std::vector<uint32_t>& cids) {
+    // The memory of encoding the columns is tracked by the flush task of the caller.
+    std::shared_ptr<ResourceContext> resource_ctx =
+            thread_context()->is_attach_task() ? thread_context()->resource_ctx() : nullptr;
+    std::vector<Status> encode_status(cids.size());
+    size_t submitted_tasks = 0;
+    CountDownLatch latch(static_cast<int>(cids.size()));
+    // The last column is encoded by the caller thread while the others are encoded by the pool.
+    for (size_t i = 0; i + 1 < cids.size(); ++i) {
+        Status submit_status = pool->submit_func([&, i]() {
+            if (resource_ctx != nullptr) {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                encode_status[i] = _encode_value_column(cids[i]);
+            } else {
+                SCOPED_INIT_THREAD_CONTEXT();
+                encode_status[i] = _encode_value_column(cids[i]);
+            }
+            latch.count_down();
+        });
+        if (!submit_status.ok()) {
+            break;
+        }
+        submitted_tasks++;
+    }
+    // The columns not submitted are encoded by the caller thread, e.g. the pool is full.
+    for (size_t i = submitted_tasks; i < cids.size(); ++i) {
+        encode_status[i] = _encode_value_column(cids[i]);
+        latch.count_down();
+    }
+    latch.wait();
+    for (const auto& status : encode_status) {
+        RETURN_IF_ERROR(status);
+    }
+    return Status::OK();
+}
+
 Status VerticalSegmentWriter::_generate_key_index(
         RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
         vectorized::IOlapColumnDataAccessor* seq_column,
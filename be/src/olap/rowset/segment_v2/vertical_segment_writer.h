@@ -51,6 +51,7 @@ class MemTracker;
 class ShortKeyIndexBuilder;
 class PrimaryKeyIndexBuilder;
 class KeyCoder;
+class ThreadPool;
 struct RowsetWriterContext;
 
 namespace io {
@@ -191,6 +192,14 @@ private:
             bool& has_default_or_nullable, std::vector<bool>& use_default_or_null_flag,
             PartialUpdateStats& stats);
     Status _append_block_with_variant_subcolumns(RowsInBlock& data);
+    // Returns the pool to encode the value columns in parallel, or nullptr if the columns are
+    // encoded one by one.
+    ThreadPool* _column_encode_pool() const;
+    bool _can_encode_in_parallel(uint32_t cid) const;
+    // Converts the batched blocks of a value column, appends them to its writer and finishes it.
+    Status _encode_value_column(uint32_t cid);
+    // Encodes the value columns in parallel, their pages are written by the caller in order.
+    Status _encode_value_columns_in_parallel(ThreadPool* pool, const std::vector<uint32_t>& cids);
     Status _generate_key_index(
             RowsInBlock& data, std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns,
             vectorized::IOlapColumnDataAccessor* seq_column,
@@ -72,8 +72,10 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -1209,16 +1211,22 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         return process_alter_exit();
     }
 
-    // b. Generate historical data converter
-    auto sc_procedure = _get_sc_procedure(
-            changer, sc_sorting, sc_directly,
-            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
+    // b. Convert historical data. The rowsets are converted concurrently with their own rowset
+    // writers and converters, which share the memory limitation of the job. The converted rowsets
+    // are added to the new tablet in version order.
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    int parallelism = std::max(1, std::min(config::schema_change_convert_rowset_parallelism,
+                                           cast_set<int>(rs_readers.size())));
+    int64_t mem_limit =
+            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change() /
+            parallelism;
 
     DBUG_EXECUTE_IF("SchemaChangeJob::_convert_historical_rowsets.block", DBUG_BLOCK);
 
-    // c.Convert historical data
-    bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
+    std::vector<std::unique_ptr<RowsetWriter>> rowset_writers(rs_readers.size());
+    std::vector<PendingRowsetGuard> pending_rs_guards(rs_readers.size());
+    auto convert_rowset = [&](size_t i) -> Status {
+        const auto& rs_reader = rs_readers[i];
         // set status for monitor
         // As long as there is a new_table as running, ref table is set as running
         // NOTE If the first sub_table fails first, it will continue to go as normal here
@@ -1248,26 +1256,80 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         }
         auto result = _new_tablet->create_rowset_writer(context, vertical);
         if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
-            return process_alter_exit();
+            return Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                      result.error().to_string());
         }
-        auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
-
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
+        rowset_writers[i] = std::move(result).value();
+        pending_rs_guards[i] = _local_storage_engine.add_pending_rowset(context);
+
+        // The converters keep the state of a rowset, each rowset has its own one.
+        auto sc_procedure = _get_sc_procedure(changer, sc_sorting, sc_directly, mem_limit);
+        if (auto st = sc_procedure->process(rs_reader, rowset_writers[i].get(), _new_tablet,
+                                            _base_tablet, _base_tablet_schema, _new_tablet_schema);
+            !st) {
             LOG(WARNING) << "failed to process the version."
                          << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
+                         << rs_reader->version().second << ", " << st.to_string();
+            return st;
+        }
+        return Status::OK();
+    };
+
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            if (res = convert_rowset(i); !res) {
+                return process_alter_exit();
+            }
+        }
+    } else {
+        std::unique_ptr<ThreadPool> pool;
+        res = ThreadPoolBuilder("SchemaChangeConvertRowsetThreadPool")
+                      .set_min_threads(parallelism)
+                      .set_max_threads(parallelism)
+                      .build(&pool);
+        if (!res) {
             return process_alter_exit();
         }
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker_sptr();
+        std::mutex res_lock;
+        for (size_t i = 0; i < rs_readers.size(); ++i) {
+            Status st = pool->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(mem_tracker);
+                {
+                    std::lock_guard lock(res_lock);
+                    if (!res) {
+                        // Some rowset has failed
+                        return;
+                    }
+                }
+                Status convert_st = convert_rowset(i);
+                if (!convert_st) {
+                    std::lock_guard lock(res_lock);
+                    if (res) {
+                        res = std::move(convert_st);
+                    }
+                }
+            });
+            if (!st) {
+                std::lock_guard lock(res_lock);
+                res = std::move(st);
+                break;
+            }
+        }
+        pool->wait();
+        if (!res) {
+            return process_alter_exit();
+        }
+    }
+
+    bool have_failure_rowset = false;
+    for (size_t i = 0; i < rs_readers.size(); ++i) {
+        const auto& rs_reader = rs_readers[i];
         // Add the new version of the data to the header
         // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
         std::lock_guard lock(_new_tablet->get_push_lock());
         RowsetSharedPtr new_rowset;
-        if (!(res = rowset_writer->build(new_rowset)).ok()) {
+        if (!(res = rowset_writers[i]->build(new_rowset)).ok()) {
             LOG(WARNING) << "failed to build rowset, exit alter process";
             return process_alter_exit();
         }
@@ -1298,6 +1360,7 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         VLOG_TRACE << "succeed to convert a history version."
                    << " version=" << rs_reader->version().first << "-"
                    << rs_reader->version().second;
+        pending_rs_guards[i].drop();
     }
 
     // XXX:The SchemaChange state should not be canceled at this time, because the new Delta has to be converted to the old and new Schema version
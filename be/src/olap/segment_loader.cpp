@@ -23,7 +23,11 @@
 #include "common/status.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset.h"
+#include "runtime/exec_env.h"
+#include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 
 namespace doris {
 
@@ -90,14 +94,85 @@ Status SegmentLoader::load_segments(const BetaRowsetSharedPtr& rowset,
     if (cache_handle->is_inited()) {
         return Status::OK();
     }
-    for (int64_t i = 0; i < rowset->num_segments(); i++) {
-        RETURN_IF_ERROR(load_segment(rowset, i, cache_handle, use_cache, need_load_pk_index_and_bf,
-                                     index_load_stats));
+    // The statistics are not thread safe, the segments are loaded one by one if required.
+    if (config::enable_parallel_segment_load && rowset->num_segments() > 1 &&
+        index_load_stats == nullptr &&
+        ExecEnv::GetInstance()->segment_load_thread_pool() != nullptr) {
+        RETURN_IF_ERROR(_load_segments_parallel(rowset, cache_handle, use_cache,
+                                                need_load_pk_index_and_bf));
+    } else {
+        for (int64_t i = 0; i < rowset->num_segments(); i++) {
+            RETURN_IF_ERROR(load_segment(rowset, i, cache_handle, use_cache,
+                                         need_load_pk_index_and_bf, index_load_stats));
+        }
     }
     cache_handle->set_inited();
     return Status::OK();
 }
 
+Status SegmentLoader::_load_segments_parallel(const BetaRowsetSharedPtr& rowset,
+                                              SegmentCacheHandle* cache_handle, bool use_cache,
+                                              bool need_load_pk_index_and_bf) {
+    const auto num_segments = rowset->num_segments();
+    std::vector<SegmentCacheHandle> segment_handles(num_segments);
+    std::vector<Status> load_status(num_segments);
+
+    // The memory of opening the segments is tracked by the task of the caller.
+    SCOPED_INIT_THREAD_CONTEXT();
+    std::shared_ptr<ResourceContext> resource_ctx =
+            thread_context()->is_attach_task() ? thread_context()->resource_ctx() : nullptr;
+    auto load = [&](int64_t i) {
+        load_status[i] = load_segment(rowset, i, &segment_handles[i], use_cache,
+                                      need_load_pk_index_and_bf, nullptr);
+    };
+
+    // The segments in the cache are taken by the caller thread without a task.
+    std::vector<int64_t> uncached_segments;
+    for (int64_t i = 0; i < num_segments; i++) {
+        if (!_segment_cache->lookup(SegmentCache::CacheKey(rowset->rowset_id(), i),
+                                    &segment_handles[i]) ||
+            segment_handles[i].pop_unhealthy_segment() != nullptr) {
+            uncached_segments.push_back(i);
+        }
+    }
+
+    auto* pool = ExecEnv::GetInstance()->segment_load_thread_pool();
+    int submitted_tasks = 0;
+    Status submit_status;
+    CountDownLatch latch(static_cast<int>(uncached_segments.size()));
+    // The last segment is loaded by the caller thread while the others are loaded by the pool.
+    for (size_t j = 0; j + 1 < uncached_segments.size(); j++) {
+        submit_status = pool->submit_func([&, i = uncached_segments[j]]() {
+            if (resource_ctx != nullptr) {
+                SCOPED_ATTACH_TASK(resource_ctx);
+                load(i);
+            } else {
+                SCOPED_INIT_THREAD_CONTEXT();
+                load(i);
+            }
+            latch.count_down();
+        });
+        if (!submit_status.ok()) {
+            break;
+        }
+        submitted_tasks++;
+    }
+    // The segments not submitted are loaded by the caller thread, e.g. the pool is full.
+    for (size_t j = submitted_tasks; j < uncached_segments.size(); j++) {
+        load(uncached_segments[j]);
+        latch.count_down();
+    }
+    latch.wait();
+
+    for (int64_t i = 0; i < num_segments; i++) {
+        RETURN_IF_ERROR(load_status[i]);
+        for (auto& segment : segment_handles[i].get_segments()) {
+            cache_handle->push_segment(std::move(segment));
+        }
+    }
+    return Status::OK();
+}
+
 void SegmentLoader::erase_segment(const SegmentCache::CacheKey& key) {
     _segment_cache->erase(key);
 }
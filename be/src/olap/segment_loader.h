@@ -33,6 +33,7 @@
 #include "common/status.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_common.h" // for rowset id
+#include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "util/time.h"
@@ -119,6 +120,8 @@ public:
 
     // Load segments of "rowset", return the "cache_handle" which contains segments.
     // If use_cache is true, it will be loaded from _cache.
+    // The segments not in the cache are opened concurrently on SegmentLoadThreadPool
+    // if enable_parallel_segment_load is true.
     Status load_segments(const BetaRowsetSharedPtr& rowset, SegmentCacheHandle* cache_handle,
                          bool use_cache = false, bool need_load_pk_index_and_bf = false,
                          OlapReaderStatistics* index_load_stats = nullptr);
@@ -144,9 +147,13 @@ public:
 
 private:
     SegmentLoader();
+    Status _load_segments_parallel(const BetaRowsetSharedPtr& rowset,
+                                   SegmentCacheHandle* cache_handle, bool use_cache,
+                                   bool need_load_pk_index_and_bf);
+
     std::unique_ptr<SegmentCache> _segment_cache;
     // Just used for BE UT
-    int64_t _cache_mem_usage = 0;
+    std::atomic<int64_t> _cache_mem_usage = 0;
 };
 
 // A handle for a single rowset from segment lru cache.
@@ -170,6 +177,14 @@ public:
 
     std::vector<segment_v2::SegmentSharedPtr>& get_segments() { return segments; }
 
+    // The pk index iterators of the segments, reused by the primary key lookups of a load.
+    std::unique_ptr<segment_v2::IndexedColumnIterator>* pk_index_iterator(size_t segment_idx) {
+        if (_pk_index_iterators.size() < segments.size()) {
+            _pk_index_iterators.resize(segments.size());
+        }
+        return &_pk_index_iterators[segment_idx];
+    }
+
     [[nodiscard]] bool is_inited() const { return _init; }
 
     void set_inited() {
@@ -191,6 +206,7 @@ public:
 
 private:
     std::vector<segment_v2::SegmentSharedPtr> segments;
+    std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>> _pk_index_iterators;
     bool _init {false};
 
     // Don't allow copy and assign
@@ -89,8 +89,15 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const segment_v2::ShortKey
     }
     _parsed = true;
 
+    _key_prefixes.resize(_footer.num_items());
+    for (uint32_t i = 0; i < _footer.num_items(); ++i) {
+        _key_prefixes[i] = key_prefix(key(i));
+    }
+
     g_short_key_index_memory_bytes << sizeof(_footer) + _key_data.size +
-                                              _offsets.size() * sizeof(uint32_t) + sizeof(*this);
+                                              _offsets.size() * sizeof(uint32_t) +
+                                              _key_prefixes.size() * sizeof(uint64_t) +
+                                              sizeof(*this);
 
     return Status::OK();
 }
@@ -99,6 +106,7 @@ ShortKeyIndexDecoder::~ShortKeyIndexDecoder() {
     if (_parsed) {
         g_short_key_index_memory_bytes << -sizeof(_footer) - _key_data.size -
                                                   _offsets.size() * sizeof(uint32_t) -
+                                                  _key_prefixes.size() * sizeof(uint64_t) -
                                                   sizeof(*this);
     }
 }
@@ -183,13 +183,32 @@ public:
     }
 
 private:
+    // The first 8 bytes of the key in big endian, padded with zeros. Keys are ordered by memcmp,
+    // so a smaller prefix always means a smaller key, only the keys with equal prefixes need to
+    // be compared in full.
+    static uint64_t key_prefix(const Slice& key) {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+            prefix = (prefix << 8) | (i < key.size ? static_cast<uint8_t>(key.data[i]) : 0);
+        }
+        return prefix;
+    }
+
     template <bool lower_bound>
     ShortKeyIndexIterator seek(const Slice& key) const {
+        // search the contiguous prefixes first, which avoids decoding a key and comparing it by
+        // memcmp at every step of the binary search.
+        uint64_t prefix = key_prefix(key);
+        auto first = std::lower_bound(_key_prefixes.begin(), _key_prefixes.end(), prefix);
+        auto last = std::upper_bound(first, _key_prefixes.end(), prefix);
+        ShortKeyIndexIterator first_iter(this,
+                                         static_cast<uint32_t>(first - _key_prefixes.begin()));
+        ShortKeyIndexIterator last_iter(this, static_cast<uint32_t>(last - _key_prefixes.begin()));
         auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
         if (lower_bound) {
-            return std::lower_bound(begin(), end(), key, comparator);
+            return std::lower_bound(first_iter, last_iter, key, comparator);
         } else {
-            return std::upper_bound(begin(), end(), key, comparator);
+            return std::upper_bound(first_iter, last_iter, key, comparator);
         }
     }
 
@@ -199,6 +218,8 @@ private:
     // All following fields are only valid after parse has been executed successfully
     segment_v2::ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
+    // the key_prefix of every key
+    std::vector<uint64_t> _key_prefixes;
     Slice _key_data;
 };
 
@@ -756,6 +756,9 @@ void StorageEngine::stop() {
     if (_cold_data_compaction_thread_pool) {
         _cold_data_compaction_thread_pool->shutdown();
     }
+    if (_clone_download_thread_pool) {
+        _clone_download_thread_pool->shutdown();
+    }
 
     if (_cooldown_thread_pool) {
         _cooldown_thread_pool->shutdown();
@@ -77,6 +77,7 @@ class WorkloadGroup;
 
 using SegCompactionCandidates = std::vector<segment_v2::SegmentSharedPtr>;
 using SegCompactionCandidatesSharedPtr = std::shared_ptr<SegCompactionCandidates>;
+using SegCompactionGroups = std::vector<SegCompactionCandidatesSharedPtr>;
 using CumuCompactionPolicyTable =
         std::unordered_map<std::string_view, std::shared_ptr<CumulativeCompactionPolicy>>;
 
@@ -326,9 +327,11 @@ public:
     Status submit_compaction_task(TabletSharedPtr tablet, CompactionType compaction_type,
                                   bool force, bool eager = true);
     Status submit_seg_compaction_task(std::shared_ptr<SegcompactionWorker> worker,
-                                      SegCompactionCandidatesSharedPtr segments);
+                                      SegCompactionGroups groups);
 
     ThreadPool* tablet_publish_txn_thread_pool() { return _tablet_publish_txn_thread_pool.get(); }
+    ThreadPool* seg_compaction_thread_pool() { return _seg_compaction_thread_pool.get(); }
+    ThreadPool* clone_download_thread_pool() { return _clone_download_thread_pool.get(); }
     bool stopped() override { return _stopped; }
 
     Status process_index_change_task(const TAlterInvertedIndexReq& reqest);
@@ -433,7 +436,7 @@ private:
     void _cold_data_compaction_producer_callback();
 
     Status _handle_seg_compaction(std::shared_ptr<SegcompactionWorker> worker,
-                                  SegCompactionCandidatesSharedPtr segments,
+                                  SegCompactionGroups groups,
                                   uint64_t submission_time);
 
     Status _handle_index_change(IndexBuilderSharedPtr index_builder);
@@ -517,6 +520,8 @@ private:
 
     std::unique_ptr<ThreadPool> _tablet_meta_checkpoint_thread_pool;
 
+    std::unique_ptr<ThreadPool> _clone_download_thread_pool;
+
     CompactionPermitLimiter _permit_limiter;
 
     CompactionSubmitRegistry _compaction_submit_registry;
@@ -2639,6 +2639,18 @@ bool Tablet::should_skip_compaction(CompactionType compaction_type, int64_t now)
     return false;
 }
 
+double Tablet::update_scan_frequency(int64_t now_ms) {
+    int64_t scan_count = query_scan_count->value();
+    if (_last_scan_count_ms > 0 && now_ms > _last_scan_count_ms) {
+        double scans_per_second = static_cast<double>(scan_count - _last_scan_count) * 1000 /
+                                  static_cast<double>(now_ms - _last_scan_count_ms);
+        _scan_frequency = (_scan_frequency + scans_per_second) / 2;
+    }
+    _last_scan_count = scan_count;
+    _last_scan_count_ms = now_ms;
+    return _scan_frequency;
+}
+
 std::pair<std::string, int64_t> Tablet::get_binlog_info(std::string_view binlog_version) const {
     return RowsetMetaManager::get_binlog_info(_data_dir->get_meta(), tablet_uid(), binlog_version);
 }
@@ -452,6 +452,9 @@ public:
                              CompactionType compaction_type = CompactionType::CUMULATIVE_COMPACTION,
                              int64_t start = -1);
     bool should_skip_compaction(CompactionType compaction_type, int64_t now);
+    // Update and return the scans of the tablet per second, which is smoothed over the checks
+    // of the compaction producer.
+    double update_scan_frequency(int64_t now_ms);
 
     std::vector<std::string> get_binlog_filepath(std::string_view binlog_version) const;
     std::pair<std::string, int64_t> get_binlog_info(std::string_view binlog_version) const;
@@ -625,6 +628,10 @@ private:
     bool _skip_base_compaction = false;
     int64_t _skip_base_compaction_ts;
 
+    int64_t _last_scan_count = 0;
+    int64_t _last_scan_count_ms = 0;
+    double _scan_frequency = 0;
+
     // cooldown related
     CooldownConf _cooldown_conf;
     // `_cooldown_conf_lock` is used to serialize update cooldown conf and all operations that:
@@ -532,8 +532,7 @@ Status TabletManager::_drop_tablet(TTabletId tablet_id, TReplicaId replica_id, b
     // Fetch tablet which need to be dropped
     TabletSharedPtr to_drop_tablet;
     {
-        std::unique_lock<std::shared_mutex> wlock(_get_tablets_shard_lock(tablet_id),
-                                                  std::defer_lock);
+        std::unique_lock wlock(_get_tablets_shard_lock(tablet_id), std::defer_lock);
         if (!had_held_shard_lock) {
             wlock.lock();
         }
@@ -727,8 +726,25 @@ void TabletManager::get_tablet_stat(TTabletStatResult* result) {
 struct TabletScore {
     TabletSharedPtr tablet_ptr;
     int score;
+    double priority;
 };
 
+// The read amplification of a tablet grows with its compaction score, and it costs every scan
+// of the tablet. So the cumulative compaction of a tablet which is scanned more saves more query
+// time, its score is weighted by the scan frequency to prioritize it.
+static double compaction_priority(Tablet* tablet, CompactionType compaction_type, uint32_t score,
+                                  int64_t now_ms) {
+    double scan_frequency = tablet->update_scan_frequency(now_ms);
+    if (compaction_type != CompactionType::CUMULATIVE_COMPACTION ||
+        config::compaction_score_scan_frequency_weight <= 0) {
+        return score;
+    }
+    // A hot tablet with a few versions should not starve the tablets with many versions.
+    static constexpr double MAX_SCAN_FACTOR = 10;
+    return score * std::min(1 + config::compaction_score_scan_frequency_weight * scan_frequency,
+                            MAX_SCAN_FACTOR);
+}
+
 std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         CompactionType compaction_type, DataDir* data_dir,
         const std::unordered_set<TabletSharedPtr>& tablet_submitted_compaction, uint32_t* score,
@@ -738,13 +754,16 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
     const string& compaction_type_str =
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
+    double highest_priority = 0;
     // find the single compaction tablet
     uint32_t single_compact_highest_score = 0;
     TabletSharedPtr best_tablet;
     TabletSharedPtr best_single_compact_tablet;
     int64_t compaction_num_per_round =
             ExecEnv::GetInstance()->storage_engine().to_local().get_compaction_num_per_round();
-    auto cmp = [](TabletScore left, TabletScore right) { return left.score > right.score; };
+    auto cmp = [](const TabletScore& left, const TabletScore& right) {
+        return left.priority > right.priority;
+    };
     std::priority_queue<TabletScore, std::vector<TabletScore>, decltype(cmp)> top_tablets(cmp);
 
     auto handler = [&](const TabletSharedPtr& tablet_ptr) {
@@ -801,6 +820,8 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
+        double priority = compaction_priority(tablet_ptr.get(), compaction_type,
+                                              current_compaction_score, now_ms);
 
         // tablet should do single compaction
         if (current_compaction_score > single_compact_highest_score &&
@@ -816,9 +837,10 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
         if (compaction_num_per_round > 1 && !tablet_ptr->should_fetch_from_peer()) {
             TabletScore ts;
             ts.score = current_compaction_score;
+            ts.priority = priority;
             ts.tablet_ptr = tablet_ptr;
             if ((top_tablets.size() >= compaction_num_per_round &&
-                 current_compaction_score > top_tablets.top().score) ||
+                 priority > top_tablets.top().priority) ||
                 top_tablets.size() < compaction_num_per_round) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
@@ -831,10 +853,11 @@ std::vector<TabletSharedPtr> TabletManager::find_best_tablets_to_compaction(
                 }
             }
         } else {
-            if (current_compaction_score > highest_score && !tablet_ptr->should_fetch_from_peer()) {
+            if (priority > highest_priority && !tablet_ptr->should_fetch_from_peer()) {
                 bool ret = tablet_ptr->suitable_for_compaction(compaction_type,
                                                                cumulative_compaction_policy);
                 if (ret) {
+                    highest_priority = priority;
                     highest_score = current_compaction_score;
                     best_tablet = tablet_ptr;
                 }
@@ -955,7 +978,7 @@ Status TabletManager::load_tablet_from_meta(DataDir* data_dir, TTabletId tablet_
             tablet->init(), absl::Substitute("tablet init failed. tablet=$0", tablet->tablet_id()));
 
     RuntimeProfile profile("CreateTablet");
-    std::lock_guard<std::shared_mutex> wrlock(_get_tablets_shard_lock(tablet_id));
+    std::lock_guard wrlock(_get_tablets_shard_lock(tablet_id));
     RETURN_NOT_OK_STATUS_WITH_WARN(
             _add_tablet_unlocked(tablet_id, tablet, update_meta, force, &profile),
             absl::Substitute("fail to add tablet. tablet=$0", tablet->tablet_id()));
@@ -1621,7 +1644,7 @@ void TabletManager::obtain_specific_quantity_tablets(vector<TabletInfo>& tablets
     }
 }
 
-std::shared_mutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
+InstrumentedSharedMutex& TabletManager::_get_tablets_shard_lock(TTabletId tabletId) {
     return _get_tablets_shard(tabletId).lock;
 }
 
@@ -1750,7 +1773,7 @@ std::set<int64_t> TabletManager::check_all_tablet_segment(bool repair) {
     for (const auto& [shard_index, shard_tablets] : repair_shard_bad_tablets) {
         auto& tablets_shard = _tablets_shards[shard_index];
         auto& tablet_map = tablets_shard.tablet_map;
-        std::lock_guard<std::shared_mutex> wrlock(tablets_shard.lock);
+        std::lock_guard wrlock(tablets_shard.lock);
         for (auto tablet_id : shard_tablets) {
             auto it = tablet_map.find(tablet_id);
             if (it == tablet_map.end()) {
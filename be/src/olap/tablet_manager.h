@@ -40,6 +40,7 @@
 #include "olap/olap_common.h"
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
+#include "util/instrumented_mutex.h"
 
 namespace doris {
 
@@ -223,7 +224,7 @@ private:
 
     void _remove_tablet_from_partition(const TabletSharedPtr& tablet);
 
-    std::shared_mutex& _get_tablets_shard_lock(TTabletId tabletId);
+    InstrumentedSharedMutex& _get_tablets_shard_lock(TTabletId tabletId);
 
     bool _move_tablet_to_trash(const TabletSharedPtr& tablet);
 
@@ -238,7 +239,7 @@ private:
             tablet_map = std::move(shard.tablet_map);
             tablets_under_transition = std::move(shard.tablets_under_transition);
         }
-        mutable std::shared_mutex lock;
+        mutable InstrumentedSharedMutex lock {"tablet_manager_shard"};
         tablet_map_t tablet_map;
         std::mutex lock_for_transition;
         // tablet do clone, path gc, move to trash, disk migrate will record in tablets_under_transition
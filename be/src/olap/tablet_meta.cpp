@@ -1495,7 +1495,14 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
                 val->bitmap |= bm;
             }
         }
+        // The deleted rows of a segment are mostly in runs, e.g. the rows overwritten by a load
+        // of a key range, so the run containers keep the cached bitmap small.
+        val->bitmap.runOptimize();
+        val->bitmap.shrinkToFit();
         size_t charge = val->bitmap.getSizeInBytes() + sizeof(DeleteBitmapAggCache::Value);
+        val->charge = static_cast<int64_t>(charge);
+        val->tablet_agg_cache_size = _agg_cache_size;
+        _agg_cache_size->fetch_add(val->charge, std::memory_order_relaxed);
         handle = DeleteBitmapAggCache::instance()->insert(key, val, charge, charge,
                                                           CachePriority::NORMAL);
         if (config::enable_mow_get_agg_by_cache && !val->bitmap.isEmpty()) {
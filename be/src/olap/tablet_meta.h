@@ -376,7 +376,16 @@ public:
 
     class Value : public LRUCacheValueBase {
     public:
+        ~Value() override {
+            if (tablet_agg_cache_size != nullptr) {
+                tablet_agg_cache_size->fetch_sub(charge, std::memory_order_relaxed);
+            }
+        }
+
         roaring::Roaring bitmap;
+        // The size of the cached bitmaps of the tablet, this value is subtracted when evicted.
+        std::shared_ptr<std::atomic<int64_t>> tablet_agg_cache_size;
+        int64_t charge = 0;
     };
 };
 
@@ -487,6 +496,13 @@ public:
 
     uint64_t get_size() const;
 
+    /**
+     * return the size of the aggregated bitmaps of this delete bitmap in DeleteBitmapAggCache
+     */
+    int64_t get_agg_cache_size() const {
+        return _agg_cache_size->load(std::memory_order_relaxed);
+    }
+
     /**
      * Sets the bitmap of specific segment, it's may be insertion or replacement
      *
@@ -587,6 +603,8 @@ private:
     int64_t _tablet_id;
     mutable std::shared_mutex _rowset_cache_version_lock;
     mutable std::map<RowsetId, std::map<SegmentId, Version>> _rowset_cache_version;
+    std::shared_ptr<std::atomic<int64_t>> _agg_cache_size =
+            std::make_shared<std::atomic<int64_t>>(0);
 };
 
 inline TabletUid TabletMeta::tablet_uid() const {
@@ -296,6 +296,7 @@ Status TabletReader::_init_params(const ReaderParams& read_params) {
     _tablet_schema = read_params.tablet_schema;
     _reader_context.runtime_state = read_params.runtime_state;
     _reader_context.target_cast_type_for_variants = read_params.target_cast_type_for_variants;
+    _reader_context.struct_read_sub_columns = read_params.struct_read_sub_columns;
 
     RETURN_IF_ERROR(_init_conditions_param(read_params));
 
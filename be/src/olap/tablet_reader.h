@@ -145,6 +145,8 @@ public:
         std::vector<RowsetMetaSharedPtr> delete_predicates;
         // slots that cast may be eliminated in storage layer
         std::map<std::string, PrimitiveType> target_cast_type_for_variants;
+        // the only sub columns read of the struct columns, the others are filled with defaults
+        std::map<ColumnId, std::vector<std::string>> struct_read_sub_columns;
 
         std::vector<RowSetSplits> rs_splits;
         // For unique key table with merge-on-write
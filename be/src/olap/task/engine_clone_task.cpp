@@ -18,6 +18,7 @@
 #include "olap/task/engine_clone_task.h"
 
 #include <absl/strings/str_split.h>
+#include <bvar/bvar.h>
 #include <curl/curl.h>
 #include <fcntl.h>
 #include <fmt/format.h>
@@ -66,6 +67,7 @@
 #include "util/network_util.h"
 #include "util/security.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -75,6 +77,12 @@ using std::stringstream;
 namespace doris {
 using namespace ErrorCode;
 
+// The progress of the clone downloads, exposed by the bvar http service.
+bvar::Adder<uint64_t> g_clone_download_bytes("clone", "download_bytes");
+bvar::PerSecond<bvar::Adder<uint64_t>> g_clone_download_bytes_per_second(
+        "clone", "download_bytes_per_second", &g_clone_download_bytes, 60);
+bvar::Adder<uint64_t> g_clone_download_files("clone", "download_files");
+
 namespace {
 /// if binlog file exist, then check if binlog file md5sum equal
 /// if equal, then skip link file
@@ -626,6 +634,8 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
         RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
+        g_clone_download_bytes << file_size;
+        g_clone_download_files << 1;
     } // Clone files from remote backend
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -677,6 +687,7 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
 
     size_t total_file_size = 0;
     size_t total_files = file_info_list.size();
+    std::vector<std::vector<std::pair<std::string, size_t>>> batches;
     std::vector<std::pair<std::string, size_t>> batch_files;
     for (size_t i = 0; i < total_files;) {
         size_t batch_file_size = 0;
@@ -690,19 +701,71 @@ Status EngineCloneTask::_batch_download_files(DataDir* data_dir, const std::stri
             batch_files.push_back(file_info_list[j]);
             batch_file_size += file_info_list[j].second;
         }
+        total_file_size += batch_file_size;
+        i += batch_files.size();
+        batches.push_back(std::move(batch_files));
+        batch_files.clear();
+    }
 
+    auto download_batch = [&](const std::vector<std::pair<std::string, size_t>>& files) {
+        size_t batch_file_size = 0;
+        for (const auto& [_, file_size] : files) {
+            batch_file_size += file_size;
+        }
         // check disk capacity
         if (data_dir->reach_capacity_limit(batch_file_size)) {
             return Status::Error<EXCEEDED_LIMIT>(
                     "reach the capacity limit of path {}, file_size={}", data_dir->path(),
                     batch_file_size);
         }
+        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, files));
+        g_clone_download_bytes << batch_file_size;
+        g_clone_download_files << files.size();
+        return Status::OK();
+    };
 
-        RETURN_IF_ERROR(download_files_v2(address, token, remote_dir, local_dir, batch_files));
-
-        total_file_size += batch_file_size;
-        i += batch_files.size();
-        batch_files.clear();
+    // The batches before the last one are downloaded concurrently, the last batch, which holds
+    // the header file if the tablet has more than one file, is downloaded after all of them.
+    auto* thread_pool = _engine.clone_download_thread_pool();
+    size_t num_concurrent_batches = batches.empty() ? 0 : batches.size() - 1;
+    if (thread_pool != nullptr && config::clone_download_parallelism > 1 &&
+        num_concurrent_batches > 1) {
+        auto download_token = thread_pool->new_token(ThreadPool::ExecutionMode::CONCURRENT,
+                                                     config::clone_download_parallelism);
+        std::mutex status_lock;
+        Status download_status;
+        for (size_t i = 0; i < num_concurrent_batches; ++i) {
+            {
+                std::lock_guard lock(status_lock);
+                if (!download_status.ok()) {
+                    break;
+                }
+            }
+            Status st = download_token->submit_func([&, i]() {
+                SCOPED_ATTACH_TASK(_mem_tracker);
+                Status batch_status = download_batch(batches[i]);
+                if (!batch_status.ok()) {
+                    std::lock_guard lock(status_lock);
+                    if (download_status.ok()) {
+                        download_status = std::move(batch_status);
+                    }
+                }
+            });
+            if (!st.ok()) {
+                std::lock_guard lock(status_lock);
+                download_status = std::move(st);
+                break;
+            }
+        }
+        download_token->wait();
+        RETURN_IF_ERROR(download_status);
+    } else {
+        for (size_t i = 0; i < num_concurrent_batches; ++i) {
+            RETURN_IF_ERROR(download_batch(batches[i]));
+        }
+    }
+    if (!batches.empty()) {
+        RETURN_IF_ERROR(download_batch(batches.back()));
     }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
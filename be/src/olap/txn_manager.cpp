@@ -77,10 +77,15 @@ TxnManager::TxnManager(StorageEngine& engine, int32_t txn_map_shard_size, int32_
     DCHECK_GT(_txn_shard_size, 0);
     DCHECK_EQ(_txn_map_shard_size & (_txn_map_shard_size - 1), 0);
     DCHECK_EQ(_txn_shard_size & (_txn_shard_size - 1), 0);
-    _txn_map_locks = new std::shared_mutex[_txn_map_shard_size];
+    for (int32_t i = 0; i < _txn_map_shard_size; ++i) {
+        _txn_map_locks.push_back(
+                std::make_unique<InstrumentedSharedMutex>("txn_manager_txn_map"));
+    }
     _txn_tablet_maps = new txn_tablet_map_t[_txn_map_shard_size];
     _txn_partition_maps = new txn_partition_map_t[_txn_map_shard_size];
-    _txn_mutex = new std::shared_mutex[_txn_shard_size];
+    for (int32_t i = 0; i < _txn_shard_size; ++i) {
+        _txn_mutex.push_back(std::make_unique<InstrumentedSharedMutex>("txn_manager_txn"));
+    }
     _txn_tablet_delta_writer_map = new txn_tablet_delta_writer_map_t[_txn_map_shard_size];
     _txn_tablet_delta_writer_map_locks = new std::shared_mutex[_txn_map_shard_size];
     // For debugging
@@ -112,7 +117,7 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
                                bool ingest) {
     TxnKey key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
-    std::lock_guard<std::shared_mutex> txn_wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard txn_wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
 
     DBUG_EXECUTE_IF("TxnManager.prepare_txn.random_failed", {
@@ -250,10 +255,10 @@ void TxnManager::set_txn_related_delete_bitmap(
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
 
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard txn_lock(_get_txn_lock(transaction_id));
     {
         // get tx
-        std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+        std::lock_guard wrlock(_get_txn_map_lock(transaction_id));
         txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
         auto it = txn_tablet_map.find(key);
         if (it == txn_tablet_map.end()) {
@@ -316,7 +321,7 @@ Status TxnManager::commit_txn(OlapMeta* meta, TPartitionId partition_id,
         }
     });
 
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard txn_lock(_get_txn_lock(transaction_id));
     // this while loop just run only once, just for if break
     do {
         // get tx
@@ -424,7 +429,7 @@ Status TxnManager::commit_txn(OlapMeta* meta, TPartitionId partition_id,
     }
 
     {
-        std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+        std::lock_guard wrlock(_get_txn_map_lock(transaction_id));
         auto load_info = std::make_shared<TabletTxnInfo>(load_id, rowset_ptr);
         load_info->pending_rs_guard = std::move(guard);
         if (is_recovery) {
@@ -609,8 +614,8 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
     /// Step 5: remove tablet_info from tnx_tablet_map
     // txn_tablet_map[key] empty, remove key from txn_tablet_map
     int64_t t6 = MonotonicMicros();
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard wrlock(_get_txn_map_lock(transaction_id));
     stats->lock_wait_time_us += MonotonicMicros() - t6;
     _remove_txn_tablet_info_unlocked(partition_id, transaction_id, tablet_id, tablet_uid, txn_lock,
                                      wrlock);
@@ -621,11 +626,10 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
     return status;
 }
 
-void TxnManager::_remove_txn_tablet_info_unlocked(TPartitionId partition_id,
-                                                  TTransactionId transaction_id,
-                                                  TTabletId tablet_id, TabletUid tablet_uid,
-                                                  std::lock_guard<std::shared_mutex>& txn_lock,
-                                                  std::lock_guard<std::shared_mutex>& wrlock) {
+void TxnManager::_remove_txn_tablet_info_unlocked(
+        TPartitionId partition_id, TTransactionId transaction_id, TTabletId tablet_id,
+        TabletUid tablet_uid, std::lock_guard<InstrumentedSharedMutex>& txn_lock,
+        std::lock_guard<InstrumentedSharedMutex>& wrlock) {
     std::pair<int64_t, int64_t> key {partition_id, transaction_id};
     TabletInfo tablet_info {tablet_id, tablet_uid};
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
@@ -641,8 +645,8 @@ void TxnManager::_remove_txn_tablet_info_unlocked(TPartitionId partition_id,
 
 void TxnManager::remove_txn_tablet_info(TPartitionId partition_id, TTransactionId transaction_id,
                                         TTabletId tablet_id, TabletUid tablet_uid) {
-    std::lock_guard<std::shared_mutex> txn_lock(_get_txn_lock(transaction_id));
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard txn_lock(_get_txn_lock(transaction_id));
+    std::lock_guard wrlock(_get_txn_map_lock(transaction_id));
     _remove_txn_tablet_info_unlocked(partition_id, transaction_id, tablet_id, tablet_uid, txn_lock,
                                      wrlock);
 }
@@ -656,7 +660,7 @@ Status TxnManager::rollback_txn(TPartitionId partition_id, TTransactionId transa
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
 
-    std::lock_guard<std::shared_mutex> wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
 
     auto it = txn_tablet_map.find(key);
@@ -696,7 +700,7 @@ Status TxnManager::delete_txn(OlapMeta* meta, TPartitionId partition_id,
                               TabletUid tablet_uid) {
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, tablet_uid);
-    std::lock_guard<std::shared_mutex> txn_wrlock(_get_txn_map_lock(transaction_id));
+    std::lock_guard txn_wrlock(_get_txn_map_lock(transaction_id));
     txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it == txn_tablet_map.end()) {
@@ -749,7 +753,7 @@ void TxnManager::get_tablet_related_txns(TTabletId tablet_id, TabletUid tablet_u
 
     TabletInfo tablet_info(tablet_id, tablet_uid);
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::shared_lock txn_rdlock(_txn_map_locks[i]);
+        std::shared_lock txn_rdlock(*_txn_map_locks[i]);
         txn_tablet_map_t& txn_tablet_map = _txn_tablet_maps[i];
         for (auto& it : txn_tablet_map) {
             if (it.second.find(tablet_info) != it.second.end()) {
@@ -770,7 +774,7 @@ void TxnManager::force_rollback_tablet_related_txns(OlapMeta* meta, TTabletId ta
                                                     TabletUid tablet_uid) {
     TabletInfo tablet_info(tablet_id, tablet_uid);
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::lock_guard<std::shared_mutex> txn_wrlock(_txn_map_locks[i]);
+        std::lock_guard txn_wrlock(*_txn_map_locks[i]);
         txn_tablet_map_t& txn_tablet_map = _txn_tablet_maps[i];
         for (auto it = txn_tablet_map.begin(); it != txn_tablet_map.end();) {
             auto load_itr = it->second.find(tablet_info);
@@ -835,7 +839,7 @@ void TxnManager::get_txn_related_tablets(const TTransactionId transaction_id,
 
 void TxnManager::get_all_related_tablets(std::set<TabletInfo>* tablet_infos) {
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::shared_lock txn_rdlock(_txn_map_locks[i]);
+        std::shared_lock txn_rdlock(*_txn_map_locks[i]);
         for (auto& it : _txn_tablet_maps[i]) {
             for (auto& tablet_load_it : it.second) {
                 tablet_infos->emplace(tablet_load_it.first);
@@ -847,7 +851,7 @@ void TxnManager::get_all_related_tablets(std::set<TabletInfo>* tablet_infos) {
 void TxnManager::get_all_commit_tablet_txn_info_by_tablet(
         const Tablet& tablet, CommitTabletTxnInfoVec* commit_tablet_txn_info_vec) {
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::shared_lock txn_rdlock(_txn_map_locks[i]);
+        std::shared_lock txn_rdlock(*_txn_map_locks[i]);
         for (const auto& [txn_key, load_info_map] : _txn_tablet_maps[i]) {
             auto tablet_load_it = load_info_map.find(tablet.get_tablet_info());
             if (tablet_load_it != load_info_map.end()) {
@@ -873,7 +877,7 @@ void TxnManager::build_expire_txn_map(std::map<TabletInfo, std::vector<int64_t>>
     int64_t now = UnixSeconds();
     // traverse the txn map, and get all expired txns
     for (int32_t i = 0; i < _txn_map_shard_size; i++) {
-        std::shared_lock txn_rdlock(_txn_map_locks[i]);
+        std::shared_lock txn_rdlock(*_txn_map_locks[i]);
         for (auto&& [txn_key, tablet_txn_infos] : _txn_tablet_maps[i]) {
             auto txn_id = txn_key.second;
             for (auto&& [tablet_info, txn_info] : tablet_txn_infos) {
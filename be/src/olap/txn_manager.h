@@ -44,6 +44,7 @@
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
 #include "runtime/memory/lru_cache_policy.h"
+#include "util/instrumented_mutex.h"
 #include "util/time.h"
 #include "vec/core/block.h"
 
@@ -144,8 +145,6 @@ public:
     ~TxnManager() {
         delete[] _txn_tablet_maps;
         delete[] _txn_partition_maps;
-        delete[] _txn_map_locks;
-        delete[] _txn_mutex;
         delete[] _txn_tablet_delta_writer_map;
         delete[] _txn_tablet_delta_writer_map_locks;
     }
@@ -276,13 +275,13 @@ private:
     using txn_tablet_delta_writer_map_t =
             std::unordered_map<int64_t, std::map<int64_t, DeltaWriter*>>;
 
-    std::shared_mutex& _get_txn_map_lock(TTransactionId transactionId);
+    InstrumentedSharedMutex& _get_txn_map_lock(TTransactionId transactionId);
 
     txn_tablet_map_t& _get_txn_tablet_map(TTransactionId transactionId);
 
     txn_partition_map_t& _get_txn_partition_map(TTransactionId transactionId);
 
-    inline std::shared_mutex& _get_txn_lock(TTransactionId transactionId);
+    inline InstrumentedSharedMutex& _get_txn_lock(TTransactionId transactionId);
 
     std::shared_mutex& _get_txn_tablet_delta_writer_map_lock(TTransactionId transactionId);
 
@@ -295,8 +294,8 @@ private:
 
     void _remove_txn_tablet_info_unlocked(TPartitionId partition_id, TTransactionId transaction_id,
                                           TTabletId tablet_id, TabletUid tablet_uid,
-                                          std::lock_guard<std::shared_mutex>& txn_lock,
-                                          std::lock_guard<std::shared_mutex>& wrlock);
+                                          std::lock_guard<InstrumentedSharedMutex>& txn_lock,
+                                          std::lock_guard<InstrumentedSharedMutex>& wrlock);
 
     class TabletVersionCache : public LRUCachePolicy {
     public:
@@ -321,9 +320,9 @@ private:
     // The _txn_partition_maps[i] should be constructed/deconstructed/modified alongside with '_txn_tablet_maps[i]'
     txn_partition_map_t* _txn_partition_maps = nullptr;
 
-    std::shared_mutex* _txn_map_locks = nullptr;
+    std::vector<std::unique_ptr<InstrumentedSharedMutex>> _txn_map_locks;
 
-    std::shared_mutex* _txn_mutex = nullptr;
+    std::vector<std::unique_ptr<InstrumentedSharedMutex>> _txn_mutex;
 
     txn_tablet_delta_writer_map_t* _txn_tablet_delta_writer_map = nullptr;
     std::unique_ptr<TabletVersionCache> _tablet_version_cache;
@@ -331,8 +330,8 @@ private:
     DISALLOW_COPY_AND_ASSIGN(TxnManager);
 }; // TxnManager
 
-inline std::shared_mutex& TxnManager::_get_txn_map_lock(TTransactionId transactionId) {
-    return _txn_map_locks[transactionId & (_txn_map_shard_size - 1)];
+inline InstrumentedSharedMutex& TxnManager::_get_txn_map_lock(TTransactionId transactionId) {
+    return *_txn_map_locks[transactionId & (_txn_map_shard_size - 1)];
 }
 
 inline TxnManager::txn_tablet_map_t& TxnManager::_get_txn_tablet_map(TTransactionId transactionId) {
@@ -344,8 +343,8 @@ inline TxnManager::txn_partition_map_t& TxnManager::_get_txn_partition_map(
     return _txn_partition_maps[transactionId & (_txn_map_shard_size - 1)];
 }
 
-inline std::shared_mutex& TxnManager::_get_txn_lock(TTransactionId transactionId) {
-    return _txn_mutex[transactionId & (_txn_shard_size - 1)];
+inline InstrumentedSharedMutex& TxnManager::_get_txn_lock(TTransactionId transactionId) {
+    return *_txn_mutex[transactionId & (_txn_shard_size - 1)];
 }
 
 inline std::shared_mutex& TxnManager::_get_txn_tablet_delta_writer_map_lock(
@@ -17,6 +17,9 @@
 
 #include "olap/wal/wal_writer.h"
 
+#include <string>
+#include <vector>
+
 #include "common/config.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
@@ -62,32 +65,24 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
-    size_t total_size = 0;
-    size_t offset = 0;
-    for (const auto& block : blocks) {
-        uint8_t len_buf[sizeof(uint64_t)];
-        uint64_t block_length = block->ByteSizeLong();
-        total_size += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
+    // The length, content and checksum of all the blocks are written by one call.
+    std::vector<std::string> contents(blocks.size());
+    std::vector<uint8_t> len_bufs(blocks.size() * LENGTH_SIZE);
+    std::vector<uint8_t> checksum_bufs(blocks.size() * CHECKSUM_SIZE);
+    std::vector<Slice> slices;
+    slices.reserve(blocks.size() * 3);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        contents[i] = blocks[i]->SerializeAsString();
+        uint64_t block_length = contents[i].size();
+        uint8_t* len_buf = len_bufs.data() + i * LENGTH_SIZE;
         encode_fixed64_le(len_buf, block_length);
-        RETURN_IF_ERROR(_file_writer->append({len_buf, sizeof(uint64_t)}));
-        offset += LENGTH_SIZE;
-
-        std::string content = block->SerializeAsString();
-        RETURN_IF_ERROR(_file_writer->append(content));
-        offset += block_length;
-
-        uint8_t checksum_buf[sizeof(uint32_t)];
-        uint32_t checksum = crc32c::Value(content.data(), block_length);
-        encode_fixed32_le(checksum_buf, checksum);
-        RETURN_IF_ERROR(_file_writer->append({checksum_buf, sizeof(uint32_t)}));
-        offset += CHECKSUM_SIZE;
+        uint8_t* checksum_buf = checksum_bufs.data() + i * CHECKSUM_SIZE;
+        encode_fixed32_le(checksum_buf, crc32c::Value(contents[i].data(), block_length));
+        slices.emplace_back(len_buf, LENGTH_SIZE);
+        slices.emplace_back(contents[i]);
+        slices.emplace_back(checksum_buf, CHECKSUM_SIZE);
     }
-    if (offset != total_size) {
-        return Status::InternalError(
-                "failed to write block to wal expected= " + std::to_string(total_size) +
-                ",actually=" + std::to_string(offset));
-    }
-    return Status::OK();
+    return _file_writer->appendv(slices.data(), slices.size());
 }
 
 Status WalWriter::append_header(std::string col_ids) {
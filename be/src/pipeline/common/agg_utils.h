@@ -21,10 +21,12 @@
 #include <vector>
 
 #include "vec/common/arena.h"
+#include "vec/common/hash_table/fixed_key_hash_map.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_util.h"
 #include "vec/common/hash_table/ph_hash_map.h"
 #include "vec/common/hash_table/string_hash_map.h"
+#include "vec/common/hash_table/two_level_hash_map.h"
 
 namespace doris {
 
@@ -32,6 +34,11 @@ template <typename T>
 using AggData = PHHashMap<T, vectorized::AggregateDataPtr, HashCRC32<T>>;
 template <typename T>
 using AggDataNullable = vectorized::DataWithNullKey<AggData<T>>;
+// UInt8 and UInt16 keys index the aggregate states directly instead of hashing.
+template <typename T>
+using FixedKeyAggData = FixedKeyHashMap<T, vectorized::AggregateDataPtr>;
+template <typename T>
+using FixedKeyAggDataNullable = vectorized::DataWithNullKey<FixedKeyAggData<T>>;
 
 using AggregatedDataWithoutKey = vectorized::AggregateDataPtr;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, vectorized::AggregateDataPtr>;
@@ -51,10 +58,14 @@ using AggregatedDataWithNullableUInt64KeyPhase2 =
 using AggregatedDataWithNullableShortStringKey =
         vectorized::DataWithNullKey<AggregatedDataWithShortStringKey>;
 
+template <typename T>
+using TwoLevelAggData = TwoLevelHashMap<AggData<T>>;
+using TwoLevelAggregatedDataWithStringKey = TwoLevelHashMap<AggregatedDataWithStringKey>;
+
 using AggregatedMethodVariants = std::variant<
         std::monostate, vectorized::MethodSerialized<AggregatedDataWithStringKey>,
-        vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>,
-        vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>,
+        vectorized::MethodOneNumber<vectorized::UInt8, FixedKeyAggData<vectorized::UInt8>>,
+        vectorized::MethodOneNumber<vectorized::UInt16, FixedKeyAggData<vectorized::UInt16>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggData<vectorized::UInt32>>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggData<vectorized::UInt64>>,
         vectorized::MethodStringNoCache<AggregatedDataWithShortStringKey>,
@@ -62,10 +73,10 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodOneNumber<vectorized::UInt256, AggData<vectorized::UInt256>>,
         vectorized::MethodOneNumber<vectorized::UInt32, AggregatedDataWithUInt32KeyPhase2>,
         vectorized::MethodOneNumber<vectorized::UInt64, AggregatedDataWithUInt64KeyPhase2>,
-        vectorized::MethodSingleNullableColumn<
-                vectorized::MethodOneNumber<vectorized::UInt8, AggDataNullable<vectorized::UInt8>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
-                vectorized::UInt16, AggDataNullable<vectorized::UInt16>>>,
+                vectorized::UInt8, FixedKeyAggDataNullable<vectorized::UInt8>>>,
+        vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
+                vectorized::UInt16, FixedKeyAggDataNullable<vectorized::UInt16>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
                 vectorized::UInt32, AggDataNullable<vectorized::UInt32>>>,
         vectorized::MethodSingleNullableColumn<vectorized::MethodOneNumber<
@@ -83,7 +94,12 @@ using AggregatedMethodVariants = std::variant<
         vectorized::MethodKeysFixed<AggData<vectorized::UInt64>>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt128>>,
         vectorized::MethodKeysFixed<AggData<vectorized::UInt256>>,
-        vectorized::MethodKeysFixed<AggData<vectorized::UInt136>>>;
+        vectorized::MethodKeysFixed<AggData<vectorized::UInt136>>,
+        vectorized::MethodSerialized<TwoLevelAggregatedDataWithStringKey>,
+        vectorized::MethodKeysFixed<TwoLevelAggData<vectorized::UInt64>>,
+        vectorized::MethodKeysFixed<TwoLevelAggData<vectorized::UInt128>>,
+        vectorized::MethodKeysFixed<TwoLevelAggData<vectorized::UInt256>>,
+        vectorized::MethodKeysFixed<TwoLevelAggData<vectorized::UInt136>>>;
 
 struct AggregatedDataVariants
         : public DataVariants<AggregatedMethodVariants, vectorized::MethodSingleNullableColumn,
@@ -100,10 +116,10 @@ struct AggregatedDataVariants
             method_variant.emplace<vectorized::MethodSerialized<AggregatedDataWithStringKey>>();
             break;
         case HashKeyType::int8_key:
-            emplace_single<vectorized::UInt8, AggData<vectorized::UInt8>>(nullable);
+            emplace_single<vectorized::UInt8, FixedKeyAggData<vectorized::UInt8>>(nullable);
             break;
         case HashKeyType::int16_key:
-            emplace_single<vectorized::UInt16, AggData<vectorized::UInt16>>(nullable);
+            emplace_single<vectorized::UInt16, FixedKeyAggData<vectorized::UInt16>>(nullable);
             break;
         case HashKeyType::int32_key:
             emplace_single<vectorized::UInt32, AggData<vectorized::UInt32>>(nullable);
@@ -154,6 +170,40 @@ struct AggregatedDataVariants
                             "AggregatedDataVariants meet invalid key type, type={}", type);
         }
     }
+
+    // Move the elements of a single-level serialized or fixed keys hash table into a two-level
+    // one. Returns false if the hash method has no two-level variant or is converted already.
+    bool convert_to_two_level() {
+        if (auto* method =
+                    std::get_if<vectorized::MethodSerialized<AggregatedDataWithStringKey>>(
+                            &method_variant)) {
+            auto hash_table = std::make_shared<TwoLevelAggregatedDataWithStringKey>(
+                    std::move(*method->hash_table));
+            using TwoLevelMethod =
+                    vectorized::MethodSerialized<TwoLevelAggregatedDataWithStringKey>;
+            method_variant.emplace<TwoLevelMethod>().hash_table = std::move(hash_table);
+            return true;
+        }
+        return _convert_keys_fixed_to_two_level<vectorized::UInt64>() ||
+               _convert_keys_fixed_to_two_level<vectorized::UInt128>() ||
+               _convert_keys_fixed_to_two_level<vectorized::UInt136>() ||
+               _convert_keys_fixed_to_two_level<vectorized::UInt256>();
+    }
+
+private:
+    template <typename T>
+    bool _convert_keys_fixed_to_two_level() {
+        auto* method = std::get_if<vectorized::MethodKeysFixed<AggData<T>>>(&method_variant);
+        if (method == nullptr) {
+            return false;
+        }
+        auto key_sizes = method->key_sizes;
+        auto hash_table = std::make_shared<TwoLevelAggData<T>>(std::move(*method->hash_table));
+        using TwoLevelMethod = vectorized::MethodKeysFixed<TwoLevelAggData<T>>;
+        method_variant.emplace<TwoLevelMethod>(std::move(key_sizes)).hash_table =
+                std::move(hash_table);
+        return true;
+    }
 };
 
 using AggregatedDataVariantsUPtr = std::unique_ptr<AggregatedDataVariants>;
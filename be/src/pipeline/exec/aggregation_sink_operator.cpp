@@ -71,6 +71,7 @@ Status AggSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
     _hash_table_compute_timer = ADD_TIMER(Base::custom_profile(), "HashTableComputeTime");
     _hash_table_limit_compute_timer = ADD_TIMER(Base::custom_profile(), "DoLimitComputeTime");
     _hash_table_emplace_timer = ADD_TIMER(Base::custom_profile(), "HashTableEmplaceTime");
+    _hash_table_convert_timer = ADD_TIMER(Base::custom_profile(), "HashTableConvertTime");
     _hash_table_input_counter =
             ADD_COUNTER(Base::custom_profile(), "HashTableInputCount", TUnit::UNIT);
 
@@ -565,14 +566,28 @@ void AggSinkLocalState::_emplace_into_hash_table(vectorized::AggregateDataPtr* p
                            };
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
-                           }
+                           agg_method.lazy_emplace_batch(
+                                   state, num_rows, creator, creator_for_null_key,
+                                   [&](size_t i, auto* mapped) { places[i] = *mapped; });
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                        }},
                _agg_data->method_variant);
+    _try_convert_to_two_level_hash_table();
+}
+
+void AggSinkLocalState::_try_convert_to_two_level_hash_table() {
+    if (_two_level_hash_table_checked || config::two_level_aggregation_hash_table_threshold < 0 ||
+        _get_hash_table_size() <=
+                static_cast<size_t>(config::two_level_aggregation_hash_table_threshold)) {
+        return;
+    }
+    _two_level_hash_table_checked = true;
+    // The aggregate states are kept in aggregate_data_container, only the hash table is rebuilt.
+    SCOPED_TIMER(_hash_table_convert_timer);
+    if (_agg_data->convert_to_two_level()) {
+        custom_profile()->add_info_string("HashTableType", "TwoLevel");
+    }
 }
 
 bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateDataPtr* places,
@@ -613,7 +628,8 @@ bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateData
 
                             AggState state(key_columns);
                             agg_method.init_serialized_keys(key_columns, num_rows);
-                            size_t i = 0;
+                            // The top limit is refreshed by the row of every new key.
+                            bool created = false;
 
                             auto creator = [&](const auto& ctor, auto& key, auto& origin) {
                                 try {
@@ -627,7 +643,7 @@ bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateData
                                         throw Exception(st.code(), st.to_string());
                                     }
                                     ctor(key, mapped);
-                                    _shared_state->refresh_top_limit(i, key_columns);
+                                    created = true;
                                 } catch (...) {
                                     // Exception-safety - if it can not allocate memory or create status,
                                     // the destructors will not be called.
@@ -646,14 +662,19 @@ bool AggSinkLocalState::_emplace_into_hash_table_limit(vectorized::AggregateData
                                 if (!st) {
                                     throw Exception(st.code(), st.to_string());
                                 }
-                                _shared_state->refresh_top_limit(i, key_columns);
+                                created = true;
                             };
 
                             SCOPED_TIMER(_hash_table_emplace_timer);
-                            for (i = 0; i < num_rows; ++i) {
-                                places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                     creator_for_null_key);
-                            }
+                            agg_method.lazy_emplace_batch(
+                                    state, num_rows, creator, creator_for_null_key,
+                                    [&](size_t i, auto* mapped) {
+                                        places[i] = *mapped;
+                                        if (created) {
+                                            _shared_state->refresh_top_limit(i, key_columns);
+                                            created = false;
+                                        }
+                                    });
                             COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                             return true;
                         }
@@ -676,15 +697,15 @@ void AggSinkLocalState::_find_in_hash_table(vectorized::AggregateDataPtr* places
                                          agg_method.init_serialized_keys(key_columns, num_rows);
 
                                          /// For all rows.
-                                         for (size_t i = 0; i < num_rows; ++i) {
-                                             auto find_result = agg_method.find(state, i);
-
-                                             if (find_result.is_found()) {
-                                                 places[i] = find_result.get_mapped();
-                                             } else {
-                                                 places[i] = nullptr;
-                                             }
-                                         }
+                                         agg_method.find_batch(
+                                                 state, num_rows,
+                                                 [&](size_t i, auto find_result) {
+                                                     if (find_result.is_found()) {
+                                                         places[i] = find_result.get_mapped();
+                                                     } else {
+                                                         places[i] = nullptr;
+                                                     }
+                                                 });
                                      }},
                _agg_data->method_variant);
 }
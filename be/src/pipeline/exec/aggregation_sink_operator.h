@@ -89,6 +89,7 @@ protected:
                                         vectorized::Block* block, const std::vector<int>& key_locs,
                                         vectorized::ColumnRawPtrs& key_columns, uint32_t num_rows);
     size_t _get_hash_table_size() const;
+    void _try_convert_to_two_level_hash_table();
 
     template <bool limit, bool for_spill = false>
     Status _merge_with_serialized_key_helper(vectorized::Block* block);
@@ -101,6 +102,7 @@ protected:
 
     RuntimeProfile::Counter* _hash_table_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_emplace_timer = nullptr;
+    RuntimeProfile::Counter* _hash_table_convert_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_limit_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_input_counter = nullptr;
     RuntimeProfile::Counter* _build_timer = nullptr;
@@ -114,6 +116,8 @@ protected:
     RuntimeProfile::Counter* _memory_usage_arena = nullptr;
 
     bool _should_limit_output = false;
+    // Whether the hash table is already checked to be converted into a two-level one.
+    bool _two_level_hash_table_checked = false;
 
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
@@ -165,6 +169,12 @@ public:
                        : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
     }
     bool require_data_distribution() const override { return _is_colocate; }
+    // A partial aggregation is merged again by the next phase, so one key may be pre-aggregated
+    // by several instances.
+    bool tolerate_partition_skew_split() const override {
+        return !_needs_finalize && !_is_merge && !_probe_expr_ctxs.empty() &&
+               !_followed_by_shuffled_operator;
+    }
     size_t get_revocable_mem_size(RuntimeState* state) const;
 
     AggregatedDataVariants* get_agg_data(RuntimeState* state) {
@@ -20,19 +20,28 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <string>
+#include <string_view>
 
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
+#include "runtime/exec_env.h"
+#include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/exprs/vectorized_agg_fn.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
 Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<AnalyticSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _evaluation_timer = ADD_TIMER(custom_profile(), "EvaluationTime");
@@ -47,6 +56,11 @@ Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
     _remove_count = ADD_COUNTER(custom_profile(), "RemoveCount", TUnit::UNIT);
     _blocks_memory_usage =
             common_profile()->AddHighWaterMarkCounter("Blocks", TUnit::BYTES, "MemoryUsage", 1);
+    init_spill_read_counters();
+    _spill_state = std::make_shared<AnalyticSpillState>();
+    _spill_state->setup_shared_profile(custom_profile());
+    _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                  "AnalyticSinkSpillDependency", true);
     auto& p = _parent->cast<AnalyticSinkOperatorX>();
     if (!p._has_window || (!p._has_window_start && !p._has_window_end)) {
         // haven't set window, Unbounded:  [unbounded preceding,unbounded following]
@@ -105,7 +119,7 @@ Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
 }
 
 Status AnalyticSinkLocalState::open(RuntimeState* state) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<AnalyticSharedState>::open(state));
+    RETURN_IF_ERROR(Base::open(state));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
     auto& p = _parent->cast<AnalyticSinkOperatorX>();
@@ -119,6 +133,7 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     _result_column_could_resize.resize(_agg_functions_size);
     _use_null_result.resize(_agg_functions_size, 0);
     _could_use_previous_result.resize(_agg_functions_size, 0);
+    _sliding_extreme_queues.resize(_agg_functions_size);
 
     for (int i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i] = p._agg_functions[i]->clone(state, state->obj_pool());
@@ -137,7 +152,11 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
         if (PARTITION_FUNCTION_SET.contains(_agg_functions[i]->function()->get_name())) {
             _streaming_mode = false;
         }
+        if (_executor.get_next_impl == &AnalyticSinkLocalState::_get_next_for_sliding_rows) {
+            _sliding_extreme_queues[i] = _create_sliding_extreme_queue(i);
+        }
         _support_incremental_calculate &=
+                _sliding_extreme_queues[i] != nullptr ||
                 _agg_functions[i]->function()->supported_incremental_mode();
     }
 
@@ -188,7 +207,12 @@ Status AnalyticSinkLocalState::close(RuntimeState* state, Status exec_status) {
     _partition_by_columns.clear();
     _order_by_columns.clear();
     _range_result_columns.clear();
-    return PipelineXSinkLocalState<AnalyticSharedState>::close(state, exec_status);
+    for (auto& spill_stream : _spill_streams) {
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+    }
+    _spill_streams.clear();
+    _spill_stream_ends.clear();
+    return Base::close(state, exec_status);
 }
 
 bool AnalyticSinkLocalState::_get_next_for_sliding_rows(int64_t current_block_rows,
@@ -351,7 +375,7 @@ Status AnalyticSinkLocalState::_execute_impl() {
                 break;
             }
             _init_result_columns();
-            auto current_block_rows = _input_blocks[_output_block_index].rows();
+            auto current_block_rows = _input_block_rows(_output_block_index);
             auto current_block_base_pos =
                     _input_block_first_row_positions[_output_block_index] - _have_removed_rows;
             bool should_output = false;
@@ -364,7 +388,7 @@ Status AnalyticSinkLocalState::_execute_impl() {
 
             if (should_output) {
                 vectorized::Block block;
-                _output_current_block(&block);
+                RETURN_IF_ERROR(_output_current_block(&block));
                 _refresh_buffer_and_dependency_state(&block);
             }
             if (_current_row_position == _partition_by_pose.end && _partition_by_pose.is_ended) {
@@ -384,7 +408,10 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
         for (int j = 0; j < _agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_agg_input_columns[i][j].get());
         }
-        if constexpr (incremental) {
+        if (_sliding_extreme_queues[i]) {
+            _execute_for_sliding_extreme(i, partition_start, partition_end, frame_start,
+                                         frame_end);
+        } else if constexpr (incremental) {
             _agg_functions[i]->function()->execute_function_with_incremental(
                     partition_start, partition_end, frame_start, frame_end,
                     _fn_place_ptr + _offsets_of_aggregate_states[i], agg_columns.data(),
@@ -399,6 +426,65 @@ void AnalyticSinkLocalState::_execute_for_function(int64_t partition_start, int6
     }
 }
 
+std::unique_ptr<SlidingExtremeQueue> AnalyticSinkLocalState::_create_sliding_extreme_queue(
+        size_t i) {
+    if (_agg_expr_ctxs[i].size() != 1) {
+        return nullptr;
+    }
+    // The rows are compared by IColumn::compare_at, which orders NaN differently from MIN/MAX,
+    // so the floating point types keep the per frame evaluation.
+    const auto& input_type = _agg_expr_ctxs[i][0]->root()->data_type();
+    const auto primitive_type = vectorized::remove_nullable(input_type)->get_primitive_type();
+    if (!is_int_or_bool(primitive_type) && !is_decimal(primitive_type) &&
+        !is_date_type(primitive_type) && !is_string_type(primitive_type)) {
+        return nullptr;
+    }
+    // A nullable input is only handled by the nullable wrapper, which skips the NULL rows.
+    std::string_view name = _agg_functions[i]->function()->get_name();
+    const std::string_view nullable_prefix = "Nullable(";
+    if (input_type->is_nullable()) {
+        if (!name.starts_with(nullable_prefix) || !name.ends_with(")")) {
+            return nullptr;
+        }
+        name = name.substr(nullable_prefix.size(), name.size() - nullable_prefix.size() - 1);
+    }
+    if (name == "min") {
+        return std::make_unique<SlidingExtremeQueue>(SlidingExtremeQueue::Kind::MIN);
+    } else if (name == "max") {
+        return std::make_unique<SlidingExtremeQueue>(SlidingExtremeQueue::Kind::MAX);
+    } else if (name == "any") {
+        return std::make_unique<SlidingExtremeQueue>(SlidingExtremeQueue::Kind::ANY);
+    }
+    return nullptr;
+}
+
+void AnalyticSinkLocalState::_execute_for_sliding_extreme(size_t i, int64_t partition_start,
+                                                          int64_t partition_end,
+                                                          int64_t frame_start, int64_t frame_end) {
+    // here is the core function, should not add timer
+    const auto* column = _agg_input_columns[i][0].get();
+    frame_start = std::max(frame_start, partition_start);
+    frame_end = std::min(frame_end, partition_end);
+    auto best_row = frame_start < frame_end
+                            ? _sliding_extreme_queues[i]->advance(*column, partition_start,
+                                                                  frame_start, frame_end)
+                            : -1;
+    // The state only holds the best row, an empty frame makes the result NULL.
+    auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+    _agg_functions[i]->reset(place);
+    _use_null_result[i] = 0;
+    _could_use_previous_result[i] = 0;
+    if (best_row < 0) {
+        best_row = frame_start;
+        frame_end = frame_start;
+    } else {
+        frame_end = best_row + 1;
+    }
+    _agg_functions[i]->function()->add_range_single_place(
+            partition_start, partition_end, best_row, frame_end, place, &column, _agg_arena_pool,
+            &_use_null_result[i], &_could_use_previous_result[i]);
+}
+
 void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     // here is the core function, should not add timer
     for (size_t i = 0; i < _agg_functions_size; ++i) {
@@ -422,9 +508,21 @@ void AnalyticSinkLocalState::_insert_result_info(int64_t start, int64_t end) {
     }
 }
 
-void AnalyticSinkLocalState::_output_current_block(vectorized::Block* block) {
-    block->swap(std::move(_input_blocks[_output_block_index]));
-    _blocks_memory_usage->add(-block->allocated_bytes());
+int64_t AnalyticSinkLocalState::_input_block_rows(int64_t block_index) const {
+    const auto next_block_index = block_index + 1;
+    const auto block_end = next_block_index < _input_block_first_row_positions.size()
+                                   ? _input_block_first_row_positions[next_block_index]
+                                   : _input_total_rows;
+    return block_end - _input_block_first_row_positions[block_index];
+}
+
+Status AnalyticSinkLocalState::_output_current_block(vectorized::Block* block) {
+    if (_output_block_index < _spilled_blocks_end) {
+        RETURN_IF_ERROR(_read_spilled_block(block));
+    } else {
+        block->swap(std::move(_input_blocks[_output_block_index]));
+        _blocks_memory_usage->add(-block->allocated_bytes());
+    }
     DCHECK(_parent->cast<AnalyticSinkOperatorX>()._change_to_nullable_flags.size() ==
            _result_window_columns.size());
     for (size_t i = 0; i < _result_window_columns.size(); ++i) {
@@ -440,6 +538,87 @@ void AnalyticSinkLocalState::_output_current_block(vectorized::Block* block) {
     }
 
     _output_block_index++;
+    return Status::OK();
+}
+
+// The sink is finished by the eos call, so the blocks are read back synchronously instead of
+// waiting for a recover task.
+Status AnalyticSinkLocalState::_read_spilled_block(vectorized::Block* block) {
+    DCHECK(!_spill_streams.empty());
+    auto& spill_stream = _spill_streams.front();
+    bool eos = false;
+    RETURN_IF_ERROR(spill_stream->read_next_block_sync(block, &eos));
+    if (block->rows() != _input_block_rows(_output_block_index)) {
+        return Status::InternalError("Read {} rows of spilled analytic block {}, expected {}",
+                                     block->rows(), _output_block_index,
+                                     _input_block_rows(_output_block_index));
+    }
+    if (_output_block_index + 1 == _spill_stream_ends.front()) {
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+        _spill_streams.pop_front();
+        _spill_stream_ends.pop_front();
+    }
+    return Status::OK();
+}
+
+size_t AnalyticSinkLocalState::revocable_mem_size() const {
+    size_t mem_size = 0;
+    for (auto i = std::max(_output_block_index, _spilled_blocks_end); i < _input_blocks.size();
+         ++i) {
+        mem_size += _input_blocks[i].allocated_bytes();
+    }
+    return mem_size;
+}
+
+Status AnalyticSinkLocalState::revoke_memory(RuntimeState* state,
+                                             const std::shared_ptr<SpillContext>& spill_context) {
+    const auto spill_begin = std::max(_output_block_index, _spilled_blocks_end);
+    const auto spill_end = static_cast<int64_t>(_input_blocks.size());
+    if (spill_begin >= spill_end) {
+        if (spill_context) {
+            spill_context->on_task_finished();
+        }
+        return Status::OK();
+    }
+    custom_profile()->add_info_string("Spilled", "true");
+
+    vectorized::SpillStreamSPtr spill_stream;
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            state, spill_stream, print_id(state->query_id()), "analytic", _parent->node_id(),
+            std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+            operator_profile()));
+    spill_stream->set_read_counters(operator_profile());
+    _spill_streams.emplace_back(spill_stream);
+    _spill_stream_ends.emplace_back(spill_end);
+    _spilled_blocks_end = spill_end;
+
+    auto spill_func = [this, state, spill_stream, spill_begin, spill_end]() {
+        for (auto i = spill_begin; i < spill_end && !state->is_cancelled(); ++i) {
+            auto& block = _input_blocks[i];
+            RETURN_IF_ERROR(spill_stream->spill_block(state, block, false));
+            _blocks_memory_usage->add(-block.allocated_bytes());
+            block.clear();
+        }
+        return spill_stream->spill_eof();
+    };
+
+    auto exception_catch_func = [state, spill_func]() {
+        Defer defer {[state]() {
+            state->get_query_ctx()
+                    ->resource_ctx()
+                    ->task_controller()
+                    ->decrease_revoking_tasks_count();
+        }};
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    state->get_query_ctx()->resource_ctx()->task_controller()->increase_revoking_tasks_count();
+    _spill_dependency->block();
+    return ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit(
+            std::make_shared<SpillSinkRunnable>(state, spill_context, _spill_dependency,
+                                                operator_profile(), _spill_state,
+                                                exception_catch_func));
 }
 
 void AnalyticSinkLocalState::_init_result_columns() {
@@ -450,9 +629,9 @@ void AnalyticSinkLocalState::_init_result_columns() {
         for (size_t i = 0; i < _agg_functions_size; ++i) {
             _result_window_columns[i] = _agg_functions[i]->data_type()->create_column();
             if (_result_column_could_resize[i]) {
-                _result_window_columns[i]->resize(_input_blocks[_output_block_index].rows());
+                _result_window_columns[i]->resize(_input_block_rows(_output_block_index));
             } else {
-                _result_window_columns[i]->reserve(_input_blocks[_output_block_index].rows());
+                _result_window_columns[i]->reserve(_input_block_rows(_output_block_index));
             }
         }
     }
@@ -649,7 +828,9 @@ AnalyticSinkOperatorX::AnalyticSinkOperatorX(ObjectPool* pool, int operator_id,
           _has_window(tnode.analytic_node.__isset.window),
           _has_range_window(tnode.analytic_node.window.type == TAnalyticWindowType::RANGE),
           _has_window_start(tnode.analytic_node.window.__isset.window_start),
-          _has_window_end(tnode.analytic_node.window.__isset.window_end) {}
+          _has_window_end(tnode.analytic_node.window.__isset.window_end) {
+    _spillable = true;
+}
 
 Status AnalyticSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state) {
     RETURN_IF_ERROR(DataSinkOperatorX::init(tnode, state));
@@ -874,6 +1055,11 @@ void AnalyticSinkLocalState::_remove_unused_rows() {
     _current_row_position -= remove_rows;
     _partition_by_pose.remove_unused_rows(remove_rows);
     _order_by_pose.remove_unused_rows(remove_rows);
+    for (auto& queue : _sliding_extreme_queues) {
+        if (queue) {
+            queue->remove_unused_rows(remove_rows);
+        }
+    }
     int64_t candidate_partition_end_size = _next_partition_ends.size();
     while (--candidate_partition_end_size >= 0) {
         auto peek = _next_partition_ends.front();
@@ -898,6 +1084,19 @@ size_t AnalyticSinkOperatorX::get_reserve_mem_size(RuntimeState* state, bool eos
     return local_state._reserve_mem_size;
 }
 
+size_t AnalyticSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
+    if (!state->enable_spill()) {
+        return 0;
+    }
+    return get_local_state(state).revocable_mem_size();
+}
+
+Status AnalyticSinkOperatorX::revoke_memory(RuntimeState* state,
+                                            const std::shared_ptr<SpillContext>& spill_context) {
+    auto& local_state = get_local_state(state);
+    return local_state.revoke_memory(state, spill_context);
+}
+
 Status AnalyticSinkOperatorX::_insert_range_column(vectorized::Block* block,
                                                    const vectorized::VExprContextSPtr& expr,
                                                    vectorized::IColumn* dst_column, size_t length) {
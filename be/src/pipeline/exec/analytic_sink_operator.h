@@ -20,8 +20,12 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <deque>
+
 #include "operator.h"
 #include "pipeline/dependency.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -59,20 +63,82 @@ public:
     int64_t _average_size = 0;
 };
 
+// Finds the best row of MIN/MAX/ANY over `rows between M preceding and N following` in amortized
+// O(1) per output row. Both bounds of the frame only move forward, so a queue of the row positions
+// which may still be the best one is kept, with the best row of the current frame at the front.
+// The NULL rows are skipped, as the nullable wrappers of those functions do.
+struct SlidingExtremeQueue {
+    enum class Kind { MIN, MAX, ANY };
+
+    explicit SlidingExtremeQueue(Kind kind_) : kind(kind_) {}
+
+    // Returns the best row of [frame_start, frame_end), or -1 if all of the rows are NULL.
+    int64_t advance(const vectorized::IColumn& column, int64_t partition_start,
+                    int64_t frame_start, int64_t frame_end) {
+        if (partition_start != current_partition_start) {
+            current_partition_start = partition_start;
+            rows.clear();
+            next_row = partition_start;
+        }
+        for (next_row = std::max(next_row, frame_start); next_row < frame_end; ++next_row) {
+            if (column.is_null_at(next_row)) {
+                continue;
+            }
+            while (kind != Kind::ANY && !rows.empty()) {
+                const int cmp = column.compare_at(rows.back(), next_row, column, 1);
+                if ((kind == Kind::MIN && cmp < 0) || (kind == Kind::MAX && cmp > 0)) {
+                    break;
+                }
+                rows.pop_back();
+            }
+            rows.push_back(next_row);
+        }
+        while (!rows.empty() && rows.front() < frame_start) {
+            rows.pop_front();
+        }
+        return rows.empty() ? -1 : rows.front();
+    }
+
+    void remove_unused_rows(int64_t cnt) {
+        current_partition_start -= cnt;
+        next_row -= cnt;
+        for (auto& row : rows) {
+            row -= cnt;
+        }
+    }
+
+    const Kind kind;
+    std::deque<int64_t> rows;
+    int64_t next_row = 0;
+    int64_t current_partition_start = -1;
+};
+
 // those function cacluate need partition info, so can't be used in streaming mode
 static const std::set<std::string> PARTITION_FUNCTION_SET {"ntile", "cume_dist", "percent_rank"};
 
-class AnalyticSinkLocalState : public PipelineXSinkLocalState<AnalyticSharedState> {
+// Only holds the spill profile of the sink, the spill runnables keep a weak_ptr of it.
+struct AnalyticSpillState final : public BasicSpillSharedState,
+                                  public std::enable_shared_from_this<AnalyticSpillState> {
+    void update_spill_stream_profiles(RuntimeProfile* source_profile) override {}
+};
+
+class AnalyticSinkLocalState : public PipelineXSpillSinkLocalState<AnalyticSharedState> {
     ENABLE_FACTORY_CREATOR(AnalyticSinkLocalState);
 
 public:
+    using Base = PipelineXSpillSinkLocalState<AnalyticSharedState>;
     AnalyticSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
-            : PipelineXSinkLocalState<AnalyticSharedState>(parent, state) {}
+            : Base(parent, state) {}
 
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
     Status close(RuntimeState* state, Status exec_status) override;
 
+    // The input blocks which are buffered but not output yet, only the payload columns of them are
+    // spilled, the evaluated partition by, order by and function input columns stay in memory.
+    size_t revocable_mem_size() const;
+    Status revoke_memory(RuntimeState* state, const std::shared_ptr<SpillContext>& spill_context);
+
 private:
     friend class AnalyticSinkOperatorX;
     Status _execute_impl();
@@ -91,12 +157,17 @@ private:
     template <bool incremental = false>
     void _execute_for_function(int64_t partition_start, int64_t partition_end, int64_t frame_start,
                                int64_t frame_end);
+    std::unique_ptr<SlidingExtremeQueue> _create_sliding_extreme_queue(size_t i);
+    void _execute_for_sliding_extreme(size_t i, int64_t partition_start, int64_t partition_end,
+                                      int64_t frame_start, int64_t frame_end);
     void _insert_result_info(int64_t start, int64_t end);
     int64_t current_pos_in_block() {
         return _current_row_position + _have_removed_rows -
                _input_block_first_row_positions[_output_block_index];
     }
-    void _output_current_block(vectorized::Block* block);
+    int64_t _input_block_rows(int64_t block_index) const;
+    Status _output_current_block(vectorized::Block* block);
+    Status _read_spilled_block(vectorized::Block* block);
     void _reset_state_for_next_partition();
     void _refresh_buffer_and_dependency_state(vectorized::Block* block);
 
@@ -138,6 +209,8 @@ private:
     std::vector<size_t> _offsets_of_aggregate_states;
     std::vector<bool> _result_column_nullable_flags;
     std::vector<bool> _result_column_could_resize;
+    // Only set for the MIN/MAX/ANY functions of a sliding rows frame, see SlidingExtremeQueue.
+    std::vector<std::unique_ptr<SlidingExtremeQueue>> _sliding_extreme_queues;
 
     using vectorized_get_next = bool (AnalyticSinkLocalState::*)(int64_t, int64_t);
     struct executor {
@@ -163,6 +236,15 @@ private:
     int64_t _removed_block_index = 0;
     int64_t _have_removed_rows = 0;
 
+    // The input blocks in [_output_block_index, _spilled_blocks_end) are in the spill streams
+    // instead of _input_blocks. Each revoke writes the following blocks to a new stream, and
+    // _spill_stream_ends keeps the end block index of each stream, so the streams are read back
+    // one by one when their blocks are output.
+    std::shared_ptr<AnalyticSpillState> _spill_state;
+    std::deque<vectorized::SpillStreamSPtr> _spill_streams;
+    std::deque<int64_t> _spill_stream_ends;
+    int64_t _spilled_blocks_end = 0;
+
     RuntimeProfile::Counter* _evaluation_timer = nullptr;
     RuntimeProfile::Counter* _compute_agg_data_timer = nullptr;
     RuntimeProfile::Counter* _compute_partition_by_timer = nullptr;
@@ -215,6 +297,11 @@ public:
 
     size_t get_reserve_mem_size(RuntimeState* state, bool eos) override;
 
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state,
+                         const std::shared_ptr<SpillContext>& spill_context) override;
+
 private:
     friend class AnalyticSinkLocalState;
     Status _insert_range_column(vectorized::Block* block, const vectorized::VExprContextSPtr& expr,
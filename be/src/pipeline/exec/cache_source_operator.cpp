@@ -20,9 +20,11 @@
 #include <functional>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "util/uid_util.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -85,6 +87,16 @@ Status CacheSourceLocalState::init(RuntimeState* state, LocalStateInfo& info) {
                 }
             }
         }
+    } else if (!hit_cache && !cache_param.force_refresh_query_cache &&
+               _parent->cast<CacheSourceOperatorX>()._incremental_reuse &&
+               config::enable_query_cache_incremental_reuse &&
+               _global_cache->lookup(_cache_key, _version, &_query_cache_handle, true) &&
+               *_query_cache_handle.get_cache_slot_orders() == _slot_orders) {
+        // The scan of the tablet decides whether to scan only the rowsets newer than the entry
+        _incremental_reuse = std::make_shared<QueryCache::IncrementalReuse>(
+                _query_cache_handle.get_cache_version());
+        _instance_key = print_id(state->fragment_instance_id()) + _cache_key;
+        _global_cache->register_incremental_reuse(_instance_key, _incremental_reuse);
     }
 
     return Status::OK();
@@ -98,6 +110,18 @@ Status CacheSourceLocalState::open(RuntimeState* state) {
     return Status::OK();
 }
 
+Status CacheSourceLocalState::close(RuntimeState* state) {
+    if (_closed) {
+        return Status::OK();
+    }
+    if (_incremental_reuse != nullptr) {
+        _global_cache->unregister_incremental_reuse(_instance_key);
+        custom_profile()->add_info_string("IncrementalReuse",
+                                          std::to_string(_incremental_reuse->accepted));
+    }
+    return Base::close(state);
+}
+
 std::string CacheSourceLocalState::debug_string(int indentation_level) const {
     fmt::memory_buffer debug_string_buffer;
     fmt::format_to(debug_string_buffer, "{}", Base::debug_string(indentation_level));
@@ -118,7 +142,8 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
 
     if (local_state._hit_cache_results == nullptr) {
         Defer insert_cache([&] {
-            if (*eos) {
+            // The reused entry is inserted together with the new result before it is output
+            if (*eos || local_state._hit_cache_results != nullptr) {
                 local_state.custom_profile()->add_info_string(
                         "InsertCache", std::to_string(local_state._need_insert_cache));
                 if (local_state._need_insert_cache) {
@@ -138,6 +163,27 @@ Status CacheSourceOperatorX::get_block(RuntimeState* state, vectorized::Block* b
         // Here, check the value of `_has_data(state)` again after `data_queue.is_all_finish()` is TRUE
         // as there may be one or more blocks when `data_queue.is_all_finish()` is TRUE.
         *eos = !_has_data(state) && local_state._shared_state->data_queue.is_all_finish();
+        if (*eos && local_state._incremental_reuse != nullptr &&
+            local_state._incremental_reuse->accepted) {
+            // The result of the new rowsets is followed by the result of the reused entry
+            local_state._hit_cache_results = local_state._query_cache_handle.get_cache_result();
+            *eos = local_state._hit_cache_results->empty();
+            for (const auto& cached_block : *local_state._hit_cache_results) {
+                if (!local_state._need_insert_cache) {
+                    break;
+                }
+                local_state._current_query_cache_rows += cached_block->rows();
+                local_state._current_query_cache_bytes += cached_block->allocated_bytes();
+                if (_cache_param.entry_max_bytes < local_state._current_query_cache_bytes ||
+                    _cache_param.entry_max_rows < local_state._current_query_cache_rows) {
+                    local_state._local_cache_blocks.clear();
+                    local_state._need_insert_cache = false;
+                } else {
+                    local_state._local_cache_blocks.emplace_back(
+                            vectorized::Block::create_unique(*cached_block));
+                }
+            }
+        }
 
         if (!output_block) {
             return Status::OK();
@@ -45,6 +45,7 @@ public:
 
     Status init(RuntimeState* state, LocalStateInfo& info) override;
     Status open(RuntimeState* state) override;
+    Status close(RuntimeState* state) override;
 
     [[nodiscard]] std::string debug_string(int indentation_level = 0) const override;
 
@@ -66,14 +67,22 @@ private:
     std::vector<vectorized::BlockUPtr>* _hit_cache_results = nullptr;
     std::vector<int> _hit_cache_column_orders;
     int _hit_cache_pos = 0;
+
+    // Set if the entry of an older version is reused, see QueryCache::IncrementalReuse
+    std::shared_ptr<QueryCache::IncrementalReuse> _incremental_reuse;
+    std::string _instance_key;
 };
 
 class CacheSourceOperatorX final : public OperatorX<CacheSourceLocalState> {
 public:
     using Base = OperatorX<CacheSourceLocalState>;
+    // `incremental_reuse` is true if the cached result is the intermediate result of the
+    // aggregation, which can be combined with the intermediate result of the new rowsets.
     CacheSourceOperatorX(ObjectPool* pool, int plan_node_id, int operator_id,
-                         const TQueryCacheParam& cache_param)
-            : Base(pool, plan_node_id, operator_id), _cache_param(cache_param) {
+                         const TQueryCacheParam& cache_param, bool incremental_reuse)
+            : Base(pool, plan_node_id, operator_id),
+              _cache_param(cache_param),
+              _incremental_reuse(incremental_reuse) {
         _op_name = "CACHE_SOURCE_OPERATOR";
     };
 
@@ -94,6 +103,7 @@ public:
 
 private:
     TQueryCacheParam _cache_param;
+    bool _incremental_reuse = false;
     bool _has_data(RuntimeState* state) const {
         auto& local_state = get_local_state(state);
         return local_state._shared_state->data_queue.remaining_has_data();
@@ -19,11 +19,14 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <limits>
 #include <memory>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "runtime/exec_env.h"
 #include "vec/exprs/vectorized_agg_fn.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris {
 class ExecNode;
@@ -58,7 +61,7 @@ static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
 
 DistinctStreamingAggLocalState::DistinctStreamingAggLocalState(RuntimeState* state,
                                                                OperatorXBase* parent)
-        : PipelineXLocalState<FakeSharedState>(state, parent),
+        : PipelineXSpillLocalState<FakeSharedState>(state, parent),
           batch_size(state->batch_size()),
           _agg_arena_pool(std::make_unique<vectorized::Arena>()),
           _agg_data(std::make_unique<DistinctDataVariants>()),
@@ -78,6 +81,14 @@ Status DistinctStreamingAggLocalState::init(RuntimeState* state, LocalStateInfo&
     _hash_table_size_counter = ADD_COUNTER(custom_profile(), "HashTableSize", TUnit::UNIT);
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
 
+    if (Base::_parent->template cast<DistinctStreamingAggOperatorX>()._spill_partitioner) {
+        init_spill_write_counters();
+        _spill_partition_timer = ADD_TIMER(custom_profile(), "SpillPartitionTime");
+        _spill_frozen_key_rows_counter =
+                ADD_COUNTER(custom_profile(), "SpillFrozenKeyRows", TUnit::UNIT);
+        _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
+                                                      "DistinctStreamingAggSpillDependency", true);
+    }
     return Status::OK();
 }
 
@@ -91,6 +102,12 @@ Status DistinctStreamingAggLocalState::open(RuntimeState* state) {
         RETURN_IF_ERROR(p._probe_expr_ctxs[i]->clone(state, _probe_expr_ctxs[i]));
     }
     RETURN_IF_ERROR(_init_hash_method(_probe_expr_ctxs));
+    if (p._spill_partitioner) {
+        RETURN_IF_ERROR(p._spill_partitioner->clone(state, _spill_partitioner));
+        _spill_partitioned_blocks.resize(p._spill_partitioner->partition_count());
+        _spill_streams.resize(p._spill_partitioner->partition_count());
+        _spill_state = std::make_shared<DistinctStreamingAggSpillState>();
+    }
     return Status::OK();
 }
 
@@ -167,6 +184,219 @@ Status DistinctStreamingAggLocalState::_init_hash_method(
     return Status::OK();
 }
 
+Status DistinctStreamingAggLocalState::_reset_hash_table() {
+    _agg_data = std::make_unique<DistinctDataVariants>();
+    _arena.clear();
+    return _init_hash_method(_probe_expr_ctxs);
+}
+
+bool DistinctStreamingAggLocalState::_should_spill(RuntimeState* state) {
+    if (!_spill_partitioner || !state->enable_spill() || !low_memory_mode()) {
+        return false;
+    }
+    // Freezing a small hash table releases nothing worth the spilling.
+    size_t hash_table_bytes = 0;
+    std::visit(vectorized::Overload {[&](std::monostate& arg) {},
+                                     [&](auto& agg_method) {
+                                         hash_table_bytes =
+                                                 agg_method.hash_table->get_buffer_size_in_bytes();
+                                     }},
+               _agg_data->method_variant);
+    return hash_table_bytes + _arena.size() >= vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM;
+}
+
+Status DistinctStreamingAggLocalState::_spill_new_keys(RuntimeState* state,
+                                                       vectorized::Block* in_block, bool eos) {
+    const auto rows = cast_set<uint32_t>(in_block->rows());
+    if (rows != 0) {
+        const auto column_count = in_block->columns();
+        size_t key_size = _probe_expr_ctxs.size();
+        vectorized::ColumnRawPtrs key_columns(key_size);
+        {
+            SCOPED_TIMER(_expr_timer);
+            for (size_t i = 0; i < key_size; ++i) {
+                int result_column_id = -1;
+                RETURN_IF_ERROR(_probe_expr_ctxs[i]->execute(in_block, &result_column_id));
+                in_block->get_by_position(result_column_id).column =
+                        in_block->get_by_position(result_column_id)
+                                .column->convert_to_full_column_if_const();
+                key_columns[i] = in_block->get_by_position(result_column_id).column.get();
+            }
+        }
+
+        // The keys already in the hash table have been output, only the new keys are spilled.
+        vectorized::IColumn::Filter new_key_filter(rows, 1);
+        size_t frozen_key_rows = 0;
+        std::visit(vectorized::Overload {
+                           [&](std::monostate& arg) -> void {
+                               throw doris::Exception(ErrorCode::INTERNAL_ERROR,
+                                                      "uninited hash table");
+                           },
+                           [&](auto& agg_method) -> void {
+                               SCOPED_TIMER(_hash_table_compute_timer);
+                               using AggState = typename std::decay_t<decltype(agg_method)>::State;
+                               AggState agg_state(key_columns);
+                               agg_method.init_serialized_keys(key_columns, rows);
+                               agg_method.find_batch(agg_state, rows,
+                                                     [&](size_t i, const auto& find_result) {
+                                                         if (find_result.is_found()) {
+                                                             new_key_filter[i] = 0;
+                                                             ++frozen_key_rows;
+                                                         }
+                                                     });
+                           }},
+                   _agg_data->method_variant);
+        COUNTER_UPDATE(_spill_frozen_key_rows_counter, frozen_key_rows);
+
+        if (frozen_key_rows != rows) {
+            SCOPED_TIMER(_spill_partition_timer);
+            RETURN_IF_ERROR(_spill_partitioner->do_partitioning(state, in_block));
+            // The keys are evaluated again when the partition is read back.
+            in_block->erase_tail(column_count);
+
+            std::vector<std::vector<uint32_t>> partition_indexes(_spill_partitioned_blocks.size());
+            const auto* channel_ids = _spill_partitioner->get_channel_ids().get<uint32_t>();
+            for (uint32_t i = 0; i != rows; ++i) {
+                if (new_key_filter[i]) {
+                    partition_indexes[channel_ids[i]].emplace_back(i);
+                }
+            }
+
+            _spill_partitioned_bytes = 0;
+            for (size_t i = 0; i != _spill_partitioned_blocks.size(); ++i) {
+                auto& partitioned_block = _spill_partitioned_blocks[i];
+                const auto& indexes = partition_indexes[i];
+                if (!indexes.empty()) {
+                    if (!partitioned_block) {
+                        partitioned_block =
+                                vectorized::MutableBlock::create_unique(in_block->clone_empty());
+                    }
+                    RETURN_IF_ERROR(partitioned_block->add_rows(in_block, indexes.data(),
+                                                                indexes.data() + indexes.size()));
+                }
+                if (partitioned_block) {
+                    _spill_partitioned_bytes += partitioned_block->allocated_bytes();
+                }
+            }
+        } else {
+            in_block->erase_tail(column_count);
+        }
+    }
+
+    if (eos) {
+        // The keys of every partition are disjoint from the frozen keys, so the frozen hash table
+        // is not needed any more.
+        RETURN_IF_ERROR(_reset_hash_table());
+        _spill_recovering = true;
+        _recover_partition_index = 0;
+        return _submit_spill_task(state, true);
+    }
+    if (_spill_partitioned_bytes >= vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM ||
+        (low_memory_mode() &&
+         _spill_partitioned_bytes >= vectorized::SpillStream::MIN_SPILL_WRITE_BATCH_MEM)) {
+        return _submit_spill_task(state, false);
+    }
+    return Status::OK();
+}
+
+Status DistinctStreamingAggLocalState::_submit_spill_task(RuntimeState* state, bool eos) {
+    auto spill_func = [this, state, eos]() {
+        for (size_t i = 0; i != _spill_partitioned_blocks.size(); ++i) {
+            auto& partitioned_block = _spill_partitioned_blocks[i];
+            auto& spill_stream = _spill_streams[i];
+            if (partitioned_block && !partitioned_block->empty()) {
+                if (!spill_stream) {
+                    RETURN_IF_ERROR(
+                            ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                                    state, spill_stream, print_id(state->query_id()),
+                                    "distinct_streaming_agg", _parent->node_id(),
+                                    std::numeric_limits<int32_t>::max(),
+                                    std::numeric_limits<size_t>::max(), operator_profile()));
+                }
+                RETURN_IF_ERROR(spill_stream->spill_block(state, partitioned_block->to_block(),
+                                                          false));
+            }
+            partitioned_block.reset();
+            if (eos && spill_stream) {
+                RETURN_IF_ERROR(spill_stream->spill_eof());
+            }
+        }
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [spill_func]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return spill_func(); }); }();
+        return status;
+    };
+
+    _spill_partitioned_bytes = 0;
+    _spill_dependency->block();
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    return spill_io_pool->submit(std::make_shared<SpillNonSinkRunnable>(
+            state, _spill_dependency, operator_profile(), _spill_state, exception_catch_func));
+}
+
+Status DistinctStreamingAggLocalState::_recover_spilled_partitions(RuntimeState* state) {
+    while (_aggregated_block->empty()) {
+        if (!_recovered_blocks.empty()) {
+            auto block = std::move(_recovered_blocks.back());
+            _recovered_blocks.pop_back();
+            RETURN_IF_ERROR(_distinct_pre_agg_with_serialized_key(&block, _aggregated_block.get()));
+            continue;
+        }
+        if (_recover_partition_index == _spill_streams.size()) {
+            _spill_recovering = false;
+            break;
+        }
+        if (_spill_streams[_recover_partition_index]) {
+            return _submit_recover_task(state);
+        }
+        // The partition is read back completely, the next one starts with an empty hash table.
+        ++_recover_partition_index;
+        RETURN_IF_ERROR(_reset_hash_table());
+    }
+    return Status::OK();
+}
+
+Status DistinctStreamingAggLocalState::_submit_recover_task(RuntimeState* state) {
+    auto& spill_stream = _spill_streams[_recover_partition_index];
+    spill_stream->set_read_counters(operator_profile());
+
+    auto read_func = [this, &spill_stream]() {
+        vectorized::Block block;
+        bool eos = false;
+        size_t read_size = 0;
+        while (!eos && !_state->is_cancelled()) {
+            RETURN_IF_ERROR(spill_stream->read_next_block_sync(&block, &eos));
+            if (!block.empty()) {
+                read_size += block.allocated_bytes();
+                _recovered_blocks.emplace_back(std::move(block));
+            }
+            if (read_size >= vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM) {
+                break;
+            }
+        }
+        if (eos) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+            spill_stream.reset();
+        }
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [read_func]() {
+        auto status = [&]() {
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(read_func());
+            return Status::OK();
+        }();
+        return status;
+    };
+
+    _spill_dependency->block();
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    return spill_io_pool->submit(std::make_shared<SpillRecoverRunnable>(
+            state, _spill_dependency, operator_profile(), _spill_state, exception_catch_func));
+}
+
 Status DistinctStreamingAggLocalState::_distinct_pre_agg_with_serialized_key(
         doris::vectorized::Block* in_block, doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -302,18 +532,23 @@ void DistinctStreamingAggLocalState::_emplace_into_hash_table_to_distinct(
                         }
                         AggState state(key_columns);
                         agg_method.init_serialized_keys(key_columns, num_rows);
-                        size_t row = 0;
+                        bool created = false;
                         auto creator = [&](const auto& ctor, auto& key, auto& origin) {
                             HashMethodType::try_presis_key(key, origin, _arena);
                             ctor(key);
-                            distinct_row.push_back(row);
+                            created = true;
                         };
-                        auto creator_for_null_key = [&]() { distinct_row.push_back(row); };
+                        auto creator_for_null_key = [&]() { created = true; };
 
                         SCOPED_TIMER(_hash_table_emplace_timer);
-                        for (; row < num_rows; ++row) {
-                            agg_method.lazy_emplace(state, row, creator, creator_for_null_key);
-                        }
+                        agg_method.lazy_emplace_batch(state, num_rows, creator,
+                                                      creator_for_null_key,
+                                                      [&](size_t row, auto* /*mapped*/) {
+                                                          if (created) {
+                                                              distinct_row.push_back(row);
+                                                              created = false;
+                                                          }
+                                                      });
 
                         COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                     }},
@@ -348,6 +583,11 @@ Status DistinctStreamingAggOperatorX::init(const TPlanNode& tnode, RuntimeState*
     // ignore return status for now , so we need to introduce ExecNode::init()
     RETURN_IF_ERROR(
             vectorized::VExpr::create_expr_trees(tnode.agg_node.grouping_exprs, _probe_expr_ctxs));
+    if (!_is_streaming_preagg && !tnode.agg_node.grouping_exprs.empty()) {
+        _spill_partitioner =
+                std::make_unique<SpillPartitionerType>(state->spill_aggregation_partition_count());
+        RETURN_IF_ERROR(_spill_partitioner->init(tnode.agg_node.grouping_exprs));
+    }
 
     _op_name = "DISTINCT_STREAMING_AGGREGATION_OPERATOR";
     return Status::OK();
@@ -357,6 +597,10 @@ Status DistinctStreamingAggOperatorX::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(StatefulOperatorX<DistinctStreamingAggLocalState>::prepare(state));
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_probe_expr_ctxs, state, _child->row_desc()));
     RETURN_IF_ERROR(vectorized::VExpr::open(_probe_expr_ctxs, state));
+    if (_spill_partitioner) {
+        RETURN_IF_ERROR(_spill_partitioner->prepare(state, _child->row_desc()));
+        RETURN_IF_ERROR(_spill_partitioner->open(state));
+    }
     init_make_nullable(state);
     return Status::OK();
 }
@@ -378,6 +622,9 @@ Status DistinctStreamingAggOperatorX::push(RuntimeState* state, vectorized::Bloc
                                            bool eos) const {
     auto& local_state = get_local_state(state);
     local_state._input_num_rows += in_block->rows();
+    if (local_state._spilled) {
+        return local_state._spill_new_keys(state, in_block, eos);
+    }
     if (in_block->rows() == 0) {
         return Status::OK();
     }
@@ -391,12 +638,33 @@ Status DistinctStreamingAggOperatorX::push(RuntimeState* state, vectorized::Bloc
         local_state._aggregated_block->set_num_rows(limit_rows);
         local_state._reach_limit = true;
     }
+    if (!eos && !local_state._reach_limit && local_state._should_spill(state)) {
+        local_state._spilled = true;
+    }
     return Status::OK();
 }
 
 Status DistinctStreamingAggOperatorX::pull(RuntimeState* state, vectorized::Block* block,
                                            bool* eos) const {
     auto& local_state = get_local_state(state);
+    if (local_state._spilled && !local_state._spill_dependency->ready()) {
+        // A spill task is still running, the task is paused by the spill dependency.
+        *eos = false;
+        return Status::OK();
+    }
+    if (local_state._spill_recovering && local_state._aggregated_block->empty()) {
+        RETURN_IF_ERROR(local_state._recover_spilled_partitions(state));
+        if (!local_state._spill_dependency->ready()) {
+            *eos = false;
+            return Status::OK();
+        }
+        if (_limit != -1 &&
+            (local_state._num_rows_returned + local_state._aggregated_block->rows()) > _limit) {
+            auto limit_rows = _limit - local_state._num_rows_returned;
+            local_state._aggregated_block->set_num_rows(limit_rows);
+            local_state._reach_limit = true;
+        }
+    }
     if (!local_state._aggregated_block->empty()) {
         block->swap(*local_state._aggregated_block);
         local_state._aggregated_block->clear_column_data(block->columns());
@@ -415,7 +683,8 @@ Status DistinctStreamingAggOperatorX::pull(RuntimeState* state, vectorized::Bloc
     // If the limit is not reached, it is important to ensure that _aggregated_block is empty
     // because it may still contain data.
     // However, if the limit is reached, there is no need to output data even if some exists.
-    *eos = (local_state._child_eos && local_state._aggregated_block->empty()) ||
+    *eos = (local_state._child_eos && local_state._aggregated_block->empty() &&
+            !local_state._spill_recovering) ||
            (local_state._reach_limit);
     return Status::OK();
 }
@@ -458,6 +727,13 @@ Status DistinctStreamingAggLocalState::close(RuntimeState* state) {
         }
     }
     _cache_block.clear();
+    for (auto& spill_stream : _spill_streams) {
+        if (spill_stream) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+            spill_stream.reset();
+        }
+    }
+    _recovered_blocks.clear();
     return Base::close(state);
 }
 
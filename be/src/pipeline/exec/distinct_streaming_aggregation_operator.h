@@ -21,12 +21,16 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline/common/distinct_agg_utils.h"
+#include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/spill_utils.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 class ExecNode;
@@ -36,10 +40,18 @@ namespace pipeline {
 #include "common/compile_check_begin.h"
 class DistinctStreamingAggOperatorX;
 
-class DistinctStreamingAggLocalState final : public PipelineXLocalState<FakeSharedState> {
+/// Only holds the lifetime of the spill tasks of a distinct streaming agg, the spill streams are
+/// owned by the local state itself.
+struct DistinctStreamingAggSpillState final
+        : public BasicSpillSharedState,
+          public std::enable_shared_from_this<DistinctStreamingAggSpillState> {
+    void update_spill_stream_profiles(RuntimeProfile* source_profile) override {}
+};
+
+class DistinctStreamingAggLocalState final : public PipelineXSpillLocalState<FakeSharedState> {
 public:
     using Parent = DistinctStreamingAggOperatorX;
-    using Base = PipelineXLocalState<FakeSharedState>;
+    using Base = PipelineXSpillLocalState<FakeSharedState>;
     ENABLE_FACTORY_CREATOR(DistinctStreamingAggLocalState);
     DistinctStreamingAggLocalState(RuntimeState* state, OperatorXBase* parent);
 
@@ -59,6 +71,16 @@ private:
                                               const uint32_t num_rows);
     void _make_nullable_output_key(vectorized::Block* block);
     bool _should_expand_preagg_hash_tables();
+    Status _reset_hash_table();
+
+    // Once the memory is low, the keys in the hash table of a final distinct are frozen: the rows
+    // of them are dropped and the rows of new keys are spilled by partition, then every partition
+    // is deduplicated alone after the child is exhausted.
+    bool _should_spill(RuntimeState* state);
+    Status _spill_new_keys(RuntimeState* state, vectorized::Block* in_block, bool eos);
+    Status _submit_spill_task(RuntimeState* state, bool eos);
+    Status _recover_spilled_partitions(RuntimeState* state);
+    Status _submit_recover_task(RuntimeState* state);
 
     void _swap_cache_block(vectorized::Block* block) {
         DCHECK(!_cache_block.is_empty_column());
@@ -89,6 +111,18 @@ private:
     RuntimeProfile::Counter* _hash_table_input_counter = nullptr;
     RuntimeProfile::Counter* _hash_table_size_counter = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+
+    std::unique_ptr<vectorized::PartitionerBase> _spill_partitioner;
+    std::shared_ptr<DistinctStreamingAggSpillState> _spill_state;
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> _spill_partitioned_blocks;
+    std::vector<vectorized::SpillStreamSPtr> _spill_streams;
+    std::vector<vectorized::Block> _recovered_blocks;
+    size_t _spill_partitioned_bytes = 0;
+    uint32_t _recover_partition_index = 0;
+    bool _spilled = false;
+    bool _spill_recovering = false;
+    RuntimeProfile::Counter* _spill_partition_timer = nullptr;
+    RuntimeProfile::Counter* _spill_frozen_key_rows_counter = nullptr;
 };
 
 class DistinctStreamingAggOperatorX final
@@ -138,6 +172,8 @@ private:
     // group by k1,k2
     vectorized::VExprContextSPtrs _probe_expr_ctxs;
     std::vector<size_t> _make_nullable_keys;
+    // Partitions the rows of new keys once a final distinct spills, null if it never spills.
+    std::unique_ptr<vectorized::PartitionerBase> _spill_partitioner;
 
     // If _is_streaming_preagg = true, deduplication will be abandoned in cases where the deduplication rate is low.
     bool _is_streaming_preagg = false;
@@ -32,10 +32,12 @@
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/pipeline_fragment_context.h"
@@ -155,6 +157,17 @@ void ExchangeSinkBuffer::construct_request(TUniqueId fragment_instance_id) {
     _rpc_instances[low_id] = std::move(instance_data);
 }
 
+void ExchangeSinkBuffer::set_broadcast_followers(InstanceLoId leader,
+                                                 const std::vector<TUniqueId>& followers) {
+    auto& leader_data = *_rpc_instances[leader];
+    for (const auto& follower : followers) {
+        auto& follower_data = *_rpc_instances[follower.lo];
+        follower_data.is_broadcast_follower = true;
+        leader_data.broadcast_followers.push_back(&follower_data);
+        leader_data.broadcast_follower_ids.push_back(follower);
+    }
+}
+
 Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&& request) {
     if (_is_failed) {
         return Status::OK();
@@ -168,6 +181,10 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel, TransmitInfo&
     if (instance_data.rpc_channel_is_turn_off) {
         return Status::EndOfFile("receiver eof");
     }
+    if (instance_data.is_broadcast_follower) {
+        // Delivered by the leader of this instance.
+        return Status::OK();
+    }
     bool send_now = false;
     {
         std::unique_lock<std::mutex> lock(*instance_data.mutex);
@@ -210,6 +227,10 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel,
     if (instance_data.rpc_channel_is_turn_off) {
         return Status::EndOfFile("receiver eof");
     }
+    if (instance_data.is_broadcast_follower) {
+        // Delivered by the leader of this instance.
+        return Status::OK();
+    }
     bool send_now = false;
     {
         std::unique_lock<std::mutex> lock(*instance_data.mutex);
@@ -231,6 +252,22 @@ Status ExchangeSinkBuffer::add_block(vectorized::Channel* channel,
     return Status::OK();
 }
 
+uint64_t ExchangeSinkBuffer::_trace_rpc_start() {
+    auto* tracer = ExecEnv::GetInstance()->pipeline_tracer_context();
+    if (tracer == nullptr || !tracer->enabled()) [[likely]] {
+        return 0;
+    }
+    return tracer->record_flow_start(_state->query_id(), "TransmitData");
+}
+
+void ExchangeSinkBuffer::_trace_rpc_end(uint64_t flow_id) {
+    if (flow_id == 0) [[likely]] {
+        return;
+    }
+    ExecEnv::GetInstance()->pipeline_tracer_context()->record_flow_end(
+            _state->query_id(), "TransmitDataCallback", flow_id);
+}
+
 Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
     std::unique_lock<std::mutex> lock(*(instance_data.mutex));
 
@@ -269,6 +306,14 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
     }
 
     auto mem_byte = 0;
+    // Used by adaptive compression.
+    int64_t sent_bytes = 0;
+    int64_t raw_bytes = 0;
+    auto add_block_bytes = [&](const PBlock& block) {
+        auto size = static_cast<int64_t>(block.column_values().size());
+        sent_bytes += size;
+        raw_bytes += block.compressed() ? static_cast<int64_t>(block.uncompressed_size()) : size;
+    };
     if (q_ptr && !q_ptr->empty()) {
         auto& q = *q_ptr;
 
@@ -280,6 +325,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             if (requests[i].block) {
                 // make sure rpc byte size under the _send_multi_blocks_bytes_size
                 mem_byte += requests[i].block->ByteSizeLong();
+                add_block_bytes(*requests[i].block);
                 if (_send_multi_blocks && mem_byte > _send_multi_blocks_byte_size) {
                     requests.resize(i + 1);
                     break;
@@ -326,7 +372,9 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             _failed(ins->id, err);
         });
         send_callback->start_rpc_time = GetCurrentTimeNanos();
-        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx()](
+        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx(),
+                                          rpc_flow_id = _trace_rpc_start(), sent_bytes,
+                                          raw_bytes](
                                                  RpcInstance* ins_ptr, const bool& eos,
                                                  const PTransmitDataResult& result,
                                                  const int64_t& start_rpc_time) {
@@ -337,10 +385,12 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
             // attach task for memory tracker and query id when core
             SCOPED_ATTACH_TASK(_state);
+            _trace_rpc_end(rpc_flow_id);
 
             auto& ins = *ins_ptr;
             auto end_rpc_time = GetCurrentTimeNanos();
             update_rpc_time(ins, start_rpc_time, end_rpc_time);
+            _update_compression_type(ins, sent_bytes, raw_bytes, end_rpc_time - start_rpc_time);
 
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -365,11 +415,23 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
                             create_unique(brpc_request, send_callback);
+            if (!instance_data.broadcast_follower_ids.empty()) {
+                request_embed_fanout_instances(
+                        instance_data.broadcast_follower_ids,
+                        &send_remote_block_closure->cntl_->request_attachment());
+            }
             if (enable_http_send_block(*brpc_request)) {
                 RETURN_IF_ERROR(transmit_block_httpv2(_context->exec_env(),
                                                       std::move(send_remote_block_closure),
                                                       channel->_brpc_dest_addr));
             } else {
+                if (config::exchange_transmit_block_by_attachment) {
+                    // The blocks are owned by this request only, so their column values can be
+                    // handed over to the attachment. Broadcast blocks are shared and not moved.
+                    RETURN_IF_ERROR(request_embed_column_values_in_attachment(
+                            brpc_request.get(),
+                            &send_remote_block_closure->cntl_->request_attachment()));
+                }
                 transmit_blockv2(channel->_brpc_stub.get(), std::move(send_remote_block_closure));
             }
         }
@@ -400,6 +462,7 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             if (requests[i].block_holder->get_block()) {
                 // make sure rpc byte size under the _send_multi_blocks_bytes_size
                 mem_byte += requests[i].block_holder->get_block()->ByteSizeLong();
+                add_block_bytes(*requests[i].block_holder->get_block());
                 if (_send_multi_blocks && mem_byte > _send_multi_blocks_byte_size) {
                     requests.resize(i + 1);
                     break;
@@ -456,7 +519,9 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             _failed(ins->id, err);
         });
         send_callback->start_rpc_time = GetCurrentTimeNanos();
-        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx()](
+        send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx(),
+                                          rpc_flow_id = _trace_rpc_start(), sent_bytes,
+                                          raw_bytes](
                                                  RpcInstance* ins_ptr, const bool& eos,
                                                  const PTransmitDataResult& result,
                                                  const int64_t& start_rpc_time) {
@@ -467,9 +532,11 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
             }
             // attach task for memory tracker and query id when core
             SCOPED_ATTACH_TASK(_state);
+            _trace_rpc_end(rpc_flow_id);
             auto& ins = *ins_ptr;
             auto end_rpc_time = GetCurrentTimeNanos();
             update_rpc_time(ins, start_rpc_time, end_rpc_time);
+            _update_compression_type(ins, sent_bytes, raw_bytes, end_rpc_time - start_rpc_time);
 
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -495,6 +562,11 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
                             create_unique(brpc_request, send_callback);
+            if (!instance_data.broadcast_follower_ids.empty()) {
+                request_embed_fanout_instances(
+                        instance_data.broadcast_follower_ids,
+                        &send_remote_block_closure->cntl_->request_attachment());
+            }
             if (enable_http_send_block(*brpc_request)) {
                 RETURN_IF_ERROR(transmit_block_httpv2(_context->exec_env(),
                                                       std::move(send_remote_block_closure),
@@ -519,10 +591,16 @@ Status ExchangeSinkBuffer::_send_rpc(RpcInstance& instance_data) {
 }
 
 void ExchangeSinkBuffer::_ended(RpcInstance& ins) {
-    std::unique_lock<std::mutex> lock(*ins.mutex);
-    ins.running_sink_count--;
-    if (ins.running_sink_count == 0) {
-        _turn_off_channel(ins, lock);
+    {
+        std::unique_lock<std::mutex> lock(*ins.mutex);
+        ins.running_sink_count--;
+        if (ins.running_sink_count == 0) {
+            _turn_off_channel(ins, lock);
+        }
+    }
+    // The receiving backend has delivered the eos to the followers as well.
+    for (auto* follower : ins.broadcast_followers) {
+        _ended(*follower);
     }
 }
 
@@ -534,6 +612,10 @@ void ExchangeSinkBuffer::_failed(InstanceLoId id, const std::string& err) {
 }
 
 void ExchangeSinkBuffer::_set_receiver_eof(RpcInstance& ins) {
+    // The receiving backend only returns eof if the followers have finished too.
+    for (auto* follower : ins.broadcast_followers) {
+        _set_receiver_eof(*follower);
+    }
     std::unique_lock<std::mutex> lock(*ins.mutex);
     // When the receiving side reaches eof, it means the receiver has finished early.
     // The remaining data in the current rpc_channel does not need to be sent,
@@ -627,6 +709,56 @@ void ExchangeSinkBuffer::update_rpc_time(RpcInstance& ins, int64_t start_rpc_tim
     }
 }
 
+segment_v2::CompressionTypePB ExchangeSinkBuffer::choose_compression_type(
+        int64_t throughput, double compression_ratio,
+        segment_v2::CompressionTypePB default_type) {
+    if (throughput >= config::exchange_adaptive_compression_fast_link_mb_per_sec * 1024 * 1024) {
+        // Sending is cheap, only keep a light codec if data is well compressible.
+        return compression_ratio >= config::exchange_adaptive_compression_min_ratio
+                       ? segment_v2::CompressionTypePB::LZ4
+                       : segment_v2::CompressionTypePB::NO_COMPRESSION;
+    }
+    if (throughput <= config::exchange_adaptive_compression_slow_link_mb_per_sec * 1024 * 1024) {
+        return segment_v2::CompressionTypePB::ZSTD;
+    }
+    return default_type;
+}
+
+segment_v2::CompressionTypePB ExchangeSinkBuffer::compression_type(
+        InstanceLoId ins_id, segment_v2::CompressionTypePB default_type) {
+    auto it = _rpc_instances.find(ins_id);
+    if (it == _rpc_instances.end()) {
+        return default_type;
+    }
+    auto type = it->second->compression_type.load(std::memory_order_relaxed);
+    return type < 0 ? default_type : static_cast<segment_v2::CompressionTypePB>(type);
+}
+
+void ExchangeSinkBuffer::_update_compression_type(RpcInstance& ins, int64_t sent_bytes,
+                                                  int64_t raw_bytes, int64_t rpc_time) {
+    if (!config::enable_exchange_adaptive_compression || sent_bytes == 0 || rpc_time <= 0) {
+        return;
+    }
+    auto& window = ins.compression_window;
+    window.rpc_count++;
+    window.sent_bytes += sent_bytes;
+    window.raw_bytes += raw_bytes;
+    window.rpc_time += rpc_time;
+    if (window.rpc_count < config::exchange_adaptive_compression_window_rpcs) {
+        return;
+    }
+    auto throughput = static_cast<int64_t>(static_cast<double>(window.sent_bytes) * NANOS_PER_SEC /
+                                           static_cast<double>(window.rpc_time));
+    auto ratio = static_cast<double>(window.raw_bytes) / static_cast<double>(window.sent_bytes);
+    auto default_type = _state->fragement_transmission_compression_type();
+    auto type = choose_compression_type(throughput, ratio, default_type);
+    int new_type = type == default_type ? -1 : static_cast<int>(type);
+    if (ins.compression_type.exchange(new_type, std::memory_order_relaxed) != new_type) {
+        _compression_switch_count++;
+    }
+    window = AdaptiveCompressionWindow {};
+}
+
 void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* _max_rpc_timer = ADD_TIMER_WITH_LEVEL(profile, "RpcMaxTime", 1);
     auto* _min_rpc_timer = ADD_TIMER(profile, "RpcMinTime");
@@ -644,6 +776,31 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
 
+    int64_t broadcast_followers = 0;
+    for (const auto& [_, ins] : _rpc_instances) {
+        broadcast_followers += ins->is_broadcast_follower;
+    }
+    if (broadcast_followers > 0) {
+        ADD_COUNTER(profile, "BroadcastFollowerInstances", TUnit::UNIT)->set(broadcast_followers);
+    }
+
+    if (config::enable_exchange_adaptive_compression) {
+        ADD_COUNTER(profile, "AdaptiveCompressionSwitchCount", TUnit::UNIT)
+                ->set(_compression_switch_count.load());
+        std::map<std::string, int> instances_per_type;
+        auto default_type = _state->fragement_transmission_compression_type();
+        for (const auto& [_, ins] : _rpc_instances) {
+            auto type = ins->compression_type.load(std::memory_order_relaxed);
+            instances_per_type[segment_v2::CompressionTypePB_Name(
+                    type < 0 ? default_type : static_cast<segment_v2::CompressionTypePB>(type))]++;
+        }
+        std::string choices;
+        for (const auto& [name, count] : instances_per_type) {
+            choices += fmt::format("{}{}: {}", choices.empty() ? "" : ", ", name, count);
+        }
+        profile->add_info_string("AdaptiveCompression", choices);
+    }
+
     auto max_count = _state->rpc_verbose_profile_max_instance_count();
     // This counter will lead to performance degradation.
     // So only collect this information when the profile level is greater than 3.
@@ -31,6 +31,7 @@
 #include <queue>
 #include <stack>
 #include <string>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/status.h"
@@ -127,6 +128,16 @@ struct RpcInstanceStatistics {
     int64_t sum_time = 0;
 };
 
+// RPCs observed since the last adaptive compression decision of one instance.
+struct AdaptiveCompressionWindow {
+    int64_t rpc_count = 0;
+    // Bytes of `column_values` sent, i.e. after compression.
+    int64_t sent_bytes = 0;
+    // Bytes of `column_values` before compression.
+    int64_t raw_bytes = 0;
+    int64_t rpc_time = 0;
+};
+
 // Consolidated structure for RPC instance data
 struct RpcInstance {
     // Constructor initializes the instance with the given ID
@@ -164,6 +175,18 @@ struct RpcInstance {
 
     // Count of active exchange sinks using this RPC instance
     int64_t running_sink_count = 0;
+
+    // Only accessed by RPC callbacks, which are serialized for one instance.
+    AdaptiveCompressionWindow compression_window;
+    // Compression type chosen for blocks sent to this instance, -1 means the session one.
+    std::atomic<int> compression_type = -1;
+
+    // Broadcast once per host: the other instances on the backend of this instance, which get
+    // everything sent to this instance from the receiving backend. Set before any RPC.
+    std::vector<RpcInstance*> broadcast_followers;
+    std::vector<TUniqueId> broadcast_follower_ids;
+    // Nothing is sent to a follower, its data and eos come with the RPCs of its leader.
+    bool is_broadcast_follower = false;
 };
 
 template <typename Response>
@@ -275,6 +298,9 @@ public:
     ~ExchangeSinkBuffer() override = default;
 
     void construct_request(TUniqueId);
+    // Send everything for `followers` to `leader` only, which must be on the same backend. Must
+    // be called after `construct_request` of all of them and before any block is added.
+    void set_broadcast_followers(InstanceLoId leader, const std::vector<TUniqueId>& followers);
 
     Status add_block(vectorized::Channel* channel, TransmitInfo&& request);
     Status add_block(vectorized::Channel* channel, BroadcastTransmitInfo&& request);
@@ -282,6 +308,16 @@ public:
     void update_rpc_time(RpcInstance& ins, int64_t start_rpc_time, int64_t receive_rpc_time);
     void update_profile(RuntimeProfile* profile);
 
+    // Compression type for blocks sent to instance `ins_id`. Returns `default_type` unless
+    // adaptive compression has chosen another one from the observed link throughput.
+    segment_v2::CompressionTypePB compression_type(InstanceLoId ins_id,
+                                                   segment_v2::CompressionTypePB default_type);
+    // Links faster than the fast threshold are not worth CPU on strong codecs, links slower than
+    // the slow threshold are worth ZSTD. `throughput` is in bytes per second of sent data.
+    static segment_v2::CompressionTypePB choose_compression_type(
+            int64_t throughput, double compression_ratio,
+            segment_v2::CompressionTypePB default_type);
+
     void set_dependency(InstanceLoId sender_ins_id, std::shared_ptr<Dependency> queue_dependency,
                         ExchangeSinkLocalState* local_state) {
         std::lock_guard l(_m);
@@ -315,6 +351,10 @@ private:
     QueryContext* _context = nullptr;
 
     Status _send_rpc(RpcInstance& ins);
+    // Record a flow from the RPC sender to its callback for pipeline tracing. Returns 0 if
+    // tracing is disabled.
+    uint64_t _trace_rpc_start();
+    void _trace_rpc_end(uint64_t flow_id);
 
 #ifndef BE_TEST
     inline void _ended(RpcInstance& ins);
@@ -331,6 +371,9 @@ private:
 
     void get_max_min_rpc_time(int64_t* max_time, int64_t* min_time);
     int64_t get_sum_rpc_time();
+    void _update_compression_type(RpcInstance& ins, int64_t sent_bytes, int64_t raw_bytes,
+                                  int64_t rpc_time);
+    std::atomic<int64_t> _compression_switch_count = 0;
 
     // _total_queue_size is the sum of the sizes of all instance_to_package_queues.
     // Any modification to instance_to_package_queue requires a corresponding modification to _total_queue_size.
@@ -22,10 +22,14 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <random>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "exchange_sink_buffer.h"
@@ -583,9 +587,38 @@ std::shared_ptr<ExchangeSinkBuffer> ExchangeSinkOperatorX::_create_buffer(
     for (const auto& _dest : _dests) {
         sink_buffer->construct_request(_dest.fragment_instance_id);
     }
+    if (_part_type == TPartitionType::UNPARTITIONED && config::exchange_broadcast_once_per_host) {
+        _set_broadcast_followers(sink_buffer.get());
+    }
     return sink_buffer;
 }
 
+// Broadcast blocks are sent once to each remote backend, to the destination instance with the
+// smallest id, and the receiving backend hands them to the other instances listed.
+void ExchangeSinkOperatorX::_set_broadcast_followers(ExchangeSinkBuffer* sink_buffer) {
+    std::map<std::pair<std::string, int>, std::map<InstanceLoId, TUniqueId>> instances_per_host;
+    for (const auto& dest : _dests) {
+        const auto& addr = dest.brpc_server;
+        // Local channels do not go through the sink buffer.
+        if (dest.fragment_instance_id.hi == -1 ||
+            (addr.hostname == BackendOptions::get_localhost() && addr.port == config::brpc_port)) {
+            continue;
+        }
+        instances_per_host[{addr.hostname, addr.port}].emplace(dest.fragment_instance_id.lo,
+                                                               dest.fragment_instance_id);
+    }
+    for (const auto& [_, instances] : instances_per_host) {
+        if (instances.size() < 2) {
+            continue;
+        }
+        std::vector<TUniqueId> followers;
+        for (auto it = std::next(instances.begin()); it != instances.end(); ++it) {
+            followers.push_back(it->second);
+        }
+        sink_buffer->set_broadcast_followers(instances.begin()->first, followers);
+    }
+}
+
 // For a normal shuffle scenario, if the concurrency is n,
 // there can be up to n * n RPCs in the current fragment.
 // Therefore, a shared sink buffer is used here to limit the number of concurrent RPCs.
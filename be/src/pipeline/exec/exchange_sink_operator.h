@@ -240,6 +240,7 @@ private:
     // or each ExchangeSinkLocalState can have its own sink buffer.
     std::shared_ptr<ExchangeSinkBuffer> _create_buffer(
             RuntimeState* state, const std::vector<InstanceLoId>& sender_ins_ids);
+    void _set_broadcast_followers(ExchangeSinkBuffer* sink_buffer);
     std::shared_ptr<ExchangeSinkBuffer> _sink_buffer = nullptr;
     RuntimeState* _state = nullptr;
 
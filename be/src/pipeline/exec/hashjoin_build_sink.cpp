@@ -96,6 +96,54 @@ Status HashJoinBuildSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     return Status::OK();
 }
 
+bool HashJoinBuildSinkLocalState::lookup_build_cache(
+        const std::vector<TScanRangeParams>& scan_ranges) {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    if (!p._use_build_cache || scan_ranges.size() != 1) {
+        return false;
+    }
+    if (!QueryCache::build_cache_key(scan_ranges, p._cache_param, &_build_cache_key,
+                                     &_build_cache_version)
+                 .ok()) {
+        _build_cache_key.clear();
+        return false;
+    }
+    if (!p._cache_param.force_refresh_query_cache) {
+        _build_cache_hit = QueryCache::instance()->lookup(_build_cache_key, _build_cache_version,
+                                                          &_build_cache_handle);
+    }
+    custom_profile()->add_info_string("HitBuildCache", std::to_string(_build_cache_hit));
+    return _build_cache_hit;
+}
+
+Status HashJoinBuildSinkLocalState::_get_build_block_from_cache() {
+    // The build block is modified by the build of hash table, so it is copied from the cache.
+    const auto& cached_block = _build_cache_handle.get_cache_result()->front();
+    auto block = cached_block->clone_empty();
+    RETURN_IF_ERROR(vectorized::MutableBlock::build_mutable_block(&block).merge(*cached_block));
+    _build_side_rows = block.rows();
+    _shared_state->build_block = std::make_shared<vectorized::Block>(std::move(block));
+    return Status::OK();
+}
+
+void HashJoinBuildSinkLocalState::_insert_build_block_into_cache() {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    const auto& build_block = *_shared_state->build_block;
+    const auto bytes = build_block.allocated_bytes();
+    if (_build_cache_key.empty() ||
+        static_cast<int64_t>(build_block.rows()) > p._cache_param.entry_max_rows ||
+        static_cast<int64_t>(bytes) > p._cache_param.entry_max_bytes) {
+        return;
+    }
+    // The columns are shared here, the cache copies them with its own memory tracker.
+    CacheResult result;
+    result.emplace_back(
+            vectorized::Block::create_unique(build_block.get_columns_with_type_and_name()));
+    QueryCache::instance()->insert(_build_cache_key, _build_cache_version, result, {},
+                                   static_cast<int64_t>(bytes));
+    custom_profile()->add_info_string("InsertBuildCache", "true");
+}
+
 Status HashJoinBuildSinkLocalState::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
@@ -540,6 +588,8 @@ Status HashJoinBuildSinkOperatorX::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(JoinBuildSinkOperatorX<HashJoinBuildSinkLocalState>::prepare(state));
     _use_shared_hash_table =
             _is_broadcast_join && state->enable_share_hash_table_for_broadcast_join();
+    _use_build_cache = config::enable_hash_join_build_cache && !_cache_param.digest.empty() &&
+                       !_use_shared_hash_table;
     auto init_keep_column_flags = [&](auto& tuple_descs, auto& output_slot_flags) {
         for (const auto& tuple_desc : tuple_descs) {
             for (const auto& slot_desc : tuple_desc->slots()) {
@@ -580,7 +630,8 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                     vectorized::MutableBlock::build_mutable_block(&tmp_build_block);
         }
 
-        if (!in_block->empty()) {
+        // The build block is got from the cache, the scan of build side reads nothing.
+        if (!in_block->empty() && !local_state._build_cache_hit) {
             std::vector<int> res_col_ids(_build_expr_ctxs.size());
             RETURN_IF_ERROR(local_state._do_evaluate(*in_block, local_state._build_expr_ctxs,
                                                      *local_state._build_expr_call_timer,
@@ -592,6 +643,7 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                         "join spill to avoid this issue",
                         std::to_string(std::numeric_limits<uint32_t>::max()));
             }
+            local_state._runtime_filter_producer_helper->update_ndv(*in_block);
 
             SCOPED_TIMER(local_state._build_side_merge_block_timer);
             RETURN_IF_ERROR(local_state._build_side_mutable_block.merge_ignore_overflow(
@@ -604,8 +656,13 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
 
     if (local_state._should_build_hash_table && eos) {
         DCHECK(!local_state._build_side_mutable_block.empty());
-        local_state._shared_state->build_block = std::make_shared<vectorized::Block>(
-                local_state._build_side_mutable_block.to_block());
+        if (local_state._build_cache_hit) {
+            RETURN_IF_ERROR(local_state._get_build_block_from_cache());
+        } else {
+            local_state._shared_state->build_block = std::make_shared<vectorized::Block>(
+                    local_state._build_side_mutable_block.to_block());
+            local_state._insert_build_block_into_cache();
+        }
 
         RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
                 state, local_state._shared_state->build_block->rows(),
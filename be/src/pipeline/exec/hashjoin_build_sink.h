@@ -19,6 +19,7 @@
 
 #include "join_build_sink_operator.h"
 #include "operator.h"
+#include "pipeline/query_cache/query_cache.h"
 #include "runtime_filter/runtime_filter_producer_helper.h"
 
 namespace doris::pipeline {
@@ -49,6 +50,11 @@ public:
 
     [[nodiscard]] MOCK_FUNCTION size_t get_reserve_mem_size(RuntimeState* state, bool eos);
 
+    // Called by the olap scan which is the source of the build pipeline of this task, before
+    // it reads anything. Returns true if the build block is found in the query cache, then the scan
+    // reads nothing and the cached block is used instead.
+    bool lookup_build_cache(const std::vector<TScanRangeParams>& scan_ranges);
+
 protected:
     Status _hash_table_init(RuntimeState* state);
     void _set_build_side_has_external_nullmap(vectorized::Block& block,
@@ -56,6 +62,8 @@ protected:
     Status _do_evaluate(vectorized::Block& block, vectorized::VExprContextSPtrs& exprs,
                         RuntimeProfile::Counter& expr_call_timer, std::vector<int>& res_col_ids);
     std::vector<uint16_t> _convert_block_to_null(vectorized::Block& block);
+    Status _get_build_block_from_cache();
+    void _insert_build_block_into_cache();
     Status _extract_join_column(vectorized::Block& block,
                                 vectorized::ColumnUInt8::MutablePtr& null_map,
                                 vectorized::ColumnRawPtrs& raw_ptrs,
@@ -96,6 +104,12 @@ protected:
     RuntimeProfile::Counter* _build_blocks_memory_usage = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::Counter* _build_arena_memory_usage = nullptr;
+
+    // Set if the build block of this join is kept in the query cache.
+    std::string _build_cache_key;
+    int64_t _build_cache_version = 0;
+    bool _build_cache_hit = false;
+    QueryCacheHandle _build_cache_handle;
 };
 
 class HashJoinBuildSinkOperatorX MOCK_REMOVE(final)
@@ -148,6 +162,8 @@ public:
     }
     std::vector<bool>& is_null_safe_eq_join() { return _is_null_safe_eq_join; }
 
+    void set_query_cache_param(const TQueryCacheParam& cache_param) { _cache_param = cache_param; }
+
 private:
     friend class HashJoinBuildSinkLocalState;
 
@@ -175,6 +191,9 @@ private:
     std::mutex _mutex;
     std::vector<std::shared_ptr<pipeline::Dependency>> _finish_dependencies;
     std::map<int, std::shared_ptr<RuntimeFilterWrapper>> _runtime_filters;
+
+    TQueryCacheParam _cache_param;
+    bool _use_build_cache = false;
 };
 
 template <class HashTableContext>
@@ -234,9 +253,11 @@ struct ProcessHashTableBuild {
         }
 
         hash_table_ctx.hash_table->build(hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(),
-                                         _rows, keep_null_key);
+                                         _rows, keep_null_key, hash_table_ctx.hash_tags.data());
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
+        hash_table_ctx.hash_tags.clear();
+        hash_table_ctx.hash_tags.shrink_to_fit();
 
         COUNTER_SET(_parent->_hash_table_memory_usage,
                     (int64_t)hash_table_ctx.hash_table->get_byte_size());
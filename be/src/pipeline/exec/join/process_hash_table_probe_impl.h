@@ -230,8 +230,9 @@ Status ProcessHashTableProbe<JoinOpType>::process(HashTableType& hash_table_ctx,
         } else {
             auto [new_probe_idx, new_build_idx, new_current_offset, picking_null_keys] =
                     hash_table_ctx.hash_table->find_null_aware_with_other_conjuncts(
-                            hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), probe_index,
-                            build_index, probe_rows, _probe_indexs.get_data().data(),
+                            hash_table_ctx.keys, hash_table_ctx.hash_tags.data(),
+                            hash_table_ctx.bucket_nums.data(), probe_index, build_index,
+                            probe_rows, _probe_indexs.get_data().data(),
                             _build_indexs.get_data().data(), _null_flags.data(), _picking_null_keys,
                             null_map);
             probe_index = new_probe_idx;
@@ -254,8 +255,9 @@ Status ProcessHashTableProbe<JoinOpType>::process(HashTableType& hash_table_ctx,
         SCOPED_TIMER(_search_hashtable_timer);
         auto [new_probe_idx, new_build_idx, new_current_offset] =
                 hash_table_ctx.hash_table->template find_batch<JoinOpType>(
-                        hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), probe_index,
-                        build_index, cast_set<int32_t>(probe_rows), _probe_indexs.get_data().data(),
+                        hash_table_ctx.keys, hash_table_ctx.hash_tags.data(),
+                        hash_table_ctx.bucket_nums.data(), probe_index, build_index,
+                        cast_set<int32_t>(probe_rows), _probe_indexs.get_data().data(),
                         _probe_visited, _build_indexs.get_data().data(), null_map,
                         _have_other_join_conjunct, is_mark_join,
                         !_parent->_mark_join_conjuncts.empty());
@@ -140,10 +140,16 @@ Status MultiCastDataStreamer::pull(RuntimeState* state, int sender_idx, vectoriz
 
         DCHECK_GT(pos_to_pull->_un_finish_copy, 0);
         DCHECK_LE(pos_to_pull->_un_finish_copy, _cast_sender_count);
-        *block = *pos_to_pull->_block;
-
         multi_cast_block = &(*pos_to_pull);
-        _copying_count.fetch_add(1);
+        // The other readers have finished copying the block, so the last reader takes its
+        // columns instead of copying them.
+        const bool is_last_reader = multi_cast_block->_un_finish_copy == 1;
+        if (is_last_reader) {
+            *block = std::move(*multi_cast_block->_block);
+        } else {
+            *block = *multi_cast_block->_block;
+            _copying_count.fetch_add(1);
+        }
 
         pos_to_pull++;
 
@@ -151,6 +157,12 @@ Status MultiCastDataStreamer::pull(RuntimeState* state, int sender_idx, vectoriz
             _block_reading(sender_idx);
             *eos = _eos;
         }
+
+        if (is_last_reader) {
+            multi_cast_block->_un_finish_copy--;
+            _release_front_block(*multi_cast_block);
+            return Status::OK();
+        }
     }
 
     return _copy_block(state, sender_idx, block, *multi_cast_block);
@@ -168,10 +180,7 @@ Status MultiCastDataStreamer::_copy_block(RuntimeState* state, int32_t sender_id
     multi_cast_block._un_finish_copy--;
     auto copying_count = _copying_count.fetch_sub(1) - 1;
     if (multi_cast_block._un_finish_copy == 0) {
-        DCHECK_EQ(_multi_cast_blocks.front()._un_finish_copy, 0);
-        DCHECK_EQ(&(_multi_cast_blocks.front()), &multi_cast_block);
-        _multi_cast_blocks.pop_front();
-        _write_dependency->set_ready();
+        _release_front_block(multi_cast_block);
     } else if (copying_count == 0) {
         bool spilled = false;
         RETURN_IF_ERROR(_trigger_spill_if_need(state, &spilled));
@@ -180,6 +189,14 @@ Status MultiCastDataStreamer::_copy_block(RuntimeState* state, int32_t sender_id
     return Status::OK();
 }
 
+void MultiCastDataStreamer::_release_front_block(MultiCastBlock& multi_cast_block) {
+    DCHECK_EQ(multi_cast_block._un_finish_copy, 0);
+    DCHECK_EQ(&(_multi_cast_blocks.front()), &multi_cast_block);
+    _cumulative_mem_size -= multi_cast_block._mem_size;
+    _multi_cast_blocks.pop_front();
+    _write_dependency->set_ready();
+}
+
 Status MultiCastDataStreamer::_trigger_spill_if_need(RuntimeState* state, bool* triggered) {
     if (!state->enable_spill()) {
         *triggered = false;
@@ -317,11 +334,11 @@ Status MultiCastDataStreamer::push(RuntimeState* state, doris::vectorized::Block
             }
         }
 
-        _cumulative_mem_size += block_mem_size;
-        COUNTER_SET(_peak_mem_usage,
-                    std::max(_cumulative_mem_size.load(), _peak_mem_usage->value()));
-
         if (rows > 0) {
+            _cumulative_mem_size += block_mem_size;
+            COUNTER_SET(_peak_mem_usage,
+                        std::max(_cumulative_mem_size.load(), _peak_mem_usage->value()));
+
             if (!eos) {
                 bool spilled = false;
                 RETURN_IF_ERROR(_trigger_spill_if_need(state, &spilled));
@@ -38,8 +38,8 @@ struct MultiCastBlock {
     MultiCastBlock(vectorized::Block* block, int need_copy, size_t mem_size);
 
     std::unique_ptr<vectorized::Block> _block;
-    // Each block is copied during pull. If _un_finish_copy == 0,
-    // it indicates that this block has been fully used and can be released.
+    // Each block is copied during pull except by its last reader, which takes the block. If
+    // _un_finish_copy == 0, it indicates that this block has been fully used and can be released.
     int _un_finish_copy;
     size_t _mem_size;
 };
@@ -114,6 +114,9 @@ private:
     Status _copy_block(RuntimeState* state, int32_t sender_idx, vectorized::Block* block,
                        MultiCastBlock& multi_cast_block);
 
+    // Called with the lock held when all the readers have read the front block.
+    void _release_front_block(MultiCastBlock& multi_cast_block);
+
     Status _submit_spill_task(RuntimeState* state, vectorized::SpillStreamSPtr spill_stream);
 
     Status _trigger_spill_if_need(RuntimeState* state, bool* triggered);
@@ -127,6 +130,7 @@ private:
     bool _eos = false;
     int _cast_sender_count = 0;
     int _node_id;
+    // the memory of the blocks in _multi_cast_blocks not released yet
     std::atomic_int64_t _cumulative_mem_size = 0;
     std::atomic_int64_t _copying_count = 0;
     RuntimeProfile::Counter* _process_rows = nullptr;
@@ -17,13 +17,20 @@
 
 #include "nested_loop_join_probe_operator.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "common/cast_set.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/primitive_type.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -47,6 +54,9 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     _update_visited_flags_timer = ADD_TIMER(custom_profile(), "UpdateVisitedFlagsTime");
     _join_conjuncts_evaluation_timer = ADD_TIMER(custom_profile(), "JoinConjunctsEvaluationTime");
     _filtered_by_join_conjuncts_timer = ADD_TIMER(custom_profile(), "FilteredByJoinConjunctsTime");
+    _band_sort_build_timer = ADD_TIMER(custom_profile(), "BandSortBuildTime");
+    _band_skipped_build_rows_counter =
+            ADD_COUNTER(custom_profile(), "BandSkippedBuildRows", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -99,8 +109,13 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
     _left_block_start_pos = _left_block_pos;
     _left_side_process_count = 0;
     DCHECK(!_need_more_input_data || !_matched_rows_done);
+    if (p._band_conjunct.has_value() &&
+        _sorted_build_blocks.size() != _shared_state->build_blocks.size()) {
+        _sort_build_blocks_by_band_conjunct();
+    }
 
     if (!_matched_rows_done && !_need_more_input_data) {
+        int64_t band_skipped_build_rows = 0;
         // We should try to join rows if there still are some rows from probe side.
         // _probe_offset_stack and _build_offset_stack use u16 for storage
         // because on the FE side, it is guaranteed that the batch size will not exceed 65535 (the maximum value for u16).s
@@ -137,8 +152,18 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
             if constexpr (set_build_side_flag) {
                 _build_offset_stack.push(cast_set<uint16_t, size_t, false>(_join_block.rows()));
             }
-            _process_left_child_block(_join_block, now_process_build_block);
+            if (p._band_conjunct.has_value()) {
+                const auto& sorted = _sorted_build_blocks[_current_build_pos - 1];
+                auto [begin, end] = _band_range(sorted);
+                band_skipped_build_rows += now_process_build_block.rows() - (end - begin);
+                _process_left_child_block(_join_block, now_process_build_block,
+                                          sorted.rows.data() + begin, end - begin);
+            } else {
+                _process_left_child_block(_join_block, now_process_build_block, nullptr,
+                                          now_process_build_block.rows());
+            }
         }
+        COUNTER_UPDATE(_band_skipped_build_rows_counter, band_skipped_build_rows);
 
         {
             SCOPED_TIMER(_finish_probe_phase_timer);
@@ -334,12 +359,81 @@ void NestedLoopJoinProbeLocalState::_append_left_data_with_null(vectorized::Bloc
     block.set_columns(std::move(dst_columns));
 }
 
+void NestedLoopJoinProbeLocalState::_sort_build_blocks_by_band_conjunct() {
+    SCOPED_TIMER(_band_sort_build_timer);
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& build_blocks = _shared_state->build_blocks;
+    _sorted_build_blocks.resize(build_blocks.size());
+    for (size_t i = 0; i < build_blocks.size(); ++i) {
+        auto column = build_blocks[i]
+                              .get_by_position(p._band_conjunct->build_column)
+                              .column->convert_to_full_column_if_const();
+        vectorized::IColumn::Permutation permutation;
+        // the nulls never satisfy the comparison, the null direction hint puts them at the end
+        column->get_permutation(false, 0, 1, permutation);
+
+        auto& sorted = _sorted_build_blocks[i];
+        sorted.rows.resize(permutation.size());
+        for (size_t j = 0; j < permutation.size(); ++j) {
+            sorted.rows[j] = static_cast<uint32_t>(permutation[j]);
+        }
+        sorted.num_not_null = column->size();
+        sorted.column = column;
+        if (const auto* nullable = check_and_get_column<vectorized::ColumnNullable>(*column)) {
+            const auto& null_map = nullable->get_null_map_data();
+            sorted.num_not_null = simd::count_zero_num(
+                    reinterpret_cast<const int8_t*>(null_map.data()), null_map.size());
+            sorted.column = nullable->get_nested_column_ptr();
+        }
+    }
+}
+
+std::pair<size_t, size_t> NestedLoopJoinProbeLocalState::_band_range(
+        const SortedBuildBlock& sorted) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& band = *p._band_conjunct;
+    const auto& [probe_column, is_const] =
+            vectorized::unpack_if_const(_child_block->get_by_position(band.probe_column).column);
+    const size_t probe_row = is_const ? 0 : _left_block_pos;
+    const vectorized::IColumn* probe_data = probe_column.get();
+    if (const auto* nullable = check_and_get_column<vectorized::ColumnNullable>(*probe_data)) {
+        if (nullable->is_null_at(probe_row)) {
+            return {0, 0};
+        }
+        probe_data = &nullable->get_nested_column();
+    }
+
+    // The build values accepted by `build < probe` and `build >= probe` are split at the first
+    // value not less than the probe value, the ones of `build <= probe` and `build > probe` at
+    // the first value greater than it.
+    const bool split_after_equal = band.build_is_less == band.inclusive;
+    const auto* begin = sorted.rows.data();
+    const auto* end = begin + sorted.num_not_null;
+    const auto* split = std::partition_point(begin, end, [&](uint32_t row) {
+        int res = sorted.column->compare_at(row, probe_row, *probe_data, 1);
+        return split_after_equal ? res <= 0 : res < 0;
+    });
+    const auto split_pos = static_cast<size_t>(split - begin);
+    if (band.build_is_less) {
+        return {0, split_pos};
+    }
+    return {split_pos, sorted.num_not_null};
+}
+
 void NestedLoopJoinProbeLocalState::_process_left_child_block(
-        vectorized::Block& block, const vectorized::Block& now_process_build_block) const {
+        vectorized::Block& block, const vectorized::Block& now_process_build_block,
+        const uint32_t* build_rows, size_t num_build_rows) const {
     SCOPED_TIMER(_output_temp_blocks_timer);
     auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
     auto dst_columns = block.mutate_columns();
-    const size_t max_added_rows = now_process_build_block.rows();
+    const size_t max_added_rows = num_build_rows;
+    auto insert_build_rows = [&](vectorized::IColumn& dst, const vectorized::IColumn& src) {
+        if (build_rows == nullptr) {
+            dst.insert_range_from(src, 0, max_added_rows);
+        } else {
+            dst.insert_indices_from(src, build_rows, build_rows + max_added_rows);
+        }
+    };
     for (size_t i = 0; i < p._num_probe_side_columns; ++i) {
         const vectorized::ColumnWithTypeAndName& src_column = _child_block->get_by_position(i);
         if (!src_column.column->is_nullable() && dst_columns[i]->is_nullable()) {
@@ -366,18 +460,17 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
             auto origin_sz = dst_columns[p._num_probe_side_columns + i]->size();
             DCHECK(p._join_op == TJoinOp::LEFT_OUTER_JOIN ||
                    p._join_op == TJoinOp::FULL_OUTER_JOIN);
-            assert_cast<vectorized::ColumnNullable*>(
-                    dst_columns[p._num_probe_side_columns + i].get())
-                    ->get_nested_column_ptr()
-                    ->insert_range_from(*src_column.column.get(), 0, max_added_rows);
+            insert_build_rows(*assert_cast<vectorized::ColumnNullable*>(
+                                       dst_columns[p._num_probe_side_columns + i].get())
+                                       ->get_nested_column_ptr(),
+                              *src_column.column);
             assert_cast<vectorized::ColumnNullable*>(
                     dst_columns[p._num_probe_side_columns + i].get())
                     ->get_null_map_column()
                     .get_data()
                     .resize_fill(origin_sz + max_added_rows, 0);
         } else {
-            dst_columns[p._num_probe_side_columns + i]->insert_range_from(*src_column.column.get(),
-                                                                          0, max_added_rows);
+            insert_build_rows(*dst_columns[p._num_probe_side_columns + i], *src_column.column);
         }
     }
     block.set_columns(std::move(dst_columns));
@@ -417,9 +510,70 @@ Status NestedLoopJoinProbeOperatorX::prepare(RuntimeState* state) {
     }
     _num_probe_side_columns = _child->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    _init_band_conjunct();
     return vectorized::VExpr::open(_join_conjuncts, state);
 }
 
+void NestedLoopJoinProbeOperatorX::_init_band_conjunct() {
+    // Only the joins without build side visited flags may skip build rows. The probe side
+    // visited flags only need to know whether a probe row matched any build row.
+    if (_old_version_flag || _is_mark_join || _is_output_left_side_only ||
+        (_join_op != TJoinOp::INNER_JOIN && _join_op != TJoinOp::CROSS_JOIN &&
+         _join_op != TJoinOp::LEFT_OUTER_JOIN && _join_op != TJoinOp::LEFT_SEMI_JOIN &&
+         _join_op != TJoinOp::LEFT_ANTI_JOIN)) {
+        return;
+    }
+    for (const auto& conjunct : _join_conjuncts) {
+        auto* root = conjunct->root().get();
+        if (root->node_type() != TExprNodeType::BINARY_PRED || root->get_num_children() != 2) {
+            continue;
+        }
+        const auto& fn_name =
+                assert_cast<vectorized::VectorizedFnCall*>(root)->fn().name.function_name;
+        const bool is_less = fn_name == "lt" || fn_name == "le";
+        if (!is_less && fn_name != "gt" && fn_name != "ge") {
+            continue;
+        }
+        const auto& left = root->children()[0];
+        const auto& right = root->children()[1];
+        if (!left->is_slot_ref() || !right->is_slot_ref()) {
+            continue;
+        }
+        auto left_id = static_cast<size_t>(
+                assert_cast<vectorized::VSlotRef*>(left.get())->column_id());
+        auto right_id = static_cast<size_t>(
+                assert_cast<vectorized::VSlotRef*>(right.get())->column_id());
+        BandConjunct band;
+        band.inclusive = fn_name == "le" || fn_name == "ge";
+        if (left_id < _num_probe_side_columns && right_id >= _num_probe_side_columns) {
+            band.probe_column = left_id;
+            band.build_column = right_id - _num_probe_side_columns;
+            band.build_is_less = !is_less;
+        } else if (right_id < _num_probe_side_columns && left_id >= _num_probe_side_columns) {
+            band.probe_column = right_id;
+            band.build_column = left_id - _num_probe_side_columns;
+            band.build_is_less = is_less;
+        } else {
+            continue;
+        }
+        if (band.build_column >= _num_build_side_columns) {
+            continue;
+        }
+        // The sort order of the column must be the order of the comparison, which excludes the
+        // floating points because of NaN.
+        auto left_type = vectorized::remove_nullable(left->data_type());
+        auto right_type = vectorized::remove_nullable(right->data_type());
+        auto type = left_type->get_primitive_type();
+        if (!left_type->equals(*right_type) ||
+            !(is_int_or_bool(type) || is_date_v2_or_datetime_v2(type) || is_decimal(type) ||
+              is_string_type(type))) {
+            continue;
+        }
+        _band_conjunct = band;
+        return;
+    }
+}
+
 bool NestedLoopJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state =
             state->get_local_state(operator_id())->cast<NestedLoopJoinProbeLocalState>();
@@ -20,6 +20,9 @@
 #include <stdint.h>
 
 #include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/status.h"
@@ -58,8 +61,24 @@ private:
     void _finalize_current_phase(vectorized::Block& block, size_t batch_size);
     void _reset_with_next_probe_row();
     void _append_left_data_with_null(vectorized::Block& block) const;
+    // Joins the current probe row with `num_build_rows` rows of the build block, which are the
+    // rows in `build_rows`, or the first rows of the block if `build_rows` is null.
     void _process_left_child_block(vectorized::Block& block,
-                                   const vectorized::Block& now_process_build_block) const;
+                                   const vectorized::Block& now_process_build_block,
+                                   const uint32_t* build_rows, size_t num_build_rows) const;
+
+    // The rows of a build block sorted by the build slot of the band conjunct.
+    struct SortedBuildBlock {
+        // the row numbers in the sorted order, the null values are at the end
+        std::vector<uint32_t> rows;
+        size_t num_not_null = 0;
+        // the build slot column without the null map
+        vectorized::ColumnPtr column;
+    };
+    void _sort_build_blocks_by_band_conjunct();
+    // The range of `sorted.rows` whose values may satisfy the band conjunct with the current
+    // probe row, all other rows are filtered out by the conjunct anyway.
+    std::pair<size_t, size_t> _band_range(const SortedBuildBlock& sorted) const;
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block,
                                                      uint32_t column_to_keep,
@@ -190,12 +209,16 @@ private:
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // Sorted lazily once the build side is finished, only when the join has a band conjunct.
+    std::vector<SortedBuildBlock> _sorted_build_blocks;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
     RuntimeProfile::Counter* _output_temp_blocks_timer = nullptr;
     RuntimeProfile::Counter* _update_visited_flags_timer = nullptr;
     RuntimeProfile::Counter* _join_conjuncts_evaluation_timer = nullptr;
     RuntimeProfile::Counter* _filtered_by_join_conjuncts_timer = nullptr;
+    RuntimeProfile::Counter* _band_sort_build_timer = nullptr;
+    RuntimeProfile::Counter* _band_skipped_build_rows_counter = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
@@ -232,8 +255,24 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+
+    // A join conjunct comparing a probe slot with a build slot by <, <=, > or >=, e.g. a bound of
+    // a range join. The build rows are sorted by the build slot, so every probe row is only
+    // joined with the band of build rows the comparison may accept instead of all of them.
+    struct BandConjunct {
+        size_t probe_column = 0;
+        // the column in the build block
+        size_t build_column = 0;
+        // the comparison written as `build < probe`, `build <= probe`, `build > probe` or
+        // `build >= probe`
+        bool build_is_less = false;
+        bool inclusive = false;
+    };
+    void _init_band_conjunct();
+
     bool _is_output_left_side_only;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    std::optional<BandConjunct> _band_conjunct;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
     const bool _old_version_flag;
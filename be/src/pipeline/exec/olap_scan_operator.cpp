@@ -19,6 +19,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 
@@ -30,6 +31,7 @@
 #include "olap/parallel_scanner_builder.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
+#include "pipeline/exec/hashjoin_build_sink.h"
 #include "pipeline/exec/scan_operator.h"
 #include "pipeline/query_cache/query_cache.h"
 #include "runtime_filter/runtime_filter_consumer_helper.h"
@@ -163,6 +165,9 @@ Status OlapScanLocalState::_init_profile() {
 
     _total_pages_num_counter = ADD_COUNTER(_segment_profile, "TotalPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_segment_profile, "CachedPagesNum", TUnit::UNIT);
+    _cached_pages_bytes_counter = ADD_COUNTER(_segment_profile, "CachedPagesBytes", TUnit::BYTES);
+    _page_prefetch_hit_counter = ADD_COUNTER(_segment_profile, "PagePrefetchHitNum", TUnit::UNIT);
+    _page_prefetch_miss_counter = ADD_COUNTER(_segment_profile, "PagePrefetchMissNum", TUnit::UNIT);
 
     _bitmap_index_filter_counter =
             ADD_COUNTER(_segment_profile, "RowsBitmapIndexFiltered", TUnit::UNIT);
@@ -450,6 +455,7 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::ScannerSPtr>* sc
                                   _read_sources[scan_range_idx],
                                   p._limit,
                                   p._olap_scan_node.is_preaggregation,
+                                  nullptr,
                           });
             RETURN_IF_ERROR(scanner->prepare(state(), _conjuncts));
             scanners->push_back(std::move(scanner));
@@ -600,10 +606,20 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
         }
     }
 
+    std::shared_ptr<QueryCache::IncrementalReuse> query_cache_reuse;
+    if (!_query_cache_key.empty() && _scan_ranges.size() == 1) {
+        query_cache_reuse = QueryCache::instance()->find_incremental_reuse(
+                print_id(_state->fragment_instance_id()) + _query_cache_key);
+    }
     for (size_t i = 0; i < _scan_ranges.size(); i++) {
-        RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers({0, _tablets[i].version},
-                                                               &_read_sources[i].rs_splits,
-                                                               _state->skip_missing_version()));
+        if (query_cache_reuse != nullptr &&
+            _capture_incremental_rs_readers(i, query_cache_reuse->base_version)) {
+            query_cache_reuse->accepted = true;
+        } else {
+            RETURN_IF_ERROR(_tablets[i].tablet->capture_rs_readers(
+                    {0, _tablets[i].version}, &_read_sources[i].rs_splits,
+                    _state->skip_missing_version()));
+        }
         if (!PipelineXLocalState<>::_state->skip_delete_predicate()) {
             _read_sources[i].fill_delete_predicates();
         }
@@ -627,6 +643,35 @@ Status OlapScanLocalState::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+bool OlapScanLocalState::_capture_incremental_rs_readers(size_t tablet_idx, int64_t base_version) {
+    // Only the rows of the duplicate key tablets are not changed by the newer rowsets, unless
+    // the newer rowsets have delete predicates.
+    const auto& tablet = _tablets[tablet_idx].tablet;
+    if (tablet->keys_type() != KeysType::DUP_KEYS || base_version >= _tablets[tablet_idx].version) {
+        return false;
+    }
+    std::shared_lock rlock(tablet->get_header_lock());
+    std::vector<RowsetSharedPtr> rowsets;
+    if (!tablet->capture_consistent_rowsets_unlocked(
+                        {base_version + 1, _tablets[tablet_idx].version}, &rowsets)
+                 .ok() ||
+        std::any_of(rowsets.begin(), rowsets.end(), [](const RowsetSharedPtr& rowset) {
+            return rowset->rowset_meta()->has_delete_predicate();
+        })) {
+        return false;
+    }
+    Versions version_path;
+    for (const auto& rowset : rowsets) {
+        version_path.push_back(rowset->version());
+    }
+    std::vector<RowSetSplits> rs_splits;
+    if (!tablet->capture_rs_readers_unlocked(version_path, &rs_splits).ok()) {
+        return false;
+    }
+    _read_sources[tablet_idx].rs_splits = std::move(rs_splits);
+    return true;
+}
+
 Status OlapScanLocalState::open(RuntimeState* state) {
     auto& p = _parent->cast<OlapScanOperatorX>();
     for (const auto& pair : p._slot_id_to_slot_desc) {
@@ -675,6 +720,11 @@ void OlapScanLocalState::set_scan_ranges(RuntimeState* state,
         }
         doris::QueryCacheHandle handle;
         hit_cache = QueryCache::instance()->lookup(cache_key, version, &handle);
+        _query_cache_key = std::move(cache_key);
+    } else if (auto* build_state =
+                       dynamic_cast<HashJoinBuildSinkLocalState*>(state->get_sink_local_state())) {
+        // The scan feeds the build side of a hash join, whose build block may be cached.
+        hit_cache = build_state->lookup_build_cache(scan_ranges);
     }
 
     if (!hit_cache) {
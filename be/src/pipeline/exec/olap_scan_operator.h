@@ -98,7 +98,12 @@ private:
 
     Status _build_key_ranges_and_filters();
 
+    // Captures the rowsets of the tablet newer than the query cache entry reused by the cache
+    // source, returns false if they can not be read without the older rowsets.
+    bool _capture_incremental_rs_readers(size_t tablet_idx, int64_t base_version);
+
     std::vector<std::unique_ptr<TPaloScanRange>> _scan_ranges;
+    std::string _query_cache_key;
     std::vector<SyncRowsetStats> _sync_statistics;
     MonotonicStopWatch _sync_cloud_tablets_watcher;
     std::shared_ptr<Dependency> _cloud_tablet_dependency;
@@ -186,6 +191,10 @@ private:
     // page read from cache
     // used by segment v2
     RuntimeProfile::Counter* _cached_pages_num_counter = nullptr;
+    RuntimeProfile::Counter* _cached_pages_bytes_counter = nullptr;
+    // page read ahead by the page prefetcher and found in page cache, or not found in page cache
+    RuntimeProfile::Counter* _page_prefetch_hit_counter = nullptr;
+    RuntimeProfile::Counter* _page_prefetch_miss_counter = nullptr;
 
     // row count filtered by bitmap inverted index
     RuntimeProfile::Counter* _bitmap_index_filter_counter = nullptr;
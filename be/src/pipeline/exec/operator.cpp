@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
@@ -84,6 +85,7 @@
 #include "util/debug_util.h"
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
+#include "vec/exprs/vcommon_subexpr_ref.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/utils/util.hpp"
@@ -221,6 +223,12 @@ Status OperatorXBase::init(const TPlanNode& tnode, RuntimeState* /*state*/) {
             _intermediate_projections.push_back(projections);
         }
     }
+    if (config::enable_projection_common_subexpr_elimination) {
+        for (const auto& projections : _intermediate_projections) {
+            vectorized::VCommonSubexprRef::rewrite(projections);
+        }
+        vectorized::VCommonSubexprRef::rewrite(_projections);
+    }
     return Status::OK();
 }
 
@@ -304,6 +312,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
         }
+        vectorized::VCommonSubexprRef::reset_results(projections);
 
         bytes_usage += input_block.allocated_bytes();
         input_block.shuffle_columns(result_column_ids);
@@ -348,6 +357,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
             }
             insert_column_datas(mutable_columns[i], column_ptr, rows);
         }
+        vectorized::VCommonSubexprRef::reset_results(local_state->_projections);
         DCHECK(mutable_block.rows() == rows);
         output_block->set_columns(std::move(mutable_columns));
     }
@@ -563,6 +573,7 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
     for (size_t i = 0; i < _projections.size(); i++) {
         RETURN_IF_ERROR(_parent->_projections[i]->clone(state, _projections[i]));
     }
+    vectorized::VCommonSubexprRef::share_results(_projections);
     _intermediate_projections.resize(_parent->_intermediate_projections.size());
     for (int i = 0; i < _parent->_intermediate_projections.size(); i++) {
         _intermediate_projections[i].resize(_parent->_intermediate_projections[i].size());
@@ -570,6 +581,7 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
             RETURN_IF_ERROR(_parent->_intermediate_projections[i][j]->clone(
                     state, _intermediate_projections[i][j]));
         }
+        vectorized::VCommonSubexprRef::share_results(_intermediate_projections[i]);
     }
     return Status::OK();
 }
@@ -143,6 +143,9 @@ public:
         _followed_by_shuffled_operator = followed_by_shuffled_operator;
     }
     [[nodiscard]] virtual bool is_shuffled_operator() const { return false; }
+    // Whether rows with the same partition key may be processed by different instances, so a
+    // local shuffle in front of this operator is allowed to spread hot partitions.
+    [[nodiscard]] virtual bool tolerate_partition_skew_split() const { return false; }
     [[nodiscard]] virtual DataDistribution required_data_distribution() const;
     [[nodiscard]] virtual bool require_shuffled_data_distribution() const;
 
@@ -764,6 +767,18 @@ public:
                 Base::custom_profile(), "SpillMinRowsOfPartition", TUnit::UNIT, 1);
     }
 
+    // Only for the sinks which read back the blocks they spilled themselves, the spill readers
+    // look up these counters by name.
+    void init_spill_read_counters() {
+        ADD_TIMER_WITH_LEVEL(Base::custom_profile(), "SpillReadFileTime", 1);
+        ADD_TIMER_WITH_LEVEL(Base::custom_profile(), "SpillReadDerializeBlockTime", 1);
+        ADD_COUNTER_WITH_LEVEL(Base::custom_profile(), "SpillReadBlockCount", TUnit::UNIT, 1);
+        ADD_COUNTER_WITH_LEVEL(Base::custom_profile(), "SpillReadBlockBytes", TUnit::BYTES, 1);
+        ADD_COUNTER_WITH_LEVEL(Base::custom_profile(), "SpillReadFileBytes", TUnit::BYTES, 1);
+        ADD_COUNTER_WITH_LEVEL(Base::custom_profile(), "SpillReadRows", TUnit::UNIT, 1);
+        ADD_COUNTER_WITH_LEVEL(Base::custom_profile(), "SpillReadFileCount", TUnit::UNIT, 1);
+    }
+
     std::vector<Dependency*> dependencies() const override {
         auto dependencies = Base::dependencies();
         return dependencies;
@@ -21,8 +21,10 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <numeric>
 #include <utility>
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/logging.h"
 #include "common/status.h"
@@ -53,6 +55,7 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
 
     _partitioned_blocks.resize(p._partition_count);
     _probe_spilling_streams.resize(p._partition_count);
+    _partition_levels.assign(p._partition_count, 0);
 
     _spill_dependency = Dependency::create_shared(_parent->operator_id(), _parent->node_id(),
                                                   "HashJoinProbeSpillDependency", true);
@@ -76,6 +79,9 @@ void PartitionedHashJoinProbeLocalState::init_counters() {
     _recovery_probe_blocks = ADD_COUNTER(custom_profile(), "SpillRecoveryProbeBlocks", TUnit::UNIT);
     _recovery_probe_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "SpillRecoveryProbeTime", 1);
     _get_child_next_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "GetChildNextTime", 1);
+    _repartition_timer = ADD_TIMER_WITH_LEVEL(custom_profile(), "SpillRepartitionTime", 1);
+    _repartition_partitions =
+            ADD_COUNTER_WITH_LEVEL(custom_profile(), "SpillRepartitionPartitions", TUnit::UNIT, 1);
 
     _probe_blocks_bytes =
             ADD_COUNTER_WITH_LEVEL(custom_profile(), "ProbeBloksBytesInMem", TUnit::BYTES, 1);
@@ -262,6 +268,185 @@ Status PartitionedHashJoinProbeLocalState::spill_probe_blocks(RuntimeState* stat
     return spill_io_pool->submit(std::move(spill_runnable));
 }
 
+bool PartitionedHashJoinProbeLocalState::_need_to_repartition(uint32_t partition_index) const {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    const auto& spilled_stream = _shared_state->spilled_streams[partition_index];
+    if (_partition_levels[partition_index] >= p._max_repartition_level || !spilled_stream) {
+        return false;
+    }
+    auto build_bytes = spilled_stream->get_written_bytes();
+    if (const auto& block = _shared_state->partitioned_build_blocks[partition_index]) {
+        build_bytes += static_cast<int64_t>(block->allocated_bytes());
+    }
+    return build_bytes > config::spill_hash_join_repartition_bytes;
+}
+
+Status PartitionedHashJoinProbeLocalState::_repartition_block(
+        RuntimeState* state, vectorized::PartitionerBase* partitioner, vectorized::Block& block,
+        const std::string& stream_name, std::unique_ptr<vectorized::MutableBlock>* sub_blocks,
+        vectorized::SpillStreamSPtr* sub_streams, size_t* sub_rows) {
+    const auto rows = block.rows();
+    if (rows == 0) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(partitioner->do_partitioning(state, &block));
+
+    constexpr auto fanout = PartitionedHashJoinProbeOperatorX::REPARTITION_FANOUT;
+    std::vector<std::vector<uint32_t>> partition_indexes(fanout);
+    const auto* channel_ids = partitioner->get_channel_ids().get<uint32_t>();
+    for (uint32_t i = 0; i != rows; ++i) {
+        partition_indexes[channel_ids[i]].emplace_back(i);
+    }
+
+    for (uint32_t i = 0; i != fanout; ++i) {
+        const auto count = partition_indexes[i].size();
+        if (count == 0) {
+            continue;
+        }
+        auto& sub_block = sub_blocks[i];
+        if (!sub_block) {
+            sub_block = vectorized::MutableBlock::create_unique(block.clone_empty());
+        }
+        RETURN_IF_ERROR(sub_block->add_rows(&block, partition_indexes[i].data(),
+                                            partition_indexes[i].data() + count));
+        sub_rows[i] += count;
+
+        // The rows left in `sub_block` at last stay in memory, so a small sub partition is never
+        // written to disk.
+        if (sub_block->allocated_bytes() >=
+            vectorized::SpillStream::MAX_SPILL_WRITE_BATCH_MEM / fanout) {
+            auto& sub_stream = sub_streams[i];
+            if (!sub_stream) {
+                RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                        state, sub_stream, print_id(state->query_id()), stream_name,
+                        _parent->node_id(), std::numeric_limits<int32_t>::max(),
+                        std::numeric_limits<size_t>::max(), operator_profile()));
+            }
+            RETURN_IF_ERROR(sub_stream->spill_block(state, sub_block->to_block(), false));
+            sub_block.reset();
+        }
+    }
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::repartition(RuntimeState* state,
+                                                       uint32_t partition_index) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    const auto level = _partition_levels[partition_index];
+    RETURN_IF_ERROR(p._build_repartitioners[level]->clone(state, _build_repartitioner));
+    RETURN_IF_ERROR(p._probe_repartitioners[level]->clone(state, _probe_repartitioner));
+
+    constexpr auto fanout = PartitionedHashJoinProbeOperatorX::REPARTITION_FANOUT;
+    const auto first_sub_partition = static_cast<uint32_t>(_partition_levels.size());
+    const auto partition_count = first_sub_partition + fanout;
+    _partition_levels.resize(partition_count, level + 1);
+    _partitioned_blocks.resize(partition_count);
+    _probe_spilling_streams.resize(partition_count);
+    _shared_state->spilled_streams.resize(partition_count);
+    _shared_state->partitioned_build_blocks.resize(partition_count);
+    COUNTER_UPDATE(_repartition_partitions, 1);
+
+    auto query_id = state->query_id();
+    auto repartition_func = [this, query_id, state, partition_index, first_sub_partition] {
+        SCOPED_TIMER(_repartition_timer);
+        std::vector<size_t> build_rows(fanout);
+        auto* build_sub_blocks =
+                _shared_state->partitioned_build_blocks.data() + first_sub_partition;
+        auto* build_sub_streams = _shared_state->spilled_streams.data() + first_sub_partition;
+        const auto build_stream_name = fmt::format("hash_build_repartition_{}", partition_index);
+
+        auto& build_stream = _shared_state->spilled_streams[partition_index];
+        build_stream->set_read_counters(operator_profile());
+        bool eos = false;
+        while (!eos && !_state->is_cancelled()) {
+            vectorized::Block block;
+            RETURN_IF_ERROR(build_stream->read_next_block_sync(&block, &eos));
+            RETURN_IF_ERROR(_repartition_block(state, _build_repartitioner.get(), block,
+                                               build_stream_name, build_sub_blocks,
+                                               build_sub_streams, build_rows.data()));
+        }
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(build_stream);
+        build_stream.reset();
+        if (auto& build_block = _shared_state->partitioned_build_blocks[partition_index]) {
+            auto block = build_block->to_block();
+            build_block.reset();
+            RETURN_IF_ERROR(_repartition_block(state, _build_repartitioner.get(), block,
+                                               build_stream_name, build_sub_blocks,
+                                               build_sub_streams, build_rows.data()));
+        }
+        for (uint32_t i = 0; i != fanout; ++i) {
+            if (build_sub_streams[i]) {
+                RETURN_IF_ERROR(build_sub_streams[i]->spill_eof());
+            }
+        }
+
+        // If all the build rows fall into one sub partition, they most likely share one key and
+        // splitting it again does not help, so it is built in memory as is.
+        const auto total_build_rows =
+                std::accumulate(build_rows.begin(), build_rows.end(), size_t {0});
+        for (uint32_t i = 0; i != fanout; ++i) {
+            if (build_rows[i] == total_build_rows) {
+                _partition_levels[first_sub_partition + i] =
+                        _parent->cast<PartitionedHashJoinProbeOperatorX>()._max_repartition_level;
+                LOG(INFO) << fmt::format(
+                        "Query:{}, hash join probe:{}, task:{}, partition:{}, rows:{}, all build "
+                        "rows are in one sub partition, stop repartitioning it",
+                        print_id(query_id), _parent->node_id(), state->task_id(), partition_index,
+                        total_build_rows);
+            }
+        }
+
+        std::vector<size_t> probe_rows(fanout);
+        auto* probe_sub_blocks = _partitioned_blocks.data() + first_sub_partition;
+        auto* probe_sub_streams = _probe_spilling_streams.data() + first_sub_partition;
+        const auto probe_stream_name = fmt::format("hash_probe_repartition_{}", partition_index);
+
+        RETURN_IF_ERROR(finish_spilling(partition_index));
+        if (auto& probe_stream = _probe_spilling_streams[partition_index]) {
+            eos = false;
+            while (!eos && !_state->is_cancelled()) {
+                vectorized::Block block;
+                RETURN_IF_ERROR(probe_stream->read_next_block_sync(&block, &eos));
+                RETURN_IF_ERROR(_repartition_block(state, _probe_repartitioner.get(), block,
+                                                   probe_stream_name, probe_sub_blocks,
+                                                   probe_sub_streams, probe_rows.data()));
+            }
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(probe_stream);
+            probe_stream.reset();
+        }
+        auto& probe_blocks = _probe_blocks[partition_index];
+        if (auto& probe_block = _partitioned_blocks[partition_index]) {
+            probe_blocks.emplace_back(probe_block->to_block());
+            probe_block.reset();
+        }
+        for (auto& block : probe_blocks) {
+            RETURN_IF_ERROR(_repartition_block(state, _probe_repartitioner.get(), block,
+                                               probe_stream_name, probe_sub_blocks,
+                                               probe_sub_streams, probe_rows.data()));
+        }
+        probe_blocks.clear();
+
+        VLOG_DEBUG << fmt::format(
+                "Query:{}, hash join probe:{}, task:{}, partition:{}, repartitioned into {}-{}, "
+                "build rows:{}, probe rows:{}",
+                print_id(query_id), _parent->node_id(), state->task_id(), partition_index,
+                first_sub_partition, first_sub_partition + fanout - 1, total_build_rows,
+                std::accumulate(probe_rows.begin(), probe_rows.end(), size_t {0}));
+        return Status::OK();
+    };
+
+    auto exception_catch_func = [repartition_func]() {
+        auto status = [&]() { RETURN_IF_CATCH_EXCEPTION({ return repartition_func(); }); }();
+        return status;
+    };
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _spill_dependency->block();
+    return spill_io_pool->submit(std::make_shared<SpillRecoverRunnable>(
+            state, _spill_dependency, operator_profile(), _shared_state->shared_from_this(),
+            exception_catch_func));
+}
+
 Status PartitionedHashJoinProbeLocalState::finish_spilling(uint32_t partition_index) {
     auto& probe_spilling_stream = _probe_spilling_streams[partition_index];
 
@@ -519,10 +704,25 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
 
     for (const auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
         _probe_exprs.emplace_back(conjunct.left);
+        _build_exprs.emplace_back(conjunct.right);
     }
     _partitioner = std::make_unique<SpillPartitionerType>(_partition_count);
     RETURN_IF_ERROR(_partitioner->init(_probe_exprs));
 
+    // A null aware join needs all the build rows to decide the result of a probe row with null key.
+    if (_join_op != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) {
+        _max_repartition_level =
+                static_cast<uint32_t>(std::max(config::spill_hash_join_max_repartition_level, 0));
+    }
+    for (uint32_t level = 0; level != _max_repartition_level; ++level) {
+        _build_repartitioners.emplace_back(
+                std::make_unique<SpillRePartitionerType>(REPARTITION_FANOUT, level + 1));
+        RETURN_IF_ERROR(_build_repartitioners.back()->init(_build_exprs));
+        _probe_repartitioners.emplace_back(
+                std::make_unique<SpillRePartitionerType>(REPARTITION_FANOUT, level + 1));
+        RETURN_IF_ERROR(_probe_repartitioners.back()->init(_probe_exprs));
+    }
+
     return Status::OK();
 }
 
@@ -539,6 +739,13 @@ Status PartitionedHashJoinProbeOperatorX::prepare(RuntimeState* state) {
     _child = std::move(child);
     RETURN_IF_ERROR(_partitioner->prepare(state, _child->row_desc()));
     RETURN_IF_ERROR(_partitioner->open(state));
+    for (uint32_t level = 0; level != _max_repartition_level; ++level) {
+        RETURN_IF_ERROR(
+                _build_repartitioners[level]->prepare(state, _build_side_child->row_desc()));
+        RETURN_IF_ERROR(_build_repartitioners[level]->open(state));
+        RETURN_IF_ERROR(_probe_repartitioners[level]->prepare(state, _child->row_desc()));
+        RETURN_IF_ERROR(_probe_repartitioners[level]->open(state));
+    }
     return Status::OK();
 }
 
@@ -686,6 +893,13 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
     }
 
     if (local_state._need_to_setup_internal_operators) {
+        if (!local_state._repartition_checked) {
+            local_state._repartition_checked = true;
+            if (local_state._need_to_repartition(partition_index)) {
+                return local_state.repartition(state, partition_index);
+            }
+        }
+
         bool has_data = false;
         RETURN_IF_ERROR(local_state.recover_build_blocks_from_disk(
                 state, local_state._partition_cursor, has_data));
@@ -742,10 +956,11 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                 local_state._partition_cursor);
         local_state._partition_cursor++;
         local_state.update_profile_from_inner();
-        if (local_state._partition_cursor == _partition_count) {
+        if (local_state._partition_cursor == local_state._partition_levels.size()) {
             *eos = true;
         } else {
             local_state._need_to_setup_internal_operators = true;
+            local_state._repartition_checked = false;
         }
     }
 
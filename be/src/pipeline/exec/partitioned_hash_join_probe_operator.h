@@ -56,6 +56,10 @@ public:
     Status recover_probe_blocks_from_disk(RuntimeState* state, uint32_t partition_index,
                                           bool& has_data);
 
+    // Splits a spilled partition which is too big to be built in memory into
+    // REPARTITION_FANOUT sub partitions, which are appended to the partitions to be processed.
+    Status repartition(RuntimeState* state, uint32_t partition_index);
+
     Status finish_spilling(uint32_t partition_index);
 
     template <bool spilled>
@@ -82,8 +86,19 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    bool _need_to_repartition(uint32_t partition_index) const;
+
+    Status _repartition_block(RuntimeState* state, vectorized::PartitionerBase* partitioner,
+                              vectorized::Block& block, const std::string& stream_name,
+                              std::unique_ptr<vectorized::MutableBlock>* sub_blocks,
+                              vectorized::SpillStreamSPtr* sub_streams, size_t* sub_rows);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
+    // The repartition level of every partition, the sub partitions split from a partition have a
+    // level one higher than it. Its size is the number of partitions to be processed.
+    std::vector<uint32_t> _partition_levels;
+    bool _repartition_checked {false};
 
     std::unique_ptr<vectorized::Block> _child_block;
     bool _child_eos {false};
@@ -95,6 +110,8 @@ private:
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
 
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _build_repartitioner;
+    std::unique_ptr<vectorized::PartitionerBase> _probe_repartitioner;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
 
     bool _need_to_setup_internal_operators {true};
@@ -113,6 +130,8 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_partitions = nullptr;
 
     RuntimeProfile::Counter* _probe_blocks_bytes = nullptr;
     RuntimeProfile::Counter* _memory_usage_reserved = nullptr;
@@ -183,6 +202,7 @@ private:
 
     // probe expr
     std::vector<TExpr> _probe_exprs;
+    std::vector<TExpr> _build_exprs;
 
     const std::vector<TExpr> _distribution_partition_exprs;
 
@@ -191,6 +211,12 @@ private:
 
     const uint32_t _partition_count;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner;
+
+    static constexpr uint32_t REPARTITION_FANOUT = 8;
+    uint32_t _max_repartition_level = 0;
+    // One partitioner for each repartition level, seeded by the level.
+    std::vector<std::unique_ptr<vectorized::PartitionerBase>> _build_repartitioners;
+    std::vector<std::unique_ptr<vectorized::PartitionerBase>> _probe_repartitioners;
 };
 
 } // namespace pipeline
@@ -21,6 +21,7 @@
 
 #include "common/logging.h"
 #include "pipeline/exec/operator.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/block.h"
 
@@ -123,14 +124,24 @@ Status RepeatLocalState::get_repeated_block(vectorized::Block* input_block, int
      * child_block 1,2,1 | 1,3,1 | 2,1,1 | 3,1,1
      * output_block 1,null,1,1 | 1,null,1,1 | 2,nul,1,1 | 3,null,1,1
      */
+    const auto rows = input_block->rows();
+    // The input block is cleared after the last grouping set, so the last grouping set takes the
+    // evaluated columns that are not shared with the child block instead of copying them.
+    const bool is_last_repeat = repeat_id_idx == p._repeat_id_list_size - 1;
+    std::vector<std::pair<size_t, vectorized::ColumnPtr>> taken_columns;
     size_t cur_col = 0;
     for (size_t i = 0; i < input_column_size; i++) {
-        const vectorized::ColumnWithTypeAndName& src_column = input_block->get_by_position(i);
+        vectorized::ColumnWithTypeAndName& src_column = input_block->get_by_position(i);
         const auto slot_id = p._output_slots[cur_col]->id();
         const bool is_repeat_slot = p._all_slot_ids.contains(slot_id);
         const bool is_set_null_slot = !p._slot_id_set_list[repeat_id_idx].contains(slot_id);
         const auto row_size = src_column.column->size();
-        if (is_repeat_slot) {
+        if (is_last_repeat && !(is_repeat_slot && is_set_null_slot) &&
+            src_column.column->use_count() == 1) {
+            auto column = std::move(src_column.column);
+            taken_columns.emplace_back(cur_col,
+                                       is_repeat_slot ? vectorized::make_nullable(column) : column);
+        } else if (is_repeat_slot) {
             DCHECK(p._output_slots[cur_col]->is_nullable());
             auto* nullable_column =
                     assert_cast<vectorized::ColumnNullable*>(output_columns[cur_col].get());
@@ -151,11 +162,13 @@ Status RepeatLocalState::get_repeated_block(vectorized::Block* input_block, int
         cur_col++;
     }
 
-    const auto rows = input_block->rows();
     // Fill grouping ID to block
     RETURN_IF_ERROR(add_grouping_id_column(rows, cur_col, output_columns, repeat_id_idx));
 
     DCHECK_EQ(cur_col, output_column_size);
+    for (auto& [position, column] : taken_columns) {
+        output_block->replace_by_position(position, std::move(column));
+    }
 
     return Status::OK();
 }
@@ -64,7 +64,6 @@ Status SetSinkLocalState<is_intersect>::close(RuntimeState* state, Status exec_s
 template <bool is_intersect>
 Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Block* in_block,
                                             bool eos) {
-    constexpr static auto BUILD_BLOCK_MAX_SIZE = 4 * 1024UL * 1024UL * 1024UL;
     RETURN_IF_CANCELLED(state);
     auto& local_state = get_local_state(state);
 
@@ -74,33 +73,29 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
     auto& build_block = local_state._shared_state->build_block;
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
 
+    // The hash table is built block by block, and only the first row of every distinct key is
+    // kept in the build block, so the duplicated rows are released as soon as they are read.
     if (in_block->rows() != 0) {
-        {
-            SCOPED_TIMER(local_state._merge_block_timer);
-            RETURN_IF_ERROR(local_state._mutable_block.merge(*in_block));
-        }
+        SCOPED_TIMER(local_state._build_timer);
+        RETURN_IF_ERROR(_process_build_block(local_state, *in_block, state));
         if (local_state._mutable_block.rows() > std::numeric_limits<uint32_t>::max()) {
             return Status::NotSupported("set operator do not support build table rows over:" +
                                         std::to_string(std::numeric_limits<uint32_t>::max()));
         }
     }
 
-    if (eos || local_state._mutable_block.allocated_bytes() >= BUILD_BLOCK_MAX_SIZE) {
-        SCOPED_TIMER(local_state._build_timer);
+    if (eos) {
         build_block = local_state._mutable_block.to_block();
-        RETURN_IF_ERROR(_process_build_block(local_state, build_block, state));
         local_state._mutable_block.clear();
 
-        if (eos) {
-            uint64_t hash_table_size = local_state._shared_state->get_hash_table_size();
-            valid_element_in_hash_tbl = is_intersect ? 0 : hash_table_size;
+        uint64_t hash_table_size = local_state._shared_state->get_hash_table_size();
+        valid_element_in_hash_tbl = is_intersect ? 0 : hash_table_size;
 
-            local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
-                    ->set_ready();
-            DCHECK_GT(_child_quantity, 1);
-            RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
-                    state, hash_table_size, local_state._finish_dependency));
-        }
+        local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
+                ->set_ready();
+        DCHECK_GT(_child_quantity, 1);
+        RETURN_IF_ERROR(local_state._runtime_filter_producer_helper->send_filter_size(
+                state, hash_table_size, local_state._finish_dependency));
     }
     return Status::OK();
 }
@@ -118,12 +113,15 @@ Status SetSinkOperatorX<is_intersect>::_process_build_block(
     vectorized::ColumnRawPtrs raw_ptrs(_child_exprs.size());
     RETURN_IF_ERROR(_extract_build_column(local_state, block, raw_ptrs, rows));
     auto st = Status::OK();
+    auto& new_rows = local_state._new_build_rows;
+    new_rows.clear();
     std::visit(
             [&](auto&& arg) {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
                 if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
                     vectorized::HashTableBuild<HashTableCtxType, is_intersect>
-                            hash_table_build_process(&local_state, rows, raw_ptrs, state);
+                            hash_table_build_process(&local_state, rows, raw_ptrs, state,
+                                                     local_state._mutable_block.rows(), new_rows);
                     st = hash_table_build_process(arg, local_state._arena);
                 } else {
                     LOG(FATAL) << "FATAL: uninited hash table";
@@ -131,8 +129,19 @@ Status SetSinkOperatorX<is_intersect>::_process_build_block(
                 }
             },
             local_state._shared_state->hash_table_variants->method_variant);
-
-    return st;
+    RETURN_IF_ERROR(st);
+
+    if (!new_rows.empty()) {
+        SCOPED_TIMER(local_state._merge_block_timer);
+        if (local_state._mutable_block.columns() == 0) {
+            auto empty_block = block.clone_empty();
+            local_state._mutable_block =
+                    vectorized::MutableBlock::build_mutable_block(&empty_block);
+        }
+        RETURN_IF_ERROR(local_state._mutable_block.add_rows(&block, new_rows.data(),
+                                                            new_rows.data() + new_rows.size()));
+    }
+    return Status::OK();
 }
 
 template <bool is_intersect>
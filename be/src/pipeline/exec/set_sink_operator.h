@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "operator.h"
 #include "runtime_filter/runtime_filter_producer_helper_set.h"
 
@@ -54,7 +57,10 @@ public:
 private:
     friend class SetSinkOperatorX<is_intersect>;
 
+    // the first row of every key in the hash table, becomes the build block at eos
     vectorized::MutableBlock _mutable_block;
+    // the rows of the current input block whose keys are new to the hash table
+    std::vector<uint32_t> _new_build_rows;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
     vectorized::Arena _arena;
@@ -39,6 +39,8 @@
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 using SpillPartitionerType = vectorized::Crc32HashPartitioner<vectorized::SpillPartitionChannelIds>;
+using SpillRePartitionerType =
+        vectorized::Crc32HashPartitioner<vectorized::SpillRePartitionChannelIds>;
 
 struct SpillContext {
     std::atomic_int running_tasks_count;
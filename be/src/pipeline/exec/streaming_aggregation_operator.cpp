@@ -24,6 +24,7 @@
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/exprs/vectorized_agg_fn.h"
 #include "vec/exprs/vslot_ref.h"
@@ -77,6 +78,10 @@ static constexpr StreamingHtMinReductionEntry STREAMING_HT_MIN_REDUCTION[] = {
 static constexpr int STREAMING_HT_MIN_REDUCTION_SIZE =
         sizeof(STREAMING_HT_MIN_REDUCTION) / sizeof(STREAMING_HT_MIN_REDUCTION[0]);
 
+// Only the first switches are kept in the timeline of the profile, so a flapping
+// pre-aggregation does not produce a huge info string.
+static constexpr int MAX_ADAPTIVE_TIMELINE_SWITCHES = 32;
+
 StreamingAggLocalState::StreamingAggLocalState(RuntimeState* state, OperatorXBase* parent)
         : Base(state, parent),
           _agg_data(std::make_unique<AggregatedDataVariants>()),
@@ -109,6 +114,9 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _get_results_timer = ADD_TIMER(custom_profile(), "GetResultsTime");
     _hash_table_iterate_timer = ADD_TIMER(custom_profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(custom_profile(), "InsertKeysToColumnTime");
+    _adaptive_pass_through_rows_counter =
+            ADD_COUNTER(custom_profile(), "AdaptivePassThroughRows", TUnit::UNIT);
+    _adaptive_switch_counter = ADD_COUNTER(custom_profile(), "AdaptiveSwitchCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -311,6 +319,10 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     // pressure. In either case we should always use the remaining space in the hash table
     // to avoid wasting memory.
     // But for fixed hash map, it never need to expand
+    if (_should_pass_through_by_reduction(rows)) {
+        SCOPED_TIMER(_streaming_agg_timer);
+        return true;
+    }
     auto& p = Base::_parent->template cast<StreamingAggOperatorX>();
     bool ret_flag = false;
     const auto spill_streaming_agg_mem_limit = p._spill_streaming_agg_mem_limit;
@@ -337,6 +349,67 @@ bool StreamingAggLocalState::_should_not_do_pre_agg(size_t rows) {
     return ret_flag;
 }
 
+bool StreamingAggLocalState::_should_pass_through_by_reduction(size_t rows) {
+    if (!_adaptive_pass_through) {
+        return false;
+    }
+    const auto probe_rows = config::streaming_agg_pass_through_probe_rows;
+    if (config::streaming_agg_reduction_window_rows <= 0 ||
+        (probe_rows >= 0 && _pass_through_rows_in_probe >= static_cast<size_t>(probe_rows))) {
+        // Aggregate a window again, the keys of the input may have become more repetitive.
+        _adaptive_pass_through = false;
+        _window_input_rows = 0;
+        _window_start_hash_table_size = _get_hash_table_size();
+        _record_adaptive_switch(false, 0);
+        return false;
+    }
+    _pass_through_rows_in_probe += rows;
+    COUNTER_UPDATE(_adaptive_pass_through_rows_counter, rows);
+    return true;
+}
+
+void StreamingAggLocalState::_update_reduction_window(size_t rows) {
+    const auto window_rows = config::streaming_agg_reduction_window_rows;
+    if (window_rows <= 0) {
+        return;
+    }
+    _window_input_rows += rows;
+    if (_window_input_rows < static_cast<size_t>(window_rows)) {
+        return;
+    }
+    // The reduction of the window is its input rows divided by the new groups it created, the
+    // rows merged into the existing groups are what the pre-aggregation saves downstream.
+    const size_t hash_table_size = _get_hash_table_size();
+    const size_t new_groups = hash_table_size > _window_start_hash_table_size
+                                      ? hash_table_size - _window_start_hash_table_size
+                                      : 0;
+    const double reduction = static_cast<double>(_window_input_rows) /
+                             static_cast<double>(std::max<size_t>(new_groups, 1));
+    _window_input_rows = 0;
+    _window_start_hash_table_size = hash_table_size;
+    if (reduction < config::streaming_agg_min_reduction_ratio) {
+        _adaptive_pass_through = true;
+        _pass_through_rows_in_probe = 0;
+        _record_adaptive_switch(true, reduction);
+    }
+}
+
+void StreamingAggLocalState::_record_adaptive_switch(bool pass_through, double reduction) {
+    COUNTER_UPDATE(_adaptive_switch_counter, 1);
+    if (_adaptive_switch_counter->value() > MAX_ADAPTIVE_TIMELINE_SWITCHES) {
+        return;
+    }
+    if (!_adaptive_timeline.empty()) {
+        _adaptive_timeline += ", ";
+    }
+    if (pass_through) {
+        _adaptive_timeline += fmt::format("agg->pass@{}({:.2f})", _input_num_rows, reduction);
+    } else {
+        _adaptive_timeline += fmt::format("pass->agg@{}", _input_num_rows);
+    }
+    custom_profile()->add_info_string("AdaptivePreAggTimeline", _adaptive_timeline);
+}
+
 Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                                             doris::vectorized::Block* out_block) {
     SCOPED_TIMER(_build_timer);
@@ -410,6 +483,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block, p._offsets_of_aggregate_states[i], _places.data(), _agg_arena_pool,
                     _should_expand_hash_table));
         }
+        _update_reduction_window(rows);
     }
 
     return Status::OK();
@@ -598,10 +672,9 @@ void StreamingAggLocalState::_emplace_into_hash_table(vectorized::AggregateDataP
                            };
 
                            SCOPED_TIMER(_hash_table_emplace_timer);
-                           for (size_t i = 0; i < num_rows; ++i) {
-                               places[i] = *agg_method.lazy_emplace(state, i, creator,
-                                                                    creator_for_null_key);
-                           }
+                           agg_method.lazy_emplace_batch(
+                                   state, num_rows, creator, creator_for_null_key,
+                                   [&](size_t i, auto* mapped) { places[i] = *mapped; });
 
                            COUNTER_UPDATE(_hash_table_input_counter, num_rows);
                        }},
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include <memory>
+#include <string>
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
@@ -60,6 +61,11 @@ private:
     bool _should_expand_preagg_hash_tables();
 
     MOCK_FUNCTION bool _should_not_do_pre_agg(size_t rows);
+    // Whether the rows should be passed through because the sampled reduction of the last
+    // window was too low, it also decides when to sample the reduction again.
+    bool _should_pass_through_by_reduction(size_t rows);
+    void _update_reduction_window(size_t rows);
+    void _record_adaptive_switch(bool pass_through, double reduction);
 
     Status _execute_with_serialized_key(vectorized::Block* block);
     void _update_memusage_with_serialized_key();
@@ -86,6 +92,8 @@ private:
     RuntimeProfile::Counter* _get_results_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_iterate_timer = nullptr;
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
+    RuntimeProfile::Counter* _adaptive_pass_through_rows_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_switch_counter = nullptr;
 
     bool _should_expand_hash_table = true;
     int64_t _cur_num_rows_returned = 0;
@@ -100,6 +108,14 @@ private:
     bool _reach_limit = false;
     size_t _input_num_rows = 0;
 
+    // The state of the adaptive pass-through, see `_should_pass_through_by_reduction`.
+    bool _adaptive_pass_through = false;
+    size_t _window_input_rows = 0;
+    size_t _window_start_hash_table_size = 0;
+    size_t _pass_through_rows_in_probe = 0;
+    // "agg->pass@rows(reduction)" entries of every switch, shown in the profile.
+    std::string _adaptive_timeline;
+
     vectorized::PODArray<vectorized::AggregateDataPtr> _places;
     std::vector<char> _deserialize_buffer;
 
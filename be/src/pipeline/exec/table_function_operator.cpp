@@ -174,6 +174,14 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
 
         bool skip_child_row = false;
         while (columns[p._child_slots.size()]->size() < state->batch_size()) {
+            if (_can_expand_child_rows() && _expand_child_rows(columns, state->batch_size())) {
+                skip_child_row = false;
+                if (_cur_child_offset == -1) {
+                    break;
+                }
+                continue;
+            }
+
             int idx = _find_last_fn_eos_idx();
             if (idx == 0 || skip_child_row) {
                 _copy_output_slots(columns);
@@ -226,6 +234,36 @@ Status TableFunctionLocalState::get_expanded_block(RuntimeState* state,
     return Status::OK();
 }
 
+bool TableFunctionLocalState::_can_expand_child_rows() const {
+    return _parent->cast<TableFunctionOperatorX>()._fn_num == 1 &&
+           _fns[0]->support_get_values_of_rows() && _fns[0]->at_row_begin();
+}
+
+// Expands the child rows from the current one to the last one whose results fit in the block at
+// once, the output slots of the child are then copied by one `insert_indices_from` per column.
+// Returns false if the results of the current row do not fit, which is then expanded row by row.
+bool TableFunctionLocalState::_expand_child_rows(vectorized::MutableColumns& columns,
+                                                 int batch_size) {
+    auto& p = _parent->cast<TableFunctionOperatorX>();
+    auto& fn_column = columns[p._child_slots.size()];
+    DCHECK_EQ(_current_row_insert_times, 0);
+    _child_rows.clear();
+    size_t next_row = _fns[0]->get_values_of_rows(fn_column, _cur_child_offset,
+                                                  _child_block->rows(),
+                                                  batch_size - fn_column->size(), _child_rows);
+    if (static_cast<int64_t>(next_row) == _cur_child_offset) {
+        return false;
+    }
+    for (auto index : p._output_slot_indexs) {
+        auto src_column = _child_block->get_by_position(index).column;
+        columns[index]->insert_indices_from(*src_column, _child_rows.data(),
+                                            _child_rows.data() + _child_rows.size());
+    }
+    _cur_child_offset = static_cast<int64_t>(next_row) - 1;
+    process_next_child_row();
+    return true;
+}
+
 void TableFunctionLocalState::process_next_child_row() {
     _cur_child_offset++;
 
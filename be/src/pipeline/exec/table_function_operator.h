@@ -64,12 +64,16 @@ private:
     // >0: some of fns are eos
     int _find_last_fn_eos_idx() const;
     bool _is_inner_and_empty();
+    bool _can_expand_child_rows() const;
+    bool _expand_child_rows(vectorized::MutableColumns& columns, int batch_size);
 
     std::vector<vectorized::TableFunction*> _fns;
     vectorized::VExprContextSPtrs _vfn_ctxs;
     int64_t _cur_child_offset = -1;
     std::unique_ptr<vectorized::Block> _child_block;
     int _current_row_insert_times = 0;
+    // the child row of every result expanded by `_expand_child_rows`.
+    std::vector<uint32_t> _child_rows;
     bool _child_eos = false;
 
     RuntimeProfile::Counter* _init_function_timer = nullptr;
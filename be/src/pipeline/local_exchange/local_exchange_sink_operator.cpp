@@ -86,11 +86,14 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
         custom_profile()->add_info_string(
                 "UseGlobalShuffle",
                 std::to_string(_parent->cast<LocalExchangeSinkOperatorX>()._use_global_shuffle));
+        _split_hot_partition_rows_counter =
+                ADD_COUNTER(custom_profile(), "SplitHotPartitionRows", TUnit::UNIT);
     }
     custom_profile()->add_info_string(
             "PartitionExprsSize",
             std::to_string(_parent->cast<LocalExchangeSinkOperatorX>()._partitioned_exprs_num));
     _channel_id = info.task_idx;
+    _sender_id = info.task_idx;
     return Status::OK();
 }
 
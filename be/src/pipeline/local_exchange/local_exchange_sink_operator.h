@@ -62,10 +62,13 @@ private:
     // Used by shuffle exchanger
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
+    RuntimeProfile::Counter* _split_hot_partition_rows_counter = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
 
     // Used by random passthrough exchanger
     int _channel_id = 0;
+    // Index of this sink instance, which owns one ring of each data queue if ring matrix is used.
+    int _sender_id = 0;
 };
 
 // A single 32-bit division on a recent x64 processor has a throughput of one instruction every six cycles with a latency of 26 cycles.
@@ -33,6 +33,12 @@ void Exchanger<BlockType>::_enqueue_data_and_set_ready(int channel_id,
         _enqueue_data_and_set_ready(channel_id, std::move(block));
         return;
     }
+    if (_data_queue[channel_id].use_rings()) {
+        if (_enqueue_data_to_ring(channel_id, local_state, std::move(block))) {
+            _wake_up_source(channel_id, local_state);
+        }
+        return;
+    }
     // PartitionedBlock is used by shuffle exchanger.
     // PartitionedBlock will be push into multiple queues with different row ranges, so it will be
     // referenced multiple times. Otherwise, we only ref the block once because it is only push into
@@ -50,6 +56,28 @@ void Exchanger<BlockType>::_enqueue_data_and_set_ready(int channel_id,
     }
 }
 
+template <typename BlockType>
+bool Exchanger<BlockType>::_enqueue_data_to_ring(int channel_id,
+                                                 LocalExchangeSinkLocalState* local_state,
+                                                 BlockType&& block) {
+    if constexpr (std::is_same_v<PartitionedBlock, BlockType> ||
+                  std::is_same_v<BroadcastBlock, BlockType>) {
+        block.first->record_channel_id(channel_id);
+    } else {
+        block->record_channel_id(channel_id);
+    }
+    return _data_queue[channel_id].enqueue_to_ring(local_state->_sender_id, std::move(block));
+}
+
+template <typename BlockType>
+void Exchanger<BlockType>::_wake_up_source(int channel_id,
+                                           LocalExchangeSinkLocalState* local_state) {
+    // Pairs with the fence in `_dequeue_data`. Either the source sees the new block after it
+    // blocks itself, or we see the source is blocked here and wake it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    local_state->_shared_state->set_ready_to_read(channel_id);
+}
+
 template <typename BlockType>
 bool Exchanger<BlockType>::_dequeue_data(LocalExchangeSourceLocalState* local_state,
                                          BlockType& block, bool* eos, vectorized::Block* data_block,
@@ -69,6 +97,23 @@ bool Exchanger<BlockType>::_dequeue_data(LocalExchangeSourceLocalState* local_st
         return true;
     } else if (all_finished) {
         *eos = true;
+    } else if (_data_queue[channel_id].use_rings()) {
+        // Senders push into rings without lock, so block first and then check again.
+        local_state->_dependency->block();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_data_queue[channel_id].try_dequeue(block)) {
+            local_state->_dependency->set_ready();
+            if constexpr (std::is_same_v<PartitionedBlock, BlockType> ||
+                          std::is_same_v<BroadcastBlock, BlockType>) {
+                local_state->_shared_state->sub_mem_usage(channel_id,
+                                                          block.first->_allocated_bytes);
+            } else {
+                local_state->_shared_state->sub_mem_usage(channel_id, block->_allocated_bytes);
+                data_block->swap(block->_data_block);
+            }
+            return true;
+        }
+        COUNTER_UPDATE(local_state->_get_block_failed_counter, 1);
     } else {
         std::unique_lock l(*_m[channel_id]);
         if (_data_queue[channel_id].try_dequeue(block)) {
@@ -216,17 +261,47 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     DCHECK(shuffle_idx_to_instance_idx && shuffle_idx_to_instance_idx->size() > 0);
     const auto& map = *shuffle_idx_to_instance_idx;
     int32_t enqueue_rows = 0;
+    // With ring matrix, sources are woken up once after all partitions of this block are pushed.
+    const bool use_rings = _data_queue.front().use_rings();
+    auto& channels_to_wake_up = _channels_to_wake_up[channel_id];
+    auto enqueue = [&](int instance, PartitionedBlock&& partitioned_block) {
+        if (!use_rings) {
+            _enqueue_data_and_set_ready(instance, local_state, std::move(partitioned_block));
+        } else if (_enqueue_data_to_ring(instance, local_state, std::move(partitioned_block))) {
+            channels_to_wake_up.push_back(instance);
+        }
+    };
+    if (_skew_rebalancer) {
+        _assign_skewed_partitions(channel_id, new_block_wrapper->_allocated_bytes);
+    }
     for (const auto& it : map) {
         DCHECK(it.second >= 0 && it.second < _num_partitions)
                 << it.first << " : " << it.second << " " << _num_partitions;
         uint32_t start = partition_rows_histogram[it.first];
         uint32_t size = partition_rows_histogram[it.first + 1] - start;
-        if (size > 0) {
-            enqueue_rows += size;
-            _enqueue_data_and_set_ready(it.second, local_state,
-                                        {new_block_wrapper, {row_idx, start, size}});
+        if (size == 0) {
+            continue;
+        }
+        enqueue_rows += size;
+        if (_skew_rebalancer && _partition_assigned_sources[channel_id][it.first].size() > 1) {
+            // A hot partition is split into contiguous row ranges, one for each assigned source.
+            const auto& sources = _partition_assigned_sources[channel_id][it.first];
+            const auto num_splits = std::min<uint32_t>(cast_set<uint32_t>(sources.size()), size);
+            for (uint32_t i = 0; i < num_splits; i++) {
+                uint32_t split_start = start + size * i / num_splits;
+                uint32_t split_end = start + size * (i + 1) / num_splits;
+                enqueue(sources[i],
+                        {new_block_wrapper, {row_idx, split_start, split_end - split_start}});
+            }
+            COUNTER_UPDATE(local_state->_split_hot_partition_rows_counter, size);
+            continue;
         }
+        enqueue(it.second, {new_block_wrapper, {row_idx, start, size}});
+    }
+    for (auto instance : channels_to_wake_up) {
+        _wake_up_source(instance, local_state);
     }
+    channels_to_wake_up.clear();
     if (enqueue_rows != rows) [[unlikely]] {
         fmt::memory_buffer debug_string_buffer;
         fmt::format_to(debug_string_buffer, "Type: {}, Local Exchange Id: {}, Shuffled Map: ",
@@ -243,6 +318,51 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     return Status::OK();
 }
 
+void ShuffleExchanger::enable_skew_rebalance(
+        int64_t min_partition_data_processed_rebalance_threshold,
+        int64_t min_data_processed_rebalance_threshold) {
+    // Rows are routed by partition index, so the rebalancer needs one task per partition.
+    DCHECK_EQ(_num_partitions, _num_sources);
+    _skew_rebalancer = std::make_unique<vectorized::SkewedPartitionRebalancer>(
+            _num_partitions, _num_sources, 1, min_partition_data_processed_rebalance_threshold,
+            min_data_processed_rebalance_threshold);
+    _partition_assigned_sources.resize(_num_senders);
+    for (auto& assigned_sources : _partition_assigned_sources) {
+        assigned_sources.resize(_num_partitions);
+    }
+    _skew_split_index.resize(_num_senders, 0);
+}
+
+void ShuffleExchanger::_assign_skewed_partitions(int channel_id, size_t block_bytes) {
+    const auto& partition_rows_histogram = _partition_rows_histogram[channel_id];
+    auto& assigned_sources = _partition_assigned_sources[channel_id];
+    auto& split_index = _skew_split_index[channel_id];
+
+    std::lock_guard<std::mutex> l(_skew_rebalancer_lock);
+    for (int partition = 0; partition < _num_partitions; partition++) {
+        const auto size =
+                partition_rows_histogram[partition + 1] - partition_rows_histogram[partition];
+        if (size > 0) {
+            _skew_rebalancer->add_partition_row_count(partition, size);
+        }
+    }
+    _skew_rebalancer->add_data_processed(cast_set<long>(block_bytes));
+    _skew_rebalancer->rebalance();
+
+    for (int partition = 0; partition < _num_partitions; partition++) {
+        auto& sources = assigned_sources[partition];
+        sources.clear();
+        if (partition_rows_histogram[partition + 1] == partition_rows_histogram[partition]) {
+            continue;
+        }
+        const int num_tasks = _skew_rebalancer->get_task_count(partition);
+        for (int i = 0; i < num_tasks; i++) {
+            sources.push_back(_skew_rebalancer->get_task_id(partition, split_index + i));
+        }
+        split_index += num_tasks;
+    }
+}
+
 Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                                      vectorized::Block* block, int channel_id) {
     const auto rows = cast_set<int32_t>(block->rows());
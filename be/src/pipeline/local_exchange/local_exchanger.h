@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "vec/exec/skewed_partition_rebalancer.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -189,14 +193,60 @@ struct RowRange {
 };
 using BroadcastBlock = std::pair<std::shared_ptr<ExchangerBase::BlockWrapper>, RowRange>;
 
+/**
+ * `BlockQueue` holds the data blocks of one source operator.
+ *
+ * By default, all senders push into `data_queue` under the lock of this queue. If `init_rings` is
+ * called, each sender owns a single-producer/single-consumer ring so senders can push without any
+ * lock (ring matrix: one ring per sender and source pair). A block is pushed into `data_queue`
+ * instead if the ring is full.
+ */
 template <typename BlockType>
 struct BlockQueue {
+    using Ring = boost::lockfree::spsc_queue<BlockType>;
     std::atomic<bool> eos = false;
     moodycamel::ConcurrentQueue<BlockType> data_queue;
     moodycamel::ProducerToken ptok {data_queue};
+    std::vector<std::unique_ptr<Ring>> rings;
+    // Only accessed by the source operator. The next ring to read to be fair among senders.
+    size_t next_ring = 0;
     BlockQueue() : eos(false), data_queue(moodycamel::ConcurrentQueue<BlockType>()) {}
     BlockQueue(BlockQueue<BlockType>&& other)
-            : eos(other.eos.load()), data_queue(std::move(other.data_queue)) {}
+            : eos(other.eos.load()),
+              data_queue(std::move(other.data_queue)),
+              rings(std::move(other.rings)) {}
+
+    void init_rings(int num_senders, size_t ring_capacity) {
+        rings.resize(num_senders);
+        for (auto& ring : rings) {
+            ring = std::make_unique<Ring>(ring_capacity);
+        }
+    }
+    bool use_rings() const { return !rings.empty(); }
+
+    // Should be called by sender `sender_id` only. No lock is needed.
+    inline bool enqueue_to_ring(int sender_id, BlockType&& item) {
+        if (eos) {
+            return false;
+        }
+        if (static_cast<size_t>(sender_id) >= rings.size() || !rings[sender_id]->push(item)) {
+            // The ring is full, use the shared queue instead of waiting for the source.
+            if (!data_queue.enqueue(std::move(item))) [[unlikely]] {
+                throw Exception(ErrorCode::INTERNAL_ERROR,
+                                "Exception occurs in data queue [size = {}] of local exchange.",
+                                data_queue.size_approx());
+            }
+        }
+        return true;
+    }
+
+    size_t size_approx() const {
+        size_t size = data_queue.size_approx();
+        for (const auto& ring : rings) {
+            size += ring->read_available();
+        }
+        return size;
+    }
     inline bool enqueue(BlockType const& item) {
         if (!eos) {
             if (!data_queue.enqueue(ptok, item)) [[unlikely]] {
@@ -221,7 +271,16 @@ struct BlockQueue {
         return false;
     }
 
-    bool try_dequeue(BlockType& item) { return data_queue.try_dequeue(item); }
+    bool try_dequeue(BlockType& item) {
+        for (size_t i = 0; i < rings.size(); i++) {
+            auto& ring = rings[next_ring];
+            next_ring = next_ring + 1 == rings.size() ? 0 : next_ring + 1;
+            if (ring->pop(item)) {
+                return true;
+            }
+        }
+        return data_queue.try_dequeue(item);
+    }
 
     void set_eos() { eos = true; }
 };
@@ -238,6 +297,7 @@ public:
         for (size_t i = 0; i < num_partitions; i++) {
             _m[i] = std::make_unique<std::mutex>();
         }
+        _init_rings();
     }
     Exchanger(int running_sink_operators, int num_sources, int num_partitions, int free_block_limit)
             : ExchangerBase(running_sink_operators, num_sources, num_partitions, free_block_limit) {
@@ -246,17 +306,33 @@ public:
         for (size_t i = 0; i < num_sources; i++) {
             _m[i] = std::make_unique<std::mutex>();
         }
+        _init_rings();
     }
     ~Exchanger() override = default;
     std::string data_queue_debug_string(int i) override {
-        return fmt::format("Data Queue {}: [size approx = {}, eos = {}]", i,
-                           _data_queue[i].data_queue.size_approx(), _data_queue[i].eos);
+        return fmt::format("Data Queue {}: [size approx = {}, eos = {}, rings = {}]", i,
+                           _data_queue[i].size_approx(), _data_queue[i].eos,
+                           _data_queue[i].rings.size());
     }
 
 protected:
+    void _init_rings() {
+        if (!config::enable_local_exchange_ring_matrix) {
+            return;
+        }
+        for (auto& queue : _data_queue) {
+            queue.init_rings(_num_senders, config::local_exchange_ring_capacity);
+        }
+    }
     // Enqueue data block and set downstream source operator to read.
     void _enqueue_data_and_set_ready(int channel_id, LocalExchangeSinkLocalState* local_state,
                                      BlockType&& block);
+    // Push data block into the ring of the sender without any lock. Source operator is not woken
+    // up, so callers must call `_wake_up_source` once a batch of blocks is enqueued. Returns
+    // false if the source operator is closed.
+    bool _enqueue_data_to_ring(int channel_id, LocalExchangeSinkLocalState* local_state,
+                               BlockType&& block);
+    void _wake_up_source(int channel_id, LocalExchangeSinkLocalState* local_state);
     bool _dequeue_data(LocalExchangeSourceLocalState* local_state, BlockType& block, bool* eos,
                        vectorized::Block* data_block, int channel_id);
 
@@ -279,6 +355,7 @@ public:
         DCHECK_GT(num_partitions, 0);
         DCHECK_GT(num_sources, 0);
         _partition_rows_histogram.resize(running_sink_operators);
+        _channels_to_wake_up.resize(running_sink_operators);
     }
     ~ShuffleExchanger() override = default;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos, Profile&& profile,
@@ -289,6 +366,14 @@ public:
     void close(SourceInfo&& source_info) override;
     ExchangeType get_type() const override { return ExchangeType::HASH_SHUFFLE; }
 
+    // Track the data volume of each partition and spread the rows of hot partitions over
+    // several source instances. Only valid if every partition maps to the source instance
+    // with the same index (local shuffle) and the downstream operator does not need all rows
+    // of a key in one instance (e.g. a partial aggregation).
+    void enable_skew_rebalance(int64_t min_partition_data_processed_rebalance_threshold,
+                               int64_t min_data_processed_rebalance_threshold);
+    bool skew_rebalance_enabled() const { return _skew_rebalancer != nullptr; }
+
 protected:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id,
@@ -296,7 +381,20 @@ protected:
                        std::map<int, int>* shuffle_idx_to_instance_idx);
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, int channel_id);
+    // Feed the partition sizes of one block into `_skew_rebalancer` and collect the source
+    // instances each non-empty partition should be sent to.
+    void _assign_skewed_partitions(int channel_id, size_t block_bytes);
     std::vector<std::vector<uint32_t>> _partition_rows_histogram;
+    // Per sink instance: sources to wake up after a block is pushed into rings.
+    std::vector<std::vector<int>> _channels_to_wake_up;
+
+    // `SkewedPartitionRebalancer` is not thread-safe and is shared by all sink instances.
+    std::mutex _skew_rebalancer_lock;
+    std::unique_ptr<vectorized::SkewedPartitionRebalancer> _skew_rebalancer;
+    // Per sink instance: source instances assigned to each partition for the current block,
+    // and a rolling index used to pick among them.
+    std::vector<std::vector<std::vector<int>>> _partition_assigned_sources;
+    std::vector<int64_t> _skew_split_index;
 };
 
 class BucketShuffleExchanger final : public ShuffleExchanger {
@@ -295,13 +295,10 @@ Status PipelineFragmentContext::prepare(const doris::TPipelineFragmentParams& re
             _runtime_state->set_load_job_id(request.load_job_id);
         }
 
-        if (request.is_simplified_param) {
-            _desc_tbl = _query_ctx->desc_tbl;
-        } else {
-            DCHECK(request.__isset.desc_tbl);
-            RETURN_IF_ERROR(DescriptorTbl::create(_runtime_state->obj_pool(), request.desc_tbl,
-                                                  &_desc_tbl));
-        }
+        // The descriptor table is the same for all fragments of a query, it is deserialized once
+        // when the query context is created and the operators are already built against it.
+        _desc_tbl = _query_ctx->desc_tbl;
+        DCHECK(_desc_tbl != nullptr);
         _runtime_state->set_desc_tbl(_desc_tbl);
         _runtime_state->set_num_per_fragment_instances(request.num_senders);
         _runtime_state->set_load_stream_per_node(request.load_stream_per_node);
@@ -763,15 +760,28 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
     std::shared_ptr<LocalExchangeSharedState> shared_state =
             LocalExchangeSharedState::create_shared(_num_instances);
     switch (data_distribution.distribution_type) {
-    case ExchangeType::HASH_SHUFFLE:
-        shared_state->exchanger = ShuffleExchanger::create_unique(
+    case ExchangeType::HASH_SHUFFLE: {
+        auto exchanger = ShuffleExchanger::create_unique(
                 std::max(cur_pipe->num_tasks(), _num_instances), _num_instances,
                 use_global_hash_shuffle ? _total_instances : _num_instances,
                 _runtime_state->query_options().__isset.local_exchange_free_blocks_limit
                         ? cast_set<int>(
                                   _runtime_state->query_options().local_exchange_free_blocks_limit)
                         : 0);
+        // Hot partitions can only be spread if partitions map to local instances one by one
+        // and the downstream operator does not need all rows of a key in one instance.
+        const bool tolerate_partition_skew_split =
+                operators.size() > idx ? operators[idx]->tolerate_partition_skew_split()
+                                       : cur_pipe->sink()->tolerate_partition_skew_split();
+        if (config::enable_local_shuffle_skew_rebalance && !use_global_hash_shuffle &&
+            tolerate_partition_skew_split) {
+            exchanger->enable_skew_rebalance(
+                    config::local_shuffle_min_partition_data_processed_rebalance_threshold,
+                    config::local_shuffle_min_data_processed_rebalance_threshold);
+        }
+        shared_state->exchanger = std::move(exchanger);
         break;
+    }
     case ExchangeType::BUCKET_HASH_SHUFFLE:
         shared_state->exchanger = BucketShuffleExchanger::create_unique(
                 std::max(cur_pipe->num_tasks(), _num_instances), _num_instances, num_buckets,
@@ -1185,13 +1195,23 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
     _pipeline_parent_map.pop(cur_pipe, parent_idx, child_idx);
     std::stringstream error_msg;
     bool enable_query_cache = request.fragment.__isset.query_cache_param;
+    // If the query cache param is set on a hash join, the build block of the join is cached
+    // instead of the result of the scans.
+    bool cache_join_build =
+            enable_query_cache &&
+            std::any_of(request.fragment.plan.nodes.begin(), request.fragment.plan.nodes.end(),
+                        [&](const TPlanNode& node) {
+                            return node.node_type == TPlanNodeType::HASH_JOIN_NODE &&
+                                   node.node_id == request.fragment.query_cache_param.node_id;
+                        });
 
     bool fe_with_old_version = false;
     switch (tnode.node_type) {
     case TPlanNodeType::OLAP_SCAN_NODE: {
-        op.reset(new OlapScanOperatorX(
-                pool, tnode, next_operator_id(), descs, _num_instances,
-                enable_query_cache ? request.fragment.query_cache_param : TQueryCacheParam {}));
+        op.reset(new OlapScanOperatorX(pool, tnode, next_operator_id(), descs, _num_instances,
+                                       enable_query_cache && !cache_join_build
+                                               ? request.fragment.query_cache_param
+                                               : TQueryCacheParam {}));
         RETURN_IF_ERROR(cur_pipe->add_operator(
                 op, request.__isset.parallel_instances ? request.parallel_instances : 0));
         fe_with_old_version = !tnode.__isset.is_serial_operator;
@@ -1257,7 +1277,8 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
             auto cache_node_id = request.local_params[0].per_node_scan_ranges.begin()->first;
             auto cache_source_id = next_operator_id();
             op.reset(new CacheSourceOperatorX(pool, cache_node_id, cache_source_id,
-                                              request.fragment.query_cache_param));
+                                              request.fragment.query_cache_param,
+                                              !tnode.agg_node.need_finalize));
             RETURN_IF_ERROR(cur_pipe->add_operator(
                     op, request.__isset.parallel_instances ? request.parallel_instances : 0));
 
@@ -1434,9 +1455,12 @@ Status PipelineFragmentContext::_create_operator(ObjectPool* pool, const TPlanNo
             PipelinePtr build_side_pipe = add_pipeline(cur_pipe);
             _dag[downstream_pipeline_id].push_back(build_side_pipe->id());
 
-            DataSinkOperatorPtr sink;
-            sink.reset(new HashJoinBuildSinkOperatorX(pool, next_sink_operator_id(),
-                                                      op->operator_id(), tnode, descs));
+            auto build_sink = std::make_shared<HashJoinBuildSinkOperatorX>(
+                    pool, next_sink_operator_id(), op->operator_id(), tnode, descs);
+            if (cache_join_build && tnode.node_id == request.fragment.query_cache_param.node_id) {
+                build_sink->set_query_cache_param(request.fragment.query_cache_param);
+            }
+            DataSinkOperatorPtr sink = build_sink;
             RETURN_IF_ERROR(build_side_pipe->set_sink(sink));
             RETURN_IF_ERROR(build_side_pipe->sink()->init(tnode, _runtime_state.get()));
 
@@ -25,6 +25,7 @@
 #include <ostream>
 #include <vector>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
@@ -44,6 +45,7 @@
 #include "util/mem_info.h"
 #include "util/runtime_profile.h"
 #include "util/uid_util.h"
+#include "vec/common/column_buffer_pool.h"
 #include "vec/core/block.h"
 #include "vec/spill/spill_stream.h"
 
@@ -229,13 +231,42 @@ void PipelineTask::_init_profile() {
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
+    _same_numa_node_steal_counts =
+            ADD_COUNTER_WITH_LEVEL(_task_profile, "NumSameNumaNodeStealTimes", TUnit::UNIT, 1);
+    _cross_numa_node_steal_counts =
+            ADD_COUNTER_WITH_LEVEL(_task_profile, "NumCrossNumaNodeStealTimes", TUnit::UNIT, 1);
+    _core_affinity_hit_counts =
+            ADD_COUNTER_WITH_LEVEL(_task_profile, "NumCoreAffinityHitTimes", TUnit::UNIT, 1);
+    _core_affinity_miss_counts =
+            ADD_COUNTER_WITH_LEVEL(_task_profile, "NumCoreAffinityMissTimes", TUnit::UNIT, 1);
     _memory_reserve_times = ADD_COUNTER(_task_profile, "MemoryReserveTimes", TUnit::UNIT);
     _memory_reserve_failed_times =
             ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
+    if (config::enable_pipeline_task_perf_counters) {
+        _perf_cycles_counter = ADD_COUNTER(_task_profile, "PerfCpuCycles", TUnit::UNIT);
+        _perf_instructions_counter = ADD_COUNTER(_task_profile, "PerfInstructions", TUnit::UNIT);
+        _perf_llc_misses_counter = ADD_COUNTER(_task_profile, "PerfLLCMisses", TUnit::UNIT);
+        _perf_branch_misses_counter = ADD_COUNTER(_task_profile, "PerfBranchMisses", TUnit::UNIT);
+    }
+}
+
+void PipelineTask::_update_perf_counters(const ThreadPerfCounters::Values& start) {
+    ThreadPerfCounters::Values end;
+    if (!ThreadPerfCounters::read(&end)) {
+        return;
+    }
+    COUNTER_UPDATE(_perf_cycles_counter, end.cycles - start.cycles);
+    COUNTER_UPDATE(_perf_instructions_counter, end.instructions - start.instructions);
+    COUNTER_UPDATE(_perf_llc_misses_counter, end.llc_misses - start.llc_misses);
+    COUNTER_UPDATE(_perf_branch_misses_counter, end.branch_misses - start.branch_misses);
 }
 
 void PipelineTask::_fresh_profile_counter() {
     COUNTER_SET(_schedule_counts, (int64_t)_schedule_time);
+    COUNTER_SET(_same_numa_node_steal_counts, (int64_t)_same_numa_node_steal_times);
+    COUNTER_SET(_cross_numa_node_steal_counts, (int64_t)_cross_numa_node_steal_times);
+    COUNTER_SET(_core_affinity_hit_counts, (int64_t)_core_affinity_hit_times);
+    COUNTER_SET(_core_affinity_miss_counts, (int64_t)_core_affinity_miss_times);
     COUNTER_SET(_wait_worker_timer, (int64_t)_wait_worker_watcher.elapsed_time());
 }
 
@@ -373,13 +404,22 @@ Status PipelineTask::execute(bool* done) {
     int64_t time_spent = 0;
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    // A task runs on one worker thread during an execution, so the counters of the thread
+    // count the work of the task.
+    ThreadPerfCounters::Values perf_start;
+    const bool perf_started =
+            _perf_cycles_counter != nullptr && ThreadPerfCounters::read(&perf_start);
     SCOPED_ATTACH_TASK(_state);
+    vectorized::ColumnBufferPool::Scope column_buffer_pool_scope;
     Defer running_defer {[&]() {
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
         int64_t delta_cpu_time = cpu_time_stop_watch.elapsed_time();
         _task_cpu_timer->update(delta_cpu_time);
+        if (perf_started) {
+            _update_perf_counters(perf_start);
+        }
         fragment_context->get_query_ctx()->resource_ctx()->cpu_context()->update_cpu_cost_ms(
                 delta_cpu_time);
 
@@ -810,6 +850,10 @@ Status PipelineTask::wake_up(Dependency* dep) {
     // call by dependency
     DCHECK_EQ(_blocked_dep, dep) << "dep : " << dep->debug_string(0) << "task: " << debug_string();
     _blocked_dep = nullptr;
+    auto* tracer = ExecEnv::GetInstance()->pipeline_tracer_context();
+    if (tracer != nullptr && tracer->enabled()) [[unlikely]] {
+        _wake_up_flow_id = tracer->record_flow_start(_query_id, dep->name());
+    }
     auto holder = std::dynamic_pointer_cast<PipelineTask>(shared_from_this());
     RETURN_IF_ERROR(_state_transition(PipelineTask::State::RUNNABLE));
     RETURN_IF_ERROR(get_task_queue()->push_back(holder));
@@ -20,12 +20,14 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
@@ -146,6 +148,28 @@ public:
 
     void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
 
+    // Called when a runnable task is put back to the queue of the worker that ran it last time
+    // (hit), or to another worker because that queue is too long (miss).
+    void inc_core_affinity_times(bool hit) {
+        if (hit) {
+            _core_affinity_hit_times++;
+        } else {
+            _core_affinity_miss_times++;
+        }
+    }
+
+    // Called by the worker which steals this task from the queue of another worker.
+    void inc_steal_times(bool same_numa_node) {
+        if (same_numa_node) {
+            _same_numa_node_steal_times++;
+        } else {
+            _cross_numa_node_steal_times++;
+        }
+    }
+
+    // Flow id of pipeline tracing recorded by the dependency which woke this task up last time.
+    uint64_t take_wake_up_flow_id() { return std::exchange(_wake_up_flow_id, 0); }
+
     bool is_running() { return _running.load(); }
     bool is_revoking() const;
     PipelineTask& set_running(bool running) {
@@ -181,6 +205,7 @@ private:
     Status _extract_dependencies();
     void _init_profile();
     void _fresh_profile_counter();
+    void _update_perf_counters(const ThreadPerfCounters::Values& start);
     Status _open();
     Status _prepare();
 
@@ -195,6 +220,11 @@ private:
     RuntimeState* _state = nullptr;
     int _core_id = -1;
     uint32_t _schedule_time = 0;
+    uint32_t _same_numa_node_steal_times = 0;
+    uint32_t _cross_numa_node_steal_times = 0;
+    uint32_t _core_affinity_hit_times = 0;
+    uint32_t _core_affinity_miss_times = 0;
+    uint64_t _wake_up_flow_id = 0;
     std::unique_ptr<vectorized::Block> _block;
 
     std::weak_ptr<PipelineFragmentContext> _fragment_context;
@@ -226,8 +256,17 @@ private:
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
+    RuntimeProfile::Counter* _same_numa_node_steal_counts = nullptr;
+    RuntimeProfile::Counter* _cross_numa_node_steal_counts = nullptr;
+    RuntimeProfile::Counter* _core_affinity_hit_counts = nullptr;
+    RuntimeProfile::Counter* _core_affinity_miss_counts = nullptr;
     RuntimeProfile::Counter* _memory_reserve_times = nullptr;
     RuntimeProfile::Counter* _memory_reserve_failed_times = nullptr;
+    // The hardware counters of the executions, only if enable_pipeline_task_perf_counters.
+    RuntimeProfile::Counter* _perf_cycles_counter = nullptr;
+    RuntimeProfile::Counter* _perf_instructions_counter = nullptr;
+    RuntimeProfile::Counter* _perf_llc_misses_counter = nullptr;
+    RuntimeProfile::Counter* _perf_branch_misses_counter = nullptr;
 
     Operators _operators; // left is _source, right is _root
     OperatorXBase* _source;
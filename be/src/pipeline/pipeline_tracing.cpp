@@ -19,13 +19,18 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
+#include <map>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -39,19 +44,46 @@ void PipelineTracerContext::record(ScheduleRecord record) {
     if (_dump_type == RecordType::None) [[unlikely]] {
         return;
     }
+    _get_or_create_traces(record.query_id)->schedule_records.enqueue(record);
+}
 
+uint64_t PipelineTracerContext::record_flow_start(TUniqueId query_id, std::string name) {
+    if (_dump_type == RecordType::None) [[unlikely]] {
+        return 0;
+    }
+    auto flow_id = _next_flow_id.fetch_add(1, std::memory_order_relaxed);
+    _record_flow({query_id, std::move(name), flow_id, current_tracing_thread_id(),
+                  MonotonicMicros(), false});
+    return flow_id;
+}
+
+void PipelineTracerContext::record_flow_end(TUniqueId query_id, std::string name,
+                                            uint64_t flow_id) {
+    if (_dump_type == RecordType::None || flow_id == 0) [[unlikely]] {
+        return;
+    }
+    _record_flow({query_id, std::move(name), flow_id, current_tracing_thread_id(),
+                  MonotonicMicros(), true});
+}
+
+void PipelineTracerContext::_record_flow(FlowRecord record) {
+    _get_or_create_traces(record.query_id)->flow_records.enqueue(std::move(record));
+}
+
+OneQueryTracesSPtr PipelineTracerContext::_get_or_create_traces(const TUniqueId& query_id) {
     auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
-    auto it = map_ptr->find({record.query_id});
+    auto it = map_ptr->find({query_id});
     if (it != map_ptr->end()) {
-        it->second->enqueue(record);
-    } else {
-        _update([&](QueryTracesMap& new_map) {
-            if (!new_map.contains({record.query_id})) {
-                new_map[{record.query_id}].reset(new OneQueryTraces());
-            }
-            new_map[{record.query_id}]->enqueue(record);
-        });
+        return it->second;
     }
+    OneQueryTracesSPtr traces;
+    _update([&](QueryTracesMap& new_map) {
+        if (!new_map.contains({query_id})) {
+            new_map[{query_id}] = std::make_shared<OneQueryTraces>();
+        }
+        traces = new_map[{query_id}];
+    });
+    return traces;
 }
 
 void PipelineTracerContext::_update(std::function<void(QueryTracesMap&)>&& handler) {
@@ -101,6 +133,17 @@ Status PipelineTracerContext::change_record_params(
         }
     }
 
+    if (auto it = params.find("format"); it != params.end()) {
+        if (boost::iequals(it->second, "text")) {
+            _dump_format = RecordFormat::Text;
+            effective = true;
+        } else if (boost::iequals(it->second, "chrome") ||
+                   boost::iequals(it->second, "perfetto")) {
+            _dump_format = RecordFormat::ChromeTrace;
+            effective = true;
+        }
+    }
+
     if (auto it = params.find("dump_interval"); it != params.end()) {
         _dump_interval_s = std::stoll(it->second); // s as unit
         effective = true;
@@ -111,9 +154,15 @@ Status PipelineTracerContext::change_record_params(
                                "No qualified param in changing tracing record method");
 }
 
-void PipelineTracerContext::_dump_query(TUniqueId query_id) {
-    auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
-    auto path = _log_dir / fmt::format("query{}", to_string(query_id));
+uint64_t PipelineTracerContext::_workload_group_of(const TUniqueId& query_id) {
+    std::unique_lock<std::mutex> l(_tg_lock);
+    auto it = _id_to_workload_group.find(query_id);
+    return it == _id_to_workload_group.end() ? 0 : it->second;
+}
+
+void PipelineTracerContext::_write_traces(
+        const std::filesystem::path& path,
+        const std::vector<std::pair<TUniqueId, OneQueryTracesSPtr>>& queries) {
     int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
                     S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
     if (fd < 0) [[unlikely]] {
@@ -122,23 +171,125 @@ void PipelineTracerContext::_dump_query(TUniqueId query_id) {
     }
     auto writer = io::LocalFileWriter {path, fd};
 
-    ScheduleRecord record;
-    while ((*map_ptr)[QueryID {query_id}]->try_dequeue(record)) {
-        uint64_t v = 0;
-        {
-            std::unique_lock<std::mutex> l(_tg_lock);
-            v = _id_to_workload_group.at(query_id);
+    if (_dump_format == RecordFormat::Text) {
+        for (const auto& [query_id, traces] : queries) {
+            auto v = _workload_group_of(query_id);
+            ScheduleRecord record;
+            while (traces->schedule_records.try_dequeue(record)) {
+                auto tmp_str = record.to_string(v);
+                auto text = Slice {tmp_str};
+                THROW_IF_ERROR(writer.appendv(&text, 1));
+            }
+        }
+        THROW_IF_ERROR(writer.close());
+        return;
+    }
+
+    // Chrome trace event format. Each workload group is a process and each thread is a track.
+    // Flow arrows link the thread waking up a task (or sending an RPC) to the task (or callback).
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> json(buffer);
+    std::map<std::pair<uint64_t, uint64_t>, std::string> thread_names;
+    auto write_common = [&](const char* name, const char* category, const char* phase,
+                            uint64_t pid, uint64_t tid, uint64_t ts) {
+        json.Key("name");
+        json.String(name);
+        json.Key("cat");
+        json.String(category);
+        json.Key("ph");
+        json.String(phase);
+        json.Key("pid");
+        json.Uint64(pid);
+        json.Key("tid");
+        json.Uint64(tid);
+        json.Key("ts");
+        json.Uint64(ts);
+    };
+    auto write_flow = [&](bool is_end, uint64_t flow_id, uint64_t pid, uint64_t tid, uint64_t ts) {
+        json.StartObject();
+        write_common("flow", "flow", is_end ? "f" : "s", pid, tid, ts);
+        json.Key("id");
+        json.Uint64(flow_id);
+        if (is_end) {
+            // Bind to the slice enclosing `ts` instead of the next slice.
+            json.Key("bp");
+            json.String("e");
+        }
+        json.EndObject();
+    };
+
+    json.StartObject();
+    json.Key("traceEvents");
+    json.StartArray();
+    for (const auto& [query_id, traces] : queries) {
+        auto pid = _workload_group_of(query_id);
+        auto query_id_str = doris::to_string(query_id);
+        ScheduleRecord record;
+        while (traces->schedule_records.try_dequeue(record)) {
+            thread_names[{pid, record.thread_id}] =
+                    fmt::format("pipeline_worker_{}", record.core_id);
+            json.StartObject();
+            write_common(record.task_id.c_str(), "pipeline_task", "X", pid, record.thread_id,
+                         record.start_time);
+            json.Key("dur");
+            json.Uint64(record.end_time - record.start_time);
+            json.Key("args");
+            json.StartObject();
+            json.Key("query_id");
+            json.String(query_id_str.c_str());
+            json.EndObject();
+            json.EndObject();
+            if (record.wake_up_flow_id != 0) {
+                write_flow(true, record.wake_up_flow_id, pid, record.thread_id, record.start_time);
+            }
+        }
+        FlowRecord flow;
+        while (traces->flow_records.try_dequeue(flow)) {
+            thread_names.emplace(std::make_pair(pid, flow.thread_id),
+                                 fmt::format("thread_{}", flow.thread_id));
+            // Flow events must be enclosed by a slice, so mark the flow end point with a tiny one.
+            json.StartObject();
+            write_common(flow.name.c_str(), "flow", "X", pid, flow.thread_id, flow.time);
+            json.Key("dur");
+            json.Uint64(1);
+            json.Key("args");
+            json.StartObject();
+            json.Key("query_id");
+            json.String(query_id_str.c_str());
+            json.EndObject();
+            json.EndObject();
+            write_flow(flow.is_end, flow.flow_id, pid, flow.thread_id, flow.time);
         }
-        auto tmp_str = record.to_string(v);
-        auto text = Slice {tmp_str};
-        THROW_IF_ERROR(writer.appendv(&text, 1));
     }
+    for (const auto& [pid_and_tid, thread_name] : thread_names) {
+        json.StartObject();
+        write_common("thread_name", "__metadata", "M", pid_and_tid.first, pid_and_tid.second, 0);
+        json.Key("args");
+        json.StartObject();
+        json.Key("name");
+        json.String(thread_name.c_str());
+        json.EndObject();
+        json.EndObject();
+    }
+    json.EndArray();
+    json.EndObject();
 
+    auto text = Slice {buffer.GetString(), buffer.GetSize()};
+    THROW_IF_ERROR(writer.appendv(&text, 1));
     THROW_IF_ERROR(writer.close());
+}
+
+void PipelineTracerContext::_dump_query(TUniqueId query_id) {
+    auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
+    auto it = map_ptr->find(QueryID {query_id});
+    if (it != map_ptr->end()) {
+        auto path = _log_dir / fmt::format("query{}{}", to_string(query_id), _file_suffix());
+        _write_traces(path, {{query_id, it->second}});
+    }
 
     _last_dump_time = MonotonicSeconds();
 
-    _update([&](QueryTracesMap& new_map) { _data->erase(QueryID {query_id}); });
+    _update([&](QueryTracesMap& new_map) { new_map.erase(QueryID {query_id}); });
 
     {
         std::unique_lock<std::mutex> l(_tg_lock);
@@ -150,34 +301,20 @@ void PipelineTracerContext::_dump_timeslice() {
     auto new_map = std::make_shared<QueryTracesMap>();
     new_map.swap(_data);
     //TODO: if long time, per timeslice per file
-    auto path = _log_dir /
-                fmt::format("until{}", std::chrono::steady_clock::now().time_since_epoch().count());
-    int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
-                    S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
-    if (fd < 0) [[unlikely]] {
-        throw Exception(Status::Error<ErrorCode::CREATE_FILE_ERROR>(
-                "create tracing log file {} failed", path.c_str()));
-    }
-    auto writer = io::LocalFileWriter {path, fd};
+    auto path = _log_dir / fmt::format("until{}{}",
+                                       std::chrono::steady_clock::now().time_since_epoch().count(),
+                                       _file_suffix());
 
     // dump all query traces in this time window to one file.
+    std::vector<std::pair<TUniqueId, OneQueryTracesSPtr>> queries;
     for (auto& [query_id, trace] : (*new_map)) {
-        ScheduleRecord record;
-        while (trace->try_dequeue(record)) {
-            uint64_t v = 0;
-            {
-                std::unique_lock<std::mutex> l(_tg_lock);
-                v = _id_to_workload_group.at(query_id.query_id);
-            }
-            auto tmp_str = record.to_string(v);
-            auto text = Slice {tmp_str};
-            THROW_IF_ERROR(writer.appendv(&text, 1));
-        }
+        queries.emplace_back(query_id.query_id, trace);
     }
-    THROW_IF_ERROR(writer.close());
+    _write_traces(path, queries);
 
     _last_dump_time = MonotonicSeconds();
 
+    std::unique_lock<std::mutex> l(_tg_lock);
     _id_to_workload_group.clear();
 }
 } // namespace doris::pipeline
@@ -22,8 +22,10 @@
 #include <gen_cpp/Types_types.h>
 #include <parallel_hashmap/phmap.h>
 
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
+#include <thread>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -32,6 +34,11 @@
 
 namespace doris::pipeline {
 
+inline uint64_t current_tracing_thread_id() {
+    std::thread::id tid = std::this_thread::get_id();
+    return *reinterpret_cast<uint64_t*>(&tid);
+}
+
 struct ScheduleRecord {
     TUniqueId query_id;
     std::string task_id;
@@ -39,6 +46,8 @@ struct ScheduleRecord {
     uint64_t thread_id;
     uint64_t start_time;
     uint64_t end_time;
+    // Flow started by the dependency which woke this task up. 0 if none.
+    uint64_t wake_up_flow_id = 0;
 
     bool operator<(const ScheduleRecord& rhs) const { return start_time < rhs.start_time; }
     std::string to_string(uint64_t append_value) const {
@@ -56,9 +65,23 @@ struct QueryID {
     bool operator==(const QueryID& query_id_) const { return query_id == query_id_.query_id; }
 };
 
+// One end of a causal link between two threads, e.g. a dependency waking up a task or an
+// exchange RPC and its callback. Exported as flow arrows in chrome trace format.
+struct FlowRecord {
+    TUniqueId query_id;
+    std::string name;
+    uint64_t flow_id;
+    uint64_t thread_id;
+    uint64_t time;
+    bool is_end;
+};
+
 // all tracing datas of ONE specific query
-using OneQueryTraces = moodycamel::ConcurrentQueue<ScheduleRecord>;
-using OneQueryTracesSPtr = std::shared_ptr<moodycamel::ConcurrentQueue<ScheduleRecord>>;
+struct OneQueryTraces {
+    moodycamel::ConcurrentQueue<ScheduleRecord> schedule_records;
+    moodycamel::ConcurrentQueue<FlowRecord> flow_records;
+};
+using OneQueryTracesSPtr = std::shared_ptr<OneQueryTraces>;
 using QueryTracesMap = std::map<QueryID, OneQueryTracesSPtr>;
 
 // belongs to exec_env, for all query, if enabled
@@ -70,7 +93,16 @@ public:
         PerQuery, // record per query. one query one file.
         Periodic  // record per times. one timeslice one file.
     };
+    enum class RecordFormat {
+        Text,       // one schedule record per line.
+        ChromeTrace // chrome trace event json, which could be opened by perfetto ui.
+    };
     void record(ScheduleRecord record); // record one schedule record
+    // Record the start of a flow on current thread and return its id.
+    uint64_t record_flow_start(TUniqueId query_id, std::string name);
+    // Record the end of a flow on current thread. Only used for flows not ended by a schedule
+    // record.
+    void record_flow_end(TUniqueId query_id, std::string name, uint64_t flow_id);
     void end_query(TUniqueId query_id,
                    uint64_t workload_group); // tell context this query is end. may leads to dump.
     Status change_record_params(const std::map<std::string, std::string>& params);
@@ -82,6 +114,15 @@ private:
     void _dump_query(TUniqueId query_id);
     void _dump_timeslice();
     void _update(std::function<void(QueryTracesMap&)>&& handler);
+    OneQueryTracesSPtr _get_or_create_traces(const TUniqueId& query_id);
+    void _record_flow(FlowRecord record);
+    uint64_t _workload_group_of(const TUniqueId& query_id);
+    const char* _file_suffix() const {
+        return _dump_format == RecordFormat::ChromeTrace ? ".json" : "";
+    }
+    // Write all traces of `queries` into file `path` in `_dump_format`.
+    void _write_traces(const std::filesystem::path& path,
+                       const std::vector<std::pair<TUniqueId, OneQueryTracesSPtr>>& queries);
 
     std::filesystem::path _log_dir = fmt::format("{}/pipe_tracing", getenv("LOG_DIR"));
 
@@ -91,6 +132,8 @@ private:
             _id_to_workload_group; // save query's workload group number
 
     RecordType _dump_type = RecordType::None;
+    RecordFormat _dump_format = RecordFormat::Text;
+    std::atomic<uint64_t> _next_flow_id = 1;
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
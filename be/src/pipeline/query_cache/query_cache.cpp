@@ -53,12 +53,14 @@ void QueryCache::insert(const CacheKey& key, int64_t version, CacheResult& res,
                                                   cache_size, CachePriority::NORMAL));
 }
 
-bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheHandle* handle) {
+bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheHandle* handle,
+                        bool older_version) {
     SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(ExecEnv::GetInstance()->query_cache_mem_tracker());
     auto* lru_handle = LRUCachePolicy::lookup(key);
     if (lru_handle) {
         QueryCacheHandle tmp_handle(this, lru_handle);
-        if (tmp_handle.get_cache_version() == version) {
+        if (older_version ? tmp_handle.get_cache_version() < version
+                          : tmp_handle.get_cache_version() == version) {
             *handle = std::move(tmp_handle);
             return true;
         }
@@ -66,4 +68,22 @@ bool QueryCache::lookup(const CacheKey& key, int64_t version, doris::QueryCacheH
     return false;
 }
 
+void QueryCache::register_incremental_reuse(const std::string& instance_key,
+                                            std::shared_ptr<IncrementalReuse> reuse) {
+    std::lock_guard lock(_reuse_mutex);
+    _incremental_reuses[instance_key] = std::move(reuse);
+}
+
+std::shared_ptr<QueryCache::IncrementalReuse> QueryCache::find_incremental_reuse(
+        const std::string& instance_key) {
+    std::lock_guard lock(_reuse_mutex);
+    auto it = _incremental_reuses.find(instance_key);
+    return it == _incremental_reuses.end() ? nullptr : it->second;
+}
+
+void QueryCache::unregister_incremental_reuse(const std::string& instance_key) {
+    std::lock_guard lock(_reuse_mutex);
+    _incremental_reuses.erase(instance_key);
+}
+
 } // namespace doris
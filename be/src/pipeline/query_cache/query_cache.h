@@ -24,8 +24,10 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <roaring/roaring.hh>
 #include <string>
+#include <unordered_map>
 
 #include "common/config.h"
 #include "common/status.h"
@@ -144,9 +146,31 @@ public:
             : LRUCachePolicy(CachePolicy::CacheType::QUERY_CACHE, capacity, LRUCacheType::SIZE,
                              3600 * 24, num_shards) {}
 
-    bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle);
+    // Finds the entry of `version`. If `older_version` is true, finds the entry older than
+    // `version` instead, whose partial result can be combined with the partial result of the
+    // rowsets newer than it.
+    bool lookup(const CacheKey& key, int64_t version, QueryCacheHandle* handle,
+                bool older_version = false);
 
     void insert(const CacheKey& key, int64_t version, CacheResult& result,
                 const std::vector<int>& solt_orders, int64_t cache_size);
+
+    // The reuse of an older entry by a fragment instance. The cache source registers it before
+    // the scan prepares, and the scan accepts it if the rowsets in (base_version, version] of the
+    // tablet can be scanned without the older ones.
+    struct IncrementalReuse {
+        explicit IncrementalReuse(int64_t v) : base_version(v) {}
+        const int64_t base_version;
+        std::atomic_bool accepted = false;
+    };
+
+    void register_incremental_reuse(const std::string& instance_key,
+                                    std::shared_ptr<IncrementalReuse> reuse);
+    std::shared_ptr<IncrementalReuse> find_incremental_reuse(const std::string& instance_key);
+    void unregister_incremental_reuse(const std::string& instance_key);
+
+private:
+    std::mutex _reuse_mutex;
+    std::unordered_map<std::string, std::shared_ptr<IncrementalReuse>> _incremental_reuses;
 };
 } // namespace doris
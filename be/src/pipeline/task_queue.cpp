@@ -18,18 +18,30 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/time.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
 
 PipelineTaskSPtr SubTaskQueue::try_take(bool is_steal) {
+    if (_lock_free) {
+        PipelineTaskSPtr task;
+        if (_size.load() == 0 || !_lock_free_queue.try_dequeue(task)) {
+            return nullptr;
+        }
+        _size.fetch_sub(1);
+        return task;
+    }
     if (_queue.empty()) {
         return nullptr;
     }
@@ -40,16 +52,20 @@ PipelineTaskSPtr SubTaskQueue::try_take(bool is_steal) {
 
 ////////////////////  PriorityTaskQueue ////////////////////
 
-PriorityTaskQueue::PriorityTaskQueue() : _closed(false) {
+PriorityTaskQueue::PriorityTaskQueue()
+        : PriorityTaskQueue(config::enable_lock_free_pipeline_task_queue) {}
+
+PriorityTaskQueue::PriorityTaskQueue(bool lock_free) : _closed(false), _lock_free(lock_free) {
     double factor = 1;
     for (int i = SUB_QUEUE_LEVEL - 1; i >= 0; i--) {
         _sub_queues[i].set_level_factor(factor);
+        _sub_queues[i].set_lock_free(_lock_free);
         factor *= LEVEL_QUEUE_TIME_FACTOR;
     }
 }
 
 void PriorityTaskQueue::close() {
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    std::unique_lock lock(_work_size_mutex);
     _closed = true;
     _wait_task.notify_all();
     DorisMetrics::instance()->pipeline_task_queue_size->increment(-_total_task_size);
@@ -92,14 +108,78 @@ int PriorityTaskQueue::_compute_level(uint64_t runtime) {
     return SUB_QUEUE_LEVEL - 1;
 }
 
+PipelineTaskSPtr PriorityTaskQueue::_try_take_lock_free(bool is_steal) {
+    // Other workers may take tasks concurrently, so the chosen level may become empty before
+    // we dequeue from it. Retry with the remaining levels in that case.
+    bool tried[SUB_QUEUE_LEVEL] = {false};
+    for (int retry = 0; retry < SUB_QUEUE_LEVEL; ++retry) {
+        if (_total_task_size.load() == 0 || _closed) {
+            return nullptr;
+        }
+        double min_vruntime = 0;
+        int level = -1;
+        for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+            double cur_queue_vruntime = _sub_queues[i].get_vruntime();
+            if (!tried[i] && !_sub_queues[i].empty()) {
+                if (level == -1 || cur_queue_vruntime < min_vruntime) {
+                    level = i;
+                    min_vruntime = cur_queue_vruntime;
+                }
+            }
+        }
+        if (level == -1) {
+            return nullptr;
+        }
+        tried[level] = true;
+        _queue_level_min_vruntime = uint64_t(min_vruntime);
+
+        auto task = _sub_queues[level].try_take(is_steal);
+        if (task) {
+            task->update_queue_level(level);
+            _total_task_size--;
+            DorisMetrics::instance()->pipeline_task_queue_size->increment(-1);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTaskSPtr PriorityTaskQueue::_take_lock_free(uint32_t timeout_ms) {
+    auto task = _try_take_lock_free(false);
+    if (task) {
+        return task;
+    }
+    std::unique_lock lock(_work_size_mutex);
+    // Register as a waiter before checking the queue again, so that a concurrent `push`
+    // either sees the waiter and notifies it, or its task is seen here.
+    _num_waiters++;
+    task = _try_take_lock_free(false);
+    if (!task && !_closed) {
+        if (timeout_ms > 0) {
+            _wait_task.wait_for(lock, std::chrono::milliseconds(timeout_ms));
+        } else {
+            _wait_task.wait(lock);
+        }
+    }
+    _num_waiters--;
+    lock.unlock();
+    return task ? task : _try_take_lock_free(false);
+}
+
 PipelineTaskSPtr PriorityTaskQueue::try_take(bool is_steal) {
+    if (_lock_free) {
+        return _try_take_lock_free(is_steal);
+    }
     // TODO other efficient lock? e.g. if get lock fail, return null_ptr
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    std::unique_lock lock(_work_size_mutex);
     return _try_take_unprotected(is_steal);
 }
 
 PipelineTaskSPtr PriorityTaskQueue::take(uint32_t timeout_ms) {
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    if (_lock_free) {
+        return _take_lock_free(timeout_ms);
+    }
+    std::unique_lock lock(_work_size_mutex);
     auto task = _try_take_unprotected(false);
     if (task) {
         return task;
@@ -118,7 +198,21 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
         return Status::InternalError("WorkTaskQueue closed");
     }
     auto level = _compute_level(task->get_runtime_ns());
-    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    if (_lock_free) {
+        if (_sub_queues[level].empty() &&
+            double(_queue_level_min_vruntime) > _sub_queues[level].get_vruntime()) {
+            _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
+        }
+        _sub_queues[level].push_back(std::move(task));
+        _total_task_size++;
+        DorisMetrics::instance()->pipeline_task_queue_size->increment(1);
+        if (_num_waiters.load() > 0) {
+            std::unique_lock lock(_work_size_mutex);
+            _wait_task.notify_one();
+        }
+        return Status::OK();
+    }
+    std::unique_lock lock(_work_size_mutex);
 
     // update empty queue's  runtime, to avoid too high priority
     if (_sub_queues[level].empty() &&
@@ -136,7 +230,50 @@ Status PriorityTaskQueue::push(PipelineTaskSPtr task) {
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
 MultiCoreTaskQueue::MultiCoreTaskQueue(int core_size)
-        : _prio_task_queues(core_size), _closed(false), _core_size(core_size) {}
+        : _prio_task_queues(core_size),
+          _closed(false),
+          _core_size(core_size),
+          _local_steal_fail_since_ns(core_size, 0) {
+    _init_numa_groups();
+}
+
+void MultiCoreTaskQueue::_init_numa_groups() {
+    // Workers are split into contiguous ranges, one range per NUMA node, in proportion to
+    // the number of cpu cores of every node.
+    int num_nodes = std::max(1, CpuInfo::get_max_num_numa_nodes());
+    std::vector<size_t> weights(num_nodes, 1);
+    size_t total_weight = num_nodes;
+    if (num_nodes > 1) {
+        total_weight = 0;
+        for (int node = 0; node < num_nodes; ++node) {
+            weights[node] = CpuInfo::get_cores_of_numa_node(node).size();
+            total_weight += weights[node];
+        }
+    }
+    if (total_weight == 0 || num_nodes > _core_size) {
+        num_nodes = 1;
+        weights.assign(1, 1);
+        total_weight = 1;
+    }
+
+    _core_to_numa_node.resize(_core_size);
+    size_t acc_weight = 0;
+    for (int node = 0, core = 0; node < num_nodes; ++node) {
+        acc_weight += weights[node];
+        int end = node == num_nodes - 1
+                          ? _core_size
+                          : cast_set<int>(acc_weight * _core_size / total_weight);
+        if (end <= core) {
+            continue;
+        }
+        _numa_node_cores.emplace_back();
+        _numa_node_ids.push_back(node);
+        for (; core < end; ++core) {
+            _core_to_numa_node[core] = cast_set<int>(_numa_node_cores.size()) - 1;
+            _numa_node_cores.back().push_back(core);
+        }
+    }
+}
 
 void MultiCoreTaskQueue::close() {
     if (_closed) {
@@ -158,42 +295,110 @@ PipelineTaskSPtr MultiCoreTaskQueue::take(int core_id) {
         if (task) {
             break;
         }
-        task = _steal_take(core_id);
+        bool cross_numa_deferred = false;
+        task = _steal_take(core_id, &cross_numa_deferred);
         if (task) {
             break;
         }
-        task = _prio_task_queues[core_id].take(WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
+        // Do not sleep too long if the worker is waiting to steal from other NUMA nodes.
+        uint32_t timeout_ms =
+                cross_numa_deferred
+                        ? std::clamp<uint32_t>(config::pipeline_task_cross_numa_steal_delay_ms,
+                                               1, WAIT_CORE_TASK_TIMEOUT_MS)
+                        : WAIT_CORE_TASK_TIMEOUT_MS;
+        task = _prio_task_queues[core_id].take(timeout_ms);
         if (task) {
             break;
         }
     }
     if (task) {
+        _local_steal_fail_since_ns[core_id] = 0;
         task->pop_out_runnable_queue();
     }
     return task;
 }
 
-PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id) {
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_from(int victim_core, bool same_numa_node) {
+    DCHECK(victim_core < _core_size);
+    auto task = _prio_task_queues[victim_core].try_take(true);
+    if (task) {
+        task->inc_steal_times(same_numa_node);
+    }
+    return task;
+}
+
+PipelineTaskSPtr MultiCoreTaskQueue::_steal_take(int core_id, bool* cross_numa_deferred) {
     DCHECK(core_id < _core_size);
-    int next_id = core_id;
-    for (int i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
-        }
-        DCHECK(next_id < _core_size);
-        auto task = _prio_task_queues[next_id].try_take(true);
-        if (task) {
+    if (!config::enable_numa_aware_task_steal || _numa_node_cores.size() <= 1) {
+        int next_id = core_id;
+        for (int i = 1; i < _core_size; ++i) {
+            ++next_id;
+            if (next_id == _core_size) {
+                next_id = 0;
+            }
+            if (auto task = _steal_from(next_id, true)) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    // 1. steal from the other workers of the same NUMA node
+    const int node = _core_to_numa_node[core_id];
+    const auto& local_cores = _numa_node_cores[node];
+    const auto local_size = local_cores.size();
+    const auto local_pos = std::find(local_cores.begin(), local_cores.end(), core_id) -
+                           local_cores.begin();
+    for (size_t i = 1; i < local_size; ++i) {
+        if (auto task = _steal_from(local_cores[(local_pos + i) % local_size], true)) {
             return task;
         }
     }
+
+    // 2. steal from other NUMA nodes only if the worker has been idle for a while
+    auto& fail_since_ns = _local_steal_fail_since_ns[core_id];
+    const int64_t now = MonotonicNanos();
+    if (fail_since_ns == 0) {
+        fail_since_ns = now;
+    }
+    if (now - fail_since_ns <
+        int64_t(config::pipeline_task_cross_numa_steal_delay_ms) * NANOS_PER_MILLIS) {
+        if (cross_numa_deferred) {
+            *cross_numa_deferred = true;
+        }
+        return nullptr;
+    }
+    const int num_nodes = cast_set<int>(_numa_node_cores.size());
+    for (int i = 1; i < num_nodes; ++i) {
+        for (int victim : _numa_node_cores[(node + i) % num_nodes]) {
+            if (auto task = _steal_from(victim, false)) {
+                return task;
+            }
+        }
+    }
     return nullptr;
 }
 
+int MultiCoreTaskQueue::_select_core(PipelineTask* task, int last_core_id) {
+    const int max_queue_size = config::pipeline_task_core_affinity_max_queue_size;
+    if (max_queue_size >= 0 &&
+        _prio_task_queues[last_core_id].size() <= static_cast<size_t>(max_queue_size)) {
+        // Keep the task on the core whose caches may still hold its hash tables and blocks.
+        task->inc_core_affinity_times(true);
+        return last_core_id;
+    }
+    task->inc_core_affinity_times(false);
+    // The last core is overloaded, move the task to another core of the same NUMA node.
+    const auto& local_cores = _numa_node_cores[_core_to_numa_node[last_core_id]];
+    return local_cores[_next_core.fetch_add(1) % local_cores.size()];
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTaskSPtr task) {
     int core_id = task->get_core_id();
     if (core_id < 0) {
         core_id = _next_core.fetch_add(1) % _core_size;
+    } else {
+        core_id = _select_core(task.get(), core_id);
     }
     return push_back(task, core_id);
 }
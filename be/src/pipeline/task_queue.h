@@ -16,6 +16,7 @@
 // under the License.
 #pragma once
 
+#include <concurrentqueue.h>
 #include <glog/logging.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -28,8 +29,10 @@
 #include <queue>
 #include <set>
 
+#include "common/cast_set.h"
 #include "common/status.h"
 #include "pipeline_task.h"
+#include "util/instrumented_mutex.h"
 
 namespace doris::pipeline {
 #include "common/compile_check_begin.h"
@@ -38,12 +41,21 @@ class SubTaskQueue {
     friend class PriorityTaskQueue;
 
 public:
-    void push_back(PipelineTaskSPtr task) { _queue.emplace(task); }
+    void push_back(PipelineTaskSPtr task) {
+        if (_lock_free) {
+            _lock_free_queue.enqueue(std::move(task));
+            _size.fetch_add(1);
+        } else {
+            _queue.emplace(task);
+        }
+    }
 
     PipelineTaskSPtr try_take(bool is_steal);
 
     void set_level_factor(double level_factor) { _level_factor = level_factor; }
 
+    void set_lock_free(bool lock_free) { _lock_free = lock_free; }
+
     // note:
     // runtime is the time consumed by the actual execution of the task
     // vruntime(means virtual runtime) = runtime / _level_factor
@@ -55,10 +67,15 @@ public:
         this->_runtime = uint64_t(double(vruntime) * _level_factor);
     }
 
-    bool empty() { return _queue.empty(); }
+    bool empty() { return _lock_free ? _size.load() == 0 : _queue.empty(); }
 
 private:
     std::queue<PipelineTaskSPtr> _queue;
+    // used instead of `_queue` in lock free mode, the tasks of one level are not strictly
+    // FIFO if they are pushed by different threads
+    moodycamel::ConcurrentQueue<PipelineTaskSPtr> _lock_free_queue;
+    std::atomic<size_t> _size = 0;
+    bool _lock_free = false;
     // depends on LEVEL_QUEUE_TIME_FACTOR
     double _level_factor = 1;
 
@@ -66,10 +83,16 @@ private:
 };
 
 // A Multilevel Feedback Queue
+//
+// If `enable_lock_free_pipeline_task_queue` is true, tasks are kept in lock-free sub queues:
+// push and take only touch atomics, and `_work_size_mutex` is taken only by a worker which
+// is going to sleep on an empty queue and by the producer which has to wake it up.
 class PriorityTaskQueue {
 public:
     PriorityTaskQueue();
 
+    explicit PriorityTaskQueue(bool lock_free);
+
     void close();
 
     PipelineTaskSPtr try_take(bool is_steal);
@@ -82,27 +105,37 @@ public:
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    size_t size() const { return _total_task_size; }
+
 private:
     PipelineTaskSPtr _try_take_unprotected(bool is_steal);
+    PipelineTaskSPtr _try_take_lock_free(bool is_steal);
+    PipelineTaskSPtr _take_lock_free(uint32_t timeout_ms);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
     // 1s, 3s, 10s, 60s, 300s
     uint64_t _queue_level_limit[SUB_QUEUE_LEVEL - 1] = {1000000000, 3000000000, 10000000000,
                                                         60000000000, 300000000000};
-    std::mutex _work_size_mutex;
-    std::condition_variable _wait_task;
+    InstrumentedMutex _work_size_mutex {"pipeline_task_queue"};
+    std::condition_variable_any _wait_task;
     std::atomic<size_t> _total_task_size = 0;
-    bool _closed;
+    std::atomic<bool> _closed;
+    const bool _lock_free;
+    // number of workers sleeping on `_wait_task`, only used in lock free mode
+    std::atomic<int> _num_waiters = 0;
 
     // used to adjust vruntime of a queue when it's not empty
-    // protected by lock _work_size_mutex
-    uint64_t _queue_level_min_vruntime = 0;
+    // protected by lock _work_size_mutex, or updated atomically in lock free mode
+    std::atomic<uint64_t> _queue_level_min_vruntime = 0;
 
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// Task queues of the workers are grouped by NUMA node. An idle worker steals tasks from
+// the workers of its own node first, and only steals from other nodes after it has been
+// idle for `pipeline_task_cross_numa_steal_delay_ms`, so that the hash tables and blocks
+// of a task tend to stay in the memory of one socket.
 class MultiCoreTaskQueue {
 public:
     explicit MultiCoreTaskQueue(int core_size);
@@ -126,8 +159,24 @@ public:
 
     int cores() const { return _core_size; }
 
+    int numa_nodes() const { return cast_set<int>(_numa_node_cores.size()); }
+
+    // Physical NUMA node which the worker `core_id` belongs to.
+    int numa_node_of_core(int core_id) const {
+        return _numa_node_ids[_core_to_numa_node[core_id]];
+    }
+
 private:
-    PipelineTaskSPtr _steal_take(int core_id);
+    void _init_numa_groups();
+
+    // `cross_numa_deferred` is set to true if stealing from other NUMA nodes is skipped
+    // because the worker has not been idle long enough.
+    PipelineTaskSPtr _steal_take(int core_id, bool* cross_numa_deferred = nullptr);
+
+    PipelineTaskSPtr _steal_from(int victim_core, bool same_numa_node);
+
+    // Choose the worker queue for a runnable task which has run on `last_core_id` before.
+    int _select_core(PipelineTask* task, int last_core_id);
 
     std::vector<PriorityTaskQueue> _prio_task_queues;
     std::atomic<uint32_t> _next_core = 0;
@@ -135,6 +184,16 @@ private:
 
     int _core_size;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
+
+    // worker index -> NUMA node (index of `_numa_node_cores`)
+    std::vector<int> _core_to_numa_node;
+    // NUMA node -> worker indexes in this node
+    std::vector<std::vector<int>> _numa_node_cores;
+    // NUMA node -> physical NUMA node id
+    std::vector<int> _numa_node_ids;
+    // Time (ns) when the worker failed to steal from its own NUMA node for the first time
+    // since it was last busy, 0 means the worker is not idle. Only visited by the worker.
+    std::vector<int64_t> _local_steal_fail_since_ns;
 };
 #include "common/compile_check_end.h"
 } // namespace doris::pipeline
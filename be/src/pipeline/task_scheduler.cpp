@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -35,6 +36,7 @@
 #include <thread>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "pipeline/pipeline_task.h"
@@ -42,6 +44,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -95,7 +98,24 @@ void close_task(PipelineTask* task, Status exec_status, PipelineFragmentContext*
     }
 }
 
+void TaskScheduler::_bind_numa_node(int index) {
+    if (!config::enable_numa_aware_task_steal || _task_queue.numa_nodes() <= 1) {
+        return;
+    }
+    int node = _task_queue.numa_node_of_core(index);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : CpuInfo::get_cores_of_numa_node(node)) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set); ret != 0) {
+        LOG(WARNING) << "failed to bind pipeline worker " << _name << "-" << index
+                     << " to numa node " << node << ", errno: " << ret;
+    }
+}
+
 void TaskScheduler::_do_work(int index) {
+    _bind_numa_node(index);
     while (!_need_to_stop) {
         auto task = _task_queue.take(index);
         if (!task) {
@@ -147,8 +167,8 @@ void TaskScheduler::_do_work(int index) {
                     TUniqueId query_id = fragment_context->get_query_id();
                     std::string task_name = task->task_name();
 
-                    std::thread::id tid = std::this_thread::get_id();
-                    uint64_t thread_id = *reinterpret_cast<uint64_t*>(&tid);
+                    uint64_t thread_id = current_tracing_thread_id();
+                    uint64_t wake_up_flow_id = task->take_wake_up_flow_id();
                     uint64_t start_time = MonotonicMicros();
 
                     status = task->execute(&done);
@@ -156,7 +176,7 @@ void TaskScheduler::_do_work(int index) {
                     uint64_t end_time = MonotonicMicros();
                     ExecEnv::GetInstance()->pipeline_tracer_context()->record(
                             {query_id, task_name, static_cast<uint32_t>(index), thread_id,
-                             start_time, end_time});
+                             start_time, end_time, wake_up_flow_id});
                 } else { status = task->execute(&done); },
                 status);
         fragment_context->trigger_report_if_necessary();
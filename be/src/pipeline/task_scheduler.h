@@ -67,5 +67,8 @@ private:
     std::weak_ptr<CgroupCpuCtl> _cgroup_cpu_ctl;
 
     void _do_work(int index);
+
+    // Bind the worker thread to the cpus of the NUMA node its task queue belongs to.
+    void _bind_numa_node(int index);
 };
 } // namespace doris::pipeline
\ No newline at end of file
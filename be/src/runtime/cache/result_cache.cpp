@@ -19,6 +19,7 @@
 #include <gen_cpp/internal_service.pb.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <iostream>
 #include <list>
 #include <utility>
@@ -128,6 +129,8 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
         node_it = _node_map.find(sql_key);
         if (node_it == _node_map.end()) {
             result->set_status(PCacheStatus::NO_SQL_KEY);
+            DorisMetrics::instance()->query_cache_partition_miss_count->increment(
+                    request->params_size());
             LOG(INFO) << "no such sql key:" << sql_key;
             return;
         }
@@ -152,6 +155,10 @@ void ResultCache::fetch(const PFetchCacheRequest* request, PFetchCacheResult* re
             status = PCacheStatus::EMPTY_DATA;
         }
         result->set_status(status);
+        int64_t hit_count = status == PCacheStatus::CACHE_OK ? result->values_size() : 0;
+        DorisMetrics::instance()->query_cache_partition_hit_count->increment(hit_count);
+        DorisMetrics::instance()->query_cache_partition_miss_count->increment(
+                std::max<int64_t>(request->params_size() - hit_count, 0));
     }
 
     if (hit_first) {
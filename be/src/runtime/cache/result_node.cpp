@@ -45,7 +45,8 @@ void PartitionRowBatch::set_row_batch(const PCacheValue& value) {
     }
     SAFE_DELETE(_cache_value);
     _cache_value = new PCacheValue(value);
-    _data_size += _cache_value->data_size();
+    // the replaced value is released, only the size of the new one is accounted
+    _data_size = _cache_value->data_size();
     _cache_stat.update();
     LOG(INFO) << "finish set row batch, row num:" << _cache_value->rows_size()
               << ", data size:" << _data_size;
@@ -259,19 +260,24 @@ PCacheStatus ResultNode::fetch_partition(const PFetchCacheRequest* request,
                 }
                 end_idx = param_idx;
                 end_it = part_it;
-                param_idx++;
-                part_it++;
-                find = false;
             } else {
+                // An overdue partition is recomputed like a missing one, e.g. only the latest
+                // partition changed, the cached partitions before or after it are still hit.
                 status = PCacheStatus::DATA_OVERDUE;
-                break;
+                if (begin_idx >= 0) {
+                    break;
+                }
             }
+            param_idx++;
+            part_it++;
+            find = false;
         }
     }
 
     if (begin_it == _partition_list.end() && end_it == _partition_list.end()) {
         return status;
     }
+    status = PCacheStatus::CACHE_OK;
 
     //[20191210 - 20191216] hit partition range [20191212-20191214],the sql will be splited to 3 part!
     if (begin_idx != 0 && end_idx != request->params_size() - 1) {
@@ -233,9 +233,15 @@ public:
     std::shared_ptr<MemTrackerLimiter> parquet_meta_tracker() { return _parquet_meta_tracker; }
 
     ThreadPool* send_batch_thread_pool() { return _send_batch_thread_pool.get(); }
+    ThreadPool* block_compression_thread_pool() { return _block_compression_thread_pool.get(); }
     ThreadPool* buffered_reader_prefetch_thread_pool() {
         return _buffered_reader_prefetch_thread_pool.get();
     }
+    ThreadPool* segment_page_prefetch_thread_pool() {
+        return _segment_page_prefetch_thread_pool.get();
+    }
+    ThreadPool* file_cache_read_thread_pool() { return _file_cache_read_thread_pool.get(); }
+    ThreadPool* segment_load_thread_pool() { return _segment_load_thread_pool.get(); }
     ThreadPool* send_table_stats_thread_pool() { return _send_table_stats_thread_pool.get(); }
     ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
@@ -438,8 +444,13 @@ private:
     std::shared_ptr<MemTrackerLimiter> _parquet_meta_tracker;
 
     std::unique_ptr<ThreadPool> _send_batch_thread_pool;
+    std::unique_ptr<ThreadPool> _block_compression_thread_pool;
     // Threadpool used to prefetch remote file for buffered reader
     std::unique_ptr<ThreadPool> _buffered_reader_prefetch_thread_pool;
+    std::unique_ptr<ThreadPool> _segment_page_prefetch_thread_pool;
+    std::unique_ptr<ThreadPool> _file_cache_read_thread_pool;
+    // Threadpool used to open the segments of a rowset concurrently
+    std::unique_ptr<ThreadPool> _segment_load_thread_pool;
     // Threadpool used to send TableStats to FE
     std::unique_ptr<ThreadPool> _send_table_stats_thread_pool;
     // Threadpool used to upload local file to s3
@@ -239,6 +239,12 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(config::send_batch_thread_pool_thread_num)
                               .set_max_queue_size(config::send_batch_thread_pool_queue_size)
                               .build(&_send_batch_thread_pool));
+    if (config::block_compression_thread_pool_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("BlockCompressionThreadPool")
+                                  .set_min_threads(0)
+                                  .set_max_threads(config::block_compression_thread_pool_thread_num)
+                                  .build(&_block_compression_thread_pool));
+    }
 
     auto [buffered_reader_min_threads, buffered_reader_max_threads] =
             get_num_threads(config::num_buffered_reader_prefetch_thread_pool_min_thread,
@@ -248,6 +254,30 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(cast_set<int>(buffered_reader_max_threads))
                               .build(&_buffered_reader_prefetch_thread_pool));
 
+    auto [segment_page_prefetch_min_threads, segment_page_prefetch_max_threads] =
+            get_num_threads(config::num_segment_page_prefetch_thread_pool_min_thread,
+                            config::num_segment_page_prefetch_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("SegmentPagePrefetchThreadPool")
+                              .set_min_threads(cast_set<int>(segment_page_prefetch_min_threads))
+                              .set_max_threads(cast_set<int>(segment_page_prefetch_max_threads))
+                              .build(&_segment_page_prefetch_thread_pool));
+
+    auto [file_cache_read_min_threads, file_cache_read_max_threads] =
+            get_num_threads(config::num_file_cache_read_thread_pool_min_thread,
+                            config::num_file_cache_read_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("FileCacheReadThreadPool")
+                              .set_min_threads(cast_set<int>(file_cache_read_min_threads))
+                              .set_max_threads(cast_set<int>(file_cache_read_max_threads))
+                              .build(&_file_cache_read_thread_pool));
+
+    auto [segment_load_min_threads, segment_load_max_threads] =
+            get_num_threads(config::num_segment_load_thread_pool_min_thread,
+                            config::num_segment_load_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("SegmentLoadThreadPool")
+                              .set_min_threads(cast_set<int>(segment_load_min_threads))
+                              .set_max_threads(cast_set<int>(segment_load_max_threads))
+                              .build(&_segment_load_thread_pool));
+
     static_cast<void>(ThreadPoolBuilder("SendTableStatsThreadPool")
                               .set_min_threads(8)
                               .set_max_threads(32)
@@ -565,7 +595,8 @@ Status ExecEnv::_init_mem_env() {
               << config::file_cache_max_file_reader_cache_size;
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_bytes,
+                                         config::max_external_file_meta_cache_num);
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -768,11 +799,15 @@ void ExecEnv::destroy() {
         _runtime_query_statistics_mgr->stop_report_thread();
     }
     SAFE_SHUTDOWN(_buffered_reader_prefetch_thread_pool);
+    SAFE_SHUTDOWN(_segment_page_prefetch_thread_pool);
+    SAFE_SHUTDOWN(_file_cache_read_thread_pool);
+    SAFE_SHUTDOWN(_segment_load_thread_pool);
     SAFE_SHUTDOWN(_s3_file_upload_thread_pool);
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_s3_file_system_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
+    SAFE_SHUTDOWN(_block_compression_thread_pool);
     SAFE_SHUTDOWN(_send_table_stats_thread_pool);
 
     SAFE_DELETE(_load_channel_mgr);
@@ -826,8 +861,12 @@ void ExecEnv::destroy() {
     _s3_file_system_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
+    _segment_page_prefetch_thread_pool.reset(nullptr);
+    _file_cache_read_thread_pool.reset(nullptr);
+    _segment_load_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
     _send_batch_thread_pool.reset(nullptr);
+    _block_compression_thread_pool.reset(nullptr);
     _write_cooldown_meta_executors.reset(nullptr);
 
     SAFE_DELETE(_broker_client_cache);
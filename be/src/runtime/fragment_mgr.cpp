@@ -243,8 +243,9 @@ template <typename Key, typename Value, typename ValueType>
 ConcurrentContextMap<Key, Value, ValueType>::ConcurrentContextMap() {
     _internal_map.resize(config::num_query_ctx_map_partitions);
     for (size_t i = 0; i < config::num_query_ctx_map_partitions; i++) {
-        _internal_map[i] = {std::make_unique<std::shared_mutex>(),
-                            phmap::flat_hash_map<Key, Value>()};
+        _internal_map[i] = {
+                std::make_unique<InstrumentedSharedMutex>("fragment_mgr_context_map"),
+                phmap::flat_hash_map<Key, Value>()};
     }
 }
 
@@ -39,6 +39,7 @@
 #include "runtime_filter/runtime_filter_mgr.h"
 #include "util/countdown_latch.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
+#include "util/instrumented_mutex.h"
 #include "util/metrics.h"
 
 namespace butil {
@@ -106,7 +107,8 @@ private:
     // in prepare stage, the call path is  prepare --> expr prepare --> may call allocator
     // when allocate failed, allocator may call query_is_cancelled, query is callced will also
     // call _lock, so that there is dead lock.
-    std::vector<std::pair<std::unique_ptr<std::shared_mutex>, phmap::flat_hash_map<Key, Value>>>
+    std::vector<
+            std::pair<std::unique_ptr<InstrumentedSharedMutex>, phmap::flat_hash_map<Key, Value>>>
             _internal_map;
 };
 
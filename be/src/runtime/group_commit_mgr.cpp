@@ -17,9 +17,11 @@
 
 #include "runtime/group_commit_mgr.h"
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -31,12 +33,14 @@
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "util/debug_points.h"
+#include "util/stopwatch.hpp"
 #include "util/thrift_rpc_helper.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
 
 bvar::Adder<uint64_t> group_commit_block_by_memory_counter("group_commit_block_by_memory_counter");
+bvar::LatencyRecorder g_group_commit_interval_ms("group_commit_interval_ms");
 
 std::string LoadBlockQueue::_get_load_ids() {
     std::stringstream ss;
@@ -115,6 +119,14 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
     return Status::OK();
 }
 
+std::pair<int64_t, int64_t> LoadBlockQueue::data_bytes_and_duration_ms() {
+    std::unique_lock l(mutex);
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - _start_time)
+                            .count();
+    return {_data_bytes, duration};
+}
+
 Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block* block,
                                  bool* find_block, bool* eos,
                                  std::shared_ptr<pipeline::Dependency> get_block_dep) {
@@ -386,9 +398,16 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", label=" << label << ", txn_id=" << txn_id
                    << ", instance_id=" << print_id(instance_id);
         {
+            int64_t interval_ms = 0;
+            {
+                std::lock_guard<std::mutex> l(_lock);
+                interval_ms = _adaptive_interval_ms(result.group_commit_interval_ms,
+                                                    result.group_commit_data_bytes);
+            }
+            g_group_commit_interval_ms << interval_ms;
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, index_size, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
+                    result.wait_internal_group_commit_finish, interval_ms,
                     result.group_commit_data_bytes);
             RETURN_IF_ERROR(load_block_queue->create_wal(
                     _db_id, _table_id, txn_id, label, _exec_env->wal_mgr(),
@@ -427,12 +446,50 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
     return st;
 }
 
+int64_t GroupCommitTable::_adaptive_interval_ms(int64_t interval_ms, int64_t data_bytes) {
+    int32_t ratio = std::max(config::group_commit_adaptive_interval_ratio, 1);
+    if (ratio == 1 || interval_ms <= 0) {
+        return interval_ms;
+    }
+    auto max_interval_ms = static_cast<double>(interval_ms * ratio);
+    // a commit is not shorter than 2 times of the commit latency, so the commits don't pile up
+    // when the loads come fast.
+    auto min_interval_ms =
+            std::min(std::max(static_cast<double>(interval_ms) / ratio, 2 * _commit_latency_ms),
+                     max_interval_ms);
+    // the time to collect data_bytes at the arrival rate, so there're fewer tiny commits when
+    // the loads come slowly.
+    double fill_ms = _arrival_bytes_per_ms > 0
+                             ? static_cast<double>(data_bytes) / _arrival_bytes_per_ms
+                             : max_interval_ms;
+    return static_cast<int64_t>(std::clamp(fill_ms, min_interval_ms, max_interval_ms));
+}
+
+void GroupCommitTable::_update_commit_stats(const std::shared_ptr<LoadBlockQueue>& load_block_queue,
+                                            int64_t commit_latency_ms) {
+    // the weight of the last commit in the moving averages
+    constexpr double weight = 0.2;
+    auto [data_bytes, duration_ms] = load_block_queue->data_bytes_and_duration_ms();
+    double arrival_bytes_per_ms = static_cast<double>(data_bytes) /
+                                  static_cast<double>(std::max<int64_t>(duration_ms, 1));
+    if (_arrival_bytes_per_ms == 0 && _commit_latency_ms == 0) {
+        _arrival_bytes_per_ms = arrival_bytes_per_ms;
+        _commit_latency_ms = static_cast<double>(commit_latency_ms);
+        return;
+    }
+    _arrival_bytes_per_ms = weight * arrival_bytes_per_ms + (1 - weight) * _arrival_bytes_per_ms;
+    _commit_latency_ms =
+            weight * static_cast<double>(commit_latency_ms) + (1 - weight) * _commit_latency_ms;
+}
+
 Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_id,
                                                    const std::string& label, int64_t txn_id,
                                                    const TUniqueId& instance_id, Status& status,
                                                    RuntimeState* state) {
     Status st;
     Status result_status;
+    MonotonicStopWatch commit_watch;
+    commit_watch.start();
     DBUG_EXECUTE_IF("LoadBlockQueue._finish_group_commit_load.err_status", {
         status = Status::InternalError("LoadBlockQueue._finish_group_commit_load.err_status");
     });
@@ -517,6 +574,9 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
             load_block_queue = it->second;
             if (!status.ok()) {
                 load_block_queue->cancel(status);
+            } else if (st.ok() && result_status.ok()) {
+                _update_commit_stats(load_block_queue,
+                                     static_cast<int64_t>(commit_watch.elapsed_time() / 1000000));
             }
             //close wal
             RETURN_IF_ERROR(load_block_queue->close_wal());
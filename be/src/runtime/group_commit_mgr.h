@@ -90,6 +90,8 @@ public:
     void append_dependency(std::shared_ptr<pipeline::Dependency> finish_dep);
     void append_read_dependency(std::shared_ptr<pipeline::Dependency> read_dep);
     int64_t get_group_commit_interval_ms() { return _group_commit_interval_ms; };
+    // the bytes added to this queue and the milliseconds since it's created.
+    std::pair<int64_t, int64_t> data_bytes_and_duration_ms();
 
     std::string debug_string() const {
         fmt::memory_buffer debug_string_buffer;
@@ -178,6 +180,10 @@ private:
     Status _finish_group_commit_load(int64_t db_id, int64_t table_id, const std::string& label,
                                      int64_t txn_id, const TUniqueId& instance_id, Status& status,
                                      RuntimeState* state);
+    // the commit interval of a new load adapted to the arrival rate and the commit latency.
+    int64_t _adaptive_interval_ms(int64_t interval_ms, int64_t data_bytes);
+    void _update_commit_stats(const std::shared_ptr<LoadBlockQueue>& load_block_queue,
+                              int64_t commit_latency_ms);
 
     ExecEnv* _exec_env = nullptr;
     ThreadPool* _thread_pool = nullptr;
@@ -197,6 +203,10 @@ private:
                                   std::shared_ptr<pipeline::Dependency>, int64_t, int64_t>>
             _create_plan_deps;
     std::string _create_plan_failed_reason;
+    // moving averages of the bytes per ms loaded into the table and the latency of the commits,
+    // protected by _lock.
+    double _arrival_bytes_per_ms = 0;
+    double _commit_latency_ms = 0;
 };
 
 class GroupCommitMgr {
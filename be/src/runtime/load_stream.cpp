@@ -29,6 +29,7 @@
 
 #include <memory>
 #include <sstream>
+#include <utility>
 
 #include "bvar/bvar.h"
 #include "cloud/config.h"
@@ -146,11 +147,12 @@ Status TabletStream::append_data(const PStreamHeader& header, butil::IOBuf* data
     FileType file_type = header.file_type();
     uint32_t new_segid = mapping->at(segid);
     DCHECK(new_segid != std::numeric_limits<uint32_t>::max());
-    butil::IOBuf buf = data->movable();
-    auto flush_func = [this, new_segid, eos, buf, header, file_type]() mutable {
+    // The data is kept in the brpc buffer until it is written to the file.
+    auto flush_func = [this, new_segid, eos, buf = data->movable(), header, file_type]() mutable {
         signal::set_signal_task_id(_load_id);
         g_load_stream_flush_running_threads << -1;
-        auto st = _load_stream_writer->append_data(new_segid, header.offset(), buf, file_type);
+        auto st = _load_stream_writer->append_data(new_segid, header.offset(), std::move(buf),
+                                                   file_type);
         if (!st.ok() && !config::is_cloud_mode()) {
             auto res = ExecEnv::get_tablet(_id);
             TabletSharedPtr tablet =
@@ -205,7 +207,7 @@ Status TabletStream::append_data(const PStreamHeader& header, butil::IOBuf* data
     DBUG_EXECUTE_IF("TabletStream.append_data.submit_func_failed",
                     { st = Status::InternalError("fault injection"); });
     if (st.ok()) {
-        st = _flush_token->submit_func(flush_func);
+        st = _flush_token->submit_func(std::move(flush_func));
     }
     if (!st.ok()) {
         _status.update(st);
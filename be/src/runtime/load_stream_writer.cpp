@@ -27,6 +27,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "bvar/bvar.h"
 #include "cloud/config.h"
@@ -123,7 +124,6 @@ Status LoadStreamWriter::append_data(uint32_t segid, uint64_t offset, butil::IOB
             }
         }
 
-        // TODO: IOBuf to Slice
         file_writer = file_writers[segid].get();
     }
     DBUG_EXECUTE_IF("LoadStreamWriter.append_data.null_file_writer", { file_writer = nullptr; });
@@ -137,7 +137,14 @@ Status LoadStreamWriter::append_data(uint32_t segid, uint64_t offset, butil::IOB
                 "append_data out-of-order in segment={}, expected offset={}, actual={}",
                 file_writer->path().native(), offset, file_writer->bytes_appended());
     }
-    return file_writer->append(buf.to_string());
+    // The blocks of the brpc buffer are written as they are without being copied.
+    std::vector<Slice> slices;
+    slices.reserve(buf.backing_block_num());
+    for (size_t i = 0; i < buf.backing_block_num(); ++i) {
+        auto block = buf.backing_block(i);
+        slices.emplace_back(block.data(), block.size());
+    }
+    return file_writer->appendv(slices.data(), slices.size());
 }
 
 Status LoadStreamWriter::close_writer(uint32_t segid, FileType file_type) {
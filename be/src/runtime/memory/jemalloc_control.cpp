@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <mutex>
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -36,6 +37,9 @@ std::atomic<int64_t> JemallocControl::je_metadata_mem_ = 0;
 std::atomic<int64_t> JemallocControl::je_dirty_pages_mem_ = std::numeric_limits<int64_t>::min();
 std::atomic<int64_t> JemallocControl::je_virtual_memory_used_ = 0;
 
+std::mutex JemallocControl::je_free_arenas_lock_;
+std::vector<int> JemallocControl::je_free_arenas_;
+
 void JemallocControl::refresh_allocator_mem() {
 #if defined(ADDRESS_SANITIZER) || defined(LEAK_SANITIZER) || defined(THREAD_SANITIZER)
 #elif defined(USE_JEMALLOC)
@@ -138,6 +142,51 @@ void JemallocControl::je_thread_tcache_flush() {
     }
 }
 
+int JemallocControl::je_acquire_arena() {
+    {
+        std::lock_guard<std::mutex> l(je_free_arenas_lock_);
+        if (!je_free_arenas_.empty()) {
+            int arena_index = je_free_arenas_.back();
+            je_free_arenas_.pop_back();
+            return arena_index;
+        }
+    }
+    unsigned arena_index = 0;
+    size_t arena_index_size = sizeof(arena_index);
+    if (jemallctl("arenas.create", &arena_index, &arena_index_size, nullptr, 0) != 0) {
+        LOG(WARNING) << "Failed, jemallctl arenas.create";
+        return -1;
+    }
+    return static_cast<int>(arena_index);
+}
+
+void JemallocControl::je_release_arena(int arena_index) {
+    if (arena_index < 0) {
+        return;
+    }
+    je_purge_arena_dirty_pages(arena_index);
+    std::lock_guard<std::mutex> l(je_free_arenas_lock_);
+    je_free_arenas_.push_back(arena_index);
+}
+
+void JemallocControl::je_purge_arena_dirty_pages(int arena_index) {
+    if (arena_index >= 0) {
+        action_jemallctl(fmt::format("arena.{}.purge", arena_index));
+    }
+}
+
+int JemallocControl::je_bind_thread_arena(int arena_index) {
+    unsigned old_arena_index = 0;
+    size_t old_arena_index_size = sizeof(old_arena_index);
+    auto new_arena_index = static_cast<unsigned>(arena_index);
+    if (jemallctl("thread.arena", &old_arena_index, &old_arena_index_size, &new_arena_index,
+                  sizeof(new_arena_index)) != 0) {
+        LOG(WARNING) << fmt::format("Failed, jemallctl thread.arena set to {}", arena_index);
+        return -1;
+    }
+    return static_cast<int>(old_arena_index);
+}
+
 #else
 void JemallocControl::action_jemallctl(const std::string& name) {}
 int64_t JemallocControl::get_je_all_arena_metrics(const std::string& name) {
@@ -151,6 +200,14 @@ void JemallocControl::je_purge_all_arena_dirty_pages() {}
 void JemallocControl::je_reset_all_arena_dirty_decay_ms(ssize_t dirty_decay_ms) {}
 void JemallocControl::je_decay_all_arena_dirty_pages() {}
 void JemallocControl::je_thread_tcache_flush() {}
+int JemallocControl::je_acquire_arena() {
+    return -1;
+}
+void JemallocControl::je_release_arena(int arena_index) {}
+void JemallocControl::je_purge_arena_dirty_pages(int arena_index) {}
+int JemallocControl::je_bind_thread_arena(int arena_index) {
+    return -1;
+}
 #endif
 
 #include "common/compile_check_end.h"
@@ -19,6 +19,7 @@
 
 #include <condition_variable>
 #include <string>
+#include <vector>
 
 #include "common/logging.h"
 
@@ -91,6 +92,17 @@ public:
     // only free the thread cache of the current thread, which will be fast.
     static void je_thread_tcache_flush();
 
+    // Each workload group allocates from a dedicated arena when enable_workload_group_je_arena,
+    // so its dirty pages can be purged without touching the arenas of other groups.
+    // An arena can not be destroyed while it may still own live memory, e.g. of caches,
+    // so the arena of a dropped group is purged and reused by the next group.
+    // Returns -1 if no arena is available.
+    static int je_acquire_arena();
+    static void je_release_arena(int arena_index);
+    static void je_purge_arena_dirty_pages(int arena_index);
+    // Binds the current thread to the arena, returns the arena bound before, -1 if failed.
+    static int je_bind_thread_arena(int arena_index);
+
     // Tcmalloc property `generic.total_physical_bytes` records the total length of the virtual memory
     // obtained by the process malloc, not the physical memory actually used by the process in the OS.
     static void refresh_allocator_mem();
@@ -130,6 +142,9 @@ private:
     static std::atomic<int64_t> je_metadata_mem_;
     static std::atomic<int64_t> je_dirty_pages_mem_;
     static std::atomic<int64_t> je_virtual_memory_used_;
+
+    static std::mutex je_free_arenas_lock_;
+    static std::vector<int> je_free_arenas_;
 };
 
 #include "common/compile_check_end.h"
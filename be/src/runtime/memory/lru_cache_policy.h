@@ -21,11 +21,13 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "olap/lru_cache.h"
 #include "runtime/memory/cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/thread_context.h"
+#include "util/string_util.h"
 #include "util/time.h"
 
 namespace doris {
@@ -44,6 +46,7 @@ public:
             _cache = std::shared_ptr<ShardedLRUCache>(
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         element_count_capacity, is_lru_k));
+            _init_eviction_policy(type);
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -64,6 +67,7 @@ public:
                     new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
                                         cache_value_time_extractor, cache_value_check_timestamp,
                                         element_count_capacity, is_lru_k));
+            _init_eviction_policy(type);
         } else {
             _cache = std::make_shared<doris::DummyLRUCache>();
         }
@@ -73,6 +77,16 @@ public:
 
     void reset_cache() { _cache.reset(); }
 
+    // Whether the cache of the type is listed in `type_names`, separated by comma.
+    static bool is_type_in(const std::string& type_names, CacheType type) {
+        for (const auto& name : split(type_names, ",")) {
+            if (trim(name) == type_string(type)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool check_capacity(size_t capacity, uint32_t num_shards) {
         if (capacity < num_shards) {
             LOG(INFO) << fmt::format(
@@ -292,6 +306,24 @@ public:
     };
 
 protected:
+    void _init_eviction_policy(CacheType type) {
+        auto cache = std::static_pointer_cast<ShardedLRUCache>(_cache);
+        if (is_type_in(config::lru_cache_tiny_lfu_admission_types, type)) {
+            cache->set_tiny_lfu_admission(true);
+            LOG(INFO) << fmt::format("{} lru cache enables tiny lfu admission", type_string(type));
+        }
+        if (is_type_in(config::lru_cache_clock_read_types, type)) {
+            if (cache->set_clock_read(true)) {
+                LOG(INFO) << fmt::format("{} lru cache enables clock read", type_string(type));
+            } else {
+                LOG(WARNING) << fmt::format(
+                        "{} lru cache can not enable clock read with tiny lfu admission or "
+                        "timestamp eviction",
+                        type_string(type));
+            }
+        }
+    }
+
     void _init_mem_tracker(const std::string& type_name) {
         if (std::find(CachePolicy::MetadataCache.begin(), CachePolicy::MetadataCache.end(),
                       _type) == CachePolicy::MetadataCache.end()) {
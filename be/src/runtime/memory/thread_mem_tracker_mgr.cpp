@@ -42,6 +42,7 @@ void ThreadMemTrackerMgr::attach_limiter_tracker(
     _consumer_tracker_stack.clear();
     _limiter_tracker_sptr = mem_tracker;
     _limiter_tracker = _limiter_tracker_sptr.get();
+    _reset_consume_batch_and_lease();
 }
 
 void ThreadMemTrackerMgr::attach_limiter_tracker(
@@ -62,6 +63,7 @@ void ThreadMemTrackerMgr::detach_limiter_tracker() {
     _reserved_mem = _last_attach_snapshots_stack.back().reserved_mem;
     _consumer_tracker_stack = _last_attach_snapshots_stack.back().consumer_tracker_stack;
     _last_attach_snapshots_stack.pop_back();
+    _reset_consume_batch_and_lease();
 }
 
 #include "common/compile_check_end.h"
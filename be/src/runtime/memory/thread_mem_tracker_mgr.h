@@ -35,6 +35,7 @@
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/mem_info.h"
 #include "util/stack_util.h"
 
 namespace doris {
@@ -82,6 +83,10 @@ public:
     void consume(int64_t size);
     void flush_untracked_mem();
 
+    // Same as MemTrackerLimiter::check_limit of the limiter tracker, but the limiter is only
+    // checked when the bytes leased from its headroom are used up by the checks of this thread.
+    Status check_limit(int64_t size);
+
     enum class TryReserveChecker {
         NONE = 0,
         CHECK_TASK = 1,
@@ -130,6 +135,7 @@ public:
     }
 
     int64_t untracked_mem() const { return _untracked_mem; }
+    int64_t consume_batch_bytes() const { return _consume_batch_bytes; }
     int64_t reserved_mem() const { return _reserved_mem; }
 
     int skip_memory_check = 0;
@@ -144,6 +150,12 @@ public:
     }
 
 private:
+    void _update_consume_batch_bytes();
+    void _reset_consume_batch_and_lease() {
+        _consume_batch_bytes = 0;
+        _limit_check_lease = 0;
+    }
+
     struct LastAttachSnapshot {
         std::shared_ptr<MemTrackerLimiter> limiter_tracker {nullptr};
         std::weak_ptr<WorkloadGroup> wg_wptr;
@@ -156,6 +168,11 @@ private:
     // Cache untracked mem.
     int64_t _untracked_mem = 0;
     int64_t _old_untracked_mem = 0;
+    // The untracked mem is consumed when it reaches this batch, see
+    // config::mem_tracker_consume_max_size_bytes. 0 for config::mem_tracker_consume_min_size_bytes.
+    int64_t _consume_batch_bytes = 0;
+    // The bytes that check_limit passes without checking the limiter tracker.
+    int64_t _limit_check_lease = 0;
 
     int64_t _reserved_mem = 0;
 
@@ -254,11 +271,15 @@ inline void ThreadMemTrackerMgr::consume(int64_t size) {
     // and some threads `_untracked_mem <= -config::mem_tracker_consume_min_size_bytes` trigger consumption(),
     // it will cause tracker->consumption to be temporarily less than 0.
     // After the jemalloc hook is loaded, before ExecEnv init, _limiter_tracker=nullptr.
-    if (std::abs(_untracked_mem) >= config::mem_tracker_consume_min_size_bytes && !_stop_consume) {
+    if (std::abs(_untracked_mem) >=
+                std::max(_consume_batch_bytes,
+                         static_cast<int64_t>(config::mem_tracker_consume_min_size_bytes)) &&
+        !_stop_consume) {
         if (!_init && !ExecEnv::ready()) {
             return;
         }
         flush_untracked_mem();
+        _update_consume_batch_bytes();
         // If size is large, then _untracked_mem must be larger than config::mem_tracker_consume_min_size_bytes.
         if (skip_large_memory_check == 0) {
             if (doris::config::stacktrace_in_alloc_large_memory_bytes > 0 &&
@@ -304,6 +325,43 @@ inline void ThreadMemTrackerMgr::flush_untracked_mem() {
     _stop_consume = false;
 }
 
+inline void ThreadMemTrackerMgr::_update_consume_batch_bytes() {
+    const int64_t min_bytes = config::mem_tracker_consume_min_size_bytes;
+    const int64_t max_bytes = config::mem_tracker_consume_max_size_bytes;
+    if (!_init || max_bytes <= min_bytes) {
+        _consume_batch_bytes = 0;
+        return;
+    }
+    // Every thread may hold up to a batch of untracked mem, so the batch only grows while the
+    // headroom of the limiter is far larger than it. Not is_exceed_soft_mem_limit, which may log
+    // and allocate in the Memory Hook.
+    const int64_t next_bytes = std::min(std::max(_consume_batch_bytes, min_bytes) * 2, max_bytes);
+    const int64_t limit = _limiter_tracker->limit();
+    if ((limit > 0 && limit - _limiter_tracker->consumption() < next_bytes * 64) ||
+        GlobalMemoryArbitrator::process_memory_usage() + next_bytes >= MemInfo::soft_mem_limit()) {
+        _consume_batch_bytes = 0;
+    } else {
+        _consume_batch_bytes = next_bytes;
+    }
+}
+
+inline Status ThreadMemTrackerMgr::check_limit(int64_t size) {
+    CHECK(init());
+    if (size <= _limit_check_lease) {
+        _limit_check_lease -= size;
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_limiter_tracker->check_limit(size));
+    const int64_t limit = _limiter_tracker->limit();
+    if (limit > 0 && _limiter_tracker->enable_check_limit()) {
+        // A small part of the headroom, since the other threads of the task lease it too.
+        const int64_t headroom = limit - _limiter_tracker->consumption() - size;
+        _limit_check_lease =
+                std::clamp(headroom / 16, int64_t(0), config::mem_tracker_limit_check_lease_bytes);
+    }
+    return Status::OK();
+}
+
 inline doris::Status ThreadMemTrackerMgr::try_reserve(int64_t size, TryReserveChecker checker) {
     DCHECK(size >= 0);
     CHECK(init());
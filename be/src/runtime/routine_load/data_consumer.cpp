@@ -189,7 +189,7 @@ Status KafkaDataConsumer::assign_topic_partitions(
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
+Status KafkaDataConsumer::group_consume(BlockingQueue<KafkaMessageBatchPtr>* queue,
                                         int64_t max_running_time_ms) {
     static constexpr int MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE = 3;
     int64_t left_time = max_running_time_ms;
@@ -203,6 +203,16 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
     watch.start();
+    auto batch = std::make_shared<KafkaMessageBatch>();
+    // put the batch into the queue, return false if the queue is shutdown
+    auto put_batch = [&]() {
+        if (batch->empty()) {
+            return true;
+        }
+        bool res = queue->controlled_blocking_put(batch, config::blocking_queue_cv_wait_timeout_ms);
+        batch = std::make_shared<KafkaMessageBatch>();
+        return res;
+    };
     while (true) {
         {
             std::unique_lock<std::mutex> l(_lock);
@@ -216,9 +226,11 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // consume 1 message at a time. Once a batch is started, only the messages which are
+        // already fetched are added to it, so that the batch is put without waiting.
         consumer_watch.start();
-        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(1000 /* timeout, ms */));
+        std::unique_ptr<RdKafka::Message> msg(
+                _k_consumer->consume(batch->empty() ? 1000 /* timeout, ms */ : 0));
         consumer_watch.stop();
         DorisMetrics::instance()->routine_load_get_msg_count->increment(1);
         DorisMetrics::instance()->routine_load_get_msg_latency->increment(
@@ -243,18 +255,23 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
                 break;
-            } else if (!queue->controlled_blocking_put(msg.get(),
-                                                       config::blocking_queue_cv_wait_timeout_ms)) {
+            }
+            // the ownership is moved to the batch, msg will be deleted after being processed
+            batch->push_back(std::move(msg));
+            ++put_rows;
+            if (batch->size() >= config::routine_load_consume_batch_size && !put_batch()) {
                 // queue is shutdown
                 done = true;
-            } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
             }
             ++received_rows;
             DorisMetrics::instance()->routine_load_consume_rows->increment(1);
             break;
         case RdKafka::ERR__TIMED_OUT:
+            if (!batch->empty()) {
+                // no more fetched message, put the batch
+                done = !put_batch();
+                break;
+            }
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
             LOG(INFO) << "kafka consume timeout: " << _id;
@@ -271,15 +288,12 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             VLOG_NOTICE << "consumer meet partition eof: " << _id
                         << " partition offset: " << msg->offset();
             _consuming_partition_ids.erase(msg->partition());
-            if (!queue->controlled_blocking_put(msg.get(),
-                                                config::blocking_queue_cv_wait_timeout_ms)) {
+            batch->push_back(std::move(msg));
+            if (!put_batch()) {
                 done = true;
             } else if (_consuming_partition_ids.size() <= 0) {
                 LOG(INFO) << "all partitions meet eof: " << _id;
-                msg.release();
                 done = true;
-            } else {
-                msg.release();
             }
             break;
         }
@@ -304,6 +318,10 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             break;
         }
     }
+    if (st.ok()) {
+        // the msgs left in the batch are not put yet
+        static_cast<void>(put_batch());
+    }
 
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
@@ -61,11 +61,8 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
-        } else {
+        KafkaMessageBatchPtr batch;
+        if (!_queue.blocking_get(&batch)) {
             break;
         }
     }
@@ -156,20 +153,26 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.controlled_blocking_get(&msg, config::blocking_queue_cv_wait_timeout_ms);
+        KafkaMessageBatchPtr batch;
+        bool res =
+                _queue.controlled_blocking_get(&batch, config::blocking_queue_cv_wait_timeout_ms);
         if (res) {
-            // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
-            VLOG_NOTICE << "get kafka message"
-                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
-                        << ", len: " << msg->len();
-
-            if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
-                if (msg->offset() > 0) {
-                    cmt_offset[msg->partition()] = msg->offset() - 1;
+            for (const auto& msg : *batch) {
+                // the msgs left in the batch are not committed, they are consumed again by the
+                // next task.
+                if (eos || left_rows <= 0 || left_bytes <= 0) {
+                    break;
+                }
+                VLOG_NOTICE << "get kafka message"
+                            << ", partition: " << msg->partition() << ", offset: " << msg->offset()
+                            << ", len: " << msg->len();
+
+                if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
+                    if (msg->offset() > 0) {
+                        cmt_offset[msg->partition()] = msg->offset() - 1;
+                    }
+                    continue;
                 }
-            } else {
                 Status st = (kafka_pipe.get()->*append_data)(
                         static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()));
                 if (st.ok()) {
@@ -202,7 +205,7 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
 }
 
 void KafkaDataConsumerGroup::actual_consume(std::shared_ptr<DataConsumer> consumer,
-                                            BlockingQueue<RdKafka::Message*>* queue,
+                                            BlockingQueue<KafkaMessageBatchPtr>* queue,
                                             int64_t max_running_time_ms, ConsumeFinishCallback cb) {
     Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(
             queue, max_running_time_ms);
@@ -227,6 +227,7 @@ Status RuntimePredicate::update(const Field& value) {
     if (!updated) {
         return Status::OK();
     }
+    ++_version;
     for (auto p : _contexts) {
         auto ctx = p.second;
         if (!ctx.tablet_schema) {
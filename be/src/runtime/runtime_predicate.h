@@ -90,6 +90,13 @@ public:
         return _orderby_extrem;
     }
 
+    // Increased every time the value is tightened, so that a reader can tell whether the
+    // predicate changed since it last pruned by it.
+    uint64_t version() const {
+        std::shared_lock<std::shared_mutex> rlock(_rwlock);
+        return _version;
+    }
+
     std::string get_col_name(int32_t target_node_id) const {
         check_target_node_id(target_node_id);
         return _contexts.find(target_node_id)->second.col_name;
@@ -160,6 +167,7 @@ private:
     bool _detected_source = false;
     bool _detected_target = false;
     bool _has_value = false;
+    uint64_t _version = 0;
 };
 
 } // namespace vectorized
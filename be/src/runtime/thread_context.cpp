@@ -18,15 +18,48 @@
 #include "runtime/thread_context.h"
 
 #include "common/signal_handler.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
+#include "runtime/workload_group/workload_group.h"
 
 namespace doris {
 class MemTracker;
 
+void ThreadContext::bind_je_arena(const WorkloadGroupPtr& wg) {
+    if (bthread_self() != 0) {
+        return;
+    }
+    int arena_index = wg != nullptr ? wg->je_arena_index() : -1;
+    if (arena_index < 0) {
+        arena_index = je_default_arena_;
+    }
+    if (arena_index < 0 || arena_index == je_bound_arena_) {
+        return;
+    }
+    int old_arena_index = JemallocControl::je_bind_thread_arena(arena_index);
+    if (old_arena_index < 0) {
+        return;
+    }
+    if (je_default_arena_ < 0) {
+        je_default_arena_ = old_arena_index;
+    }
+    je_bound_arena_ = arena_index;
+}
+
+namespace {
+
+void set_signal_workload_group(const std::shared_ptr<ResourceContext>& rc) {
+    auto wg = rc->workload_group();
+    signal::set_signal_workload_group_id(wg != nullptr ? wg->id() : 0);
+}
+
+} // namespace
+
 void AttachTask::init(const std::shared_ptr<ResourceContext>& rc) {
     ThreadLocalHandle::create_thread_local_if_not_exits();
     signal::set_signal_task_id(rc->task_controller()->task_id());
+    set_signal_workload_group(rc);
     thread_context()->attach_task(rc);
 }
 
@@ -54,6 +87,7 @@ AttachTask::AttachTask(QueryContext* query_ctx) {
 
 AttachTask::~AttachTask() {
     signal::set_signal_task_id(TUniqueId());
+    signal::set_signal_workload_group_id(0);
     thread_context()->detach_task();
     ThreadLocalHandle::del_thread_local_if_count_is_zero();
 }
@@ -65,9 +99,11 @@ SwitchResourceContext::SwitchResourceContext(const std::shared_ptr<ResourceConte
     old_resource_ctx_ = thread_context()->resource_ctx();
     if (rc != old_resource_ctx_) {
         signal::set_signal_task_id(rc->task_controller()->task_id());
+        set_signal_workload_group(rc);
         thread_context()->resource_ctx_ = rc;
         thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(
                 rc->memory_context()->mem_tracker(), rc->workload_group());
+        thread_context()->bind_je_arena(rc->workload_group());
     }
 }
 
@@ -75,8 +111,10 @@ SwitchResourceContext::~SwitchResourceContext() {
     if (old_resource_ctx_ != thread_context()->resource_ctx()) {
         DCHECK(old_resource_ctx_ != nullptr);
         signal::set_signal_task_id(old_resource_ctx_->task_controller()->task_id());
+        set_signal_workload_group(old_resource_ctx_);
         thread_context()->resource_ctx_ = old_resource_ctx_;
         thread_context()->thread_mem_tracker_mgr->detach_limiter_tracker();
+        thread_context()->bind_je_arena(old_resource_ctx_->workload_group());
     }
     doris::ThreadLocalHandle::del_thread_local_if_count_is_zero();
 }
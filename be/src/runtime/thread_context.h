@@ -181,14 +181,21 @@ public:
         thread_mem_tracker_mgr->attach_limiter_tracker(rc->memory_context()->mem_tracker(),
                                                        rc->workload_group());
         thread_mem_tracker_mgr->enable_wait_gc();
+        bind_je_arena(rc->workload_group());
     }
 
     void detach_task() {
         resource_ctx_.reset();
         thread_mem_tracker_mgr->detach_limiter_tracker();
         thread_mem_tracker_mgr->disable_wait_gc();
+        bind_je_arena(nullptr);
     }
 
+    // Binds the thread to the jemalloc arena of the workload group, or back to the arena the
+    // thread used before if the group has no arena. Only a pthread is bound, a bthread may be
+    // resumed on another pthread.
+    void bind_je_arena(const WorkloadGroupPtr& wg);
+
     bool is_attach_task() { return resource_ctx_ != nullptr; }
 
     std::shared_ptr<ResourceContext> resource_ctx() {
@@ -223,6 +230,9 @@ public:
 private:
     friend class SwitchResourceContext;
     std::shared_ptr<ResourceContext> resource_ctx_;
+    // The arena of the thread before it is bound to the arena of a workload group.
+    int je_default_arena_ = -1;
+    int je_bound_arena_ = -1;
 };
 
 class ThreadLocalHandle {
@@ -26,6 +26,7 @@
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/schema_scanner/schema_scanner_helper.h"
 #include "io/fs/local_file_reader.h"
@@ -34,6 +35,7 @@
 #include "pipeline/task_scheduler.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/global_memory_arbitrator.h"
+#include "runtime/memory/jemalloc_control.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/memory_reclamation.h"
 #include "runtime/workload_group/workload_group_metrics.h"
@@ -42,6 +44,7 @@
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
+#include "util/string_util.h"
 #include "util/threadpool.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 
@@ -84,9 +87,15 @@ WorkloadGroup::WorkloadGroup(const WorkloadGroupInfo& tg_info)
     _remote_scan_io_throttle = std::make_shared<IOThrottle>();
 
     _wg_metrics = std::make_shared<WorkloadGroupMetrics>(this);
+
+    if (config::enable_workload_group_je_arena) {
+        _je_arena_index = JemallocControl::je_acquire_arena();
+    }
 }
 
-WorkloadGroup::~WorkloadGroup() = default;
+WorkloadGroup::~WorkloadGroup() {
+    JemallocControl::je_release_arena(_je_arena_index);
+}
 
 std::string WorkloadGroup::debug_string() const {
     std::shared_lock<std::shared_mutex> rl {_mutex};
@@ -220,14 +229,25 @@ int64_t WorkloadGroup::memory_used() {
 }
 
 void WorkloadGroup::do_sweep() {
-    // Clear resource context that is registered during add_resource_ctx
-    std::unique_lock<std::shared_mutex> wlock(_mutex);
-    for (auto iter = _resource_ctxs.begin(); iter != _resource_ctxs.end();) {
-        if (iter->second.lock() == nullptr) {
-            iter = _resource_ctxs.erase(iter);
-        } else {
-            iter++;
+    bool is_idle = false;
+    {
+        // Clear resource context that is registered during add_resource_ctx
+        std::unique_lock<std::shared_mutex> wlock(_mutex);
+        bool swept = false;
+        for (auto iter = _resource_ctxs.begin(); iter != _resource_ctxs.end();) {
+            if (iter->second.lock() == nullptr) {
+                iter = _resource_ctxs.erase(iter);
+                swept = true;
+            } else {
+                iter++;
+            }
         }
+        is_idle = swept && _resource_ctxs.empty();
+    }
+    // The last task of the group is finished, return the dirty pages of its arena to the OS,
+    // without waiting for the decay or purging the arenas of other groups.
+    if (is_idle) {
+        JemallocControl::je_purge_arena_dirty_pages(_je_arena_index);
     }
 }
 
@@ -610,6 +630,17 @@ Status WorkloadGroup::upsert_thread_pool_no_lock(WorkloadGroupInfo* wg_info,
     return upsert_ret;
 }
 
+// Returns the cpus of the workload group in config::workload_group_cpusets, empty if not bound.
+static std::string workload_group_cpuset(const std::string& wg_name) {
+    for (const auto& item : split(config::workload_group_cpusets, ";")) {
+        auto pos = item.find(':');
+        if (pos != std::string::npos && trim(std::string_view(item).substr(0, pos)) == wg_name) {
+            return std::string(trim(std::string_view(item).substr(pos + 1)));
+        }
+    }
+    return "";
+}
+
 void WorkloadGroup::upsert_cgroup_cpu_ctl_no_lock(WorkloadGroupInfo* wg_info) {
     int cpu_hard_limit = wg_info->cpu_hard_limit;
     int cpu_share = static_cast<int>(wg_info->cpu_share);
@@ -618,6 +649,7 @@ void WorkloadGroup::upsert_cgroup_cpu_ctl_no_lock(WorkloadGroupInfo* wg_info) {
     if (_cgroup_cpu_ctl) {
         _cgroup_cpu_ctl->update_cpu_hard_limit(cpu_hard_limit);
         _cgroup_cpu_ctl->update_cpu_soft_limit(cpu_share);
+        _cgroup_cpu_ctl->update_cpuset(workload_group_cpuset(wg_info->name));
         _cgroup_cpu_ctl->get_cgroup_cpu_info(&(wg_info->cgroup_cpu_shares),
                                              &(wg_info->cgroup_cpu_hard_limit));
     }
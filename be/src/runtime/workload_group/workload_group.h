@@ -229,6 +229,10 @@ public:
     int64_t revoke_memory(int64_t need_free_mem, const std::string& revoke_reason,
                           RuntimeProfile* profile);
 
+    // The jemalloc arena the threads of this group's tasks allocate from, -1 if the group shares
+    // the default arenas.
+    int je_arena_index() const { return _je_arena_index; }
+
 private:
     void set_id(uint64_t wg_id) { _id = wg_id; }
 
@@ -286,6 +290,8 @@ private:
     std::shared_ptr<IOThrottle> _remote_scan_io_throttle {nullptr};
 
     std::shared_ptr<WorkloadGroupMetrics> _wg_metrics {nullptr};
+
+    int _je_arena_index = -1;
 };
 
 using WorkloadGroupPtr = std::shared_ptr<WorkloadGroup>;
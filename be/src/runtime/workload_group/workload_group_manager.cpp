@@ -937,6 +937,94 @@ bool WorkloadGroupMgr::handle_single_query_(const std::shared_ptr<ResourceContex
     return true;
 }
 
+void WorkloadGroupMgr::revoke_memory_proactively() {
+    const int32_t percent = config::proactive_spill_soft_mem_limit_percent;
+    if (percent <= 0) {
+        return;
+    }
+    const auto watermark = static_cast<int64_t>(static_cast<double>(MemInfo::soft_mem_limit()) *
+                                                percent / 100);
+    const int64_t process_memory = GlobalMemoryArbitrator::process_memory_usage();
+    if (process_memory < watermark) {
+        return;
+    }
+    {
+        // The memory of the paused queries is being revoked by handle_paused_queries.
+        std::lock_guard<std::mutex> lock(_paused_queries_lock);
+        for (const auto& [wg, queries] : _paused_queries_list) {
+            if (!queries.empty()) {
+                return;
+            }
+        }
+    }
+
+    struct RevocableQuery {
+        std::shared_ptr<ResourceContext> resource_ctx;
+        uint64_t cpu_share;
+        size_t revocable_size;
+        size_t memory_usage;
+    };
+    std::vector<RevocableQuery> queries;
+    {
+        std::shared_lock<std::shared_mutex> r_lock(_group_mutex);
+        for (const auto& [wg_id, wg] : _workload_groups) {
+            for (const auto& [query_id, resource_ctx_wptr] : wg->resource_ctxs()) {
+                auto resource_ctx = resource_ctx_wptr.lock();
+                // Only the queries that reserve memory are paused and resumed by spilling.
+                if (resource_ctx == nullptr || resource_ctx->task_controller()->is_cancelled() ||
+                    resource_ctx->task_controller()->is_pure_load_task() ||
+                    !resource_ctx->task_controller()->is_enable_reserve_memory()) {
+                    continue;
+                }
+                size_t revocable_size = 0;
+                size_t memory_usage = 0;
+                bool has_running_task = false;
+                resource_ctx->task_controller()->get_revocable_info(
+                        &revocable_size, &memory_usage, &has_running_task);
+                // The revocable size of a query with running tasks is unknown, it is paused to be
+                // found out, and resumed at once by handle_single_query_ if it has none.
+                if (has_running_task || revocable_size > 0) {
+                    queries.push_back({std::move(resource_ctx), wg->cpu_share(), revocable_size,
+                                       memory_usage});
+                }
+            }
+        }
+    }
+
+    // The queries of the groups of lower cpu share spill first, and among them the ones that free
+    // the most memory by spilling.
+    std::sort(queries.begin(), queries.end(), [](const auto& lhs, const auto& rhs) {
+        if (lhs.cpu_share != rhs.cpu_share) {
+            return lhs.cpu_share < rhs.cpu_share;
+        }
+        if (lhs.revocable_size != rhs.revocable_size) {
+            return lhs.revocable_size > rhs.revocable_size;
+        }
+        return lhs.memory_usage > rhs.memory_usage;
+    });
+
+    const int64_t need_free_mem = process_memory - watermark;
+    int64_t freed_mem = 0;
+    for (auto& query : queries) {
+        if (freed_mem >= need_free_mem) {
+            break;
+        }
+        // QueryTaskController::revoke_memory spills a fifth of the memory of the query.
+        freed_mem += static_cast<int64_t>(query.memory_usage / 5);
+        LOG(INFO) << "Query: " << print_id(query.resource_ctx->task_controller()->task_id())
+                  << " is paused to spill ahead, revocable: "
+                  << PrettyPrinter::print_bytes(query.revocable_size)
+                  << ", memory usage: " << PrettyPrinter::print_bytes(query.memory_usage)
+                  << ", process memory: " << PrettyPrinter::print_bytes(process_memory)
+                  << ", watermark: " << PrettyPrinter::print_bytes(watermark);
+        add_paused_query(query.resource_ctx, 0,
+                         Status::Error<ErrorCode::QUERY_MEMORY_EXCEEDED>(
+                                 "process memory {} reaches the proactive spill watermark {}",
+                                 PrettyPrinter::print_bytes(process_memory),
+                                 PrettyPrinter::print_bytes(watermark)));
+    }
+}
+
 void WorkloadGroupMgr::update_queries_limit_(WorkloadGroupPtr wg, bool enable_hard_limit) {
     auto wg_mem_limit = wg->memory_limit();
     auto all_resource_ctxs = wg->resource_ctxs();
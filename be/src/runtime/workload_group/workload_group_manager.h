@@ -91,6 +91,10 @@ public:
 
     void handle_paused_queries();
 
+    // Pauses the queries to spill their revocable memory, when the process memory reaches
+    // proactive_spill_soft_mem_limit_percent of the soft limit but no query is paused yet.
+    void revoke_memory_proactively();
+
     friend class WorkloadGroupListener;
     friend class ExecEnv;
 
@@ -18,6 +18,7 @@
 #include "runtime/workload_group/workload_group_metrics.h"
 
 #include "io/fs/local_file_reader.h"
+#include "io/io_common.h"
 #include "olap/olap_common.h"
 #include "runtime/workload_group/workload_group.h"
 #include "runtime/workload_management/io_throttle.h"
@@ -32,11 +33,23 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_remote_scan_bytes, doris::Me
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_total_local_scan_bytes,
                                      doris::MetricUnit::BYTES);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_local_scan_bytes, doris::MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_scan_split_scheduled_time_ns,
+                                     doris::MetricUnit::NANOSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_scan_page_cache_bytes,
+                                     doris::MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_scan_io_total, doris::MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_scan_io_time_ns,
+                                     doris::MetricUnit::NANOSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(workload_group_scan_slow_io_total,
+                                     doris::MetricUnit::OPERATIONS);
 
 #include "common/compile_check_begin.h"
 
 WorkloadGroupMetrics::~WorkloadGroupMetrics() {
     DorisMetrics::instance()->metric_registry()->deregister_entity(_entity);
+    for (const auto& entity : _io_entity_list) {
+        DorisMetrics::instance()->metric_registry()->deregister_entity(entity);
+    }
 }
 
 WorkloadGroupMetrics::WorkloadGroupMetrics(WorkloadGroup* wg) {
@@ -48,6 +61,28 @@ WorkloadGroupMetrics::WorkloadGroupMetrics(WorkloadGroup* wg) {
     INT_GAUGE_METRIC_REGISTER(_entity, workload_group_mem_used_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_remote_scan_bytes);
     INT_COUNTER_METRIC_REGISTER(_entity, workload_group_total_local_scan_bytes);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_scan_split_scheduled_time_ns);
+    INT_COUNTER_METRIC_REGISTER(_entity, workload_group_scan_page_cache_bytes);
+
+    static constexpr std::array<const char*, NUM_SCAN_IO_TIERS> tier_names = {
+            "file_cache", "remote", "local_disk"};
+    for (size_t tier = 0; tier < NUM_SCAN_IO_TIERS; ++tier) {
+        std::shared_ptr<MetricEntity> tier_entity =
+                DorisMetrics::instance()->metric_registry()->register_entity(
+                        wg_id_prefix + "_scan_io_" + tier_names[tier],
+                        {{"workload_group", wg->name()},
+                         {"tier", tier_names[tier]},
+                         {"id", std::to_string(wg->id())}});
+        IntCounter* workload_group_scan_io_total = nullptr;
+        IntCounter* workload_group_scan_io_time_ns = nullptr;
+        IntCounter* workload_group_scan_slow_io_total = nullptr;
+        INT_COUNTER_METRIC_REGISTER(tier_entity, workload_group_scan_io_total);
+        INT_COUNTER_METRIC_REGISTER(tier_entity, workload_group_scan_io_time_ns);
+        INT_COUNTER_METRIC_REGISTER(tier_entity, workload_group_scan_slow_io_total);
+        _scan_io_counters[tier] = {workload_group_scan_io_total, workload_group_scan_io_time_ns,
+                                   workload_group_scan_slow_io_total};
+        _io_entity_list.push_back(tier_entity);
+    }
 
     std::vector<DataDirInfo>& data_dir_list = io::BeConfDataDirReader::be_config_data_dir_list;
     for (const auto& data_dir : data_dir_list) {
@@ -84,6 +119,28 @@ void WorkloadGroupMetrics::update_remote_scan_io_bytes(uint64_t delta_io_bytes)
     workload_group_remote_scan_bytes->increment(delta_io_bytes);
 }
 
+void WorkloadGroupMetrics::update_scan_split_scheduled_time_nanos(int64_t delta_nanos) {
+    workload_group_scan_split_scheduled_time_ns->increment(delta_nanos);
+}
+
+void WorkloadGroupMetrics::update_scan_io_stats(const io::FileCacheStatistics& stats,
+                                                int64_t page_cache_bytes) {
+    auto update_tier = [this](ScanIOTier tier, int64_t io_total, int64_t io_time_ns,
+                              const io::IOLatencyHistogram& latency) {
+        const auto& counters = _scan_io_counters[tier];
+        counters.io_total->increment(io_total);
+        counters.io_time_ns->increment(io_time_ns);
+        // the buckets of 100ms and 1s
+        counters.slow_io_total->increment(latency.counts[4] + latency.counts[5]);
+    };
+    update_tier(FILE_CACHE, stats.num_local_io_total, stats.local_io_timer,
+                stats.cache_hit_io_latency);
+    update_tier(REMOTE, stats.num_remote_io_total, stats.remote_io_timer, stats.remote_io_latency);
+    update_tier(LOCAL_DISK, stats.num_local_disk_io_total, stats.local_disk_io_timer,
+                stats.local_disk_io_latency);
+    workload_group_scan_page_cache_bytes->increment(page_cache_bytes);
+}
+
 void WorkloadGroupMetrics::refresh_metrics() {
     int interval_second = config::workload_group_metrics_interval_ms / 1000;
 
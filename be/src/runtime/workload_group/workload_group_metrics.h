@@ -18,6 +18,7 @@
 #pragma once
 
 #include <atomic>
+#include <array>
 #include <map>
 #include <memory>
 #include <string>
@@ -28,6 +29,10 @@ namespace doris {
 
 class WorkloadGroup;
 
+namespace io {
+struct FileCacheStatistics;
+} // namespace io
+
 template <typename T>
 class AtomicCounter;
 using IntCounter = AtomicCounter<int64_t>;
@@ -53,6 +58,13 @@ public:
 
     void update_remote_scan_io_bytes(uint64_t delta_io_bytes);
 
+    // Time the scan splits of this group are scheduled by the time sharing task executor.
+    void update_scan_split_scheduled_time_nanos(int64_t delta_nanos);
+
+    // Adds the reads of a scanner by the tier serving them: the file cache, the remote storage
+    // and the local disks, and the bytes of the pages the scanner found in the page cache.
+    void update_scan_io_stats(const io::FileCacheStatistics& stats, int64_t page_cache_bytes);
+
     void refresh_metrics();
 
     uint64_t get_cpu_time_nanos_per_second();
@@ -68,8 +80,19 @@ private:
     IntGuage* workload_group_mem_used_bytes {nullptr};           // used for metric
     IntCounter* workload_group_remote_scan_bytes {nullptr};      // used for metric
     IntCounter* workload_group_total_local_scan_bytes {nullptr}; // used for metric
+    IntCounter* workload_group_scan_split_scheduled_time_ns {nullptr}; // used for metric
     std::unordered_multimap<std::string, IntCounter*>
             _local_scan_bytes_counter_map; // used for metric
+    IntCounter* workload_group_scan_page_cache_bytes {nullptr}; // used for metric
+
+    // the IOs of a tier, the slow ones take 100ms or more
+    struct ScanIOCounters {
+        IntCounter* io_total = nullptr;
+        IntCounter* io_time_ns = nullptr;
+        IntCounter* slow_io_total = nullptr;
+    };
+    enum ScanIOTier { FILE_CACHE = 0, REMOTE = 1, LOCAL_DISK = 2, NUM_SCAN_IO_TIERS = 3 };
+    std::array<ScanIOCounters, NUM_SCAN_IO_TIERS> _scan_io_counters; // used for metric
 
     std::atomic<uint64_t> _cpu_time_nanos {0};
     std::atomic<uint64_t> _last_cpu_time_nanos {0};
@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_management/io_scheduler.h"
+
+#include <bvar/bvar.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/thread_context.h"
+#include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_management/task_controller.h"
+#include "util/time.h"
+
+namespace doris {
+
+bvar::Adder<int64_t> g_io_scheduler_waiting_reads("io_scheduler_waiting_reads");
+bvar::LatencyRecorder g_io_scheduler_wait_latency("io_scheduler_wait");
+bvar::Adder<uint64_t> g_io_scheduler_deadline_grants("io_scheduler_deadline_grants");
+
+// The slots held by the thread, see IOSchedulerSlot.
+static thread_local int t_held_slots = 0;
+
+IOScheduler* IOScheduler::local(const std::string& data_dir) {
+    if (config::io_scheduler_max_concurrent_local_reads <= 0) {
+        return nullptr;
+    }
+    static std::mutex lock;
+    static std::unordered_map<std::string, std::unique_ptr<IOScheduler>> schedulers;
+    std::lock_guard<std::mutex> l(lock);
+    auto& scheduler = schedulers[data_dir];
+    if (scheduler == nullptr) {
+        scheduler = std::make_unique<IOScheduler>(false);
+    }
+    return scheduler.get();
+}
+
+IOScheduler* IOScheduler::remote() {
+    if (config::io_scheduler_max_concurrent_remote_reads <= 0) {
+        return nullptr;
+    }
+    static IOScheduler scheduler(true);
+    return &scheduler;
+}
+
+int IOScheduler::_max_running() const {
+    int max_running = _remote ? config::io_scheduler_max_concurrent_remote_reads
+                              : config::io_scheduler_max_concurrent_local_reads;
+    return max_running <= 0 ? std::numeric_limits<int>::max() : max_running;
+}
+
+void IOScheduler::acquire(uint64_t group_id, uint64_t weight, int64_t deadline_ms) {
+    std::unique_lock<std::mutex> l(_lock);
+    auto& group = _groups[group_id];
+    group.weight = std::max<uint64_t>(weight, 1);
+    if (_num_waiters == 0 && _running < _max_running()) {
+        _running++;
+        return;
+    }
+    if (group.waiters.empty()) {
+        group.vtime = std::max(group.vtime, _vtime);
+    }
+    Waiter waiter;
+    waiter.deadline_ms = deadline_ms;
+    group.waiters.push_back(&waiter);
+    _num_waiters++;
+    g_io_scheduler_waiting_reads << 1;
+    int64_t start = MonotonicMicros();
+    // The limit may have been raised since the running reads were granted.
+    _dispatch();
+    waiter.cv.wait(l, [&]() { return waiter.granted; });
+    g_io_scheduler_wait_latency << (MonotonicMicros() - start);
+    g_io_scheduler_waiting_reads << -1;
+}
+
+void IOScheduler::release(uint64_t group_id, size_t bytes) {
+    std::lock_guard<std::mutex> l(_lock);
+    DCHECK_GT(_running, 0);
+    _running--;
+    auto& group = _groups[group_id];
+    group.vtime += static_cast<double>(bytes) / static_cast<double>(group.weight);
+    _dispatch();
+}
+
+void IOScheduler::_dispatch() {
+    const int max_running = _max_running();
+    while (_num_waiters > 0 && _running < max_running) {
+        const int64_t urgent_ms = MonotonicMillis() + config::io_scheduler_deadline_slack_ms;
+        Group* next = nullptr;
+        bool by_deadline = false;
+        for (auto& [_, group] : _groups) {
+            if (group.waiters.empty()) {
+                continue;
+            }
+            int64_t deadline_ms = group.waiters.front()->deadline_ms;
+            bool urgent = deadline_ms > 0 && deadline_ms <= urgent_ms;
+            if (next == nullptr || (urgent && !by_deadline)) {
+                next = &group;
+                by_deadline = urgent;
+            } else if (urgent) {
+                if (deadline_ms < next->waiters.front()->deadline_ms) {
+                    next = &group;
+                }
+            } else if (!by_deadline && group.vtime < next->vtime) {
+                next = &group;
+            }
+        }
+        DCHECK(next != nullptr);
+        Waiter* waiter = next->waiters.front();
+        next->waiters.pop_front();
+        _num_waiters--;
+        _running++;
+        _vtime = std::max(_vtime, next->vtime);
+        if (by_deadline) {
+            g_io_scheduler_deadline_grants << 1;
+        }
+        waiter->granted = true;
+        waiter->cv.notify_one();
+    }
+}
+
+IOSchedulerSlot::IOSchedulerSlot(IOScheduler* scheduler, const size_t* bytes_read)
+        : _bytes_read(bytes_read) {
+    if (scheduler == nullptr || t_held_slots > 0) {
+        return;
+    }
+    uint64_t weight = config::io_scheduler_background_weight;
+    int64_t deadline_ms = 0;
+    auto* t_ctx = thread_context();
+    if (t_ctx->is_attach_task()) {
+        auto* resource_ctx = t_ctx->resource_ctx();
+        if (auto wg = resource_ctx->workload_group(); wg != nullptr) {
+            _group_id = wg->id();
+            weight = wg->cpu_share();
+        }
+        deadline_ms = resource_ctx->task_controller()->deadline();
+    }
+    scheduler->acquire(_group_id, weight, deadline_ms);
+    _scheduler = scheduler;
+    t_held_slots++;
+}
+
+IOSchedulerSlot::~IOSchedulerSlot() {
+    if (_scheduler != nullptr) {
+        t_held_slots--;
+        _scheduler->release(_group_id, *_bytes_read);
+    }
+}
+
+} // namespace doris
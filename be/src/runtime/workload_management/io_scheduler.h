@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace doris {
+
+// Schedules the reads of a device, a local data dir or the remote storage, across the workload
+// groups.
+//
+// At most io_scheduler_max_concurrent_{local,remote}_reads reads of a device run at once. When
+// they are all running, a new read waits in the queue of its workload group, and a finished read
+// passes its slot to the first read of the group which has read the fewest bytes per weight, the
+// weight of a group being its cpu share, so the groups share the device by their weights. A
+// waiting read whose query times out in io_scheduler_deadline_slack_ms goes first. The bandwidth
+// limits of the groups are applied by their IOThrottles before the reads are scheduled.
+class IOScheduler {
+public:
+    // The group of the reads which are not in a workload group.
+    static constexpr uint64_t BACKGROUND_GROUP_ID = UINT64_MAX;
+
+    // Returns nullptr if the reads of the device are not scheduled.
+    static IOScheduler* local(const std::string& data_dir);
+    static IOScheduler* remote();
+
+    explicit IOScheduler(bool remote) : _remote(remote) {}
+
+    // Blocks until the read may run. `deadline_ms` is the MonotonicMillis at which the query of
+    // the read times out, 0 if it has none.
+    void acquire(uint64_t group_id, uint64_t weight, int64_t deadline_ms);
+
+    // Called when the read finished, `bytes` is the bytes it read.
+    void release(uint64_t group_id, size_t bytes);
+
+    int running() const {
+        std::lock_guard<std::mutex> l(_lock);
+        return _running;
+    }
+
+    size_t waiting() const {
+        std::lock_guard<std::mutex> l(_lock);
+        return _num_waiters;
+    }
+
+private:
+    struct Waiter {
+        std::condition_variable cv;
+        int64_t deadline_ms;
+        bool granted = false;
+    };
+
+    struct Group {
+        uint64_t weight = 1;
+        // The bytes read by the group divided by its weight.
+        double vtime = 0;
+        std::deque<Waiter*> waiters;
+    };
+
+    int _max_running() const;
+    void _dispatch();
+
+    const bool _remote;
+
+    mutable std::mutex _lock;
+    int _running = 0;
+    size_t _num_waiters = 0;
+    // The vtime of the group last granted a slot. A group which starts reading again starts from
+    // here, so it doesn't take the device for the time it was idle.
+    double _vtime = 0;
+    std::unordered_map<uint64_t, Group> _groups;
+};
+
+// Holds a slot of the scheduler during a read. The workload group and the query deadline are
+// those of the task attached to the thread. A thread already holding a slot, like a reader
+// reading through another reader, doesn't wait for a second one.
+class IOSchedulerSlot {
+public:
+    IOSchedulerSlot(IOScheduler* scheduler, const size_t* bytes_read);
+    ~IOSchedulerSlot();
+
+    IOSchedulerSlot(const IOSchedulerSlot&) = delete;
+    IOSchedulerSlot& operator=(const IOSchedulerSlot&) = delete;
+
+private:
+    IOScheduler* _scheduler = nullptr;
+    const size_t* _bytes_read;
+    uint64_t _group_id = IOScheduler::BACKGROUND_GROUP_ID;
+};
+
+} // namespace doris
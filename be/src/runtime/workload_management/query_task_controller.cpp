@@ -36,6 +36,14 @@ bool QueryTaskController::is_cancelled() const {
     return query_ctx->is_cancelled();
 }
 
+int64_t QueryTaskController::deadline() const {
+    auto query_ctx = query_ctx_.lock();
+    if (query_ctx == nullptr || query_ctx->execution_timeout() <= 0) {
+        return 0;
+    }
+    return start_time() + static_cast<int64_t>(query_ctx->execution_timeout()) * 1000;
+}
+
 bool QueryTaskController::cancel_impl(const Status& reason, int fragment_id) {
     auto query_ctx = query_ctx_.lock();
     if (query_ctx == nullptr) {
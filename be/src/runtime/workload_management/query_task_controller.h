@@ -33,6 +33,7 @@ public:
     ~QueryTaskController() override = default;
 
     bool is_cancelled() const override;
+    int64_t deadline() const override;
     bool cancel_impl(const Status& reason, int fragment_id);
     bool cancel_impl(const Status& reason) override { return cancel_impl(reason, -1); }
     bool is_pure_load_task() const override;
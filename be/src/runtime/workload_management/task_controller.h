@@ -65,6 +65,8 @@ public:
     int64_t start_time() const { return start_time_; }
     int64_t finish_time() const { return finish_time_; }
     int64_t running_time() const { return finish_time() - start_time(); }
+    // The MonotonicMillis at which the task times out, 0 if it has no timeout.
+    virtual int64_t deadline() const { return 0; }
 
     /* cancel action
     */
@@ -59,6 +59,11 @@ void RuntimeFilterConsumer::signal(RuntimeFilter* other) {
     std::unique_lock<std::recursive_mutex> l(_rmtx);
     COUNTER_SET(_wait_timer, int64_t((MonotonicMillis() - _registration_time) * NANOS_PER_MILLIS));
     _set_state(State::READY, other->_wrapper);
+    if (_adaptive_wait) {
+        RuntimeFilterWaitHistory::instance()->record_ready(
+                _digest, MonotonicMillis() - _registration_time,
+                _wrapper->get_state() == RuntimeFilterWrapper::State::DISABLED);
+    }
     if (!_filter_timer.empty()) {
         for (auto& timer : _filter_timer) {
             timer->call_ready();
@@ -241,6 +246,12 @@ void RuntimeFilterConsumer::collect_realtime_profile(RuntimeProfile* parent_oper
     c = parent_operator_profile->add_counter(fmt::format("RF{} AlwaysTrueFilterRows", filter_id),
                                              TUnit::UNIT, "RuntimeFilterInfo", 2);
     c->update(_always_true_counter->value());
+
+    if (_adaptive_wait && _rf_state == State::APPLIED &&
+        _wrapper->get_state() == RuntimeFilterWrapper::State::READY) {
+        RuntimeFilterWaitHistory::instance()->record_selectivity(_digest, _rf_input->value(),
+                                                                 _rf_filter->value());
+    }
 }
 
 } // namespace doris
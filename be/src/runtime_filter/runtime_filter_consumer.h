@@ -25,6 +25,7 @@
 #include "pipeline/dependency.h"
 #include "runtime/query_context.h"
 #include "runtime_filter/runtime_filter.h"
+#include "runtime_filter/runtime_filter_wait_history.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -90,6 +91,7 @@ private:
                           int node_id)
             : RuntimeFilter(desc),
               _probe_expr(desc->planId_to_target_expr.find(node_id)->second),
+              _digest(RuntimeFilterWaitHistory::digest(*desc, _probe_expr)),
               _registration_time(MonotonicMillis()),
               _rf_state(State::NOT_READY) {
         // If bitmap filter is not applied, it will cause the query result to be incorrect
@@ -97,6 +99,11 @@ private:
                                _runtime_filter_type == RuntimeFilterType::BITMAP_FILTER;
         _rf_wait_time_ms = wait_infinitely ? query_ctx->execution_timeout() * 1000
                                            : query_ctx->runtime_filter_wait_time_ms();
+        _adaptive_wait = !wait_infinitely && config::enable_adaptive_runtime_filter_wait;
+        if (_adaptive_wait) {
+            _rf_wait_time_ms =
+                    RuntimeFilterWaitHistory::instance()->wait_time_ms(_digest, _rf_wait_time_ms);
+        }
         DorisMetrics::instance()->runtime_filter_consumer_num->increment(1);
     }
 
@@ -133,6 +140,10 @@ private:
     }
 
     TExpr _probe_expr;
+    // Identifies the filters of the same expressions in RuntimeFilterWaitHistory.
+    const uint64_t _digest;
+    // Whether the wait time is decided and the outcome recorded by RuntimeFilterWaitHistory.
+    bool _adaptive_wait = false;
 
     std::vector<std::shared_ptr<pipeline::RuntimeFilterTimer>> _filter_timer;
 
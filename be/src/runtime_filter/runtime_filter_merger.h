@@ -55,8 +55,9 @@ public:
     }
 
     // If input is a disabled predicate, the final result is a disabled predicate.
-    Status merge_from(const RuntimeFilter* other) {
-        _received_producer_num++;
+    // `producer_num` is the number of producers which have been merged into `other`.
+    Status merge_from(const RuntimeFilter* other, int producer_num = 1) {
+        _received_producer_num += producer_num;
         if (_expected_producer_num < _received_producer_num) {
             return Status::InternalError(
                     "runtime filter merger input product more than expected, {}", debug_string());
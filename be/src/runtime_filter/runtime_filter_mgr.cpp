@@ -302,22 +302,55 @@ Status RuntimeFilterMergeControllerEntity::merge(std::shared_ptr<QueryContext> q
         }
     }
     auto& cnt_val = iter->second;
-    bool is_ready = false;
     {
         std::lock_guard<std::mutex> l(iter->second.mtx);
         // Skip the other broadcast join runtime filter
-        if (cnt_val.arrive_id.size() == 1 && cnt_val.runtime_filter_desc.is_broadcast_join) {
+        if (!cnt_val.arrive_id.empty() && cnt_val.runtime_filter_desc.is_broadcast_join) {
             return Status::OK();
         }
-        std::shared_ptr<RuntimeFilterProducer> tmp_filter;
-        RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
-                                                      &tmp_filter));
+        cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
+    }
 
-        RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
+    // Deserialize out of the lock, so that the filters arriving at the same time are deserialized
+    // in parallel.
+    std::shared_ptr<RuntimeFilterProducer> tmp_filter;
+    RETURN_IF_ERROR(RuntimeFilterProducer::create(query_ctx.get(), &cnt_val.runtime_filter_desc,
+                                                  &tmp_filter));
+    RETURN_IF_ERROR(tmp_filter->assign(*request, attach_data));
 
-        RETURN_IF_ERROR(cnt_val.merger->merge_from(tmp_filter.get()));
+    int producer_num = 1;
+    bool is_ready = false;
+    {
+        std::unique_lock<std::mutex> l(cnt_val.mtx);
+        while (cnt_val.merging) {
+            if (cnt_val.pending.empty()) {
+                // The merging thread will take it.
+                cnt_val.pending.emplace_back(std::move(tmp_filter), producer_num);
+                return Status::OK();
+            }
+            // Combine with another waiting filter while the merger is busy, so the filters are
+            // merged as a fan-in tree instead of one by one into the merger.
+            auto [other, other_producer_num] = std::move(cnt_val.pending.back());
+            cnt_val.pending.pop_back();
+            l.unlock();
+            RETURN_IF_ERROR(tmp_filter->merge(other.get()));
+            producer_num += other_producer_num;
+            l.lock();
+        }
 
-        cnt_val.arrive_id.insert(UniqueId(request->fragment_instance_id()));
+        cnt_val.merging = true;
+        while (true) {
+            l.unlock();
+            auto merge_st = cnt_val.merger->merge_from(tmp_filter.get(), producer_num);
+            l.lock();
+            if (!merge_st.ok() || cnt_val.pending.empty()) {
+                cnt_val.merging = false;
+                RETURN_IF_ERROR(merge_st);
+                break;
+            }
+            std::tie(tmp_filter, producer_num) = std::move(cnt_val.pending.back());
+            cnt_val.pending.pop_back();
+        }
         is_ready = cnt_val.merger->ready(); // update is_ready in locked scope
     }
 
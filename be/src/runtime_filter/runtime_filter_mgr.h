@@ -71,6 +71,11 @@ struct GlobalMergeContext {
     std::vector<TRuntimeFilterTargetParamsV2> targetv2_info;
     std::unordered_set<UniqueId> arrive_id;
     std::vector<PNetworkAddress> source_addrs;
+    // Only one thread merges into `merger` at a time. Filters arriving meanwhile wait in
+    // `pending` with the number of producers merged into them, and are combined in pairs by
+    // the arriving threads before they reach `merger`.
+    bool merging = false;
+    std::vector<std::pair<std::shared_ptr<RuntimeFilterProducer>, int>> pending;
 };
 
 // owned by RuntimeState
@@ -72,6 +72,12 @@ public:
 
     Status publish(RuntimeState* state, bool build_hash_table);
 
+    // Merge a filter received from another producer into this one. Only used by the global
+    // merge controller on the filters it deserialized.
+    Status merge(const RuntimeFilterProducer* other) {
+        return _wrapper->merge(other->_wrapper.get());
+    }
+
     std::string debug_string() override {
         std::unique_lock<std::recursive_mutex> l(_rmtx);
         auto result =
@@ -19,8 +19,13 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <cmath>
+
+#include "common/config.h"
+#include "exprs/bloom_filter_func.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime_filter/runtime_filter_wrapper.h"
+#include "util/pretty_printer.h"
 
 namespace doris {
 #include "common/compile_check_begin.h"
@@ -42,9 +47,65 @@ Status RuntimeFilterProducerHelper::init(
                 state->register_producer_runtime_filter(runtime_filter_descs[i], &_producers[i]));
     }
     _init_expr(build_expr_ctxs, runtime_filter_descs);
+
+    if (config::enable_runtime_filter_ndv_sizing) {
+        _build_key_ndvs.resize(_producers.size());
+        for (size_t i = 0; i < _producers.size(); i++) {
+            const auto type = _producers[i]->type();
+            if ((type == RuntimeFilterType::BLOOM_FILTER ||
+                 type == RuntimeFilterType::IN_OR_BLOOM_FILTER) &&
+                _producers[i]->wrapper()->build_bf_by_runtime_size()) {
+                _build_key_ndvs[i] = std::make_unique<HyperLogLog>();
+            }
+        }
+    }
     return Status::OK();
 }
 
+void RuntimeFilterProducerHelper::update_ndv(const vectorized::Block& block) {
+    if (_build_key_ndvs.empty() || _skip_runtime_filters_process) {
+        return;
+    }
+    SCOPED_TIMER(_runtime_filter_compute_timer.get());
+    std::vector<uint64_t> hashes;
+    for (size_t i = 0; i < _producers.size(); i++) {
+        if (!_build_key_ndvs[i]) {
+            continue;
+        }
+        int result_column_id = _filter_expr_contexts[i]->get_last_result_column_id();
+        DCHECK_NE(result_column_id, -1);
+        const auto column =
+                block.get_by_position(result_column_id).column->convert_to_full_column_if_const();
+        hashes.assign(column->size(), 0);
+        column->update_hashes_with_value(hashes.data());
+        for (auto hash : hashes) {
+            _build_key_ndvs[i]->update(hash);
+        }
+    }
+    _ndv_rows += block.rows();
+}
+
+uint64_t RuntimeFilterProducerHelper::_filter_size(size_t filter_index,
+                                                   uint64_t hash_table_size) const {
+    // The sketch is useless if it does not see all the build rows, the first row of hash table is
+    // mocked and never in the filter.
+    if (_build_key_ndvs.empty() || !_build_key_ndvs[filter_index] ||
+        _ndv_rows + 1 != hash_table_size) {
+        return hash_table_size;
+    }
+    const auto ndv = std::min(
+            static_cast<uint64_t>(_build_key_ndvs[filter_index]->estimate_cardinality()),
+            hash_table_size);
+    if (_producers[filter_index]->type() == RuntimeFilterType::IN_OR_BLOOM_FILTER) {
+        // Keep the choice between in filter and bloom filter the same as sizing by rows, an in
+        // filter chosen by an underestimated ndv may overflow.
+        const auto max_in_num =
+                static_cast<uint64_t>(_producers[filter_index]->wrapper()->max_in_num());
+        return hash_table_size > max_in_num ? std::max(ndv, max_in_num + 1) : hash_table_size;
+    }
+    return ndv;
+}
+
 Status RuntimeFilterProducerHelper::send_filter_size(
         RuntimeState* state, uint64_t hash_table_size,
         const std::shared_ptr<pipeline::CountedFinishDependency>& dependency) {
@@ -54,8 +115,8 @@ Status RuntimeFilterProducerHelper::send_filter_size(
     for (const auto& filter : _producers) {
         filter->latch_dependency(dependency);
     }
-    for (const auto& filter : _producers) {
-        RETURN_IF_ERROR(filter->send_size(state, hash_table_size));
+    for (size_t i = 0; i < _producers.size(); i++) {
+        RETURN_IF_ERROR(_producers[i]->send_size(state, _filter_size(i, hash_table_size)));
     }
     return Status::OK();
 }
@@ -63,12 +124,34 @@ Status RuntimeFilterProducerHelper::send_filter_size(
 Status RuntimeFilterProducerHelper::_init_filters(RuntimeState* state,
                                                   uint64_t local_hash_table_size) {
     // process IN_OR_BLOOM_FILTER's real type
-    for (const auto& filter : _producers) {
-        RETURN_IF_ERROR(filter->init(local_hash_table_size));
+    for (size_t i = 0; i < _producers.size(); i++) {
+        RETURN_IF_ERROR(_producers[i]->init(_filter_size(i, local_hash_table_size)));
     }
+    _collect_bloom_filter_info();
     return Status::OK();
 }
 
+void RuntimeFilterProducerHelper::_collect_bloom_filter_info() {
+    for (size_t i = 0; i < _build_key_ndvs.size(); i++) {
+        if (!_build_key_ndvs[i]) {
+            continue;
+        }
+        auto wrapper = _producers[i]->wrapper();
+        auto bloom_filter_func = wrapper->bloom_filter_func();
+        if (wrapper->get_real_type() != RuntimeFilterType::BLOOM_FILTER || !bloom_filter_func) {
+            continue;
+        }
+        // The false positive rate of a bloom filter with 8 hash functions.
+        const auto ndv = static_cast<double>(_build_key_ndvs[i]->estimate_cardinality());
+        const auto bits = static_cast<double>(bloom_filter_func->get_size() * 8);
+        const double fpp = bits > 0 ? std::pow(1 - std::exp(-8 * ndv / bits), 8) : 1;
+        _bloom_filter_infos.emplace_back(
+                wrapper->filter_id(),
+                fmt::format("ndv: {}, size: {}, estimated fpp: {:.6f}", int64_t(ndv),
+                            PrettyPrinter::print_bytes(bloom_filter_func->get_size()), fpp));
+    }
+}
+
 Status RuntimeFilterProducerHelper::_insert(const vectorized::Block* block, size_t start) {
     SCOPED_TIMER(_runtime_filter_compute_timer.get());
     for (int i = 0; i < _producers.size(); i++) {
@@ -173,6 +256,10 @@ void RuntimeFilterProducerHelper::collect_realtime_profile(
 
     parent_operator_profile->add_description(
             "SkipProcess", _skip_runtime_filters_process ? "True" : "False", "RuntimeFilterInfo");
+    for (const auto& [filter_id, info] : _bloom_filter_infos) {
+        parent_operator_profile->add_description(fmt::format("BloomFilter{}", filter_id), info,
+                                                 "RuntimeFilterInfo");
+    }
     publish_timer->set(_publish_runtime_filter_timer->value());
     build_timer->set(_runtime_filter_compute_timer->value());
 }
@@ -21,6 +21,7 @@
 
 #include "common/be_mock_util.h"
 #include "common/status.h"
+#include "olap/hll.h"
 #include "runtime/runtime_state.h"
 #include "runtime_filter/runtime_filter.h"
 #include "runtime_filter/runtime_filter_mgr.h"
@@ -66,6 +67,10 @@ public:
     // publish rf
     Status publish(RuntimeState* state);
 
+    // Feed the build keys into the sketches of bloom filters, `block` must have been evaluated by
+    // the build exprs.
+    void update_ndv(const vectorized::Block& block);
+
     void collect_realtime_profile(RuntimeProfile* parent_operator_profile);
 
 protected:
@@ -74,6 +79,8 @@ protected:
     Status _init_filters(RuntimeState* state, uint64_t local_hash_table_size);
     Status _insert(const vectorized::Block* block, size_t start);
     Status _publish(RuntimeState* state);
+    uint64_t _filter_size(size_t filter_index, uint64_t hash_table_size) const;
+    void _collect_bloom_filter_info();
 
     std::vector<std::shared_ptr<RuntimeFilterProducer>> _producers;
     const bool _should_build_hash_table;
@@ -88,6 +95,13 @@ protected:
     const bool _is_broadcast_join;
 
     std::vector<std::shared_ptr<vectorized::VExprContext>> _filter_expr_contexts;
+
+    // The distinct build keys of every bloom filter whose size is decided by the runtime size, or
+    // nullptr for the other filters.
+    std::vector<std::unique_ptr<HyperLogLog>> _build_key_ndvs;
+    uint64_t _ndv_rows = 0;
+    // The ndv, size and estimated false positive rate of every bloom filter, shown in profile.
+    std::vector<std::pair<int, std::string>> _bloom_filter_infos;
 };
 #include "common/compile_check_end.h"
 } // namespace doris
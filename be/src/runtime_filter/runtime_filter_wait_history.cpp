@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime_filter/runtime_filter_wait_history.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/hash_util.hpp"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Bounds the memory of the history, which is simply reset when it is full.
+static constexpr size_t MAX_HISTORY_SIZE = 100000;
+
+RuntimeFilterWaitHistory* RuntimeFilterWaitHistory::instance() {
+    static RuntimeFilterWaitHistory history;
+    return &history;
+}
+
+static uint64_t hash_expr(const TExpr& expr, uint64_t seed) {
+    for (const auto& node : expr.nodes) {
+        seed = HashUtil::hash64(&node.node_type, sizeof(node.node_type), seed);
+        if (node.__isset.slot_ref) {
+            seed = HashUtil::hash64(&node.slot_ref.slot_id, sizeof(node.slot_ref.slot_id), seed);
+        }
+        if (node.__isset.label) {
+            seed = HashUtil::hash64(node.label.data(), node.label.size(), seed);
+        }
+    }
+    return seed;
+}
+
+uint64_t RuntimeFilterWaitHistory::digest(const TRuntimeFilterDesc& desc,
+                                          const TExpr& probe_expr) {
+    uint64_t seed = HashUtil::hash64(&desc.type, sizeof(desc.type), 0);
+    return hash_expr(probe_expr, hash_expr(desc.src_expr, seed));
+}
+
+int32_t RuntimeFilterWaitHistory::wait_time_ms(uint64_t digest, int32_t wait_time_ms) {
+    std::lock_guard l(_lock);
+    auto it = _stats.find(digest);
+    if (it == _stats.end()) {
+        return wait_time_ms;
+    }
+    const auto& stats = it->second;
+    if (stats.useless_streak >= USELESS_STREAK_TO_SKIP) {
+        return 0;
+    }
+    if (stats.num_latency_samples >= MIN_LATENCY_SAMPLES) {
+        int64_t usual_wait_ms = std::max<int64_t>(
+                stats.latency_ms * 2, config::runtime_filter_adaptive_min_wait_time_ms);
+        return static_cast<int32_t>(std::min<int64_t>(wait_time_ms, usual_wait_ms));
+    }
+    return wait_time_ms;
+}
+
+void RuntimeFilterWaitHistory::record_ready(uint64_t digest, int64_t latency_ms, bool disabled) {
+    std::lock_guard l(_lock);
+    if (_stats.size() >= MAX_HISTORY_SIZE) {
+        _stats.clear();
+    }
+    auto& stats = _stats[digest];
+    if (disabled) {
+        stats.useless_streak++;
+        return;
+    }
+    stats.latency_ms = stats.num_latency_samples == 0
+                               ? latency_ms
+                               : (stats.latency_ms * 3 + latency_ms) / 4;
+    stats.num_latency_samples++;
+}
+
+void RuntimeFilterWaitHistory::record_selectivity(uint64_t digest, int64_t input_rows,
+                                                  int64_t filtered_rows) {
+    if (input_rows < config::runtime_filter_adaptive_min_input_rows) {
+        return;
+    }
+    std::lock_guard l(_lock);
+    auto it = _stats.find(digest);
+    if (it == _stats.end()) {
+        return;
+    }
+    // useless if it removes less than 5% of the rows
+    if (filtered_rows * 20 < input_rows) {
+        it->second.useless_streak++;
+    } else {
+        it->second.useless_streak = 0;
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// The outcome of the previous runtime filters of the same plan, identified by a digest of the
+// filter expressions, used to decide how long a consumer waits for its filter:
+//  - a filter which was useless (disabled by its producer or filtering almost nothing) the last
+//    few times is not waited on, it is still applied by the scanners if it arrives later.
+//  - a filter which always arrived quickly is waited on for a few times its usual latency
+//    instead of the whole `runtime_filter_wait_time_ms`.
+class RuntimeFilterWaitHistory {
+public:
+    // The number of consecutive useless filters after which a filter is not waited on.
+    static constexpr int32_t USELESS_STREAK_TO_SKIP = 3;
+    // The number of samples before the usual latency shortens the wait.
+    static constexpr int32_t MIN_LATENCY_SAMPLES = 3;
+
+    static RuntimeFilterWaitHistory* instance();
+
+    static uint64_t digest(const TRuntimeFilterDesc& desc, const TExpr& probe_expr);
+
+    // Returns the time to wait for the filter of `digest`, at most `wait_time_ms`.
+    int32_t wait_time_ms(uint64_t digest, int32_t wait_time_ms);
+
+    // Called when the filter arrives after `latency_ms`, `disabled` if the producer gave up.
+    void record_ready(uint64_t digest, int64_t latency_ms, bool disabled);
+
+    // Called when the filter has been evaluated on `input_rows` rows and removed `filtered_rows`.
+    void record_selectivity(uint64_t digest, int64_t input_rows, int64_t filtered_rows);
+
+private:
+    struct Stats {
+        int64_t latency_ms = 0; // moving average
+        int32_t num_latency_samples = 0;
+        int32_t useless_streak = 0;
+    };
+
+    std::mutex _lock;
+    std::unordered_map<uint64_t, Stats> _stats;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
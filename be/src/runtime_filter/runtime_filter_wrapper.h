@@ -61,6 +61,7 @@ public:
 
     bool is_valid() const { return _state != State::DISABLED; }
     int filter_id() const { return _filter_id; }
+    int32_t max_in_num() const { return _max_in_num; }
     bool build_bf_by_runtime_size() const;
 
     RuntimeFilterType get_real_type() const {
@@ -76,6 +76,7 @@
 #include "service/backend_service.h"
 #include "service/brpc_service.h"
 #include "service/http_service.h"
+#include "util/cpu_sampler.h"
 #include "util/debug_util.h"
 #include "util/disk_info.h"
 #include "util/mem_info.h"
@@ -600,6 +601,15 @@ int main(int argc, char** argv) {
     doris::Daemon daemon;
     daemon.start();
 
+    // 7. cpu sampler
+    if (doris::config::enable_cpu_sampler) {
+        status = doris::CpuSampler::instance()->start(doris::config::cpu_sampler_frequency,
+                                                      doris::config::cpu_sampler_capacity);
+        if (!status.ok()) {
+            LOG(WARNING) << "cpu sampler did not start: " << status;
+        }
+    }
+
     exec_env->storage_engine().notify_listeners();
 
     while (!doris::k_doris_exit) {
@@ -615,6 +625,7 @@ int main(int argc, char** argv) {
 #endif
     // For graceful shutdown, need to wait for all running queries to stop
     exec_env->wait_for_all_tasks_done();
+    doris::CpuSampler::instance()->stop();
     daemon.stop();
     flight_server.reset();
     LOG(INFO) << "Flight server stopped.";
@@ -1645,6 +1645,13 @@ void PInternalService::transmit_block_by_http(google::protobuf::RpcController* c
         brpc::Controller* cntl = static_cast<brpc::Controller*>(controller);
         Status st =
                 attachment_extract_request_contain_block<PTransmitDataParams>(new_request, cntl);
+        // The request is at the head of the attachment, the rest is for `transmit_block`.
+        if (st.ok()) {
+            cntl->request_attachment().pop_front(
+                    attachment_embedded_request_size(cntl->request_attachment()));
+        } else {
+            cntl->request_attachment().clear();
+        }
         _transmit_block(controller, new_request, response, new_done, st,
                         GetCurrentTimeNanos() - receive_time);
     });
@@ -1668,7 +1675,9 @@ void PInternalService::_transmit_block(google::protobuf::RpcController* controll
     // give response a default value to avoid null pointers in high concurrency.
     Status st;
     if (extract_st.ok()) {
-        st = _exec_env->vstream_mgr()->transmit_block(request, &done, wait_for_worker);
+        st = _exec_env->vstream_mgr()->transmit_block(
+                request, &done, wait_for_worker,
+                &static_cast<brpc::Controller*>(controller)->request_attachment());
         if (!st.ok() && !st.is<END_OF_FILE>()) {
             LOG(WARNING) << "transmit_block failed, message=" << st
                          << ", fragment_instance_id=" << print_id(request->finst_id())
@@ -28,6 +28,7 @@
 
 #include <climits>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -421,9 +422,18 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // Lookup the keys in order, so that the adjacent keys hit the same primary key index pages
+    std::vector<size_t> key_order(_row_read_ctxs.size());
+    std::iota(key_order.begin(), key_order.end(), 0);
+    std::sort(key_order.begin(), key_order.end(), [&](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    // The cached rows do not have the columns missing in row store
+    const bool use_row_cache =
+            !config::disable_storage_row_cache && _reusable->missing_col_uids().empty();
+    for (size_t i : key_order) {
         RowLocation location;
-        if (!config::disable_storage_row_cache) {
+        if (use_row_cache) {
             RowCache::CacheHandle cache_handle;
             auto hit_cache = RowCache::instance()->lookup(
                     {_tablet->tablet_id(), _row_read_ctxs[i]._primary_key}, &cache_handle);
@@ -457,49 +467,93 @@ Status PointQueryExecutor::_lookup_row_key() {
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    // The found rows are output by segments in the order of row id, so that the rows of a
+    // segment are read in one batch.
+    std::vector<size_t> row_order;
+    std::vector<std::pair<size_t, size_t>> segment_ranges; // [begin, end) in row_order
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
-            RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
-                    _reusable->get_data_type_serdes(),
-                    _row_read_ctxs[i]._cached_row_data.data().data,
-                    _row_read_ctxs[i]._cached_row_data.data().size, _reusable->get_col_uid_to_idx(),
-                    *_result_block, _reusable->get_col_default_values(),
-                    _reusable->include_col_uids()));
-            continue;
+            row_order.push_back(i);
         }
-        if (!_row_read_ctxs[i]._row_location.has_value()) {
-            continue;
+    }
+    const size_t num_cached_rows = row_order.size();
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        if (_row_read_ctxs[i]._row_location.has_value()) {
+            row_order.push_back(i);
         }
-        std::string value;
-        // fill block by row store
-        if (_reusable->rs_column_uid() != -1) {
-            bool use_row_cache = !config::disable_storage_row_cache;
-            RETURN_IF_ERROR(_tablet->lookup_row_data(
-                    _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                    *(_row_read_ctxs[i]._rowset_ptr), _profile_metrics.read_stats, value,
-                    use_row_cache));
-            // serilize value to block, currently only jsonb row formt
-            RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
-                    _reusable->get_data_type_serdes(), value.data(), value.size(),
-                    _reusable->get_col_uid_to_idx(), *_result_block,
-                    _reusable->get_col_default_values(), _reusable->include_col_uids()));
+    }
+    std::sort(row_order.begin() + num_cached_rows, row_order.end(), [&](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._row_location.value() <
+               _row_read_ctxs[rhs]._row_location.value();
+    });
+    for (size_t begin = num_cached_rows; begin < row_order.size();) {
+        const auto& loc = _row_read_ctxs[row_order[begin]]._row_location.value();
+        size_t end = begin + 1;
+        while (end < row_order.size()) {
+            const auto& next = _row_read_ctxs[row_order[end]]._row_location.value();
+            if (next.rowset_id != loc.rowset_id || next.segment_id != loc.segment_id) {
+                break;
+            }
+            ++end;
         }
-        if (!_reusable->missing_col_uids().empty()) {
-            if (!_reusable->runtime_state()->enable_short_circuit_query_access_column_store()) {
-                std::string missing_columns;
-                for (int cid : _reusable->missing_col_uids()) {
-                    missing_columns += _tablet->tablet_schema()->column_by_uid(cid).name() + ",";
+        segment_ranges.emplace_back(begin, end);
+        begin = end;
+    }
+
+    for (size_t i = 0; i < num_cached_rows; ++i) {
+        const auto& cached_row_data = _row_read_ctxs[row_order[i]]._cached_row_data;
+        RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
+                _reusable->get_data_type_serdes(), cached_row_data.data().data,
+                cached_row_data.data().size, _reusable->get_col_uid_to_idx(), *_result_block,
+                _reusable->get_col_default_values(), _reusable->include_col_uids()));
+    }
+    // fill block by row store
+    if (_reusable->rs_column_uid() != -1) {
+        const bool use_row_cache = !config::disable_storage_row_cache;
+        for (const auto& [begin, end] : segment_ranges) {
+            const auto& first = _row_read_ctxs[row_order[begin]];
+            std::vector<uint32_t> rowids;
+            rowids.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                rowids.push_back(_row_read_ctxs[row_order[i]]._row_location->row_id);
+            }
+            vectorized::MutableColumnPtr values = vectorized::ColumnString::create();
+            RETURN_IF_ERROR(_tablet->lookup_row_data_by_rowids(
+                    *first._rowset_ptr, first._row_location->segment_id, rowids,
+                    _profile_metrics.read_stats, values));
+            DCHECK_EQ(values->size(), rowids.size());
+            for (size_t i = begin; i < end; ++i) {
+                StringRef value = values->get_data_at(i - begin);
+                if (use_row_cache) {
+                    RowCache::instance()->insert(
+                            {_tablet->tablet_id(), _row_read_ctxs[row_order[i]]._primary_key},
+                            Slice {value.data, value.size});
                 }
-                return Status::InternalError(
-                        "Not support column store, set store_row_column=true or row_store_columns "
-                        "in table "
-                        "properties, missing columns: " +
-                        missing_columns + " should be added to row store");
+                // serilize value to block, currently only jsonb row formt
+                RETURN_IF_ERROR(vectorized::JsonbSerializeUtil::jsonb_to_block(
+                        _reusable->get_data_type_serdes(), value.data, value.size,
+                        _reusable->get_col_uid_to_idx(), *_result_block,
+                        _reusable->get_col_default_values(), _reusable->include_col_uids()));
             }
-            // fill missing columns by column store
-            RowLocation row_loc = _row_read_ctxs[i]._row_location.value();
-            BetaRowsetSharedPtr rowset =
-                    std::static_pointer_cast<BetaRowset>(_tablet->get_rowset(row_loc.rowset_id));
+        }
+    }
+    if (!_reusable->missing_col_uids().empty() && !segment_ranges.empty()) {
+        if (!_reusable->runtime_state()->enable_short_circuit_query_access_column_store()) {
+            std::string missing_columns;
+            for (int cid : _reusable->missing_col_uids()) {
+                missing_columns += _tablet->tablet_schema()->column_by_uid(cid).name() + ",";
+            }
+            return Status::InternalError(
+                    "Not support column store, set store_row_column=true or row_store_columns "
+                    "in table "
+                    "properties, missing columns: " +
+                    missing_columns + " should be added to row store");
+        }
+        // fill missing columns by column store
+        for (const auto& [begin, end] : segment_ranges) {
+            const RowLocation& first_loc = _row_read_ctxs[row_order[begin]]._row_location.value();
+            BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(
+                    _tablet->get_rowset(first_loc.rowset_id));
             SegmentCacheHandle segment_cache;
             {
                 SCOPED_TIMER(&_profile_metrics.load_segment_data_stage_ns);
@@ -510,18 +564,21 @@ Status PointQueryExecutor::_lookup_row_data() {
             auto it = std::find_if(segment_cache.get_segments().cbegin(),
                                    segment_cache.get_segments().cend(),
                                    [&](const segment_v2::SegmentSharedPtr& seg) {
-                                       return seg->id() == row_loc.segment_id;
+                                       return seg->id() == first_loc.segment_id;
                                    });
             const auto& segment = *it;
             for (int cid : _reusable->missing_col_uids()) {
                 int pos = _reusable->get_col_uid_to_idx().at(cid);
-                auto row_id = static_cast<segment_v2::rowid_t>(row_loc.row_id);
                 vectorized::MutableColumnPtr column =
                         _result_block->get_by_position(pos).column->assume_mutable();
                 std::unique_ptr<ColumnIterator> iter;
                 SlotDescriptor* slot = _reusable->tuple_desc()->slots()[pos];
-                RETURN_IF_ERROR(segment->seek_and_read_by_rowid(*_tablet->tablet_schema(), slot,
-                                                                row_id, column, _read_stats, iter));
+                for (size_t i = begin; i < end; ++i) {
+                    auto row_id = static_cast<segment_v2::rowid_t>(
+                            _row_read_ctxs[row_order[i]]._row_location->row_id);
+                    RETURN_IF_ERROR(segment->seek_and_read_by_rowid(
+                            *_tablet->tablet_schema(), slot, row_id, column, _read_stats, iter));
+                }
                 if (_tablet->tablet_schema()
                             ->column_by_uid(slot->col_unique_id())
                             .has_char_type()) {
@@ -530,6 +587,7 @@ Status PointQueryExecutor::_lookup_row_data() {
             }
         }
     }
+    const auto num_rows = cast_set<int>(row_order.size());
     if (_result_block->columns() > _reusable->include_col_uids().size()) {
         // Padding rows for some columns that no need to output to mysql client
         // eg. SELECT k1,v1,v2 FROM TABLE WHERE k1 = 1, k1 is not in output slots, tuple as bellow
@@ -539,32 +597,36 @@ Status PointQueryExecutor::_lookup_row_data() {
         // thus missing in include_col_uids and missing_col_uids
         for (size_t i = 0; i < _result_block->columns(); ++i) {
             auto column = _result_block->get_by_position(i).column;
-            int padding_rows = _row_hits - cast_set<int>(column->size());
+            int padding_rows = num_rows - cast_set<int>(column->size());
             if (padding_rows > 0) {
                 column->assume_mutable()->insert_many_defaults(padding_rows);
             }
         }
     }
     // filter rows by delete sign
-    if (_row_hits > 0 && _reusable->delete_sign_idx() != -1) {
+    if (num_rows > 0 && _reusable->delete_sign_idx() != -1) {
+        vectorized::IColumn::Filter filter;
         size_t filtered = 0;
-        size_t total = 0;
         {
             // clear_column_data will check reference of ColumnPtr, so we need to release
             // reference before clear_column_data
             vectorized::ColumnPtr delete_filter_columns =
                     _result_block->get_columns()[_reusable->delete_sign_idx()];
-            const auto& filter =
+            const auto& delete_signs =
                     assert_cast<const vectorized::ColumnInt8*>(delete_filter_columns.get())
                             ->get_data();
-            filtered = filter.size() - simd::count_zero_num((int8_t*)filter.data(), filter.size());
-            total = filter.size();
+            filter.resize(delete_signs.size());
+            for (size_t i = 0; i < delete_signs.size(); ++i) {
+                filter[i] = delete_signs[i] == 0;
+            }
+            filtered = delete_signs.size() -
+                       simd::count_zero_num((int8_t*)delete_signs.data(), delete_signs.size());
         }
 
-        if (filtered == total) {
+        if (filtered == filter.size()) {
             _result_block->clear_column_data();
         } else if (filtered > 0) {
-            return Status::NotSupported("Not implemented since only single row at present");
+            vectorized::Block::filter_block_internal(_result_block.get(), filter);
         }
     }
     return Status::OK();
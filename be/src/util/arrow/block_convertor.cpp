@@ -22,16 +22,22 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
+#include <arrow/util/bit_util.h>
 #include <arrow/util/decimal.h>
+#include <arrow/util/parallel.h>
 #include <arrow/visit_type_inline.h>
 #include <arrow/visitor.h>
 #include <cctz/time_zone.h>
 #include <glog/logging.h>
 
 #include <ctime>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -40,6 +46,10 @@
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -52,33 +62,49 @@ class Array;
 
 namespace doris {
 
+// Keeps the column alive while arrow reads its memory.
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(vectorized::ColumnPtr column, const void* data, int64_t size)
+            : arrow::Buffer(reinterpret_cast<const uint8_t*>(data), size),
+              _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
 class FromBlockConverter {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
-                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj)
+                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj,
+                       bool zero_copy, bool use_threads)
             : _block(block),
               _schema(schema),
               _pool(pool),
-              _cur_field_idx(-1),
-              _timezone_obj(timezone_obj) {}
+              _timezone_obj(timezone_obj),
+              _zero_copy(zero_copy),
+              _use_threads(use_threads) {}
 
     ~FromBlockConverter() = default;
 
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    Status _convert_column(size_t idx);
+
+    // Wraps the buffers of the column as the arrow array if their layouts are the same, then
+    // `*shared` is true.
+    Status _share_column(const vectorized::ColumnPtr& column, const vectorized::DataTypePtr& type,
+                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                         std::shared_ptr<arrow::Array>* array, bool* shared);
+
     const vectorized::Block& _block;
     const std::shared_ptr<arrow::Schema>& _schema;
     arrow::MemoryPool* _pool;
 
-    size_t _cur_field_idx;
-    size_t _cur_start;
-    size_t _cur_rows;
-    vectorized::ColumnPtr _cur_col;
-    vectorized::DataTypePtr _cur_type;
-    arrow::ArrayBuilder* _cur_builder = nullptr;
-
     const cctz::time_zone& _timezone_obj;
+    const bool _zero_copy;
+    const bool _use_threads;
 
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
@@ -90,47 +116,148 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     }
 
     _arrays.resize(num_fields);
+    std::vector<Status> statuses(num_fields);
+    auto arrow_st = arrow::internal::OptionalParallelFor(
+            _use_threads && num_fields > 1, static_cast<int>(num_fields), [&](int idx) {
+                statuses[idx] = _convert_column(idx);
+                return arrow::Status::OK();
+            });
+    if (!arrow_st.ok()) {
+        return to_doris_status(arrow_st);
+    }
+    for (const Status& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    *out = arrow::RecordBatch::Make(_schema, _block.rows(), std::move(_arrays));
+    return Status::OK();
+}
+
+Status FromBlockConverter::_convert_column(size_t idx) {
+    const auto& cur_type = _block.get_by_position(idx).type;
+    auto column = _block.get_by_position(idx).column->convert_to_full_column_if_const();
+    auto arrow_type = _schema->field(static_cast<int>(idx))->type();
+    if (_zero_copy) {
+        bool shared = false;
+        RETURN_IF_ERROR(_share_column(column, cur_type, arrow_type, &_arrays[idx], &shared));
+        if (shared) {
+            return Status::OK();
+        }
+    }
+    if (arrow_type->name() == "utf8" && column->byte_size() >= MAX_ARROW_UTF8) {
+        arrow_type = arrow::large_utf8();
+    }
+    std::unique_ptr<arrow::ArrayBuilder> builder;
+    auto arrow_st = arrow::MakeBuilder(_pool, arrow_type, &builder);
+    if (!arrow_st.ok()) {
+        return to_doris_status(arrow_st);
+    }
+    try {
+        RETURN_IF_ERROR(cur_type->get_serde()->write_column_to_arrow(
+                *column, nullptr, builder.get(), 0, _block.rows(), _timezone_obj));
+    } catch (std::exception& e) {
+        return Status::InternalError(
+                "Fail to convert block data to arrow data, type: {}, name: {}, error: {}",
+                cur_type->get_name(), _block.get_by_position(idx).name, e.what());
+    }
+    arrow_st = builder->Finish(&_arrays[idx]);
+    if (!arrow_st.ok()) {
+        return to_doris_status(arrow_st);
+    }
+    return Status::OK();
+}
 
-    for (size_t idx = 0; idx < num_fields; ++idx) {
-        _cur_field_idx = idx;
-        _cur_start = 0;
-        _cur_rows = _block.rows();
-        _cur_col = _block.get_by_position(idx).column;
-        _cur_type = _block.get_by_position(idx).type;
-        auto column = _cur_col->convert_to_full_column_if_const();
-        auto arrow_type = _schema->field(idx)->type();
-        if (arrow_type->name() == "utf8" && column->byte_size() >= MAX_ARROW_UTF8) {
-            arrow_type = arrow::large_utf8();
+Status FromBlockConverter::_share_column(const vectorized::ColumnPtr& column,
+                                         const vectorized::DataTypePtr& type,
+                                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                                         std::shared_ptr<arrow::Array>* array, bool* shared) {
+    *shared = false;
+    size_t num_rows = _block.rows();
+    const vectorized::IColumn* data_column = column.get();
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable_column =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(*column)) {
+        data_column = &nullable_column->get_nested_column();
+        null_map = &nullable_column->get_null_map_data();
+    }
+
+    auto primitive_type = vectorized::remove_nullable(type)->get_primitive_type();
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers(1);
+    switch (arrow_type->id()) {
+#define SHARE_FIXED_LENGTH_COLUMN(ARROW_TYPE, PRIMITIVE_TYPE, COLUMN_TYPE)                  \
+    case ARROW_TYPE: {                                                                      \
+        if (primitive_type != PRIMITIVE_TYPE) {                                             \
+            return Status::OK();                                                            \
+        }                                                                                   \
+        const auto& data = assert_cast<const COLUMN_TYPE&>(*data_column).get_data();        \
+        buffers.emplace_back(std::make_shared<ColumnBuffer>(                                \
+                column, data.data(), static_cast<int64_t>(data.size() * sizeof(data[0])))); \
+        break;                                                                              \
+    }
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::INT8, TYPE_TINYINT, vectorized::ColumnInt8)
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::INT16, TYPE_SMALLINT, vectorized::ColumnInt16)
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::INT32, TYPE_INT, vectorized::ColumnInt32)
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::INT64, TYPE_BIGINT, vectorized::ColumnInt64)
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::FLOAT, TYPE_FLOAT, vectorized::ColumnFloat32)
+        SHARE_FIXED_LENGTH_COLUMN(arrow::Type::DOUBLE, TYPE_DOUBLE, vectorized::ColumnFloat64)
+#undef SHARE_FIXED_LENGTH_COLUMN
+    case arrow::Type::STRING: {
+        if (primitive_type != TYPE_STRING && primitive_type != TYPE_VARCHAR &&
+            primitive_type != TYPE_CHAR) {
+            return Status::OK();
         }
-        std::unique_ptr<arrow::ArrayBuilder> builder;
-        auto arrow_st = arrow::MakeBuilder(_pool, arrow_type, &builder);
-        if (!arrow_st.ok()) {
-            return to_doris_status(arrow_st);
+        const auto* string_column =
+                vectorized::check_and_get_column<vectorized::ColumnString>(*data_column);
+        if (string_column == nullptr ||
+            string_column->get_chars().size() >
+                    static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+            return Status::OK();
         }
-        _cur_builder = builder.get();
-        try {
-            RETURN_IF_ERROR(_cur_type->get_serde()->write_column_to_arrow(
-                    *column, nullptr, _cur_builder, _cur_start, _cur_start + _cur_rows,
-                    _timezone_obj));
-        } catch (std::exception& e) {
-            return Status::InternalError(
-                    "Fail to convert block data to arrow data, type: {}, name: {}, error: {}",
-                    _cur_type->get_name(), _block.get_by_position(idx).name, e.what());
+        // The offsets of ColumnString are the ends of the strings, and the one before the first
+        // is padded with 0, so they are the n + 1 offsets of arrow from the padding.
+        const auto& offsets = string_column->get_offsets();
+        const auto& chars = string_column->get_chars();
+        buffers.emplace_back(std::make_shared<ColumnBuffer>(
+                column, offsets.data() - 1,
+                static_cast<int64_t>((num_rows + 1) * sizeof(offsets[0]))));
+        buffers.emplace_back(std::make_shared<ColumnBuffer>(
+                column, chars.data(), static_cast<int64_t>(chars.size())));
+        break;
+    }
+    default:
+        return Status::OK();
+    }
+
+    int64_t null_count = 0;
+    if (null_map != nullptr) {
+        auto bitmap = arrow::AllocateEmptyBitmap(static_cast<int64_t>(num_rows), _pool);
+        if (!bitmap.ok()) {
+            return to_doris_status(bitmap.status());
+        }
+        uint8_t* validity = (*bitmap)->mutable_data();
+        const auto* null_data = null_map->data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (null_data[i]) {
+                ++null_count;
+            } else {
+                arrow::bit_util::SetBit(validity, static_cast<int64_t>(i));
+            }
         }
-        arrow_st = _cur_builder->Finish(&_arrays[_cur_field_idx]);
-        if (!arrow_st.ok()) {
-            return to_doris_status(arrow_st);
+        if (null_count > 0) {
+            buffers[0] = std::move(*bitmap);
         }
     }
-    *out = arrow::RecordBatch::Make(_schema, _block.rows(), std::move(_arrays));
+    *array = arrow::MakeArray(arrow::ArrayData::Make(arrow_type, static_cast<int64_t>(num_rows),
+                                                     std::move(buffers), null_count));
+    *shared = true;
     return Status::OK();
 }
 
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj) {
-    FromBlockConverter converter(block, schema, pool, timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy,
+                              bool use_threads) {
+    FromBlockConverter converter(block, schema, pool, timezone_obj, zero_copy, use_threads);
     return converter.convert(result);
 }
 
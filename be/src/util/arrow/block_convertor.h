@@ -38,9 +38,14 @@ class Schema;
 
 namespace doris {
 
+// If `zero_copy` is true, the numeric and string columns whose layouts are the same as arrow's
+// are wrapped as the arrays of the result without copy. The result then keeps these columns
+// alive, and they must not be modified while it is alive.
+// If `use_threads` is true, the columns are converted in parallel by the arrow cpu thread pool.
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy = false,
+                              bool use_threads = false);
 
 } // namespace doris
@@ -138,6 +138,14 @@ public:
         return *this;
     }
 
+    /**
+     * Move assignment operator, so that the results of fastunion are not copied.
+     */
+    Roaring64Map& operator=(Roaring64Map&& r) noexcept {
+        roarings = std::move(r.roarings);
+        return *this;
+    }
+
     /**
      * Add value x
      *
@@ -1329,8 +1337,13 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                for (const auto* bitmap : bitmaps) {
-                    *_bitmap |= *bitmap;
+                if (bitmaps.size() == 1) {
+                    *_bitmap |= *bitmaps[0];
+                } else {
+                    // union all the containers of a key at once, the cardinality is only
+                    // computed for the result instead of after every input.
+                    bitmaps.push_back(_bitmap.get());
+                    *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
                 }
                 break;
             case SET: {
@@ -2124,6 +2137,9 @@ public:
 
     bool empty() const { return _type == EMPTY; }
 
+    // Whether the values are kept in a roaring bitmap, which is shared instead of copied.
+    bool is_roaring() const { return _type == BITMAP; }
+
     /**
      * Return new set with specified range (not include the range_end)
      */
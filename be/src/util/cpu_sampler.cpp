@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/cpu_sampler.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "common/logging.h"
+#include "common/phdr_cache.h"
+#include "common/signal_handler.h"
+#include "common/stack_trace.h"
+#include "common/symbol_index.h"
+#include "vec/common/demangle.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+// A real time signal which is not used by the BE, gperftools and the JVM, so that the sampler
+// does not interfere with the CPU profile of pprof, which uses SIGPROF.
+int sample_signal() {
+    return SIGRTMIN + 4;
+}
+
+std::string symbol_name(const void* address) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    if (const auto* symbol = SymbolIndex::instance()->findSymbol(address)) {
+        std::string name = demangle(symbol->name);
+        // ';' separates the frames of a folded stack.
+        std::replace(name.begin(), name.end(), ';', ',');
+        return name;
+    }
+#endif
+    return fmt::format("{}", address);
+}
+
+} // namespace
+
+CpuSampler* CpuSampler::instance() {
+    static CpuSampler sampler;
+    return &sampler;
+}
+
+Status CpuSampler::start(int frequency, size_t capacity) {
+    std::lock_guard lock(_mutex);
+    if (started()) {
+        return Status::OK();
+    }
+    if (frequency <= 0 || frequency > 1000 || capacity == 0) {
+        return Status::InvalidArgument("invalid cpu sampler frequency {} or capacity {}",
+                                       frequency, capacity);
+    }
+    // The stacks are unwound in the signal handler, which is safe only if the unwinder does not
+    // take the lock of dl_iterate_phdr.
+    updatePHDRCache();
+    if (!hasPHDRCache()) {
+        return Status::NotSupported("cpu sampler needs the phdr cache, which is not available");
+    }
+    if (_samples == nullptr) {
+        _samples = std::make_unique<Sample[]>(capacity);
+        _capacity = capacity;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = &CpuSampler::_signal_handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(sample_signal(), &action, nullptr) != 0) {
+        return Status::InternalError("failed to set the cpu sampler signal handler, errno={}",
+                                     errno);
+    }
+
+    struct sigevent event;
+    memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = sample_signal();
+    // The timer of the CPU time of the process signals the thread running when it expires.
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &_timer) != 0) {
+        return Status::InternalError("failed to create the cpu sampler timer, errno={}", errno);
+    }
+    _started.store(true, std::memory_order_relaxed);
+    struct itimerspec interval;
+    interval.it_interval.tv_sec = 0;
+    interval.it_interval.tv_nsec = 1000000000L / frequency;
+    interval.it_value = interval.it_interval;
+    if (timer_settime(_timer, 0, &interval, nullptr) != 0) {
+        _started.store(false, std::memory_order_relaxed);
+        timer_delete(_timer);
+        return Status::InternalError("failed to start the cpu sampler timer, errno={}", errno);
+    }
+    LOG(INFO) << "cpu sampler started, frequency=" << frequency << ", capacity=" << capacity;
+    return Status::OK();
+}
+
+void CpuSampler::stop() {
+    std::lock_guard lock(_mutex);
+    if (!started()) {
+        return;
+    }
+    _started.store(false, std::memory_order_relaxed);
+    timer_delete(_timer);
+    LOG(INFO) << "cpu sampler stopped";
+}
+
+void CpuSampler::_signal_handler(int sig, siginfo_t* info, void* context) {
+    auto saved_errno = errno;
+    auto* sampler = instance();
+    if (sampler->started()) {
+        sampler->_take_sample(context);
+    }
+    errno = saved_errno;
+}
+
+void CpuSampler::_take_sample(void* context) {
+    StackTrace stack_trace(*reinterpret_cast<const ucontext_t*>(context));
+    auto& sample = _samples[_next_sample.fetch_add(1, std::memory_order_relaxed) % _capacity];
+    uint64_t version = sample.version.load(std::memory_order_relaxed);
+    // Skip the slot if another thread is writing it after the ring buffer wraps around.
+    if ((version & 1) != 0 || !sample.version.compare_exchange_strong(
+                                      version, version + 1, std::memory_order_acquire)) {
+        return;
+    }
+    timespec now;
+    clock_gettime(CLOCK_REALTIME_COARSE, &now);
+    sample.time_ms = now.tv_sec * 1000 + now.tv_nsec / 1000000;
+    sample.query_id_hi = signal::query_id_hi;
+    sample.query_id_lo = signal::query_id_lo;
+    sample.workload_group_id = signal::workload_group_id;
+    size_t num_frames = std::min(stack_trace.getSize() - stack_trace.getOffset(), MAX_FRAMES);
+    for (size_t i = 0; i < num_frames; ++i) {
+        sample.frames[i] = stack_trace.getFramePointers()[stack_trace.getOffset() + i];
+    }
+    sample.num_frames = num_frames;
+    sample.version.store(version + 2, std::memory_order_release);
+}
+
+std::string CpuSampler::folded_stacks(const Filter& filter) const {
+    if (_samples == nullptr) {
+        return "";
+    }
+    // The stacks from the root frame to the leaf frame.
+    std::map<std::vector<void*>, size_t> stacks;
+    for (size_t i = 0; i < _capacity; ++i) {
+        const auto& sample = _samples[i];
+        uint64_t version = sample.version.load(std::memory_order_acquire);
+        if (version == 0 || (version & 1) != 0) {
+            continue;
+        }
+        int64_t time_ms = sample.time_ms;
+        uint64_t query_id_hi = sample.query_id_hi;
+        uint64_t query_id_lo = sample.query_id_lo;
+        uint64_t workload_group_id = sample.workload_group_id;
+        std::vector<void*> frames(sample.frames,
+                                  sample.frames + std::min(sample.num_frames, MAX_FRAMES));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sample.version.load(std::memory_order_relaxed) != version) {
+            continue;
+        }
+        if (time_ms < filter.start_time_ms || time_ms > filter.end_time_ms ||
+            (filter.query_id.has_value() &&
+             (static_cast<int64_t>(query_id_hi) != filter.query_id->hi ||
+              static_cast<int64_t>(query_id_lo) != filter.query_id->lo)) ||
+            (filter.workload_group_id.has_value() &&
+             workload_group_id != *filter.workload_group_id)) {
+            continue;
+        }
+        std::reverse(frames.begin(), frames.end());
+        ++stacks[std::move(frames)];
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    std::string result;
+    for (const auto& [frames, count] : stacks) {
+        for (size_t i = 0; i < frames.size(); ++i) {
+            auto [iter, inserted] = symbols.try_emplace(frames[i]);
+            if (inserted) {
+                iter->second = symbol_name(frames[i]);
+            }
+            if (i > 0) {
+                result.push_back(';');
+            }
+            result.append(iter->second);
+        }
+        result.append(fmt::format(" {}\n", count));
+    }
+    return result;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <atomic>
+#include <csignal>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "common/status.h"
+
+namespace doris {
+
+// Samples the stacks of the threads of the process at a low frequency of its CPU time, like a
+// sampling profiler which is always on. Each sample is tagged with the query and the workload
+// group of the task attached to the thread. The samples are kept in a ring buffer and folded
+// into the stacks of a flame graph by query, workload group and time window.
+//
+// The samples are taken in a signal handler of a process CPU time timer, so a thread is sampled
+// in proportion to the CPU it uses.
+class CpuSampler {
+public:
+    struct Filter {
+        // All queries if not set.
+        std::optional<TUniqueId> query_id;
+        // All workload groups if not set.
+        std::optional<uint64_t> workload_group_id;
+        // Samples taken in [start_time_ms, end_time_ms], unix time in ms.
+        int64_t start_time_ms = 0;
+        int64_t end_time_ms = INT64_MAX;
+    };
+
+    static CpuSampler* instance();
+
+    // `frequency` is the number of samples per second of the CPU time of the process, the ring
+    // buffer keeps the latest `capacity` samples.
+    Status start(int frequency, size_t capacity);
+    // The samples taken before are kept.
+    void stop();
+    bool started() const { return _started.load(std::memory_order_relaxed); }
+
+    // Returns the folded stacks of the samples which match the filter, one stack per line with
+    // the frames from the root separated by ';' followed by the number of the samples, which is
+    // the input of flamegraph.pl and speedscope.
+    std::string folded_stacks(const Filter& filter) const;
+
+private:
+    static constexpr size_t MAX_FRAMES = 32;
+
+    struct Sample {
+        // Odd while the sample is being written.
+        std::atomic<uint64_t> version {0};
+        int64_t time_ms = 0;
+        uint64_t query_id_hi = 0;
+        uint64_t query_id_lo = 0;
+        uint64_t workload_group_id = 0;
+        size_t num_frames = 0;
+        void* frames[MAX_FRAMES];
+    };
+
+    static void _signal_handler(int sig, siginfo_t* info, void* context);
+    void _take_sample(void* context);
+
+    std::mutex _mutex;
+    std::atomic<bool> _started {false};
+    // Allocated on the first start and never freed, since a signal may be handled after stop.
+    std::unique_ptr<Sample[]> _samples;
+    size_t _capacity = 0;
+    std::atomic<uint64_t> _next_sample {0};
+    timer_t _timer {};
+};
+
+} // namespace doris
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
+#include <vector>
 
 #include "common/status.h"
 #include "roaring/roaring.hh"
@@ -42,6 +43,16 @@ public:
 
     uint32_t minimum() const { return _roaring_bitmap.minimum(); }
 
+    uint64_t cardinality() const { return _roaring_bitmap.cardinality(); }
+
+    // Appends the deleted positions in ascending order.
+    void to_positions(std::vector<int64_t>* positions) const {
+        positions->reserve(positions->size() + _roaring_bitmap.cardinality());
+        for (uint32_t position : _roaring_bitmap) {
+            positions->push_back(position);
+        }
+    }
+
     static Result<DeletionVector> deserialize(const char* buf, size_t length) {
         uint32_t actual_length;
         std::memcpy(reinterpret_cast<char*>(&actual_length), buf, 4);
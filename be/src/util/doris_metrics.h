@@ -219,6 +219,9 @@ public:
     UIntGauge* query_cache_memory_total_byte = nullptr;
     UIntGauge* query_cache_sql_total_count = nullptr;
     UIntGauge* query_cache_partition_total_count = nullptr;
+    // the partitions requested by the fetches of the partition cache, served or not from it
+    IntCounter* query_cache_partition_hit_count = nullptr;
+    IntCounter* query_cache_partition_miss_count = nullptr;
 
     // Upload metrics
     UIntGauge* upload_total_byte = nullptr;
@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "common/logging.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+namespace {
+// The symbols are learned from at most this many bytes of the values.
+constexpr size_t SAMPLE_BYTES = 16 * 1024;
+constexpr int BUILD_ROUNDS = 5;
+// A unit of a parsed string is a symbol code, or LITERAL_UNIT + byte for an escaped byte.
+constexpr uint32_t LITERAL_UNIT = 256;
+constexpr uint32_t UNIT_NUM = 512;
+} // namespace
+
+void FsstSymbolTable::build(const Slice* values, size_t count) {
+    _symbol_num = 0;
+    _finish_build();
+
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total_bytes += values[i].size;
+    }
+    size_t stride = std::max<size_t>(1, total_bytes / SAMPLE_BYTES);
+    std::vector<Slice> sample;
+    for (size_t i = 0; i < count; i += stride) {
+        sample.push_back(values[i]);
+    }
+
+    std::vector<uint64_t> unit_counts(UNIT_NUM);
+    std::unordered_map<uint32_t, uint64_t> pair_counts;
+    std::unordered_map<std::string, uint64_t> gains;
+    auto unit_string = [this](uint32_t unit) {
+        if (unit >= LITERAL_UNIT) {
+            return std::string(1, static_cast<char>(unit - LITERAL_UNIT));
+        }
+        return std::string(reinterpret_cast<const char*>(&_symbols[unit]), _lengths[unit]);
+    };
+
+    // Each round parses the sample with the current symbols, and takes the single units and
+    // the pairs of adjacent units which cover the most bytes as the next symbols.
+    for (int round = 0; round < BUILD_ROUNDS; ++round) {
+        std::fill(unit_counts.begin(), unit_counts.end(), 0);
+        pair_counts.clear();
+        for (const Slice& value : sample) {
+            const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+            size_t pos = 0;
+            uint32_t prev_unit = UNIT_NUM;
+            while (pos < value.size) {
+                uint8_t code = _find_longest_symbol(data + pos, value.size - pos);
+                uint32_t unit = code;
+                if (code == ESCAPE_CODE) {
+                    unit = LITERAL_UNIT + data[pos];
+                    pos += 1;
+                } else {
+                    pos += _lengths[code];
+                }
+                unit_counts[unit]++;
+                if (prev_unit != UNIT_NUM) {
+                    pair_counts[prev_unit * UNIT_NUM + unit]++;
+                }
+                prev_unit = unit;
+            }
+        }
+
+        gains.clear();
+        for (uint32_t unit = 0; unit < UNIT_NUM; ++unit) {
+            if (unit_counts[unit] > 0) {
+                std::string symbol = unit_string(unit);
+                gains[symbol] += unit_counts[unit] * symbol.size();
+            }
+        }
+        for (const auto& [pair, pair_count] : pair_counts) {
+            std::string symbol = unit_string(pair / UNIT_NUM) + unit_string(pair % UNIT_NUM);
+            if (symbol.size() > MAX_SYMBOL_LENGTH) {
+                symbol.resize(MAX_SYMBOL_LENGTH);
+            }
+            gains[symbol] += pair_count * symbol.size();
+        }
+
+        std::vector<std::pair<uint64_t, std::string>> candidates;
+        candidates.reserve(gains.size());
+        for (auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, symbol);
+        }
+        size_t symbol_num = std::min(MAX_SYMBOL_NUM, candidates.size());
+        auto middle = candidates.begin() + static_cast<ptrdiff_t>(symbol_num);
+        std::partial_sort(candidates.begin(), middle, candidates.end(),
+                          [](const auto& lhs, const auto& rhs) {
+                              return lhs.first != rhs.first ? lhs.first > rhs.first
+                                                            : lhs.second < rhs.second;
+                          });
+        _symbol_num = 0;
+        for (size_t i = 0; i < symbol_num; ++i) {
+            const std::string& symbol = candidates[i].second;
+            _add_symbol(reinterpret_cast<const uint8_t*>(symbol.data()), symbol.size());
+        }
+        _finish_build();
+    }
+}
+
+void FsstSymbolTable::compress(const Slice& input, faststring* output) const {
+    size_t old_size = output->size();
+    // An escaped byte takes two bytes.
+    output->resize(old_size + input.size * 2);
+    uint8_t* out = output->data() + old_size;
+    const auto* data = reinterpret_cast<const uint8_t*>(input.data);
+    size_t pos = 0;
+    while (pos < input.size) {
+        uint8_t code = _find_longest_symbol(data + pos, input.size - pos);
+        *out++ = code;
+        if (code == ESCAPE_CODE) {
+            *out++ = data[pos];
+            pos += 1;
+        } else {
+            pos += _lengths[code];
+        }
+    }
+    output->resize(static_cast<size_t>(out - output->data()));
+}
+
+size_t FsstSymbolTable::decompress(const uint8_t* input, size_t input_len, uint8_t* output) const {
+    const uint8_t* end = input + input_len;
+    uint8_t* out = output;
+    while (input < end) {
+        uint8_t code = *input++;
+        if (code != ESCAPE_CODE) [[likely]] {
+            // A code never expands to more than 8 bytes, so the store stays in the bound.
+            memcpy(out, &_symbols[code], MAX_SYMBOL_LENGTH);
+            out += _lengths[code];
+        } else if (input < end) {
+            *out++ = *input++;
+        }
+    }
+    return static_cast<size_t>(out - output);
+}
+
+void FsstSymbolTable::serialize(faststring* output) const {
+    output->push_back(static_cast<char>(_symbol_num));
+    for (size_t code = 0; code < _symbol_num; ++code) {
+        output->push_back(static_cast<char>(_lengths[code]));
+    }
+    for (size_t code = 0; code < _symbol_num; ++code) {
+        output->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+bool FsstSymbolTable::deserialize(const uint8_t* input, size_t input_len, size_t* size) {
+    if (input_len < 1) {
+        return false;
+    }
+    size_t symbol_num = input[0];
+    if (symbol_num > MAX_SYMBOL_NUM || input_len < 1 + symbol_num) {
+        return false;
+    }
+    const uint8_t* lengths = input + 1;
+    const uint8_t* symbols = lengths + symbol_num;
+    size_t symbols_size = 0;
+    for (size_t code = 0; code < symbol_num; ++code) {
+        if (lengths[code] == 0 || lengths[code] > MAX_SYMBOL_LENGTH) {
+            return false;
+        }
+        symbols_size += lengths[code];
+    }
+    if (input_len < 1 + symbol_num + symbols_size) {
+        return false;
+    }
+    _symbol_num = 0;
+    for (size_t code = 0; code < symbol_num; ++code) {
+        _add_symbol(symbols, lengths[code]);
+        symbols += lengths[code];
+    }
+    _finish_build();
+    *size = 1 + symbol_num + symbols_size;
+    return true;
+}
+
+void FsstSymbolTable::_add_symbol(const uint8_t* data, size_t len) {
+    DCHECK(len > 0 && len <= MAX_SYMBOL_LENGTH);
+    DCHECK_LT(_symbol_num, MAX_SYMBOL_NUM);
+    _symbols[_symbol_num] = 0;
+    memcpy(&_symbols[_symbol_num], data, len);
+    _lengths[_symbol_num] = static_cast<uint8_t>(len);
+    _symbol_num++;
+}
+
+void FsstSymbolTable::_finish_build() {
+    for (size_t code = _symbol_num; code <= MAX_SYMBOL_NUM; ++code) {
+        _symbols[code] = 0;
+        _lengths[code] = 0;
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        codes.clear();
+    }
+    for (size_t code = 0; code < _symbol_num; ++code) {
+        auto first_byte = reinterpret_cast<const uint8_t*>(&_symbols[code])[0];
+        _codes_by_first_byte[first_byte].push_back(static_cast<uint8_t>(code));
+    }
+    for (auto& codes : _codes_by_first_byte) {
+        std::stable_sort(codes.begin(), codes.end(), [this](uint8_t lhs, uint8_t rhs) {
+            return _lengths[lhs] > _lengths[rhs];
+        });
+    }
+}
+
+uint8_t FsstSymbolTable::_find_longest_symbol(const uint8_t* data, size_t len) const {
+    for (uint8_t code : _codes_by_first_byte[data[0]]) {
+        if (_lengths[code] <= len && memcmp(data, &_symbols[code], _lengths[code]) == 0) {
+            return code;
+        }
+    }
+    return ESCAPE_CODE;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris
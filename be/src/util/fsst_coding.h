@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/slice.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// Fast static symbol table (FSST) compression of short strings.
+//
+// A symbol table maps up to 255 codes to symbols of 1 to 8 bytes, which are learned from a
+// sample of the strings. A string is compressed to one code byte per symbol, greedily taking
+// the longest symbol at each position, the bytes not covered by a symbol are stored as
+// ESCAPE_CODE followed by the byte. Every string is compressed on its own, so it can be
+// decompressed without the others.
+//
+// The compression is deterministic, so two strings are equal iff their compressed bytes are
+// equal, and an equality predicate can be evaluated on the compressed strings.
+//
+// Serialized table:
+//   SymbolNum(1) SymbolLengths(SymbolNum) Symbols(sum of SymbolLengths)
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE_CODE = 255;
+    static constexpr size_t MAX_SYMBOL_NUM = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+
+    FsstSymbolTable() = default;
+
+    // Learns the symbols from a sample of the values.
+    void build(const Slice* values, size_t count);
+
+    size_t symbol_num() const { return _symbol_num; }
+
+    // Appends the compressed bytes of `input` to `output`.
+    void compress(const Slice& input, faststring* output) const;
+
+    // The output of decompress must have room for this many bytes.
+    static size_t decompress_bound(size_t compressed_len) {
+        return compressed_len * MAX_SYMBOL_LENGTH;
+    }
+
+    // Returns the length of the decompressed string, `output` must have room for
+    // decompress_bound(input_len) bytes.
+    size_t decompress(const uint8_t* input, size_t input_len, uint8_t* output) const;
+
+    void serialize(faststring* output) const;
+
+    // Returns false if the table is broken, `*size` is set to the bytes of the table.
+    bool deserialize(const uint8_t* input, size_t input_len, size_t* size);
+
+private:
+    void _add_symbol(const uint8_t* data, size_t len);
+    void _finish_build();
+    // Returns the code of the longest symbol at the beginning of `data`, or ESCAPE_CODE.
+    uint8_t _find_longest_symbol(const uint8_t* data, size_t len) const;
+
+    size_t _symbol_num = 0;
+    // The symbols are zero padded to 8 bytes, so they are copied with one 8 bytes store.
+    uint64_t _symbols[MAX_SYMBOL_NUM + 1] = {};
+    uint8_t _lengths[MAX_SYMBOL_NUM + 1] = {};
+    // The codes of the symbols starting with a byte, longer symbols first.
+    std::vector<uint8_t> _codes_by_first_byte[256];
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/instrumented_mutex.h"
+
+#include <memory>
+#include <unordered_map>
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+LockContentionStats* LockContentionStats::get(const std::string& name) {
+    static std::mutex registry_mutex;
+    static auto* registry =
+            new std::unordered_map<std::string, std::unique_ptr<LockContentionStats>>();
+    std::lock_guard lock(registry_mutex);
+    auto& stats = (*registry)[name];
+    if (stats == nullptr) {
+        stats.reset(new LockContentionStats(name));
+    }
+    return stats.get();
+}
+
+LockContentionStats::LockContentionStats(const std::string& name)
+        : _wait_us("lock_contention", name + "_wait_us"),
+          _hold_us("lock_contention", name + "_hold_us") {}
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bvar/bvar.h>
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+#include "common/compile_check_begin.h"
+
+// The contention of a named group of mutexes, e.g. the shards of the tablet map. The stats are
+// exposed as the bvars `lock_contention_<name>_wait_us` and `lock_contention_<name>_hold_us`.
+class LockContentionStats {
+public:
+    // Returns the stats of the name, which are created on the first call and never destroyed.
+    static LockContentionStats* get(const std::string& name);
+
+    void record_wait(int64_t wait_ns) { _wait_us << wait_ns / 1000; }
+    void record_hold(int64_t hold_ns) { _hold_us << hold_ns / 1000; }
+
+private:
+    explicit LockContentionStats(const std::string& name);
+
+    bvar::LatencyRecorder _wait_us;
+    bvar::LatencyRecorder _hold_us;
+};
+
+// A mutex recording its contention into the stats of its name. An uncontended lock costs a
+// try_lock, the wait is timed only when the try_lock fails. The hold time is sampled from one of
+// every `lock_contention_hold_sample_interval` exclusive acquisitions, the shared acquisitions
+// only record their waits.
+template <typename Mutex>
+class InstrumentedMutexBase {
+public:
+    explicit InstrumentedMutexBase(const std::string& name)
+            : _stats(LockContentionStats::get(name)) {}
+
+    InstrumentedMutexBase(const InstrumentedMutexBase&) = delete;
+    InstrumentedMutexBase& operator=(const InstrumentedMutexBase&) = delete;
+
+    void lock() {
+        if (!_mutex.try_lock()) {
+            int64_t start = MonotonicNanos();
+            _mutex.lock();
+            _stats->record_wait(MonotonicNanos() - start);
+        }
+        _on_locked();
+    }
+
+    bool try_lock() {
+        if (!_mutex.try_lock()) {
+            return false;
+        }
+        _on_locked();
+        return true;
+    }
+
+    void unlock() {
+        int64_t hold_start = _hold_start;
+        _mutex.unlock();
+        if (UNLIKELY(hold_start != 0)) {
+            _stats->record_hold(MonotonicNanos() - hold_start);
+        }
+    }
+
+    void lock_shared()
+        requires requires(Mutex& m) { m.lock_shared(); }
+    {
+        if (!_mutex.try_lock_shared()) {
+            int64_t start = MonotonicNanos();
+            _mutex.lock_shared();
+            _stats->record_wait(MonotonicNanos() - start);
+        }
+    }
+
+    bool try_lock_shared()
+        requires requires(Mutex& m) { m.try_lock_shared(); }
+    {
+        return _mutex.try_lock_shared();
+    }
+
+    void unlock_shared()
+        requires requires(Mutex& m) { m.unlock_shared(); }
+    {
+        _mutex.unlock_shared();
+    }
+
+private:
+    // Called with the mutex held exclusively, so the sampling state needs no atomics.
+    void _on_locked() {
+        int32_t interval = config::lock_contention_hold_sample_interval;
+        if (UNLIKELY(interval > 0 && ++_acquisitions >= interval)) {
+            _acquisitions = 0;
+            _hold_start = MonotonicNanos();
+        } else {
+            _hold_start = 0;
+        }
+    }
+
+    Mutex _mutex;
+    LockContentionStats* _stats;
+    int32_t _acquisitions = 0;
+    int64_t _hold_start = 0;
+};
+
+using InstrumentedMutex = InstrumentedMutexBase<std::mutex>;
+using InstrumentedSharedMutex = InstrumentedMutexBase<std::shared_mutex>;
+
+#include "common/compile_check_end.h"
+} // namespace doris
@@ -24,7 +24,7 @@
 #include "util/jsonb_writer.h"
 
 namespace doris {
-JsonbFindResult JsonbValue::findValue(JsonbPath& path) const {
+JsonbFindResult JsonbValue::findValue(JsonbPath& path, size_t begin_leg) const {
     JsonbFindResult result;
     bool is_wildcard = false;
 
@@ -32,7 +32,7 @@ JsonbFindResult JsonbValue::findValue(JsonbPath& path) const {
     std::vector<const JsonbValue*> results;
     results.emplace_back(this);
 
-    for (size_t i = 0; i < path.get_leg_vector_size(); ++i) {
+    for (size_t i = begin_leg; i < path.get_leg_vector_size(); ++i) {
         values.assign(results.begin(), results.end());
         results.clear();
         for (const auto* pval : values) {
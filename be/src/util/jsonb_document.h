@@ -71,6 +71,7 @@
 #include <charconv>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -683,8 +684,8 @@ struct JsonbValue {
     //Whether to include the jsonbvalue rhs
     bool contains(JsonbValue* rhs) const;
 
-    // find the JSONB value by JsonbPath
-    JsonbFindResult findValue(JsonbPath& path) const;
+    // find the JSONB value by JsonbPath, starting from the leg at begin_leg
+    JsonbFindResult findValue(JsonbPath& path, size_t begin_leg = 0) const;
     friend class JsonbDocument;
 
     JsonbType type; // type info
@@ -1018,7 +1019,7 @@ private:
 
         while (pch < fence) {
             auto* pkey = (JsonbKeyValue*)(pch);
-            if (klen == pkey->klen() && strncmp(key, pkey->getKeyStr(), klen) == 0) {
+            if (klen == pkey->klen() && memcmp(key, pkey->getKeyStr(), klen) == 0) {
                 return iterator(pkey);
             }
             pch += pkey->numPackedBytes();
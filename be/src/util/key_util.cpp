@@ -29,4 +29,16 @@ bool key_is_not_in_segment(Slice key, const KeyBoundsPB& segment_key_bounds,
                                                      is_segments_key_bounds_truncated, key, false);
     return res1 || res2;
 }
+
+bool key_range_is_not_in_segment(Slice min_key, Slice max_key,
+                                 const KeyBoundsPB& segment_key_bounds,
+                                 bool is_segments_key_bounds_truncated) {
+    Slice maybe_truncated_min_key {segment_key_bounds.min_key()};
+    Slice maybe_truncated_max_key {segment_key_bounds.max_key()};
+    bool res1 = Slice::lhs_is_strictly_less_than_rhs(max_key, false, maybe_truncated_min_key,
+                                                     is_segments_key_bounds_truncated);
+    bool res2 = Slice::lhs_is_strictly_less_than_rhs(
+            maybe_truncated_max_key, is_segments_key_bounds_truncated, min_key, false);
+    return res1 || res2;
+}
 } // namespace doris
\ No newline at end of file
@@ -112,4 +112,9 @@ void encode_key(std::string* buf, const RowType& row, size_t num_keys) {
 bool key_is_not_in_segment(Slice key, const KeyBoundsPB& segment_key_bounds,
                            bool is_segments_key_bounds_truncated);
 
+// same as key_is_not_in_segment, but for all the keys in [min_key, max_key]
+bool key_range_is_not_in_segment(Slice min_key, Slice max_key,
+                                 const KeyBoundsPB& segment_key_bounds,
+                                 bool is_segments_key_bounds_truncated);
+
 } // namespace doris
@@ -19,10 +19,11 @@
 
 namespace doris {
 
-ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards)
-        : LRUCachePolicy(CachePolicy::CacheType::COMMON_OBJ_LRU_CACHE, capacity,
-                         LRUCacheType::NUMBER, config::common_obj_lru_cache_stale_sweep_time_sec,
-                         num_shards) {
+ObjLRUCache::ObjLRUCache(int64_t capacity, LRUCacheType lru_cache_type, uint32_t num_shards,
+                         uint32_t element_count_capacity)
+        : LRUCachePolicy(CachePolicy::CacheType::COMMON_OBJ_LRU_CACHE, capacity, lru_cache_type,
+                         config::common_obj_lru_cache_stale_sweep_time_sec, num_shards,
+                         element_count_capacity) {
     _enabled = (capacity > 0);
 }
 
@@ -46,6 +47,9 @@ void ObjLRUCache::erase(const ObjKey& key) {
 }
 
 bool ObjLRUCache::exceed_prune_limit() {
+    if (_lru_cache_type == LRUCacheType::SIZE) {
+        return LRUCachePolicy::exceed_prune_limit();
+    }
     // just return true to prune all cached obj.
     // Because ObjLRUCache is counted with number, not memory.
     // Simple prune all
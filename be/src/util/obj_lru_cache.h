@@ -23,7 +23,8 @@
 namespace doris {
 
 // A common object cache depends on an Sharded LRU Cache.
-// It has a certain capacity, which determin how many objects it can cache.
+// It has a certain capacity, which determin how many objects it can cache, or how many bytes
+// the cached objects can take if it is a LRUCacheType::SIZE cache.
 // Caller must hold a CacheHandle instance when visiting the cached object.
 class ObjLRUCache : public LRUCachePolicy {
 public:
@@ -85,16 +86,22 @@ public:
         DISALLOW_COPY_AND_ASSIGN(CacheHandle);
     };
 
-    ObjLRUCache(int64_t capacity, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS);
+    ObjLRUCache(int64_t capacity, LRUCacheType lru_cache_type = LRUCacheType::NUMBER,
+                uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS,
+                uint32_t element_count_capacity = DEFAULT_LRU_CACHE_ELEMENT_COUNT_CAPACITY);
 
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
+    // `mem_size` is the memory taken by the value, it is the charge of the value in a
+    // LRUCacheType::SIZE cache.
     template <typename T>
-    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle) {
+    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle,
+                size_t mem_size = sizeof(T)) {
         if (_enabled) {
             const std::string& encoded_key = key.key;
             auto* obj_value = new ObjValue<T>(value);
-            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, sizeof(T),
+            size_t charge = _lru_cache_type == LRUCacheType::SIZE ? mem_size : 1;
+            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, charge, mem_size,
                                                   CachePriority::NORMAL);
             *cache_handle = CacheHandle {this, handle};
         } else {
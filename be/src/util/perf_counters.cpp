@@ -71,6 +71,73 @@ static inline auto sys_perf_event_open(struct perf_event_attr* attr, pid_t pid,
     return syscall(__NR_perf_event_open, attr, pid, cpu, group_fd, flags);
 }
 
+namespace {
+
+constexpr int NUM_THREAD_PERF_COUNTERS = 4;
+
+// The counters of a thread in one group, so that they are read by one syscall.
+struct ThreadPerfCounterGroup {
+    ~ThreadPerfCounterGroup() {
+        for (int fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    bool open() {
+        static constexpr uint64_t configs[NUM_THREAD_PERF_COUNTERS] = {
+                PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+                PERF_COUNT_HW_BRANCH_MISSES};
+        for (int i = 0; i < NUM_THREAD_PERF_COUNTERS; ++i) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(perf_event_attr));
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.read_format = PERF_FORMAT_GROUP;
+            // Counting the user space only is allowed with perf_event_paranoid 2.
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            auto fd = sys_perf_event_open(&attr, 0, -1, i == 0 ? -1 : fds[0], 0);
+            if (fd < 0) {
+                return false;
+            }
+            fds[i] = static_cast<int>(fd);
+        }
+        return true;
+    }
+
+    int fds[NUM_THREAD_PERF_COUNTERS] = {-1, -1, -1, -1};
+    bool opened = false;
+    bool available = false;
+};
+
+thread_local ThreadPerfCounterGroup thread_perf_counter_group;
+
+} // namespace
+
+bool ThreadPerfCounters::read(Values* values) {
+    auto& group = thread_perf_counter_group;
+    if (!group.opened) {
+        group.opened = true;
+        group.available = group.open();
+    }
+    if (!group.available) {
+        return false;
+    }
+    // The number of the counters followed by their values.
+    uint64_t buffer[NUM_THREAD_PERF_COUNTERS + 1];
+    if (::read(group.fds[0], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+        buffer[0] != NUM_THREAD_PERF_COUNTERS) {
+        return false;
+    }
+    values->cycles = static_cast<int64_t>(buffer[1]);
+    values->instructions = static_cast<int64_t>(buffer[2]);
+    values->llc_misses = static_cast<int64_t>(buffer[3]);
+    values->branch_misses = static_cast<int64_t>(buffer[4]);
+    return true;
+}
+
 // Remap PerfCounters::Counter to Linux kernel enums
 static bool init_event_attr(perf_event_attr* attr, PerfCounters::Counter counter) {
     memset(attr, 0, sizeof(perf_event_attr));
@@ -173,4 +173,21 @@ private:
     static int64_t _vm_peak;
 };
 
+// The hardware counters of the calling thread, which are read before and after a piece of work
+// running on the thread to attribute the cycles and misses to it. The counters are opened on the
+// first read of each thread. They are not available if the kernel does not allow them, e.g.
+// perf_event_paranoid is 3 or the process is in a container without perf events.
+class ThreadPerfCounters {
+public:
+    struct Values {
+        int64_t cycles = 0;
+        int64_t instructions = 0;
+        int64_t llc_misses = 0;
+        int64_t branch_misses = 0;
+    };
+
+    // Returns false if the counters of the calling thread are not available.
+    static bool read(Values* values);
+};
+
 } // namespace doris
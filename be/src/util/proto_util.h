@@ -18,8 +18,15 @@
 #pragma once
 
 #include <brpc/http_method.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "common/config.h"
 #include "common/status.h"
 #include "network_util.h"
@@ -127,11 +134,21 @@ Status request_embed_attachmentv2(Params* brpc_request, const std::string& data,
         return Status::MemoryAllocFailed("request embed attachment failed to memcpy {} bytes",
                                          data_size);
     }
-    // step3: attachment add to closure.
+    // step3: attachment add to closure, what was attached before is kept after the request.
+    attachment.append(closure->cntl_->request_attachment());
     closure->cntl_->request_attachment().swap(attachment);
     return Status::OK();
 }
 
+// Bytes at the head of the attachment taken by `request_embed_attachmentv2`.
+inline size_t attachment_embedded_request_size(const butil::IOBuf& io_buf) {
+    int64_t req_str_size = 0;
+    io_buf.copy_to(&req_str_size, sizeof(req_str_size), 0);
+    int64_t data_size = 0;
+    io_buf.copy_to(&data_size, sizeof(data_size), sizeof(req_str_size) + req_str_size);
+    return sizeof(req_str_size) + req_str_size + sizeof(data_size) + data_size;
+}
+
 // Extract the brpc request and block from the controller attachment,
 // and put the block into the request.
 template <typename Params>
@@ -169,4 +186,120 @@ Status attachment_extract_request(const Params* brpc_request, brpc::Controller*
     return Status::OK();
 }
 
+// IOBuf user data deleters only get the data pointer, so the strings referenced by a request
+// attachment are kept here until brpc has written them and releases the last reference.
+class AttachmentStringHolder {
+public:
+    static AttachmentStringHolder* instance() {
+        static AttachmentStringHolder holder;
+        return &holder;
+    }
+
+    char* hold(std::string&& data) {
+        auto str = std::make_unique<std::string>(std::move(data));
+        char* ptr = str->data();
+        std::lock_guard<std::mutex> l(_lock);
+        _strings.emplace(ptr, std::move(str));
+        return ptr;
+    }
+
+    static void release(void* ptr) {
+        auto* holder = instance();
+        std::unique_ptr<std::string> str;
+        std::lock_guard<std::mutex> l(holder->_lock);
+        auto it = holder->_strings.find(ptr);
+        DCHECK(it != holder->_strings.end());
+        if (it != holder->_strings.end()) {
+            // Destroy the string after unlock.
+            str = std::move(it->second);
+            holder->_strings.erase(it);
+        }
+    }
+
+private:
+    std::mutex _lock;
+    std::unordered_map<const void*, std::unique_ptr<std::string>> _strings;
+};
+
+// Move the column values of the blocks in `request` to the controller attachment without
+// copying them, so they are not serialized again with the request. For each of `blocks` and
+// then `block`, the attachment holds the length in int64 followed by the column values.
+inline Status request_embed_column_values_in_attachment(PTransmitDataParams* request,
+                                                        butil::IOBuf* attachment) {
+    auto embed = [&](PBlock* block) {
+        std::string* column_values = block->mutable_column_values();
+        int64_t size = column_values->size();
+        attachment->append(&size, sizeof(size));
+        if (size == 0) {
+            return Status::OK();
+        }
+        char* data = AttachmentStringHolder::instance()->hold(std::move(*column_values));
+        column_values->clear();
+        if (attachment->append_user_data(data, size, AttachmentStringHolder::release) != 0) {
+            AttachmentStringHolder::release(data);
+            return Status::InternalError("failed to append {} bytes of column values to attachment",
+                                         size);
+        }
+        return Status::OK();
+    };
+    for (int i = 0; i < request->blocks_size(); ++i) {
+        RETURN_IF_ERROR(embed(request->mutable_blocks(i)));
+    }
+    if (request->has_block()) {
+        RETURN_IF_ERROR(embed(request->mutable_block()));
+    }
+    return Status::OK();
+}
+
+// A broadcast request may be handed by the receiving backend to other local instances as well
+// (config::exchange_broadcast_once_per_host). They are put at the head of the attachment: the
+// negated count, which can not be a length of column values, then hi and lo of each instance.
+inline void request_embed_fanout_instances(const std::vector<TUniqueId>& instances,
+                                           butil::IOBuf* attachment) {
+    int64_t count = -static_cast<int64_t>(instances.size());
+    attachment->append(&count, sizeof(count));
+    for (const auto& instance : instances) {
+        attachment->append(&instance.hi, sizeof(instance.hi));
+        attachment->append(&instance.lo, sizeof(instance.lo));
+    }
+}
+
+// Cut the instances embedded by `request_embed_fanout_instances` out of the attachment, if any.
+inline Status attachment_extract_fanout_instances(butil::IOBuf* attachment,
+                                                  std::vector<TUniqueId>* instances) {
+    int64_t count = 0;
+    if (attachment->copy_to(&count, sizeof(count)) != sizeof(count) || count >= 0) {
+        return Status::OK();
+    }
+    attachment->pop_front(sizeof(count));
+    for (int64_t i = 0; i < -count; ++i) {
+        TUniqueId instance;
+        if (attachment->cutn(&instance.hi, sizeof(instance.hi)) != sizeof(instance.hi) ||
+            attachment->cutn(&instance.lo, sizeof(instance.lo)) != sizeof(instance.lo)) {
+            return Status::InternalError("invalid fan-out instances attachment, expect {} instances",
+                                         -count);
+        }
+        instances->push_back(instance);
+    }
+    return Status::OK();
+}
+
+// Cut the column values embedded by `request_embed_column_values_in_attachment` out of the
+// attachment, one IOBuf per block. Cutting only references the received buffers.
+inline Status attachment_extract_column_values(const PTransmitDataParams& request,
+                                               butil::IOBuf* attachment,
+                                               std::vector<butil::IOBuf>* column_values) {
+    column_values->resize(request.blocks_size() + (request.has_block() ? 1 : 0));
+    for (auto& values : *column_values) {
+        int64_t size = 0;
+        if (attachment->cutn(&size, sizeof(size)) != sizeof(size) || size < 0 ||
+            attachment->cutn(&values, size) != static_cast<size_t>(size)) {
+            return Status::InternalError(
+                    "invalid column values attachment, {} bytes left, expect {} bytes",
+                    attachment->size(), size);
+        }
+    }
+    return Status::OK();
+}
+
 } // namespace doris
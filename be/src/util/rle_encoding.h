@@ -680,6 +680,11 @@ public:
     // Returns the number of consumed values or 0 if an error occurred.
     uint32_t GetBatch(T* values, uint32_t batch_num);
 
+    // Skip 'num_values' values without unpacking them, except the literals of a batch of 32
+    // which is partially skipped.
+    // Returns the number of skipped values or 0 if an error occurred.
+    uint32_t SkipValues(uint32_t num_values);
+
 private:
     // Called when both 'literal_count_' and 'repeat_count_' have been exhausted.
     // Sets either 'literal_count_' or 'repeat_count_' to the size of the next literal
@@ -697,6 +702,10 @@ private:
     /// 'literal_count_'. Returns the number of literals outputted.
     int32_t OutputBufferedLiterals(int32_t max_to_output, T* values);
 
+    /// Skip 'num_literals_to_skip' literals of the current literal run, which must be
+    /// <= NextNumLiterals(). Return false if the input was truncated.
+    bool SkipLiteralValues(int32_t num_literals_to_skip) WARN_UNUSED_RESULT;
+
     BatchedBitReader bit_reader_;
 
     // Number of bits needed to encode the value. Must be between 0 and 64 after
@@ -866,5 +875,63 @@ uint32_t RleBatchDecoder<T>::GetBatch(T* values, uint32_t batch_num) {
     }
     return num_consumed;
 }
+
+template <typename T>
+bool RleBatchDecoder<T>::SkipLiteralValues(int32_t num_literals_to_skip) {
+    int32_t num_skipped = 0;
+    if (HaveBufferedLiterals()) {
+        num_skipped = std::min<int32_t>(num_literals_to_skip,
+                                        num_buffered_literals_ - literal_buffer_pos_);
+        literal_buffer_pos_ += num_skipped;
+        literal_count_ -= num_skipped;
+    }
+
+    int32_t num_remaining = num_literals_to_skip - num_skipped;
+    // Skip whole batches of 32 literals in the input, they end on a byte boundary.
+    int32_t num_to_bypass =
+            std::min<int32_t>(literal_count_, BitUtil::RoundDownToPowerOf2(num_remaining, 32));
+    if (num_to_bypass > 0) {
+        if (UNLIKELY(!bit_reader_.SkipBatch(bit_width_, num_to_bypass))) {
+            return false;
+        }
+        literal_count_ -= num_to_bypass;
+        num_remaining -= num_to_bypass;
+    }
+
+    if (num_remaining > 0) {
+        // The literals after the skipped ones are read from the buffer.
+        if (UNLIKELY(!FillLiteralBuffer())) {
+            return false;
+        }
+        literal_buffer_pos_ += num_remaining;
+        literal_count_ -= num_remaining;
+    }
+    return true;
+}
+
+template <typename T>
+uint32_t RleBatchDecoder<T>::SkipValues(uint32_t num_values) {
+    uint32_t num_skipped = 0;
+    while (num_skipped < num_values) {
+        uint32_t num_repeats = NextNumRepeats();
+        if (num_repeats > 0) {
+            int32_t num_repeats_to_skip = std::min(num_repeats, num_values - num_skipped);
+            GetRepeatedValue(num_repeats_to_skip);
+            num_skipped += num_repeats_to_skip;
+            continue;
+        }
+
+        uint32_t num_literals = NextNumLiterals();
+        if (num_literals == 0) {
+            break;
+        }
+        uint32_t num_literals_to_skip = std::min(num_literals, num_values - num_skipped);
+        if (!SkipLiteralValues(num_literals_to_skip)) {
+            return 0;
+        }
+        num_skipped += num_literals_to_skip;
+    }
+    return num_skipped;
+}
 #include "common/compile_check_end.h"
 } // namespace doris
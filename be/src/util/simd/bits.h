@@ -98,6 +98,31 @@ inline auto bytes_mask_to_bits_mask(const uint8_t* data) {
 #endif
 }
 
+// Returns the mask of the bits_mask_length() bytes from data which are equal to byte, in the
+// format of bytes_mask_to_bits_mask, it is iterated by iterate_through_bits_mask.
+inline auto bytes_equal_to_bits_mask(const uint8_t* data, uint8_t byte) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    return get_nibble_mask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+#elif defined(__AVX2__)
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+                              _mm256_set1_epi8(static_cast<char>(byte)))));
+#elif defined(__SSE2__)
+    auto bytes16 = _mm_set1_epi8(static_cast<char>(byte));
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), bytes16))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16)), bytes16)))
+            << 16);
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 32; ++i) {
+        mask |= static_cast<uint32_t>(byte == *(data + i)) << i;
+    }
+    return mask;
+#endif
+}
+
 inline constexpr auto bits_mask_all() {
 #if defined(__ARM_NEON) && defined(__aarch64__)
     return 0xffff'ffff'ffff'ffffULL;
@@ -125,6 +150,71 @@ void iterate_through_bits_mask(Func func, decltype(bytes_mask_to_bits_mask(nullp
 #endif
 }
 
+// Copies the elements of `src` at the bits set in `mask`, which is returned by
+// bytes_mask_to_bits_mask, to `dst` in order and returns the number of them. `dst` must have room
+// for bits_mask_length() elements, all of which may be written, and it may alias `src` if it does
+// not start after `src`, which is the case of filtering a column in place.
+template <typename T>
+inline size_t compress_by_bits_mask(const T* src, decltype(bytes_mask_to_bits_mask(nullptr)) mask,
+                                    T* dst) {
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    size_t count = 0;
+    iterate_through_bits_mask([&](const size_t idx) { dst[count++] = src[idx]; }, mask);
+    return count;
+#else
+    static_assert(bits_mask_length() == 32);
+    // All of the elements are loaded before any of them is stored, so that `dst` may alias `src`.
+#if defined(__AVX512F__)
+    if constexpr (sizeof(T) == 4) {
+        const auto low = static_cast<__mmask16>(mask);
+        const auto high = static_cast<__mmask16>(mask >> 16);
+        const __m512i low_values = _mm512_loadu_si512(src);
+        const __m512i high_values = _mm512_loadu_si512(src + 16);
+        const size_t low_count = __builtin_popcount(low);
+        _mm512_storeu_si512(dst, _mm512_maskz_compress_epi32(low, low_values));
+        _mm512_storeu_si512(dst + low_count, _mm512_maskz_compress_epi32(high, high_values));
+        return low_count + __builtin_popcount(high);
+    } else if constexpr (sizeof(T) == 8) {
+        __m512i values[4];
+        for (int i = 0; i < 4; ++i) {
+            values[i] = _mm512_loadu_si512(src + i * 8);
+        }
+        size_t count = 0;
+        for (int i = 0; i < 4; ++i) {
+            const auto lanes = static_cast<__mmask8>(mask >> (i * 8));
+            _mm512_storeu_si512(dst + count, _mm512_maskz_compress_epi64(lanes, values[i]));
+            count += __builtin_popcount(lanes);
+        }
+        return count;
+    }
+#endif
+#if defined(__AVX512VBMI2__) && defined(__AVX512VL__)
+    if constexpr (sizeof(T) == 1) {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst),
+                            _mm256_maskz_compress_epi8(mask, values));
+        return __builtin_popcount(mask);
+    } else if constexpr (sizeof(T) == 2) {
+        const __m512i values = _mm512_loadu_si512(src);
+        _mm512_storeu_si512(dst, _mm512_maskz_compress_epi16(mask, values));
+        return __builtin_popcount(mask);
+    }
+#endif
+    // A sparse mask is iterated by its set bits, a dense one is copied without branches, which
+    // does not pay the mispredictions of the bits.
+    size_t count = 0;
+    if (__builtin_popcount(mask) * 2 < bits_mask_length()) {
+        iterate_through_bits_mask([&](const size_t idx) { dst[count++] = src[idx]; }, mask);
+    } else {
+        for (size_t i = 0; i < bits_mask_length(); ++i) {
+            dst[count] = src[i];
+            count += (mask >> i) & 1;
+        }
+    }
+    return count;
+#endif
+}
+
 template <typename T>
     requires requires { std::is_unsigned_v<T>; }
 inline T count_zero_num(const int8_t* __restrict data, T size) {
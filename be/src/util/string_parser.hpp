@@ -29,6 +29,7 @@
 // IWYU pragma: no_include <bits/std_abs.h>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <map>
 #include <string>
@@ -300,6 +301,45 @@ public:
         return string_to_int_internal<T, enable_strict_mode>(s, len, result);
     }
 
+    // Parses the integers of 1 to 16 digits with an optional sign and without whitespaces, which
+    // are most of the integers in loads and casts, 8 digits at a time. Returns false if the string
+    // is in another form or the value overflows T, then string_to_int should be used to parse it
+    // or to report the error.
+    template <typename T>
+    static inline bool try_parse_plain_int(const char* __restrict s, size_t len, T* val) {
+        static_assert(std::is_signed_v<T> || std::is_same_v<T, __int128>);
+        bool negative = false;
+        if (len > 1 && (*s == '-' || *s == '+')) {
+            negative = *s == '-';
+            ++s;
+            --len;
+        }
+        if (len == 0 || len > 16) {
+            return false;
+        }
+        // Right-align the digits in 16 bytes padded by '0'.
+        char digits[16];
+        memset(digits, '0', sizeof(digits));
+        memcpy(digits + sizeof(digits) - len, s, len);
+        uint64_t high;
+        uint64_t low;
+        memcpy(&high, digits, sizeof(high));
+        memcpy(&low, digits + sizeof(high), sizeof(low));
+        if (!is_eight_digits(high) || !is_eight_digits(low)) {
+            return false;
+        }
+        uint64_t value = parse_eight_digits(high) * 100000000ULL + parse_eight_digits(low);
+        if constexpr (sizeof(T) < sizeof(int64_t)) {
+            if (value > static_cast<uint64_t>(std::numeric_limits<T>::max()) + negative) {
+                return false;
+            }
+        }
+        // value < 10^16, the negation can not overflow.
+        *val = static_cast<T>(negative ? -static_cast<int64_t>(value)
+                                       : static_cast<int64_t>(value));
+        return true;
+    }
+
     // This is considerably faster than glibc's implementation.
     // In the case of overflow, the max/min value for the data type will be returned.
     // Assumes s represents a decimal number.
@@ -390,6 +430,22 @@ public:
     static inline T string_to_int_no_overflow(const char* __restrict s, int len,
                                               ParseResult* result);
 
+    // Returns true if the 8 bytes are all ascii digits. A byte is a digit iff its high nibble is 3
+    // and adding 6 to it does not carry into the high nibble.
+    static inline bool is_eight_digits(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+               0x3333333333333333ULL;
+    }
+
+    // Converts 8 ascii digits loaded in little endian, the first digit is the most significant.
+    // Combines adjacent 1, 2 and 4 digit groups by 3 multiply-adds instead of 8.
+    static inline uint64_t parse_eight_digits(uint64_t chunk) {
+        chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+        chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        return ((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+    }
+
     // zero length, or at least one legal digit. at most consume MAX_LEN digits and stop. or stop when next
     // char is not a digit.
     template <typename T>
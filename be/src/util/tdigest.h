@@ -50,6 +50,7 @@
 #include <iostream>
 #include <memory>
 #include <queue>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -96,6 +97,9 @@ private:
     Weight _weight = 0;
 };
 
+// the centroids are serialized by memcpy
+static_assert(std::is_trivially_copyable_v<Centroid>);
+
 struct CentroidList {
     CentroidList(const std::vector<Centroid>& s) : iter(s.cbegin()), end(s.cend()) {}
     std::vector<Centroid>::const_iterator iter;
@@ -431,10 +435,11 @@ public:
         }
     }
 
+    // The cumulative weights are not serialized, they are recomputed from the processed
+    // centroids when the digest is read.
     uint32_t serialized_size() {
         return sizeof(uint32_t) + sizeof(Value) * 5 + sizeof(Index) * 2 + sizeof(uint32_t) * 3 +
-               _processed.size() * sizeof(Centroid) + _unprocessed.size() * sizeof(Centroid) +
-               _cumulative.size() * sizeof(Weight);
+               _processed.size() * sizeof(Centroid) + _unprocessed.size() * sizeof(Centroid);
     }
 
     size_t serialize(uint8_t* writer) {
@@ -457,30 +462,12 @@ public:
         memcpy(writer, &_unprocessed_weight, sizeof(Value));
         writer += sizeof(Value);
 
-        uint32_t size = _processed.size();
-        memcpy(writer, &size, sizeof(uint32_t));
-        writer += sizeof(uint32_t);
-        for (int i = 0; i < size; i++) {
-            memcpy(writer, &_processed[i], sizeof(Centroid));
-            writer += sizeof(Centroid);
-        }
-
-        size = _unprocessed.size();
-        memcpy(writer, &size, sizeof(uint32_t));
-        writer += sizeof(uint32_t);
-        //TODO(weixiang): may be once memcpy is enough!
-        for (int i = 0; i < size; i++) {
-            memcpy(writer, &_unprocessed[i], sizeof(Centroid));
-            writer += sizeof(Centroid);
-        }
+        writer = serialize_centroids(_processed, writer);
+        writer = serialize_centroids(_unprocessed, writer);
 
-        size = _cumulative.size();
+        uint32_t size = 0;
         memcpy(writer, &size, sizeof(uint32_t));
         writer += sizeof(uint32_t);
-        for (int i = 0; i < size; i++) {
-            memcpy(writer, &_cumulative[i], sizeof(Weight));
-            writer += sizeof(Weight);
-        }
         return writer - dst;
     }
 
@@ -504,30 +491,30 @@ public:
         memcpy(&_unprocessed_weight, type_reader, sizeof(Value));
         type_reader += sizeof(Value);
 
+        type_reader = unserialize_centroids(type_reader, _processed);
+        type_reader = unserialize_centroids(type_reader, _unprocessed);
+
+        // the digests serialized by the older versions still carry the cumulative weights
         uint32_t size;
         memcpy(&size, type_reader, sizeof(uint32_t));
         type_reader += sizeof(uint32_t);
-        _processed.resize(size);
-        for (int i = 0; i < size; i++) {
-            memcpy(&_processed[i], type_reader, sizeof(Centroid));
-            type_reader += sizeof(Centroid);
-        }
-        memcpy(&size, type_reader, sizeof(uint32_t));
-        type_reader += sizeof(uint32_t);
-        _unprocessed.resize(size);
-        for (int i = 0; i < size; i++) {
-            memcpy(&_unprocessed[i], type_reader, sizeof(Centroid));
-            type_reader += sizeof(Centroid);
-        }
-        memcpy(&size, type_reader, sizeof(uint32_t));
-        type_reader += sizeof(uint32_t);
-        _cumulative.resize(size);
-        for (int i = 0; i < size; i++) {
-            memcpy(&_cumulative[i], type_reader, sizeof(Weight));
-            type_reader += sizeof(Weight);
+        if (size == 0) {
+            updateCumulative();
+        } else {
+            _cumulative.resize(size);
+            memcpy(_cumulative.data(), type_reader, size * sizeof(Weight));
         }
     }
 
+    // merge in a serialized t-digest. It is read into buffers of its own size, instead of a
+    // digest reserving the full unprocessed buffer for every merged row, then merged the same
+    // way as merge(const TDigest*).
+    void merge_serialized(const uint8_t* type_reader) {
+        TDigest other(_compression, 1, 1);
+        other.unserialize(type_reader);
+        merge(&other);
+    }
+
 private:
     Value _compression;
 
@@ -549,6 +536,28 @@ private:
 
     std::vector<Weight> _cumulative;
 
+    static uint8_t* serialize_centroids(const std::vector<Centroid>& centroids, uint8_t* writer) {
+        uint32_t size = centroids.size();
+        memcpy(writer, &size, sizeof(uint32_t));
+        writer += sizeof(uint32_t);
+        if (size > 0) {
+            memcpy(writer, centroids.data(), size * sizeof(Centroid));
+        }
+        return writer + size * sizeof(Centroid);
+    }
+
+    static const uint8_t* unserialize_centroids(const uint8_t* type_reader,
+                                                std::vector<Centroid>& centroids) {
+        uint32_t size;
+        memcpy(&size, type_reader, sizeof(uint32_t));
+        type_reader += sizeof(uint32_t);
+        centroids.resize(size);
+        if (size > 0) {
+            memcpy(centroids.data(), type_reader, size * sizeof(Centroid));
+        }
+        return type_reader + size * sizeof(Centroid);
+    }
+
     // return mean of i-th centroid
     Value mean(int i) const noexcept { return _processed[i].mean(); }
 
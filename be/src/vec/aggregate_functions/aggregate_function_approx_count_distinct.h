@@ -30,6 +30,7 @@
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column_decimal.h"
 #include "vec/common/assert_cast.h"
+#include "vec/common/pod_array.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_number.h"
@@ -95,20 +96,30 @@ public:
 
     void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
              Arena&) const override {
-        if constexpr (is_decimal(type) || is_int_or_bool(type) || is_ip(type) ||
-                      is_date_type(type) || is_float_or_double(type) || type == TYPE_TIME ||
-                      type == TYPE_TIMEV2) {
-            auto column =
-                    assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0]);
-            auto value = column->get_element(row_num);
-            this->data(place).add(
-                    HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED));
-        } else {
-            auto value = assert_cast<const ColumnDataType*, TypeCheckOnRelease::DISABLE>(columns[0])
-                                 ->get_data_at(row_num);
-            uint64_t hash_value =
-                    HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
-            this->data(place).add(hash_value);
+        uint64_t hash_value = 0;
+        auto row = static_cast<size_t>(row_num);
+        _hash_rows(columns[0], row, row + 1, &hash_value);
+        this->data(place).add(hash_value);
+    }
+
+    // The rows are hashed in a loop before they are added, so the hashing is not interleaved
+    // with the random accesses of the places.
+    void add_batch(size_t batch_size, AggregateDataPtr* places, size_t place_offset,
+                   const IColumn** columns, Arena&, bool) const override {
+        PaddedPODArray<uint64_t> hash_values(batch_size);
+        _hash_rows(columns[0], 0, batch_size, hash_values.data());
+        for (size_t i = 0; i < batch_size; ++i) {
+            this->data(places[i] + place_offset).add(hash_values[i]);
+        }
+    }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena&) const override {
+        PaddedPODArray<uint64_t> hash_values(batch_size);
+        _hash_rows(columns[0], 0, batch_size, hash_values.data());
+        auto& data = this->data(place);
+        for (size_t i = 0; i < batch_size; ++i) {
+            data.add(hash_values[i]);
         }
     }
 
@@ -132,6 +143,29 @@ public:
         auto& column = assert_cast<ColumnInt64&>(to);
         column.get_data().push_back(this->data(place).get());
     }
+
+private:
+    // Writes the hash values of the rows [begin, end) of the column into `hash_values`.
+    static void _hash_rows(const IColumn* column, size_t begin, size_t end,
+                           uint64_t* __restrict hash_values) {
+        const auto& typed_column =
+                assert_cast<const ColumnDataType&, TypeCheckOnRelease::DISABLE>(*column);
+        if constexpr (is_decimal(type) || is_int_or_bool(type) || is_ip(type) ||
+                      is_date_type(type) || is_float_or_double(type) || type == TYPE_TIME ||
+                      type == TYPE_TIMEV2) {
+            const auto* values = typed_column.get_data().data();
+            for (size_t i = begin; i < end; ++i) {
+                hash_values[i - begin] = HashUtil::murmur_hash64A(
+                        (const char*)&values[i], sizeof(values[i]), HashUtil::MURMUR_SEED);
+            }
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                auto value = typed_column.get_data_at(i);
+                hash_values[i - begin] =
+                        HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+            }
+        }
+    }
 };
 
 } // namespace doris::vectorized
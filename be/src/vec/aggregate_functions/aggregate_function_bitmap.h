@@ -125,8 +125,15 @@ struct AggregateFunctionGroupBitmapXorOp {
 
 template <typename Op>
 struct AggregateFunctionBitmapData {
+    // bitmap_union buffers this many merged roaring bitmaps before unioning them in one pass.
+    static constexpr size_t PENDING_UNION_BATCH_SIZE = 32;
+    static constexpr bool lazy_union = std::is_same_v<Op, AggregateFunctionBitmapUnionOp>;
+
     BitmapValue value;
     bool is_first = true;
+    // The roaring bitmaps merged but not unioned into value yet. They share the roaring of
+    // the merged values, so buffering them copies no containers.
+    std::vector<BitmapValue> pending;
 
     template <typename T>
     void add(const T& data) {
@@ -135,18 +142,71 @@ struct AggregateFunctionBitmapData {
 
     void add_batch(std::vector<const BitmapValue*>& data) { Op::add_batch(value, data, is_first); }
 
-    void merge(const BitmapValue& data) { Op::merge(value, data, is_first); }
+    void merge(const BitmapValue& data) {
+        if constexpr (lazy_union) {
+            if (data.is_roaring()) {
+                pending.push_back(data);
+                if (pending.size() >= PENDING_UNION_BATCH_SIZE) {
+                    flush();
+                }
+                return;
+            }
+        }
+        Op::merge(value, data, is_first);
+    }
+
+    // Unions the pending bitmaps into value.
+    void flush() {
+        if (pending.empty()) {
+            return;
+        }
+        if (is_first && pending.size() == 1) {
+            Op::merge(value, pending[0], is_first);
+        } else {
+            std::vector<const BitmapValue*> values;
+            values.reserve(pending.size());
+            for (const auto& bitmap : pending) {
+                values.push_back(&bitmap);
+            }
+            Op::add_batch(value, values, is_first);
+        }
+        // release the buffer, there may be millions of groups each holding one
+        std::vector<BitmapValue>().swap(pending);
+    }
+
+    // The cardinality of the union, without unioning the pending bitmaps into value.
+    uint64_t cardinality() const {
+        if (pending.empty()) {
+            return value.cardinality();
+        }
+        std::vector<const BitmapValue*> values;
+        values.reserve(pending.size() + 1);
+        values.push_back(&value);
+        for (const auto& bitmap : pending) {
+            values.push_back(&bitmap);
+        }
+        BitmapValue result;
+        result.fastunion(values);
+        return result.cardinality();
+    }
 
-    void write(BufferWritable& buf) const { DataTypeBitMap::serialize_as_stream(value, buf); }
+    void write(BufferWritable& buf) const {
+        const_cast<AggregateFunctionBitmapData*>(this)->flush();
+        DataTypeBitMap::serialize_as_stream(value, buf);
+    }
 
     void read(BufferReadable& buf) { DataTypeBitMap::deserialize_as_stream(value, buf); }
 
     void reset() {
         is_first = true;
         value.reset(); // it's better to call reset function by self firstly.
+        std::vector<BitmapValue>().swap(pending);
     }
 
-    BitmapValue& get() { return value; }
+    BitmapValue& get() {
+        flush();
+        return value;
+    }
 };
 
 template <typename Data, typename Derived>
@@ -171,7 +231,7 @@ public:
             });
             assert_cast<const Derived*, TypeCheckOnRelease::DISABLE>(this)->add(place, columns, i,
                                                                                 arena);
-            data[i] = std::move(this->data(place).value);
+            data[i] = std::move(this->data(place).get());
         }
     }
 
@@ -181,7 +241,7 @@ public:
         col.resize(num_rows);
         auto* data = col.get_data().data();
         for (size_t i = 0; i != num_rows; ++i) {
-            data[i] = std::move(this->data(places[i] + offset).value);
+            data[i] = std::move(this->data(places[i] + offset).get());
         }
     }
 
@@ -235,7 +295,7 @@ public:
         auto& col = assert_cast<ColumnBitmap&>(to);
         size_t old_size = col.size();
         col.resize(old_size + 1);
-        col.get_data()[old_size] = std::move(this->data(place).value);
+        col.get_data()[old_size] = const_cast<Data&>(this->data(place)).get();
     }
 
     [[nodiscard]] MutableColumnPtr create_serialize_column() const override {
@@ -441,9 +501,9 @@ public:
     }
 
     void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
-        auto& value_data = const_cast<AggFunctionData&>(this->data(place)).get();
+        // only the cardinality is needed, the final bitmap is never materialized in the state
         auto& column = assert_cast<ColVecResult&>(to);
-        column.get_data().push_back(value_data.cardinality());
+        column.get_data().push_back(this->data(place).cardinality());
     }
 
     void reset(AggregateDataPtr __restrict place) const override { this->data(place).reset(); }
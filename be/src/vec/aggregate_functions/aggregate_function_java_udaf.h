@@ -17,11 +17,13 @@
 
 #pragma once
 
+#include <arrow/c/abi.h>
 #include <jni.h>
 #include <unistd.h>
 
 #include <cstdint>
 #include <memory>
+#include <numeric>
 
 #include "absl/strings/substitute.h"
 #include "common/cast_set.h"
@@ -30,6 +32,7 @@
 #include "common/logging.h"
 #include "common/status.h"
 #include "runtime/user_function_cache.h"
+#include "util/defer_op.h"
 #include "util/jni-util.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column_array.h"
@@ -49,6 +52,7 @@ const char* UDAF_EXECUTOR_CTOR_SIGNATURE = "([B)V";
 const char* UDAF_EXECUTOR_CLOSE_SIGNATURE = "()V";
 const char* UDAF_EXECUTOR_DESTROY_SIGNATURE = "()V";
 const char* UDAF_EXECUTOR_ADD_SIGNATURE = "(ZIIJILjava/util/Map;)V";
+const char* UDAF_EXECUTOR_ADD_ARROW_SIGNATURE = "(ZIIJIJJ)V";
 const char* UDAF_EXECUTOR_SERIALIZE_SIGNATURE = "(J)[B";
 const char* UDAF_EXECUTOR_MERGE_SIGNATURE = "(J[B)V";
 const char* UDAF_EXECUTOR_GET_SIGNATURE = "(JLjava/util/Map;)J";
@@ -127,6 +131,10 @@ public:
             input_block.insert(ColumnWithTypeAndName(columns[i]->get_ptr(), argument_types[i],
                                                      std::to_string(i)));
         }
+        if (executor_add_batch_arrow_id != nullptr) {
+            return add_arrow(env, input_block, places_address, is_single_place, row_num_start,
+                             row_num_end, place_offset);
+        }
         std::unique_ptr<long[]> input_table;
         RETURN_IF_ERROR(JniConnector::to_java_table(&input_block, input_table));
         auto input_table_schema = JniConnector::parse_table_schema(&input_block);
@@ -146,6 +154,27 @@ public:
         return JniUtil::GetJniExceptionMsg(env);
     }
 
+    // Same as add, but the columns are exported by the arrow c data interface.
+    Status add_arrow(JNIEnv* env, const Block& input_block, int64_t places_address,
+                     bool is_single_place, int64_t row_num_start, int64_t row_num_end,
+                     int64_t place_offset) {
+        ArrowArray input_array {};
+        ArrowSchema input_schema {};
+        Defer release_batch {
+                [&]() { JniConnector::release_arrow_batch(&input_array, &input_schema); }};
+        ColumnNumbers arguments(input_block.columns());
+        std::iota(arguments.begin(), arguments.end(), 0);
+        RETURN_IF_ERROR(JniConnector::to_arrow_batch(input_block, arguments, &input_array,
+                                                     &input_schema));
+        // Keep consistent with the function signature of executor_add_batch_arrow_id.
+        env->CallVoidMethod(executor_obj, executor_add_batch_arrow_id, is_single_place,
+                            cast_set<int>(row_num_start), cast_set<int>(row_num_end),
+                            places_address, cast_set<int>(place_offset),
+                            reinterpret_cast<jlong>(&input_array),
+                            reinterpret_cast<jlong>(&input_schema));
+        return JniUtil::GetJniExceptionMsg(env);
+    }
+
     Status merge(const AggregateJavaUdafData& rhs, int64_t place) {
         JNIEnv* env = nullptr;
         RETURN_NOT_OK_STATUS_WITH_WARN(JniUtil::GetJNIEnv(&env), "Java-Udaf merge function");
@@ -241,6 +270,12 @@ private:
                 register_id("destroy", UDAF_EXECUTOR_DESTROY_SIGNATURE, executor_destroy_id));
         RETURN_IF_ERROR(
                 register_id("addBatch", UDAF_EXECUTOR_ADD_SIGNATURE, executor_add_batch_id));
+        // Optional, only the executors accepting arrow batches implement it.
+        executor_add_batch_arrow_id =
+                env->GetMethodID(executor_cl, "addBatchArrow", UDAF_EXECUTOR_ADD_ARROW_SIGNATURE);
+        if (executor_add_batch_arrow_id == nullptr) {
+            env->ExceptionClear();
+        }
         return Status::OK();
     }
 
@@ -252,6 +287,7 @@ private:
     jmethodID executor_ctor_id;
 
     jmethodID executor_add_batch_id;
+    jmethodID executor_add_batch_arrow_id = nullptr;
     jmethodID executor_merge_id;
     jmethodID executor_serialize_id;
     jmethodID executor_get_value_id;
@@ -36,6 +36,7 @@
 #include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/pod_array_fwd.h"
+#include "vec/common/string_ref.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_array.h"
 #include "vec/data_types/data_type_nullable.h"
@@ -100,10 +101,35 @@ struct PercentileApproxState {
 
         buf.read_binary(target_quantile);
         buf.read_binary(compressions);
-        std::string str;
+        StringRef str;
         buf.read_binary(str);
         digest = TDigest::create_unique(compressions);
-        digest->unserialize((uint8_t*)str.c_str());
+        digest->unserialize((const uint8_t*)str.data);
+    }
+
+    // Same as merging a state read by read(), but the serialized digest is merged in place
+    // instead of being copied into a digest of its own first.
+    void read_and_merge(BufferReadable& buf) {
+        bool rhs_init_flag = false;
+        buf.read_binary(rhs_init_flag);
+        if (!rhs_init_flag) {
+            return;
+        }
+
+        double rhs_target_quantile = INIT_QUANTILE;
+        double rhs_compressions = 0;
+        buf.read_binary(rhs_target_quantile);
+        buf.read_binary(rhs_compressions);
+        StringRef str;
+        buf.read_binary(str);
+        if (!init_flag) {
+            digest = TDigest::create_unique(compressions);
+            init_flag = true;
+        }
+        digest->merge_serialized((const uint8_t*)str.data);
+        if (target_quantile == PercentileApproxState::INIT_QUANTILE) {
+            target_quantile = rhs_target_quantile;
+        }
     }
 
     double get() const {
@@ -181,6 +207,11 @@ public:
                      Arena&) const override {
         AggregateFunctionPercentileApprox::data(place).read(buf);
     }
+
+    void deserialize_and_merge(AggregateDataPtr __restrict place, AggregateDataPtr __restrict rhs,
+                               BufferReadable& buf, Arena&) const override {
+        AggregateFunctionPercentileApprox::data(place).read_and_merge(buf);
+    }
 };
 
 class AggregateFunctionPercentileApproxTwoParams : public AggregateFunctionPercentileApprox {
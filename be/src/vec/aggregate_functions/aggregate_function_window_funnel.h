@@ -29,6 +29,7 @@
 #include <memory>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/exception.h"
@@ -57,7 +58,7 @@ namespace doris::vectorized {
 
 enum class WindowFunnelMode : Int64 { INVALID, DEFAULT, DEDUPLICATION, FIXED, INCREASE };
 
-WindowFunnelMode string_to_window_funnel_mode(const String& string) {
+inline WindowFunnelMode string_to_window_funnel_mode(const String& string) {
     if (string == "default") {
         return WindowFunnelMode::DEFAULT;
     } else if (string == "deduplication") {
@@ -109,6 +110,8 @@ struct WindowFunnelState {
     bool enable_mode;
     WindowFunnelMode window_funnel_mode;
     DataValue events_list;
+    // whether events_list is ordered by the timestamps, then it is not sorted at finalize
+    bool events_sorted = true;
 
     WindowFunnelState() {
         event_count = 0;
@@ -120,13 +123,34 @@ struct WindowFunnelState {
         events_list.event_columns_data.resize(event_count);
     }
 
-    void reset() { events_list.clear(); }
+    void reset() {
+        events_list.clear();
+        events_sorted = true;
+    }
 
     void add(const IColumn** arg_columns, ssize_t row_num, int64_t win, WindowFunnelMode mode) {
         window = win;
         window_funnel_mode = enable_mode ? mode : WindowFunnelMode::DEFAULT;
-        events_list.dt.emplace_back(assert_cast<const ColumnVector<PrimitiveType>&>(*arg_columns[2])
-                                            .get_data()[row_num]);
+        // The rows without any event never match nor break a chain, except in the FIXED mode
+        // where every chain must continue on the next row, so they are not buffered.
+        if (window_funnel_mode != WindowFunnelMode::FIXED) {
+            bool has_event = false;
+            for (int i = 0; i < event_count && !has_event; i++) {
+                has_event = assert_cast<const ColumnUInt8&, TypeCheckOnRelease::DISABLE>(
+                                    *arg_columns[3 + i])
+                                    .get_data()[row_num];
+            }
+            if (!has_event) {
+                return;
+            }
+        }
+        auto timestamp = static_cast<UInt64>(
+                assert_cast<const ColumnVector<PrimitiveType>&>(*arg_columns[2])
+                        .get_data()[row_num]);
+        if (!events_list.empty() && timestamp < events_list.dt.back()) {
+            events_sorted = false;
+        }
+        events_list.dt.emplace_back(timestamp);
         for (int i = 0; i < event_count; i++) {
             events_list.event_columns_data[i].emplace_back(
                     assert_cast<const ColumnUInt8&>(*arg_columns[3 + i]).get_data()[row_num]);
@@ -134,6 +158,10 @@ struct WindowFunnelState {
     }
 
     void sort() {
+        if (events_sorted) {
+            return;
+        }
+        events_sorted = true;
         auto num = events_list.size();
         std::vector<size_t> indices(num);
         std::iota(indices.begin(), indices.end(), 0);
@@ -234,6 +262,67 @@ struct WindowFunnelState {
         return matched_count;
     }
 
+    // Evaluates the sorted events in one pass. A chain starts at every row of the first event
+    // and then takes the first following row of every next event, so a chain reaching a level
+    // later also started later and has the later window end. In the DEFAULT, DEDUPLICATION and
+    // FIXED modes it matches whatever the earlier chains at the level would, so only the window
+    // end of the latest chain waiting at every level is kept. The INCREASE mode also compares
+    // the timestamps of the previous events, which the starts do not order, so it is evaluated
+    // by _get_internal instead.
+    template <WindowFunnelMode WINDOW_FUNNEL_MODE>
+    int _get_streaming() const {
+        static_assert(WINDOW_FUNNEL_MODE != WindowFunnelMode::INCREASE);
+        const auto& timestamp_data = events_list.dt;
+        const auto& event_data = events_list.event_columns_data;
+        auto row_count = events_list.size();
+        TimeInterval interval(SECOND, window, false);
+        std::vector<DateValueType> window_ends(event_count);
+        std::vector<UInt8> waiting(event_count, 0);
+        int max_found_event_count = 0;
+        for (size_t row = 0; row < row_count; ++row) {
+            auto current_timestamp = binary_cast<NativeType, DateValueType>(timestamp_data[row]);
+            // a chain waiting at or above the first event of the row sees a duplicated event
+            int first_event = event_count;
+            if constexpr (WINDOW_FUNNEL_MODE == WindowFunnelMode::DEDUPLICATION) {
+                for (int i = 0; i < event_count; i++) {
+                    if (event_data[i][row]) {
+                        first_event = i;
+                        break;
+                    }
+                }
+            }
+            // from the top level, so that a chain does not advance twice on the same row
+            for (int level = event_count - 2; level >= 0; level--) {
+                if (!waiting[level]) {
+                    continue;
+                }
+                if (event_data[level + 1][row]) {
+                    waiting[level] = 0;
+                    if (current_timestamp <= window_ends[level]) {
+                        if (level + 2 == event_count) {
+                            return event_count;
+                        }
+                        max_found_event_count = std::max(max_found_event_count, level + 2);
+                        waiting[level + 1] = 1;
+                        window_ends[level + 1] = window_ends[level];
+                    }
+                } else if (WINDOW_FUNNEL_MODE == WindowFunnelMode::FIXED || first_event <= level) {
+                    waiting[level] = 0;
+                }
+            }
+            if (event_data[0][row]) {
+                if (event_count == 1) {
+                    return event_count;
+                }
+                max_found_event_count = std::max(max_found_event_count, 1);
+                waiting[0] = 1;
+                window_ends[0] = current_timestamp;
+                window_ends[0].template date_add_interval<SECOND>(interval);
+            }
+        }
+        return max_found_event_count;
+    }
+
     template <WindowFunnelMode WINDOW_FUNNEL_MODE>
     int _get_internal() const {
         size_t start_row = 0;
@@ -255,11 +344,11 @@ struct WindowFunnelState {
         }
         switch (window_funnel_mode) {
         case WindowFunnelMode::DEFAULT:
-            return _get_internal<WindowFunnelMode::DEFAULT>();
+            return _get_streaming<WindowFunnelMode::DEFAULT>();
         case WindowFunnelMode::DEDUPLICATION:
-            return _get_internal<WindowFunnelMode::DEDUPLICATION>();
+            return _get_streaming<WindowFunnelMode::DEDUPLICATION>();
         case WindowFunnelMode::FIXED:
-            return _get_internal<WindowFunnelMode::FIXED>();
+            return _get_streaming<WindowFunnelMode::FIXED>();
         case WindowFunnelMode::INCREASE:
             return _get_internal<WindowFunnelMode::INCREASE>();
         default:
@@ -272,6 +361,9 @@ struct WindowFunnelState {
         if (other.events_list.empty()) {
             return;
         }
+        events_sorted = events_sorted && other.events_sorted &&
+                        (events_list.empty() ||
+                         events_list.dt.back() <= other.events_list.dt.front());
         events_list.dt.insert(std::end(events_list.dt), std::begin(other.events_list.dt),
                               std::end(other.events_list.dt));
         for (size_t i = 0; i < event_count; i++) {
@@ -339,6 +431,7 @@ struct WindowFunnelState {
                 event_columns_data[j] = static_cast<UInt8>(temp_value);
             }
         }
+        events_sorted = std::is_sorted(events_list.dt.begin(), events_list.dt.end());
     }
 };
 
@@ -141,12 +141,13 @@ void ColumnDecimal<T>::update_crcs_with_value(uint32_t* __restrict hashes, Primi
     if constexpr (T != TYPE_DECIMALV2) {
         if (null_data == nullptr) {
             for (size_t i = 0; i < s; i++) {
-                hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hashes[i]);
+                hashes[i] = HashUtil::zlib_crc_hash_small(&data[i], sizeof(value_type), hashes[i]);
             }
         } else {
             for (size_t i = 0; i < s; i++) {
                 if (null_data[i] == 0)
-                    hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(value_type), hashes[i]);
+                    hashes[i] =
+                            HashUtil::zlib_crc_hash_small(&data[i], sizeof(value_type), hashes[i]);
             }
         }
     } else {
@@ -334,8 +335,10 @@ ColumnPtr ColumnDecimal<T>::filter(const IColumn::Filter& filt, ssize_t result_s
         } else if (simd::bits_mask_all() == mask) {
             res_data.insert(data_pos, data_pos + SIMD_BYTES);
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t bit_pos) { res_data.push_back(data_pos[bit_pos]); }, mask);
+            const size_t res_size = res_data.size();
+            res_data.resize(res_size + SIMD_BYTES);
+            res_data.resize(res_size + simd::compress_by_bits_mask(
+                                               data_pos, mask, res_data.data() + res_size));
         }
 
         filt_pos += SIMD_BYTES;
@@ -378,12 +381,7 @@ size_t ColumnDecimal<T>::filter(const IColumn::Filter& filter) {
             memmove(result_data, data_pos, sizeof(value_type) * SIMD_BYTES);
             result_data += SIMD_BYTES;
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t idx) {
-                        *result_data = data_pos[idx];
-                        ++result_data;
-                    },
-                    mask);
+            result_data += simd::compress_by_bits_mask(data_pos, mask, result_data);
         }
 
         filter_pos += SIMD_BYTES;
@@ -269,6 +269,17 @@ public:
         return _dict.find_codes(values, selected);
     }
 
+    // selected[code] is set if the hash value of the dict word passes `hash_tester`, so a hash
+    // based filter is evaluated once per dict word instead of once per row.
+    template <typename HashTester>
+    void find_codes_by_hash(const HashTester& hash_tester,
+                            std::vector<vectorized::UInt8>& selected) const {
+        selected.resize(dict_size());
+        for (size_t i = 0; i < selected.size(); i++) {
+            selected[i] = hash_tester(_dict.get_hash_value(static_cast<Int32>(i), _type));
+        }
+    }
+
     void set_rowset_segment_id(std::pair<RowsetId, uint32_t> rowset_segment_id) override {
         _rowset_segment_id = rowset_segment_id;
     }
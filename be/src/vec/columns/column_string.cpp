@@ -300,19 +300,23 @@ void ColumnStr<T>::update_crcs_with_value(uint32_t* __restrict hashes, doris::Pr
     auto s = rows;
     DCHECK(s == size());
 
+    // short strings are hashed inline, zlib is faster for the long ones.
+    auto do_crc = [&](size_t i) {
+        auto data_ref = get_data_at(i);
+        // If offset is uint32, size will not exceed, check the size when inserting data into
+        // ColumnStr<T>.
+        auto size = static_cast<uint32_t>(data_ref.size);
+        hashes[i] = size <= 16 ? HashUtil::zlib_crc_hash_small(data_ref.data, size, hashes[i])
+                               : HashUtil::zlib_crc_hash(data_ref.data, size, hashes[i]);
+    };
     if (null_data == nullptr) {
         for (size_t i = 0; i < s; i++) {
-            auto data_ref = get_data_at(i);
-            // If offset is uint32, size will not exceed, check the size when inserting data into ColumnStr<T>.
-            hashes[i] = HashUtil::zlib_crc_hash(data_ref.data, static_cast<uint32_t>(data_ref.size),
-                                                hashes[i]);
+            do_crc(i);
         }
     } else {
         for (size_t i = 0; i < s; i++) {
             if (null_data[i] == 0) {
-                auto data_ref = get_data_at(i);
-                hashes[i] = HashUtil::zlib_crc_hash(
-                        data_ref.data, static_cast<uint32_t>(data_ref.size), hashes[i]);
+                do_crc(i);
             }
         }
     }
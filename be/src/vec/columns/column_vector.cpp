@@ -34,6 +34,7 @@
 #include "vec/common/assert_cast.h"
 #include "vec/common/memcpy_small.h"
 #include "vec/common/nan_utils.h"
+#include "vec/common/radix_sort.h"
 #include "vec/common/sip_hash.h"
 #include "vec/common/unaligned.h"
 #include "vec/core/sort_block.h"
@@ -175,14 +176,14 @@ void ColumnVector<T>::update_crcs_with_value(uint32_t* __restrict hashes, Primit
     } else {
         if (null_data == nullptr) {
             for (size_t i = 0; i < s; i++) {
-                hashes[i] = HashUtil::zlib_crc_hash(
+                hashes[i] = HashUtil::zlib_crc_hash_small(
                         &data[i], sizeof(typename PrimitiveTypeTraits<T>::ColumnItemType),
                         hashes[i]);
             }
         } else {
             for (size_t i = 0; i < s; i++) {
                 if (null_data[i] == 0)
-                    hashes[i] = HashUtil::zlib_crc_hash(
+                    hashes[i] = HashUtil::zlib_crc_hash_small(
                             &data[i], sizeof(typename PrimitiveTypeTraits<T>::ColumnItemType),
                             hashes[i]);
             }
@@ -235,6 +236,14 @@ void ColumnVector<T>::get_permutation(bool reverse, size_t limit, int nan_direct
             std::partial_sort(res.begin(), res.begin() + limit, res.end(),
                               less(*this, nan_direction_hint));
     } else {
+        /// The integer keys are sorted by radix sort, which is not comparison based.
+        if constexpr (is_radix_sortable_v<value_type>) {
+            if (s >= RADIX_SORT_MIN_ROWS) {
+                radix_sort_permutation(data.data(), s, reverse, res);
+                return;
+            }
+        }
+
         /// Default sorting algorithm.
         for (size_t i = 0; i < s; ++i) res[i] = i;
 
@@ -325,9 +334,10 @@ ColumnPtr ColumnVector<T>::filter(const IColumn::Filter& filt, ssize_t result_si
         } else if (simd::bits_mask_all() == mask) {
             res_data.insert(data_pos, data_pos + SIMD_BYTES);
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t idx) { res_data.push_back_without_reserve(data_pos[idx]); },
-                    mask);
+            const size_t res_size = res_data.size();
+            res_data.resize(res_size + SIMD_BYTES);
+            res_data.resize(res_size + simd::compress_by_bits_mask(
+                                               data_pos, mask, res_data.data() + res_size));
         }
 
         filt_pos += SIMD_BYTES;
@@ -372,12 +382,7 @@ size_t ColumnVector<T>::filter(const IColumn::Filter& filter) {
             memmove(result_data, data_pos, sizeof(value_type) * SIMD_BYTES);
             result_data += SIMD_BYTES;
         } else {
-            simd::iterate_through_bits_mask(
-                    [&](const size_t idx) {
-                        *result_data = data_pos[idx];
-                        ++result_data;
-                    },
-                    mask);
+            result_data += simd::compress_by_bits_mask(data_pos, mask, result_data);
         }
 
         filter_pos += SIMD_BYTES;
@@ -17,6 +17,7 @@
 
 #include "vec/common/allocator.h"
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
 
 #include <atomic>
@@ -40,11 +41,49 @@
 #include "util/pretty_printer.h"
 #include "util/stack_util.h"
 #include "util/uid_util.h"
+#include "vec/common/column_buffer_pool.h"
 
 namespace doris {
 std::unordered_map<void*, size_t> RecordSizeMemoryAllocator::_allocated_sizes;
 std::mutex RecordSizeMemoryAllocator::_mutex;
 
+static constexpr size_t HUGE_PAGE_SIZE = 2UL << 20;
+
+static bvar::Adder<int64_t> allocator_huge_page_hit_count("allocator_huge_page_hit_count");
+static bvar::Adder<int64_t> allocator_huge_page_miss_count("allocator_huge_page_miss_count");
+static bvar::Adder<int64_t> allocator_huge_page_advised_bytes("allocator_huge_page_advised_bytes");
+static bvar::PassiveStatus<double> allocator_huge_page_hit_rate(
+        "allocator_huge_page_hit_rate",
+        [](void*) {
+            const auto hit = allocator_huge_page_hit_count.get_value();
+            const auto total = hit + allocator_huge_page_miss_count.get_value();
+            return total == 0 ? 0.0 : static_cast<double>(hit) / static_cast<double>(total);
+        },
+        nullptr);
+
+// Whether the allocation of `size` bytes should be backed by transparent huge pages.
+static bool use_huge_pages(size_t size) {
+    return config::enable_huge_page_for_large_alloc &&
+           size >= static_cast<size_t>(config::huge_page_alloc_threshold_bytes);
+}
+
+// Asks the kernel to back the huge page aligned part of the buffer by transparent huge pages.
+// It is only a hint, the buffer is still served by the normal pages if the transparent huge pages
+// are disabled or the kernel fails to find a huge page, which is counted as a miss.
+static void advise_huge_pages(void* buf, size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+    const auto addr = reinterpret_cast<uintptr_t>(buf);
+    const auto begin = (addr + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+    const auto end = (addr + size) & ~(HUGE_PAGE_SIZE - 1);
+    if (end > begin && madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0) {
+        allocator_huge_page_hit_count << 1;
+        allocator_huge_page_advised_bytes << static_cast<int64_t>(end - begin);
+        return;
+    }
+#endif
+    allocator_huge_page_miss_count << 1;
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename MemoryAllocator,
           bool check_and_tracking_memory>
 bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
@@ -208,8 +247,8 @@ bool Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         return false;
     }
 
-    auto st = doris::thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker()->check_limit(
-            size);
+    auto st = doris::thread_context()->thread_mem_tracker_mgr->check_limit(
+            static_cast<int64_t>(size));
     if (!st) {
         *err_msg += fmt::format("Allocator mem tracker check failed, {}", st.to_string());
         doris::thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker()->print_log_usage(
@@ -305,6 +344,20 @@ template <bool clear_memory_, bool mmap_populate, bool use_mmap, typename Memory
           bool check_and_tracking_memory>
 void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
                 check_and_tracking_memory>::alloc(size_t size, size_t alignment) {
+    if constexpr (is_pooled_column_buffer) {
+        // A pooled buffer is still consumed in the mem tracker, see ColumnBufferPool.
+        if (!(use_mmap && size >= doris::config::mmap_threshold) &&
+            alignment <= MALLOC_MIN_ALIGNMENT) {
+            if (void* pooled_buf = doris::vectorized::ColumnBufferPool::try_get(size)) {
+                if constexpr (!check_and_tracking_memory) {
+                    // The caller (e.g. PODArray) tracks the buffer itself.
+                    RELEASE_THREAD_MEM_TRACKER(size);
+                }
+                add_address_sanitizers(pooled_buf, size);
+                return pooled_buf;
+            }
+        }
+    }
     memory_check(size);
     // consume memory in tracker before alloc, similar to early declaration.
     consume_memory(size);
@@ -324,13 +377,17 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
             release_memory(size);
             throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
         }
+        if (use_huge_pages(size)) {
+            advise_huge_pages(buf, size);
+        }
         if constexpr (MemoryAllocator::need_record_actual_size()) {
             record_size = MemoryAllocator::allocated_size(buf);
         }
 
         /// No need for zero-fill, because mmap guarantees it.
     } else {
-        if (alignment <= MALLOC_MIN_ALIGNMENT) {
+        const bool huge_pages = use_huge_pages(size);
+        if (alignment <= MALLOC_MIN_ALIGNMENT && !huge_pages) {
             if constexpr (clear_memory) {
                 buf = MemoryAllocator::calloc(size, 1);
             } else {
@@ -347,13 +404,19 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
             add_address_sanitizers(buf, record_size);
         } else {
             buf = nullptr;
-            int res = MemoryAllocator::posix_memalign(&buf, alignment, size);
+            // Aligns the buffer to the huge page, so that all of its pages could be huge pages.
+            int res = MemoryAllocator::posix_memalign(
+                    &buf, huge_pages ? std::max(alignment, HUGE_PAGE_SIZE) : alignment, size);
 
             if (0 != res) {
                 release_memory(size);
                 throw_bad_alloc(fmt::format("Cannot allocate memory (posix_memalign) {}.", size));
             }
 
+            // Before the buffer is touched by memset, or its pages are faulted in as normal pages.
+            if (huge_pages) {
+                advise_huge_pages(buf, size);
+            }
             if constexpr (clear_memory) {
                 memset(buf, 0, size);
             }
@@ -380,6 +443,14 @@ void Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         }
     } else {
         remove_address_sanitizers(buf, size);
+        if constexpr (is_pooled_column_buffer) {
+            if (doris::vectorized::ColumnBufferPool::try_put(buf, size)) {
+                if constexpr (!check_and_tracking_memory) {
+                    CONSUME_THREAD_MEM_TRACKER(size);
+                }
+                return;
+            }
+        }
         MemoryAllocator::free(buf);
     }
     release_memory(size);
@@ -416,6 +487,9 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
         }
         // usually, buf addr = new_buf addr, asan maybe not equal.
         add_address_sanitizers(new_buf, new_size);
+        if (use_huge_pages(new_size)) {
+            advise_huge_pages(new_buf, new_size);
+        }
 
         buf = new_buf;
         release_memory(old_size);
@@ -435,6 +509,9 @@ void* Allocator<clear_memory_, mmap_populate, use_mmap, MemoryAllocator,
             throw_bad_alloc(fmt::format("Allocator: Cannot mremap memory chunk from {} to {}.",
                                         old_size, new_size));
         }
+        if (use_huge_pages(new_size)) {
+            advise_huge_pages(buf, new_size);
+        }
         release_memory(old_size);
 
         /// No need for zero-fill, because mmap guarantees it.
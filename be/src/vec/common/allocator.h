@@ -57,6 +57,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <string>
+#include <type_traits>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #ifdef THREAD_SANITIZER
@@ -253,6 +254,10 @@ protected:
     static constexpr bool clear_memory = clear_memory_;
 
 private:
+    // Only the buffers of malloc may be recycled by the ColumnBufferPool of the thread.
+    static constexpr bool is_pooled_column_buffer =
+            !clear_memory_ && std::is_same_v<MemoryAllocator, DefaultMemoryAllocator>;
+
     void sys_memory_check(size_t size) const;
     void memory_tracker_check(size_t size) const;
     // If sys memory or tracker exceeds the limit, but there is no external catch bad_alloc,
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <cstdlib>
+
+#include "common/config.h"
+#include "runtime/memory/thread_mem_tracker_mgr.h"
+#include "runtime/thread_context.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+ColumnBufferPool::Scope::Scope() {
+    if (config::column_buffer_pool_bytes_per_task <= 0 || _current != nullptr ||
+        !pthread_context_ptr_init) {
+        return;
+    }
+    _pool = new ColumnBufferPool(thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker(),
+                                 static_cast<size_t>(config::column_buffer_pool_bytes_per_task));
+    _current = _pool;
+}
+
+ColumnBufferPool::Scope::~Scope() {
+    if (_pool == nullptr) {
+        return;
+    }
+    _current = nullptr;
+    delete _pool;
+}
+
+ColumnBufferPool::~ColumnBufferPool() {
+    for (auto& [size, buffers] : _buffers) {
+        for (auto* buf : buffers) {
+            std::free(buf);
+        }
+    }
+    // The pooled buffers were not released when they were put into the pool.
+    if (_pooled_bytes > 0 && _is_tracked_by_current_thread()) {
+        RELEASE_THREAD_MEM_TRACKER(static_cast<int64_t>(_pooled_bytes));
+    }
+}
+
+bool ColumnBufferPool::_is_tracked_by_current_thread() const {
+    return thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker() == _mem_tracker;
+}
+
+void* ColumnBufferPool::_get(size_t size) {
+    auto it = _buffers.find(size);
+    if (it == _buffers.end() || it->second.empty() || !_is_tracked_by_current_thread()) {
+        return nullptr;
+    }
+    auto* buf = it->second.back();
+    it->second.pop_back();
+    _pooled_bytes -= size;
+    return buf;
+}
+
+bool ColumnBufferPool::_put(void* buf, size_t size) {
+    if (_pooled_bytes + size > _capacity || !_is_tracked_by_current_thread()) {
+        return false;
+    }
+    _buffers[size].emplace_back(buf);
+    _pooled_bytes += size;
+    return true;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace doris {
+class MemTrackerLimiter;
+} // namespace doris
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+/// Recycles the buffers of the columns (PODArray and the others on Allocator) that are freed by a
+/// thread while a pipeline task runs on it, so that the temporary columns of the following batches
+/// of the task reuse them instead of freeing and allocating them again by malloc.
+/// A pooled buffer stays consumed in the mem tracker of the task, as if it had not been freed, and
+/// all of the pooled buffers are freed and released when the task yields the thread.
+/// Only the buffers freed and allocated under the mem tracker that the pool was created with are
+/// recycled, and a buffer is only reused by an allocation of exactly the same size.
+class ColumnBufferPool {
+public:
+    /// The smaller buffers are served well enough by the thread cache of the allocator.
+    static constexpr size_t MIN_BUFFER_SIZE = 4096;
+
+    /// Installs a pool on the current thread during its lifetime, if
+    /// column_buffer_pool_bytes_per_task is positive.
+    class Scope {
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        ColumnBufferPool* _pool = nullptr;
+    };
+
+    /// Returns a pooled buffer of `size` bytes, or nullptr.
+    static void* try_get(size_t size) {
+        auto* pool = _current;
+        return pool == nullptr || size < MIN_BUFFER_SIZE ? nullptr : pool->_get(size);
+    }
+
+    /// Takes the buffer of `size` bytes into the pool instead of freeing it, returns false if it
+    /// is not taken.
+    static bool try_put(void* buf, size_t size) {
+        auto* pool = _current;
+        return pool != nullptr && size >= MIN_BUFFER_SIZE && pool->_put(buf, size);
+    }
+
+private:
+    ColumnBufferPool(MemTrackerLimiter* mem_tracker, size_t capacity)
+            : _mem_tracker(mem_tracker), _capacity(capacity) {}
+    ~ColumnBufferPool();
+
+    bool _is_tracked_by_current_thread() const;
+    void* _get(size_t size);
+    bool _put(void* buf, size_t size);
+
+    static inline thread_local ColumnBufferPool* _current = nullptr;
+
+    MemTrackerLimiter* _mem_tracker;
+    const size_t _capacity;
+    size_t _pooled_bytes = 0;
+    std::unordered_map<size_t, std::vector<void*>> _buffers;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
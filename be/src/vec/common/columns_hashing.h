@@ -153,7 +153,9 @@ struct HashMethodSingleLowNullableColumn : public SingleColumnMethod {
     template <typename Data, typename Key>
     ALWAYS_INLINE FindResult find_key_with_hash(Data& data, size_t i, Key key, size_t hash_value) {
         if (key_column->is_null_at(i)) {
-            if (data.has_null_key_data()) {
+            if constexpr (std::is_same_v<Mapped, void>) {
+                return FindResult {data.has_null_key_data()};
+            } else if (data.has_null_key_data()) {
                 return FindResult {&data.template get_null_key_data<Mapped>(), true};
             } else {
                 return FindResult {nullptr, false};
@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/compiler_util.h"
+#include "vec/common/hash_table/ph_hash_map.h" // IWYU pragma: keep, lookup_result_get_mapped
+#include "vec/core/types.h"
+
+/// A hash map of UInt8 or UInt16 keys which indexes a flat array of all possible keys by the key
+/// itself, so there is no hashing, probing or resizing at all. The cells are allocated on the
+/// first insertion. It has the same interface as PHHashMap, so it can be used by the hash methods
+/// in hash_map_context.h directly, and the null key is kept by DataWithNullKey as usual.
+template <typename Key, typename Mapped>
+class FixedKeyHashMap : private boost::noncopyable {
+    static_assert(std::is_same_v<Key, doris::vectorized::UInt8> ||
+                          std::is_same_v<Key, doris::vectorized::UInt16>,
+                  "FixedKeyHashMap only supports UInt8 and UInt16 keys");
+
+public:
+    using Self = FixedKeyHashMap;
+    using cell_type = std::pair<const Key, Mapped>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using Value = Mapped;
+    using value_type = std::pair<const Key, Mapped>;
+
+    using LookupResult = std::pair<const Key, Mapped>*;
+    using ConstLookupResult = const std::pair<const Key, Mapped>*;
+
+    static constexpr size_t NUM_CELLS = 1ULL << (sizeof(Key) * 8);
+
+    FixedKeyHashMap() = default;
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+
+        Container* container = nullptr;
+        size_t index = NUM_CELLS;
+
+        friend class FixedKeyHashMap;
+
+        void skip_empty_cells() {
+            while (index < container->_occupied.size() && !container->_occupied[index]) {
+                ++index;
+            }
+            if (index >= container->_occupied.size()) {
+                index = NUM_CELLS;
+            }
+        }
+
+    public:
+        iterator_base() = default;
+        iterator_base(Container* container_, size_t index_) : container(container_), index(index_) {
+            skip_empty_cells();
+        }
+
+        bool operator==(const iterator_base& rhs) const { return index == rhs.index; }
+        bool operator!=(const iterator_base& rhs) const { return index != rhs.index; }
+
+        Derived& operator++() {
+            ++index;
+            skip_empty_cells();
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const { return container->_cells[index].first; }
+
+        const auto& get_second() const { return container->_cells[index].second; }
+
+        auto& get_second() { return container->_cells[index].second; }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return index; }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+
+    const_iterator cbegin() const { return begin(); }
+
+    iterator begin() { return iterator(this, 0); }
+
+    const_iterator end() const { return const_iterator(this, NUM_CELLS); }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, NUM_CELLS); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key_holder, LookupResult& it, bool& inserted) {
+        emplace(key_holder, it, inserted, hash(key_holder));
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key_holder, LookupResult& it, Func&& f) {
+        it = _lazy_emplace(key_holder, [&](const auto& ctor) { f(ctor, key_holder); });
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t /*hash_value*/) {
+        inserted = false;
+        it = _lazy_emplace(key, [&](const auto& ctor) {
+            inserted = true;
+            if constexpr (std::is_pointer_v<std::remove_reference_t<mapped_type>>) {
+                ctor(key, nullptr);
+            } else {
+                ctor(key, mapped_type());
+            }
+        });
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t /*hash_value*/,
+                                    Func&& f) {
+        it = _lazy_emplace(key, [&](const auto& ctor) { f(ctor, key, key); });
+    }
+
+    void ALWAYS_INLINE insert(const Key& key, const Mapped& value) {
+        _lazy_emplace(key, [&](const auto& ctor) { ctor(key, value); });
+    }
+
+    void insert(const iterator& other_iter) {
+        insert(other_iter->get_first(), other_iter->get_second());
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        return find(key, 0);
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t /*hash_value*/) {
+        if (_occupied.empty() || !_occupied[key]) {
+            return nullptr;
+        }
+        return &_cells[key];
+    }
+
+    size_t hash(const Key& x) const { return static_cast<size_t>(x); }
+
+    /// All of the cells are in one small array, there is nothing worth prefetching.
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {}
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& v : *this) func(v.get_second());
+    }
+
+    size_t get_buffer_size_in_bytes() const {
+        return _cells.capacity() * sizeof(cell_type) + _occupied.capacity();
+    }
+
+    /// The cells of all possible keys are allocated at once, it never needs to expand.
+    bool add_elem_size_overflow(size_t row) const { return false; }
+
+    size_t estimate_memory(size_t num_elem) const {
+        if (!_cells.empty() || num_elem == 0) {
+            return 0;
+        }
+        return NUM_CELLS * (sizeof(cell_type) + sizeof(uint8_t));
+    }
+
+    size_t size() const { return _size; }
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return _size == 0; }
+
+    void clear_and_shrink() {
+        std::vector<cell_type>().swap(_cells);
+        std::vector<uint8_t>().swap(_occupied);
+        _size = 0;
+    }
+
+    void reserve(size_t num_elem) {}
+
+private:
+    void _init_cells() {
+        _cells.reserve(NUM_CELLS);
+        for (size_t i = 0; i < NUM_CELLS; ++i) {
+            _cells.emplace_back(static_cast<Key>(i), Mapped());
+        }
+        _occupied.resize(NUM_CELLS, 0);
+    }
+
+    /// The cell is occupied once the creator calls ctor(key, mapped), a creator which throws
+    /// before that leaves the cell empty.
+    template <typename Func>
+    LookupResult ALWAYS_INLINE _lazy_emplace(Key key, Func&& f) {
+        if (UNLIKELY(_cells.empty())) {
+            _init_cells();
+        }
+        auto* cell = &_cells[key];
+        if (!_occupied[key]) {
+            f([&](const auto& /*key*/, const auto& mapped) {
+                cell->second = mapped;
+                _occupied[key] = 1;
+                ++_size;
+            });
+        }
+        return cell;
+    }
+
+    std::vector<cell_type> _cells;
+    std::vector<uint8_t> _occupied;
+    size_t _size = 0;
+};
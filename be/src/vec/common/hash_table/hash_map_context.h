@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 
@@ -52,6 +53,9 @@ struct MethodBaseInner {
 
     // use in join case
     DorisVector<uint32_t> bucket_nums;
+    // use in join case, only filled if the hash table keeps hash tags of the keys
+    DorisVector<uint8_t> hash_tags;
+    static constexpr bool has_hash_tags = requires { requires HashMap::has_hash_tags; };
 
     MethodBaseInner() { hash_table.reset(new HashMap()); }
     virtual ~MethodBaseInner() = default;
@@ -68,20 +72,40 @@ struct MethodBaseInner {
 
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
         bucket_nums.resize(num_rows);
+        if constexpr (has_hash_tags) {
+            hash_tags.resize(num_rows);
+        }
 
         if (null_map == nullptr) {
             init_join_bucket_num(num_rows, bucket_size);
             return;
         }
         for (uint32_t k = 0; k < num_rows; ++k) {
-            bucket_nums[k] =
-                    null_map[k] ? bucket_size : hash_table->hash(keys[k]) & (bucket_size - 1);
+            if constexpr (has_hash_tags) {
+                if (null_map[k]) {
+                    bucket_nums[k] = bucket_size;
+                    hash_tags[k] = 0;
+                } else {
+                    auto hash_value = hash_table->hash(keys[k]);
+                    bucket_nums[k] = hash_value & (bucket_size - 1);
+                    hash_tags[k] = HashMap::hash_tag(hash_value);
+                }
+            } else {
+                bucket_nums[k] =
+                        null_map[k] ? bucket_size : hash_table->hash(keys[k]) & (bucket_size - 1);
+            }
         }
     }
 
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size) {
         for (uint32_t k = 0; k < num_rows; ++k) {
-            bucket_nums[k] = hash_table->hash(keys[k]) & (bucket_size - 1);
+            if constexpr (has_hash_tags) {
+                auto hash_value = hash_table->hash(keys[k]);
+                bucket_nums[k] = hash_value & (bucket_size - 1);
+                hash_tags[k] = HashMap::hash_tag(hash_value);
+            } else {
+                bucket_nums[k] = hash_table->hash(keys[k]) & (bucket_size - 1);
+            }
         }
     }
 
@@ -115,6 +139,18 @@ struct MethodBaseInner {
         }
     }
 
+    /// The rows prefetched by `prefetch(i)` start from HASH_MAP_PREFETCH_DIST, a batch fetches the
+    /// rows before it at once.
+    template <bool read>
+    ALWAYS_INLINE void prefetch_head(size_t num_rows) {
+        if constexpr (!is_string_hash_map()) {
+            const auto head_rows = std::min({num_rows, HASH_MAP_PREFETCH_DIST, hash_values.size()});
+            for (size_t i = 0; i < head_rows; ++i) {
+                hash_table->template prefetch<read>(keys[i], hash_values[i]);
+            }
+        }
+    }
+
     template <typename State>
     ALWAYS_INLINE auto find(State& state, size_t i) {
         if constexpr (!is_string_hash_map()) {
@@ -133,6 +169,29 @@ struct MethodBaseInner {
                                       creator_for_null_key);
     }
 
+    /// Find the keys of rows [0, num_rows), `handler(i, find_result)` is called with the result of
+    /// every row. The hash values of the whole block are already computed, so the first rows are
+    /// prefetched before the loop and every lookup then prefetches the row
+    /// HASH_MAP_PREFETCH_DIST rows ahead.
+    template <typename State, typename Handler>
+    ALWAYS_INLINE void find_batch(State& state, size_t num_rows, Handler&& handler) {
+        prefetch_head<true>(num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            handler(i, find(state, i));
+        }
+    }
+
+    /// Emplace the keys of rows [0, num_rows), `handler(i, mapped)` is called with the mapped
+    /// value of every row after it is emplaced. Prefetches like `find_batch`.
+    template <typename State, typename F, typename FF, typename Handler>
+    ALWAYS_INLINE void lazy_emplace_batch(State& state, size_t num_rows, F&& creator,
+                                          FF&& creator_for_null_key, Handler&& handler) {
+        prefetch_head<false>(num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            handler(i, lazy_emplace(state, i, creator, creator_for_null_key));
+        }
+    }
+
     static constexpr bool is_string_hash_map() {
         return std::is_same_v<StringHashMap<Mapped>, HashMap> ||
                std::is_same_v<DataWithNullKey<StringHashMap<Mapped>>, HashMap>;
@@ -218,6 +277,9 @@ struct MethodSerialized : public MethodBase<TData> {
         size += sizeof(StringRef) * num_rows; // stored_keys
         if (is_join) {
             size += sizeof(uint32_t) * num_rows; // bucket_nums
+            if constexpr (Base::has_hash_tags) {
+                size += sizeof(uint8_t) * num_rows; // hash_tags
+            }
         } else {
             size += sizeof(size_t) * num_rows; // hash_values
         }
@@ -314,6 +376,9 @@ struct MethodStringNoCache : public MethodBase<TData> {
         size += sizeof(StringRef) * num_rows; // stored_keys
         if (is_join) {
             size += sizeof(uint32_t) * num_rows; // bucket_nums
+            if constexpr (Base::has_hash_tags) {
+                size += sizeof(uint8_t) * num_rows; // hash_tags
+            }
         } else {
             size += sizeof(size_t) * num_rows; // hash_values
         }
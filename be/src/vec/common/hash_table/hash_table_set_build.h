@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <vector>
+
 #include "pipeline/exec/set_sink_operator.h"
 #include "runtime/runtime_state.h"
 #include "vec/columns/column.h"
@@ -23,9 +25,17 @@ namespace doris::vectorized {
 constexpr size_t CHECK_FRECUENCY = 65536;
 template <class HashTableContext, bool is_intersect>
 struct HashTableBuild {
+    // The keys not in the hash table yet are mapped to the rows after `num_build_rows` of the
+    // build block in order, and their rows of the input are appended to `new_rows`, so only the
+    // first row of every key needs to be kept.
     template <typename Parent>
-    HashTableBuild(Parent* parent, size_t rows, ColumnRawPtrs& build_raw_ptrs, RuntimeState* state)
-            : _rows(rows), _build_raw_ptrs(build_raw_ptrs), _state(state) {}
+    HashTableBuild(Parent* parent, size_t rows, ColumnRawPtrs& build_raw_ptrs, RuntimeState* state,
+                   size_t num_build_rows, std::vector<uint32_t>& new_rows)
+            : _rows(rows),
+              _build_raw_ptrs(build_raw_ptrs),
+              _state(state),
+              _num_build_rows(num_build_rows),
+              _new_rows(new_rows) {}
 
     Status operator()(HashTableContext& hash_table_ctx, Arena& arena) {
         using KeyGetter = typename HashTableContext::State;
@@ -36,9 +46,13 @@ struct HashTableBuild {
         size_t k = 0;
         auto creator = [&](const auto& ctor, auto& key, auto& origin) {
             HashTableContext::try_presis_key(key, origin, arena);
-            ctor(key, Mapped {k});
+            ctor(key, Mapped {_num_build_rows + _new_rows.size()});
+            _new_rows.push_back(static_cast<uint32_t>(k));
+        };
+        auto creator_for_null_key = [&](auto& mapped) {
+            mapped = {_num_build_rows + _new_rows.size()};
+            _new_rows.push_back(static_cast<uint32_t>(k));
         };
-        auto creator_for_null_key = [&](auto& mapped) { mapped = {k}; };
 
         for (; k < _rows; ++k) {
             if (k % CHECK_FRECUENCY == 0) {
@@ -53,6 +67,8 @@ private:
     const size_t _rows;
     ColumnRawPtrs& _build_raw_ptrs;
     RuntimeState* _state = nullptr;
+    const size_t _num_build_rows;
+    std::vector<uint32_t>& _new_rows;
 };
 
 } // namespace doris::vectorized
@@ -20,7 +20,9 @@
 #include <gen_cpp/PlanNodes_types.h>
 
 #include <limits>
+#include <type_traits>
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "vec/columns/column_filter_helper.h"
@@ -37,6 +39,15 @@ public:
     using value_type = void*;
     size_t hash(const Key& x) const { return Hash()(x); }
 
+    // A few hash bits are kept for every row of string keys, so most of the rows of a bucket
+    // chain whose keys are different are rejected before the key data is compared.
+    static constexpr bool has_hash_tags = std::is_same_v<Key, StringRef>;
+
+    // The bucket takes the low bits of the hash, the tag uses the higher ones.
+    static uint8_t hash_tag(size_t hash_value) {
+        return static_cast<uint8_t>((hash_value >> 24) ^ (hash_value >> 56));
+    }
+
     static uint32_t calc_bucket_size(size_t num_elem) {
         size_t expect_bucket_size = num_elem + (num_elem - 1) / 7;
         return (uint32_t)std::min(phmap::priv::NormalizeCapacity(expect_bucket_size) + 1,
@@ -45,7 +56,8 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(build_tags);
     }
 
     template <int JoinOpType>
@@ -58,6 +70,10 @@ public:
         bucket_size = calc_bucket_size(num_elem + 1);
         first.resize(bucket_size + 1);
         next.resize(num_elem);
+        if constexpr (has_hash_tags) {
+            build_tags.resize(num_elem);
+        }
+        _init_cache_partitions();
 
         if constexpr (JoinOpType == TJoinOp::FULL_OUTER_JOIN ||
                       JoinOpType == TJoinOp::RIGHT_OUTER_JOIN ||
@@ -75,13 +91,28 @@ public:
 
     bool empty_build_side() const { return _empty_build_side; }
 
+    // 0 means the table is built and probed without partitions.
+    uint32_t num_cache_partitions() const { return _num_partitions; }
+
+    // `hash_tags` is required if `has_hash_tags` is true.
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
-               uint32_t num_elem, bool keep_null_key) {
+               uint32_t num_elem, bool keep_null_key,
+               const uint8_t* __restrict hash_tags = nullptr) {
         build_keys = keys;
-        for (uint32_t i = 1; i < num_elem; i++) {
-            uint32_t bucket_num = bucket_nums[i];
-            next[i] = first[bucket_num];
-            first[bucket_num] = i;
+        if constexpr (has_hash_tags) {
+            DCHECK(hash_tags != nullptr || num_elem <= 1);
+            if (hash_tags != nullptr) {
+                memcpy(build_tags.data(), hash_tags, num_elem);
+            }
+        }
+        if (_num_partitions > 0) {
+            _build_partitioned(bucket_nums, num_elem);
+        } else {
+            for (uint32_t i = 1; i < num_elem; i++) {
+                uint32_t bucket_num = bucket_nums[i];
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
         }
         if (!keep_null_key) {
             first[bucket_size] = 0; // index = bucket_size means null
@@ -90,9 +121,9 @@ public:
     }
 
     template <int JoinOpType>
-    auto find_batch(const Key* __restrict keys, const uint32_t* __restrict build_idx_map,
-                    int probe_idx, uint32_t build_idx, int probe_rows,
-                    uint32_t* __restrict probe_idxs, bool& probe_visited,
+    auto find_batch(const Key* __restrict keys, const uint8_t* __restrict hash_tags,
+                    const uint32_t* __restrict build_idx_map, int probe_idx, uint32_t build_idx,
+                    int probe_rows, uint32_t* __restrict probe_idxs, bool& probe_visited,
                     uint32_t* __restrict build_idxs, const uint8_t* null_map,
                     bool with_other_conjuncts, bool is_mark_join, bool has_mark_join_conjunct) {
         if ((JoinOpType == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN ||
@@ -103,8 +134,9 @@ public:
         }
 
         if (with_other_conjuncts) {
-            return _find_batch_conjunct<JoinOpType, false>(
-                    keys, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs, build_idxs);
+            return _find_batch_conjunct<JoinOpType, false>(keys, hash_tags, build_idx_map,
+                                                           probe_idx, build_idx, probe_rows,
+                                                           probe_idxs, build_idxs);
         }
 
         if (is_mark_join) {
@@ -118,33 +150,37 @@ public:
             /// If one row on probe side has one match in build side, we should stop searching the
             /// hash table for this row.
             if (is_null_aware_join || (is_left_half_join && !has_mark_join_conjunct)) {
-                return _find_batch_conjunct<JoinOpType, true>(keys, build_idx_map, probe_idx,
-                                                              build_idx, probe_rows, probe_idxs,
-                                                              build_idxs);
+                return _find_batch_conjunct<JoinOpType, true>(keys, hash_tags, build_idx_map,
+                                                              probe_idx, build_idx, probe_rows,
+                                                              probe_idxs, build_idxs);
             }
 
-            return _find_batch_conjunct<JoinOpType, false>(
-                    keys, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs, build_idxs);
+            return _find_batch_conjunct<JoinOpType, false>(keys, hash_tags, build_idx_map,
+                                                           probe_idx, build_idx, probe_rows,
+                                                           probe_idxs, build_idxs);
         }
 
         if (JoinOpType == TJoinOp::INNER_JOIN || JoinOpType == TJoinOp::FULL_OUTER_JOIN ||
             JoinOpType == TJoinOp::LEFT_OUTER_JOIN || JoinOpType == TJoinOp::RIGHT_OUTER_JOIN) {
-            return _find_batch_inner_outer_join<JoinOpType>(keys, build_idx_map, probe_idx,
-                                                            build_idx, probe_rows, probe_idxs,
-                                                            probe_visited, build_idxs);
+            return _find_batch_inner_outer_join<JoinOpType>(
+                    keys, hash_tags, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs,
+                    probe_visited, build_idxs);
         }
         if (JoinOpType == TJoinOp::LEFT_ANTI_JOIN || JoinOpType == TJoinOp::LEFT_SEMI_JOIN ||
             JoinOpType == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN) {
             if (null_map) {
                 return _find_batch_left_semi_anti<JoinOpType, true>(
-                        keys, build_idx_map, probe_idx, probe_rows, probe_idxs, null_map);
+                        keys, hash_tags, build_idx_map, probe_idx, probe_rows, probe_idxs,
+                        null_map);
             } else {
                 return _find_batch_left_semi_anti<JoinOpType, false>(
-                        keys, build_idx_map, probe_idx, probe_rows, probe_idxs, nullptr);
+                        keys, hash_tags, build_idx_map, probe_idx, probe_rows, probe_idxs,
+                        nullptr);
             }
         }
         if (JoinOpType == TJoinOp::RIGHT_ANTI_JOIN || JoinOpType == TJoinOp::RIGHT_SEMI_JOIN) {
-            return _find_batch_right_semi_anti(keys, build_idx_map, probe_idx, probe_rows);
+            return _find_batch_right_semi_anti(keys, hash_tags, build_idx_map, probe_idx,
+                                               probe_rows);
         }
         throw Exception(ErrorCode::INTERNAL_ERROR, "meet invalid hash join input");
     }
@@ -161,6 +197,7 @@ public:
      * select 'a' not in ('a', 'b', null) => false
      */
     auto find_null_aware_with_other_conjuncts(const Key* __restrict keys,
+                                              const uint8_t* __restrict hash_tags,
                                               const uint32_t* __restrict build_idx_map,
                                               int probe_idx, uint32_t build_idx, int probe_rows,
                                               uint32_t* __restrict probe_idxs,
@@ -169,12 +206,12 @@ public:
                                               bool picking_null_keys, const uint8_t* null_map) {
         if (null_map) {
             return _find_null_aware_with_other_conjuncts_impl<true>(
-                    keys, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs, build_idxs,
-                    null_flags, picking_null_keys, null_map);
+                    keys, hash_tags, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs,
+                    build_idxs, null_flags, picking_null_keys, null_map);
         } else {
             return _find_null_aware_with_other_conjuncts_impl<false>(
-                    keys, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs, build_idxs,
-                    null_flags, picking_null_keys, nullptr);
+                    keys, hash_tags, build_idx_map, probe_idx, build_idx, probe_rows, probe_idxs,
+                    build_idxs, null_flags, picking_null_keys, nullptr);
         }
     }
 
@@ -211,12 +248,123 @@ public:
     bool keep_null_key() { return _keep_null_key; }
 
     void pre_build_idxs(DorisVector<uint32_t>& buckets) const {
+        if (_exceeds_cache) {
+            _pre_build_idxs_with_prefetch(buckets);
+            return;
+        }
         for (unsigned int& bucket : buckets) {
             bucket = first[bucket];
         }
     }
 
 private:
+    ALWAYS_INLINE bool _key_equal(const Key* __restrict keys, const uint8_t* __restrict hash_tags,
+                                  int probe_idx, uint32_t build_idx) const {
+        if constexpr (has_hash_tags) {
+            if (hash_tags[probe_idx] != build_tags[build_idx]) {
+                return false;
+            }
+        }
+        return keys[probe_idx] == build_keys[build_idx];
+    }
+
+    // Buckets are split into partitions by their high bits, every partition covers
+    // `hash_join_cache_partition_bytes` of `first`. Too many partitions make the scatter of
+    // rows miss the TLB, so the partitions get larger instead.
+    static constexpr uint32_t MAX_CACHE_PARTITIONS = 1024;
+
+    void _init_cache_partitions() {
+        _num_partitions = 0;
+        _partition_shift = 0;
+        const auto cache_bytes = config::hash_join_cache_partition_bytes;
+        _exceeds_cache =
+                cache_bytes > 0 && size_t(bucket_size) * sizeof(uint32_t) > size_t(cache_bytes);
+        if (!_exceeds_cache) {
+            return;
+        }
+        uint32_t shift = 0;
+        while ((sizeof(uint32_t) << (shift + 1)) <= size_t(cache_bytes)) {
+            ++shift;
+        }
+        // bucket_size is a power of 2 and is larger than the partition.
+        uint32_t num_partitions = bucket_size >> shift;
+        while (num_partitions > MAX_CACHE_PARTITIONS) {
+            num_partitions >>= 1;
+            ++shift;
+        }
+        if (num_partitions > 1) {
+            _num_partitions = num_partitions;
+            _partition_shift = shift;
+        }
+    }
+
+    // Scatter the rows by the partition of their bucket first, so inserting the rows of a
+    // partition only touches a cache sized range of `first`. Rows of one bucket are inserted in
+    // the same order as the plain build, the bucket chains are identical.
+    void _build_partitioned(const uint32_t* __restrict bucket_nums, uint32_t num_elem) {
+        if (num_elem <= 1) {
+            return;
+        }
+        // The extra partition holds the null bucket, whose index is bucket_size.
+        DorisVector<uint32_t> offsets(_num_partitions + 2, 0);
+        for (uint32_t i = 1; i < num_elem; i++) {
+            offsets[(bucket_nums[i] >> _partition_shift) + 1]++;
+        }
+        for (uint32_t i = 1; i < offsets.size(); i++) {
+            offsets[i] += offsets[i - 1];
+        }
+        DorisVector<uint32_t> rows(num_elem - 1);
+        for (uint32_t i = 1; i < num_elem; i++) {
+            rows[offsets[bucket_nums[i] >> _partition_shift]++] = i;
+        }
+        for (auto row : rows) {
+            uint32_t bucket_num = bucket_nums[row];
+            next[row] = first[bucket_num];
+            first[bucket_num] = row;
+        }
+    }
+
+    // The table does not fit the cache, prefetch the buckets ahead and the chain heads of the
+    // probe batch, which are then walked by `find_batch`.
+    void _pre_build_idxs_with_prefetch(DorisVector<uint32_t>& buckets) const {
+        const auto num_rows = buckets.size();
+        for (size_t i = 0; i < num_rows; i++) {
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num_rows)) {
+                __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]], 0, 1);
+            }
+            const auto build_idx = first[buckets[i]];
+            buckets[i] = build_idx;
+            __builtin_prefetch(&next[build_idx], 0, 1);
+            __builtin_prefetch(&build_keys[build_idx], 0, 1);
+            if constexpr (has_hash_tags) {
+                __builtin_prefetch(&build_tags[build_idx], 0, 1);
+            }
+        }
+    }
+
+    // Group prefetch for the chain walk: the heads of the probe batch were prefetched by
+    // `pre_build_idxs`, here the rows a few probes ahead prefetch the data of their string key and
+    // the second element of their chain, so the dependent misses overlap with the current probe.
+    ALWAYS_INLINE void _prefetch_chain(const uint32_t* __restrict build_idx_map, int probe_idx,
+                                       int probe_rows) const {
+        if (!_exceeds_cache || probe_idx + int(HASH_MAP_PREFETCH_DIST) >= probe_rows) {
+            return;
+        }
+        const auto head = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+        if (!head) {
+            return;
+        }
+        if constexpr (std::is_same_v<Key, StringRef>) {
+            __builtin_prefetch(build_keys[head].data, 0, 1);
+        }
+        const auto second = next[head];
+        __builtin_prefetch(&next[second], 0, 1);
+        __builtin_prefetch(&build_keys[second], 0, 1);
+        if constexpr (has_hash_tags) {
+            __builtin_prefetch(&build_tags[second], 0, 1);
+        }
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -240,13 +388,15 @@ private:
     }
 
     auto _find_batch_right_semi_anti(const Key* __restrict keys,
+                                     const uint8_t* __restrict hash_tags,
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
-                if (!visited[build_idx] && keys[probe_idx] == build_keys[build_idx]) {
+                if (!visited[build_idx] && _key_equal(keys, hash_tags, probe_idx, build_idx)) {
                     visited[build_idx] = 1;
                 }
                 build_idx = next[build_idx];
@@ -257,7 +407,7 @@ private:
     }
 
     template <int JoinOpType, bool has_null_map>
-    auto _find_batch_left_semi_anti(const Key* __restrict keys,
+    auto _find_batch_left_semi_anti(const Key* __restrict keys, const uint8_t* __restrict hash_tags,
                                     const uint32_t* __restrict build_idx_map, int probe_idx,
                                     int probe_rows, uint32_t* __restrict probe_idxs,
                                     const uint8_t* null_map) {
@@ -272,9 +422,10 @@ private:
                 }
             }
 
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
-            while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
+            while (build_idx && !_key_equal(keys, hash_tags, probe_idx, build_idx)) {
                 build_idx = next[build_idx];
             }
             bool matched = JoinOpType == TJoinOp::LEFT_SEMI_JOIN ? build_idx != 0 : build_idx == 0;
@@ -285,15 +436,16 @@ private:
     }
 
     template <int JoinOpType, bool only_need_to_match_one>
-    auto _find_batch_conjunct(const Key* __restrict keys, const uint32_t* __restrict build_idx_map,
-                              int probe_idx, uint32_t build_idx, int probe_rows,
+    auto _find_batch_conjunct(const Key* __restrict keys, const uint8_t* __restrict hash_tags,
+                              const uint32_t* __restrict build_idx_map, int probe_idx,
+                              uint32_t build_idx, int probe_rows,
                               uint32_t* __restrict probe_idxs, uint32_t* __restrict build_idxs) {
         uint32_t matched_cnt = 0;
         const auto batch_size = max_batch_size;
 
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
-                if (keys[probe_idx] == build_keys[build_idx]) {
+                if (_key_equal(keys, hash_tags, probe_idx, build_idx)) {
                     build_idxs[matched_cnt] = build_idx;
                     probe_idxs[matched_cnt] = probe_idx;
                     matched_cnt++;
@@ -328,6 +480,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -338,6 +491,7 @@ private:
 
     template <int JoinOpType>
     auto _find_batch_inner_outer_join(const Key* __restrict keys,
+                                      const uint8_t* __restrict hash_tags,
                                       const uint32_t* __restrict build_idx_map, int probe_idx,
                                       uint32_t build_idx, int probe_rows,
                                       uint32_t* __restrict probe_idxs, bool& probe_visited,
@@ -347,7 +501,7 @@ private:
 
         auto do_the_probe = [&]() {
             while (build_idx && matched_cnt < batch_size) {
-                if (keys[probe_idx] == build_keys[build_idx]) {
+                if (_key_equal(keys, hash_tags, probe_idx, build_idx)) {
                     probe_idxs[matched_cnt] = probe_idx;
                     build_idxs[matched_cnt] = build_idx;
                     matched_cnt++;
@@ -382,6 +536,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -392,10 +547,10 @@ private:
 
     template <bool has_null_map>
     auto _find_null_aware_with_other_conjuncts_impl(
-            const Key* __restrict keys, const uint32_t* __restrict build_idx_map, int probe_idx,
-            uint32_t build_idx, int probe_rows, uint32_t* __restrict probe_idxs,
-            uint32_t* __restrict build_idxs, uint8_t* __restrict null_flags, bool picking_null_keys,
-            const uint8_t* null_map) {
+            const Key* __restrict keys, const uint8_t* __restrict hash_tags,
+            const uint32_t* __restrict build_idx_map, int probe_idx, uint32_t build_idx,
+            int probe_rows, uint32_t* __restrict probe_idxs, uint32_t* __restrict build_idxs,
+            uint8_t* __restrict null_flags, bool picking_null_keys, const uint8_t* null_map) {
         uint32_t matched_cnt = 0;
         const auto batch_size = max_batch_size;
 
@@ -408,7 +563,7 @@ private:
             }
 
             while (build_idx && matched_cnt < batch_size) {
-                if (picking_null_keys || keys[probe_idx] == build_keys[build_idx]) {
+                if (picking_null_keys || _key_equal(keys, hash_tags, probe_idx, build_idx)) {
                     build_idxs[matched_cnt] = build_idx;
                     probe_idxs[matched_cnt] = probe_idx;
                     null_flags[matched_cnt] = picking_null_keys;
@@ -441,6 +596,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
 
             /// If the probe key is null
@@ -462,6 +618,8 @@ private:
 
     const Key* __restrict build_keys;
     DorisVector<uint8_t> visited;
+    // The hash tags of the build rows, only used if `has_hash_tags` is true.
+    DorisVector<uint8_t> build_tags;
 
     uint32_t bucket_size = 1;
     int max_batch_size = 4064;
@@ -474,6 +632,11 @@ private:
     bool _has_null_key = false;
     bool _keep_null_key = false;
     bool _empty_build_side = true;
+
+    // The buckets do not fit `hash_join_cache_partition_bytes`, the probe prefetches the chains.
+    bool _exceeds_cache = false;
+    uint32_t _num_partitions = 0;
+    uint32_t _partition_shift = 0;
 };
 
 template <typename Key, typename Hash = DefaultHash<Key>>
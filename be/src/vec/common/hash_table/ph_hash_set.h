@@ -67,6 +67,13 @@ public:
                                          [&](const auto& ctor) { f(ctor, key, key); });
     }
 
+    /// Only tells whether the key exists, there is no mapped value in a set.
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t hash_value) {
+        auto it = _hash_set.find(key, hash_value);
+        return it != _hash_set.end() ? const_cast<Key*>(&*it) : nullptr;
+    }
+
     template <bool read>
     void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {
         _hash_set.prefetch_hash(hash_value);
@@ -173,6 +180,12 @@ public:
         }
     }
 
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t hash_value) {
+        auto& flag = _hash_table[static_cast<search_key_type>(key)];
+        return flag == set_flag ? &flag : nullptr;
+    }
+
     template <bool read>
     void ALWAYS_INLINE prefetch(const KeyType& key, size_t hash_value) {}
 
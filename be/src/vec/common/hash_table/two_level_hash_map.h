@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <boost/noncopyable.hpp>
+
+#include "vec/common/hash_table/ph_hash_map.h"
+
+/// A hash map made of NUM_SUB_TABLES single-level hash maps, the sub table of a key is chosen by
+/// the bits of its hash value. It has the same interface as PHHashMap, so it can be used by the
+/// hash methods in hash_map_context.h directly.
+/// A resize only rehashes one sub table, which is 1/NUM_SUB_TABLES of the whole table, so inserting
+/// into a huge table does not stall on rehashing all of the elements at once.
+template <typename Impl, size_t BITS_FOR_SUB_TABLE = 8>
+class TwoLevelHashMap : private boost::noncopyable {
+public:
+    using Self = TwoLevelHashMap;
+    using Hash = typename Impl::Hash;
+    using cell_type = typename Impl::cell_type;
+
+    using key_type = typename Impl::key_type;
+    using mapped_type = typename Impl::mapped_type;
+    using Value = typename Impl::Value;
+    using value_type = typename Impl::value_type;
+
+    using LookupResult = typename Impl::LookupResult;
+    using ConstLookupResult = typename Impl::ConstLookupResult;
+
+    static constexpr size_t NUM_SUB_TABLES = 1ULL << BITS_FOR_SUB_TABLE;
+    static constexpr size_t MAX_SUB_TABLE = NUM_SUB_TABLES - 1;
+
+    TwoLevelHashMap() = default;
+
+    /// Move all of the elements of a single-level hash map into the sub tables.
+    explicit TwoLevelHashMap(Impl&& src) {
+        for (auto it = src.begin(); it != src.end(); ++it) {
+            const auto& key = it->get_first();
+            auto hash_value = src.hash(key);
+            LookupResult lookup_result;
+            bool inserted = false;
+            impls[get_sub_table(hash_value)].emplace(key, lookup_result, inserted, hash_value);
+            lookup_result->second = it->get_second();
+        }
+        src.clear_and_shrink();
+    }
+
+    /// Use the bits above the 7 bits phmap keeps in the control bytes, so that the keys in a sub
+    /// table are still spread over its slots.
+    static size_t get_sub_table(size_t hash_value) {
+        return (hash_value >> (32 - BITS_FOR_SUB_TABLE)) & MAX_SUB_TABLE;
+    }
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Container = std::conditional_t<is_const, const Self, Self>;
+        using SubIterator = std::conditional_t<is_const, typename Impl::const_iterator,
+                                               typename Impl::iterator>;
+
+        Container* container = nullptr;
+        size_t sub_table_num = 0;
+        SubIterator current_it;
+
+        friend class TwoLevelHashMap;
+
+        void skip_empty_sub_tables() {
+            while (sub_table_num < MAX_SUB_TABLE &&
+                   current_it == container->impls[sub_table_num].end()) {
+                ++sub_table_num;
+                current_it = container->impls[sub_table_num].begin();
+            }
+        }
+
+    public:
+        iterator_base() = default;
+        iterator_base(Container* container_, size_t sub_table_num_, SubIterator current_it_)
+                : container(container_), sub_table_num(sub_table_num_), current_it(current_it_) {
+            skip_empty_sub_tables();
+        }
+
+        bool operator==(const iterator_base& rhs) const {
+            return sub_table_num == rhs.sub_table_num && current_it == rhs.current_it;
+        }
+        bool operator!=(const iterator_base& rhs) const { return !(*this == rhs); }
+
+        Derived& operator++() {
+            ++current_it;
+            skip_empty_sub_tables();
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const { return current_it->get_first(); }
+
+        const auto& get_second() const { return current_it->get_second(); }
+
+        auto& get_second() { return current_it->get_second(); }
+
+        auto get_ptr() const { return this; }
+        size_t get_hash() const { return current_it->get_hash(); }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0, impls[0].begin()); }
+
+    const_iterator cbegin() const { return begin(); }
+
+    iterator begin() { return iterator(this, 0, impls[0].begin()); }
+
+    const_iterator end() const {
+        return const_iterator(this, MAX_SUB_TABLE, impls[MAX_SUB_TABLE].end());
+    }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, MAX_SUB_TABLE, impls[MAX_SUB_TABLE].end()); }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key_holder, LookupResult& it, bool& inserted) {
+        auto hash_value = hash(key_holder);
+        impls[get_sub_table(hash_value)].emplace(key_holder, it, inserted, hash_value);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key_holder, LookupResult& it, Func&& f) {
+        impls[get_sub_table(hash(key_holder))].lazy_emplace(key_holder, it, std::forward<Func>(f));
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t hash_value) {
+        impls[get_sub_table(hash_value)].emplace(key, it, inserted, hash_value);
+    }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t hash_value,
+                                    Func&& f) {
+        impls[get_sub_table(hash_value)].lazy_emplace(key, it, hash_value, std::forward<Func>(f));
+    }
+
+    void ALWAYS_INLINE insert(const key_type& key, const mapped_type& value) {
+        impls[get_sub_table(hash(key))].insert(key, value);
+    }
+
+    void insert(const iterator& other_iter) {
+        insert(other_iter->get_first(), other_iter->get_second());
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        auto hash_value = hash(key);
+        return impls[get_sub_table(hash_value)].find(key, hash_value);
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t hash_value) {
+        return impls[get_sub_table(hash_value)].find(key, hash_value);
+    }
+
+    size_t hash(const key_type& x) const { return impls[0].hash(x); }
+
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const key_type& key, size_t hash_value) {
+        impls[get_sub_table(hash_value)].template prefetch<read>(key, hash_value);
+    }
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (auto& impl : impls) {
+            impl.for_each_mapped(func);
+        }
+    }
+
+    size_t get_buffer_size_in_bytes() const {
+        size_t res = 0;
+        for (const auto& impl : impls) {
+            res += impl.get_buffer_size_in_bytes();
+        }
+        return res;
+    }
+
+    /// The rows are assumed to be spread over the sub tables evenly.
+    bool add_elem_size_overflow(size_t row) const {
+        for (const auto& impl : impls) {
+            if (impl.add_elem_size_overflow(row / NUM_SUB_TABLES + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t estimate_memory(size_t num_elem) const {
+        size_t res = 0;
+        for (const auto& impl : impls) {
+            res += impl.estimate_memory(num_elem / NUM_SUB_TABLES + 1);
+        }
+        return res;
+    }
+
+    size_t size() const {
+        size_t res = 0;
+        for (const auto& impl : impls) {
+            res += impl.size();
+        }
+        return res;
+    }
+
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const {
+        for (const auto& impl : impls) {
+            if (!impl.empty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void clear_and_shrink() {
+        for (auto& impl : impls) {
+            impl.clear_and_shrink();
+        }
+    }
+
+    void reserve(size_t num_elem) {
+        for (auto& impl : impls) {
+            impl.reserve(num_elem / NUM_SUB_TABLES + 1);
+        }
+    }
+
+    std::array<Impl, NUM_SUB_TABLES> impls;
+};
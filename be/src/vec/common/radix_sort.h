@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "vec/common/pod_array.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+/// Below this number of rows pdqsort over the permutation is as fast, the histograms of the radix
+/// sort are not paid off.
+static constexpr size_t RADIX_SORT_MIN_ROWS = 256;
+
+template <typename T>
+constexpr bool is_radix_sortable_v =
+        std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= sizeof(uint64_t);
+
+/// LSD radix sort of the elements by their integer keys, one byte per pass. The keys are mapped
+/// to unsigned integers of the same order first (the sign bit of signed keys is flipped, and all
+/// of the bits are flipped for a descending sort), the histograms of all of the bytes are built by
+/// a single scan, and a pass is skipped if all of the keys have the same value in its byte.
+/// The sort is stable, so the elements of equal keys keep their order.
+template <typename Element, typename GetKey>
+void radix_sort(Element* __restrict elements, size_t size, bool reverse, GetKey&& get_key) {
+    using Key = std::decay_t<decltype(get_key(*elements))>;
+    static_assert(is_radix_sortable_v<Key>);
+    using UnsignedKey = std::make_unsigned_t<Key>;
+    static constexpr size_t NUM_PASSES = sizeof(Key);
+    static constexpr size_t HISTOGRAM_SIZE = 256;
+
+    if (size <= 1) {
+        return;
+    }
+
+    auto get_byte = [&](const Element& element, size_t pass) {
+        auto value = static_cast<UnsignedKey>(get_key(element));
+        if constexpr (std::is_signed_v<Key>) {
+            value ^= static_cast<UnsignedKey>(UnsignedKey(1) << (sizeof(Key) * 8 - 1));
+        }
+        if (reverse) {
+            value = static_cast<UnsignedKey>(~value);
+        }
+        return static_cast<size_t>((value >> (pass * 8)) & 0xFF);
+    };
+
+    std::array<std::array<uint32_t, HISTOGRAM_SIZE>, NUM_PASSES> histograms {};
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t pass = 0; pass < NUM_PASSES; ++pass) {
+            ++histograms[pass][get_byte(elements[i], pass)];
+        }
+    }
+
+    PaddedPODArray<Element> swap_buffer(size);
+    auto* src = elements;
+    auto* dst = swap_buffer.data();
+    for (size_t pass = 0; pass < NUM_PASSES; ++pass) {
+        auto& histogram = histograms[pass];
+        if (histogram[get_byte(src[0], pass)] == size) {
+            continue;
+        }
+        uint32_t offset = 0;
+        for (auto& count : histogram) {
+            const auto current = count;
+            count = offset;
+            offset += current;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            dst[histogram[get_byte(src[i], pass)]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != elements) {
+        std::copy(src, src + size, elements);
+    }
+}
+
+/// Sorts the row numbers of `keys` by radix_sort, for ColumnVector::get_permutation.
+template <typename T, typename Permutation>
+void radix_sort_permutation(const T* __restrict keys, size_t size, bool reverse,
+                            Permutation& res) {
+    struct Element {
+        T key;
+        uint32_t row;
+    };
+
+    PaddedPODArray<Element> elements(size);
+    for (size_t i = 0; i < size; ++i) {
+        elements[i] = {keys[i], static_cast<uint32_t>(i)};
+    }
+    radix_sort(elements.data(), size, reverse, [](const Element& element) { return element.key; });
+
+    res.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        res[i] = elements[i].row;
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -39,13 +39,31 @@ class VSortExecExprs;
 
 namespace doris::vectorized {
 
+namespace {
+
+// row_number() numbers only the first partition_inner_limit rows of a partition, so the rest of
+// the rows of every block need not be sorted at all.
+int64_t get_block_sort_limit(int64_t limit, bool has_global_limit, int64_t partition_inner_limit,
+                             TopNAlgorithm::type top_n_algorithm) {
+    if ((has_global_limit || top_n_algorithm == TopNAlgorithm::ROW_NUMBER) &&
+        partition_inner_limit > 0) {
+        return limit < 0 ? partition_inner_limit : std::min(limit, partition_inner_limit);
+    }
+    return limit;
+}
+
+} // namespace
+
 PartitionSorter::PartitionSorter(VSortExecExprs& vsort_exec_exprs, int64_t limit, int64_t offset,
                                  ObjectPool* pool, std::vector<bool>& is_asc_order,
                                  std::vector<bool>& nulls_first, const RowDescriptor& row_desc,
                                  RuntimeState* state, RuntimeProfile* profile,
                                  bool has_global_limit, int64_t partition_inner_limit,
                                  TopNAlgorithm::type top_n_algorithm, SortCursorCmp* previous_row)
-        : Sorter(vsort_exec_exprs, limit, offset, pool, is_asc_order, nulls_first),
+        : Sorter(vsort_exec_exprs,
+                 get_block_sort_limit(limit, has_global_limit, partition_inner_limit,
+                                      top_n_algorithm),
+                 offset, pool, is_asc_order, nulls_first),
           _state(MergeSorterState::create_unique(row_desc, offset)),
           _row_desc(row_desc),
           _partition_inner_limit(partition_inner_limit),
@@ -59,10 +77,52 @@ Status PartitionSorter::append_block(Block* input_block) {
     Block sorted_block = VectorizedUtils::create_empty_columnswithtypename(_row_desc);
     DCHECK(input_block->columns() == sorted_block.columns());
     RETURN_IF_ERROR(partial_sort(*input_block, sorted_block));
+    _cut_sorted_block(sorted_block);
     _state->add_sorted_block(Block::create_shared(std::move(sorted_block)));
     return Status::OK();
 }
 
+// The rows of a sorted block after the first partition_inner_limit ranks could never be output,
+// whatever the other blocks of the partition are, as the ranks only grow by merging.
+void PartitionSorter::_cut_sorted_block(Block& sorted_block) const {
+    const size_t rows = sorted_block.rows();
+    if (_top_n_algorithm == TopNAlgorithm::ROW_NUMBER || _partition_inner_limit <= 0 ||
+        rows <= static_cast<size_t>(_partition_inner_limit)) {
+        return;
+    }
+    auto same_sort_key = [&](size_t lhs, size_t rhs) {
+        for (const auto& column_desc : _sort_description) {
+            const auto& column = sorted_block.get_by_position(column_desc.column_number).column;
+            if (column->compare_at(lhs, rhs, *column, column_desc.nulls_direction) != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    size_t keep_rows = 0;
+    if (_top_n_algorithm == TopNAlgorithm::RANK) {
+        // rank() of the rows equal to the last row inside the limit is still inside the limit.
+        keep_rows = static_cast<size_t>(_partition_inner_limit);
+        while (keep_rows < rows && same_sort_key(keep_rows - 1, keep_rows)) {
+            ++keep_rows;
+        }
+    } else {
+        int64_t distinct_rows = 1;
+        keep_rows = 1;
+        while (keep_rows < rows) {
+            if (!same_sort_key(keep_rows - 1, keep_rows) &&
+                ++distinct_rows > _partition_inner_limit) {
+                break;
+            }
+            ++keep_rows;
+        }
+    }
+    if (keep_rows < rows) {
+        sorted_block.set_num_rows(keep_rows);
+    }
+}
+
 Status PartitionSorter::prepare_for_read(bool is_spill) {
     if (is_spill) {
         return Status::InternalError("PartitionSorter does not support spill");
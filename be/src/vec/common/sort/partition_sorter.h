@@ -99,6 +99,7 @@ public:
     void set_prepared_finish() { _prepared_finish = true; }
 
 private:
+    void _cut_sorted_block(Block& sorted_block) const;
     Status _read_row_num(Block* block, bool* eos, int batch_size);
     Status _read_row_rank(Block* block, bool* eos, int batch_size);
     bool _get_enough_data() const {
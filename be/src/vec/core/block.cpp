@@ -20,6 +20,7 @@
 
 #include "vec/core/block.h"
 
+#include <butil/iobuf.h>
 #include <fmt/format.h>
 #include <gen_cpp/data.pb.h>
 #include <glog/logging.h>
@@ -29,6 +30,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <iomanip>
 #include <iterator>
 #include <limits>
@@ -42,10 +44,12 @@
 #include "runtime/descriptors.h"
 #include "runtime/thread_context.h"
 #include "util/block_compression.h"
+#include "util/countdown_latch.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 #include "util/simd/bits.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nothing.h"
@@ -112,18 +116,151 @@ Block::Block(const std::vector<SlotDescriptor>& slots, size_t block_size,
     *this = Block(slot_ptrs, block_size, ignore_trivial_slot);
 }
 
+namespace {
+
+// Since COLUMN_COMPRESSION_FRAMES, the compressed column values of a block are laid out as:
+//   uint32 number of frames
+//   per frame: uint32 number of columns, uint64 uncompressed size, uint64 stored size
+//   the stored bytes of the frames
+// A frame holds consecutive columns and is at least MIN_COLUMN_FRAME_BYTES unless it is the last
+// one. It is stored uncompressed if the compression does not shrink it.
+constexpr size_t MIN_COLUMN_FRAME_BYTES = 256 * 1024;
+constexpr size_t COLUMN_FRAME_HEADER_BYTES = sizeof(uint32_t) + 2 * sizeof(uint64_t);
+
+struct ColumnFrame {
+    uint32_t num_columns = 0;
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+template <typename T>
+void append_value(std::string* buf, T value) {
+    buf->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(const char* data) {
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+// Compresses the serialized columns ending at `column_ends` of `column_values` in frames. The
+// first frame is compressed by this thread, the others by `pool` if it is not null.
+Status compress_column_frames(BlockCompressionCodec* codec, const std::string& column_values,
+                              const std::vector<size_t>& column_ends, ThreadPool* pool,
+                              std::string* output) {
+    std::vector<ColumnFrame> frames;
+    size_t begin = 0;
+    for (size_t end : column_ends) {
+        if (frames.empty() || frames.back().end - frames.back().begin >= MIN_COLUMN_FRAME_BYTES) {
+            frames.emplace_back();
+            frames.back().begin = begin;
+        }
+        ++frames.back().num_columns;
+        frames.back().end = end;
+        begin = end;
+    }
+
+    // faststring is not movable, the outputs are constructed in place.
+    std::vector<faststring> compressed(frames.size());
+    std::vector<Status> statuses(frames.size());
+    auto compress = [&](size_t i) -> Status {
+        RETURN_IF_ERROR_OR_CATCH_EXCEPTION(codec->compress(
+                Slice(column_values.data() + frames[i].begin, frames[i].end - frames[i].begin),
+                &compressed[i]));
+        return Status::OK();
+    };
+    CountDownLatch latch(cast_set<int>(frames.size()));
+    size_t submitted = 0;
+    if (pool != nullptr && frames.size() > 1) {
+        auto resource_ctx = thread_context()->is_attach_task() ? thread_context()->resource_ctx()
+                                                               : nullptr;
+        for (size_t i = 1; i < frames.size(); ++i) {
+            auto st = pool->submit_func([&, i, resource_ctx]() {
+                if (resource_ctx != nullptr) {
+                    SCOPED_ATTACH_TASK(resource_ctx);
+                    statuses[i] = compress(i);
+                } else {
+                    statuses[i] = compress(i);
+                }
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                break;
+            }
+            ++submitted;
+        }
+    }
+    // The frames which are not submitted to the pool are compressed by this thread.
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (i == 0 || i > submitted) {
+            statuses[i] = compress(i);
+            latch.count_down();
+        }
+    }
+    latch.wait();
+
+    size_t output_size = sizeof(uint32_t) + frames.size() * COLUMN_FRAME_HEADER_BYTES;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        RETURN_IF_ERROR(statuses[i]);
+        output_size += std::min(compressed[i].size(), frames[i].end - frames[i].begin);
+    }
+    output->reserve(output_size);
+    append_value(output, cast_set<uint32_t>(frames.size()));
+    for (size_t i = 0; i < frames.size(); ++i) {
+        const size_t uncompressed_size = frames[i].end - frames[i].begin;
+        append_value(output, frames[i].num_columns);
+        append_value(output, static_cast<uint64_t>(uncompressed_size));
+        append_value(output,
+                     static_cast<uint64_t>(std::min(compressed[i].size(), uncompressed_size)));
+    }
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (compressed[i].size() < frames[i].end - frames[i].begin) {
+            output->append(reinterpret_cast<const char*>(compressed[i].data()),
+                           compressed[i].size());
+        } else {
+            output->append(column_values.data() + frames[i].begin,
+                           frames[i].end - frames[i].begin);
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace
+
 Status Block::deserialize(const PBlock& pblock) {
+    return _deserialize(pblock, pblock.column_values().data(), pblock.column_values().size());
+}
+
+Status Block::deserialize(const PBlock& pblock, const butil::IOBuf& column_values) {
+    if (column_values.backing_block_num() == 1) {
+        auto data = column_values.backing_block(0);
+        return _deserialize(pblock, data.data(), data.size());
+    }
+    // Decompression and column deserialization need continuous memory, gather the received
+    // buffers once. This is the copy protobuf would have done when parsing the request.
+    std::string buf;
+    column_values.copy_to(&buf);
+    return _deserialize(pblock, buf.data(), buf.size());
+}
+
+Status Block::_deserialize(const PBlock& pblock, const char* column_values, size_t size) {
     swap(Block());
     int be_exec_version = pblock.has_be_exec_version() ? pblock.be_exec_version() : 0;
     RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
 
+    if (pblock.compressed() && be_exec_version >= COLUMN_COMPRESSION_FRAMES) {
+        return _deserialize_column_frames(pblock, column_values, size);
+    }
+
     const char* buf = nullptr;
     std::string compression_scratch;
     if (pblock.compressed()) {
         // Decompress
         SCOPED_RAW_TIMER(&_decompress_time_ns);
-        const char* compressed_data = pblock.column_values().c_str();
-        size_t compressed_size = pblock.column_values().size();
+        const char* compressed_data = column_values;
+        size_t compressed_size = size;
         size_t uncompressed_size = 0;
         if (pblock.has_compression_type() && pblock.has_uncompressed_size()) {
             BlockCompressionCodec* codec;
@@ -147,7 +284,7 @@ Status Block::deserialize(const PBlock& pblock) {
         _decompressed_bytes = uncompressed_size;
         buf = compression_scratch.data();
     } else {
-        buf = pblock.column_values().data();
+        buf = column_values;
     }
 
     for (const auto& pcol_meta : pblock.column_metas()) {
@@ -163,6 +300,72 @@ Status Block::deserialize(const PBlock& pblock) {
     return Status::OK();
 }
 
+Status Block::_deserialize_column_frames(const PBlock& pblock, const char* column_values,
+                                         size_t size) {
+    BlockCompressionCodec* codec;
+    RETURN_IF_ERROR(get_block_compression_codec(pblock.compression_type(), &codec));
+    auto corrupted = [&]() {
+        return Status::InternalError("The column frames of block are corrupted, size={}", size);
+    };
+    if (size < sizeof(uint32_t)) {
+        return corrupted();
+    }
+    const auto num_frames = read_value<uint32_t>(column_values);
+    const size_t headers_size = sizeof(uint32_t) + num_frames * COLUMN_FRAME_HEADER_BYTES;
+    if (headers_size > size) {
+        return corrupted();
+    }
+    const char* header = column_values + sizeof(uint32_t);
+    const char* stored = column_values + headers_size;
+    const char* stored_end = column_values + size;
+
+    // The frames are decompressed one by one into the scratch, which is padded for the column
+    // deserialization like the whole column values.
+    std::string scratch;
+    int column_id = 0;
+    for (uint32_t i = 0; i < num_frames; ++i, header += COLUMN_FRAME_HEADER_BYTES) {
+        const auto num_columns = read_value<uint32_t>(header);
+        const auto uncompressed_size = read_value<uint64_t>(header + sizeof(uint32_t));
+        const auto stored_size =
+                read_value<uint64_t>(header + sizeof(uint32_t) + sizeof(uint64_t));
+        if (stored_size > static_cast<uint64_t>(stored_end - stored) ||
+            stored_size > uncompressed_size ||
+            num_columns > static_cast<uint32_t>(pblock.column_metas_size() - column_id)) {
+            return corrupted();
+        }
+        {
+            SCOPED_RAW_TIMER(&_decompress_time_ns);
+            scratch.resize(uncompressed_size + STREAMVBYTE_PADDING);
+            if (stored_size == uncompressed_size) {
+                memcpy(scratch.data(), stored, stored_size);
+            } else {
+                Slice decompressed(scratch.data(), uncompressed_size);
+                RETURN_IF_ERROR(codec->decompress(Slice(stored, stored_size), &decompressed));
+                if (decompressed.size != uncompressed_size) {
+                    return corrupted();
+                }
+            }
+        }
+        _decompressed_bytes += uncompressed_size;
+        stored += stored_size;
+
+        const char* buf = scratch.data();
+        for (uint32_t j = 0; j < num_columns; ++j, ++column_id) {
+            const auto& pcol_meta = pblock.column_metas(column_id);
+            DataTypePtr type = DataTypeFactory::instance().create_data_type(pcol_meta);
+            MutableColumnPtr data_column = type->create_column();
+            RETURN_IF_CATCH_EXCEPTION(
+                    buf = type->deserialize(buf, &data_column, pblock.be_exec_version()));
+            data.emplace_back(data_column->get_ptr(), type, pcol_meta.name());
+        }
+    }
+    if (column_id != pblock.column_metas_size()) {
+        return corrupted();
+    }
+    initialize_index_by_name();
+    return Status::OK();
+}
+
 void Block::reserve(size_t count) {
     index_by_name.reserve(count);
     data.reserve(count);
@@ -916,7 +1119,7 @@ Status Block::filter_block(Block* block, size_t filter_column_id, size_t column_
 Status Block::serialize(int be_exec_version, PBlock* pblock,
                         /*std::string* compressed_buffer,*/ size_t* uncompressed_bytes,
                         size_t* compressed_bytes, segment_v2::CompressionTypePB compression_type,
-                        bool allow_transfer_large_data) const {
+                        bool allow_transfer_large_data, ThreadPool* compression_pool) const {
     RETURN_IF_ERROR(BeExecVersionManager::check_be_exec_version(be_exec_version));
     pblock->set_be_exec_version(be_exec_version);
 
@@ -945,8 +1148,11 @@ Status Block::serialize(int be_exec_version, PBlock* pblock,
     }
     char* buf = column_values.data();
 
+    std::vector<size_t> column_ends;
+    column_ends.reserve(columns());
     for (const auto& c : *this) {
         buf = c.type->serialize(*(c.column), buf, pblock->be_exec_version());
+        column_ends.push_back(buf - column_values.data());
     }
     *uncompressed_bytes = content_uncompressed_size;
     const size_t serialize_bytes = buf - column_values.data() + STREAMVBYTE_PADDING;
@@ -962,21 +1168,30 @@ Status Block::serialize(int be_exec_version, PBlock* pblock,
         BlockCompressionCodec* codec;
         RETURN_IF_ERROR(get_block_compression_codec(compression_type, &codec));
 
-        faststring buf_compressed;
-        RETURN_IF_ERROR_OR_CATCH_EXCEPTION(
-                codec->compress(Slice(column_values.data(), serialize_bytes), &buf_compressed));
-        size_t compressed_size = buf_compressed.size();
-        if (LIKELY(compressed_size < serialize_bytes)) {
-            // TODO: rethink the logic here may copy again ?
-            pblock->set_column_values(buf_compressed.data(), buf_compressed.size());
+        if (be_exec_version >= COLUMN_COMPRESSION_FRAMES) {
+            std::string frames;
+            RETURN_IF_ERROR(compress_column_frames(codec, column_values, column_ends,
+                                                   compression_pool, &frames));
+            *compressed_bytes = frames.size();
+            pblock->set_column_values(std::move(frames));
             pblock->set_compressed(true);
-            *compressed_bytes = compressed_size;
         } else {
-            pblock->set_column_values(std::move(column_values));
+            faststring buf_compressed;
+            RETURN_IF_ERROR_OR_CATCH_EXCEPTION(codec->compress(
+                    Slice(column_values.data(), serialize_bytes), &buf_compressed));
+            size_t compressed_size = buf_compressed.size();
+            if (LIKELY(compressed_size < serialize_bytes)) {
+                // TODO: rethink the logic here may copy again ?
+                pblock->set_column_values(buf_compressed.data(), buf_compressed.size());
+                pblock->set_compressed(true);
+                *compressed_bytes = compressed_size;
+            } else {
+                pblock->set_column_values(std::move(column_values));
+            }
         }
 
         VLOG_ROW << "uncompressed size: " << content_uncompressed_size
-                 << ", compressed size: " << compressed_size;
+                 << ", compressed size: " << *compressed_bytes;
     } else {
         pblock->set_column_values(std::move(column_values));
     }
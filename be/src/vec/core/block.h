@@ -48,11 +48,16 @@
 
 class SipHash;
 
+namespace butil {
+class IOBuf;
+} // namespace butil
+
 namespace doris {
 
 class TupleDescriptor;
 class PBlock;
 class SlotDescriptor;
+class ThreadPool;
 
 namespace segment_v2 {
 enum CompressionTypePB : int;
@@ -288,12 +293,19 @@ public:
     }
 
     // serialize block to PBlock
+    // Since COLUMN_COMPRESSION_FRAMES, the columns are compressed in independent frames, which are
+    // compressed in parallel by `compression_pool` if it is not null.
     Status serialize(int be_exec_version, PBlock* pblock, size_t* uncompressed_bytes,
                      size_t* compressed_bytes, segment_v2::CompressionTypePB compression_type,
-                     bool allow_transfer_large_data = false) const;
+                     bool allow_transfer_large_data = false,
+                     ThreadPool* compression_pool = nullptr) const;
 
     Status deserialize(const PBlock& pblock);
 
+    // deserialize block from PBlock whose column values are kept in `column_values` instead of
+    // `PBlock::column_values`, e.g. received in brpc attachment.
+    Status deserialize(const PBlock& pblock, const butil::IOBuf& column_values);
+
     std::unique_ptr<Block> create_same_struct_block(size_t size, bool is_reserve = false) const;
 
     /** Compares (*this) n-th row and rhs m-th row.
@@ -390,6 +402,10 @@ public:
 
 private:
     void erase_impl(size_t position);
+
+    Status _deserialize(const PBlock& pblock, const char* column_values, size_t size);
+    Status _deserialize_column_frames(const PBlock& pblock, const char* column_values,
+                                      size_t size);
 };
 
 using Blocks = std::vector<Block>;
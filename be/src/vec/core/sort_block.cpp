@@ -20,7 +20,9 @@
 
 #include "vec/core/sort_block.h"
 
+#include "common/config.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/core/sort_normalized_keys.h"
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
@@ -78,7 +80,15 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
 
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
-        {
+        ColumnRawPtrs sort_columns;
+        for (const auto& column_with_sort_desc : columns_with_sort_desc) {
+            sort_columns.push_back(column_with_sort_desc.first);
+        }
+        NormalizedSortKeys normalized_keys;
+        if (config::enable_sort_normalized_keys &&
+            normalized_keys.encode(sort_columns, description)) {
+            normalized_keys.sort_permutation(perm, limit);
+        } else {
             EqualFlags flags(size, 1);
             EqualRange range {0, size};
 
@@ -25,6 +25,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <cstring>
 #include <boost/iterator/iterator_facade.hpp>
 #include <utility>
 #include <vector>
@@ -37,7 +38,9 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_struct.h"
+#include "vec/common/endian.h"
 #include "vec/common/memcmp_small.h"
+#include "vec/common/radix_sort.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
 #include "vec/core/sort_description.h"
@@ -133,9 +136,44 @@ struct ColumnPartialSortingLess {
     }
 };
 
+// A string with its first 8 bytes loaded as a big endian integer, the strings are mostly ordered
+// by comparing the prefixes without touching the chars of the column.
+struct PrefixedStringRef {
+    static constexpr size_t PREFIX_SIZE = sizeof(UInt64);
+
+    PrefixedStringRef() = default;
+    explicit PrefixedStringRef(const StringRef& value) : ref(value) {
+        if (ref.size >= PREFIX_SIZE) {
+            prefix = BigEndian::Load64(ref.data);
+        } else {
+            char buf[PREFIX_SIZE] = {};
+            memcpy(buf, ref.data, ref.size);
+            prefix = BigEndian::Load64(buf);
+        }
+    }
+
+    int compare(const PrefixedStringRef& rhs) const {
+        if (prefix != rhs.prefix) {
+            return prefix < rhs.prefix ? -1 : 1;
+        }
+        // The strings are padded by zeros in the prefixes, so a string no longer than the prefix
+        // is a prefix of the other string.
+        if (ref.size <= PREFIX_SIZE || rhs.ref.size <= PREFIX_SIZE) {
+            return ref.size < rhs.ref.size ? -1 : (ref.size > rhs.ref.size ? 1 : 0);
+        }
+        return memcmp_small_allow_overflow15(
+                reinterpret_cast<const UInt8*>(ref.data) + PREFIX_SIZE, ref.size - PREFIX_SIZE,
+                reinterpret_cast<const UInt8*>(rhs.ref.data) + PREFIX_SIZE,
+                rhs.ref.size - PREFIX_SIZE);
+    }
+
+    UInt64 prefix = 0;
+    StringRef ref;
+};
+
 template <PrimitiveType T>
 struct PermutationWithInlineValue {
-    using ValueType = std::conditional_t<is_string_type(T), StringRef,
+    using ValueType = std::conditional_t<is_string_type(T), PrefixedStringRef,
                                          typename PrimitiveTypeTraits<T>::ColumnItemType>;
     ValueType inline_value;
     uint32_t row_id;
@@ -361,7 +399,8 @@ private:
                 permutation_for_column[i].inline_value = column.get_data()[row_id];
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
-                permutation_for_column[i].inline_value = column.get_data_at(row_id);
+                permutation_for_column[i].inline_value =
+                        PrefixedStringRef(column.get_data_at(row_id));
             } else {
                 static_assert(always_false_v<ColumnType>);
             }
@@ -443,13 +482,12 @@ private:
         _create_permutation(column, permutation_for_column.data(), perms);
         auto comparator = [&](const PermutationWithInlineValue<InlineType>& a,
                               const PermutationWithInlineValue<InlineType>& b) {
-            if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
+            if constexpr (!std::is_same_v<ColumnType, ColumnString> &&
+                          !std::is_same_v<ColumnType, ColumnString64>) {
                 return a.inline_value > b.inline_value ? 1
                                                        : (a.inline_value < b.inline_value ? -1 : 0);
             } else {
-                return memcmp_small_allow_overflow15(
-                        reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
-                        reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
+                return a.inline_value.compare(b.inline_value);
             }
         };
 
@@ -475,6 +513,16 @@ private:
                 }
                 new_limit = _limit + equal_count;
             } else {
+                using ValueType = typename PermutationWithInlineValue<InlineType>::ValueType;
+                if constexpr (is_radix_sortable_v<ValueType>) {
+                    if (last_iter - first_iter >= RADIX_SORT_MIN_ROWS) {
+                        radix_sort(&*begin, last_iter - first_iter, _direction < 0,
+                                   [](const PermutationWithInlineValue<InlineType>& value) {
+                                       return value.inline_value;
+                                   });
+                        return;
+                    }
+                }
                 pdqsort(begin, end, sort_comparator);
             }
         };
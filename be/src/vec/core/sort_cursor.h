@@ -22,10 +22,12 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
 #include "vec/core/field.h"
 #include "vec/core/sort_description.h"
+#include "vec/core/sort_normalized_keys.h"
 #include "vec/exprs/vexpr_context.h"
 
 namespace doris::vectorized {
@@ -43,6 +45,9 @@ struct MergeSortCursorImpl {
     size_t sort_columns_size = 0;
     int pos = 0;
     int rows = 0;
+    /// Only for multiple sort columns, the rows are compared by memcmp of their keys if the keys
+    /// of both of the cursors are encoded.
+    NormalizedSortKeys normalized_keys;
 
     MergeSortCursorImpl() = default;
     virtual ~MergeSortCursorImpl() = default;
@@ -91,6 +96,11 @@ struct MergeSortCursorImpl {
                                            : column_desc.column_number;
             sort_columns.push_back(columns[column_number]);
         }
+        if (config::enable_sort_normalized_keys && sort_columns_size > 1) {
+            normalized_keys.encode(sort_columns, desc);
+        } else {
+            normalized_keys.clear();
+        }
 
         pos = 0;
         rows = (int)block->rows();
@@ -176,6 +186,11 @@ struct MergeSortCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t greater_at(const MergeSortCursor& rhs, size_t lhs_pos, size_t rhs_pos) const {
+        if (impl->normalized_keys.comparable_with(rhs.impl->normalized_keys)) {
+            const int res =
+                    impl->normalized_keys.compare_at(lhs_pos, rhs_pos, rhs.impl->normalized_keys);
+            return res > 0 ? 1 : (res < 0 ? -1 : 0);
+        }
         for (size_t i = 0; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
@@ -217,6 +232,11 @@ struct MergeSortBlockCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t less_at(const MergeSortBlockCursor& rhs, int rows) const {
+        if (impl->normalized_keys.comparable_with(rhs.impl->normalized_keys)) {
+            const int res = impl->normalized_keys.compare_at(rows, rhs->rows - 1,
+                                                             rhs.impl->normalized_keys);
+            return res < 0 ? 1 : (res > 0 ? -1 : 0);
+        }
         for (size_t i = 0; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
@@ -473,5 +493,104 @@ template <typename Cursor>
 using SortingQueue = SortingQueueImpl<Cursor, SortingQueueStrategy::Default>;
 template <typename Cursor>
 using SortingQueueBatch = SortingQueueImpl<Cursor, SortingQueueStrategy::Batch>;
+
+/// Tournament tree of losers over a fixed set of cursors (Knuth, TAOCP vol. 3, 5.4.1). Every
+/// internal node keeps the loser of the match played there and the root keeps the winner, so
+/// after the top cursor is advanced only the matches on the path from its leaf to the root are
+/// replayed: log2(k) comparisons, while the sift-down of a binary heap takes up to 2 * log2(k).
+/// The top cursor may as well be reset to its next block before it is replayed. An exhausted
+/// cursor stays in its leaf and loses every match. Equal rows are won by the lower leaf, so the
+/// merge is stable in the order of the cursors.
+template <typename Cursor>
+class LoserTree {
+public:
+    LoserTree() = default;
+
+    template <typename Cursors, typename IsActive>
+    LoserTree(const Cursors& cursors, IsActive&& is_active) {
+        _cursors.reserve(cursors.size());
+        for (const auto& cursor : cursors) {
+            _cursors.emplace_back(cursor);
+            _active.push_back(is_active(_cursors.back()));
+            _num_active += _active.back();
+        }
+        _build();
+    }
+
+    bool empty() const { return _num_active == 0; }
+    size_t size() const { return _num_active; }
+
+    const Cursor& top() const {
+        DCHECK(!empty());
+        return _cursors[_tree[0]];
+    }
+
+    /// The top cursor was advanced and still has rows, let it play its way up again.
+    void update_top() { _replay(_tree[0]); }
+
+    /// The top cursor is exhausted, all of the other cursors win over it from now on.
+    void deactivate_top() {
+        const size_t leaf = _tree[0];
+        DCHECK(_active[leaf]);
+        _active[leaf] = false;
+        --_num_active;
+        _replay(leaf);
+    }
+
+private:
+    /// Whether leaf `lhs` is merged before leaf `rhs`.
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_active[lhs]) {
+            return false;
+        }
+        if (!_active[rhs]) {
+            return true;
+        }
+        const auto& lhs_cursor = _cursors[lhs];
+        const auto& rhs_cursor = _cursors[rhs];
+        const int8_t res = lhs_cursor.greater_at(rhs_cursor, lhs_cursor->pos, rhs_cursor->pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    /// The leaf `leaf` sits at node `leaf + k` of the implicit tree of 2 * k nodes, whose root is
+    /// node 1. _tree[0] is the overall winner.
+    void _build() {
+        const size_t k = _cursors.size();
+        if (k == 0) {
+            return;
+        }
+        std::vector<size_t> winners(2 * k);
+        _tree.assign(k, 0);
+        for (size_t leaf = 0; leaf < k; ++leaf) {
+            winners[k + leaf] = leaf;
+        }
+        for (size_t node = k - 1; node >= 1; --node) {
+            const size_t lhs = winners[2 * node];
+            const size_t rhs = winners[2 * node + 1];
+            const bool lhs_wins = _beats(lhs, rhs);
+            winners[node] = lhs_wins ? lhs : rhs;
+            _tree[node] = lhs_wins ? rhs : lhs;
+        }
+        _tree[0] = winners[1];
+    }
+
+    void _replay(size_t leaf) {
+        const size_t k = _cursors.size();
+        size_t winner = leaf;
+        for (size_t node = (leaf + k) / 2; node >= 1; node /= 2) {
+            if (_beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+
+    std::vector<Cursor> _cursors;
+    std::vector<bool> _active;
+    /// _tree[0] is the winner, _tree[1, k) are the losers of the internal nodes.
+    std::vector<size_t> _tree;
+    size_t _num_active = 0;
+};
+
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_normalized_keys.h"
+
+#include <pdqsort.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+/// Calls func with the data of the column if it is a ColumnVector of one of the types.
+template <PrimitiveType... Types, typename Func>
+bool visit_integer_column(const IColumn& column, Func&& func) {
+    auto try_visit = [&]<PrimitiveType T>() {
+        const auto* typed_column = check_and_get_column<ColumnVector<T>>(column);
+        if (typed_column == nullptr) {
+            return false;
+        }
+        func(typed_column->get_data());
+        return true;
+    };
+    return (try_visit.template operator()<Types>() || ...);
+}
+
+template <typename Func>
+bool visit_sort_key_column(const IColumn& column, Func&& func) {
+    return visit_integer_column<TYPE_BOOLEAN, TYPE_TINYINT, TYPE_SMALLINT, TYPE_INT, TYPE_BIGINT,
+                                TYPE_DATE, TYPE_DATETIME, TYPE_DATEV2, TYPE_DATETIMEV2,
+                                TYPE_IPV4>(column, std::forward<Func>(func));
+}
+
+template <typename T>
+void encode_column(const PaddedPODArray<T>& data, const NullMap* null_map, bool descending,
+                   bool nulls_last, uint8_t* __restrict keys, size_t key_width) {
+    static_assert(std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t));
+    using UnsignedType = std::make_unsigned_t<T>;
+    const uint8_t null_byte = nulls_last ? 1 : 0;
+    const uint8_t not_null_byte = nulls_last ? 0 : 1;
+    for (size_t row = 0; row < data.size(); ++row) {
+        auto* key = keys + row * key_width;
+        if (null_map != nullptr && (*null_map)[row]) {
+            key[0] = null_byte;
+            memset(key + 1, 0, sizeof(T));
+            continue;
+        }
+        key[0] = not_null_byte;
+        auto value = static_cast<UnsignedType>(data[row]);
+        if constexpr (std::is_signed_v<T>) {
+            value ^= static_cast<UnsignedType>(UnsignedType(1) << (sizeof(T) * 8 - 1));
+        }
+        if (descending) {
+            value = static_cast<UnsignedType>(~value);
+        }
+        unaligned_store<UnsignedType>(key + 1, to_endian<std::endian::big>(value));
+    }
+}
+
+} // namespace
+
+bool NormalizedSortKeys::encode(const ColumnRawPtrs& sort_columns,
+                                const SortDescription& description) {
+    clear();
+    if (sort_columns.empty()) {
+        return false;
+    }
+
+    size_t key_width = 0;
+    for (const auto* column : sort_columns) {
+        const auto* nested_column = column;
+        if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*column)) {
+            nested_column = &nullable_column->get_nested_column();
+        }
+        size_t value_size = 0;
+        if (!visit_sort_key_column(*nested_column,
+                                   [&](const auto& data) { value_size = sizeof(data[0]); })) {
+            return false;
+        }
+        key_width += 1 + value_size;
+    }
+
+    const size_t rows = sort_columns[0]->size();
+    _keys.resize(rows * key_width);
+    size_t offset = 0;
+    for (size_t i = 0; i < sort_columns.size(); ++i) {
+        const auto* nested_column = sort_columns[i];
+        const NullMap* null_map = nullptr;
+        if (const auto* nullable_column = check_and_get_column<ColumnNullable>(*nested_column)) {
+            nested_column = &nullable_column->get_nested_column();
+            null_map = &nullable_column->get_null_map_data();
+        }
+        const bool descending = description[i].direction < 0;
+        // See ColumnNullable::compare_at, a NULL is greater than the other values if
+        // nulls_direction is positive, before the result is multiplied by direction.
+        const bool nulls_last = description[i].direction * description[i].nulls_direction > 0;
+        visit_sort_key_column(*nested_column, [&](const auto& data) {
+            encode_column(data, null_map, descending, nulls_last, _keys.data() + offset,
+                          key_width);
+            offset += 1 + sizeof(data[0]);
+        });
+    }
+    _key_width = key_width;
+    return true;
+}
+
+void NormalizedSortKeys::sort_permutation(IColumn::Permutation& perm, size_t limit) const {
+    auto less = [this](size_t lhs, size_t rhs) {
+        return compare_keys(key_at(lhs), key_at(rhs), _key_width) < 0;
+    };
+    if (limit > 0 && limit < perm.size()) {
+        std::partial_sort(perm.begin(), perm.begin() + limit, perm.end(), less);
+    } else {
+        pdqsort(perm.begin(), perm.end(), less);
+    }
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "vec/columns/column.h"
+#include "vec/common/endian.h"
+#include "vec/common/pod_array.h"
+#include "vec/common/unaligned.h"
+#include "vec/core/sort_description.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+/// The sort keys of all of the rows of a block, each encoded into one binary key so that the
+/// order of the rows is the memcmp order of their keys (a la olap/key_coder.h). Every sort column
+/// takes a null byte, which sorts the NULLs by nulls_direction, and the big-endian value with the
+/// sign bit flipped, all of whose bytes are flipped for a descending column.
+/// Only the integer columns (including the dates stored as integers) of up to 8 bytes are
+/// encoded, so all of the keys have the same width.
+class NormalizedSortKeys {
+public:
+    /// Returns false and keeps the keys empty if any of the columns could not be encoded.
+    bool encode(const ColumnRawPtrs& sort_columns, const SortDescription& description);
+
+    void clear() {
+        _keys.clear();
+        _key_width = 0;
+    }
+
+    bool empty() const { return _key_width == 0; }
+    size_t key_width() const { return _key_width; }
+    const uint8_t* key_at(size_t row) const { return _keys.data() + row * _key_width; }
+
+    /// Whether the keys of this and rhs are encoded by the same layout.
+    bool comparable_with(const NormalizedSortKeys& rhs) const {
+        return !empty() && _key_width == rhs._key_width;
+    }
+
+    int compare_at(size_t row, size_t rhs_row, const NormalizedSortKeys& rhs) const {
+        return compare_keys(key_at(row), rhs.key_at(rhs_row), _key_width);
+    }
+
+    /// The first 8 bytes are compared as one integer, which decides most of the comparisons.
+    static int compare_keys(const uint8_t* lhs, const uint8_t* rhs, size_t key_width) {
+        if (key_width >= sizeof(uint64_t)) {
+            const auto lhs_prefix = to_endian<std::endian::big>(unaligned_load<uint64_t>(lhs));
+            const auto rhs_prefix = to_endian<std::endian::big>(unaligned_load<uint64_t>(rhs));
+            if (lhs_prefix != rhs_prefix) {
+                return lhs_prefix < rhs_prefix ? -1 : 1;
+            }
+            return memcmp(lhs + sizeof(uint64_t), rhs + sizeof(uint64_t),
+                          key_width - sizeof(uint64_t));
+        }
+        return memcmp(lhs, rhs, key_width);
+    }
+
+    /// Sorts the rows by their keys, only the first `limit` rows are sorted if limit is not 0.
+    void sort_permutation(IColumn::Permutation& perm, size_t limit) const;
+
+private:
+    PaddedPODArray<uint8_t> _keys;
+    size_t _key_width = 0;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
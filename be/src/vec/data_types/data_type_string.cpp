@@ -23,9 +23,11 @@
 #include <lz4/lz4.h>
 #include <streamvbyte.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <vector>
 
 #include "agent/be_exec_version_manager.h"
 #include "common/cast_set.h"
@@ -36,6 +38,7 @@
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_string.h"
 #include "vec/common/assert_cast.h"
+#include "vec/common/hash_table/phmap_fwd_decl.h"
 #include "vec/common/string_buffer.hpp"
 #include "vec/common/string_ref.h"
 #include "vec/core/field.h"
@@ -44,6 +47,127 @@
 
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
+
+namespace {
+
+// Since STRING_DICTIONARY_SERDE, the saved rows of a string column begin with a StringEncoding
+// byte. The rows of a dictionary encoded column are laid out as:
+//   uint32 dictionary size | dictionary offsets | size_t dictionary chars length
+//   | dictionary chars | codes
+// The codes are uint8 if the dictionary has at most 256 values, uint16 otherwise.
+enum StringEncoding : uint8_t { PLAIN_STRING = 0, DICTIONARY_STRING = 1 };
+
+// The dictionary is only tried on enough rows, and given up once it holds more values than a
+// quarter of the rows.
+constexpr size_t MIN_DICTIONARY_ROWS = 256;
+constexpr size_t MAX_DICTIONARY_SIZE = 65536;
+
+// Writes the first `rows` rows of the column dictionary encoded and returns the end of them.
+// Returns nullptr without writing anything if the dictionary would not be smaller than the
+// plain offsets and chars.
+char* serialize_dictionary(const ColumnString& column, size_t rows, char* buf) {
+    if (rows < MIN_DICTIONARY_ROWS) {
+        return nullptr;
+    }
+    const size_t max_dictionary_size = std::min(rows / 4, MAX_DICTIONARY_SIZE);
+    phmap::flat_hash_map<StringRef, uint16_t, StringRefHash> value_codes;
+    std::vector<StringRef> values;
+    std::vector<uint16_t> codes(rows);
+    size_t values_bytes = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        const auto value = column.get_data_at(i);
+        auto [it, inserted] = value_codes.try_emplace(value, static_cast<uint16_t>(values.size()));
+        if (inserted) {
+            if (values.size() == max_dictionary_size) {
+                return nullptr;
+            }
+            values.push_back(value);
+            values_bytes += value.size;
+        }
+        codes[i] = it->second;
+    }
+
+    const size_t code_size = values.size() <= 256 ? sizeof(uint8_t) : sizeof(uint16_t);
+    const size_t dictionary_bytes = sizeof(uint32_t) + values.size() * sizeof(IColumn::Offset) +
+                                    sizeof(size_t) + values_bytes + rows * code_size;
+    const size_t plain_bytes =
+            rows * sizeof(IColumn::Offset) + sizeof(size_t) + column.get_offsets()[rows - 1];
+    if (dictionary_bytes >= plain_bytes) {
+        return nullptr;
+    }
+
+    *buf++ = static_cast<char>(DICTIONARY_STRING);
+    unaligned_store<uint32_t>(buf, cast_set<uint32_t>(values.size()));
+    buf += sizeof(uint32_t);
+    size_t offset = 0;
+    for (const auto& value : values) {
+        offset += value.size;
+        unaligned_store<IColumn::Offset>(buf, cast_set<IColumn::Offset>(offset));
+        buf += sizeof(IColumn::Offset);
+    }
+    unaligned_store<size_t>(buf, values_bytes);
+    buf += sizeof(size_t);
+    for (const auto& value : values) {
+        memcpy(buf, value.data, value.size);
+        buf += value.size;
+    }
+    if (code_size == sizeof(uint8_t)) {
+        for (auto code : codes) {
+            *buf++ = static_cast<char>(code);
+        }
+    } else {
+        memcpy(buf, codes.data(), rows * sizeof(uint16_t));
+        buf += rows * sizeof(uint16_t);
+    }
+    return buf;
+}
+
+template <typename Code>
+const char* decode_dictionary(const char* codes, const std::vector<StringRef>& values,
+                              size_t rows, ColumnString* column) {
+    auto& offsets = column->get_offsets();
+    offsets.resize(rows);
+    size_t chars_size = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        chars_size += values[unaligned_load<Code>(codes + i * sizeof(Code))].size;
+        offsets[i] = cast_set<IColumn::Offset>(chars_size);
+    }
+    auto& chars = column->get_chars();
+    chars.resize(chars_size);
+    for (size_t i = 0; i < rows; ++i) {
+        const auto& value = values[unaligned_load<Code>(codes + i * sizeof(Code))];
+        memcpy(chars.data() + offsets[i] - value.size, value.data, value.size);
+    }
+    return codes + rows * sizeof(Code);
+}
+
+// Reads the `rows` dictionary encoded rows following the encoding byte into the column.
+const char* deserialize_dictionary(const char* buf, size_t rows, ColumnString* column) {
+    const auto dictionary_size = unaligned_load<uint32_t>(buf);
+    buf += sizeof(uint32_t);
+    const char* dictionary_offsets = buf;
+    buf += dictionary_size * sizeof(IColumn::Offset);
+    const auto dictionary_chars_size = unaligned_load<size_t>(buf);
+    buf += sizeof(size_t);
+    const char* dictionary_chars = buf;
+    buf += dictionary_chars_size;
+
+    std::vector<StringRef> values(dictionary_size);
+    IColumn::Offset begin = 0;
+    for (uint32_t i = 0; i < dictionary_size; ++i) {
+        const auto end = unaligned_load<IColumn::Offset>(dictionary_offsets +
+                                                         i * sizeof(IColumn::Offset));
+        values[i] = StringRef(dictionary_chars + begin, end - begin);
+        begin = end;
+    }
+    if (dictionary_size <= 256) {
+        return decode_dictionary<uint8_t>(buf, values, rows, column);
+    }
+    return decode_dictionary<uint16_t>(buf, values, rows, column);
+}
+
+} // namespace
+
 std::string DataTypeString::to_string(const IColumn& column, size_t row_num) const {
     auto result = check_column_const_set_readability(column, row_num);
     ColumnPtr ptr = result.first;
@@ -91,10 +215,15 @@ bool DataTypeString::equals(const IDataType& rhs) const {
 // binary: const flag | row num | read saved num | offset | chars
 // offset: {offset1 | offset2 ...} or {encode_size | offset1 |offset2 ...}
 // chars : {value_length | <value1> | <value2 ...} or {value_length | encode_size | <value1> | <value2 ...}
+// since STRING_DICTIONARY_SERDE, an encoding byte follows the read saved num, see StringEncoding
 int64_t DataTypeString::get_uncompressed_serialized_bytes(const IColumn& column,
                                                           int be_exec_version) const {
     if (be_exec_version >= USE_CONST_SERDE) {
         int64_t size = sizeof(bool) + sizeof(size_t) + sizeof(size_t);
+        if (be_exec_version >= STRING_DICTIONARY_SERDE) {
+            // the encoding, the dictionary is only chosen when it is smaller than the plain rows
+            size += sizeof(uint8_t);
+        }
         bool is_const_column = is_column_const(column);
         const IColumn* string_column = &column;
         if (is_const_column) {
@@ -157,10 +286,16 @@ char* DataTypeString::serialize(const IColumn& column, char* buf, int be_exec_ve
         const auto* data_column = &column;
         size_t real_need_copy_num = 0;
         buf = serialize_const_flag_and_row_num(&data_column, buf, &real_need_copy_num);
+        const auto& string_column = assert_cast<const ColumnString&>(*data_column);
+        if (be_exec_version >= STRING_DICTIONARY_SERDE) {
+            if (char* end = serialize_dictionary(string_column, real_need_copy_num, buf)) {
+                return end;
+            }
+            *buf++ = static_cast<char>(PLAIN_STRING);
+        }
 
         // mem_size = real_row_num * sizeof(IColumn::Offset)
         size_t mem_size = real_need_copy_num * sizeof(IColumn::Offset);
-        const auto& string_column = assert_cast<const ColumnString&>(*data_column);
         // offsets
         if (mem_size <= SERIALIZED_MEM_SIZE_LIMIT) {
             memcpy(buf, string_column.get_offsets().data(), mem_size);
@@ -234,9 +369,14 @@ const char* DataTypeString::deserialize(const char* buf, MutableColumnPtr* colum
         auto* origin_column = column->get();
         size_t real_have_saved_num = 0;
         buf = deserialize_const_flag_and_row_num(buf, column, &real_have_saved_num);
+        auto* column_string = assert_cast<ColumnString*>(origin_column);
+        if (be_exec_version >= STRING_DICTIONARY_SERDE) {
+            if (*buf++ == DICTIONARY_STRING) {
+                return deserialize_dictionary(buf, real_have_saved_num, column_string);
+            }
+        }
 
         auto mem_size = real_have_saved_num * sizeof(IColumn::Offset);
-        auto* column_string = assert_cast<ColumnString*>(origin_column);
         ColumnString::Chars& data = column_string->get_chars();
         ColumnString::Offsets& offsets = column_string->get_offsets();
         offsets.resize(real_have_saved_num);
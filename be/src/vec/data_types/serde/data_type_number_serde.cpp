@@ -24,6 +24,7 @@
 #include "util/jsonb_document.h"
 #include "util/jsonb_writer.h"
 #include "util/mysql_global.h"
+#include "util/string_parser.hpp"
 #include "util/to_string.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/core/types.h"
@@ -147,7 +148,8 @@ Status DataTypeNumberSerDe<T>::deserialize_one_cell_from_json(IColumn& column, S
         column_data.insert_value(val);
     } else if constexpr (is_int_or_bool(T)) {
         typename PrimitiveTypeTraits<T>::ColumnItemType val = 0;
-        if (!try_read_int_text(val, str_ref)) {
+        if (!StringParser::try_parse_plain_int(str_ref.data, str_ref.size, &val) &&
+            !try_read_int_text(val, str_ref)) {
             return Status::InvalidArgument("parse number fail, string: '{}'", slice.to_string());
         }
         column_data.insert_value(val);
@@ -613,7 +615,8 @@ bool try_parse_impl(typename PrimitiveTypeTraits<PT>::ColumnItemType& x, const S
     } else if constexpr (PT == TYPE_BOOLEAN) {
         return CastToBool::from_string(str_ref, x, params);
     } else if constexpr (is_int(PT)) {
-        return CastToInt::from_string(str_ref, x, params);
+        return StringParser::try_parse_plain_int(str_ref.data, str_ref.size, &x) ||
+               CastToInt::from_string(str_ref, x, params);
     } else {
         throw doris::Exception(ErrorCode::NOT_IMPLEMENTED_ERROR,
                                "try_parse_impl not implemented for type: {}", type_to_string(PT));
@@ -22,11 +22,13 @@
 #include <numeric>
 #include <unordered_set>
 
+#include "vec/exec/executor/time_sharing/time_sharing_task_handle.h"
+
 namespace doris {
 namespace vectorized {
 
 MultilevelSplitQueue::MultilevelSplitQueue(double level_time_multiplier)
-        : _level_time_multiplier(level_time_multiplier), _level_waiting_splits() {
+        : _level_time_multiplier(level_time_multiplier) {
     for (size_t i = 0; i < LEVEL_THRESHOLD_SECONDS.size(); ++i) {
         _level_scheduled_time[i].store(0);
         _level_min_priority[i].store(-1);
@@ -103,14 +105,26 @@ void MultilevelSplitQueue::offer(std::shared_ptr<PrioritizedSplitRunner> split)
 }
 
 void MultilevelSplitQueue::_do_offer(std::shared_ptr<PrioritizedSplitRunner> split, int level) {
-    if (_level_waiting_splits[level].empty()) {
+    if (_level_waiting_size[level] == 0) {
         int64_t level0_time = _get_level0_target_time();
         int64_t level_expected_time =
                 static_cast<int64_t>(level0_time / std::pow(_level_time_multiplier, level));
         int64_t delta = level_expected_time - _level_scheduled_time[level].load();
         _level_scheduled_time[level].fetch_add(delta);
     }
-    _level_waiting_splits[level].push(split);
+    GroupQueue* group = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_group_mutex);
+        group = &_group_waiting_splits[split->task_handle()->workload_group_id()];
+        if (group->size == 0) {
+            // A group which has been idle must not accumulate credit and starve other groups
+            // when it comes back, so it starts from the minimal vruntime of the active groups.
+            group->vruntime = std::max(group->vruntime, _min_active_vruntime());
+        }
+    }
+    group->level_waiting_splits[level].push(split);
+    group->size++;
+    _level_waiting_size[level]++;
 }
 
 std::shared_ptr<PrioritizedSplitRunner> MultilevelSplitQueue::take() {
@@ -127,21 +141,67 @@ std::shared_ptr<PrioritizedSplitRunner> MultilevelSplitQueue::take() {
     return nullptr;
 }
 
+void MultilevelSplitQueue::add_group_scheduled_nanos(uint64_t group_id, uint64_t group_weight,
+                                                     int64_t quanta_nanos) {
+    std::lock_guard<std::mutex> lock(_group_mutex);
+    auto it = _group_waiting_splits.find(group_id);
+    if (it == _group_waiting_splits.end()) {
+        return;
+    }
+    it->second.vruntime += static_cast<double>(std::min(quanta_nanos, LEVEL_CONTRIBUTION_CAP)) /
+                           static_cast<double>(std::max<uint64_t>(group_weight, 1));
+}
+
+double MultilevelSplitQueue::group_vruntime(uint64_t group_id) const {
+    std::lock_guard<std::mutex> lock(_group_mutex);
+    auto it = _group_waiting_splits.find(group_id);
+    return it == _group_waiting_splits.end() ? -1 : it->second.vruntime;
+}
+
+double MultilevelSplitQueue::_min_active_vruntime() const {
+    double min_vruntime = 0;
+    bool found = false;
+    for (const auto& [_, group] : _group_waiting_splits) {
+        if (group.size > 0 && (!found || group.vruntime < min_vruntime)) {
+            min_vruntime = group.vruntime;
+            found = true;
+        }
+    }
+    return min_vruntime;
+}
+
+MultilevelSplitQueue::GroupQueue* MultilevelSplitQueue::_select_group() {
+    std::lock_guard<std::mutex> lock(_group_mutex);
+    GroupQueue* selected = nullptr;
+    for (auto& [_, group] : _group_waiting_splits) {
+        if (group.size > 0 && (selected == nullptr || group.vruntime < selected->vruntime)) {
+            selected = &group;
+        }
+    }
+    return selected;
+}
+
 /**
  * Attempts to give each level a target amount of scheduled time, which is configurable
  * using levelTimeMultiplier.
  * <p>
- * This function selects the level that has the lowest ratio of actual to the target time
+ * This function first selects the workload group with the lowest weighted virtual time, then
+ * selects the level of this group that has the lowest ratio of actual to the target time
  * with the objective of minimizing deviation from the target scheduled time. From this level,
  * we pick the split with the lowest priority.
  */
 std::shared_ptr<PrioritizedSplitRunner> MultilevelSplitQueue::_poll_split() {
+    auto* group = _select_group();
+    if (group == nullptr) {
+        return nullptr;
+    }
+
     int64_t target_scheduled_time = _get_level0_target_time();
     double worst_ratio = 1.0;
     int selected_level = -1;
 
     for (int level = 0; level < LEVEL_THRESHOLD_SECONDS.size(); ++level) {
-        if (!_level_waiting_splits[level].empty()) {
+        if (!group->level_waiting_splits[level].empty()) {
             int64_t level_time = _level_scheduled_time[level].load();
             double ratio = (level_time == 0) ? 0
                                              : static_cast<double>(target_scheduled_time) /
@@ -158,52 +218,47 @@ std::shared_ptr<PrioritizedSplitRunner> MultilevelSplitQueue::_poll_split() {
 
     if (selected_level == -1) return nullptr;
 
-    auto result = _level_waiting_splits[selected_level].top();
-    _level_waiting_splits[selected_level].pop();
+    auto result = group->level_waiting_splits[selected_level].top();
+    group->level_waiting_splits[selected_level].pop();
+    group->size--;
+    _level_waiting_size[selected_level]--;
     return result;
 }
 
-void MultilevelSplitQueue::remove(std::shared_ptr<PrioritizedSplitRunner> split) {
-    for (auto& level_queue : _level_waiting_splits) {
-        std::priority_queue<std::shared_ptr<PrioritizedSplitRunner>,
-                            std::vector<std::shared_ptr<PrioritizedSplitRunner>>,
-                            SplitRunnerComparator>
-                new_queue;
-        while (!level_queue.empty()) {
-            auto current = level_queue.top();
-            level_queue.pop();
-            if (current != split) {
-                new_queue.emplace(std::move(current));
+template <typename Pred>
+void MultilevelSplitQueue::_remove_if(Pred&& pred) {
+    for (auto& [_, group] : _group_waiting_splits) {
+        for (int level = 0; level < LEVEL_THRESHOLD_SECONDS.size(); ++level) {
+            auto& level_queue = group.level_waiting_splits[level];
+            LevelQueue new_queue;
+            while (!level_queue.empty()) {
+                auto current = level_queue.top();
+                level_queue.pop();
+                if (!pred(current)) {
+                    new_queue.emplace(std::move(current));
+                } else {
+                    group.size--;
+                    _level_waiting_size[level]--;
+                }
             }
+            level_queue.swap(new_queue);
         }
-        level_queue.swap(new_queue);
     }
 }
 
+void MultilevelSplitQueue::remove(std::shared_ptr<PrioritizedSplitRunner> split) {
+    _remove_if([&](const auto& current) { return current == split; });
+}
+
 void MultilevelSplitQueue::remove_all(
         const std::vector<std::shared_ptr<PrioritizedSplitRunner>>& splits) {
     std::unordered_set<std::shared_ptr<PrioritizedSplitRunner>> to_remove(splits.begin(),
                                                                           splits.end());
-
-    for (auto& level_queue : _level_waiting_splits) {
-        std::priority_queue<std::shared_ptr<PrioritizedSplitRunner>,
-                            std::vector<std::shared_ptr<PrioritizedSplitRunner>>,
-                            SplitRunnerComparator>
-                new_queue;
-        while (!level_queue.empty()) {
-            auto current = level_queue.top();
-            level_queue.pop();
-            if (!to_remove.count(current)) {
-                new_queue.emplace(std::move(current));
-            }
-        }
-        level_queue.swap(new_queue);
-    }
+    _remove_if([&](const auto& current) { return to_remove.contains(current); });
 }
 
 size_t MultilevelSplitQueue::size() const {
-    return std::accumulate(_level_waiting_splits.begin(), _level_waiting_splits.end(), size_t(0),
-                           [](size_t sum, const auto& queue) { return sum + queue.size(); });
+    return std::accumulate(_level_waiting_size.begin(), _level_waiting_size.end(), size_t(0));
 }
 
 int64_t MultilevelSplitQueue::_get_level0_target_time() {
@@ -220,11 +275,15 @@ int64_t MultilevelSplitQueue::_get_level0_target_time() {
 }
 
 void MultilevelSplitQueue::clear() {
-    for (auto& queue : _level_waiting_splits) {
-        while (!queue.empty()) {
-            queue.pop();
+    for (auto& [_, group] : _group_waiting_splits) {
+        for (auto& queue : group.level_waiting_splits) {
+            while (!queue.empty()) {
+                queue.pop();
+            }
         }
+        group.size = 0;
     }
+    _level_waiting_size.fill(0);
 }
 
 } // namespace vectorized
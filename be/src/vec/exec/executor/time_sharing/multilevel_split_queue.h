@@ -17,7 +17,9 @@
 
 #pragma once
 #include <array>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 
 #include "common/factory_creator.h"
@@ -54,6 +56,9 @@ struct SplitRunnerComparator {
  *  - Supports multiple priority levels, each with its own priority queue.
  *  - Dynamically adjusts split priority based on execution time and configurable thresholds.
  *  - Integrates with the time-sharing task executor for fine-grained scheduling.
+ *  - Keeps the splits of every workload group in separate sub queues. The group with the
+ *    lowest weighted virtual time (scheduled time / weight) is served first, so the split
+ *    time of groups sharing one executor follows their cpu share.
  *
  */
 
@@ -77,21 +82,41 @@ public:
     void remove(std::shared_ptr<PrioritizedSplitRunner> split) override;
     void remove_all(const std::vector<std::shared_ptr<PrioritizedSplitRunner>>& splits) override;
     void clear() override;
+    void add_group_scheduled_nanos(uint64_t group_id, uint64_t group_weight,
+                                   int64_t quanta_nanos) override;
 
     int64_t level_scheduled_time(int level) const { return _level_scheduled_time[level].load(); }
 
+    // Weighted virtual time of the group, -1 if the group never offered any split.
+    double group_vruntime(uint64_t group_id) const;
+
 private:
+    using LevelQueue = std::priority_queue<std::shared_ptr<PrioritizedSplitRunner>,
+                                           std::vector<std::shared_ptr<PrioritizedSplitRunner>>,
+                                           SplitRunnerComparator>;
+
+    struct GroupQueue {
+        std::array<LevelQueue, LEVEL_THRESHOLD_SECONDS.size()> level_waiting_splits;
+        size_t size = 0;
+        // scheduled nanos / weight
+        double vruntime = 0;
+    };
+
     int64_t _get_level0_target_time();
     std::shared_ptr<PrioritizedSplitRunner> _poll_split();
     void _do_offer(std::shared_ptr<PrioritizedSplitRunner> split, int level);
+    GroupQueue* _select_group();
+    double _min_active_vruntime() const;
+    template <typename Pred>
+    void _remove_if(Pred&& pred);
 
     const double _level_time_multiplier;
 
-    std::array<std::priority_queue<std::shared_ptr<PrioritizedSplitRunner>,
-                                   std::vector<std::shared_ptr<PrioritizedSplitRunner>>,
-                                   SplitRunnerComparator>,
-               LEVEL_THRESHOLD_SECONDS.size()>
-            _level_waiting_splits;
+    // workload group id -> waiting splits of the group
+    std::map<uint64_t, GroupQueue> _group_waiting_splits;
+    // protects `vruntime` of groups, which is charged out of the executor lock
+    mutable std::mutex _group_mutex;
+    std::array<size_t, LEVEL_THRESHOLD_SECONDS.size()> _level_waiting_size {};
 
     std::array<std::atomic<int64_t>, LEVEL_THRESHOLD_SECONDS.size()> _level_scheduled_time;
     std::array<std::atomic<int64_t>, LEVEL_THRESHOLD_SECONDS.size()> _level_min_priority;
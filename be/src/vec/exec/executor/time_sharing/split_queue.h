@@ -42,6 +42,10 @@ public:
                                      int64_t scheduled_nanos) = 0;
 
     virtual int64_t get_level_min_priority(int level, int64_t scheduled_nanos) = 0;
+
+    // Charge the scheduled time of a split to the workload group it belongs to.
+    virtual void add_group_scheduled_nanos(uint64_t group_id, uint64_t group_weight,
+                                           int64_t quanta_nanos) {}
 };
 
 } // namespace vectorized
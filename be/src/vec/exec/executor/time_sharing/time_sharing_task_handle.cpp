@@ -43,11 +43,33 @@ Priority TimeSharingTaskHandle::add_scheduled_nanos(int64_t duration_nanos) {
 
     Priority new_priority =
             _split_queue->update_priority(_priority, duration_nanos, _scheduled_nanos);
+    _split_queue->add_group_scheduled_nanos(_workload_group_id, workload_group_weight(),
+                                            duration_nanos);
+    if (_scheduled_nanos_listener) {
+        _scheduled_nanos_listener(duration_nanos);
+    }
 
     _priority = new_priority;
     return new_priority;
 }
 
+void TimeSharingTaskHandle::set_workload_group(
+        uint64_t group_id, std::function<uint64_t()> weight_supplier,
+        std::function<void(int64_t)> scheduled_nanos_listener) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _workload_group_id = group_id;
+    _workload_group_weight_supplier = std::move(weight_supplier);
+    _scheduled_nanos_listener = std::move(scheduled_nanos_listener);
+}
+
+uint64_t TimeSharingTaskHandle::workload_group_weight() const {
+    if (!_workload_group_weight_supplier) {
+        return DEFAULT_WORKLOAD_GROUP_WEIGHT;
+    }
+    uint64_t weight = _workload_group_weight_supplier();
+    return weight == 0 ? DEFAULT_WORKLOAD_GROUP_WEIGHT : weight;
+}
+
 Priority TimeSharingTaskHandle::reset_level_priority() {
     std::lock_guard<std::mutex> lock(_mutex);
 
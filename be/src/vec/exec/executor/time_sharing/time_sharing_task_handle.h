@@ -18,6 +18,7 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -65,6 +66,16 @@ public:
     std::shared_ptr<PrioritizedSplitRunner> get_split(std::shared_ptr<SplitRunner> split,
                                                       bool intermediate) const;
 
+    // Charge the splits of this task to a workload group. `weight_supplier` returns the current
+    // cpu share of the group, and `scheduled_nanos_listener` is notified of every scheduled
+    // quanta. Must be called before any split is enqueued.
+    void set_workload_group(uint64_t group_id, std::function<uint64_t()> weight_supplier,
+                            std::function<void(int64_t)> scheduled_nanos_listener);
+    uint64_t workload_group_id() const { return _workload_group_id; }
+    uint64_t workload_group_weight() const;
+
+    static constexpr uint64_t DEFAULT_WORKLOAD_GROUP_WEIGHT = 1024;
+
 private:
     mutable std::mutex _mutex;
     std::atomic<bool> _closed {false};
@@ -85,6 +96,10 @@ private:
     std::atomic<int> _next_split_id {0};
     //    std::atomic<Priority> _priority {Priority(0, 0)};
     Priority _priority {0, 0};
+
+    uint64_t _workload_group_id {0};
+    std::function<uint64_t()> _workload_group_weight_supplier;
+    std::function<void(int64_t)> _scheduled_nanos_listener;
 };
 
 } // namespace vectorized
@@ -42,6 +42,7 @@
 #include "io/fs/tracing_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/core/block.h"
@@ -85,8 +86,22 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
                                                          std::vector<Slice>* splitted_values) {
     const char* data = line.data;
     const size_t size = line.size;
+    const auto sep = static_cast<uint8_t>(_value_sep[0]);
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
+    size_t i = 0;
+    // Compares a vector of bytes with the separator at a time, most of the bytes are not.
+    constexpr size_t step = simd::bits_mask_length();
+    for (; i + step <= size; i += step) {
+        simd::iterate_through_bits_mask(
+                [&](auto bit_pos) {
+                    const size_t pos = i + bit_pos;
+                    process_value_func(data, value_start, pos - value_start, _trimming_char,
+                                       splitted_values);
+                    value_start = pos + _value_sep_len;
+                },
+                simd::bytes_equal_to_bits_mask(reinterpret_cast<const uint8_t*>(data + i), sep));
+    }
+    for (; i < size; ++i) {
         if (data[i] == _value_sep[0]) {
             process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
             value_start = i + _value_sep_len;
@@ -1228,22 +1228,19 @@ Status NewJsonReader::_read_one_message_from_pipe(std::unique_ptr<uint8_t[]>* fi
         return Status::OK();
     }
 
-    std::vector<uint8_t> buf;
+    // second read: continuously read data from the pipe until all data is read, the chunks are
+    // kept as they are and copied only once into the whole message.
+    std::vector<std::pair<std::unique_ptr<uint8_t[]>, size_t>> chunks;
     uint64_t cur_size = 0;
-
-    // second read: continuously read data from the pipe until all data is read.
-    std::unique_ptr<uint8_t[]> read_buf;
-    size_t read_buf_size = 0;
     while (true) {
+        std::unique_ptr<uint8_t[]> read_buf;
+        size_t read_buf_size = 0;
         RETURN_IF_ERROR(stream_load_pipe->read_one_message(&read_buf, &read_buf_size));
         if (read_buf_size == 0) {
             break;
-        } else {
-            buf.insert(buf.end(), read_buf.get(), read_buf.get() + read_buf_size);
-            cur_size += read_buf_size;
-            read_buf_size = 0;
-            read_buf.reset();
         }
+        cur_size += read_buf_size;
+        chunks.emplace_back(std::move(read_buf), read_buf_size);
     }
 
     // No data is available during the second read.
@@ -1257,7 +1254,12 @@ Status NewJsonReader::_read_one_message_from_pipe(std::unique_ptr<uint8_t[]>* fi
     memcpy(total_buf.get(), file_buf->get(), *read_size);
 
     // copy the data during the second read
-    memcpy(total_buf.get() + *read_size, buf.data(), cur_size);
+    uint8_t* pos = total_buf.get() + *read_size;
+    for (auto& [chunk, chunk_size] : chunks) {
+        memcpy(pos, chunk.get(), chunk_size);
+        pos += chunk_size;
+        chunk.reset();
+    }
     *file_buf = std::move(total_buf);
     *read_size += cur_size;
     return Status::OK();
@@ -1293,6 +1295,7 @@ Status NewJsonReader::_simdjson_init_reader() {
             skip_bitmap_col_idx = i;
         }
     }
+    _num_loaded_keys = _slot_desc_index.size() - (_should_process_skip_bitmap_col() ? 1 : 0);
     _simdjson_ondemand_padding_buffer.resize(_padded_size);
     _simdjson_ondemand_unscape_padding_buffer.resize(_padded_size);
     return Status::OK();
@@ -1592,14 +1595,17 @@ Status NewJsonReader::_simdjson_handle_nested_complex_json(
 size_t NewJsonReader::_column_index(const StringRef& name, size_t key_index) {
     /// Optimization by caching the order of fields (which is almost always the same)
     /// and a quick check to match the next expected field, instead of searching the hash table.
-    if (_prev_positions.size() > key_index && name == _prev_positions[key_index]->first) {
+    if (_prev_positions.size() > key_index &&
+        _prev_positions[key_index] != _slot_desc_index.end() &&
+        name == _prev_positions[key_index]->first) {
         return _prev_positions[key_index]->second;
     }
     auto it = _slot_desc_index.find(name);
     if (it != _slot_desc_index.end()) {
-        if (key_index < _prev_positions.size()) {
-            _prev_positions[key_index] = it;
+        if (key_index >= _prev_positions.size()) {
+            _prev_positions.resize(key_index + 1, _slot_desc_index.end());
         }
+        _prev_positions[key_index] = it;
         return it->second;
     }
     return size_t(-1);
@@ -1614,6 +1620,7 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
     bool has_valid_value = false;
     // iterate through object, simdjson::ondemond will parsing on the fly
     size_t key_index = 0;
+    size_t num_seen_keys = 0;
     for (auto field : *value) {
         std::string_view key = field.unescaped_key();
         StringRef name_ref(key.data(), key.size());
@@ -1650,6 +1657,11 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         }
         _seen_columns[column_index] = true;
         has_valid_value = true;
+        // The first value of a key is loaded, so the rest of the object is skipped without
+        // matching its keys once all the columns are seen. Hive tables load the last value.
+        if (!_is_hive_table && ++num_seen_keys == _num_loaded_keys) {
+            break;
+        }
     }
 
     if (!has_valid_value && _is_load) {
@@ -270,6 +270,8 @@ private:
     std::vector<NameMap::iterator> _prev_positions;
     /// Set of columns which already met in row. Exception is thrown if there are more than one column with the same name.
     std::vector<UInt8> _seen_columns;
+    /// Number of the keys in _slot_desc_index which are loaded from the json object.
+    size_t _num_loaded_keys = 0;
     // simdjson
     std::unique_ptr<uint8_t[]> _json_str_ptr;
     const uint8_t* _json_str = nullptr;
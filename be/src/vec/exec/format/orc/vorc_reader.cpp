@@ -31,6 +31,7 @@
 #include <chrono> // IWYU pragma: keep
 #include <exception>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -44,6 +45,7 @@
 #include "exprs/create_predicate_function.h"
 #include "exprs/hybrid_set.h"
 #include "io/fs/buffered_reader.h"
+#include "io/fs/file_meta_cache.h"
 #include "io/fs/file_reader.h"
 #include "olap/id_manager.h"
 #include "olap/utils.h"
@@ -168,7 +170,7 @@ void StripeStreamInputStream::read(void* buf, uint64_t length, uint64_t offset)
 OrcReader::OrcReader(RuntimeProfile* profile, RuntimeState* state,
                      const TFileScanRangeParams& params, const TFileRangeDesc& range,
                      size_t batch_size, const std::string& ctz, io::IOContext* io_ctx,
-                     bool enable_lazy_mat)
+                     bool enable_lazy_mat, FileMetaCache* meta_cache)
         : _profile(profile),
           _state(state),
           _scan_params(params),
@@ -178,6 +180,7 @@ OrcReader::OrcReader(RuntimeProfile* profile, RuntimeState* state,
           _range_size(range.size),
           _ctz(ctz),
           _io_ctx(io_ctx),
+          _meta_cache(meta_cache),
           _enable_lazy_mat(enable_lazy_mat),
           _enable_filter_by_min_max(
                   state == nullptr ? true : state->query_options().enable_orc_filter_by_min_max),
@@ -291,8 +294,22 @@ Status OrcReader::_create_file_reader() {
         orc::ReaderOptions options;
         options.setMemoryPool(*ExecEnv::GetInstance()->orc_memory_pool());
         options.setReaderMetrics(&_reader_metrics);
+        // the cached file tail saves reading the postscript, footer and metadata of the file
+        ObjLRUCache::CacheHandle file_tail_handle;
+        bool hit_file_tail =
+                _meta_cache != nullptr &&
+                _meta_cache->lookup_orc_file_tail(_scan_range.path, _file_description.mtime,
+                                                  &file_tail_handle);
+        if (hit_file_tail) {
+            options.setSerializedFileTail(*static_cast<const std::string*>(
+                    file_tail_handle.data<std::string>()));
+        }
         _reader = orc::createReader(
                 std::unique_ptr<ORCFileInputStream>(_file_input_stream.release()), options);
+        if (_meta_cache != nullptr && !hit_file_tail) {
+            _meta_cache->insert_orc_file_tail(_scan_range.path, _file_description.mtime,
+                                              _reader->getSerializedFileTail(), &file_tail_handle);
+        }
     } catch (std::exception& e) {
         // invoker maybe just skip Status.NotFound and continue
         // so we need distinguish between it and other kinds of errors
@@ -1411,6 +1428,29 @@ Status OrcReader::_decode_string_column(const std::string& col_name,
     }
 }
 
+bool OrcReader::_insert_contiguous_strings(const MutableColumnPtr& data_column,
+                                           const orc::EncodedStringVectorBatch* cvb,
+                                           size_t num_values) {
+    // The direct encoded strings are read into one blob, they are contiguous unless there are
+    // nulls.
+    const char* begin = cvb->data[0];
+    _string_offsets.resize(num_values + 1);
+    _string_offsets[0] = 0;
+    size_t offset = 0;
+    for (int i = 0; i < num_values; ++i) {
+        if (cvb->data[i] != begin + offset) {
+            return false;
+        }
+        offset += cvb->length[i];
+        if (offset > std::numeric_limits<uint32_t>::max()) {
+            return false;
+        }
+        _string_offsets[i + 1] = static_cast<uint32_t>(offset);
+    }
+    data_column->insert_many_continuous_binary_data(begin, _string_offsets.data(), num_values);
+    return true;
+}
+
 template <bool is_filter>
 Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_name,
                                                          const MutableColumnPtr& data_column,
@@ -1418,13 +1458,31 @@ Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_
                                                          const orc::EncodedStringVectorBatch* cvb,
                                                          size_t num_values) {
     const static std::string empty_string;
-    std::vector<StringRef> string_values;
+    if constexpr (!is_filter) {
+        if (type_kind != orc::TypeKind::CHAR && !cvb->hasNulls && num_values > 0 &&
+            _insert_contiguous_strings(data_column, cvb, num_values)) {
+            return Status::OK();
+        }
+    }
+    UInt8* __restrict filter_data;
+    if constexpr (is_filter) {
+        filter_data = _filter->data();
+    }
+    // The filtered rows are not copied, they are removed by the filter later.
+    std::vector<StringRef>& string_values = _string_values;
+    string_values.clear();
     string_values.reserve(num_values);
     if (type_kind == orc::TypeKind::CHAR) {
         // Possibly there are some zero padding characters in CHAR type, we have to strip them off.
         if (cvb->hasNulls) {
             for (int i = 0; i < num_values; ++i) {
                 if (cvb->notNull[i]) {
+                    if constexpr (is_filter) {
+                        if (!filter_data[i]) {
+                            string_values.emplace_back(empty_string.data(), 0);
+                            continue;
+                        }
+                    }
                     size_t length = trim_right(cvb->data[i], cvb->length[i]);
                     string_values.emplace_back((length > 0) ? cvb->data[i] : empty_string.data(),
                                                length);
@@ -1437,6 +1495,12 @@ Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_
             }
         } else {
             for (int i = 0; i < num_values; ++i) {
+                if constexpr (is_filter) {
+                    if (!filter_data[i]) {
+                        string_values.emplace_back(empty_string.data(), 0);
+                        continue;
+                    }
+                }
                 size_t length = trim_right(cvb->data[i], cvb->length[i]);
                 string_values.emplace_back((length > 0) ? cvb->data[i] : empty_string.data(),
                                            length);
@@ -1446,6 +1510,12 @@ Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_
         if (cvb->hasNulls) {
             for (int i = 0; i < num_values; ++i) {
                 if (cvb->notNull[i]) {
+                    if constexpr (is_filter) {
+                        if (!filter_data[i]) {
+                            string_values.emplace_back(empty_string.data(), 0);
+                            continue;
+                        }
+                    }
                     string_values.emplace_back(
                             (cvb->length[i] > 0) ? cvb->data[i] : empty_string.data(),
                             cvb->length[i]);
@@ -1455,6 +1525,12 @@ Status OrcReader::_decode_string_non_dict_encoded_column(const std::string& col_
             }
         } else {
             for (int i = 0; i < num_values; ++i) {
+                if constexpr (is_filter) {
+                    if (!filter_data[i]) {
+                        string_values.emplace_back(empty_string.data(), 0);
+                        continue;
+                    }
+                }
                 string_values.emplace_back(
                         (cvb->length[i] > 0) ? cvb->data[i] : empty_string.data(), cvb->length[i]);
             }
@@ -1472,8 +1548,9 @@ Status OrcReader::_decode_string_dict_encoded_column(const std::string& col_name
                                                      const orc::TypeKind& type_kind,
                                                      const orc::EncodedStringVectorBatch* cvb,
                                                      size_t num_values) {
-    std::vector<StringRef> string_values;
+    std::vector<StringRef>& string_values = _string_values;
     size_t max_value_length = 0;
+    string_values.clear();
     string_values.reserve(num_values);
     UInt8* __restrict filter_data;
     if constexpr (is_filter) {
@@ -59,6 +59,7 @@
 #include "vec/exprs/vslot_ref.h"
 
 namespace doris {
+class FileMetaCache;
 class RuntimeState;
 class TFileRangeDesc;
 class TFileScanRangeParams;
@@ -139,7 +140,8 @@ public:
 
     OrcReader(RuntimeProfile* profile, RuntimeState* state, const TFileScanRangeParams& params,
               const TFileRangeDesc& range, size_t batch_size, const std::string& ctz,
-              io::IOContext* io_ctx, bool enable_lazy_mat = true);
+              io::IOContext* io_ctx, bool enable_lazy_mat = true,
+              FileMetaCache* meta_cache = nullptr);
 
     OrcReader(const TFileScanRangeParams& params, const TFileRangeDesc& range,
               const std::string& ctz, io::IOContext* io_ctx, bool enable_lazy_mat = true);
@@ -188,7 +190,7 @@ public:
     Status get_parsed_schema(std::vector<std::string>* col_names,
                              std::vector<DataTypePtr>* col_types) override;
 
-    void set_position_delete_rowids(std::vector<int64_t>* delete_rows) {
+    void set_position_delete_rowids(const std::vector<int64_t>* delete_rows) {
         _position_delete_ordered_rowids = delete_rows;
     }
     void _execute_filter_position_delete_rowids(IColumn::Filter& filter);
@@ -450,6 +452,11 @@ private:
                 auto& v = reinterpret_cast<DecimalType&>(column_data[origin_size + i]);
                 v = (DecimalType)value;
             }
+        } else if constexpr (DecimalPrimitiveType == TYPE_DECIMAL64 &&
+                             std::is_same_v<OrcColumnType, orc::Decimal64VectorBatch>) {
+            // the values are in the layout of the column
+            static_assert(sizeof(DecimalType) == sizeof(cvb_data[0]));
+            memcpy(column_data.data() + origin_size, cvb_data, num_values * sizeof(DecimalType));
         } else {
             for (int i = 0; i < num_values; ++i) {
                 int128_t value;
@@ -553,6 +560,11 @@ private:
                                                   const orc::EncodedStringVectorBatch* cvb,
                                                   size_t num_values);
 
+    // Appends the strings of a batch without nulls with one copy, returns false if the strings
+    // are not contiguous in the batch.
+    bool _insert_contiguous_strings(const MutableColumnPtr& data_column,
+                                    const orc::EncodedStringVectorBatch* cvb, size_t num_values);
+
     template <bool is_filter>
     Status _decode_string_dict_encoded_column(const std::string& col_name,
                                               const MutableColumnPtr& data_column,
@@ -665,12 +677,18 @@ private:
     std::shared_ptr<io::FileSystem> _file_system;
 
     io::IOContext* _io_ctx = nullptr;
+    // if not null, the file tail is got from and put into the cache.
+    FileMetaCache* _meta_cache = nullptr;
     bool _enable_lazy_mat = true;
     bool _enable_filter_by_min_max = true;
 
     std::vector<DecimalScaleParams> _decimal_scale_params;
     size_t _decimal_scale_params_index;
 
+    // the buffers to decode string columns, reused by the batches
+    std::vector<StringRef> _string_values;
+    std::vector<uint32_t> _string_offsets;
+
     const std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
     bool _is_acid = false;
     std::unique_ptr<IColumn::Filter> _filter;
@@ -696,7 +714,7 @@ private:
     std::unordered_map<std::string, std::unique_ptr<converter::ColumnTypeConverter>> _converters;
 
     //support iceberg position delete .
-    std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
+    const std::vector<int64_t>* _position_delete_ordered_rowids = nullptr;
     std::unordered_map<const VSlotRef*, orc::PredicateDataType>
             _vslot_ref_to_orc_predicate_data_type;
     std::unordered_map<const VLiteral*, orc::Literal> _vliteral_to_orc_literal;
@@ -81,12 +81,12 @@ Status ByteArrayDictDecoder::read_dict_values_to_column(MutableColumnPtr& doris_
 MutableColumnPtr ByteArrayDictDecoder::convert_dict_column_to_string_column(
         const ColumnInt32* dict_column) {
     auto res = ColumnString::create();
-    std::vector<StringRef> dict_values(dict_column->size());
     const auto& data = dict_column->get_data();
-    for (size_t i = 0; i < dict_column->size(); ++i) {
-        dict_values[i] = _dict_items[data[i]];
+    _string_values.resize(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        _string_values[i] = _dict_items[data[i]];
     }
-    res->insert_many_strings_overflow(dict_values.data(), dict_values.size(), _max_value_length);
+    res->insert_many_strings_overflow(_string_values.data(), data.size(), _max_value_length);
     return res;
 }
 
@@ -113,25 +113,25 @@ Status ByteArrayDictDecoder::_decode_values(MutableColumnPtr& doris_column, Data
                                               cast_set<uint32_t>(_dict_items.size()));
         }
     }
-    _indexes.resize(non_null_size);
-    _index_batch_decoder->GetBatch(_indexes.data(), cast_set<uint32_t>(non_null_size));
-
     if (doris_column->is_column_dictionary() || is_dict_filter) {
+        _indexes.resize(non_null_size);
+        _index_batch_decoder->GetBatch(_indexes.data(), cast_set<uint32_t>(non_null_size));
         return _decode_dict_values<has_filter>(doris_column, select_vector, is_dict_filter);
     }
 
-    size_t dict_index = 0;
-
+    // Only the indexes of the selected values are unpacked and expanded to strings, the
+    // indexes of the filtered values are skipped.
     ColumnSelectVector::DataReadType read_type;
     while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
         switch (read_type) {
         case ColumnSelectVector::CONTENT: {
-            std::vector<StringRef> string_values;
-            string_values.reserve(run_length);
+            _indexes.resize(run_length);
+            _index_batch_decoder->GetBatch(_indexes.data(), cast_set<uint32_t>(run_length));
+            _string_values.resize(run_length);
             for (size_t i = 0; i < run_length; ++i) {
-                string_values.emplace_back(_dict_items[_indexes[dict_index++]]);
+                _string_values[i] = _dict_items[_indexes[i]];
             }
-            doris_column->insert_many_strings_overflow(string_values.data(), run_length,
+            doris_column->insert_many_strings_overflow(_string_values.data(), run_length,
                                                        _max_value_length);
             break;
         }
@@ -140,7 +140,7 @@ Status ByteArrayDictDecoder::_decode_values(MutableColumnPtr& doris_column, Data
             break;
         }
         case ColumnSelectVector::FILTERED_CONTENT: {
-            dict_index += run_length;
+            _index_batch_decoder->SkipValues(cast_set<uint32_t>(run_length));
             break;
         }
         case ColumnSelectVector::FILTERED_NULL: {
@@ -60,6 +60,8 @@ protected:
     std::vector<StringRef> _dict_items;
     std::vector<uint8_t> _dict_data;
     size_t _max_value_length;
+    // The strings of a run of selected values, reused across the runs.
+    std::vector<StringRef> _string_values;
 };
 #include "common/compile_check_end.h"
 
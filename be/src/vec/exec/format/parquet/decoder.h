@@ -145,8 +145,7 @@ protected:
     }
 
     Status skip_values(size_t num_values) override {
-        _indexes.resize(num_values);
-        _index_batch_decoder->GetBatch(_indexes.data(), cast_set<uint32_t>(num_values));
+        _index_batch_decoder->SkipValues(cast_set<uint32_t>(num_values));
         return Status::OK();
     }
 
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
+
+#include <gen_cpp/parquet_types.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "io/fs/file_reader.h"
+#include "olap/rowset/segment_v2/bloom_filter.h"
+#include "util/slice.h"
+#include "util/thrift_util.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+// The bloom filter header takes about 15 bytes.
+static constexpr size_t INIT_BLOOM_FILTER_HEADER_SIZE = 64;
+
+Status ParquetBloomFilter::read_bitset(io::FileReader* file, const tparquet::ColumnMetaData& meta,
+                                       io::IOContext* io_ctx, std::string* bitset) {
+    bitset->clear();
+    if (!meta.__isset.bloom_filter_offset || meta.bloom_filter_offset < 0 ||
+        static_cast<size_t>(meta.bloom_filter_offset) >= file->size()) {
+        return Status::OK();
+    }
+    size_t offset = meta.bloom_filter_offset;
+    // The writers which set the length write the header and the bitset together.
+    size_t bytes_to_read = meta.__isset.bloom_filter_length && meta.bloom_filter_length > 0
+                                   ? static_cast<size_t>(meta.bloom_filter_length)
+                                   : INIT_BLOOM_FILTER_HEADER_SIZE;
+    bytes_to_read = std::min(bytes_to_read, file->size() - offset);
+    std::vector<uint8_t> buf(bytes_to_read);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file->read_at(offset, Slice(buf.data(), bytes_to_read), &bytes_read, io_ctx));
+
+    tparquet::BloomFilterHeader header;
+    auto header_size = static_cast<uint32_t>(bytes_read);
+    RETURN_IF_ERROR(deserialize_thrift_msg(buf.data(), &header_size, true, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH ||
+        !header.compression.__isset.UNCOMPRESSED || header.numBytes <= 0 ||
+        header.numBytes % BYTES_PER_BLOCK != 0 ||
+        static_cast<uint32_t>(header.numBytes) > segment_v2::BloomFilter::MAXIMUM_BYTES) {
+        return Status::OK();
+    }
+    auto num_bytes = static_cast<size_t>(header.numBytes);
+    if (offset + header_size + num_bytes > file->size()) {
+        return Status::Corruption("Invalid bloom filter of size {} at offset {} in file {}",
+                                  num_bytes, offset, file->path().native());
+    }
+    if (header_size + num_bytes <= bytes_read) {
+        bitset->assign(reinterpret_cast<const char*>(buf.data()) + header_size, num_bytes);
+        return Status::OK();
+    }
+    bitset->resize(num_bytes);
+    RETURN_IF_ERROR(file->read_at(offset + header_size, Slice(bitset->data(), num_bytes),
+                                  &bytes_read, io_ctx));
+    return Status::OK();
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t size) {
+    return XXH64(data, size, 0);
+}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    if (_num_blocks == 0) {
+        return true;
+    }
+    const size_t block_index = ((hash >> 32) * _num_blocks) >> 32;
+    const auto key = static_cast<uint32_t>(hash);
+    const uint32_t* block = _blocks + block_index * BITS_SET_PER_BLOCK;
+    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        uint32_t mask = uint32_t(1) << ((key * SALT[i]) >> 27);
+        if ((block[i] & mask) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
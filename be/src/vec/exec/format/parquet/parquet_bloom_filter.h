@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <common/status.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "io/fs/file_reader_writer_fwd.h"
+
+namespace doris::io {
+struct IOContext;
+} // namespace doris::io
+namespace tparquet {
+class ColumnMetaData;
+} // namespace tparquet
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+// The split block bloom filter of a parquet column chunk, written by parquet-mr, Spark and
+// Iceberg. A value is hashed by XXH64 of its plain encoding, the upper 32 bits of the hash pick
+// a 32-byte block, and the lower 32 bits set a bit in each of the 8 words of the block.
+class ParquetBloomFilter {
+public:
+    // Reads the bitset of the bloom filter of the column chunk. `bitset` is empty if the chunk
+    // has no bloom filter or its algorithm, hash or compression is not supported.
+    static Status read_bitset(io::FileReader* file, const tparquet::ColumnMetaData& meta,
+                              io::IOContext* io_ctx, std::string* bitset);
+
+    static uint64_t hash(const void* data, size_t size);
+
+    // The bitset must outlive the filter.
+    explicit ParquetBloomFilter(const std::string& bitset)
+            : _blocks(reinterpret_cast<const uint32_t*>(bitset.data())),
+              _num_blocks(bitset.size() / BYTES_PER_BLOCK) {}
+
+    // Returns false if no value of the hash is in the chunk.
+    bool test_hash(uint64_t hash) const;
+
+private:
+    static constexpr size_t BYTES_PER_BLOCK = 32;
+    static constexpr int BITS_SET_PER_BLOCK = 8;
+    static constexpr uint32_t SALT[BITS_SET_PER_BLOCK] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU,
+                                                          0xa2b7289dU, 0x705495c7U, 0x2df1424bU,
+                                                          0x9efc4947U, 0x5c6bfb31U};
+
+    const uint32_t* _blocks;
+    size_t _num_blocks;
+};
+#include "common/compile_check_end.h"
+
+} // namespace doris::vectorized
@@ -28,6 +28,7 @@
 #include "vec/common/endian.h"
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/exec/format/format_common.h"
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
 #include "vec/exec/format/parquet/schema_desc.h"
 
 namespace doris::vectorized {
@@ -444,6 +445,59 @@ private:
         return predicates;
     }
 
+    template <PrimitiveType primitive_type>
+    static bool _filter_by_bloom_filter(const ColumnValueRange<primitive_type>& col_val_range,
+                                        const FieldSchema* col_schema,
+                                        const ParquetBloomFilter& bloom_filter) {
+        if (!col_val_range.is_fixed_value_range() || col_val_range.get_fixed_value_set().empty()) {
+            return false;
+        }
+        PrimitiveType src_type = col_schema->data_type->get_primitive_type();
+        if (src_type != primitive_type &&
+            !(is_string_type(src_type) && is_string_type(primitive_type))) {
+            return false;
+        }
+        tparquet::Type::type physical_type = col_schema->physical_type;
+        for (const auto& value : col_val_range.get_fixed_value_set()) {
+            // hash the plain encoding of the value in the physical type
+            uint64_t hash = 0;
+            if constexpr (primitive_type == TYPE_TINYINT || primitive_type == TYPE_SMALLINT ||
+                          primitive_type == TYPE_INT) {
+                if (physical_type != tparquet::Type::INT32) {
+                    return false;
+                }
+                int32_t int32_value = value;
+                hash = ParquetBloomFilter::hash(&int32_value, sizeof(int32_value));
+            } else if constexpr (primitive_type == TYPE_BIGINT) {
+                if (physical_type != tparquet::Type::INT64) {
+                    return false;
+                }
+                hash = ParquetBloomFilter::hash(&value, sizeof(value));
+            } else if constexpr (primitive_type == TYPE_FLOAT || primitive_type == TYPE_DOUBLE) {
+                // -0.0 equals 0.0 and the NaNs are equal in the fixed values, but their
+                // encodings are not.
+                if (physical_type != (primitive_type == TYPE_FLOAT ? tparquet::Type::FLOAT
+                                                                   : tparquet::Type::DOUBLE) ||
+                    value == 0 || std::isnan(value)) {
+                    return false;
+                }
+                hash = ParquetBloomFilter::hash(&value, sizeof(value));
+            } else if constexpr (primitive_type == TYPE_VARCHAR || primitive_type == TYPE_STRING) {
+                // CHAR values are padded, they may not equal the values in the file.
+                if (physical_type != tparquet::Type::BYTE_ARRAY) {
+                    return false;
+                }
+                hash = ParquetBloomFilter::hash(value.data, value.size);
+            } else {
+                return false;
+            }
+            if (bloom_filter.test_hash(hash)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     static inline bool _is_ascii(uint8_t byte) { return byte < 128; }
 
     static int _common_prefix(const std::string& encoding_min, const std::string& encoding_max) {
@@ -532,6 +586,20 @@ public:
                 col_val_range);
         return need_filter;
     }
+
+    // Returns true if no value of the `=` and `IN` predicates of the column is in the bloom
+    // filter of the column chunk.
+    static bool filter_by_bloom_filter(const ColumnValueRangeType& col_val_range,
+                                       const FieldSchema* col_schema,
+                                       const ParquetBloomFilter& bloom_filter) {
+        bool need_filter = false;
+        std::visit(
+                [&](auto&& range) {
+                    need_filter = _filter_by_bloom_filter(range, col_schema, bloom_filter);
+                },
+                col_val_range);
+        return need_filter;
+    }
 };
 #include "common/compile_check_end.h"
 
@@ -195,6 +195,29 @@ Status ScalarColumnReader::init(io::FileReaderSPtr file, FieldSchema* field, siz
     return Status::OK();
 }
 
+Status ScalarColumnReader::_skip_page() {
+    _pending_skip_values = 0;
+    return _chunk_reader->skip_page();
+}
+
+Status ScalarColumnReader::_load_page_data() {
+    if (_chunk_reader->page_data_loaded()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_chunk_reader->load_page_data());
+    size_t pending_skip_values = _pending_skip_values;
+    _pending_skip_values = 0;
+    return _skip_values(pending_skip_values);
+}
+
+Status ScalarColumnReader::_lazy_skip_values(size_t num_values) {
+    if (_chunk_reader->page_data_loaded()) {
+        return _skip_values(num_values);
+    }
+    _pending_skip_values += num_values;
+    return Status::OK();
+}
+
 Status ScalarColumnReader::_skip_values(size_t num_values) {
     if (num_values == 0) {
         return Status::OK();
@@ -595,7 +618,11 @@ Status ScalarColumnReader::read_column_data(
     DataTypePtr& resolved_type = _converter->get_physical_type();
 
     do {
-        if (_chunk_reader->remaining_num_values() == 0) {
+        if (_page_remaining_values() == 0) {
+            if (_pending_skip_values > 0) {
+                // no value of the page is read
+                RETURN_IF_ERROR(_skip_page());
+            }
             if (!_chunk_reader->has_next_page()) {
                 *eof = true;
                 *read_rows = 0;
@@ -612,13 +639,12 @@ Status ScalarColumnReader::read_column_data(
 
         // generate the row ranges that should be read
         std::list<RowRange> read_ranges;
-        _generate_read_ranges(_current_row_index,
-                              _current_row_index + _chunk_reader->remaining_num_values(),
+        _generate_read_ranges(_current_row_index, _current_row_index + _page_remaining_values(),
                               read_ranges);
         if (read_ranges.size() == 0) {
             // skip the whole page
-            _current_row_index += _chunk_reader->remaining_num_values();
-            RETURN_IF_ERROR(_chunk_reader->skip_page());
+            _current_row_index += _page_remaining_values();
+            RETURN_IF_ERROR(_skip_page());
             *read_rows = 0;
         } else {
             bool skip_whole_batch = false;
@@ -634,8 +660,8 @@ Status ScalarColumnReader::read_column_data(
                     filter_map.can_filter_all(remaining_num_values, _filter_map_index)) {
                     // We can skip the whole page if the remaining values is filtered by predicate columns
                     _filter_map_index += remaining_num_values;
-                    _current_row_index += _chunk_reader->remaining_num_values();
-                    RETURN_IF_ERROR(_chunk_reader->skip_page());
+                    _current_row_index += _page_remaining_values();
+                    RETURN_IF_ERROR(_skip_page());
                     *read_rows = remaining_num_values;
                     if (!_chunk_reader->has_next_page()) {
                         *eof = true;
@@ -648,20 +674,21 @@ Status ScalarColumnReader::read_column_data(
                     _filter_map_index += batch_size;
                 }
             }
-            // load page data to decode or skip values
-            RETURN_IF_ERROR(_chunk_reader->load_page_data_idempotent());
+            // The page data is loaded only when some values of the page are read, the values
+            // skipped before are skipped with the page otherwise.
             size_t has_read = 0;
             for (auto& range : read_ranges) {
                 // generate the skipped values
                 size_t skip_values = range.first_row - _current_row_index;
-                RETURN_IF_ERROR(_skip_values(skip_values));
+                RETURN_IF_ERROR(_lazy_skip_values(skip_values));
                 _current_row_index += skip_values;
                 // generate the read values
                 size_t read_values =
                         std::min((size_t)(range.last_row - range.first_row), batch_size - has_read);
                 if (skip_whole_batch) {
-                    RETURN_IF_ERROR(_skip_values(read_values));
+                    RETURN_IF_ERROR(_lazy_skip_values(read_values));
                 } else {
+                    RETURN_IF_ERROR(_load_page_data());
                     RETURN_IF_ERROR(_read_values(read_values, resolved_column, resolved_type,
                                                  filter_map, is_dict_filter));
                 }
@@ -674,7 +701,7 @@ Status ScalarColumnReader::read_column_data(
             *read_rows = has_read;
         }
 
-        if (_chunk_reader->remaining_num_values() == 0 && !_chunk_reader->has_next_page()) {
+        if (_page_remaining_values() == 0 && !_chunk_reader->has_next_page()) {
             *eof = true;
         }
     } while (false);
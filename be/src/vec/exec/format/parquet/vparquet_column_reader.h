@@ -205,7 +205,17 @@ private:
     std::unique_ptr<parquet::PhysicalToLogicalConverter> _converter = nullptr;
     std::unique_ptr<std::vector<uint8_t>> _nested_filter_map_data = nullptr;
     size_t _orig_filter_map_index = 0;
+    // The values skipped before the data of current page is loaded. They are skipped when the
+    // page data is loaded, so a page whose values are all skipped is never decompressed.
+    size_t _pending_skip_values = 0;
 
+    // The values of current page which are neither read nor skipped.
+    size_t _page_remaining_values() const {
+        return _chunk_reader->remaining_num_values() - _pending_skip_values;
+    }
+    Status _skip_page();
+    Status _load_page_data();
+    Status _lazy_skip_values(size_t num_values);
     Status _skip_values(size_t num_values);
     Status _read_values(size_t num_values, ColumnPtr& doris_column, DataTypePtr& type,
                         FilterMap& filter_map, bool is_dict_filter);
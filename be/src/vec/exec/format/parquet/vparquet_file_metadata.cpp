@@ -19,7 +19,9 @@
 
 #include <gen_cpp/parquet_types.h>
 
+#include <algorithm>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include "runtime/exec_env.h"
@@ -29,9 +31,42 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+// The memory taken by the thrift footer, its structs and the strings they own. The footer of a
+// file with many row groups takes several times its serialized size.
+static size_t thrift_mem_size(const tparquet::FileMetaData& metadata) {
+    size_t size = sizeof(tparquet::FileMetaData) +
+                  metadata.schema.capacity() * sizeof(tparquet::SchemaElement) +
+                  metadata.row_groups.capacity() * sizeof(tparquet::RowGroup);
+    for (const auto& element : metadata.schema) {
+        size += element.name.size();
+    }
+    for (const auto& key_value : metadata.key_value_metadata) {
+        size += sizeof(tparquet::KeyValue) + key_value.key.size() + key_value.value.size();
+    }
+    for (const auto& row_group : metadata.row_groups) {
+        size += row_group.columns.capacity() * sizeof(tparquet::ColumnChunk);
+        for (const auto& column : row_group.columns) {
+            const auto& meta = column.meta_data;
+            size += column.file_path.size() +
+                    meta.encodings.capacity() * sizeof(tparquet::Encoding::type) +
+                    meta.encoding_stats.capacity() * sizeof(tparquet::PageEncodingStats);
+            for (const auto& path : meta.path_in_schema) {
+                size += sizeof(std::string) + path.size();
+            }
+            const auto& stats = meta.statistics;
+            size += stats.max.size() + stats.min.size() + stats.max_value.size() +
+                    stats.min_value.size();
+        }
+    }
+    return size;
+}
+
 FileMetaData::FileMetaData(tparquet::FileMetaData& metadata, size_t mem_size)
-        : _metadata(metadata), _mem_size(mem_size) {
-    ExecEnv::GetInstance()->parquet_meta_tracker()->consume(mem_size);
+        : _metadata(std::move(metadata)) {
+    // The parsed schema has a FieldSchema for each schema element.
+    _mem_size = std::max(mem_size, thrift_mem_size(_metadata) +
+                                           _metadata.schema.size() * sizeof(FieldSchema));
+    ExecEnv::GetInstance()->parquet_meta_tracker()->consume(_mem_size);
 }
 
 FileMetaData::~FileMetaData() {
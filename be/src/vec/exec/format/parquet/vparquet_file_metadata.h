@@ -27,6 +27,7 @@ namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 class FileMetaData {
 public:
+    // Takes the content of `metadata`, `mem_size` is its serialized size.
     FileMetaData(tparquet::FileMetaData& metadata, size_t mem_size);
     ~FileMetaData();
     Status init_schema();
@@ -36,6 +37,7 @@ public:
         _schema.iceberg_sanitize(read_columns);
     }
     std::string debug_string() const;
+    // The memory taken by the parsed footer and schema.
     size_t get_mem_size() const { return _mem_size; }
 
 private:
@@ -33,6 +33,7 @@
 #include "io/fs/file_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "io/fs/tracing_file_reader.h"
+#include "parquet_bloom_filter.h"
 #include "parquet_pred_cmp.h"
 #include "parquet_thrift_util.h"
 #include "runtime/define_primitive_type.h"
@@ -136,6 +137,8 @@ void ParquetReader::_init_profile() {
                 _profile, "FilteredGroups", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.to_read_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "ReadGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.bloom_filter_filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByBloomFilter", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_group_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredRowsByGroup", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_page_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -921,8 +924,7 @@ Status ParquetReader::_process_row_group_filter(
         RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, filter_group));
         _init_chunk_dicts();
         RETURN_IF_ERROR(_process_dict_filter(filter_group));
-        _init_bloom_filter();
-        RETURN_IF_ERROR(_process_bloom_filter(filter_group));
+        RETURN_IF_ERROR(_process_bloom_filter(row_group.columns, filter_group));
     }
     return Status::OK();
 }
@@ -1022,9 +1024,67 @@ Status ParquetReader::_process_dict_filter(bool* filter_group) {
     return Status::OK();
 }
 
-void ParquetReader::_init_bloom_filter() {}
+Status ParquetReader::_process_bloom_filter(const std::vector<tparquet::ColumnChunk>& columns,
+                                            bool* filter_group) {
+    if (*filter_group || _colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
+        return Status::OK();
+    }
+    auto& schema_desc = _file_metadata->schema();
+    for (auto& table_col_name : _read_table_columns) {
+        if (!_table_info_node_ptr->children_column_exists(table_col_name)) {
+            continue;
+        }
+        auto slot_iter = _colname_to_value_range->find(table_col_name);
+        if (slot_iter == _colname_to_value_range->end()) {
+            continue;
+        }
+        // only `=` and `IN` predicates, including the runtime IN filters, can be tested
+        if (!std::visit([](auto&& range) { return range.is_fixed_value_range(); },
+                        slot_iter->second)) {
+            continue;
+        }
+        auto file_col_name = _table_info_node_ptr->children_file_column_name(table_col_name);
+        const FieldSchema* col_schema = schema_desc.get_column(file_col_name);
+        int parquet_col_id = col_schema->physical_column_index;
+        if (parquet_col_id < 0) {
+            // complex type, not support filter yet.
+            continue;
+        }
+        auto& meta_data = columns[parquet_col_id].meta_data;
+        if (!meta_data.__isset.bloom_filter_offset) {
+            continue;
+        }
 
-Status ParquetReader::_process_bloom_filter(bool* filter_group) {
+        // The bitsets are cached with the footer, they are read again by every scan otherwise.
+        ObjLRUCache::CacheHandle cache_handle;
+        std::string local_bitset;
+        const std::string* bitset = &local_bitset;
+        if (_meta_cache != nullptr && _meta_cache->lookup_parquet_bloom_filter(
+                                              _file_description.path, _file_description.mtime,
+                                              meta_data.bloom_filter_offset, &cache_handle)) {
+            bitset = static_cast<const std::string*>(cache_handle.data<std::string>());
+        } else {
+            RETURN_IF_ERROR(ParquetBloomFilter::read_bitset(_tracing_file_reader.get(), meta_data,
+                                                            _io_ctx, &local_bitset));
+            _column_statistics.read_bytes += local_bitset.size();
+            _column_statistics.meta_read_calls += 1;
+            if (_meta_cache != nullptr) {
+                _meta_cache->insert_parquet_bloom_filter(
+                        _file_description.path, _file_description.mtime,
+                        meta_data.bloom_filter_offset, std::move(local_bitset), &cache_handle);
+                bitset = static_cast<const std::string*>(cache_handle.data<std::string>());
+            }
+        }
+        if (bitset->empty()) {
+            continue;
+        }
+        if (ParquetPredicate::filter_by_bloom_filter(slot_iter->second, col_schema,
+                                                     ParquetBloomFilter(*bitset))) {
+            *filter_group = true;
+            _statistics.bloom_filter_filtered_row_groups++;
+            break;
+        }
+    }
     return Status::OK();
 }
 
@@ -1042,6 +1102,8 @@ void ParquetReader::_collect_profile() {
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
+    COUNTER_UPDATE(_parquet_profile.bloom_filter_filtered_row_groups,
+                   _statistics.bloom_filter_filtered_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
     COUNTER_UPDATE(_parquet_profile.lazy_read_filtered_rows, _statistics.lazy_read_filtered_rows);
@@ -15,6 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#pragma once
+
+#include <parallel_hashmap/phmap.h>
+
+#include <limits>
+
 #include "exprs/hybrid_set.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
@@ -29,36 +35,27 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ *
+ * The set is immutable once built, `filter_data_block` may be called by the readers of
+ * many data files at the same time, see `EqualityDeleteSet`.
  */
 class EqualityDeleteBase {
 protected:
-    RuntimeProfile::Counter* num_delete_rows;
-    RuntimeProfile::Counter* build_set_time;
-    RuntimeProfile::Counter* equality_delete_time;
-
-    Block* _delete_block;
+    const Block* _delete_block;
 
     virtual Status _build_set() = 0;
 
 public:
-    EqualityDeleteBase(Block* delete_block) : _delete_block(delete_block) {}
+    EqualityDeleteBase(const Block* delete_block) : _delete_block(delete_block) {}
     virtual ~EqualityDeleteBase() = default;
 
-    Status init(RuntimeProfile* profile) {
-        static const char* delete_profile = "EqualityDelete";
-        ADD_TIMER_WITH_LEVEL(profile, delete_profile, 1);
-        num_delete_rows = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumRowsInDeleteFile", TUnit::UNIT,
-                                                       delete_profile, 1);
-        build_set_time = ADD_CHILD_TIMER_WITH_LEVEL(profile, "BuildHashSetTime", delete_profile, 1);
-        equality_delete_time =
-                ADD_CHILD_TIMER_WITH_LEVEL(profile, "EqualityDeleteFilterTime", delete_profile, 1);
-        SCOPED_TIMER(build_set_time);
-        return _build_set();
-    }
-
-    virtual Status filter_data_block(Block* data_block) = 0;
-
-    static std::unique_ptr<EqualityDeleteBase> get_delete_impl(Block* delete_block);
+    Status init() { return _build_set(); }
+
+    size_t num_delete_rows() const { return _delete_block->rows(); }
+
+    virtual Status filter_data_block(Block* data_block) const = 0;
+
+    static std::unique_ptr<EqualityDeleteBase> get_delete_impl(const Block* delete_block);
 };
 
 class SimpleEqualityDelete : public EqualityDeleteBase {
@@ -66,14 +63,13 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
 public:
-    SimpleEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
+    SimpleEqualityDelete(const Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 /**
@@ -81,26 +77,35 @@ public:
  */
 class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
-    // hash column for delete block
-    std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
-    // hash code => row index
-    // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
+    static constexpr size_t NO_ROW = std::numeric_limits<size_t>::max();
+
+    // hash code => the last delete row of the hash, the rows of a hash are chained by
+    // `_next_delete_rows`. If hash values are equal, then compare the real values.
+    // The row index records the row number of the delete row in delete block.
+    phmap::flat_hash_map<uint64_t, size_t> _delete_hash_map;
+    std::vector<size_t> _next_delete_rows;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    bool _equal(const Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index) const;
 
 public:
-    MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
+    MultiEqualityDelete(const Block* delete_block) : EqualityDeleteBase(delete_block) {}
+
+    Status filter_data_block(Block* data_block) const override;
+};
 
-    Status filter_data_block(Block* data_block) override;
+/**
+ * The rows of the equality delete files of a data file and the set built on them. It is built
+ * once under the lock of the kv cache of the scan node, and shared by the readers of all the
+ * data files having the same delete files.
+ */
+struct EqualityDeleteSet {
+    std::vector<std::string> col_names;
+    std::vector<DataTypePtr> col_types;
+    Block delete_block;
+    std::unique_ptr<EqualityDeleteBase> impl;
 };
 
 #include "common/compile_check_end.h"
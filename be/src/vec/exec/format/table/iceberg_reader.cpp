@@ -91,6 +91,14 @@ IcebergTableReader::IcebergTableReader(std::unique_ptr<GenericReader> file_forma
             ADD_CHILD_TIMER(_profile, "DeleteFileReadTime", iceberg_profile);
     _iceberg_profile.delete_rows_sort_time =
             ADD_CHILD_TIMER(_profile, "DeleteRowsSortTime", iceberg_profile);
+    static const char* delete_profile = "EqualityDelete";
+    ADD_TIMER_WITH_LEVEL(_profile, delete_profile, 1);
+    _iceberg_profile.num_equality_delete_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
+            _profile, "NumRowsInDeleteFile", TUnit::UNIT, delete_profile, 1);
+    _iceberg_profile.build_equality_delete_set_time =
+            ADD_CHILD_TIMER_WITH_LEVEL(_profile, "BuildHashSetTime", delete_profile, 1);
+    _iceberg_profile.equality_delete_filter_time =
+            ADD_CHILD_TIMER_WITH_LEVEL(_profile, "EqualityDeleteFilterTime", delete_profile, 1);
 }
 
 Status IcebergTableReader::get_next_block_inner(Block* block, size_t* read_rows, bool* eof) {
@@ -98,8 +106,9 @@ Status IcebergTableReader::get_next_block_inner(Block* block, size_t* read_rows,
 
     RETURN_IF_ERROR(_file_format_reader->get_next_block(block, read_rows, eof));
 
-    if (_equality_delete_impl != nullptr) {
-        RETURN_IF_ERROR(_equality_delete_impl->filter_data_block(block));
+    if (_equality_delete_set != nullptr) {
+        SCOPED_TIMER(_iceberg_profile.equality_delete_filter_time);
+        RETURN_IF_ERROR(_equality_delete_set->impl->filter_data_block(block));
         *read_rows = block->rows();
     }
     return _shrink_block_if_need(block);
@@ -141,11 +150,73 @@ Status IcebergTableReader::init_row_filters() {
     return Status::OK();
 }
 
+std::string IcebergTableReader::_equality_delete_cache_key(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    // The data files sharing the same delete files share the same delete set.
+    std::vector<std::string> paths;
+    paths.reserve(delete_files.size());
+    for (const auto& delete_file : delete_files) {
+        paths.emplace_back(delete_file.path);
+    }
+    std::sort(paths.begin(), paths.end());
+    std::string key = "equality_delete";
+    for (const std::string& path : paths) {
+        key.append("_").append(path);
+    }
+    return key;
+}
+
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    Status create_status = Status::OK();
+    _equality_delete_set = _kv_cache->get<EqualityDeleteSet>(
+            _equality_delete_cache_key(delete_files), [&]() -> EqualityDeleteSet* {
+                auto delete_set = std::make_unique<EqualityDeleteSet>();
+                {
+                    SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+                    create_status = _read_equality_delete_files(delete_files, delete_set.get());
+                }
+                if (!create_status.ok()) {
+                    return nullptr;
+                }
+                SCOPED_TIMER(_iceberg_profile.build_equality_delete_set_time);
+                delete_set->impl = EqualityDeleteBase::get_delete_impl(&delete_set->delete_block);
+                create_status = delete_set->impl->init();
+                if (!create_status.ok()) {
+                    return nullptr;
+                }
+                COUNTER_UPDATE(_iceberg_profile.num_equality_delete_rows,
+                               delete_set->impl->num_delete_rows());
+                return delete_set.release();
+            });
+    RETURN_IF_ERROR(create_status);
+    if (_equality_delete_set == nullptr) {
+        return Status::InternalError("Failed to build the equality delete set");
+    }
+
+    const auto& equality_delete_col_names = _equality_delete_set->col_names;
+    const auto& equality_delete_col_types = _equality_delete_set->col_types;
+    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
+        const std::string& delete_col = equality_delete_col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    return Status::OK();
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDeleteSet* delete_set) {
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<DataTypePtr> equality_delete_col_types;
+    std::vector<std::string>& equality_delete_col_names = delete_set->col_names;
+    std::vector<DataTypePtr>& equality_delete_col_types = delete_set->col_types;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -163,7 +234,7 @@ Status IcebergTableReader::_equality_delete_base(
             RETURN_IF_ERROR(delete_reader->init_schema_reader());
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
+            _generate_equality_delete_block(&delete_set->delete_block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
         }
@@ -188,26 +259,12 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&delete_set->delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = make_nullable(equality_delete_col_types[i]);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(std::move(data_column), data_type, delete_col);
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    return Status::OK();
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -91,6 +91,9 @@ protected:
         RuntimeProfile::Counter* num_delete_rows;
         RuntimeProfile::Counter* delete_files_read_time;
         RuntimeProfile::Counter* delete_rows_sort_time;
+        RuntimeProfile::Counter* num_equality_delete_rows;
+        RuntimeProfile::Counter* build_equality_delete_set_time;
+        RuntimeProfile::Counter* equality_delete_filter_time;
     };
     using DeleteRows = std::vector<int64_t>;
     using DeleteFile = phmap::parallel_flat_hash_map<
@@ -111,10 +114,15 @@ protected:
     PositionDeleteRange _get_range(const ColumnString& file_path_column);
 
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
+    static std::string _equality_delete_cache_key(
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
 
     Status _position_delete_base(const std::string data_file_path,
                                  const std::vector<TIcebergDeleteFileDesc>& delete_files);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    // Reads all the equality delete files into the delete block of the set.
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       EqualityDeleteSet* delete_set);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(Block* block,
@@ -149,9 +157,9 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // equality delete, built once and shared by all the scanners of the scan node.
+    // owned by _kv_cache
+    EqualityDeleteSet* _equality_delete_set = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
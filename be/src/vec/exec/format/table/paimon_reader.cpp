@@ -28,8 +28,9 @@ namespace doris::vectorized {
 PaimonReader::PaimonReader(std::unique_ptr<GenericReader> file_format_reader,
                            RuntimeProfile* profile, RuntimeState* state,
                            const TFileScanRangeParams& params, const TFileRangeDesc& range,
-                           io::IOContext* io_ctx)
-        : TableFormatReader(std::move(file_format_reader), state, profile, params, range, io_ctx) {
+                           io::IOContext* io_ctx, FileMetaCache* meta_cache)
+        : TableFormatReader(std::move(file_format_reader), state, profile, params, range, io_ctx),
+          _meta_cache(meta_cache) {
     static const char* paimon_profile = "PaimonProfile";
     ADD_TIMER(_profile, paimon_profile);
     _paimon_profile.num_delete_rows =
@@ -51,6 +52,33 @@ Status PaimonReader::init_row_filters() {
     }
 
     const auto& deletion_file = table_desc.deletion_file;
+    if (_meta_cache != nullptr &&
+        _meta_cache->lookup_deletion_vector(deletion_file.path, deletion_file.offset,
+                                            &_delete_rows_cache_handle)) {
+        _delete_rows = static_cast<const std::vector<int64_t>*>(
+                _delete_rows_cache_handle.data<std::vector<int64_t>>());
+    } else {
+        std::vector<int64_t> delete_rows;
+        RETURN_IF_ERROR(_read_deletion_vector(&delete_rows));
+        if (_meta_cache != nullptr) {
+            _meta_cache->insert_deletion_vector(deletion_file.path, deletion_file.offset,
+                                                std::move(delete_rows), &_delete_rows_cache_handle);
+            _delete_rows = static_cast<const std::vector<int64_t>*>(
+                    _delete_rows_cache_handle.data<std::vector<int64_t>>());
+        } else {
+            _owned_delete_rows = std::move(delete_rows);
+            _delete_rows = &_owned_delete_rows;
+        }
+    }
+    if (!_delete_rows->empty()) {
+        COUNTER_UPDATE(_paimon_profile.num_delete_rows, _delete_rows->size());
+        set_delete_rows();
+    }
+    return Status::OK();
+}
+
+Status PaimonReader::_read_deletion_vector(std::vector<int64_t>* delete_rows) {
+    const auto& deletion_file = _range.table_format_params.paimon_params.deletion_file;
     io::FileSystemProperties properties = {
             .system_type = _params.file_type,
             .properties = _params.properties,
@@ -94,15 +122,8 @@ Status PaimonReader::init_row_filters() {
                 deletion_file.path, deletion_file.offset, deletion_file.length + 4, bytes_read);
     }
     auto deletion_vector = DORIS_TRY(DeletionVector::deserialize(result.data, result.size));
-    if (!deletion_vector.is_empty()) {
-        for (auto i = deletion_vector.minimum(); i <= deletion_vector.maximum(); i++) {
-            if (deletion_vector.is_delete(i)) {
-                _delete_rows.push_back(i);
-            }
-        }
-        COUNTER_UPDATE(_paimon_profile.num_delete_rows, _delete_rows.size());
-        set_delete_rows();
-    }
+    // Iterates the set bits instead of probing every position between the minimum and maximum.
+    deletion_vector.to_positions(delete_rows);
     return Status::OK();
 }
 
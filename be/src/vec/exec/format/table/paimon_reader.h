@@ -20,6 +20,7 @@
 #include <memory>
 #include <vector>
 
+#include "io/fs/file_meta_cache.h"
 #include "vec/exec/format/orc/vorc_reader.h"
 #include "vec/exec/format/parquet/vparquet_reader.h"
 #include "vec/exec/format/table/table_format_reader.h"
@@ -30,7 +31,8 @@ class PaimonReader : public TableFormatReader, public TableSchemaChangeHelper {
 public:
     PaimonReader(std::unique_ptr<GenericReader> file_format_reader, RuntimeProfile* profile,
                  RuntimeState* state, const TFileScanRangeParams& params,
-                 const TFileRangeDesc& range, io::IOContext* io_ctx);
+                 const TFileRangeDesc& range, io::IOContext* io_ctx,
+                 FileMetaCache* meta_cache = nullptr);
 
     ~PaimonReader() override = default;
 
@@ -43,9 +45,17 @@ protected:
         RuntimeProfile::Counter* num_delete_rows;
         RuntimeProfile::Counter* delete_files_read_time;
     };
-    std::vector<int64_t> _delete_rows;
+    // The sorted positions of the deleted rows, points to `_owned_delete_rows` or the entry
+    // of `_delete_rows_cache_handle` in the file meta cache.
+    const std::vector<int64_t>* _delete_rows = nullptr;
+    std::vector<int64_t> _owned_delete_rows;
+    ObjLRUCache::CacheHandle _delete_rows_cache_handle;
+    // owned by ExecEnv, nullptr if the file meta cache is disabled
+    FileMetaCache* _meta_cache = nullptr;
     PaimonProfile _paimon_profile;
 
+    Status _read_deletion_vector(std::vector<int64_t>* delete_rows);
+
     virtual void set_delete_rows() = 0;
 };
 
@@ -54,13 +64,15 @@ public:
     ENABLE_FACTORY_CREATOR(PaimonOrcReader);
     PaimonOrcReader(std::unique_ptr<GenericReader> file_format_reader, RuntimeProfile* profile,
                     RuntimeState* state, const TFileScanRangeParams& params,
-                    const TFileRangeDesc& range, io::IOContext* io_ctx)
-            : PaimonReader(std::move(file_format_reader), profile, state, params, range, io_ctx) {};
+                    const TFileRangeDesc& range, io::IOContext* io_ctx,
+                    FileMetaCache* meta_cache = nullptr)
+            : PaimonReader(std::move(file_format_reader), profile, state, params, range, io_ctx,
+                           meta_cache) {};
     ~PaimonOrcReader() final = default;
 
     void set_delete_rows() final {
         (reinterpret_cast<OrcReader*>(_file_format_reader.get()))
-                ->set_position_delete_rowids(&_delete_rows);
+                ->set_position_delete_rowids(_delete_rows);
     }
 
     Status init_reader(
@@ -90,13 +102,15 @@ public:
     ENABLE_FACTORY_CREATOR(PaimonParquetReader);
     PaimonParquetReader(std::unique_ptr<GenericReader> file_format_reader, RuntimeProfile* profile,
                         RuntimeState* state, const TFileScanRangeParams& params,
-                        const TFileRangeDesc& range, io::IOContext* io_ctx)
-            : PaimonReader(std::move(file_format_reader), profile, state, params, range, io_ctx) {};
+                        const TFileRangeDesc& range, io::IOContext* io_ctx,
+                        FileMetaCache* meta_cache = nullptr)
+            : PaimonReader(std::move(file_format_reader), profile, state, params, range, io_ctx,
+                           meta_cache) {};
     ~PaimonParquetReader() final = default;
 
     void set_delete_rows() final {
         (reinterpret_cast<ParquetReader*>(_file_format_reader.get()))
-                ->set_delete_rows(&_delete_rows);
+                ->set_delete_rows(_delete_rows);
     }
 
     Status init_reader(
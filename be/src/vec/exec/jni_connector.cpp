@@ -17,6 +17,10 @@
 
 #include "jni_connector.h"
 
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
 #include <glog/logging.h>
 
 #include <sstream>
@@ -25,6 +29,8 @@
 #include "jni.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/runtime_state.h"
+#include "util/arrow/block_convertor.h"
+#include "util/arrow/row_batch.h"
 #include "util/jni-util.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_map.h"
@@ -117,6 +123,9 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     // return the address of meta information
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
+    if (use_arrow_batch()) {
+        return _get_next_arrow_block(env, block, read_rows, eof);
+    }
     long meta_address = 0;
     {
         SCOPED_RAW_TIMER(&_java_scan_watcher);
@@ -145,6 +154,58 @@ Status JniConnector::get_next_block(Block* block, size_t* read_rows, bool* eof)
     return Status::OK();
 }
 
+Status JniConnector::_get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows,
+                                           bool* eof) {
+    struct ArrowArray c_array {};
+    struct ArrowSchema c_schema {};
+    long num_rows = 0;
+    {
+        SCOPED_RAW_TIMER(&_java_scan_watcher);
+        num_rows = env->CallLongMethod(_jni_scanner_obj, _jni_scanner_get_next_arrow_batch,
+                                       reinterpret_cast<jlong>(&c_array),
+                                       reinterpret_cast<jlong>(&c_schema));
+    }
+    RETURN_ERROR_IF_EXC(env);
+    if (num_rows == 0) {
+        *read_rows = 0;
+        *eof = true;
+        return Status::OK();
+    }
+    // The imported batch owns the exported buffers, they are released by the java side when the
+    // batch is destroyed.
+    auto import_result = arrow::ImportRecordBatch(&c_array, &c_schema);
+    if (!import_result.ok()) {
+        return Status::InternalError("Failed to import arrow batch from {}: {}", _connector_name,
+                                     import_result.status().ToString());
+    }
+    std::shared_ptr<arrow::RecordBatch> batch = std::move(import_result).ValueUnsafe();
+    if (batch->num_rows() != num_rows) {
+        return Status::InternalError("Arrow batch of {} has {} rows, expect {} rows",
+                                     _connector_name, batch->num_rows(), num_rows);
+    }
+
+    SCOPED_RAW_TIMER(&_fill_block_watcher);
+    for (const std::string& column_name : _column_names) {
+        auto& column_with_type_and_name = block->get_by_name(column_name);
+        std::shared_ptr<arrow::Array> arrow_column = batch->GetColumnByName(column_name);
+        if (arrow_column == nullptr) {
+            return Status::InternalError("Column {} is not in the arrow batch of {}", column_name,
+                                         _connector_name);
+        }
+        try {
+            RETURN_IF_ERROR(column_with_type_and_name.type->get_serde()->read_column_from_arrow(
+                    column_with_type_and_name.column->assume_mutable_ref(), arrow_column.get(), 0,
+                    num_rows, _state->timezone_obj()));
+        } catch (Exception& e) {
+            return Status::InternalError("Failed to convert from arrow to block: {}", e.what());
+        }
+    }
+    *read_rows = num_rows;
+    *eof = false;
+    _has_read += num_rows;
+    return Status::OK();
+}
+
 Status JniConnector::get_table_schema(std::string& table_schema_str) {
     JNIEnv* env = nullptr;
     RETURN_IF_ERROR(JniUtil::GetJNIEnv(&env));
@@ -275,6 +336,12 @@ Status JniConnector::_init_jni_scanner(JNIEnv* env, int batch_size) {
     _jni_scanner_get_statistics =
             env->GetMethodID(_jni_scanner_cls, "getStatistics", "()Ljava/util/Map;");
     RETURN_ERROR_IF_EXC(env);
+    // Optional, only the scanners exporting arrow batches implement it.
+    _jni_scanner_get_next_arrow_batch =
+            env->GetMethodID(_jni_scanner_cls, "getNextArrowBatch", "(JJ)J");
+    if (_jni_scanner_get_next_arrow_batch == nullptr) {
+        env->ExceptionClear();
+    }
     RETURN_IF_ERROR(JniUtil::LocalToGlobalRef(env, jni_scanner_obj, &_jni_scanner_obj));
     env->DeleteLocalRef(jni_scanner_obj);
     RETURN_ERROR_IF_EXC(env);
@@ -316,6 +383,66 @@ Status JniConnector::fill_block(Block* block, const ColumnNumbers& arguments, lo
     return Status::OK();
 }
 
+Status JniConnector::to_arrow_batch(const Block& block, const ColumnNumbers& arguments,
+                                    ArrowArray* array, ArrowSchema* schema) {
+    Block arrow_block;
+    for (size_t i : arguments) {
+        const auto& column_with_type_and_name = block.get_by_position(i);
+        // Same as the field names of parse_table_schema.
+        arrow_block.insert({column_with_type_and_name.column->convert_to_full_column_if_const(),
+                            column_with_type_and_name.type, "_col_" + std::to_string(i)});
+    }
+    std::shared_ptr<arrow::Schema> arrow_schema;
+    RETURN_IF_ERROR(get_arrow_schema_from_block(arrow_block, &arrow_schema, "UTC"));
+    std::shared_ptr<arrow::RecordBatch> batch;
+    RETURN_IF_ERROR(convert_to_arrow_batch(arrow_block, arrow_schema, arrow::default_memory_pool(),
+                                           &batch, cctz::utc_time_zone(), true));
+    auto status = arrow::ExportRecordBatch(*batch, array, schema);
+    if (!status.ok()) {
+        return Status::InternalError("Failed to export arrow batch: {}", status.ToString());
+    }
+    return Status::OK();
+}
+
+Status JniConnector::fill_block_from_arrow(Block* block, const ColumnNumbers& arguments,
+                                           size_t num_rows, ArrowArray* array,
+                                           ArrowSchema* schema) {
+    auto import_result = arrow::ImportRecordBatch(array, schema);
+    if (!import_result.ok()) {
+        return Status::InternalError("Failed to import arrow batch: {}",
+                                     import_result.status().ToString());
+    }
+    std::shared_ptr<arrow::RecordBatch> batch = std::move(import_result).ValueUnsafe();
+    if (static_cast<size_t>(batch->num_columns()) != arguments.size() ||
+        static_cast<size_t>(batch->num_rows()) != num_rows) {
+        return Status::InternalError("Arrow batch has {} columns and {} rows, expect {} and {}",
+                                     batch->num_columns(), batch->num_rows(), arguments.size(),
+                                     num_rows);
+    }
+    for (size_t i = 0; i < arguments.size(); ++i) {
+        const auto& data_type = block->get_by_position(arguments[i]).type;
+        auto column = data_type->create_column();
+        try {
+            RETURN_IF_ERROR(data_type->get_serde()->read_column_from_arrow(
+                    *column, batch->column(static_cast<int>(i)).get(), 0, num_rows,
+                    cctz::utc_time_zone()));
+        } catch (Exception& e) {
+            return Status::InternalError("Failed to convert from arrow to block: {}", e.what());
+        }
+        block->replace_by_position(arguments[i], std::move(column));
+    }
+    return Status::OK();
+}
+
+void JniConnector::release_arrow_batch(ArrowArray* array, ArrowSchema* schema) {
+    if (array->release != nullptr) {
+        array->release(array);
+    }
+    if (schema->release != nullptr) {
+        schema->release(schema);
+    }
+}
+
 Status JniConnector::_fill_block(Block* block, size_t num_rows) {
     SCOPED_RAW_TIMER(&_fill_block_watcher);
     JNIEnv* env = nullptr;
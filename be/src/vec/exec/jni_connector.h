@@ -40,6 +40,9 @@
 #include "vec/common/string_ref.h"
 #include "vec/data_types/data_type.h"
 
+struct ArrowArray;
+struct ArrowSchema;
+
 namespace doris {
 class RuntimeState;
 
@@ -215,6 +218,7 @@ public:
      * 2. close: close java scanner, and release jni resources
      * 3. releaseColumn: release a single column
      * 4. releaseTable: release current batch, which will also release columns and meta information
+     * 5. getNextArrowBatch: optional, read next batch and export it by the arrow c data interface
      */
     Status open(RuntimeState* state, RuntimeProfile* profile);
 
@@ -239,6 +243,11 @@ public:
      */
     Status get_next_block(Block* block, size_t* read_rows, bool* eof);
 
+    /**
+     * Whether the java scanner exports its batches by the arrow c data interface.
+     */
+    bool use_arrow_batch() const { return _jni_scanner_get_next_arrow_batch != nullptr; }
+
     /**
      * Get performance metrics from java scanner
      */
@@ -272,6 +281,28 @@ public:
 
     static Status fill_block(Block* block, const ColumnNumbers& arguments, long table_address);
 
+    /**
+     * Export the columns of the block at the arguments by the arrow c data interface. Numeric and
+     * string columns are shared without copy, the exported batch keeps them alive until it is
+     * released, by the java side after importing it, or by the caller otherwise.
+     * Date times are exported as UTC timestamps, so that the java side sees their wall clock.
+     */
+    static Status to_arrow_batch(const Block& block, const ColumnNumbers& arguments,
+                                 ArrowArray* array, ArrowSchema* schema);
+
+    /**
+     * Import the arrow batch exported by the java side into the columns of the block at the
+     * arguments, the i-th column of the batch is read into the column at arguments[i].
+     * The batch is released after it is read.
+     */
+    static Status fill_block_from_arrow(Block* block, const ColumnNumbers& arguments,
+                                        size_t num_rows, ArrowArray* array, ArrowSchema* schema);
+
+    /**
+     * Release the arrow batch unless it has been moved away, e.g. imported by the java side.
+     */
+    static void release_arrow_batch(ArrowArray* array, ArrowSchema* schema);
+
 protected:
     void _collect_profile_before_close() override;
 
@@ -312,6 +343,7 @@ private:
     jmethodID _jni_scanner_release_column = nullptr;
     jmethodID _jni_scanner_release_table = nullptr;
     jmethodID _jni_scanner_get_statistics = nullptr;
+    jmethodID _jni_scanner_get_next_arrow_batch = nullptr;
 
     TableMetaAddress _table_meta;
 
@@ -327,6 +359,14 @@ private:
 
     Status _fill_block(Block* block, size_t num_rows);
 
+    /**
+     * Call java side function JniScanner.getNextArrowBatch(long arrayAddress, long schemaAddress),
+     * which exports the next batch into the ArrowArray and ArrowSchema at the addresses and returns
+     * the number of rows, 0 if there's no data. The buffers of the batch are imported without copy,
+     * then converted into the columns of the block.
+     */
+    Status _get_next_arrow_block(JNIEnv* env, Block* block, size_t* read_rows, bool* eof);
+
     static Status _fill_column(TableMetaAddress& address, ColumnPtr& doris_column,
                                DataTypePtr& data_type, size_t num_rows);
 
@@ -37,15 +37,20 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
+#include "exec/olap_common.h"
 #include "exec/rowid_fetcher.h"
+#include "exprs/hybrid_set.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/fs/tracing_file_reader.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_group/workload_group_metrics.h"
 #include "util/runtime_profile.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/string_ref.h"
@@ -75,6 +80,7 @@
 #include "vec/exec/format/text/text_reader.h"
 #include "vec/exec/format/wal/wal_reader.h"
 #include "vec/exec/scan/scan_node.h"
+#include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vexpr_fwd.h"
@@ -110,6 +116,7 @@ FileScanner::FileScanner(
           _cur_reader(nullptr),
           _cur_reader_eof(false),
           _colname_to_value_range(colname_to_value_range),
+          _origin_colname_to_value_range(colname_to_value_range),
           _kv_cache(kv_cache),
           _strict_mode(false),
           _col_name_to_slot_id(colname_to_slot_id) {
@@ -162,6 +169,9 @@ Status FileScanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjun
     _runtime_filter_partition_pruned_range_counter =
             ADD_COUNTER_WITH_LEVEL(_local_state->scanner_profile(),
                                    "RuntimeFilterPartitionPrunedRangeNum", TUnit::UNIT, 1);
+    _runtime_filter_value_range_counter =
+            ADD_COUNTER_WITH_LEVEL(_local_state->scanner_profile(),
+                                   "RuntimeFilterConvertedToValueRangeNum", TUnit::UNIT, 1);
 
     _file_cache_statistics.reset(new io::FileCacheStatistics());
     _file_reader_stats.reset(new io::FileReaderStats());
@@ -348,6 +358,7 @@ Status FileScanner::_process_late_arrival_conjuncts() {
             RETURN_IF_ERROR(_conjuncts[i]->clone(_state, _push_down_conjuncts[i]));
         }
         RETURN_IF_ERROR(_process_conjuncts_for_dict_filter());
+        RETURN_IF_ERROR(_process_runtime_filters_value_range());
         _discard_conjuncts();
     }
     if (_applied_rf_num == _total_rf_num) {
@@ -356,6 +367,117 @@ Status FileScanner::_process_late_arrival_conjuncts() {
     return Status::OK();
 }
 
+namespace {
+// Narrow `range` by the IN or MINMAX predicate of a runtime filter, `applied` is set if the
+// predicate is converted.
+template <PrimitiveType T>
+Status narrow_value_range_by_runtime_filter(VExpr* expr, VExprContext* ctx, size_t max_in_num,
+                                            ColumnValueRange<T>& range, bool* applied) {
+    using CppType = typename ColumnValueRange<T>::CppType;
+    // DATE and DATETIME need to handle the loss of accuracy, leave them as they are.
+    if constexpr (T == TYPE_DATE || T == TYPE_DATETIME || T == TYPE_HLL || T == TYPE_BOOLEAN) {
+        return Status::OK();
+    } else {
+        if (expr->node_type() == TExprNodeType::IN_PRED) {
+            auto hybrid_set = expr->get_set_func();
+            if (hybrid_set == nullptr || static_cast<size_t>(hybrid_set->size()) > max_in_num) {
+                return Status::OK();
+            }
+            auto temp_range = ColumnValueRange<T>::create_empty_column_value_range(
+                    range.is_nullable_col(), range.precision(), range.scale());
+            auto* iter = hybrid_set->begin();
+            while (iter->has_next()) {
+                RETURN_IF_ERROR(temp_range.add_fixed_value(
+                        *reinterpret_cast<const CppType*>(iter->get_value())));
+                iter->next();
+            }
+            range.intersection(temp_range);
+            *applied = true;
+        } else if (expr->node_type() == TExprNodeType::BINARY_PRED &&
+                   expr->get_num_children() == 2) {
+            const auto& fn_name = assert_cast<VectorizedFnCall*>(expr)->fn().name.function_name;
+            if (fn_name != "ge" && fn_name != "le") {
+                return Status::OK();
+            }
+            std::shared_ptr<ColumnPtrWrapper> const_col_wrapper;
+            RETURN_IF_ERROR(expr->children()[1]->get_const_col(ctx, &const_col_wrapper));
+            const auto* const_column = const_col_wrapper == nullptr
+                                               ? nullptr
+                                               : check_and_get_column<ColumnConst>(
+                                                         const_col_wrapper->column_ptr.get());
+            if (const_column == nullptr) {
+                return Status::OK();
+            }
+            auto data = const_column->get_data_at(0);
+            if (data.data == nullptr) {
+                return Status::OK();
+            }
+            CppType value;
+            if constexpr (T == TYPE_CHAR || T == TYPE_VARCHAR || T == TYPE_STRING) {
+                value = data;
+            } else {
+                if (sizeof(CppType) != data.size) {
+                    return Status::InternalError(
+                            "PrimitiveType {} meet invalid input value size {}, expect size {}", T,
+                            data.size, sizeof(CppType));
+                }
+                memcpy(&value, data.data, sizeof(CppType));
+            }
+            RETURN_IF_ERROR(range.add_range(
+                    fn_name == "ge" ? FILTER_LARGER_OR_EQUAL : FILTER_LESS_OR_EQUAL, value));
+            *applied = true;
+        }
+        return Status::OK();
+    }
+}
+} // namespace
+
+// The runtime filters arriving after the scan operator normalized its conjuncts are only
+// evaluated row by row. Convert their IN and MINMAX predicates into value ranges, so that
+// parquet and orc readers can skip row groups, pages and stripes before reading them.
+Status FileScanner::_process_runtime_filters_value_range() {
+    if (!config::enable_runtime_filter_file_pruning || _origin_colname_to_value_range == nullptr) {
+        return Status::OK();
+    }
+    // The ranges may refer to the literals of the last pushed down conjuncts, rebuild them all.
+    _rf_colname_to_value_range = *_origin_colname_to_value_range;
+    _colname_to_value_range = _origin_colname_to_value_range;
+    // Same as the default limit of scan operator.
+    size_t max_in_num = 1024;
+    if (_state->query_options().__isset.max_pushdown_conditions_per_column) {
+        max_in_num = static_cast<size_t>(
+                _state->query_options().max_pushdown_conditions_per_column);
+    }
+    int64_t converted = 0;
+    for (const auto& conjunct : _push_down_conjuncts) {
+        if (!conjunct->root()->is_rf_wrapper()) {
+            continue;
+        }
+        auto impl = conjunct->root()->get_impl();
+        if (impl == nullptr || impl->children().empty() ||
+            impl->children()[0]->node_type() != TExprNodeType::SLOT_REF) {
+            continue;
+        }
+        auto iter = _rf_colname_to_value_range.find(impl->children()[0]->expr_name());
+        if (iter == _rf_colname_to_value_range.end()) {
+            continue;
+        }
+        bool applied = false;
+        RETURN_IF_ERROR(std::visit(
+                [&](auto& range) {
+                    return narrow_value_range_by_runtime_filter(impl.get(), conjunct.get(),
+                                                                max_in_num, range, &applied);
+                },
+                iter->second));
+        converted += applied;
+    }
+    if (converted > 0) {
+        _colname_to_value_range = &_rf_colname_to_value_range;
+        COUNTER_UPDATE(_runtime_filter_value_range_counter, converted);
+    }
+    return Status::OK();
+}
+
 void FileScanner::_get_slot_ids(VExpr* expr, std::vector<int>* slot_ids) {
     for (auto& child_expr : expr->children()) {
         if (child_expr->is_slot_ref()) {
@@ -1029,7 +1151,9 @@ Status FileScanner::_get_next_reader() {
         case TFileFormatType::FORMAT_ORC: {
             std::unique_ptr<OrcReader> orc_reader = OrcReader::create_unique(
                     _profile, _state, *_params, range, _state->query_options().batch_size,
-                    _state->timezone(), _io_ctx.get(), _state->query_options().enable_orc_lazy_mat);
+                    _state->timezone(), _io_ctx.get(), _state->query_options().enable_orc_lazy_mat,
+                    _should_enable_file_meta_cache() ? ExecEnv::GetInstance()->file_meta_cache()
+                                                     : nullptr);
             if (_row_id_column_iterator_pair.second != -1) {
                 RETURN_IF_ERROR(_create_row_id_column_iterator());
                 orc_reader->set_row_id_column_iterator(_row_id_column_iterator_pair);
@@ -1148,7 +1272,9 @@ Status FileScanner::_init_parquet_reader(std::unique_ptr<ParquetReader>&& parque
     } else if (range.__isset.table_format_params &&
                range.table_format_params.table_format_type == "paimon") {
         std::unique_ptr<PaimonParquetReader> paimon_reader = PaimonParquetReader::create_unique(
-                std::move(parquet_reader), _profile, _state, *_params, range, _io_ctx.get());
+                std::move(parquet_reader), _profile, _state, *_params, range, _io_ctx.get(),
+                _should_enable_file_meta_cache() ? ExecEnv::GetInstance()->file_meta_cache()
+                                                 : nullptr);
         init_status = paimon_reader->init_reader(
                 _file_col_names, _colname_to_value_range, _push_down_conjuncts, _real_tuple_desc,
                 _default_val_row_desc.get(), _col_name_to_slot_id,
@@ -1251,7 +1377,9 @@ Status FileScanner::_init_orc_reader(std::unique_ptr<OrcReader>&& orc_reader) {
     } else if (range.__isset.table_format_params &&
                range.table_format_params.table_format_type == "paimon") {
         std::unique_ptr<PaimonOrcReader> paimon_reader = PaimonOrcReader::create_unique(
-                std::move(orc_reader), _profile, _state, *_params, range, _io_ctx.get());
+                std::move(orc_reader), _profile, _state, *_params, range, _io_ctx.get(),
+                _should_enable_file_meta_cache() ? ExecEnv::GetInstance()->file_meta_cache()
+                                                 : nullptr);
 
         init_status = paimon_reader->init_reader(
                 _file_col_names, _colname_to_value_range, _push_down_conjuncts, _real_tuple_desc,
@@ -1418,9 +1546,12 @@ Status FileScanner::read_lines_from_range(const TFileRangeDesc& range,
                 }
                 case TFileFormatType::FORMAT_ORC: {
                     std::unique_ptr<vectorized::OrcReader> orc_reader =
-                            vectorized::OrcReader::create_unique(_profile, _state, *_params, range,
-                                                                 1, _state->timezone(),
-                                                                 _io_ctx.get(), false);
+                            vectorized::OrcReader::create_unique(
+                                    _profile, _state, *_params, range, 1, _state->timezone(),
+                                    _io_ctx.get(), false,
+                                    external_info.enable_file_meta_cache
+                                            ? ExecEnv::GetInstance()->file_meta_cache()
+                                            : nullptr);
 
                     RETURN_IF_ERROR(orc_reader->set_read_lines_mode(row_ids));
                     RETURN_IF_ERROR(_init_orc_reader(std::move(orc_reader)));
@@ -1688,6 +1819,9 @@ void FileScanner::_collect_profile_before_close() {
         io::FileCacheProfileReporter cache_profile(_profile);
         cache_profile.update(_file_cache_statistics.get());
     }
+    if (auto wg = _state->get_query_ctx()->workload_group(); wg && wg->get_metrics()) {
+        wg->get_metrics()->update_scan_io_stats(*_file_cache_statistics, 0);
+    }
 
     if (_cur_reader != nullptr) {
         _cur_reader->collect_profile_before_close();
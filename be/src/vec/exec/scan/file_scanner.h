@@ -126,6 +126,11 @@ protected:
     std::unique_ptr<GenericReader> _cur_reader;
     bool _cur_reader_eof = false;
     const std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // The value ranges normalized by scan operator, and the ones narrowed by late-arrival
+    // runtime filters. _colname_to_value_range points to one of them.
+    const std::unordered_map<std::string, ColumnValueRangeType>* _origin_colname_to_value_range =
+            nullptr;
+    std::unordered_map<std::string, ColumnValueRangeType> _rf_colname_to_value_range;
     // File source slot descriptors
     std::vector<SlotDescriptor*> _file_slot_descs;
     // col names from _file_slot_descs
@@ -211,6 +216,7 @@ private:
     RuntimeProfile::Counter* _file_read_calls_counter = nullptr;
     RuntimeProfile::Counter* _file_read_time_counter = nullptr;
     RuntimeProfile::Counter* _runtime_filter_partition_pruned_range_counter = nullptr;
+    RuntimeProfile::Counter* _runtime_filter_value_range_counter = nullptr;
 
     const std::unordered_map<std::string, int>* _col_name_to_slot_id = nullptr;
     // single slot filter conjuncts
@@ -249,6 +255,7 @@ private:
     Status _process_runtime_filters_partition_prune(bool& is_partition_pruned);
     Status _process_conjuncts_for_dict_filter();
     Status _process_late_arrival_conjuncts();
+    Status _process_runtime_filters_value_range();
     void _get_slot_ids(VExpr* expr, std::vector<int>* slot_ids);
     Status _generate_truncate_columns(bool need_to_get_parsed_schema);
     Status _set_fill_or_truncate_columns(bool need_to_get_parsed_schema);
@@ -281,11 +288,12 @@ private:
     int64_t _get_push_down_count() { return _local_state->get_push_down_count(); }
 
     // enable the file meta cache only when
-    // 1. max_external_file_meta_cache_num is > 0
+    // 1. max_external_file_meta_cache_num and max_external_file_meta_cache_bytes are > 0
     // 2. the file number is less than 1/3 of cache's capacibility
     // Otherwise, the cache miss rate will be high
     bool _should_enable_file_meta_cache() {
         return config::max_external_file_meta_cache_num > 0 &&
+               config::max_external_file_meta_cache_bytes > 0 &&
                _split_source->num_scan_ranges() < config::max_external_file_meta_cache_num / 3;
     }
 };
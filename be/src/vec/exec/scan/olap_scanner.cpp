@@ -44,6 +44,7 @@
 #include "olap/inverted_index_profile.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
+#include "olap/parallel_scan_split_source.h"
 #include "olap/schema_cache.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
@@ -51,6 +52,8 @@
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_group/workload_group_metrics.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
@@ -83,6 +86,7 @@ OlapScanner::OlapScanner(pipeline::ScanLocalStateBase* parent, OlapScanner::Para
                   .function_filters {},
                   .delete_predicates {},
                   .target_cast_type_for_variants {},
+                  .struct_read_sub_columns {},
                   .rs_splits {},
                   .return_columns {},
                   .output_columns {},
@@ -94,7 +98,8 @@ OlapScanner::OlapScanner(pipeline::ScanLocalStateBase* parent, OlapScanner::Para
                   .virtual_column_exprs {},
                   .vir_cid_to_idx_in_block {},
                   .vir_col_idx_to_type {},
-          }) {
+          }),
+          _split_source(std::move(params.split_source)) {
     _tablet_reader_params.set_read_source(std::move(params.read_source));
     _is_init = false;
 }
@@ -191,7 +196,7 @@ Status OlapScanner::init() {
             }
         }
 
-        if (_tablet_reader_params.rs_splits.empty()) {
+        if (_tablet_reader_params.rs_splits.empty() && _split_source == nullptr) {
             // Non-pipeline mode, Tablet : Scanner = 1 : 1
             // acquire tablet rowset readers at the beginning of the scan node
             // to prevent this case: when there are lots of olap scanners to run for example 10000
@@ -244,6 +249,11 @@ Status OlapScanner::open(RuntimeState* state) {
     RETURN_IF_ERROR(Scanner::open(state));
     SCOPED_TIMER(_local_state->cast<pipeline::OlapScanLocalState>()._reader_init_timer);
 
+    if (_split_source != nullptr) {
+        // If all the rows are taken by the other scanners, this scanner ends at once.
+        return _init_next_split(&_split_source_exhausted);
+    }
+
     auto res = _tablet_reader->init(_tablet_reader_params);
     if (!res.ok()) {
         std::stringstream ss;
@@ -419,6 +429,13 @@ Status OlapScanner::_init_tablet_reader_params(
         }
     }
 
+    _register_reading_rowsets();
+
+    return Status::OK();
+}
+
+void OlapScanner::_register_reading_rowsets() {
+    const auto& tablet_schema = _tablet_reader_params.tablet_schema;
     // If this is a Two-Phase read query, and we need to delay the release of Rowset
     // by rowset->update_delayed_expired_timestamp().This could expand the lifespan of Rowset
     if (tablet_schema->field_index(BeConsts::ROWID_COL) >= 0) {
@@ -440,6 +457,29 @@ Status OlapScanner::_init_tablet_reader_params(
             id_file_map->add_temp_rowset(rs_reader.rs_reader->rowset());
         }
     }
+}
+
+Status OlapScanner::_init_next_split(bool* eof) {
+    SCOPED_RAW_TIMER(&_split_scan_ns);
+    ReadSource read_source;
+    *eof = !_split_source->next_split(&read_source, &_split_rows);
+    if (*eof) {
+        return Status::OK();
+    }
+    _tablet_reader_params.set_read_source(std::move(read_source));
+    _register_reading_rowsets();
+
+    auto res = _tablet_reader->init(_tablet_reader_params);
+    if (!res.ok()) {
+        std::stringstream ss;
+        ss << "failed to initialize storage reader. tablet="
+           << _tablet_reader_params.tablet->tablet_id() << ", res=" << res
+           << ", backend=" << BackendOptions::get_localhost();
+        return Status::InternalError(ss.str());
+    }
+
+    // Do not hold rs_splits any more to release memory.
+    _tablet_reader_params.rs_splits.clear();
 
     return Status::OK();
 }
@@ -506,6 +546,12 @@ Status OlapScanner::_init_return_columns() {
                     _vir_col_idx_to_type[idx_in_block]->get_name());
         }
 
+        // a struct slot with a column path only reads the sub column of the first path element
+        if (slot->type()->get_primitive_type() == PrimitiveType::TYPE_STRUCT &&
+            !slot->column_paths().empty()) {
+            _tablet_reader_params.struct_read_sub_columns[index] = {slot->column_paths()[0]};
+        }
+
         _return_columns.push_back(index);
         if (slot->is_nullable() && !tablet_schema->column(index).is_nullable()) {
             _tablet_columns_convert_to_null_set.emplace(index);
@@ -544,13 +590,32 @@ doris::TabletStorageType OlapScanner::get_storage_type() {
 }
 
 Status OlapScanner::_get_block_impl(RuntimeState* state, Block* block, bool* eof) {
+    if (_split_source_exhausted) {
+        *eof = true;
+        return Status::OK();
+    }
     // Read one block from block reader
     // ATTN: Here we need to let the _get_block_impl method guarantee the semantics of the interface,
     // that is, eof can be set to true only when the returned block is empty.
-    RETURN_IF_ERROR(_tablet_reader->next_block_with_aggregation(block, eof));
+    {
+        SCOPED_RAW_TIMER(&_split_scan_ns);
+        RETURN_IF_ERROR(_tablet_reader->next_block_with_aggregation(block, eof));
+    }
     if (block->rows() > 0) {
         _tablet_reader_params.tablet->read_block_count.fetch_add(1, std::memory_order_relaxed);
         *eof = false;
+    } else if (*eof && _split_source != nullptr && !_should_stop) {
+        // The split is read, take the next one with a new tablet reader. The returned block is
+        // empty and not eof, so the caller reads again.
+        _split_source->finish_split(_split_rows, _split_scan_ns);
+        _split_rows = 0;
+        _split_scan_ns = 0;
+        update_realtime_counters();
+        _update_counters_by_stats(_tablet_reader->stats());
+        _tablet_reader = std::make_unique<BlockReader>();
+        _tablet_reader->set_batch_size(_state->batch_size());
+        RETURN_IF_ERROR(_init_next_split(&_split_source_exhausted));
+        *eof = _split_source_exhausted;
     }
     return Status::OK();
 }
@@ -621,7 +686,20 @@ void OlapScanner::_collect_profile_before_close() {
 
     // Update counters for OlapScanner
     // Update counters from tablet reader's stats
-    auto& stats = _tablet_reader->stats();
+    _update_counters_by_stats(_tablet_reader->stats());
+
+    // Update metrics
+    auto* local_state = (pipeline::OlapScanLocalState*)_local_state;
+    DorisMetrics::instance()->query_scan_bytes->increment(
+            local_state->_read_uncompressed_counter->value());
+    DorisMetrics::instance()->query_scan_rows->increment(local_state->_scan_rows->value());
+    auto& tablet = _tablet_reader_params.tablet;
+    tablet->query_scan_bytes->increment(local_state->_read_uncompressed_counter->value());
+    tablet->query_scan_rows->increment(local_state->_scan_rows->value());
+    tablet->query_scan_count->increment(1);
+}
+
+void OlapScanner::_update_counters_by_stats(const OlapReaderStatistics& stats) {
     auto* local_state = (pipeline::OlapScanLocalState*)_local_state;
     COUNTER_UPDATE(local_state->_io_timer, stats.io_ns);
     COUNTER_UPDATE(local_state->_read_compressed_counter, stats.compressed_bytes_read);
@@ -680,6 +758,9 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_key_range_filtered_counter, stats.rows_key_range_filtered);
     COUNTER_UPDATE(local_state->_total_pages_num_counter, stats.total_pages_num);
     COUNTER_UPDATE(local_state->_cached_pages_num_counter, stats.cached_pages_num);
+    COUNTER_UPDATE(local_state->_cached_pages_bytes_counter, stats.cached_pages_bytes);
+    COUNTER_UPDATE(local_state->_page_prefetch_hit_counter, stats.page_prefetch_hit_num);
+    COUNTER_UPDATE(local_state->_page_prefetch_miss_counter, stats.page_prefetch_miss_num);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_counter, stats.rows_bitmap_index_filtered);
     COUNTER_UPDATE(local_state->_bitmap_index_filter_timer, stats.bitmap_index_filter_timer);
     COUNTER_UPDATE(local_state->_inverted_index_filter_counter, stats.rows_inverted_index_filtered);
@@ -712,9 +793,11 @@ void OlapScanner::_collect_profile_before_close() {
     inverted_index_profile.update(local_state->_index_filter_profile.get(),
                                   &stats.inverted_index_stats);
 
-    if (config::enable_file_cache) {
-        io::FileCacheProfileReporter cache_profile(local_state->_segment_profile.get());
-        cache_profile.update(&stats.file_cache_stats);
+    // The reads of the segments on the local disks are reported even without the file cache.
+    io::FileCacheProfileReporter cache_profile(local_state->_segment_profile.get());
+    cache_profile.update(&stats.file_cache_stats);
+    if (auto wg = _state->get_query_ctx()->workload_group(); wg && wg->get_metrics()) {
+        wg->get_metrics()->update_scan_io_stats(stats.file_cache_stats, stats.cached_pages_bytes);
     }
     COUNTER_UPDATE(local_state->_output_index_result_column_timer,
                    stats.output_index_result_column_timer);
@@ -761,15 +844,6 @@ void OlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(local_state->_segment_create_column_readers_timer,
                    stats.segment_create_column_readers_timer_ns);
     COUNTER_UPDATE(local_state->_segment_load_index_timer, stats.segment_load_index_timer_ns);
-
-    // Update metrics
-    DorisMetrics::instance()->query_scan_bytes->increment(
-            local_state->_read_uncompressed_counter->value());
-    DorisMetrics::instance()->query_scan_rows->increment(local_state->_scan_rows->value());
-    auto& tablet = _tablet_reader_params.tablet;
-    tablet->query_scan_bytes->increment(local_state->_read_uncompressed_counter->value());
-    tablet->query_scan_rows->increment(local_state->_scan_rows->value());
-    tablet->query_scan_count->increment(1);
 }
 
 } // namespace doris::vectorized
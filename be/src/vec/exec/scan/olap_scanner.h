@@ -44,6 +44,7 @@ namespace doris {
 
 struct OlapScanRange;
 class FunctionFilter;
+class ParallelScanSplitSource;
 class RuntimeProfile;
 class RuntimeState;
 class TPaloScanRange;
@@ -69,6 +70,8 @@ public:
         TabletReader::ReadSource read_source;
         int64_t limit;
         bool aggregation;
+        // If set, the rows are taken from it split by split instead of `read_source`.
+        std::shared_ptr<ParallelScanSplitSource> split_source;
     };
 
     OlapScanner(pipeline::ScanLocalStateBase* parent, Params&& params);
@@ -93,6 +96,16 @@ private:
                                       const pipeline::FilterPredicates& filter_predicates,
                                       const std::vector<FunctionFilter>& function_filters);
 
+    // Keeps the rowsets of `_tablet_reader_params.rs_splits` alive for the two-phase read and
+    // the global row id.
+    void _register_reading_rowsets();
+
+    // Takes the next split of `_split_source` and initializes a new tablet reader for it,
+    // `*eof` is set if all the rows are taken.
+    Status _init_next_split(bool* eof);
+
+    void _update_counters_by_stats(const OlapReaderStatistics& stats);
+
     [[nodiscard]] Status _init_return_columns();
     [[nodiscard]] Status _init_variant_columns();
 
@@ -101,6 +114,12 @@ private:
     TabletReader::ReaderParams _tablet_reader_params;
     std::unique_ptr<TabletReader> _tablet_reader;
 
+    std::shared_ptr<ParallelScanSplitSource> _split_source;
+    // The rows of the current split and the time spent on it.
+    size_t _split_rows = 0;
+    int64_t _split_scan_ns = 0;
+    bool _split_source_exhausted = false;
+
 public:
     std::vector<ColumnId> _return_columns;
 
@@ -27,6 +27,7 @@
 #include "vec/columns/column_nothing.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/exec/scan/scan_node.h"
+#include "vec/exprs/vcommon_subexpr_ref.h"
 #include "vec/exprs/vexpr_context.h"
 
 namespace doris::vectorized {
@@ -56,6 +57,7 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
         for (size_t i = 0; i != projections.size(); ++i) {
             RETURN_IF_ERROR(projections[i]->clone(state, _projections[i]));
         }
+        VCommonSubexprRef::share_results(_projections);
     }
 
     const auto& intermediate_projections = _local_state->_intermediate_projections;
@@ -67,6 +69,7 @@ Status Scanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts)
                 RETURN_IF_ERROR(intermediate_projections[i][j]->clone(
                         state, _intermediate_projections[i][j]));
             }
+            VCommonSubexprRef::share_results(_intermediate_projections[i]);
         }
     }
 
@@ -173,6 +176,7 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
         }
+        VCommonSubexprRef::reset_results(projections);
         input_block.shuffle_columns(result_column_ids);
     }
 
@@ -198,6 +202,7 @@ Status Scanner::_do_projections(vectorized::Block* origin_block, vectorized::Blo
             mutable_columns[i]->insert_range_from(*column_ptr, 0, rows);
         }
     }
+    VCommonSubexprRef::reset_results(_projections);
     DCHECK(mutable_block.rows() == rows);
     output_block->set_columns(std::move(mutable_columns));
 
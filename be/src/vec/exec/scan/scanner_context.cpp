@@ -40,11 +40,14 @@
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "runtime/workload_group/workload_group.h"
+#include "runtime/workload_group/workload_group_metrics.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 #include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
+#include "vec/exec/executor/time_sharing/time_sharing_task_handle.h"
 #include "vec/exec/scan/scan_node.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 
@@ -123,6 +126,22 @@ Status ScannerContext::init() {
                 task_id, []() { return 0.0; },
                 config::task_executor_initial_max_concurrency_per_task,
                 std::chrono::milliseconds(100), std::nullopt));
+        auto time_sharing_handle =
+                std::dynamic_pointer_cast<vectorized::TimeSharingTaskHandle>(_task_handle);
+        if (auto wg = _state->get_query_ctx()->workload_group(); wg && time_sharing_handle) {
+            std::weak_ptr<WorkloadGroup> wg_weak = wg;
+            time_sharing_handle->set_workload_group(
+                    wg->id(),
+                    [wg_weak]() {
+                        auto wg_ptr = wg_weak.lock();
+                        return wg_ptr ? wg_ptr->cpu_share() : 0;
+                    },
+                    [metrics = wg->get_metrics()](int64_t delta_nanos) {
+                        if (metrics) {
+                            metrics->update_scan_split_scheduled_time_nanos(delta_nanos);
+                        }
+                    });
+        }
     }
 #endif
     // _max_bytes_in_queue controls the maximum memory that can be used by a single scan operator.
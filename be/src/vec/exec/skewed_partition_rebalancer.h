@@ -81,6 +81,10 @@ public:
                               long min_data_processed_rebalance_threshold);
 
     int get_task_id(int partition_id, int64_t index);
+    // Number of tasks the partition is currently spread over.
+    int get_task_count(int partition_id) const {
+        return static_cast<int>(_partition_assignments[partition_id].size());
+    }
     void add_data_processed(long data_size);
     void add_partition_row_count(int partition, long row_count);
     void rebalance();
@@ -19,6 +19,7 @@
 #include <vec/exprs/vcolumn_ref.h>
 #include <vec/exprs/vslot_ref.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -44,26 +45,6 @@ namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 class VExprContext;
 
-// extend a block with all required parameters
-struct LambdaArgs {
-    // the lambda function need the column ids of all the slots
-    std::vector<int> output_slot_ref_indexs;
-    // which line is extended to the original block
-    int64_t current_row_idx = 0;
-    // when a block is filled, the array may be truncated, recording where it was truncated
-    int64_t current_offset_in_array = 0;
-    // the beginning position of the array
-    size_t array_start = 0;
-    // the size of the array
-    int64_t cur_size = 0;
-    // offset of column array
-    const ColumnArray::Offsets64* offsets_ptr = nullptr;
-    // expend data of repeat times
-    int current_repeat_times = 0;
-    // whether the current row of the original block has been extended
-    bool current_row_eos = false;
-};
-
 class ArrayMapFunction : public LambdaFunction {
     ENABLE_FACTORY_CREATOR(ArrayMapFunction);
 
@@ -78,9 +59,8 @@ public:
 
     Status execute(VExprContext* context, vectorized::Block* block, int* result_column_id,
                    const DataTypePtr& result_type, const VExprSPtrs& children) override {
-        LambdaArgs args_info;
         // collect used slot ref in lambda function body
-        std::vector<int>& output_slot_ref_indexs = args_info.output_slot_ref_indexs;
+        std::vector<int> output_slot_ref_indexs;
         _collect_slot_ref_column_id(children[0], output_slot_ref_indexs);
 
         int gap = 0;
@@ -161,7 +141,6 @@ public:
                 const auto& off_data = assert_cast<const ColumnArray::ColumnOffsets&>(
                         col_array.get_offsets_column());
                 array_column_offset = off_data.clone_resized(col_array.get_offsets_column().size());
-                args_info.offsets_ptr = &col_array.get_offsets();
             } else {
                 // select array_map((x,y)->x+y,c_array1,[0,1,2,3]) from array_test2;
                 // c_array1: [0,1,2,3,4,5,6,7,8,9]
@@ -222,10 +201,20 @@ public:
         DataTypePtr res_type;
         std::string res_name;
 
-        //process first row
-        args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
-        args_info.cur_size =
-                (*args_info.offsets_ptr)[args_info.current_row_idx] - args_info.array_start;
+        // The captured columns are gathered by the outer rows of the elements, except the const
+        // ones, which are broadcast as const columns.
+        std::vector<ColumnPtr> captured_columns(gap);
+        bool gather_captured = false;
+        for (int i : output_slot_ref_indexs) {
+            captured_columns[i] = block->get_by_position(i).column;
+            gather_captured |= !is_column_const(*captured_columns[i]);
+        }
+        const auto& first_offsets =
+                assert_cast<const ColumnArray::ColumnOffsets&>(*first_array_offsets).get_data();
+        // the outer rows of the elements of the current batch
+        PaddedPODArray<uint32_t> element_rows;
+        size_t element_begin = 0;
+        size_t row = 0;
 
         // lambda block to exectute the lambda, and reuse the memory
         Block lambda_block;
@@ -236,48 +225,43 @@ public:
             for (int i = 0; i < column_size; i++) {
                 if (mem_reuse) {
                     columns[i] = lambda_block.get_by_position(i).column->assume_mutable();
+                } else if (i >= gap || (captured_columns[i] != nullptr &&
+                                        !is_column_const(*captured_columns[i]))) {
+                    columns[i] = data_types[i]->create_column();
+                } else if (captured_columns[i] != nullptr) {
+                    columns[i] = captured_columns[i]->clone_resized(0);
                 } else {
-                    if (_contains_column_id(output_slot_ref_indexs, i) || i >= gap) {
-                        // TODO: maybe could create const column, so not insert_many_from when extand data
-                        // but now here handle batch_size of array nested data every time, so maybe have different rows
-                        columns[i] = data_types[i]->create_column();
-                    } else {
-                        columns[i] = data_types[i]
-                                             ->create_column_const_with_default_value(0)
-                                             ->assume_mutable();
-                    }
+                    // padding some mock data to hold the position
+                    columns[i] = data_types[i]
+                                         ->create_column_const_with_default_value(0)
+                                         ->assume_mutable();
                 }
             }
-            // batch_size of array nested data every time inorder to avoid memory overflow
-            while (columns[gap]->size() < batch_size) {
-                long max_step = batch_size - columns[gap]->size();
-                long current_step = std::min(
-                        max_step, (long)(args_info.cur_size - args_info.current_offset_in_array));
-                size_t pos = args_info.array_start + args_info.current_offset_in_array;
-                for (int i = 0; i < arguments.size() && current_step > 0; ++i) {
-                    columns[gap + i]->insert_range_from(*lambda_datas[i], pos, current_step);
-                }
-                args_info.current_offset_in_array += current_step;
-                args_info.current_repeat_times += current_step;
-                if (args_info.current_offset_in_array >= args_info.cur_size) {
-                    args_info.current_row_eos = true;
-                }
-                _extend_data(columns, block, args_info.current_repeat_times, gap,
-                             args_info.current_row_idx, output_slot_ref_indexs);
-                args_info.current_repeat_times = 0;
-                if (args_info.current_row_eos) {
-                    //current row is end of array, move to next row
-                    args_info.current_row_idx++;
-                    args_info.current_offset_in_array = 0;
-                    if (args_info.current_row_idx >= block->rows()) {
-                        break;
+            // batch_size of array nested data every time inorder to avoid memory overflow, the
+            // batch may span many rows
+            const size_t step =
+                    std::min<size_t>(batch_size, nested_array_column_rows - element_begin);
+            for (int i = 0; i < arguments.size(); ++i) {
+                columns[gap + i]->insert_range_from(*lambda_datas[i], element_begin, step);
+            }
+            if (gather_captured) {
+                element_rows.resize(step);
+                for (size_t j = 0; j < step; ++j) {
+                    while (first_offsets[row] <= element_begin + j) {
+                        ++row;
                     }
-                    args_info.current_row_eos = false;
-                    args_info.array_start = (*args_info.offsets_ptr)[args_info.current_row_idx - 1];
-                    args_info.cur_size = (*args_info.offsets_ptr)[args_info.current_row_idx] -
-                                         args_info.array_start;
+                    element_rows[j] = cast_set<uint32_t>(row);
                 }
             }
+            for (int i = 0; i < gap; ++i) {
+                if (is_column_const(*columns[i])) {
+                    columns[i]->resize(columns[i]->size() + step);
+                } else {
+                    columns[i]->insert_indices_from(*captured_columns[i], element_rows.data(),
+                                                    element_rows.data() + step);
+                }
+            }
+            element_begin += step;
 
             if (!mem_reuse) {
                 for (int i = 0; i < column_size; ++i) {
@@ -294,10 +278,11 @@ public:
             res_name = lambda_block.get_by_position(*result_column_id).name;
             if (!result_col) {
                 result_col = res_col->clone_empty();
+                result_col->reserve(nested_array_column_rows);
             }
             result_col->insert_range_from(*res_col, 0, res_col->size());
             lambda_block.clear_column_data(column_size);
-        } while (args_info.current_row_idx < block->rows());
+        } while (element_begin < nested_array_column_rows);
 
         //4. get the result column after execution, reassemble it into a new array column, and return.
         if (result_type->is_nullable()) {
@@ -366,25 +351,6 @@ private:
             }
         }
     }
-
-    void _extend_data(std::vector<MutableColumnPtr>& columns, Block* block,
-                      int current_repeat_times, int size, int64_t current_row_idx,
-                      const std::vector<int>& output_slot_ref_indexs) {
-        if (!current_repeat_times || !size) {
-            return;
-        }
-        for (int i = 0; i < size; i++) {
-            if (_contains_column_id(output_slot_ref_indexs, i)) {
-                auto src_column =
-                        block->get_by_position(i).column->convert_to_full_column_if_const();
-                columns[i]->insert_many_from(*src_column, current_row_idx, current_repeat_times);
-            } else {
-                // must be column const
-                DCHECK(is_column_const(*columns[i]));
-                columns[i]->resize(columns[i]->size() + current_repeat_times);
-            }
-        }
-    }
 };
 
 void register_function_array_map(doris::vectorized::LambdaFunctionFactory& factory) {
@@ -20,7 +20,10 @@
 #include <fmt/core.h>
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
+#include "common/exception.h"
 #include "common/status.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_context.h"
@@ -58,6 +61,19 @@ public:
     virtual void get_same_many_values(MutableColumnPtr& column, int length = 0) = 0;
     virtual int get_value(MutableColumnPtr& column, int max_step) = 0;
 
+    // Whether get_values_of_rows is implemented, then the results of many child rows can be
+    // appended at once instead of row by row with process_row and get_value.
+    virtual bool support_get_values_of_rows() const { return false; }
+
+    // Appends all the results of the child rows from `row_idx` on, stopping before `end_row` or
+    // the first row whose results do not fit in `max_step`. The child row of every appended
+    // result is pushed into `child_rows`. Returns the index of the first unprocessed row.
+    virtual size_t get_values_of_rows(MutableColumnPtr& column, size_t row_idx, size_t end_row,
+                                      size_t max_step, std::vector<uint32_t>& child_rows) {
+        throw doris::Exception(ErrorCode::NOT_IMPLEMENTED_ERROR,
+                               "get_values_of_rows is not supported by {}", _fn_name);
+    }
+
     virtual Status close() { return Status::OK(); }
 
     virtual void forward(int step = 1) {
@@ -73,6 +89,8 @@ public:
 
     std::string name() const { return _fn_name; }
     bool eos() const { return _eos; }
+    // true if no result of the current row has been read yet.
+    bool at_row_begin() const { return !_eos && _cur_offset == 0; }
 
     void set_expr_context(const VExprContextSPtr& expr_context) { _expr_context = expr_context; }
     void set_nullable() { _is_nullable = true; }
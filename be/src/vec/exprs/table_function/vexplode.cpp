@@ -132,23 +132,60 @@ int VExplodeTableFunction::get_value(MutableColumnPtr& column, int max_step) {
         column->insert_default();
         max_step = 1;
     } else {
-        if (_is_nullable) {
-            auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
-            auto nested_column = nullable_column->get_nested_column_ptr();
-            auto* nullmap_column =
-                    assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
-            nested_column->insert_range_from(*_detail.nested_col, pos, max_step);
-            size_t old_size = nullmap_column->size();
-            nullmap_column->resize(old_size + max_step);
-            memcpy(nullmap_column->get_data().data() + old_size,
-                   _detail.nested_nullmap_data + pos * sizeof(UInt8), max_step * sizeof(UInt8));
-        } else {
-            column->insert_range_from(*_detail.nested_col, pos, max_step);
-        }
+        _insert_values(column, pos, max_step);
     }
     forward(max_step);
     return max_step;
 }
 
+size_t VExplodeTableFunction::get_values_of_rows(MutableColumnPtr& column, size_t row_idx,
+                                                 size_t end_row, size_t max_step,
+                                                 std::vector<uint32_t>& child_rows) {
+    const auto& offsets = *_detail.offsets_ptr;
+    // the values of adjacent arrays are adjacent in the nested column, so they are appended
+    // by one range until an outer empty row or a null row breaks it.
+    size_t range_begin = offsets[row_idx - 1];
+    size_t range_end = range_begin;
+    for (; row_idx < end_row; ++row_idx) {
+        bool is_null = _detail.array_nullmap_data && _detail.array_nullmap_data[row_idx];
+        size_t size = is_null ? 0 : offsets[row_idx] - offsets[row_idx - 1];
+        size_t num_results = size == 0 && _is_outer ? 1 : size;
+        if (child_rows.size() + num_results > max_step) {
+            break;
+        }
+        if (size == 0 && (is_null || _is_outer)) {
+            _insert_values(column, range_begin, range_end - range_begin);
+            if (_is_outer) {
+                column->insert_default();
+            }
+            range_begin = range_end = offsets[row_idx];
+        } else {
+            range_end += size;
+        }
+        child_rows.insert(child_rows.end(), num_results, static_cast<uint32_t>(row_idx));
+    }
+    _insert_values(column, range_begin, range_end - range_begin);
+    return row_idx;
+}
+
+void VExplodeTableFunction::_insert_values(MutableColumnPtr& column, size_t pos, size_t length) {
+    if (length == 0) {
+        return;
+    }
+    if (_is_nullable) {
+        auto* nullable_column = assert_cast<ColumnNullable*>(column.get());
+        auto nested_column = nullable_column->get_nested_column_ptr();
+        auto* nullmap_column =
+                assert_cast<ColumnUInt8*>(nullable_column->get_null_map_column_ptr().get());
+        nested_column->insert_range_from(*_detail.nested_col, pos, length);
+        size_t old_size = nullmap_column->size();
+        nullmap_column->resize(old_size + length);
+        memcpy(nullmap_column->get_data().data() + old_size,
+               _detail.nested_nullmap_data + pos * sizeof(UInt8), length * sizeof(UInt8));
+    } else {
+        column->insert_range_from(*_detail.nested_col, pos, length);
+    }
+}
+
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
@@ -45,9 +45,14 @@ public:
     void process_close() override;
     void get_same_many_values(MutableColumnPtr& column, int length) override;
     int get_value(MutableColumnPtr& column, int max_step) override;
+    bool support_get_values_of_rows() const override { return true; }
+    size_t get_values_of_rows(MutableColumnPtr& column, size_t row_idx, size_t end_row,
+                              size_t max_step, std::vector<uint32_t>& child_rows) override;
 
 private:
     Status _process_init_variant(Block* block, int value_column_idx);
+    // appends the nested values [pos, pos + length) into the result column.
+    void _insert_values(MutableColumnPtr& column, size_t pos, size_t length);
     ColumnPtr _array_column;
     ColumnArrayExecutionData _detail;
     size_t _array_offset; // start offset of array[row_idx]
@@ -20,17 +20,29 @@
 #include <gen_cpp/Exprs_types.h>
 #include <gen_cpp/Types_types.h>
 
+#include <algorithm>
 #include <ostream>
+#include <typeinfo>
 
 #include "common/status.h"
 #include "runtime/runtime_state.h"
+#include "util/simd/bits.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
 #include "vec/core/block.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vcast_expr.h"
+#include "vec/exprs/vcompound_pred.h"
+#include "vec/exprs/vectorized_fn_call.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vin_predicate.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/functions/simple_function_factory.h"
 
 namespace doris {
@@ -41,6 +53,33 @@ class RuntimeState;
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+namespace {
+
+// Collects the columns read by the expr. Returns false if the expr can not be executed on a part
+// of the rows of a block, i.e. it reads the block other than by slot refs.
+bool collect_input_columns(const VExprSPtr& expr, std::vector<int>* column_ids,
+                           bool* calls_function) {
+    const VExpr& node = *expr;
+    if (typeid(node) == typeid(VSlotRef)) {
+        column_ids->push_back(static_cast<const VSlotRef&>(node).column_id());
+        return true;
+    }
+    if (dynamic_cast<const VLiteral*>(&node) != nullptr) {
+        return true;
+    }
+    if (typeid(node) != typeid(VectorizedFnCall) && typeid(node) != typeid(VCompoundPred) &&
+        typeid(node) != typeid(VCastExpr) && typeid(node) != typeid(VCaseExpr) &&
+        typeid(node) != typeid(VInPredicate)) {
+        return false;
+    }
+    *calls_function = true;
+    return std::ranges::all_of(expr->children(), [&](const VExprSPtr& child) {
+        return collect_input_columns(child, column_ids, calls_function);
+    });
+}
+
+} // namespace
+
 VCaseExpr::VCaseExpr(const TExprNode& node)
         : VExpr(node),
           _has_case_expr(node.case_expr.has_case_expr),
@@ -72,6 +111,29 @@ Status VCaseExpr::prepare(RuntimeState* state, const RowDescriptor& desc, VExprC
     }
 
     VExpr::register_function_context(state, context);
+
+    // The children are WHEN, THEN, ..., [ELSE]. The THEN and ELSE children calling functions are
+    // executed on the rows taking them if the WHEN children are boolean.
+    _branch_column_ids.assign(_children.size(), {});
+    const size_t num_when_then = _children.size() - _has_else_expr;
+    bool boolean_when = !_has_case_expr;
+    for (size_t i = 0; boolean_when && i < num_when_then; i += 2) {
+        boolean_when = remove_nullable(_children[i]->data_type())->get_primitive_type() ==
+                       TYPE_BOOLEAN;
+    }
+    for (size_t i = 1; boolean_when && i < _children.size(); ++i) {
+        if (i % 2 == 0 && i != num_when_then) {
+            continue;
+        }
+        std::vector<int> column_ids;
+        bool calls_function = false;
+        if (collect_input_columns(_children[i], &column_ids, &calls_function) && calls_function &&
+            !column_ids.empty() &&
+            std::ranges::none_of(column_ids, [](int id) { return id < 0; })) {
+            _branch_column_ids[i] = std::move(column_ids);
+            _has_selective_branch = true;
+        }
+    }
     _prepare_finished = true;
     return Status::OK();
 }
@@ -102,10 +164,15 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     }
     DCHECK(_open_finished || _getting_const_col);
     ColumnNumbers arguments(_children.size());
-    for (int i = 0; i < _children.size(); i++) {
-        int column_id = -1;
-        RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
-        arguments[i] = column_id;
+    // The results of the inverted indexes are computed for all rows.
+    if (_has_selective_branch && context->get_inverted_index_context() == nullptr) {
+        RETURN_IF_ERROR(_execute_branches_on_selected_rows(context, block, arguments));
+    } else {
+        for (int i = 0; i < _children.size(); i++) {
+            int column_id = -1;
+            RETURN_IF_ERROR(_children[i]->execute(context, block, &column_id));
+            arguments[i] = column_id;
+        }
     }
     RETURN_IF_ERROR(check_constant(*block, arguments));
 
@@ -119,6 +186,101 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     return Status::OK();
 }
 
+Status VCaseExpr::_execute_branches_on_selected_rows(VExprContext* context, Block* block,
+                                                     ColumnNumbers& arguments) {
+    const size_t rows = block->rows();
+    const size_t num_when_then = _children.size() - _has_else_expr;
+    // the rows not taken by the WHEN children executed so far
+    IColumn::Filter remaining(rows, 1);
+    IColumn::Filter selected(rows);
+    auto execute_branch = [&](size_t child_idx) -> Status {
+        int column_id = -1;
+        if (_branch_column_ids[child_idx].empty()) {
+            RETURN_IF_ERROR(_children[child_idx]->execute(context, block, &column_id));
+        } else {
+            const size_t count =
+                    rows - simd::count_zero_num(reinterpret_cast<const int8_t*>(selected.data()),
+                                                rows);
+            RETURN_IF_ERROR(_execute_on_selected_rows(context, block, child_idx, selected, count,
+                                                      &column_id));
+        }
+        arguments[child_idx] = column_id;
+        return Status::OK();
+    };
+
+    for (size_t i = 0; i < num_when_then; i += 2) {
+        int when_id = -1;
+        RETURN_IF_ERROR(_children[i]->execute(context, block, &when_id));
+        arguments[i] = when_id;
+        ColumnPtr when = block->get_by_position(when_id).column->convert_to_full_column_if_const();
+        const IColumn* when_values = when.get();
+        const NullMap::value_type* null_map = nullptr;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*when)) {
+            null_map = nullable->get_null_map_data().data();
+            when_values = &nullable->get_nested_column();
+        }
+        const auto* __restrict when_data =
+                assert_cast<const ColumnUInt8&>(*when_values).get_data().data();
+        for (size_t row = 0; row < rows; ++row) {
+            selected[row] =
+                    remaining[row] && when_data[row] && (null_map == nullptr || !null_map[row]);
+            remaining[row] = remaining[row] && !selected[row];
+        }
+        RETURN_IF_ERROR(execute_branch(i + 1));
+    }
+    if (_has_else_expr) {
+        selected.swap(remaining);
+        RETURN_IF_ERROR(execute_branch(num_when_then));
+    }
+    return Status::OK();
+}
+
+Status VCaseExpr::_execute_on_selected_rows(VExprContext* context, Block* block, size_t child_idx,
+                                            const IColumn::Filter& filter, size_t count,
+                                            int* result_column_id) {
+    const auto& child = _children[child_idx];
+    const size_t rows = block->rows();
+    if (count == rows) {
+        return child->execute(context, block, result_column_id);
+    }
+    if (count == 0) {
+        *result_column_id = cast_set<int>(block->columns());
+        block->insert({child->data_type()->create_column_const_with_default_value(rows),
+                       child->data_type(), child->expr_name()});
+        return Status::OK();
+    }
+
+    // The columns not read by the child are left empty, they keep their positions for the slot
+    // refs.
+    const auto& column_ids = _branch_column_ids[child_idx];
+    Block selected_block;
+    for (size_t i = 0; i < block->columns(); ++i) {
+        const auto& column = block->get_by_position(i);
+        const bool is_read = std::ranges::find(column_ids, cast_set<int>(i)) != column_ids.end();
+        selected_block.insert({is_read && column.column ? column.column->filter(filter, count)
+                                                        : nullptr,
+                               column.type, column.name});
+    }
+    int selected_id = -1;
+    RETURN_IF_ERROR(child->execute(context, &selected_block, &selected_id));
+    const auto& selected_result = selected_block.get_by_position(selected_id);
+
+    // Scatters the results back, the other rows take the default value appended at the end.
+    auto values =
+            selected_result.column->convert_to_full_column_if_const()->clone_resized(count + 1);
+    std::vector<uint32_t> indices(rows);
+    uint32_t next = 0;
+    for (size_t row = 0; row < rows; ++row) {
+        indices[row] = filter[row] ? next : cast_set<uint32_t>(count);
+        next += static_cast<uint32_t>(filter[row]);
+    }
+    auto result = values->clone_empty();
+    result->insert_indices_from(*values, indices.data(), indices.data() + rows);
+    *result_column_id = cast_set<int>(block->columns());
+    block->insert({std::move(result), selected_result.type, selected_result.name});
+    return Status::OK();
+}
+
 const std::string& VCaseExpr::expr_name() const {
     return _expr_name;
 }
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -52,9 +53,24 @@ public:
     std::string debug_string() const override;
 
 private:
+    // Executes the THEN and ELSE children which call functions only on the rows taking them, so
+    // that e.g. `CASE WHEN is_json THEN json_extract(...) ELSE ... END` does not parse the other
+    // rows. The results of the other rows are default values, which are not used by the case
+    // function.
+    Status _execute_branches_on_selected_rows(VExprContext* context, Block* block,
+                                              ColumnNumbers& arguments);
+    Status _execute_on_selected_rows(VExprContext* context, Block* block, size_t child_idx,
+                                     const IColumn::Filter& filter, size_t count,
+                                     int* result_column_id);
+
     bool _has_case_expr;
     bool _has_else_expr;
 
+    // the ids of the columns read by each child which is executed on the selected rows, empty
+    // for the other children
+    std::vector<std::vector<int>> _branch_column_ids;
+    bool _has_selective_branch = false;
+
     FunctionBasePtr _function;
     std::string _function_name = "case";
     const std::string _expr_name = "vcase expr";
@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcommon_subexpr_ref.h"
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "vec/core/block.h"
+#include "vec/exprs/vectorized_fn_call.h"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+namespace {
+
+// The functions which may return different results for the same arguments.
+const std::unordered_set<std::string> NON_DETERMINISTIC_FUNCTIONS = {
+        "rand", "random", "random_bytes", "uuid", "uuid_numeric", "sleep"};
+
+using Candidates = std::vector<std::pair<const VExpr*, std::string>>;
+
+// Returns the fingerprint of the expr tree, which is the same for the trees computing the same
+// result on a block, or empty if the tree can not be shared. The function calls reading slots
+// are added to `candidates`, the trees without slots are constant and evaluated in open.
+std::string fingerprint(const VExprSPtr& expr, bool* has_slot, Candidates* candidates) {
+    std::vector<std::string> children;
+    bool children_shareable = true;
+    bool children_have_slot = false;
+    for (const auto& child : expr->children()) {
+        bool child_has_slot = false;
+        children.push_back(fingerprint(child, &child_has_slot, candidates));
+        children_shareable &= !children.back().empty();
+        children_have_slot |= child_has_slot;
+    }
+
+    *has_slot = false;
+    if (expr->is_slot_ref()) {
+        int slot_id = static_cast<const VSlotRef&>(*expr).slot_id();
+        if (slot_id < 0) {
+            return {};
+        }
+        *has_slot = true;
+        return fmt::format("slot#{}", slot_id);
+    }
+    if (const auto* literal = dynamic_cast<const VLiteral*>(expr.get())) {
+        // The value is prefixed by its length, so that the fingerprints can not collide.
+        std::string value = literal->value();
+        return fmt::format("{}:{}:{}", expr->data_type()->get_name(), value.size(), value);
+    }
+    const VExpr& node = *expr;
+    if (!children_shareable || node.node_type() != TExprNodeType::FUNCTION_CALL ||
+        typeid(node) != typeid(VectorizedFnCall) ||
+        node.fn().binary_type != TFunctionBinaryType::BUILTIN ||
+        NON_DETERMINISTIC_FUNCTIONS.contains(node.fn().name.function_name)) {
+        return {};
+    }
+    *has_slot = children_have_slot;
+    auto result = fmt::format("{}({}):{}", node.fn().name.function_name,
+                              fmt::join(children, ","), expr->data_type()->get_name());
+    if (*has_slot) {
+        candidates->emplace_back(expr.get(), result);
+    }
+    return result;
+}
+
+VExprSPtr wrap_common_subexprs(const VExprSPtr& expr,
+                               const std::unordered_map<const VExpr*, size_t>& subexpr_ids) {
+    VExprSPtrs children;
+    children.reserve(expr->children().size());
+    bool changed = false;
+    for (const auto& child : expr->children()) {
+        children.push_back(wrap_common_subexprs(child, subexpr_ids));
+        changed |= children.back() != child;
+    }
+    if (changed) {
+        expr->set_children(std::move(children));
+    }
+    if (auto iter = subexpr_ids.find(expr.get()); iter != subexpr_ids.end()) {
+        return VCommonSubexprRef::create_shared(expr, iter->second);
+    }
+    return expr;
+}
+
+void count_common_subexprs(const VExprSPtr& expr, size_t* num_subexprs) {
+    if (const auto* ref = dynamic_cast<const VCommonSubexprRef*>(expr.get())) {
+        *num_subexprs = std::max(*num_subexprs, ref->subexpr_id() + 1);
+    }
+    for (const auto& child : expr->children()) {
+        count_common_subexprs(child, num_subexprs);
+    }
+}
+
+} // namespace
+
+int CommonSubexprResults::find(size_t subexpr_id, const Block& block) const {
+    const auto& result = _results[subexpr_id];
+    if (result.block != &block || result.column_id < 0 ||
+        static_cast<size_t>(result.column_id) >= block.columns() ||
+        block.get_by_position(result.column_id).column.get() != result.column.get()) {
+        return -1;
+    }
+    return result.column_id;
+}
+
+void CommonSubexprResults::set(size_t subexpr_id, const Block& block, int column_id) {
+    _results[subexpr_id] = {&block, column_id, block.get_by_position(column_id).column};
+}
+
+void CommonSubexprResults::reset() {
+    std::fill(_results.begin(), _results.end(), Result {});
+}
+
+VCommonSubexprRef::VCommonSubexprRef(const VExprSPtr& impl, size_t subexpr_id)
+        : VExpr(*impl), _subexpr_id(subexpr_id) {
+    _children = {impl};
+}
+
+size_t VCommonSubexprRef::rewrite(const VExprContextSPtrs& ctxs) {
+    Candidates candidates;
+    for (const auto& ctx : ctxs) {
+        bool has_slot = false;
+        fingerprint(ctx->root(), &has_slot, &candidates);
+    }
+    std::unordered_map<std::string, size_t> occurrences;
+    for (const auto& [_, key] : candidates) {
+        ++occurrences[key];
+    }
+    std::unordered_map<std::string, size_t> key_to_id;
+    std::unordered_map<const VExpr*, size_t> subexpr_ids;
+    for (const auto& [expr, key] : candidates) {
+        if (occurrences[key] > 1) {
+            auto [iter, _] = key_to_id.emplace(key, key_to_id.size());
+            subexpr_ids.emplace(expr, iter->second);
+        }
+    }
+    if (subexpr_ids.empty()) {
+        return 0;
+    }
+    for (const auto& ctx : ctxs) {
+        ctx->set_root(wrap_common_subexprs(ctx->root(), subexpr_ids));
+    }
+    return key_to_id.size();
+}
+
+void VCommonSubexprRef::share_results(const VExprContextSPtrs& ctxs) {
+    size_t num_subexprs = 0;
+    for (const auto& ctx : ctxs) {
+        count_common_subexprs(ctx->root(), &num_subexprs);
+    }
+    if (num_subexprs == 0) {
+        return;
+    }
+    auto results = std::make_shared<CommonSubexprResults>(num_subexprs);
+    for (const auto& ctx : ctxs) {
+        ctx->set_common_subexpr_results(results);
+    }
+}
+
+void VCommonSubexprRef::reset_results(const VExprContextSPtrs& ctxs) {
+    if (!ctxs.empty() && ctxs[0]->common_subexpr_results() != nullptr) {
+        ctxs[0]->common_subexpr_results()->reset();
+    }
+}
+
+Status VCommonSubexprRef::prepare(RuntimeState* state, const RowDescriptor& row_desc,
+                                  VExprContext* context) {
+    RETURN_IF_ERROR_OR_PREPARED(VExpr::prepare(state, row_desc, context));
+    // The type of the subexpr may be adjusted in its prepare.
+    _data_type = _children[0]->data_type();
+    _prepare_finished = true;
+    return Status::OK();
+}
+
+Status VCommonSubexprRef::open(RuntimeState* state, VExprContext* context,
+                               FunctionContext::FunctionStateScope scope) {
+    DCHECK(_prepare_finished);
+    RETURN_IF_ERROR(VExpr::open(state, context, scope));
+    _open_finished = true;
+    return Status::OK();
+}
+
+Status VCommonSubexprRef::execute(VExprContext* context, Block* block, int* result_column_id) {
+    DCHECK(_open_finished || _getting_const_col);
+    auto* results = context->common_subexpr_results();
+    if (results != nullptr) {
+        int column_id = results->find(_subexpr_id, *block);
+        if (column_id >= 0) {
+            *result_column_id = column_id;
+            return Status::OK();
+        }
+    }
+    RETURN_IF_ERROR(_children[0]->execute(context, block, result_column_id));
+    if (results != nullptr) {
+        results->set(_subexpr_id, *block, *result_column_id);
+    }
+    return Status::OK();
+}
+
+size_t VCommonSubexprRef::estimate_memory(const size_t rows) {
+    return _children[0]->estimate_memory(rows);
+}
+
+std::string VCommonSubexprRef::debug_string() const {
+    return fmt::format("CommonSubexprRef(id={}, {})", _subexpr_id, _children[0]->debug_string());
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "vec/columns/column.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+class Block;
+
+// The result columns of the common subexpressions of a list of exprs, which are executed on the
+// same block. A result is valid while the block holds its column at the recorded position.
+class CommonSubexprResults {
+public:
+    explicit CommonSubexprResults(size_t num_subexprs) : _results(num_subexprs) {}
+
+    // Returns the position of the result of the subexpr in the block, -1 if the subexpr is not
+    // executed on the block.
+    int find(size_t subexpr_id, const Block& block) const;
+
+    void set(size_t subexpr_id, const Block& block, int column_id);
+
+    // Releases the result columns, called after the exprs are executed on a block.
+    void reset();
+
+private:
+    struct Result {
+        const Block* block = nullptr;
+        int column_id = -1;
+        ColumnPtr column;
+    };
+
+    std::vector<Result> _results;
+};
+
+// Wraps an occurrence of a subexpression which appears more than once in a list of exprs, e.g.
+// `parse_url(url, 'HOST')` in the projections `parse_url(url, 'HOST')` and
+// `lower(parse_url(url, 'HOST'))`. The first occurrence executed on a block records its result
+// column in the CommonSubexprResults of the context, and the others reuse the column.
+class VCommonSubexprRef final : public VExpr {
+    ENABLE_FACTORY_CREATOR(VCommonSubexprRef);
+
+public:
+    VCommonSubexprRef(const VExprSPtr& impl, size_t subexpr_id);
+    ~VCommonSubexprRef() override = default;
+
+    // Replaces the deterministic function calls which appear more than once in the exprs by
+    // refs. Must be called before the exprs are prepared, all exprs are executed on blocks of
+    // the same row descriptor. Returns the number of the common subexpressions.
+    static size_t rewrite(const VExprContextSPtrs& ctxs);
+
+    // Makes the contexts of the exprs share the results of their common subexpressions.
+    static void share_results(const VExprContextSPtrs& ctxs);
+
+    // Releases the results shared by the contexts of the exprs.
+    static void reset_results(const VExprContextSPtrs& ctxs);
+
+    Status prepare(RuntimeState* state, const RowDescriptor& row_desc,
+                   VExprContext* context) override;
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override;
+    size_t estimate_memory(const size_t rows) override;
+
+    const std::string& expr_name() const override { return _children[0]->expr_name(); }
+    std::string debug_string() const override;
+
+    size_t subexpr_id() const { return _subexpr_id; }
+
+private:
+    const size_t _subexpr_id;
+};
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
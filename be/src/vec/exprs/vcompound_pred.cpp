@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcompound_pred.h"
+
+#include <string>
+#include <vector>
+
+#include "runtime/primitive_type.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+#include "vec/functions/like.h"
+
+namespace doris::vectorized {
+#include "common/compile_check_begin.h"
+
+Status VCompoundPred::prepare(RuntimeState* state, const RowDescriptor& desc,
+                              VExprContext* context) {
+    const bool prepared = _prepared;
+    RETURN_IF_ERROR(VectorizedFnCall::prepare(state, desc, context));
+    if (!prepared && _op == TExprOpcode::COMPOUND_OR) {
+        _init_pattern_matcher();
+    }
+    return Status::OK();
+}
+
+void VCompoundPred::_init_pattern_matcher() {
+    std::vector<std::string> like_patterns;
+    std::vector<std::string> regexp_patterns;
+    VExprSPtr slot;
+    VExprSPtrs disjuncts(_children.begin(), _children.end());
+    while (!disjuncts.empty()) {
+        VExprSPtr expr = std::move(disjuncts.back());
+        disjuncts.pop_back();
+        if (const auto* compound = dynamic_cast<const VCompoundPred*>(expr.get())) {
+            if (compound->_op != TExprOpcode::COMPOUND_OR) {
+                return;
+            }
+            disjuncts.insert(disjuncts.end(), compound->children().begin(),
+                             compound->children().end());
+            continue;
+        }
+        const auto& name = expr->fn().name.function_name;
+        const bool is_like = name == FunctionLike::name;
+        const bool is_regexp =
+                name == FunctionRegexpLike::name || name == FunctionRegexpLike::alias;
+        // LIKE with an escape character has 3 arguments.
+        if (expr->node_type() != TExprNodeType::FUNCTION_CALL || !(is_like || is_regexp) ||
+            expr->get_num_children() != 2) {
+            return;
+        }
+        auto* child_slot = dynamic_cast<VSlotRef*>(expr->get_child(0).get());
+        auto* literal = dynamic_cast<VLiteral*>(expr->get_child(1).get());
+        if (child_slot == nullptr || literal == nullptr ||
+            (slot != nullptr &&
+             static_cast<const VSlotRef&>(*slot).slot_id() != child_slot->slot_id()) ||
+            literal->data_type()->is_nullable() ||
+            !is_string_type(literal->data_type()->get_primitive_type())) {
+            return;
+        }
+        slot = expr->get_child(0);
+        (is_like ? like_patterns : regexp_patterns).push_back(literal->value());
+    }
+    if (like_patterns.size() + regexp_patterns.size() < 2 ||
+        !is_string_type(remove_nullable(slot->data_type())->get_primitive_type())) {
+        return;
+    }
+    _pattern_matcher = MultiPatternMatcher::create(like_patterns, regexp_patterns);
+    if (_pattern_matcher != nullptr) {
+        _pattern_slot = std::move(slot);
+    }
+}
+
+Status VCompoundPred::_execute_pattern_matcher(VExprContext* context, Block* block,
+                                               int* result_column_id, bool* executed) {
+    *executed = false;
+    int slot_column_id = -1;
+    RETURN_IF_ERROR(_pattern_slot->execute(context, block, &slot_column_id));
+    ColumnPtr column =
+            block->get_by_position(slot_column_id).column->convert_to_full_column_if_const();
+    const auto* nullable_column = check_and_get_column<ColumnNullable>(*column);
+    const auto* values = check_and_get_column<ColumnString>(
+            nullable_column != nullptr ? nullable_column->get_nested_column() : *column);
+    if (values == nullptr || (nullable_column != nullptr && !_data_type->is_nullable())) {
+        return Status::OK();
+    }
+
+    const size_t size = column->size();
+    auto result = ColumnUInt8::create(size, 0);
+    RETURN_IF_ERROR(_pattern_matcher->match(*values, result->get_data()));
+    ColumnPtr result_column = std::move(result);
+    if (_data_type->is_nullable()) {
+        // The predicates are null iff the value is null, so is the disjunction of them.
+        ColumnPtr null_map = nullable_column != nullptr
+                                     ? nullable_column->get_null_map_column_ptr()
+                                     : ColumnUInt8::create(size, 0);
+        result_column = ColumnNullable::create(result_column, null_map);
+    }
+    block->insert({std::move(result_column), _data_type, _expr_name});
+    *result_column_id = static_cast<int>(block->columns()) - 1;
+    *executed = true;
+    return Status::OK();
+}
+
+#include "common/compile_check_end.h"
+} // namespace doris::vectorized
@@ -32,6 +32,8 @@
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 
+class MultiPatternMatcher;
+
 inline std::string compound_operator_to_string(TExprOpcode::type op) {
     if (op == TExprOpcode::COMPOUND_AND) {
         return "and";
@@ -55,6 +57,8 @@ public:
 
     const std::string& expr_name() const override { return _expr_name; }
 
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override;
+
     Status evaluate_inverted_index(VExprContext* context, uint32_t segment_num_rows) override {
         segment_v2::InvertedIndexResultBitmap res;
         bool all_pass = true;
@@ -157,6 +161,13 @@ public:
         if (get_num_children() == 1 || _has_const_child()) {
             return VectorizedFnCall::execute(context, block, result_column_id);
         }
+        if (_pattern_matcher != nullptr) {
+            bool executed = false;
+            RETURN_IF_ERROR(_execute_pattern_matcher(context, block, result_column_id, &executed));
+            if (executed) {
+                return Status::OK();
+            }
+        }
 
         int lhs_id = -1;
         int rhs_id = -1;
@@ -382,6 +393,13 @@ private:
         return (l_null & r_null) | (r_null & (r_null ^ a)) | (l_null & (l_null ^ b));
     }
 
+    // If the OR is a disjunction of LIKE and REGEXP predicates with constant patterns on the same
+    // string slot, matches all patterns at once by a MultiPatternMatcher.
+    void _init_pattern_matcher();
+    // `executed` is false if the slot is not a string column, then the children are executed.
+    Status _execute_pattern_matcher(VExprContext* context, Block* block, int* result_column_id,
+                                    bool* executed);
+
     bool _has_const_child() const {
         return std::ranges::any_of(_children,
                                    [](const VExprSPtr& arg) -> bool { return arg->is_constant(); });
@@ -408,6 +426,9 @@ private:
     }
 
     TExprOpcode::type _op;
+    // the slot and the matcher of the patterns of a disjunction of LIKE and REGEXP predicates
+    VExprSPtr _pattern_slot;
+    std::shared_ptr<MultiPatternMatcher> _pattern_matcher;
 };
 
 #include "common/compile_check_end.h"
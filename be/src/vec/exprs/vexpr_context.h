@@ -39,6 +39,7 @@ class RuntimeState;
 } // namespace doris
 
 namespace doris::vectorized {
+class CommonSubexprResults;
 
 class InvertedIndexContext {
 public:
@@ -239,6 +240,14 @@ public:
 
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
+    // The results of the common subexpressions shared by the contexts of a list of exprs, see
+    // VCommonSubexprRef. Clones do not inherit them.
+    CommonSubexprResults* common_subexpr_results() const { return _common_subexpr_results.get(); }
+
+    void set_common_subexpr_results(std::shared_ptr<CommonSubexprResults> results) {
+        _common_subexpr_results = std::move(results);
+    }
+
     VExprContext& operator=(const VExprContext& other) {
         if (this == &other) {
             return *this;
@@ -312,5 +321,7 @@ private:
 
     std::shared_ptr<InvertedIndexContext> _inverted_index_context;
     size_t _memory_usage = 0;
+
+    std::shared_ptr<CommonSubexprResults> _common_subexpr_results;
 };
 } // namespace doris::vectorized
@@ -19,6 +19,7 @@
 
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
@@ -103,9 +104,11 @@ public:
                                                     arg2.type->get_name()));
         }
 
-        auto col1 = arg1.column->convert_to_full_column_if_const();
-        auto col2 = arg2.column->convert_to_full_column_if_const();
-        if (col1->size() != col2->size()) {
+        // The query vector of a similarity search is usually a constant, it is not copied for
+        // every row.
+        const auto [col1, col1_const] = unpack_if_const(arg1.column);
+        const auto [col2, col2_const] = unpack_if_const(arg2.column);
+        if (!col1_const && !col2_const && col1->size() != col2->size()) {
             return Status::RuntimeError(
                     fmt::format("function {} have different input array sizes: {} and {}",
                                 get_name(), col1->size(), col2->size()));
@@ -127,38 +130,50 @@ public:
 
         const auto& offsets1 = *arr1.offsets_ptr;
         const auto& offsets2 = *arr2.offsets_ptr;
-        const auto& nested_col1 = assert_cast<const ColumnFloat64*>(arr1.nested_col.get());
-        const auto& nested_col2 = assert_cast<const ColumnFloat64*>(arr2.nested_col.get());
-        for (ssize_t row = 0; row < offsets1.size(); ++row) {
-            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row]) {
+        const auto* data1 =
+                assert_cast<const ColumnFloat64*>(arr1.nested_col.get())->get_data().data();
+        const auto* data2 =
+                assert_cast<const ColumnFloat64*>(arr2.nested_col.get())->get_data().data();
+        const bool has_nested_null = arr1.nested_nullmap_data || arr2.nested_nullmap_data;
+        for (size_t row = 0; row < input_rows_count; ++row) {
+            const size_t row1 = index_check_const(row, col1_const);
+            const size_t row2 = index_check_const(row, col2_const);
+            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row1]) {
                 dst_null_data[row] = true;
                 continue;
             }
-            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row]) {
+            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row2]) {
                 dst_null_data[row] = true;
                 continue;
             }
 
             dst_null_data[row] = false;
-            if (offsets1[row] != offsets2[row]) [[unlikely]] {
+            const size_t begin1 = offsets1[row1 - 1];
+            const size_t begin2 = offsets2[row2 - 1];
+            const size_t size = offsets1[row1] - begin1;
+            if (size != offsets2[row2] - begin2) [[unlikely]] {
                 return Status::InvalidArgument(
                         "function {} have different input element sizes of array: {} and {}",
-                        get_name(), offsets1[row] - offsets1[row - 1],
-                        offsets2[row] - offsets2[row - 1]);
+                        get_name(), size, offsets2[row2] - begin2);
             }
 
             typename DistanceImpl::State st;
-            for (ssize_t pos = offsets1[row - 1]; pos < offsets1[row]; ++pos) {
-                if (arr1.nested_nullmap_data && arr1.nested_nullmap_data[pos]) {
-                    dst_null_data[row] = true;
-                    break;
+            if (has_nested_null) {
+                for (size_t i = 0; i < size; ++i) {
+                    if (arr1.nested_nullmap_data && arr1.nested_nullmap_data[begin1 + i]) {
+                        dst_null_data[row] = true;
+                        break;
+                    }
+                    if (arr2.nested_nullmap_data && arr2.nested_nullmap_data[begin2 + i]) {
+                        dst_null_data[row] = true;
+                        break;
+                    }
+                    DistanceImpl::accumulate(st, data1[begin1 + i], data2[begin2 + i]);
                 }
-                if (arr2.nested_nullmap_data && arr2.nested_nullmap_data[pos]) {
-                    dst_null_data[row] = true;
-                    break;
+            } else {
+                for (size_t i = 0; i < size; ++i) {
+                    DistanceImpl::accumulate(st, data1[begin1 + i], data2[begin2 + i]);
                 }
-                DistanceImpl::accumulate(st, nested_col1->get_element(pos),
-                                         nested_col2->get_element(pos));
             }
             if (!dst_null_data[row]) {
                 dst_data[row] = DistanceImpl::finalize(st);
@@ -27,6 +27,12 @@
 
 namespace doris::vectorized {
 
+// The hash methods whose hash tables refer to the keys in the key columns instead of copying them.
+template <typename HashMethod>
+constexpr bool hash_map_refers_key_columns =
+        std::is_same_v<HashMethod, MethodSerialized<StringHashMap<IColumn::ColumnIndex>>> ||
+        std::is_same_v<HashMethod, MethodStringNoCache<StringHashMap<IColumn::ColumnIndex>>>;
+
 ComplexHashMapDictionary::~ComplexHashMapDictionary() {
     if (_mem_tracker) {
         SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(_mem_tracker);
@@ -71,6 +77,10 @@ void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const Da
                            State state(key_raw_columns);
 
                            const size_t rows = key_columns[0]->size();
+                           if constexpr (!HashMethodType::is_string_hash_map()) {
+                               // sized for all keys at once instead of growing by rehashing
+                               dict_method.hash_table->reserve(rows);
+                           }
                            dict_method.init_serialized_keys(key_raw_columns, rows);
                            size_t input_rows = 0;
                            for (int i = 0; i < rows; i++) {
@@ -90,6 +100,10 @@ void ComplexHashMapDictionary::load_data(const ColumnPtrs& key_columns, const Da
                                        DICT_DATA_ERROR_TAG +
                                                "The key has duplicate data in HashMapDictionary");
                            }
+                           if constexpr (!hash_map_refers_key_columns<HashMethodType>) {
+                               // the keys are copied into the hash table
+                               ColumnPtrs {}.swap(_key_columns);
+                           }
                        }},
                _hash_map_method.method_variant);
 
@@ -172,20 +186,25 @@ ColumnPtrs ComplexHashMapDictionary::get_tuple_columns(
                            using State = typename HashMethodType::State;
                            State state(key_raw_columns);
                            dict_method.init_serialized_keys(key_raw_columns, rows);
-                           for (size_t i = 0; i < rows; ++i) {
-                               if constexpr (key_hash_nullable) {
+                           auto set_value_index = [&](size_t i, auto&& find_result) {
+                               if (find_result.is_found()) {
+                                   value_index[i] = find_result.get_mapped();
+                               } else {
+                                   key_not_found[i] = true;
+                               }
+                           };
+                           if constexpr (key_hash_nullable) {
+                               for (size_t i = 0; i < rows; ++i) {
                                    // if any key is null, we will not find it in the hash table
                                    if (has_null_key(i)) {
                                        key_not_found[i] = true;
                                        continue;
                                    }
+                                   set_value_index(i, dict_method.find(state, i));
                                }
-                               auto find_result = dict_method.find(state, i);
-                               if (find_result.is_found()) {
-                                   value_index[i] = find_result.get_mapped();
-                               } else {
-                                   key_not_found[i] = true;
-                               }
+                           } else {
+                               // every row is looked up, the first rows are prefetched as well
+                               dict_method.find_batch(state, rows, set_value_index);
                            }
                        }},
                find_hash_map.method_variant, make_bool_variant(key_hash_nullable));
@@ -17,12 +17,47 @@
 
 #include "vec/functions/function_convert_tz.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "vec/data_types/data_type_date.h"
 #include "vec/functions/simple_function_factory.h"
 #include "vec/runtime/vdatetime_value.h"
 
 namespace doris::vectorized {
 
+bool ConvertTzOffsetCache::_find_range(const cctz::civil_second& from) {
+    const auto lookup = _from_tz.lookup(from);
+    if (lookup.kind != cctz::time_zone::civil_lookup::UNIQUE) {
+        return false;
+    }
+    const auto from_offset = _from_tz.lookup(lookup.pre).offset;
+    const auto to_offset = _to_tz.lookup(lookup.pre).offset;
+    const cctz::civil_second epoch;
+    _begin = std::numeric_limits<int64_t>::min();
+    _end = std::numeric_limits<int64_t>::max();
+    _delta = to_offset - from_offset;
+
+    // The transitions strictly before lookup.pre + 1 and after lookup.pre, i.e. the range of the
+    // offsets at lookup.pre. The local times just after a backward transition of from_tz are
+    // repeated and resolved to the earlier offset by cctz, so they are excluded.
+    cctz::time_zone::civil_transition transition;
+    if (_from_tz.prev_transition(lookup.pre + cctz::seconds(1), &transition)) {
+        _begin = std::max(_begin, std::max(transition.from, transition.to) - epoch);
+    }
+    if (_from_tz.next_transition(lookup.pre, &transition)) {
+        _end = std::min(_end, transition.from - epoch);
+    }
+    // The transitions of to_tz are converted to the local times of from_tz.
+    if (_to_tz.prev_transition(lookup.pre + cctz::seconds(1), &transition)) {
+        _begin = std::max(_begin, transition.to - epoch - _delta);
+    }
+    if (_to_tz.next_transition(lookup.pre, &transition)) {
+        _end = std::min(_end, transition.from - epoch - _delta);
+    }
+    return true;
+}
+
 void register_function_convert_tz(SimpleFunctionFactory& factory) {
     factory.register_function<FunctionConvertTZ<DataTypeDateTime>>();
     factory.register_function<FunctionConvertTZ<DataTypeDateTimeV2>>();
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cctz/civil_time.h>
 #include <cctz/time_zone.h>
 
 #include <cstddef>
@@ -60,6 +61,39 @@ struct ConvertTzState {
     cctz::time_zone to_tz;
 };
 
+// Between two transitions of from_tz or to_tz, converting a local time of from_tz to to_tz adds
+// a constant difference of their offsets. Caches the range of local times around the latest
+// converted one, so that most rows of a block are converted without cctz lookups.
+class ConvertTzOffsetCache {
+public:
+    ConvertTzOffsetCache(const cctz::time_zone& from_tz, const cctz::time_zone& to_tz)
+            : _from_tz(from_tz), _to_tz(to_tz) {}
+
+    // Returns false if the local time is skipped or repeated in from_tz, it should be converted
+    // by cctz then.
+    bool convert(const cctz::civil_second& from, cctz::civil_second* to) {
+        int64_t seconds = from - cctz::civil_second();
+        if (seconds < _begin || seconds >= _end) [[unlikely]] {
+            if (!_find_range(from)) {
+                return false;
+            }
+        }
+        *to = cctz::civil_second() + (seconds + _delta);
+        return true;
+    }
+
+private:
+    bool _find_range(const cctz::civil_second& from);
+
+    const cctz::time_zone& _from_tz;
+    const cctz::time_zone& _to_tz;
+    // the local times in [_begin, _end) of from_tz, in seconds since 1970-01-01 00:00:00, are
+    // converted by adding _delta
+    int64_t _begin = 0;
+    int64_t _end = 0;
+    int64_t _delta = 0;
+};
+
 template <typename ArgDateType>
 class FunctionConvertTZ : public IFunction {
     using DateValueType = date_cast::TypeToValueTypeV<ArgDateType>;
@@ -231,6 +265,7 @@ private:
             }
             return;
         }
+        ConvertTzOffsetCache offset_cache(from_tz, to_tz);
         for (size_t i = 0; i < input_rows_count; i++) {
             if (result_null_map[i]) {
                 result_column->insert_default();
@@ -241,20 +276,22 @@ private:
                     binary_cast<NativeType, DateValueType>(date_column->get_element(i));
             ReturnDateValueType ts_value2;
 
-            if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
-                std::pair<int64_t, int64_t> timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
-                }
-                ts_value2.from_unixtime(timestamp, to_tz);
-            } else {
-                int64_t timestamp;
-                if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
-                    push_null(i);
-                    continue;
+            if (!convert_by_offset_cache(offset_cache, ts_value, ts_value2)) [[unlikely]] {
+                if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
+                    std::pair<int64_t, int64_t> timestamp;
+                    if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
+                        push_null(i);
+                        continue;
+                    }
+                    ts_value2.from_unixtime(timestamp, to_tz);
+                } else {
+                    int64_t timestamp;
+                    if (!ts_value.unix_timestamp(&timestamp, from_tz)) {
+                        push_null(i);
+                        continue;
+                    }
+                    ts_value2.from_unixtime(timestamp, to_tz);
                 }
-                ts_value2.from_unixtime(timestamp, to_tz);
             }
 
             if (!ts_value2.is_valid_date()) [[unlikely]] {
@@ -278,19 +315,52 @@ private:
         }
     }
 
+    // Returns false if the value is not converted by the cache.
+    static bool convert_by_offset_cache(ConvertTzOffsetCache& offset_cache,
+                                        const DateValueType& ts_value,
+                                        ReturnDateValueType& ts_value2) {
+        if constexpr (std::is_same_v<ArgDateType, DataTypeDateV2>) {
+            return false;
+        } else {
+            cctz::civil_second converted;
+            if (!offset_cache.convert(cctz::civil_second(ts_value.year(), ts_value.month(),
+                                                         ts_value.day(), ts_value.hour(),
+                                                         ts_value.minute(), ts_value.second()),
+                                      &converted)) {
+                return false;
+            }
+            if constexpr (std::is_same_v<ArgDateType, DataTypeDateTimeV2>) {
+                ts_value2.unchecked_set_time(static_cast<uint16_t>(converted.year()),
+                                             static_cast<uint8_t>(converted.month()),
+                                             static_cast<uint8_t>(converted.day()),
+                                             static_cast<uint8_t>(converted.hour()),
+                                             static_cast<uint8_t>(converted.minute()),
+                                             static_cast<uint16_t>(converted.second()),
+                                             ts_value.microsecond());
+            } else {
+                ts_value2.unchecked_set_time(static_cast<uint32_t>(converted.year()),
+                                             static_cast<uint32_t>(converted.month()),
+                                             static_cast<uint32_t>(converted.day()),
+                                             static_cast<uint32_t>(converted.hour()),
+                                             static_cast<uint32_t>(converted.minute()),
+                                             static_cast<uint32_t>(converted.second()));
+            }
+            return true;
+        }
+    }
+
     static void execute_tz_const(FunctionContext* context, const ColumnType* date_column,
                                  const ColumnString* from_tz_column,
                                  const ColumnString* to_tz_column, ReturnColumnType* result_column,
                                  NullMap& result_null_map, size_t input_rows_count) {
-        auto from_tz = from_tz_column->get_data_at(0).to_string();
-        auto to_tz = to_tz_column->get_data_at(0).to_string();
-        for (size_t i = 0; i < input_rows_count; i++) {
-            if (result_null_map[i]) {
-                result_column->insert_default();
-                continue;
-            }
-            execute_inner_loop(date_column, from_tz, to_tz, result_column, result_null_map, i);
-        }
+        // The time zones are looked up once for the block.
+        ConvertTzState state;
+        state.is_valid = TimezoneUtils::find_cctz_time_zone(
+                                 from_tz_column->get_data_at(0).to_string(), state.from_tz) &&
+                         TimezoneUtils::find_cctz_time_zone(
+                                 to_tz_column->get_data_at(0).to_string(), state.to_tz);
+        execute_tz_const_with_state(&state, date_column, result_column, result_null_map,
+                                    input_rows_count);
     }
 
     static void execute_inner_loop(const ColumnType* date_column, const std::string& from_tz_name,
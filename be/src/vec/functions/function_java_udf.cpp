@@ -17,12 +17,15 @@
 
 #include "vec/functions/function_java_udf.h"
 
+#include <arrow/c/abi.h>
+
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "jni.h"
 #include "runtime/user_function_cache.h"
+#include "util/defer_op.h"
 #include "util/jni-util.h"
 #include "vec/columns/column.h"
 #include "vec/common/assert_cast.h"
@@ -33,6 +36,7 @@ const char* EXECUTOR_CLASS = "org/apache/doris/udf/UdfExecutor";
 const char* EXECUTOR_CTOR_SIGNATURE = "([B)V";
 const char* EXECUTOR_EVALUATE_SIGNATURE = "(Ljava/util/Map;Ljava/util/Map;)J";
 const char* EXECUTOR_CLOSE_SIGNATURE = "()V";
+const char* EXECUTOR_EVALUATE_ARROW_SIGNATURE = "(JJJJ)V";
 
 namespace doris::vectorized {
 JavaFunctionCall::JavaFunctionCall(const TFunction& fn, const DataTypes& argument_types,
@@ -76,6 +80,12 @@ Status JavaFunctionCall::open(FunctionContext* context, FunctionContext::Functio
                     env->GetMethodID(jni_ctx->executor_cl, "evaluate", EXECUTOR_EVALUATE_SIGNATURE);
             jni_ctx->executor_close_id =
                     env->GetMethodID(jni_ctx->executor_cl, "close", EXECUTOR_CLOSE_SIGNATURE);
+            // Optional, only the executors accepting arrow batches implement it.
+            jni_ctx->executor_evaluate_arrow_id = env->GetMethodID(
+                    jni_ctx->executor_cl, "evaluateArrow", EXECUTOR_EVALUATE_ARROW_SIGNATURE);
+            if (jni_ctx->executor_evaluate_arrow_id == nullptr) {
+                env->ExceptionClear();
+            }
             jni_ctx->executor = env->NewObject(jni_ctx->executor_cl, jni_ctx->executor_ctor_id,
                                                ctor_params_bytes);
 
@@ -98,6 +108,9 @@ Status JavaFunctionCall::execute_impl(FunctionContext* context, Block& block,
     JniContext* jni_ctx = reinterpret_cast<JniContext*>(
             context->get_function_state(FunctionContext::THREAD_LOCAL));
     SCOPED_TIMER(context->get_udf_execute_timer());
+    if (jni_ctx->executor_evaluate_arrow_id != nullptr) {
+        return _execute_arrow(env, jni_ctx, block, arguments, result, num_rows);
+    }
     std::unique_ptr<long[]> input_table;
     RETURN_IF_ERROR(JniConnector::to_java_table(&block, num_rows, arguments, input_table));
     auto input_table_schema = JniConnector::parse_table_schema(&block, arguments, true);
@@ -125,6 +138,30 @@ Status JavaFunctionCall::execute_impl(FunctionContext* context, Block& block,
     return JniConnector::fill_block(&block, {result}, output_address);
 }
 
+Status JavaFunctionCall::_execute_arrow(JNIEnv* env, JniContext* jni_ctx, Block& block,
+                                        const ColumnNumbers& arguments, uint32_t result,
+                                        size_t num_rows) const {
+    ArrowArray input_array {};
+    ArrowSchema input_schema {};
+    ArrowArray output_array {};
+    ArrowSchema output_schema {};
+    Defer release_batches {[&]() {
+        JniConnector::release_arrow_batch(&input_array, &input_schema);
+        JniConnector::release_arrow_batch(&output_array, &output_schema);
+    }};
+    RETURN_IF_ERROR(JniConnector::to_arrow_batch(block, arguments, &input_array, &input_schema));
+    // UdfExecutor.evaluateArrow(long inputArray, long inputSchema, long outputArray,
+    // long outputSchema) imports the arguments and exports the result column.
+    env->CallVoidMethod(jni_ctx->executor, jni_ctx->executor_evaluate_arrow_id,
+                        reinterpret_cast<jlong>(&input_array),
+                        reinterpret_cast<jlong>(&input_schema),
+                        reinterpret_cast<jlong>(&output_array),
+                        reinterpret_cast<jlong>(&output_schema));
+    RETURN_ERROR_IF_EXC(env);
+    return JniConnector::fill_block_from_arrow(&block, {result}, num_rows, &output_array,
+                                               &output_schema);
+}
+
 Status JavaFunctionCall::close(FunctionContext* context,
                                FunctionContext::FunctionStateScope scope) {
     JniContext* jni_ctx = reinterpret_cast<JniContext*>(
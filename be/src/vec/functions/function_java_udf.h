@@ -121,6 +121,8 @@ private:
         jmethodID executor_ctor_id;
         jmethodID executor_evaluate_id;
         jmethodID executor_close_id;
+        // optional, evaluates the arguments exported by the arrow c data interface
+        jmethodID executor_evaluate_arrow_id = nullptr;
         jobject executor = nullptr;
         bool is_closed = false;
         bool open_successes = false;
@@ -152,6 +154,11 @@ private:
             return Status::OK();
         }
     };
+
+    // Passes the arguments to and gets the result from the java side by the arrow c data
+    // interface, used if the executor implements evaluateArrow.
+    Status _execute_arrow(JNIEnv* env, JniContext* jni_ctx, Block& block,
+                          const ColumnNumbers& arguments, uint32_t result, size_t num_rows) const;
 };
 
 } // namespace doris::vectorized
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <glog/logging.h>
+#include <parallel_hashmap/phmap.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 #include <string>
@@ -24,6 +26,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "CLucene/util/stringUtil.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -70,6 +73,96 @@ enum class NullalbeMode { NULLABLE = 0, FOLLOW_INPUT };
 
 enum class JsonbParseErrorMode { FAIL = 0, RETURN_NULL, RETURN_VALUE };
 
+// The json paths of the constant path arguments of a function, which are parsed once in open
+// instead of once per block.
+struct JsonbConstPathsState {
+    struct ConstPath {
+        std::string text; // the legs of the path point into the text
+        JsonbPath path;
+    };
+    // indexed by the argument, nullptr if the argument is not a constant valid path
+    std::vector<std::unique_ptr<ConstPath>> paths;
+
+    static Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
+        if (scope != FunctionContext::THREAD_LOCAL) {
+            return Status::OK();
+        }
+        auto state = std::make_shared<JsonbConstPathsState>();
+        state->paths.resize(context->get_num_args());
+        for (int i = 1; i < context->get_num_args(); ++i) {
+            if (!context->is_col_constant(i)) {
+                continue;
+            }
+            const auto& column = context->get_constant_col(i)->column_ptr;
+            if (column->is_null_at(0)) {
+                continue;
+            }
+            auto path = std::make_unique<ConstPath>();
+            path->text = column->get_data_at(0).to_string();
+            // An invalid path is reported when the function is executed.
+            if (path->path.seek(path->text.data(), path->text.size())) {
+                state->paths[i] = std::move(path);
+            }
+        }
+        context->set_function_state(scope, state);
+        return Status::OK();
+    }
+
+    // Returns the parsed path of the argument, nullptr if it is not parsed in open.
+    static JsonbPath* get(FunctionContext* context, size_t argument) {
+        const auto* state = reinterpret_cast<JsonbConstPathsState*>(
+                context->get_function_state(FunctionContext::THREAD_LOCAL));
+        if (state == nullptr || argument >= state->paths.size() ||
+            state->paths[argument] == nullptr) {
+            return nullptr;
+        }
+        return &state->paths[argument]->path;
+    }
+};
+
+// Finds the members of a json object by hash. Used when many paths look up the members of the
+// same object, which otherwise scans the members once per path.
+class JsonbObjectIndex {
+public:
+    // Whether the first leg of the path is a member which can be looked up in the index.
+    static bool can_find(const JsonbPath& path) {
+        if (path.get_leg_vector_size() == 0) {
+            return false;
+        }
+        const auto* leg = path.get_leg_from_leg_vector(0);
+        return leg->type == MEMBER_CODE && leg->leg_len > 0 &&
+               !(leg->leg_len == 1 && *leg->leg_ptr == WILDCARD);
+    }
+
+    void reset(const ObjectVal& object) {
+        _members.clear();
+        for (const auto& member : object) {
+            // The members with a key id can not be found by name.
+            if (member.klen() > 0) {
+                _members.try_emplace(StringRef(member.getKeyStr(), member.klen()),
+                                     member.value());
+            }
+        }
+    }
+
+    // Same as object.findValue(path) for the paths which can be found.
+    JsonbFindResult find_value(JsonbPath& path) const {
+        const auto* leg = path.get_leg_from_leg_vector(0);
+        auto iter = _members.find(StringRef(leg->leg_ptr, leg->leg_len));
+        if (iter == _members.end()) {
+            return {};
+        }
+        return iter->second->findValue(path, 1);
+    }
+
+private:
+    phmap::flat_hash_map<StringRef, const JsonbValue*, StringRefHash> _members;
+};
+
+// The number of the paths looking up the members of an object from which the members are
+// indexed by hash.
+constexpr size_t JSONB_OBJECT_INDEX_MIN_PATHS = 4;
+
 // func(string,string) -> json
 template <NullalbeMode nullable_mode, JsonbParseErrorMode parse_error_handle_mode>
 class FunctionJsonbParseBase : public IFunction {
@@ -381,6 +474,10 @@ public:
         }
     }
 
+    Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override {
+        return JsonbConstPathsState::open(context, scope);
+    }
+
     Status execute_impl(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                         uint32_t result, size_t input_rows_count) const override {
         DCHECK_GE(arguments.size(), 2);
@@ -909,6 +1006,13 @@ public:
         // reuseable json path list, espacially for const path
         std::vector<JsonbPath> json_path_list;
         json_path_list.resize(rdata_columns.size());
+        // the paths looked up, the constant paths parsed in open are not parsed again
+        std::vector<JsonbPath*> paths(rdata_columns.size());
+        for (size_t pi = 0; pi < rdata_columns.size(); pi++) {
+            JsonbPath* const_path =
+                    path_const[pi] ? JsonbConstPathsState::get(context, pi + 1) : nullptr;
+            paths[pi] = const_path != nullptr ? const_path : &json_path_list[pi];
+        }
 
         // lambda function to parse json path for row i and path pi
         auto parse_json_path = [&](size_t i, size_t pi) -> Status {
@@ -932,14 +1036,23 @@ public:
             return Status::OK();
         };
 
+        // the constant paths whose first legs are looked up in the index of the root object
+        std::vector<bool> find_in_index(rdata_columns.size(), false);
         for (size_t pi = 0; pi < rdata_columns.size(); pi++) {
             if (path_const[pi]) {
                 if (r_null_maps[pi] && (*r_null_maps[pi])[0]) {
                     continue;
                 }
-                RETURN_IF_ERROR(parse_json_path(0, pi));
+                if (paths[pi] == &json_path_list[pi]) {
+                    RETURN_IF_ERROR(parse_json_path(0, pi));
+                }
+                find_in_index[pi] = JsonbObjectIndex::can_find(*paths[pi]);
             }
         }
+        const bool use_object_index =
+                static_cast<size_t>(std::ranges::count(find_in_index, true)) >=
+                JSONB_OBJECT_INDEX_MIN_PATHS;
+        JsonbObjectIndex object_index;
 
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
@@ -966,7 +1079,7 @@ public:
                     RETURN_IF_ERROR(parse_json_path(i, 0));
                 }
                 inner_loop_impl(i, res_data, res_offsets, null_map, formater, l_raw, l_size,
-                                json_path_list[0]);
+                                *paths[0]);
             } else { // will make array string to user
                 writer->reset();
                 bool has_value = false;
@@ -974,6 +1087,11 @@ public:
                 // doc is NOT necessary to be deleted since JsonbDocument will not allocate memory
                 JsonbDocument* doc = nullptr;
                 auto st = JsonbDocument::checkAndCreateDocument(l_raw, l_size, &doc);
+                const bool root_indexed = use_object_index && st.ok() && doc &&
+                                          doc->getValue() && doc->getValue()->isObject();
+                if (root_indexed) {
+                    object_index.reset(*doc->getValue()->unpack<ObjectVal>());
+                }
 
                 for (size_t pi = 0; pi < rdata_columns.size(); ++pi) {
                     if (!st.ok() || !doc || !doc->getValue()) [[unlikely]] {
@@ -990,7 +1108,9 @@ public:
                         RETURN_IF_ERROR(parse_json_path(i, pi));
                     }
 
-                    auto find_result = doc->getValue()->findValue(json_path_list[pi]);
+                    auto find_result = root_indexed && find_in_index[pi]
+                                               ? object_index.find_value(*paths[pi])
+                                               : doc->getValue()->findValue(*paths[pi]);
 
                     if (find_result.value) {
                         if (!has_value) {
@@ -1233,10 +1353,14 @@ public:
         size_t size = loffsets.size();
         res.resize(size);
 
-        JsonbPath path;
-        if (!path.seek(rdata.data, rdata.size)) {
-            return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
-                                           std::string_view(rdata.data, rdata.size));
+        JsonbPath parsed_path;
+        JsonbPath* path = JsonbConstPathsState::get(context, 1);
+        if (path == nullptr) {
+            if (!parsed_path.seek(rdata.data, rdata.size)) {
+                return Status::InvalidArgument("Json path error: Invalid Json Path for value: {}",
+                                               std::string_view(rdata.data, rdata.size));
+            }
+            path = &parsed_path;
         }
 
         for (size_t i = 0; i < loffsets.size(); i++) {
@@ -1249,7 +1373,7 @@ public:
             const char* l_raw_str = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
             int l_str_size = loffsets[i] - loffsets[i - 1];
 
-            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, path);
+            inner_loop_impl(i, res, null_map, l_raw_str, l_str_size, *path);
         } //for
         return Status::OK();
     } //function
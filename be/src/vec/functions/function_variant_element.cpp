@@ -157,10 +157,16 @@ private:
             (*result)->assume_mutable()->finalize();
             return Status::OK();
         } else {
-            auto mutable_src = src.clone_finalized();
-            auto* mutable_ptr = assert_cast<ColumnVariant*>(mutable_src.get());
+            // A finalized variant is read in place, so only the subcolumns under `field_name` are
+            // copied, cloning it would copy all the other paths of a wide variant too.
+            ColumnPtr finalized_src;
+            const ColumnVariant* finalized_ptr = &src;
+            if (!src.is_finalized()) {
+                finalized_src = src.clone_finalized();
+                finalized_ptr = assert_cast<const ColumnVariant*>(finalized_src.get());
+            }
             PathInData path(field_name);
-            ColumnVariant::Subcolumns subcolumns = mutable_ptr->get_subcolumns();
+            const ColumnVariant::Subcolumns& subcolumns = finalized_ptr->get_subcolumns();
             const auto* node = subcolumns.find_exact(path);
             MutableColumnPtr result_col;
             if (node != nullptr) {
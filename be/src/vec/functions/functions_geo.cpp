@@ -18,6 +18,11 @@
 #include "vec/functions/functions_geo.h"
 
 #include <glog/logging.h>
+#include <s2/s2cap.h>
+#include <s2/s2cell_id.h>
+#include <s2/s2cell_union.h>
+#include <s2/s2polygon.h>
+#include <s2/s2region_coverer.h>
 
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
@@ -604,6 +609,44 @@ struct StCircle {
     }
 };
 
+// The cells of an exterior covering of a polygon, multi polygon or circle. A point outside of
+// the cells is outside of the shape, which is much cheaper to check than the shape itself.
+class GeoCellCovering {
+public:
+    void init(const GeoShape& shape) {
+        S2RegionCoverer::Options options;
+        options.set_max_cells(GEO_COVERING_MAX_CELLS);
+        S2RegionCoverer coverer(options);
+        switch (shape.type()) {
+        case GEO_SHAPE_POLYGON:
+            _cells = coverer.GetCovering(*assert_cast<const GeoPolygon&>(shape).polygon());
+            break;
+        case GEO_SHAPE_MULTI_POLYGON:
+            for (const auto& polygon : assert_cast<const GeoMultiPolygon&>(shape).polygons()) {
+                _cells = _cells.Union(coverer.GetCovering(*polygon->polygon()));
+            }
+            break;
+        case GEO_SHAPE_CIRCLE:
+            _cells = coverer.GetCovering(*assert_cast<const GeoCircle&>(shape).circle());
+            break;
+        default:
+            return;
+        }
+        _initialized = true;
+    }
+
+    bool excludes(const GeoShape& shape) const {
+        return _initialized && shape.type() == GEO_SHAPE_POINT &&
+               !_cells.Contains(S2CellId(*assert_cast<const GeoPoint&>(shape).point()));
+    }
+
+private:
+    static constexpr int GEO_COVERING_MAX_CELLS = 16;
+
+    bool _initialized = false;
+    S2CellUnion _cells;
+};
+
 template <typename Func>
 struct StRelationFunction {
     static constexpr auto NAME = Func::NAME;
@@ -654,23 +697,48 @@ struct StRelationFunction {
         }
     }
 
+    // The constant shape is decoded once instead of for every row.
     static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
         auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
+        std::unique_ptr<GeoShape> lhs(GeoShape::from_encoded(lhs_value.data, lhs_value.size));
+        if (!lhs) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        GeoCellCovering covering;
+        if constexpr (Func::PRUNE_BY_COVERING) {
+            covering.init(*lhs);
+        }
+        auto& res_data = res->get_data();
         for (int row = 0; row < size; ++row) {
             auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+            std::unique_ptr<GeoShape> rhs(GeoShape::from_encoded(rhs_value.data, rhs_value.size));
+            if (!rhs) {
+                null_map[row] = 1;
+            } else if (!covering.excludes(*rhs)) {
+                res_data[row] = Func::evaluate(lhs.get(), rhs.get());
+            }
         }
     }
 
     static void vector_const(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              ColumnUInt8::MutablePtr& res, NullMap& null_map, const size_t size) {
         auto rhs_value = right_column->get_data_at(0);
-        std::vector<std::unique_ptr<GeoShape>> shapes(2);
+        std::unique_ptr<GeoShape> rhs(GeoShape::from_encoded(rhs_value.data, rhs_value.size));
+        if (!rhs) {
+            std::fill(null_map.begin(), null_map.end(), 1);
+            return;
+        }
+        auto& res_data = res->get_data();
         for (int row = 0; row < size; ++row) {
             auto lhs_value = left_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, res, null_map, row);
+            std::unique_ptr<GeoShape> lhs(GeoShape::from_encoded(lhs_value.data, lhs_value.size));
+            if (!lhs) {
+                null_map[row] = 1;
+            } else {
+                res_data[row] = Func::evaluate(lhs.get(), rhs.get());
+            }
         }
     }
 
@@ -687,21 +755,26 @@ struct StRelationFunction {
 
 struct StContainsFunc {
     static constexpr auto NAME = "st_contains";
+    // A constant shape does not contain the points outside of its covering.
+    static constexpr bool PRUNE_BY_COVERING = true;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->contains(shape2); }
 };
 
 struct StIntersectsFunc {
     static constexpr auto NAME = "st_intersects";
+    static constexpr bool PRUNE_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->intersects(shape2); }
 };
 
 struct StDisjointFunc {
     static constexpr auto NAME = "st_disjoint";
+    static constexpr bool PRUNE_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->disjoint(shape2); }
 };
 
 struct StTouchesFunc {
     static constexpr auto NAME = "st_touches";
+    static constexpr bool PRUNE_BY_COVERING = false;
     static bool evaluate(GeoShape* shape1, GeoShape* shape2) { return shape1->touches(shape2); }
 };
 
@@ -21,6 +21,7 @@
 #include "vec/functions/ip_address_dictionary.h"
 
 #include <algorithm>
+#include <limits>
 #include <ranges>
 #include <vector>
 
@@ -44,8 +45,8 @@ IPAddressDictionary::~IPAddressDictionary() {
     if (_mem_tracker) {
         std::vector<IPv6> {}.swap(ip_column);
         std::vector<UInt8> {}.swap(prefix_column);
-        std::vector<size_t> {}.swap(origin_row_idx_column);
-        std::vector<size_t> {}.swap(parent_subnet);
+        std::vector<RowIdx> {}.swap(origin_row_idx_column);
+        std::vector<RowIdx> {}.swap(parent_subnet);
     }
 }
 
@@ -206,9 +207,16 @@ void IPAddressDictionary::load_data(const ColumnPtr& key_column,
 
     // Construct an IP trie
 
+    if (key_column->size() > std::numeric_limits<RowIdx>::max()) {
+        throw doris::Exception(ErrorCode::INVALID_ARGUMENT,
+                               DICT_DATA_ERROR_TAG + "IpAddressDictionary has too many rows: {}",
+                               key_column->size());
+    }
+
     // Step 1: Import the CIDR data.
     // Record the parsed CIDR and the corresponding row from the original data.
     std::vector<IPRecord> ip_records;
+    ip_records.reserve(key_column->size());
     auto load_key_str = [&](const auto* str_column) {
         for (size_t i = 0; i < str_column->size(); i++) {
             auto ip_str = str_column->get_data_at(i);
@@ -257,10 +265,14 @@ void IPAddressDictionary::load_data(const ColumnPtr& key_column,
     //     UInt8 prefix;
     //     size_t origin_row_idx;
     // };
+    // The columns are sized exactly, they are kept as long as the dictionary.
+    ip_column.reserve(ip_records.size());
+    prefix_column.reserve(ip_records.size());
+    origin_row_idx_column.reserve(ip_records.size());
     for (const auto& record : ip_records) {
         ip_column.push_back(record.to_ipv6());
         prefix_column.push_back(record.prefix());
-        origin_row_idx_column.push_back(record.row);
+        origin_row_idx_column.push_back(static_cast<RowIdx>(record.row));
     }
 
     // Step 4: Construct subnet relationships.
@@ -277,14 +289,14 @@ void IPAddressDictionary::load_data(const ColumnPtr& key_column,
     // parent_subnet[0] = 0 (itself)
 
     parent_subnet.resize(ip_records.size());
-    std::stack<size_t> subnets_stack;
+    std::stack<RowIdx> subnets_stack;
     // Use monotonic stack to build IP subnet relationships in trie structure
     // https://liuzhenglaichn.gitbook.io/algorithm/monotonic-stack
     // Note: The final structure may result in multiple trees rather than a single tree
-    for (auto i = 0; i < ip_records.size(); i++) {
+    for (RowIdx i = 0; i < ip_records.size(); i++) {
         parent_subnet[i] = i;
         while (!subnets_stack.empty()) {
-            size_t pi = subnets_stack.top();
+            RowIdx pi = subnets_stack.top();
 
             auto cur_address_ip = ip_records[i].to_ipv6();
             const auto* addr = reinterpret_cast<UInt8*>(&cur_address_ip);
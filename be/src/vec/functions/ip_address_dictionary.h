@@ -62,7 +62,9 @@ public:
     size_t allocated_bytes() const override;
 
 private:
-    using RowIdxConstIter = std::vector<size_t>::const_iterator;
+    // The rows and the subnets are indexed by UInt32, which halves the memory of the indexes.
+    using RowIdx = UInt32;
+    using RowIdxConstIter = std::vector<RowIdx>::const_iterator;
 
     RowIdxConstIter ip_not_found() const { return origin_row_idx_column.end(); }
 
@@ -74,9 +76,9 @@ private:
 
     std::vector<UInt8> prefix_column;
 
-    std::vector<size_t> origin_row_idx_column;
+    std::vector<RowIdx> origin_row_idx_column;
 
-    std::vector<size_t> parent_subnet;
+    std::vector<RowIdx> parent_subnet;
 };
 
 inline DictionaryPtr create_ip_trie_dict_from_column(const std::string& name,
@@ -33,6 +33,7 @@
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/functions/regexps.h"
 #include "vec/functions/simple_function_factory.h"
 
 namespace doris::vectorized {
@@ -1015,6 +1016,50 @@ Status FunctionRegexpLike::open(FunctionContext* context,
     return Status::OK();
 }
 
+std::unique_ptr<MultiPatternMatcher> MultiPatternMatcher::create(
+        const std::vector<std::string>& like_patterns,
+        const std::vector<std::string>& regexp_patterns) {
+    std::vector<std::string> patterns;
+    patterns.reserve(like_patterns.size() + regexp_patterns.size());
+    for (const auto& pattern : like_patterns) {
+        std::string re_pattern;
+        FunctionLike::convert_like_pattern(nullptr, pattern, &re_pattern);
+        patterns.push_back(std::move(re_pattern));
+    }
+    patterns.insert(patterns.end(), regexp_patterns.begin(), regexp_patterns.end());
+    std::vector<StringRef> pattern_refs(patterns.begin(), patterns.end());
+    try {
+        auto holder = multiregexps::getOrSet</*save_indices*/ false, /*WithEditDistance*/ false>(
+                pattern_refs, std::nullopt);
+        auto* regexps = holder->get();
+        return std::unique_ptr<MultiPatternMatcher>(
+                new MultiPatternMatcher(std::move(holder), regexps));
+    } catch (const Exception& e) {
+        // e.g. back references, which are supported by re2 only
+        VLOG_DEBUG << "fall back to matching the patterns one by one: " << e.what();
+        return nullptr;
+    }
+}
+
+Status MultiPatternMatcher::match(const ColumnString& values,
+                                  ColumnUInt8::Container& result) const {
+    hs_scratch_t* scratch = nullptr;
+    if (hs_clone_scratch(_regexps->getScratch(), &scratch) != HS_SUCCESS) {
+        return Status::InternalError("could not clone scratch space for hyperscan");
+    }
+    multiregexps::ScratchPtr scratch_holder(scratch);
+    const size_t size = values.size();
+    for (size_t i = 0; i < size; ++i) {
+        const auto& str_ref = values.get_data_at(i);
+        auto ret = hs_scan(_regexps->getDB(), str_ref.data, (unsigned int)str_ref.size, 0, scratch,
+                           LikeSearchState::hs_match_handler, (void*)(result.data() + i));
+        if (ret != HS_SUCCESS && ret != HS_SCAN_TERMINATED) {
+            return Status::RuntimeError(fmt::format("hyperscan error: {}", ret));
+        }
+    }
+    return Status::OK();
+}
+
 void register_function_like(SimpleFunctionFactory& factory) {
     factory.register_function<FunctionLike>();
 }
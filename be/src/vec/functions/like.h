@@ -45,6 +45,10 @@
 namespace doris {
 namespace vectorized {
 class Block;
+namespace multiregexps {
+class DeferredConstructedRegexps;
+class Regexps;
+} // namespace multiregexps
 } // namespace vectorized
 } // namespace doris
 
@@ -286,6 +290,7 @@ public:
                                              bool try_hyperscan = true);
 
     friend struct LikeSearchState;
+    friend class MultiPatternMatcher;
     friend struct VectorAllpassSearchState;
     friend struct VectorEqualSearchState;
     friend struct VectorSubStringSearchState;
@@ -317,4 +322,27 @@ public:
     Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) override;
 };
 
+// Matches a string column against the disjunction of LIKE and REGEXP patterns, e.g.
+// `msg LIKE '%timeout%' OR msg LIKE 'ERROR%' OR msg REGEXP 'code=5\d\d'`, with one hyperscan
+// scan of each row instead of one scan per pattern.
+class MultiPatternMatcher {
+public:
+    // Returns nullptr if hyperscan can not compile a pattern.
+    static std::unique_ptr<MultiPatternMatcher> create(
+            const std::vector<std::string>& like_patterns,
+            const std::vector<std::string>& regexp_patterns);
+
+    // Sets the result of the rows matching any pattern to 1, the other results are untouched.
+    Status match(const ColumnString& values, ColumnUInt8::Container& result) const;
+
+private:
+    MultiPatternMatcher(std::shared_ptr<multiregexps::DeferredConstructedRegexps> holder,
+                        multiregexps::Regexps* regexps)
+            : _holder(std::move(holder)), _regexps(regexps) {}
+
+    // Keeps the compiled patterns alive after they are evicted from the global cache.
+    std::shared_ptr<multiregexps::DeferredConstructedRegexps> _holder;
+    multiregexps::Regexps* _regexps;
+};
+
 } // namespace doris::vectorized
@@ -298,6 +298,13 @@ bool VerticalMergeIteratorContext::compare(const VerticalMergeIteratorContext& r
     return result;
 }
 
+bool VerticalMergeIteratorContext::is_cur_block_less_than(
+        const VerticalMergeIteratorContext& rhs) const {
+    DCHECK(_key_group_cluster_key_idxes.empty());
+    return _block->compare_at(_block->rows() - 1, rhs._index_in_block, _num_key_columns,
+                              *rhs._block, -1) < 0;
+}
+
 Status VerticalMergeIteratorContext::copy_rows(Block* block, size_t count) {
     Block& src = *_block;
     Block& dst = *block;
@@ -446,37 +453,58 @@ Status VerticalHeapMergeIterator::next_batch(Block* block) {
 
         auto ctx = _merge_heap.top();
         _merge_heap.pop();
-        if (ctx->is_same()) {
-            tmp_row_sources.emplace_back(ctx->order(), true);
-        } else {
-            tmp_row_sources.emplace_back(ctx->order(), false);
-        }
-        if (ctx->is_same() &&
-            ((_keys_type == KeysType::UNIQUE_KEYS && _key_group_cluster_key_idxes.empty()) ||
-             _keys_type == KeysType::AGG_KEYS)) {
-            // skip cur row, copy pre ctx
-            ++_merged_rows;
+        // The rowsets of a compaction are mostly not overlapping, if the rest of the current
+        // block is less than the rows of the other contexts, copy it without the heap.
+        if (!ctx->is_same() && _key_group_cluster_key_idxes.empty() && ctx->remain_rows() > 1 &&
+            (_merge_heap.empty() || ctx->is_cur_block_less_than(*_merge_heap.top()))) {
             if (pre_ctx) {
                 RETURN_IF_ERROR(pre_ctx->copy_rows(block));
                 pre_ctx = nullptr;
             }
+            size_t num_rows = std::min(ctx->remain_rows(), _block_row_max - row_idx);
+            tmp_row_sources.insert(tmp_row_sources.end(), num_rows,
+                                   RowSource(ctx->order(), false));
+            if (UNLIKELY(_record_rowids)) {
+                for (size_t i = 0; i < num_rows; ++i) {
+                    _block_row_locations[row_idx + i] = ctx->current_row_location(i);
+                }
+            }
+            row_idx += num_rows;
+            // the context is at the last copied row after copy_rows
+            RETURN_IF_ERROR(ctx->copy_rows(block, num_rows));
         } else {
-            ctx->add_cur_batch();
-            if (pre_ctx != ctx) {
+            if (ctx->is_same()) {
+                tmp_row_sources.emplace_back(ctx->order(), true);
+            } else {
+                tmp_row_sources.emplace_back(ctx->order(), false);
+            }
+            if (ctx->is_same() &&
+                ((_keys_type == KeysType::UNIQUE_KEYS && _key_group_cluster_key_idxes.empty()) ||
+                 _keys_type == KeysType::AGG_KEYS)) {
+                // skip cur row, copy pre ctx
+                ++_merged_rows;
                 if (pre_ctx) {
                     RETURN_IF_ERROR(pre_ctx->copy_rows(block));
+                    pre_ctx = nullptr;
+                }
+            } else {
+                ctx->add_cur_batch();
+                if (pre_ctx != ctx) {
+                    if (pre_ctx) {
+                        RETURN_IF_ERROR(pre_ctx->copy_rows(block));
+                    }
+                    pre_ctx = ctx;
+                }
+                if (UNLIKELY(_record_rowids)) {
+                    _block_row_locations[row_idx] = ctx->current_row_location();
+                }
+                row_idx++;
+                if (ctx->is_cur_block_finished() || row_idx >= _block_row_max) {
+                    // current block finished, ctx not advance
+                    // so copy start_idx = (_index_in_block - _cur_batch_num + 1)
+                    RETURN_IF_ERROR(ctx->copy_rows(block, false));
+                    pre_ctx = nullptr;
                 }
-                pre_ctx = ctx;
-            }
-            if (UNLIKELY(_record_rowids)) {
-                _block_row_locations[row_idx] = ctx->current_row_location();
-            }
-            row_idx++;
-            if (ctx->is_cur_block_finished() || row_idx >= _block_row_max) {
-                // current block finished, ctx not advance
-                // so copy start_idx = (_index_in_block - _cur_batch_num + 1)
-                RETURN_IF_ERROR(ctx->copy_rows(block, false));
-                pre_ctx = nullptr;
             }
         }
 
@@ -162,6 +162,9 @@ public:
     Status block_reset(const std::shared_ptr<Block>& block);
     Status init(const StorageReadOptions& opts, CompactionSampleInfo* sample_info = nullptr);
     bool compare(const VerticalMergeIteratorContext& rhs) const;
+    // Return if the keys of all the remaining rows in the current block are less than
+    // the key of the current row of rhs.
+    bool is_cur_block_less_than(const VerticalMergeIteratorContext& rhs) const;
     Status copy_rows(Block* block, bool advanced = true);
     Status copy_rows(Block* block, size_t count);
 
@@ -191,9 +194,9 @@ public:
         ref->row_pos = _index_in_block;
     }
     bool inited() const { return _inited; }
-    RowLocation current_row_location() {
+    RowLocation current_row_location(size_t offset = 0) {
         DCHECK(_record_rowids);
-        return _block_row_locations[_index_in_block];
+        return _block_row_locations[_index_in_block + offset];
     }
 
     size_t bytes() {
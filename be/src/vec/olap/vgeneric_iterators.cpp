@@ -58,6 +58,12 @@ Status VStatisticsIterator::init(const StorageReadOptions& opts) {
         }
 
         _target_rows = _push_down_agg_type_opt == TPushAggOp::MINMAX ? 2 : _segment->num_rows();
+        if (_push_down_agg_type_opt == TPushAggOp::COUNT) {
+            auto it = opts.delete_bitmap.find(_segment->id());
+            if (it != opts.delete_bitmap.end() && it->second != nullptr) {
+                _target_rows -= it->second->cardinality();
+            }
+        }
         _init = true;
     }
 
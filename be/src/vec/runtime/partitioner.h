@@ -63,7 +63,10 @@ protected:
 template <typename ChannelIds>
 class Crc32HashPartitioner : public PartitionerBase {
 public:
-    Crc32HashPartitioner(int partition_count) : PartitionerBase(partition_count) {}
+    // `hash_seed` is the initial value of the crc, partitioners with different seeds spread the
+    // same keys differently.
+    Crc32HashPartitioner(int partition_count, uint32_t hash_seed = 0)
+            : PartitionerBase(partition_count), _hash_seed(hash_seed) {}
     ~Crc32HashPartitioner() override = default;
 
     Status init(const std::vector<TExpr>& texprs) override {
@@ -98,6 +101,7 @@ protected:
 
     VExprContextSPtrs _partition_expr_ctxs;
     mutable std::vector<uint32_t> _hash_vals;
+    const uint32_t _hash_seed;
 };
 
 struct ShuffleChannelIds {
@@ -113,5 +117,19 @@ struct SpillPartitionChannelIds {
         return ((l >> 16) | (l << 16)) % r;
     }
 };
+
+// Used to split a spilled partition again, the hash is mixed so that the rows of one partition,
+// which share some bits of the crc, are spread over all the sub partitions.
+struct SpillRePartitionChannelIds {
+    template <typename HashValueType>
+    HashValueType operator()(HashValueType l, size_t r) {
+        l ^= l >> 16;
+        l *= 0x85ebca6b;
+        l ^= l >> 13;
+        l *= 0xc2b2ae35;
+        l ^= l >> 16;
+        return l % r;
+    }
+};
 #include "common/compile_check_end.h"
 } // namespace doris::vectorized
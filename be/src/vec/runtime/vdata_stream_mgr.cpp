@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vdata_stream_mgr.h"
 
+#include <butil/iobuf.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/data.pb.h>
 #include <gen_cpp/internal_service.pb.h>
@@ -30,6 +31,7 @@
 
 #include "common/logging.h"
 #include "util/hash_util.hpp"
+#include "util/proto_util.h"
 #include "vec/runtime/vdata_stream_recvr.h"
 
 namespace doris {
@@ -111,15 +113,55 @@ Status VDataStreamMgr::find_recvr(const TUniqueId& fragment_instance_id, PlanNod
 
 Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
                                       ::google::protobuf::Closure** done,
-                                      const int64_t wait_for_worker) {
+                                      const int64_t wait_for_worker,
+                                      butil::IOBuf* attachment) {
+    ThreadCpuStopWatch cpu_time_stop_watch;
+    cpu_time_stop_watch.start();
+
+    std::vector<TUniqueId> fanout_instances;
+    std::vector<butil::IOBuf> column_values;
+    if (attachment != nullptr && !attachment->empty()) {
+        RETURN_IF_ERROR(attachment_extract_fanout_instances(attachment, &fanout_instances));
+    }
+    if (attachment != nullptr && !attachment->empty()) {
+        RETURN_IF_ERROR(attachment_extract_column_values(*request, attachment, &column_values));
+    }
+
     const PUniqueId& finst_id = request->finst_id();
     TUniqueId t_finst_id;
     t_finst_id.hi = finst_id.hi();
     t_finst_id.lo = finst_id.lo();
+    if (fanout_instances.empty()) {
+        return _transmit_block(t_finst_id, request, done, wait_for_worker, column_values, true,
+                               cpu_time_stop_watch);
+    }
+
+    // A broadcast block sent once to this backend, hand it to the listed local instances too.
+    // The blocks of the request are moved to the last one. The sender only stops sending if
+    // none of them needs more data.
+    fanout_instances.push_back(t_finst_id);
+    bool all_eof = true;
+    for (size_t i = 0; i < fanout_instances.size(); ++i) {
+        const bool is_last = i + 1 == fanout_instances.size();
+        auto st = _transmit_block(fanout_instances[i], request, is_last ? done : nullptr,
+                                  wait_for_worker, column_values, is_last, cpu_time_stop_watch);
+        if (st.is<ErrorCode::END_OF_FILE>()) {
+            continue;
+        }
+        RETURN_IF_ERROR(st);
+        all_eof = false;
+    }
+    return all_eof ? Status::EndOfFile("data stream receivers closed") : Status::OK();
+}
+
+Status VDataStreamMgr::_transmit_block(const TUniqueId& finst_id,
+                                       const PTransmitDataParams* request,
+                                       ::google::protobuf::Closure** done,
+                                       const int64_t wait_for_worker,
+                                       std::vector<butil::IOBuf>& column_values, bool move_blocks,
+                                       const ThreadCpuStopWatch& cpu_time_stop_watch) {
     std::shared_ptr<VDataStreamRecvr> recvr = nullptr;
-    ThreadCpuStopWatch cpu_time_stop_watch;
-    cpu_time_stop_watch.start();
-    static_cast<void>(find_recvr(t_finst_id, request->node_id(), &recvr));
+    static_cast<void>(find_recvr(finst_id, request->node_id(), &recvr));
     if (recvr == nullptr) {
         // The receiver may remove itself from the receiver map via deregister_recvr()
         // at any time without considering the remaining number of senders.
@@ -145,11 +187,32 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
         return Status::EndOfFile("data stream receiver is deconstructed");
     }
 
+    auto take_block = [&](const PBlock& block) {
+        auto pblock_ptr = std::make_unique<PBlock>();
+        if (move_blocks) {
+            pblock_ptr->Swap(const_cast<PBlock*>(&block));
+        } else {
+            pblock_ptr->CopyFrom(block);
+        }
+        return pblock_ptr;
+    };
+    // Column values still needed by other instances are shared by reference, not copied.
+    butil::IOBuf shared_column_values;
+    auto column_values_of = [&](int i) -> butil::IOBuf* {
+        if (column_values.empty()) {
+            return nullptr;
+        }
+        if (move_blocks) {
+            return &column_values[i];
+        }
+        shared_column_values = column_values[i];
+        return &shared_column_values;
+    };
+
     bool eos = request->eos();
     if (!request->blocks().empty()) {
         for (int i = 0; i < request->blocks_size(); i++) {
-            std::unique_ptr<PBlock> pblock_ptr = std::make_unique<PBlock>();
-            pblock_ptr->Swap(const_cast<PBlock*>(&request->blocks(i)));
+            std::unique_ptr<PBlock> pblock_ptr = take_block(request->blocks(i));
             auto pass_done = [&]() -> ::google::protobuf::Closure** {
                 // If it is eos, no callback is needed, done can be nullptr
                 if (eos) {
@@ -167,18 +230,21 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
             RETURN_IF_ERROR(recvr->add_block(
                     std::move(pblock_ptr), request->sender_id(), request->be_number(),
                     request->packet_seq() - request->blocks_size() + i, pass_done(),
-                    wait_for_worker, cpu_time_stop_watch.elapsed_time()));
+                    wait_for_worker, cpu_time_stop_watch.elapsed_time(), column_values_of(i)));
         }
     }
 
     // old logic, for compatibility
     if (request->has_block()) {
-        std::unique_ptr<PBlock> pblock_ptr {
-                const_cast<PTransmitDataParams*>(request)->release_block()};
+        std::unique_ptr<PBlock> pblock_ptr =
+                move_blocks ? std::unique_ptr<PBlock> {const_cast<PTransmitDataParams*>(request)
+                                                               ->release_block()}
+                            : take_block(request->block());
         RETURN_IF_ERROR(recvr->add_block(std::move(pblock_ptr), request->sender_id(),
                                          request->be_number(), request->packet_seq(),
                                          eos ? nullptr : done, wait_for_worker,
-                                         cpu_time_stop_watch.elapsed_time()));
+                                         cpu_time_stop_watch.elapsed_time(),
+                                         column_values_of(request->blocks_size())));
     }
 
     if (eos) {
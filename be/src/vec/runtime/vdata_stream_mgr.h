@@ -26,11 +26,17 @@
 #include <shared_mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "common/be_mock_util.h"
 #include "common/global_types.h"
 #include "common/status.h"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
+
+namespace butil {
+class IOBuf;
+} // namespace butil
 
 namespace google {
 #include "common/compile_check_begin.h"
@@ -66,12 +72,22 @@ public:
 
     Status deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
 
+    // `attachment` holds the column values of the blocks if the sender embedded them by
+    // `request_embed_column_values_in_attachment`, and the other local instances to deliver a
+    // broadcast request to if embedded by `request_embed_fanout_instances`.
     Status transmit_block(const PTransmitDataParams* request, ::google::protobuf::Closure** done,
-                          const int64_t wait_for_worker);
+                          const int64_t wait_for_worker, butil::IOBuf* attachment = nullptr);
 
     void cancel(const TUniqueId& fragment_instance_id, Status exec_status);
 
 private:
+    // Deliver the request to the receiver of `finst_id`. The blocks of the request are moved to it
+    // if `move_blocks`, otherwise copied.
+    Status _transmit_block(const TUniqueId& finst_id, const PTransmitDataParams* request,
+                           ::google::protobuf::Closure** done, const int64_t wait_for_worker,
+                           std::vector<butil::IOBuf>& column_values, bool move_blocks,
+                           const ThreadCpuStopWatch& cpu_time_stop_watch);
+
     std::shared_mutex _lock;
     using StreamMap = std::unordered_multimap<uint32_t, std::shared_ptr<VDataStreamRecvr>>;
     StreamMap _receiver_map;
@@ -101,6 +101,10 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
     RETURN_IF_ERROR(block_item.get_block(next_block));
     size_t block_byte_size = block_item.block_byte_size();
     COUNTER_UPDATE(_recvr->_deserialize_row_batch_timer, block_item.deserialize_time());
+    size_t num_blocks = 1;
+    if (_recvr->_coalesce_block_rows > 0) {
+        RETURN_IF_ERROR(_coalesce_queued_blocks(next_block, &block_byte_size, &num_blocks));
+    }
     COUNTER_UPDATE(_recvr->_decompress_timer, block->get_decompress_time());
     COUNTER_UPDATE(_recvr->_decompress_bytes, block->get_decompressed_bytes());
     _recvr->_memory_used_counter->update(-(int64_t)block_byte_size);
@@ -113,7 +117,8 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
         }
     }
 
-    if (!_pending_closures.empty()) {
+    // Every consumed block releases its memory, so one blocked sender can go on for each of them.
+    for (size_t i = 0; i < num_blocks && !_pending_closures.empty(); ++i) {
         auto closure_pair = _pending_closures.front();
         closure_pair.first->Run();
         int64_t elapse_time = closure_pair.second.elapsed_time();
@@ -131,6 +136,58 @@ Status VDataStreamRecvr::SenderQueue::get_batch(Block* block, bool* eos) {
     return Status::OK();
 }
 
+Status VDataStreamRecvr::SenderQueue::_coalesce_queued_blocks(BlockUPtr& block,
+                                                              size_t* block_byte_size,
+                                                              size_t* num_blocks) {
+    const size_t max_rows = _recvr->_coalesce_block_rows;
+    const auto max_bytes = static_cast<size_t>(config::exchange_receiver_coalesce_bytes);
+    size_t rows = block->rows();
+    size_t bytes = block->bytes();
+    if (rows >= max_rows || bytes >= max_bytes) {
+        return Status::OK();
+    }
+
+    // Only the blocks which have already arrived are merged, it never waits for more data,
+    // so a small block is not delayed and LIMIT queries are not stalled.
+    MutableBlock merged_block;
+    bool merged = false;
+    while (rows < max_rows && bytes < max_bytes) {
+        BlockItem block_item;
+        {
+            INJECT_MOCK_SLEEP(std::lock_guard<std::mutex> l(_lock));
+            if (_is_cancelled || _block_queue.empty()) {
+                break;
+            }
+            block_item = std::move(_block_queue.front());
+            _block_queue.pop_front();
+        }
+        BlockUPtr next_block;
+        RETURN_IF_ERROR(block_item.get_block(next_block));
+        COUNTER_UPDATE(_recvr->_deserialize_row_batch_timer, block_item.deserialize_time());
+        if (rows + next_block->rows() > max_rows) {
+            // Keep the deserialized block at the head of the queue for the next call.
+            INJECT_MOCK_SLEEP(std::lock_guard<std::mutex> l(_lock));
+            _block_queue.emplace_front(std::move(next_block), block_item.block_byte_size());
+            break;
+        }
+        if (!merged) {
+            materialize_block_inplace(*block);
+            merged_block = MutableBlock(block.get());
+            merged = true;
+        }
+        RETURN_IF_ERROR(merged_block.merge(*next_block));
+        rows += next_block->rows();
+        bytes += next_block->bytes();
+        *block_byte_size += block_item.block_byte_size();
+        ++*num_blocks;
+    }
+    if (merged) {
+        block->set_columns(std::move(merged_block.mutable_columns()));
+        COUNTER_UPDATE(_recvr->_coalesced_blocks_counter, *num_blocks - 1);
+    }
+    return Status::OK();
+}
+
 void VDataStreamRecvr::SenderQueue::set_source_ready(std::lock_guard<std::mutex>&) {
     // Here, it is necessary to check if _source_dependency is not nullptr.
     // This is because the queue might be closed before setting the source dependency.
@@ -147,7 +204,8 @@ Status VDataStreamRecvr::SenderQueue::add_block(std::unique_ptr<PBlock> pblock,
                                                 int64_t packet_seq,
                                                 ::google::protobuf::Closure** done,
                                                 const int64_t wait_for_worker,
-                                                const uint64_t time_to_find_recvr) {
+                                                const uint64_t time_to_find_recvr,
+                                                butil::IOBuf* column_values) {
     {
         INJECT_MOCK_SLEEP(std::lock_guard<std::mutex> l(_lock));
         if (_is_cancelled) {
@@ -178,7 +236,8 @@ Status VDataStreamRecvr::SenderQueue::add_block(std::unique_ptr<PBlock> pblock,
         return Status::OK();
     }
 
-    const auto block_byte_size = pblock->ByteSizeLong();
+    const auto block_byte_size =
+            pblock->ByteSizeLong() + (column_values != nullptr ? column_values->size() : 0);
     COUNTER_UPDATE(_recvr->_blocks_produced_counter, 1);
     if (_recvr->_max_wait_worker_time->value() < wait_for_worker) {
         _recvr->_max_wait_worker_time->set(wait_for_worker);
@@ -188,7 +247,7 @@ Status VDataStreamRecvr::SenderQueue::add_block(std::unique_ptr<PBlock> pblock,
         _recvr->_max_find_recvr_time->set((int64_t)time_to_find_recvr);
     }
 
-    _block_queue.emplace_back(std::move(pblock), block_byte_size);
+    _block_queue.emplace_back(std::move(pblock), column_values, block_byte_size);
     COUNTER_UPDATE(_recvr->_remote_bytes_received_counter, block_byte_size);
     _record_debug_info();
     set_source_ready(l);
@@ -364,6 +423,10 @@ VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr,
     _max_wait_worker_time = ADD_COUNTER(_profile, "MaxWaitForWorkerTime", TUnit::UNIT);
     _max_wait_to_process_time = ADD_COUNTER(_profile, "MaxWaitToProcessTime", TUnit::UNIT);
     _max_find_recvr_time = ADD_COUNTER(_profile, "MaxFindRecvrTime(NS)", TUnit::UNIT);
+    _coalesced_blocks_counter = ADD_COUNTER(_profile, "CoalescedBlocks", TUnit::UNIT);
+    if (config::enable_exchange_receiver_coalesce_blocks) {
+        _coalesce_block_rows = state->batch_size();
+    }
 }
 
 VDataStreamRecvr::~VDataStreamRecvr() {
@@ -393,7 +456,8 @@ Status VDataStreamRecvr::create_merger(const VExprContextSPtrs& ordering_expr,
 Status VDataStreamRecvr::add_block(std::unique_ptr<PBlock> pblock, int sender_id, int be_number,
                                    int64_t packet_seq, ::google::protobuf::Closure** done,
                                    const int64_t wait_for_worker,
-                                   const uint64_t time_to_find_recvr) {
+                                   const uint64_t time_to_find_recvr,
+                                   butil::IOBuf* column_values) {
     SCOPED_ATTACH_TASK(_resource_ctx);
     if (_query_context->low_memory_mode()) {
         set_low_memory_mode();
@@ -401,7 +465,8 @@ Status VDataStreamRecvr::add_block(std::unique_ptr<PBlock> pblock, int sender_id
 
     int use_sender_id = _is_merging ? sender_id : 0;
     return _sender_queues[use_sender_id]->add_block(std::move(pblock), be_number, packet_seq, done,
-                                                    wait_for_worker, time_to_find_recvr);
+                                                    wait_for_worker, time_to_find_recvr,
+                                                    column_values);
 }
 
 void VDataStreamRecvr::add_block(Block* block, int sender_id, bool use_move) {
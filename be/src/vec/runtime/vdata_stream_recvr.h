@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <butil/iobuf.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/data.pb.h>
 #include <glog/logging.h>
@@ -86,9 +87,12 @@ public:
 
     std::vector<SenderQueue*> sender_queues() const { return _sender_queues; }
 
+    // If `column_values` is not null, it holds the column values of `pblock` received in the
+    // brpc attachment, it is swapped into the queue instead of being copied.
     Status add_block(std::unique_ptr<PBlock> pblock, int sender_id, int be_number,
                      int64_t packet_seq, ::google::protobuf::Closure** done,
-                     const int64_t wait_for_worker, const uint64_t time_to_find_recvr);
+                     const int64_t wait_for_worker, const uint64_t time_to_find_recvr,
+                     butil::IOBuf* column_values = nullptr);
 
     void add_block(Block* block, int sender_id, bool use_move);
 
@@ -168,6 +172,10 @@ private:
     RuntimeProfile::Counter* _max_wait_worker_time = nullptr;
     RuntimeProfile::Counter* _max_wait_to_process_time = nullptr;
     RuntimeProfile::Counter* _max_find_recvr_time = nullptr;
+    RuntimeProfile::Counter* _coalesced_blocks_counter = nullptr;
+
+    // Target rows of the blocks coalesced by the sender queues, 0 means coalescing is disabled.
+    size_t _coalesce_block_rows = 0;
 
     std::vector<std::shared_ptr<pipeline::Dependency>> _sender_to_local_channel_dependency;
 };
@@ -183,7 +191,7 @@ public:
 
     Status add_block(std::unique_ptr<PBlock> pblock, int be_number, int64_t packet_seq,
                      ::google::protobuf::Closure** done, const int64_t wait_for_worker,
-                     const uint64_t time_to_find_recvr);
+                     const uint64_t time_to_find_recvr, butil::IOBuf* column_values = nullptr);
 
     void add_block(Block* block, bool use_move);
 
@@ -207,6 +215,10 @@ protected:
 
     void set_source_ready(std::lock_guard<std::mutex>&);
 
+    // Merge the queued blocks into `block` until it reaches the batch size or
+    // `exchange_receiver_coalesce_bytes`.
+    Status _coalesce_queued_blocks(BlockUPtr& block, size_t* block_byte_size, size_t* num_blocks);
+
     // To record information about several variables in the event of a DCHECK failure.
     //  DCHECK(_is_cancelled || !_block_queue.empty() || _num_remaining_senders == 0)
 #ifndef NDEBUG
@@ -269,7 +281,12 @@ protected:
                 DCHECK(_pblock);
                 SCOPED_RAW_TIMER(&_deserialize_time);
                 _block = Block::create_unique();
-                RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_block->deserialize(*_pblock));
+                if (_column_values_in_attachment) {
+                    RETURN_IF_ERROR_OR_CATCH_EXCEPTION(
+                            _block->deserialize(*_pblock, _column_values));
+                } else {
+                    RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_block->deserialize(*_pblock));
+                }
             }
             block.swap(_block);
             _block.reset();
@@ -285,9 +302,21 @@ protected:
         BlockItem(std::unique_ptr<PBlock>&& pblock, size_t block_byte_size)
                 : _block(nullptr), _pblock(std::move(pblock)), _block_byte_size(block_byte_size) {}
 
+        BlockItem(std::unique_ptr<PBlock>&& pblock, butil::IOBuf* column_values,
+                  size_t block_byte_size)
+                : BlockItem(std::move(pblock), block_byte_size) {
+            if (column_values != nullptr) {
+                _column_values.swap(*column_values);
+                _column_values_in_attachment = true;
+            }
+        }
+
     private:
         BlockUPtr _block;
         std::unique_ptr<PBlock> _pblock;
+        // Column values of `_pblock` kept in the received brpc buffers.
+        butil::IOBuf _column_values;
+        bool _column_values_in_attachment = false;
         size_t _block_byte_size = 0;
         int64_t _deserialize_time = 0;
     };
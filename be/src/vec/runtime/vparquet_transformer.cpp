@@ -20,6 +20,7 @@
 #include <arrow/io/type_fwd.h>
 #include <arrow/table.h>
 #include <arrow/util/key_value_metadata.h>
+#include <arrow/util/thread_pool.h>
 #include <glog/logging.h>
 #include <parquet/column_writer.h>
 #include <parquet/platform.h>
@@ -40,6 +41,7 @@
 #include "util/arrow/block_convertor.h"
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
+#include "util/cpu_info.h"
 #include "util/debug_util.h"
 #include "vec/exec/format/table/iceberg/arrow_schema_util.h"
 #include "vec/exprs/vexpr.h"
@@ -161,6 +163,27 @@ void ParquetBuildHelper::build_compression_type(
     }
 }
 
+// The pool encoding the column chunks of the parquet writers, null if they are encoded on the
+// sink threads. It is never destroyed, the writers may outlive any owner.
+static arrow::internal::Executor* parquet_encode_executor() {
+    static arrow::internal::Executor* executor = []() -> arrow::internal::Executor* {
+        int threads = config::parquet_writer_encode_thread_num;
+        if (threads < 0) {
+            threads = CpuInfo::num_cores();
+        }
+        if (threads <= 1) {
+            return nullptr;
+        }
+        auto pool = arrow::internal::ThreadPool::MakeEternal(threads);
+        if (!pool.ok()) {
+            LOG(WARNING) << "failed to create the parquet encode pool: " << pool.status();
+            return nullptr;
+        }
+        return pool->get();
+    }();
+    return executor;
+}
+
 void ParquetBuildHelper::build_version(parquet::WriterProperties::Builder& builder,
                                        const TParquetVersion::type& parquet_version) {
     switch (parquet_version) {
@@ -232,6 +255,12 @@ Status VParquetTransformer::_parse_properties() {
             arrow_builder.enable_deprecated_int96_timestamps();
         }
         arrow_builder.store_schema();
+        if (auto* executor = parquet_encode_executor();
+            executor != nullptr && _output_vexpr_ctxs.size() > 1) {
+            // WriteRecordBatch writes the columns of the buffered row group in parallel.
+            arrow_builder.set_use_threads(true);
+            arrow_builder.set_executor(executor);
+        }
         _arrow_properties = arrow_builder.build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
@@ -20,7 +20,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
 #include <vector>
 
 #include "common/status.h"
@@ -35,8 +34,8 @@ namespace doris::vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that maintains the run with the next
+// rows in sorted order at the top of the tree.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -54,8 +53,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree of the runs.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -74,10 +72,11 @@ protected:
     size_t _offset = 0;
 
     std::vector<std::shared_ptr<BlockSupplierSortCursorImpl>> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    LoserTree<MergeSortCursor> _loser_tree;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
-    /// we make it as a pending cursor until the supplier is readable.
+    /// we make it as a pending cursor until the supplier is readable. A pending cursor
+    /// stays at the top of the loser tree, it is replayed once its next block is read.
     std::shared_ptr<MergeSortCursorImpl> _pending_cursor = nullptr;
 
     // Times calls to get_next().
@@ -93,7 +92,7 @@ protected:
 private:
     void init_timers(RuntimeProfile* profile);
     // If current stream is exhausted and not eof, we should break this loop and read more blocks.
-    bool _need_more_data(MergeSortCursor& current);
+    bool _need_more_data(const MergeSortCursor& current);
 };
 
 } // namespace doris::vectorized
@@ -40,6 +40,7 @@
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/exec/result_file_sink_operator.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "runtime/types.h"
@@ -142,6 +143,10 @@ Status Channel::add_rows(Block* block, const uint32_t* data, const uint32_t offs
     Defer update_mem([&]() {
         COUNTER_UPDATE(_parent->memory_used_counter(), mem_usage() - old_channel_mem_usage);
     });
+    if (config::enable_exchange_adaptive_compression && _buffer != nullptr) {
+        _serializer.set_compression_type(
+                _buffer->compression_type(dest_ins_id(), _parent->compression_type()));
+    }
     RETURN_IF_ERROR(_serializer.next_serialized_block(block, _pblock.get(), 1, &serialized, eos,
                                                       data, offset, size));
     if (serialized) {
@@ -335,8 +340,10 @@ Status BlockSerializer::serialize_block(const Block* src, PBlock* dest, size_t n
     dest->Clear();
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
     RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest, &uncompressed_bytes,
-                                   &compressed_bytes, _parent->compression_type(),
-                                   _parent->transfer_large_data_by_brpc()));
+                                   &compressed_bytes,
+                                   _compression_type.value_or(_parent->compression_type()),
+                                   _parent->transfer_large_data_by_brpc(),
+                                   ExecEnv::GetInstance()->block_compression_thread_pool()));
     COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
     COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -95,11 +96,17 @@ public:
 
     void set_low_memory_mode(RuntimeState* state) { _buffer_mem_limit = 4 * 1024 * 1024; }
 
+    // Overwrite the compression type of the exchange sink, used by adaptive compression.
+    void set_compression_type(segment_v2::CompressionTypePB compression_type) {
+        _compression_type = compression_type;
+    }
+
 private:
     Status _serialize_block(PBlock* dest, size_t num_receivers = 1);
 
     pipeline::ExchangeSinkLocalState* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
+    std::optional<segment_v2::CompressionTypePB> _compression_type;
 
     bool _is_local;
     const int _batch_size;
@@ -29,6 +29,7 @@
 
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "common/cast_set.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -233,19 +234,52 @@ Status VMysqlResultWriter<is_binary_format>::_write_one_block(RuntimeState* stat
             }
         }
 
-        for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+        if constexpr (is_binary_format) {
+            // a binary row starts with the null bitmap of its columns, so it is built row by row
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const, _options));
+                }
+
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                bytes_sent += row_buffer.length();
+                row_buffer.reset();
+                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            }
+        } else {
+            // The text cells are serialized column by column into one buffer, which keeps the
+            // same serde and column hot in the inner loop, then every row is copied out of it
+            // with a single allocation.
+            std::vector<int64_t> cell_ends(num_cols * num_rows);
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const, _options));
+                const auto& argument = arguments[col_idx];
+                auto* ends = cell_ends.data() + col_idx * num_rows;
+                for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                    RETURN_IF_ERROR(argument.serde->write_column_to_mysql(
+                            *argument.column, row_buffer, row_idx, argument.is_const, _options));
+                    ends[row_idx] = row_buffer.length();
+                }
             }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
-                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+            auto cell_begin = [&](size_t cell) { return cell == 0 ? 0 : cell_ends[cell - 1]; };
+            for (int row_idx = 0; row_idx < num_rows; ++row_idx) {
+                int64_t row_size = 0;
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    const size_t cell = col_idx * num_rows + row_idx;
+                    row_size += cell_ends[cell] - cell_begin(cell);
+                }
+                // copy MysqlRowBuffer to Thrift
+                auto& row = result->result_batch.rows[row_idx];
+                row.reserve(row_size);
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    const size_t cell = col_idx * num_rows + row_idx;
+                    const auto begin = cell_begin(cell);
+                    row.append(row_buffer.buf() + begin, cell_ends[cell] - begin);
+                }
+                bytes_sent += row_size;
             }
         }
     }
@@ -19,11 +19,14 @@
 
 #include <aws/s3/model/CompletedPart.h>
 
+#include "common/config.h"
 #include "io/file_factory.h"
 #include "io/fs/s3_file_writer.h"
 #include "runtime/runtime_state.h"
 #include "vec/columns/column_map.h"
 #include "vec/core/materialize_block.h"
+#include "vec/core/sort_block.h"
+#include "vec/core/sort_description.h"
 #include "vec/runtime/vcsv_transformer.h"
 #include "vec/runtime/vorc_transformer.h"
 #include "vec/runtime/vparquet_transformer.h"
@@ -120,7 +123,13 @@ Status VHivePartitionWriter::open(RuntimeState* state, RuntimeProfile* operator_
 Status VHivePartitionWriter::close(const Status& status) {
     Status result_status;
     if (_file_format_transformer != nullptr) {
-        result_status = _file_format_transformer->close();
+        if (status.ok()) {
+            result_status = _flush_sort_buffer();
+        }
+        Status close_status = _file_format_transformer->close();
+        if (result_status.ok()) {
+            result_status = close_status;
+        }
         if (!result_status.ok()) {
             LOG(WARNING) << fmt::format("_file_format_transformer close failed, reason: {}",
                                         result_status.to_string());
@@ -142,11 +151,46 @@ Status VHivePartitionWriter::close(const Status& status) {
 }
 
 Status VHivePartitionWriter::write(vectorized::Block& block) {
+    if (config::hive_sink_sort_buffer_bytes > 0) {
+        if (_sort_buffer == nullptr) {
+            _sort_buffer = MutableBlock::create_unique(block.clone_empty());
+        }
+        RETURN_IF_ERROR(_sort_buffer->merge(block));
+        _row_count += block.rows();
+        if (_sort_buffer->allocated_bytes() >= config::hive_sink_sort_buffer_bytes) {
+            return _flush_sort_buffer();
+        }
+        return Status::OK();
+    }
     RETURN_IF_ERROR(_file_format_transformer->write(block));
     _row_count += block.rows();
     return Status::OK();
 }
 
+Status VHivePartitionWriter::_flush_sort_buffer() {
+    if (_sort_buffer == nullptr || _sort_buffer->rows() == 0) {
+        return Status::OK();
+    }
+    Block block = _sort_buffer->to_block();
+    // The table has no sort order in the sink, so the rows are ordered by the leading columns,
+    // which clusters the first one and breaks its ties by the next ones.
+    SortDescription sort_description;
+    for (int i = 0; i < block.columns(); ++i) {
+        if (!block.get_by_position(i).type->is_comparable()) {
+            break;
+        }
+        sort_description.emplace_back(i, 1, 1);
+    }
+    if (!sort_description.empty()) {
+        sort_block(block, block, sort_description);
+    }
+    RETURN_IF_ERROR(_file_format_transformer->write(block));
+    // reuse the memory of the columns for the next run
+    block.clear_column_data();
+    _sort_buffer = MutableBlock::create_unique(std::move(block));
+    return Status::OK();
+}
+
 THivePartitionUpdate VHivePartitionWriter::_build_partition_update() {
     THivePartitionUpdate hive_partition_update;
     hive_partition_update.__set_name(_partition_name);
@@ -21,6 +21,7 @@
 
 #include "io/fs/file_writer.h"
 #include "vec/columns/column.h"
+#include "vec/core/block.h"
 #include "vec/exprs/vexpr_fwd.h"
 #include "vec/runtime/vfile_format_transformer.h"
 
@@ -76,6 +77,9 @@ public:
 private:
     std::string _get_target_file_name();
 
+    // Sorts the buffered rows and writes them as one sorted run.
+    Status _flush_sort_buffer();
+
 private:
     THivePartitionUpdate _build_partition_update();
 
@@ -109,6 +113,8 @@ private:
     std::unique_ptr<doris::io::FileWriter> _file_writer = nullptr;
     // convert block to parquet/orc/csv format
     std::unique_ptr<VFileFormatTransformer> _file_format_transformer = nullptr;
+    // rows not written yet, see config::hive_sink_sort_buffer_bytes
+    std::unique_ptr<MutableBlock> _sort_buffer = nullptr;
 
     RuntimeState* _state;
 };
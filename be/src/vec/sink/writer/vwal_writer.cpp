@@ -21,6 +21,7 @@
 
 #include <sstream>
 
+#include "common/config.h"
 #include "util/debug_points.h"
 
 namespace doris {
@@ -69,9 +70,12 @@ Status VWalWriter::write_wal(vectorized::Block* block) {
                     { return Status::InternalError("Failed to write wal!"); });
     PBlock pblock;
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
+    // the compressed block is decompressed by Block::deserialize when the wal is replayed.
+    auto compression_type = config::enable_group_commit_wal_compression
+                                    ? segment_v2::CompressionTypePB::LZ4
+                                    : segment_v2::CompressionTypePB::NO_COMPRESSION;
     RETURN_IF_ERROR(block->serialize(_be_exe_version, &pblock, &uncompressed_bytes,
-                                     &compressed_bytes,
-                                     segment_v2::CompressionTypePB::NO_COMPRESSION));
+                                     &compressed_bytes, compression_type));
     RETURN_IF_ERROR(_wal_writer->append_blocks(std::vector<PBlock*> {&pblock}));
     return Status::OK();
 }
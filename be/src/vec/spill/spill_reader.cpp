@@ -22,9 +22,11 @@
 #include <algorithm>
 
 #include "common/cast_set.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
+#include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/slice.h"
@@ -46,10 +48,10 @@ Status SpillReader::open() {
 
     COUNTER_UPDATE(_read_file_count, 1);
 
-    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(file_path_, &file_reader_));
+    RETURN_IF_ERROR(data_dir_->fs()->open_file(file_path_, &file_reader_));
 
     size_t file_size = file_reader_->size();
-    DCHECK(file_size >= 16); // max_sub_block_size, block count
+    DCHECK(file_size >= 24); // column count, max_sub_block_size, block count
 
     Slice result((char*)&block_count_, sizeof(size_t));
 
@@ -59,7 +61,7 @@ Status SpillReader::open() {
     RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t), result, &bytes_read));
     DCHECK(bytes_read == 8); // max_sub_block_size, block count
     total_read_bytes += bytes_read;
-    if (_resource_ctx) {
+    if (_resource_ctx && !data_dir_->is_remote()) {
         _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes_read);
     }
 
@@ -69,24 +71,36 @@ Status SpillReader::open() {
     RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t) * 2, result, &bytes_read));
     DCHECK(bytes_read == 8); // max_sub_block_size, block count
     total_read_bytes += bytes_read;
-    if (_resource_ctx) {
+    if (_resource_ctx && !data_dir_->is_remote()) {
         _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes_read);
     }
 
-    size_t buff_size = std::max(block_count_ * sizeof(size_t), max_sub_block_size_);
+    // read column count
+    bytes_read = 0;
+    result.data = (char*)&column_count_;
+    RETURN_IF_ERROR(file_reader_->read_at(file_size - sizeof(size_t) * 3, result, &bytes_read));
+    DCHECK(bytes_read == 8);
+    total_read_bytes += bytes_read;
+    if (_resource_ctx && !data_dir_->is_remote()) {
+        _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(bytes_read);
+    }
+
+    const size_t offsets_size = block_count_ * (column_count_ + 1) * sizeof(size_t);
+    size_t buff_size = std::max(offsets_size, max_sub_block_size_);
     read_buff_.reserve(buff_size);
 
-    // read block start offsets
-    size_t read_offset = file_size - (block_count_ + 2) * sizeof(size_t);
+    // read block start offsets and column start offsets
+    size_t read_offset = file_size - 3 * sizeof(size_t) - offsets_size;
     result.data = read_buff_.data();
-    result.size = block_count_ * sizeof(size_t);
+    result.size = offsets_size;
 
     RETURN_IF_ERROR(file_reader_->read_at(read_offset, result, &bytes_read));
-    DCHECK(bytes_read == block_count_ * sizeof(size_t));
+    DCHECK(bytes_read == offsets_size);
     total_read_bytes += bytes_read;
     COUNTER_UPDATE(_read_file_size, total_read_bytes);
+    data_dir_->update_spill_read_bytes(total_read_bytes);
     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(total_read_bytes);
-    if (_resource_ctx) {
+    if (_resource_ctx && !data_dir_->is_remote()) {
         _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
     }
 
@@ -94,14 +108,41 @@ Status SpillReader::open() {
     for (size_t i = 0; i < block_count_; ++i) {
         block_start_offsets_[i] = *(size_t*)(result.data + i * sizeof(size_t));
     }
-    block_start_offsets_[block_count_] = file_size - (block_count_ + 2) * sizeof(size_t);
+    block_start_offsets_[block_count_] = read_offset;
+    column_start_offsets_.resize(block_count_ * column_count_);
+    for (size_t i = 0; i < column_start_offsets_.size(); ++i) {
+        column_start_offsets_[i] = *(size_t*)(result.data + (block_count_ + i) * sizeof(size_t));
+    }
 
+    local_file_reader_ = dynamic_cast<io::LocalFileReader*>(file_reader_.get());
+    read_ahead_end_ = 0;
+    _read_ahead(0);
     return Status::OK();
 }
 
 void SpillReader::seek(size_t block_index) {
     DCHECK_LT(block_index, block_count_);
     read_block_index_ = block_index;
+    read_ahead_end_ = 0;
+}
+
+void SpillReader::_read_ahead(size_t offset) {
+    if (local_file_reader_ == nullptr || config::spill_read_ahead_bytes <= 0) {
+        return;
+    }
+    const auto read_ahead_bytes = static_cast<size_t>(config::spill_read_ahead_bytes);
+    const size_t data_end = block_start_offsets_[block_count_];
+    // Every advice takes a syscall, so the window is only extended once half of it is consumed.
+    if (read_ahead_end_ >= data_end ||
+        (read_ahead_end_ > offset && read_ahead_end_ - offset >= read_ahead_bytes / 2)) {
+        return;
+    }
+    const size_t start = std::max(offset, read_ahead_end_);
+    const size_t end = std::min(data_end, offset + read_ahead_bytes);
+    if (end > start) {
+        local_file_reader_->advise_will_need(start, end - start);
+    }
+    read_ahead_end_ = std::max(read_ahead_end_, end);
 }
 
 Status SpillReader::read(Block* block, bool* eos) {
@@ -121,28 +162,60 @@ Status SpillReader::read(Block* block, bool* eos) {
         return Status::OK();
     }
 
-    Slice result(read_buff_.data(), bytes_to_read);
+    // The columns to read are read into read_buff_ one after another.
+    read_column_sizes_.clear();
     size_t bytes_read = 0;
-    {
+    if (read_column_ids_.empty()) {
+        Slice result(read_buff_.data(), bytes_to_read);
+        {
+            SCOPED_TIMER(_read_file_timer);
+            RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
+                                                  &bytes_read));
+        }
+        DCHECK(bytes_read == bytes_to_read);
+        _read_ahead(block_start_offsets_[read_block_index_ + 1]);
+        for (size_t column = 0; column < column_count_; ++column) {
+            read_column_sizes_.emplace_back(_column_offset(read_block_index_, column + 1) -
+                                            _column_offset(read_block_index_, column));
+        }
+    } else {
         SCOPED_TIMER(_read_file_timer);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+        for (auto column : read_column_ids_) {
+            DCHECK_LT(column, column_count_);
+            const size_t column_offset = _column_offset(read_block_index_, column);
+            const size_t column_size =
+                    _column_offset(read_block_index_, column + 1) - column_offset;
+            Slice result(read_buff_.data() + bytes_read, column_size);
+            size_t column_bytes_read = 0;
+            RETURN_IF_ERROR(file_reader_->read_at(column_offset, result, &column_bytes_read));
+            DCHECK(column_bytes_read == column_size);
+            bytes_read += column_bytes_read;
+            read_column_sizes_.emplace_back(column_size);
+        }
     }
-    DCHECK(bytes_read == bytes_to_read);
 
     if (bytes_read > 0) {
         COUNTER_UPDATE(_read_file_size, bytes_read);
+        data_dir_->update_spill_read_bytes(bytes_read);
         ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_read_bytes(bytes_read);
-        if (_resource_ctx) {
+        if (_resource_ctx && !data_dir_->is_remote()) {
             _resource_ctx->io_context()->update_spill_read_bytes_from_local_storage(bytes_read);
         }
         COUNTER_UPDATE(_read_block_count, 1);
         {
             SCOPED_TIMER(_deserialize_timer);
-            if (!pb_block_.ParseFromArray(result.data, cast_set<int>(result.size))) {
-                return Status::InternalError("Failed to read spilled block");
+            ColumnsWithTypeAndName columns;
+            const char* column_data = read_buff_.data();
+            for (auto column_size : read_column_sizes_) {
+                if (!pb_block_.ParseFromArray(column_data, cast_set<int>(column_size))) {
+                    return Status::InternalError("Failed to read spilled block");
+                }
+                Block column_block;
+                RETURN_IF_ERROR(column_block.deserialize(pb_block_));
+                columns.emplace_back(column_block.get_by_position(0));
+                column_data += column_size;
             }
-            RETURN_IF_ERROR(block->deserialize(pb_block_));
+            block->swap(Block(std::move(columns)));
         }
         COUNTER_UPDATE(_read_block_data_size, block->bytes());
         COUNTER_UPDATE(_read_rows_count, block->rows());
@@ -155,12 +228,18 @@ Status SpillReader::read(Block* block, bool* eos) {
     return Status::OK();
 }
 
+size_t SpillReader::_column_offset(size_t block_index, size_t column) const {
+    return column < column_count_ ? column_start_offsets_[block_index * column_count_ + column]
+                                  : block_start_offsets_[block_index + 1];
+}
+
 Status SpillReader::close() {
     if (!file_reader_) {
         return Status::OK();
     }
     (void)file_reader_->close();
     file_reader_.reset();
+    local_file_reader_ = nullptr;
     return Status::OK();
 }
 
@@ -30,14 +30,20 @@
 #include "vec/common/pod_array.h"
 #include "vec/common/pod_array_fwd.h"
 
+namespace doris::io {
+class LocalFileReader;
+} // namespace doris::io
+
 namespace doris::vectorized {
 #include "common/compile_check_begin.h"
 class Block;
+class SpillDataDir;
 class SpillReader {
 public:
     SpillReader(std::shared_ptr<ResourceContext> resource_context, int64_t stream_id,
-                std::string file_path)
-            : stream_id_(stream_id),
+                SpillDataDir* data_dir, std::string file_path)
+            : data_dir_(data_dir),
+              stream_id_(stream_id),
               file_path_(std::move(file_path)),
               _resource_ctx(std::move(resource_context)) {}
 
@@ -57,6 +63,12 @@ public:
 
     size_t block_count() const { return block_count_; }
 
+    // Only the columns of column_ids are read from the file, and the blocks that are read are
+    // made of them in the order of column_ids. All of the columns are read if it is empty.
+    void set_read_columns(std::vector<size_t> column_ids) {
+        read_column_ids_ = std::move(column_ids);
+    }
+
     void set_counters(RuntimeProfile* operator_profile) {
         RuntimeProfile* custom_profile = operator_profile->get_child("CustomCounters");
         DCHECK(custom_profile != nullptr);
@@ -70,15 +82,32 @@ public:
     }
 
 private:
+    // Lets the kernel read the blocks after `offset` while the current one is processed.
+    void _read_ahead(size_t offset);
+
+    // The start offset of the column of the block, or the end of the block if it is the last.
+    size_t _column_offset(size_t block_index, size_t column) const;
+
+    // not owned, the data dir that the file is in
+    SpillDataDir* data_dir_ = nullptr;
     int64_t stream_id_;
     std::string file_path_;
     io::FileReaderSPtr file_reader_;
+    // file_reader_ if it is a local file, which can be read ahead.
+    io::LocalFileReader* local_file_reader_ = nullptr;
+    // the end of the range that has been asked to be read ahead
+    size_t read_ahead_end_ = 0;
 
     size_t block_count_ = 0;
     size_t read_block_index_ = 0;
     size_t max_sub_block_size_ = 0;
     PaddedPODArray<char> read_buff_;
     std::vector<size_t> block_start_offsets_;
+    size_t column_count_ = 0;
+    // the start offsets of the columns of all of the blocks, column_count_ per block
+    std::vector<size_t> column_start_offsets_;
+    std::vector<size_t> read_column_ids_;
+    std::vector<size_t> read_column_sizes_;
 
     PBlock pb_block_;
 
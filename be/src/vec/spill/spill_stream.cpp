@@ -68,6 +68,21 @@ void SpillStream::gc() {
     if (_current_file_size) {
         COUNTER_UPDATE(_current_file_size, -total_written_bytes_);
     }
+    if (data_dir_->is_remote()) {
+        _gc_remote();
+    } else {
+        _gc_local();
+    }
+    // If QueryContext is destructed earlier than PipelineFragmentContext,
+    // spill_dir_ will be already moved to spill_gc directory.
+
+    // decrease spill data usage anyway, since in ~QueryContext() spill data of the query will be
+    // clean up as a last resort
+    data_dir_->update_spill_data_usage(-total_written_bytes_);
+    total_written_bytes_ = 0;
+}
+
+void SpillStream::_gc_local() {
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -89,13 +104,31 @@ void SpillStream::gc() {
                                                    query_gc_dir, status.to_string());
         }
     }
-    // If QueryContext is destructed earlier than PipelineFragmentContext,
-    // spill_dir_ will be already moved to spill_gc directory.
+}
 
-    // decrease spill data usage anyway, since in ~QueryContext() spill data of the query will be
-    // clean up as a last resort
-    data_dir_->update_spill_data_usage(-total_written_bytes_);
-    total_written_bytes_ = 0;
+void SpillStream::_gc_remote() {
+    if (_remote_gc_submitted) {
+        return;
+    }
+    _remote_gc_submitted = true;
+    if (_current_file_count) {
+        COUNTER_UPDATE(_current_file_count, -1);
+    }
+    // The objects can not be renamed to the gc dir, they are deleted by the spill io threads
+    // instead of blocking the pipeline task on the remote storage.
+    auto st = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool()->submit_func(
+            [fs = data_dir_->fs(), spill_dir = spill_dir_] {
+                auto status = fs->delete_directory(spill_dir);
+                if (!status.ok()) {
+                    LOG_EVERY_T(WARNING, 1) << fmt::format(
+                            "failed to gc remote spill data, dir {}, error: {}", spill_dir,
+                            status.to_string());
+                }
+            });
+    if (!st.ok()) {
+        LOG_EVERY_T(WARNING, 1) << fmt::format("failed to gc remote spill data, dir {}, error: {}",
+                                               spill_dir_, st.to_string());
+    }
 }
 
 Status SpillStream::prepare() {
@@ -104,7 +137,7 @@ Status SpillStream::prepare() {
     _set_write_counters(profile_);
 
     reader_ = std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                            writer_->get_file_path());
+                                            data_dir_, writer_->get_file_path());
 
     DBUG_EXECUTE_IF("fault_inject::spill_stream::prepare_spill", {
         return Status::Error<INTERNAL_ERROR>("fault_inject spill_stream prepare_spill failed");
@@ -118,7 +151,7 @@ Status SpillStream::prepare() {
 
 SpillReaderUPtr SpillStream::create_separate_reader() const {
     return std::make_unique<SpillReader>(state_->get_query_ctx()->resource_ctx(), stream_id_,
-                                         writer_->get_file_path());
+                                         data_dir_, writer_->get_file_path());
 }
 
 const TUniqueId& SpillStream::query_id() const {
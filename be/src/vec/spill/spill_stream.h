@@ -80,6 +80,9 @@ private:
 
     Status prepare();
 
+    void _gc_local();
+    void _gc_remote();
+
     void _set_write_counters(RuntimeProfile* profile) { writer_->set_counters(profile); }
 
     RuntimeState* state_ = nullptr;
@@ -94,6 +97,7 @@ private:
 
     std::atomic_bool _ready_for_reading = false;
     std::atomic_bool _is_reading = false;
+    bool _remote_gc_submitted = false;
 
     SpillWriterUPtr writer_;
     SpillReaderUPtr reader_;
@@ -27,11 +27,15 @@
 #include <random>
 #include <string>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/logging.h"
 #include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
@@ -117,6 +121,9 @@ void SpillStreamManager::_spill_gc_thread_callback() {
         for (auto& [path, dir] : _spill_store_map) {
             static_cast<void>(dir->update_capacity());
         }
+        if (auto* remote_store = _remote_store()) {
+            static_cast<void>(remote_store->update_capacity());
+        }
     }
 }
 
@@ -150,6 +157,36 @@ std::vector<SpillDataDir*> SpillStreamManager::_get_stores_for_spill(
     return stores;
 }
 
+SpillDataDir* SpillStreamManager::_remote_store() {
+    std::lock_guard<std::mutex> l(_remote_store_mutex);
+    return _remote_spill_store.get();
+}
+
+SpillDataDir* SpillStreamManager::_get_remote_store_for_spill() {
+    if (!config::enable_spill_to_remote_storage || !config::is_cloud_mode()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> l(_remote_store_mutex);
+    if (_remote_spill_store == nullptr) {
+        auto fs = ExecEnv::GetInstance()->storage_engine().to_cloud().latest_fs();
+        if (fs == nullptr) {
+            return nullptr;
+        }
+        auto store = std::make_unique<SpillDataDir>(
+                fs, fmt::format("{}/{}", SPILL_DIR_PREFIX, BackendOptions::get_be_endpoint()));
+        auto st = store->init();
+        if (!st.ok()) {
+            LOG_EVERY_T(WARNING, 1) << "failed to init remote spill storage: " << st;
+            return nullptr;
+        }
+        _remote_spill_store = std::move(store);
+    }
+    if (_remote_spill_store->reach_capacity_limit(0)) {
+        return nullptr;
+    }
+    return _remote_spill_store.get();
+}
+
 Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStreamSPtr& spill_stream,
                                                  const std::string& query_id,
                                                  const std::string& operator_name, int32_t node_id,
@@ -159,6 +196,12 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
     if (data_dirs.empty()) {
         data_dirs = _get_stores_for_spill(TStorageMedium::type::HDD);
     }
+    // The remote storage is the slowest tier, which is only used when the local disks are full.
+    if (data_dirs.empty()) {
+        if (auto* remote_store = _get_remote_store_for_spill()) {
+            data_dirs.emplace_back(remote_store);
+        }
+    }
     if (data_dirs.empty()) {
         return Status::Error<ErrorCode::NO_AVAILABLE_ROOT_PATH>(
                 "no available disk can be used for spill.");
@@ -172,7 +215,7 @@ Status SpillStreamManager::register_spill_stream(RuntimeState* state, SpillStrea
         // storage_root/spill/query_id/partitioned_hash_join-node_id-task_id-stream_id
         spill_dir = fmt::format("{}/{}/{}-{}-{}-{}", spill_root_dir, query_id, operator_name,
                                 node_id, state->task_id(), id);
-        auto st = io::global_local_filesystem()->create_directory(spill_dir);
+        auto st = dir->fs()->create_directory(spill_dir);
         if (!st.ok()) {
             std::cerr << "create spill dir failed: " << st.to_string();
             continue;
@@ -277,6 +320,10 @@ void SpillStreamManager::async_cleanup_query(TUniqueId query_id) {
                 }
             }
         }
+        if (auto* remote_store = _remote_store()) {
+            static_cast<void>(remote_store->fs()->delete_directory(
+                    remote_store->get_spill_data_path(print_id(query_id))));
+        }
     });
 }
 
@@ -286,12 +333,27 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_avail_capacity, MetricUnit::BYTES)
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_data_size, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_has_spill_data, MetricUnit::BYTES);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_has_spill_gc_data, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_write_bytes, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_read_bytes, MetricUnit::BYTES);
 
 SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
                            TStorageMedium::type storage_medium)
         : _path(std::move(path)),
+          _fs(io::global_local_filesystem()),
           _disk_capacity_bytes(capacity_bytes),
           _storage_medium(storage_medium) {
+    _register_metrics();
+}
+
+SpillDataDir::SpillDataDir(io::FileSystemSPtr fs, std::string path)
+        : _path(std::move(path)),
+          _fs(std::move(fs)),
+          _is_remote(true),
+          _storage_medium(TStorageMedium::HDD) {
+    _register_metrics();
+}
+
+void SpillDataDir::_register_metrics() {
     spill_data_dir_metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
             std::string("spill_data_dir.") + _path, {{"path", _path + "/" + SPILL_DIR_PREFIX}});
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_capacity);
@@ -300,6 +362,8 @@ SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_data_size);
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_data);
     INT_GAUGE_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_has_spill_gc_data);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_write_bytes);
+    INT_COUNTER_METRIC_REGISTER(spill_data_dir_metric_entity, spill_disk_read_bytes);
 }
 
 bool is_directory_empty(const std::filesystem::path& dir) {
@@ -315,6 +379,14 @@ bool is_directory_empty(const std::filesystem::path& dir) {
 }
 
 Status SpillDataDir::init() {
+    if (_is_remote) {
+        // The spill data of a former process of this BE can not be in use any more.
+        RETURN_IF_ERROR(_fs->delete_directory(get_spill_data_path()));
+        RETURN_IF_ERROR(update_capacity());
+        LOG(INFO) << fmt::format("remote spill storage path: {}, limit: {}", _path,
+                                 PrettyPrinter::print_bytes(_spill_data_limit_bytes));
+        return Status::OK();
+    }
     bool exists = false;
     RETURN_IF_ERROR(io::global_local_filesystem()->exists(_path, &exists));
     if (!exists) {
@@ -349,6 +421,11 @@ std::string SpillDataDir::get_spill_data_gc_path(const std::string& sub_dir_name
 
 Status SpillDataDir::update_capacity() {
     std::lock_guard<std::mutex> l(_mutex);
+    if (_is_remote) {
+        _spill_data_limit_bytes = config::spill_remote_storage_limit_bytes;
+        spill_disk_limit->set_value(_spill_data_limit_bytes);
+        return Status::OK();
+    }
     RETURN_IF_ERROR(io::global_local_filesystem()->get_space_info(_path, &_disk_capacity_bytes,
                                                                   &_available_bytes));
     spill_disk_capacity->set_value(_disk_capacity_bytes);
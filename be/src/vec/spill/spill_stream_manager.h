@@ -23,6 +23,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "io/fs/file_system.h"
 #include "olap/options.h"
 #include "util/metrics.h"
 #include "util/threadpool.h"
@@ -47,10 +48,18 @@ public:
     SpillDataDir(std::string path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium = TStorageMedium::HDD);
 
+    // A data dir in the remote storage `fs`, which is the last tier of spill storage, used when
+    // all of the local data dirs reach their limits. Its limit is spill_remote_storage_limit_bytes.
+    SpillDataDir(io::FileSystemSPtr fs, std::string path);
+
     Status init();
 
     const std::string& path() const { return _path; }
 
+    const io::FileSystemSPtr& fs() const { return _fs; }
+
+    bool is_remote() const { return _is_remote; }
+
     std::string get_spill_data_path(const std::string& query_id = "") const;
 
     std::string get_spill_data_gc_path(const std::string& sub_dir_name = "") const;
@@ -69,6 +78,10 @@ public:
         spill_disk_data_size->set_value(_spill_data_bytes);
     }
 
+    void update_spill_write_bytes(int64_t bytes) { spill_disk_write_bytes->increment(bytes); }
+
+    void update_spill_read_bytes(int64_t bytes) { spill_disk_read_bytes->increment(bytes); }
+
     int64_t get_spill_data_bytes() {
         std::lock_guard<std::mutex> l(_mutex);
         return _spill_data_bytes;
@@ -90,13 +103,17 @@ private:
                                  (double)_disk_capacity_bytes;
     }
 
+    void _register_metrics();
+
     friend class SpillStreamManager;
     std::string _path;
+    io::FileSystemSPtr _fs;
+    bool _is_remote = false;
 
     // protect _disk_capacity_bytes, _available_bytes, _spill_data_limit_bytes, _spill_data_bytes
     std::mutex _mutex;
     // the actual capacity of the disk of this data dir
-    size_t _disk_capacity_bytes;
+    size_t _disk_capacity_bytes = 0;
     int64_t _spill_data_limit_bytes = 0;
     // the actual available capacity of the disk of this data dir
     size_t _available_bytes = 0;
@@ -108,6 +125,8 @@ private:
     IntGauge* spill_disk_limit = nullptr;
     IntGauge* spill_disk_avail_capacity = nullptr;
     IntGauge* spill_disk_data_size = nullptr;
+    IntCounter* spill_disk_write_bytes = nullptr;
+    IntCounter* spill_disk_read_bytes = nullptr;
     // for test
     IntGauge* spill_disk_has_spill_data = nullptr;
     IntGauge* spill_disk_has_spill_gc_data = nullptr;
@@ -152,8 +171,13 @@ private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
     std::vector<SpillDataDir*> _get_stores_for_spill(TStorageMedium::type storage_medium);
+    SpillDataDir* _get_remote_store_for_spill();
+    SpillDataDir* _remote_store();
 
     std::unordered_map<std::string, std::unique_ptr<SpillDataDir>> _spill_store_map;
+    // Created on its first use, since the storage vaults are synced after the manager is inited.
+    std::mutex _remote_store_mutex;
+    std::unique_ptr<SpillDataDir> _remote_spill_store;
 
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
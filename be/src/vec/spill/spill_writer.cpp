@@ -32,7 +32,7 @@ Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
     }
-    return io::global_local_filesystem()->create_file(file_path_, &file_writer_);
+    return data_dir_->fs()->create_file(file_path_, &file_writer_);
 }
 
 Status SpillWriter::close() {
@@ -41,10 +41,13 @@ Status SpillWriter::close() {
     }
     closed_ = true;
 
+    meta_.append(column_meta_);
+    meta_.append((const char*)&column_count_, sizeof(column_count_));
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
 
-    // meta: block1 offset, block2 offset, ..., blockn offset, max_sub_block_size, n
+    // meta: block1 offset, ..., blockn offset, block1 column1 offset, ..., block1 columnm offset,
+    // ..., blockn columnm offset, m, max_sub_block_size, n
     {
         SCOPED_TIMER(_write_file_timer);
         RETURN_IF_ERROR(file_writer_->append(meta_));
@@ -52,13 +55,14 @@ Status SpillWriter::close() {
 
     total_written_bytes_ += meta_.size();
     COUNTER_UPDATE(_write_file_total_size, meta_.size());
-    if (_resource_ctx) {
+    if (_resource_ctx && !data_dir_->is_remote()) {
         _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(meta_.size());
     }
     if (_write_file_current_size) {
         COUNTER_UPDATE(_write_file_current_size, meta_.size());
     }
     data_dir_->update_spill_data_usage(meta_.size());
+    data_dir_->update_spill_write_bytes(meta_.size());
     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(meta_.size());
 
     RETURN_IF_ERROR(file_writer_->close());
@@ -110,22 +114,32 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     Status status;
     std::string buff;
     int64_t buff_size {0};
+    // the offsets of the columns in buff
+    std::vector<size_t> column_offsets;
 
     if (block.rows() > 0) {
+        DCHECK(written_blocks_ == 0 || column_count_ == block.columns());
+        column_count_ = block.columns();
         {
-            PBlock pblock;
             SCOPED_TIMER(_serialize_timer);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
-            RETURN_IF_ERROR(status);
-            int64_t pblock_mem = pblock.ByteSizeLong();
-            COUNTER_UPDATE(_memory_used_counter, pblock_mem);
-            Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
-            if (!pblock.SerializeToString(&buff)) {
-                return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
-                        "serialize spill data error. [path={}]", file_path_);
+            // Every column is serialized into a PBlock of its own, so that a reader can read
+            // only some of the columns.
+            for (size_t i = 0; i < block.columns(); ++i) {
+                Block column_block({block.get_by_position(i)});
+                PBlock pblock;
+                status = column_block.serialize(
+                        BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
+                        &compressed_bytes,
+                        segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
+                RETURN_IF_ERROR(status);
+                int64_t pblock_mem = pblock.ByteSizeLong();
+                COUNTER_UPDATE(_memory_used_counter, pblock_mem);
+                Defer defer {[&]() { COUNTER_UPDATE(_memory_used_counter, -pblock_mem); }};
+                column_offsets.emplace_back(buff.size());
+                if (!pblock.AppendToString(&buff)) {
+                    return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
+                            "serialize spill data error. [path={}]", file_path_);
+                }
             }
             buff_size = buff.size();
             COUNTER_UPDATE(_memory_used_counter, buff_size);
@@ -144,14 +158,19 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
             Defer defer {[&]() {
                 if (status.ok()) {
                     data_dir_->update_spill_data_usage(buff_size);
+                    data_dir_->update_spill_write_bytes(buff_size);
                     ExecEnv::GetInstance()->spill_stream_mgr()->update_spill_write_bytes(buff_size);
 
                     written_bytes += buff_size;
                     max_sub_block_size_ = std::max(max_sub_block_size_, (size_t)buff_size);
 
                     meta_.append((const char*)&total_written_bytes_, sizeof(size_t));
+                    for (const auto column_offset : column_offsets) {
+                        auto offset = static_cast<size_t>(total_written_bytes_) + column_offset;
+                        column_meta_.append((const char*)&offset, sizeof(size_t));
+                    }
                     COUNTER_UPDATE(_write_file_total_size, buff_size);
-                    if (_resource_ctx) {
+                    if (_resource_ctx && !data_dir_->is_remote()) {
                         _resource_ctx->io_context()->update_spill_write_bytes_to_local_storage(
                                 buff_size);
                     }
@@ -86,6 +86,9 @@ private:
     size_t written_blocks_ = 0;
     int64_t total_written_bytes_ = 0;
     std::string meta_;
+    // the columns of every block, which are written one after another
+    size_t column_count_ = 0;
+    std::string column_meta_;
 
     RuntimeProfile::Counter* _write_file_timer = nullptr;
     RuntimeProfile::Counter* _serialize_timer = nullptr;
@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "agent/cgroup_cpu_ctl.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "util/cpu_info.h"
+
+namespace doris {
+
+TEST(CgroupCpuCtlTest, parse_cpuset) {
+    std::vector<int> cores;
+    EXPECT_TRUE(CgroupCpuCtl::parse_cpuset("", &cores).ok());
+    EXPECT_TRUE(cores.empty());
+
+    int max_cores = CpuInfo::get_max_num_cores();
+    std::string last = std::to_string(max_cores - 1);
+    EXPECT_TRUE(CgroupCpuCtl::parse_cpuset(last + ",0-0,0", &cores).ok());
+    if (max_cores > 1) {
+        EXPECT_EQ(cores, std::vector<int>({0, max_cores - 1}));
+    } else {
+        EXPECT_EQ(cores, std::vector<int>({0}));
+    }
+    EXPECT_TRUE(CgroupCpuCtl::parse_cpuset("0-" + last, &cores).ok());
+    EXPECT_EQ(cores.size(), static_cast<size_t>(max_cores));
+
+    EXPECT_TRUE(CgroupCpuCtl::parse_cpuset("numa:0", &cores).ok());
+    EXPECT_EQ(cores, CpuInfo::get_cores_of_numa_node(0));
+
+    std::vector<std::string> invalid_cpusets = {
+            "numa:", "-1", "1-0", "0,,1", "0-", "a", "0 ", std::to_string(max_cores),
+            "numa:" + std::to_string(CpuInfo::get_max_num_numa_nodes())};
+    for (const auto& invalid : invalid_cpusets) {
+        EXPECT_FALSE(CgroupCpuCtl::parse_cpuset(invalid, &cores).ok()) << invalid;
+    }
+}
+
+} // namespace doris
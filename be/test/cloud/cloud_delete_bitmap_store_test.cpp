@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "cloud/cloud_delete_bitmap_store.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace doris {
+
+class CloudDeleteBitmapStoreTest : public testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(_path);
+        ASSERT_TRUE(_store.init().ok());
+    }
+    void TearDown() override { std::filesystem::remove_all(_path); }
+
+    const std::string _path = "./ut_dir/cloud_delete_bitmap_store_test";
+    CloudDeleteBitmapStore _store {_path};
+};
+
+TEST_F(CloudDeleteBitmapStoreTest, save_and_load) {
+    RowsetId rs1;
+    rs1.init(10001);
+    RowsetId rs2;
+    rs2.init(10002);
+    RowsetId rs3;
+    rs3.init(10003);
+    DeleteBitmap delete_bitmap(1);
+    delete_bitmap.add({rs1, 0, 2}, 1);
+    delete_bitmap.add({rs1, 1, 3}, 5);
+    delete_bitmap.add({rs2, 0, 3}, 7);
+    // newer than the snapshot version
+    delete_bitmap.add({rs2, 0, 4}, 8);
+    // not covered by the snapshot
+    delete_bitmap.add({rs3, 0, 3}, 9);
+    ASSERT_TRUE(_store.save(1, 3, {rs1, rs2}, delete_bitmap).ok());
+
+    int64_t version = 0;
+    RowsetIdUnorderedSet rowset_ids;
+    DeleteBitmap loaded(1);
+    ASSERT_TRUE(_store.load(1, &version, &rowset_ids, &loaded).ok());
+    EXPECT_EQ(version, 3);
+    EXPECT_EQ(rowset_ids, (RowsetIdUnorderedSet {rs1, rs2}));
+    EXPECT_EQ(loaded.delete_bitmap.size(), 3);
+    EXPECT_TRUE(loaded.contains({rs1, 0, 2}, 1));
+    EXPECT_TRUE(loaded.contains({rs1, 1, 3}, 5));
+    EXPECT_TRUE(loaded.contains({rs2, 0, 3}, 7));
+
+    DeleteBitmap other(2);
+    EXPECT_TRUE(_store.load(2, &version, &rowset_ids, &other).is<ErrorCode::NOT_FOUND>());
+
+    _store.remove(1);
+    EXPECT_TRUE(_store.load(1, &version, &rowset_ids, &loaded).is<ErrorCode::NOT_FOUND>());
+}
+
+TEST_F(CloudDeleteBitmapStoreTest, corrupted_file) {
+    RowsetId rs1;
+    rs1.init(10001);
+    DeleteBitmap delete_bitmap(1);
+    delete_bitmap.add({rs1, 0, 2}, 1);
+    ASSERT_TRUE(_store.save(1, 2, {rs1}, delete_bitmap).ok());
+    {
+        std::fstream file(_path + "/1.dbm", std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(1);
+        file.put('x');
+    }
+    int64_t version = 0;
+    RowsetIdUnorderedSet rowset_ids;
+    DeleteBitmap loaded(1);
+    EXPECT_TRUE(_store.load(1, &version, &rowset_ids, &loaded).is<ErrorCode::NOT_FOUND>());
+    EXPECT_FALSE(std::filesystem::exists(_path + "/1.dbm"));
+}
+
+} // namespace doris
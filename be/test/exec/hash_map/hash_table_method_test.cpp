@@ -17,11 +17,15 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "testutil/column_helper.h"
 #include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/fixed_key_hash_map.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/common/hash_table/two_level_hash_map.h"
 #include "vec/data_types/data_type_number.h"
 
 namespace doris::vectorized {
@@ -80,6 +84,38 @@ TEST(HashTableMethodTest, testMethodOneNumber) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodOneNumberFixedKey) {
+    using FixedKeyMap = FixedKeyHashMap<UInt16, IColumn::ColumnIndex>;
+    MethodOneNumber<UInt16, FixedKeyMap> method;
+    EXPECT_TRUE(method.hash_table->empty());
+    EXPECT_EQ(method.hash_table->begin(), method.hash_table->end());
+    EXPECT_EQ(method.hash_table->get_buffer_size_in_bytes(), 0U);
+
+    test_insert(method, {ColumnHelper::create_column<DataTypeInt16>({1, 2, 3, 4, 5})});
+
+    test_find(method, {ColumnHelper::create_column<DataTypeInt16>({1, 2, 3, 4, 5})},
+              {0, 1, 2, 3, 4});
+
+    test_find(method, {ColumnHelper::create_column<DataTypeInt16>({1, 2, 7, 4, 6, 5})},
+              {0, 1, -1, 3, -1, 4});
+
+    // The negative keys are indexed by their unsigned bits.
+    test_insert(method, {ColumnHelper::create_column<DataTypeInt16>({-1, 1})});
+    test_find(method, {ColumnHelper::create_column<DataTypeInt16>({-1, 1, -2})}, {0, 0, -1});
+
+    EXPECT_EQ(method.hash_table->size(), 6U);
+    EXPECT_FALSE(method.hash_table->add_elem_size_overflow(1000000));
+    std::vector<UInt16> keys;
+    for (auto it = method.hash_table->begin(); it != method.hash_table->end(); ++it) {
+        keys.push_back(it->get_first());
+    }
+    EXPECT_EQ(keys, std::vector<UInt16>({1, 2, 3, 4, 5, 65535}));
+
+    method.hash_table->clear_and_shrink();
+    EXPECT_TRUE(method.hash_table->empty());
+    EXPECT_EQ(method.hash_table->begin(), method.hash_table->end());
+}
+
 TEST(HashTableMethodTest, testMethodFixed) {
     MethodKeysFixed<PHHashMap<UInt64, IColumn::ColumnIndex, HashCRC32<UInt64>>> method(
             Sizes {sizeof(int), sizeof(int)});
@@ -98,6 +134,85 @@ TEST(HashTableMethodTest, testMethodFixed) {
               {0, 1, -1, 3, -1, 4});
 }
 
+TEST(HashTableMethodTest, testMethodFixedTwoLevel) {
+    using SingleLevelMap = PHHashMap<UInt64, IColumn::ColumnIndex, HashCRC32<UInt64>>;
+    MethodKeysFixed<SingleLevelMap> single_level_method(Sizes {sizeof(int), sizeof(int)});
+    std::vector<int32_t> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    test_insert(single_level_method, {ColumnHelper::create_column<DataTypeInt32>(values),
+                                      ColumnHelper::create_column<DataTypeInt32>(values)});
+
+    // Convert the single-level hash table into a two-level one.
+    MethodKeysFixed<TwoLevelHashMap<SingleLevelMap>> method(Sizes {sizeof(int), sizeof(int)});
+    method.hash_table = std::make_shared<TwoLevelHashMap<SingleLevelMap>>(
+            std::move(*single_level_method.hash_table));
+    EXPECT_TRUE(single_level_method.hash_table->empty());
+    EXPECT_EQ(method.hash_table->size(), values.size());
+
+    size_t iterated = 0;
+    size_t used_sub_tables = 0;
+    for (auto it = method.hash_table->begin(); it != method.hash_table->end(); ++it) {
+        ++iterated;
+    }
+    for (const auto& impl : method.hash_table->impls) {
+        used_sub_tables += !impl.empty();
+    }
+    EXPECT_EQ(iterated, values.size());
+    EXPECT_GT(used_sub_tables, 1U);
+
+    std::vector<int64_t> expected(values.begin(), values.end());
+    test_find(method,
+              {ColumnHelper::create_column<DataTypeInt32>(values),
+               ColumnHelper::create_column<DataTypeInt32>(values)},
+              expected);
+
+    test_insert(method, {ColumnHelper::create_column<DataTypeInt32>({1001, 1002}),
+                         ColumnHelper::create_column<DataTypeInt32>({1001, 1002})});
+    test_find(method,
+              {ColumnHelper::create_column<DataTypeInt32>({1, 1001, 1002, 1003}),
+               ColumnHelper::create_column<DataTypeInt32>({1, 1001, 1002, 1003})},
+              {1, 0, 1, -1});
+}
+
+TEST(HashTableMethodTest, testMethodOneNumberBatch) {
+    using HashMethodType =
+            MethodOneNumber<UInt32, PHHashMap<UInt32, IColumn::ColumnIndex, HashCRC32<UInt32>>>;
+    HashMethodType method;
+    // More rows than the prefetch distance, with every key repeated once.
+    std::vector<int32_t> values(100);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<int32_t>(i % 50);
+    }
+    auto column = ColumnHelper::create_column<DataTypeInt32>(values);
+    ColumnRawPtrs key_raw_columns {column.get()};
+    HashMethodType::State state(key_raw_columns);
+    method.init_serialized_keys(key_raw_columns, values.size());
+
+    size_t created = 0;
+    std::vector<IColumn::ColumnIndex> mapped_values(values.size());
+    auto creator = [&](const auto& ctor, auto& key, auto& origin) { ctor(key, created++); };
+    auto creator_for_null_key = [&](auto& mapped) {
+        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "no null key"); // NOLINT
+    };
+    method.lazy_emplace_batch(state, values.size(), creator, creator_for_null_key,
+                              [&](size_t i, auto* mapped) { mapped_values[i] = *mapped; });
+    EXPECT_EQ(created, 50U);
+    EXPECT_EQ(method.hash_table->size(), 50U);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(mapped_values[i], i % 50);
+    }
+
+    auto find_column = ColumnHelper::create_column<DataTypeInt32>({1, 49, 50, 7});
+    ColumnRawPtrs find_raw_columns {find_column.get()};
+    HashMethodType::State find_state(find_raw_columns);
+    method.init_serialized_keys(find_raw_columns, 4);
+    std::vector<int64_t> found;
+    method.find_batch(find_state, 4, [&](size_t i, auto find_result) {
+        found.push_back(find_result.is_found() ? find_result.get_mapped() : -1);
+    });
+    EXPECT_EQ(found, std::vector<int64_t>({1, 49, -1, 7}));
+}
+
 TEST(HashTableMethodTest, testMethodSerialized) {
     MethodSerialized<StringHashMap<IColumn::ColumnIndex>> method;
 
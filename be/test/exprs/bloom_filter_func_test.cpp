@@ -583,6 +583,71 @@ TEST_F(BloomFilterFuncTest, FindDictOlapEngine) {
     ASSERT_EQ(find_count, count);
 }
 
+TEST_F(BloomFilterFuncTest, FindDictOlapEngineByCodes) {
+    const size_t count = 4096;
+
+    std::vector<StringRef> dicts = {StringRef("aa"),  StringRef("bb"),  StringRef("cc"),
+                                    StringRef("dd"),  StringRef("aab"), StringRef("bbc"),
+                                    StringRef("ccd"), StringRef("dde")};
+    auto column = vectorized::ColumnDictI32::create();
+    column->reserve(count);
+    std::vector<int32_t> data(count);
+    for (size_t i = 0; i != count; ++i) {
+        data[i] = i % dicts.size();
+    }
+
+    column->insert_many_dict_data(data.data(), 0, dicts.data(), count, dicts.size());
+    column->initialize_hash_values_for_runtime_filter();
+
+    BloomFilterFunc<PrimitiveType::TYPE_STRING> bloom_filter_func(false);
+    RuntimeFilterParams params {1,
+                                RuntimeFilterType::BLOOM_FILTER,
+                                PrimitiveType::TYPE_INT,
+                                false,
+                                0,
+                                0,
+                                0,
+                                256,
+                                0,
+                                0,
+                                false,
+                                false};
+    bloom_filter_func.init_params(&params);
+    auto st = bloom_filter_func.init_with_fixed_length(0);
+    ASSERT_TRUE(st) << "Failed to init bloom filter with fixed length: " << st.to_string();
+
+    // Only the words with even codes are in the filter.
+    auto string_column = vectorized::ColumnString::create();
+    for (size_t i = 0; i < dicts.size(); i += 2) {
+        string_column->insert_data(dicts[i].data, dicts[i].size);
+    }
+    bloom_filter_func.insert_fixed_len(std::move(string_column), 0);
+
+    std::vector<vectorized::UInt8> dict_flags;
+    vectorized::PODArray<uint16_t> offsets(count);
+    std::iota(offsets.begin(), offsets.end(), 0);
+    auto find_count = bloom_filter_func.find_dict_olap_engine<false>(
+            column.get(), nullptr, offsets.data(), count, dict_flags);
+    ASSERT_EQ(dict_flags.size(), dicts.size());
+    for (size_t i = 0; i < dicts.size(); i += 2) {
+        ASSERT_TRUE(dict_flags[i]);
+    }
+    // The words not in the filter may pass as false positive.
+    ASSERT_GE(find_count, count / 2);
+    for (uint16_t i = 0; i < find_count; ++i) {
+        ASSERT_TRUE(dict_flags[data[offsets[i]]]);
+    }
+
+    // The cached flags are reused.
+    dict_flags.assign(dicts.size(), 0);
+    std::iota(offsets.begin(), offsets.end(), 0);
+    vectorized::PODArray<uint8_t> nullmap;
+    nullmap.assign(count, uint8_t(0));
+    find_count = bloom_filter_func.find_dict_olap_engine<true>(column.get(), nullmap.data(),
+                                                               offsets.data(), count, dict_flags);
+    ASSERT_EQ(find_count, 0U);
+}
+
 TEST_F(BloomFilterFuncTest, FindFixedLenOlapEngine) {
     const size_t count = 4096;
 
@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -726,4 +727,38 @@ TEST_F(HybridSetTest, StringValueSet) {
     }
 }
 
+TEST_F(HybridSetTest, DynamicContainer) {
+    // Dense values are found in the bitmap, which grows with them in both directions.
+    DynamicContainer<int32_t> dense;
+    for (int32_t i = 0; i < 3000; ++i) {
+        dense.insert(1000 + i);
+        dense.insert(1000 - i * 2);
+    }
+    for (int32_t i = -10000; i < 10000; ++i) {
+        EXPECT_EQ(dense.find(i), (i >= 1000 && i < 4000) || (i <= 1000 && i > -5000 && i % 2 == 0))
+                << i;
+    }
+
+    // Sparse values are found in the hash set, including the limits of the type.
+    DynamicContainer<int64_t> sparse;
+    for (int64_t value : {std::numeric_limits<int64_t>::min(), int64_t(-1), int64_t(0),
+                          int64_t(1) << 40, std::numeric_limits<int64_t>::max()}) {
+        sparse.insert(value);
+        EXPECT_TRUE(sparse.find(value));
+    }
+    EXPECT_FALSE(sparse.find(1));
+    EXPECT_FALSE(sparse.find(std::numeric_limits<int64_t>::max() - 1));
+    EXPECT_EQ(sparse.size(), 5U);
+    sparse.clear();
+    EXPECT_FALSE(sparse.find(0));
+
+    DynamicContainer<StringRef> strings;
+    strings.insert(StringRef("abc"));
+    strings.insert(StringRef(""));
+    EXPECT_TRUE(strings.find(StringRef("abc")));
+    EXPECT_TRUE(strings.find(StringRef("")));
+    EXPECT_FALSE(strings.find(StringRef("abd")));
+    EXPECT_FALSE(strings.find(StringRef("abcd")));
+}
+
 } // namespace doris
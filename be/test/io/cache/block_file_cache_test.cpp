@@ -2012,6 +2012,89 @@ TEST_F(BlockFileCacheTest, test_async_load) {
     }
 }
 
+TEST_F(BlockFileCacheTest, compressed_blocks) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    bool old_enable_compression = config::enable_file_cache_block_compression;
+    config::enable_file_cache_block_compression = true;
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 100000;
+    settings.query_queue_elements = 5;
+    settings.capacity = 100000;
+    settings.max_file_block_size = 10000;
+    settings.max_query_cache_size = 100000;
+    io::CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = io::FileCacheType::NORMAL;
+    auto key = io::BlockFileCache::hash("key1");
+    auto key_str = key.to_string();
+    auto dir = fs::path(cache_base_path) / key_str.substr(0, 3) / (key_str + "_0");
+    std::string compressible(10000, 'a');
+    std::string random(10000, '\0');
+    std::mt19937 rng(42);
+    for (auto& c : random) {
+        c = static_cast<char>(rng());
+    }
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        for (int i = 0; i < 100; i++) {
+            if (cache.get_async_open_success()) {
+                break;
+            };
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        auto holder = cache.get_or_set(key, 0, 20000, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 2);
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            const std::string& data = i == 0 ? compressible : random;
+            ASSERT_TRUE(blocks[i]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+            ASSERT_TRUE(blocks[i]->append(Slice(data)).ok());
+            ASSERT_TRUE(blocks[i]->finalize().ok());
+        }
+        // the random block is not worth compressing
+        ASSERT_TRUE(fs::exists(dir / "0_lz4"));
+        ASSERT_FALSE(fs::exists(dir / "0"));
+        ASSERT_LT(fs::file_size(dir / "0_lz4"), 1000);
+        ASSERT_TRUE(fs::exists(dir / "10000"));
+        ASSERT_FALSE(fs::exists(dir / "10000_lz4"));
+
+        std::string buffer(100, '\0');
+        ASSERT_TRUE(blocks[0]->read(Slice(buffer.data(), buffer.size()), 500).ok());
+        EXPECT_EQ(compressible.substr(500, 100), buffer);
+        ASSERT_TRUE(blocks[1]->read(Slice(buffer.data(), buffer.size()), 500).ok());
+        EXPECT_EQ(random.substr(500, 100), buffer);
+    }
+    {
+        // the size of a compressed block is loaded from its header
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        for (int i = 0; i < 100; i++) {
+            if (cache.get_async_open_success()) {
+                break;
+            };
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(cache.get_used_cache_size(io::FileCacheType::NORMAL), 20000);
+        auto holder = cache.get_or_set(key, 0, 20000, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 2);
+        assert_range(1, blocks[0], io::FileBlock::Range(0, 9999),
+                     io::FileBlock::State::DOWNLOADED);
+        std::string buffer(10000, '\0');
+        ASSERT_TRUE(blocks[0]->read(Slice(buffer.data(), buffer.size()), 0).ok());
+        EXPECT_EQ(compressible, buffer);
+    }
+    config::enable_file_cache_block_compression = old_enable_compression;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 TEST_F(BlockFileCacheTest, test_async_load_with_limit) {
     if (fs::exists(cache_base_path)) {
         fs::remove_all(cache_base_path);
@@ -3841,6 +3924,93 @@ TEST_F(BlockFileCacheTest, cached_remote_file_reader_tail) {
     FileCacheFactory::instance()->_capacity = 0;
 }
 
+TEST_F(BlockFileCacheTest, cached_remote_file_reader_read_ahead) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("BufferedReaderPrefetchThreadPool")
+                        .set_min_threads(1)
+                        .set_max_threads(1)
+                        .build(&pool)
+                        .ok());
+    ExecEnv::GetInstance()->_buffered_reader_prefetch_thread_pool = std::move(pool);
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 6291456;
+    settings.query_queue_elements = 6;
+    settings.index_queue_size = 1048576;
+    settings.index_queue_elements = 1;
+    settings.disposable_queue_size = 1048576;
+    settings.disposable_queue_elements = 1;
+    settings.capacity = 8388608;
+    settings.max_file_block_size = 1048576;
+    settings.max_query_cache_size = 0;
+    io::CacheContext context;
+    ReadStatistics rstats;
+    context.stats = &rstats;
+    context.cache_type = io::FileCacheType::NORMAL;
+    ASSERT_TRUE(FileCacheFactory::instance()->create_file_cache(cache_base_path, settings).ok());
+    FileReaderSPtr local_reader;
+    ASSERT_TRUE(global_local_filesystem()->open_file(tmp_file, &local_reader));
+    io::FileReaderOptions opts;
+    opts.cache_type = io::cache_type_from_string("file_block_cache");
+    opts.is_doris_table = true;
+    CachedRemoteFileReader reader(local_reader, opts);
+    // the second sequential read reads [128kb, 4mb + 128kb) ahead
+    for (size_t offset = 0; offset < 192_kb; offset += 64_kb) {
+        std::string buffer;
+        buffer.resize(64_kb);
+        IOContext io_ctx;
+        FileCacheStatistics stats;
+        io_ctx.file_cache_stats = &stats;
+        size_t bytes_read {0};
+        ASSERT_TRUE(reader.read_at(offset, Slice(buffer.data(), buffer.size()), &bytes_read,
+                                   &io_ctx)
+                            .ok());
+        EXPECT_EQ(std::string(64_kb, '0'), buffer);
+    }
+    ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->wait();
+    {
+        auto key = io::BlockFileCache::hash("tmp_file");
+        auto cache = FileCacheFactory::instance()->get_by_path(key);
+        auto holder = cache->get_or_set(key, 4_mb, 2_mb, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 2);
+        assert_range(1, blocks[0], io::FileBlock::Range(4_mb, 5_mb - 1),
+                     io::FileBlock::State::DOWNLOADED);
+        assert_range(2, blocks[1], io::FileBlock::Range(5_mb, 6_mb - 1),
+                     io::FileBlock::State::EMPTY);
+    }
+    {
+        // a random read does not read ahead
+        std::string buffer;
+        buffer.resize(64_kb);
+        IOContext io_ctx;
+        size_t bytes_read {0};
+        ASSERT_TRUE(reader.read_at(8_mb, Slice(buffer.data(), buffer.size()), &bytes_read,
+                                   &io_ctx)
+                            .ok());
+        ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->wait();
+        auto key = io::BlockFileCache::hash("tmp_file");
+        auto cache = FileCacheFactory::instance()->get_by_path(key);
+        auto holder = cache->get_or_set(key, 9_mb, 1_mb, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        assert_range(3, blocks[0], io::FileBlock::Range(9_mb, 10_mb - 1),
+                     io::FileBlock::State::EMPTY);
+    }
+    EXPECT_TRUE(reader.close().ok());
+    ExecEnv::GetInstance()->_buffered_reader_prefetch_thread_pool.reset();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    FileCacheFactory::instance()->_caches.clear();
+    FileCacheFactory::instance()->_path_to_cache.clear();
+    FileCacheFactory::instance()->_capacity = 0;
+}
+
 TEST_F(BlockFileCacheTest, cached_remote_file_reader_error_handle) {
     if (fs::exists(cache_base_path)) {
         fs::remove_all(cache_base_path);
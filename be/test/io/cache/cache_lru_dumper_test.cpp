@@ -146,4 +146,31 @@ TEST_F(CacheLRUDumperTest, test_dump_and_restore_queue) {
     std::remove(fmt::format("lru_dump_{}.tail", queue_name).c_str());
 }
 
+TEST_F(CacheLRUDumperTest, test_dump_and_restore_queue_of_groups) {
+    LRUQueue src_queue;
+    std::string queue_name = "index";
+
+    // The entries are dumped in groups of 10000
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (uint64_t i = 0; i < 25000; ++i) {
+        src_queue.add(UInt128Wrapper(i), i * 4096, 4096, lock);
+    }
+
+    dumper->do_dump_queue(src_queue, queue_name);
+
+    std::lock_guard<std::mutex> cache_lock(mock_cache->mutex());
+    dumper->restore_queue(dst_queue, queue_name, cache_lock);
+
+    ASSERT_EQ(src_queue.get_elements_num(lock), dst_queue.get_elements_num(cache_lock));
+    auto src_it = src_queue.begin();
+    auto dst_it = dst_queue.begin();
+    for (; src_it != src_queue.end(); ++src_it, ++dst_it) {
+        EXPECT_EQ(src_it->hash, dst_it->hash);
+        EXPECT_EQ(src_it->offset, dst_it->offset);
+        EXPECT_EQ(src_it->size, dst_it->size);
+    }
+
+    std::remove(fmt::format("lru_dump_{}.tail", queue_name).c_str());
+}
+
 } // namespace doris::io
\ No newline at end of file
@@ -508,4 +508,31 @@ TEST_F(BufferedReaderTest, test_range_cache_file_reader) {
     }
 }
 
+TEST_F(BufferedReaderTest, test_remote_read_cost_model) {
+    io::RemoteReadCostModel model;
+    constexpr size_t MB = 1024 * 1024;
+    // 10ms latency and 100MB/s bandwidth
+    auto read_time_ns = [](size_t bytes) { return int64_t(10 * 1000 * 1000 + bytes * 10); };
+    for (int i = 0; i < 16; ++i) {
+        model.update(MB, read_time_ns(MB));
+        model.update(2 * MB, read_time_ns(2 * MB));
+    }
+    // too few reads
+    EXPECT_EQ(0, model.equivalent_io_size());
+    for (int i = 0; i < 100; ++i) {
+        size_t bytes = (i % 8 + 1) * 256 * 1024;
+        model.update(bytes, read_time_ns(bytes));
+    }
+    size_t equivalent_io_size = model.equivalent_io_size();
+    EXPECT_GT(equivalent_io_size, 950 * 1024);
+    EXPECT_LT(equivalent_io_size, 1050 * 1024);
+
+    // reads of the same size can not estimate the latency
+    io::RemoteReadCostModel same_size_model;
+    for (int i = 0; i < 100; ++i) {
+        same_size_model.update(MB, read_time_ns(MB));
+    }
+    EXPECT_EQ(0, same_size_model.equivalent_io_size());
+}
+
 } // end namespace doris
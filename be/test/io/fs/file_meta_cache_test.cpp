@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/file_meta_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris {
+
+TEST(FileMetaCacheTest, OrcFileTail) {
+    FileMetaCache meta_cache(1024 * 1024 * 1024, 1000);
+    ObjLRUCache::CacheHandle handle;
+    EXPECT_FALSE(meta_cache.lookup_orc_file_tail("/path/file.orc", 100, &handle));
+
+    std::string file_tail(10000, 't');
+    meta_cache.insert_orc_file_tail("/path/file.orc", 100, file_tail, &handle);
+    EXPECT_TRUE(handle.valid());
+    // The entry is charged by its size.
+    EXPECT_GE(meta_cache.cache().get_usage(), 10000);
+
+    ObjLRUCache::CacheHandle hit_handle;
+    ASSERT_TRUE(meta_cache.lookup_orc_file_tail("/path/file.orc", 100, &hit_handle));
+    EXPECT_EQ(file_tail, *static_cast<std::string*>(hit_handle.data<std::string>()));
+
+    // A modified file has another tail.
+    ObjLRUCache::CacheHandle miss_handle;
+    EXPECT_FALSE(meta_cache.lookup_orc_file_tail("/path/file.orc", 200, &miss_handle));
+}
+
+TEST(FileMetaCacheTest, DeletionVector) {
+    FileMetaCache meta_cache(1024 * 1024 * 1024, 1000);
+    ObjLRUCache::CacheHandle handle;
+    EXPECT_FALSE(meta_cache.lookup_deletion_vector("/path/index", 10, &handle));
+
+    std::vector<int64_t> positions {1, 5, 100};
+    meta_cache.insert_deletion_vector("/path/index", 10, positions, &handle);
+    EXPECT_TRUE(handle.valid());
+
+    ObjLRUCache::CacheHandle hit_handle;
+    ASSERT_TRUE(meta_cache.lookup_deletion_vector("/path/index", 10, &hit_handle));
+    EXPECT_EQ(positions,
+              *static_cast<std::vector<int64_t>*>(hit_handle.data<std::vector<int64_t>>()));
+
+    // Another deletion vector in the same deletion file.
+    ObjLRUCache::CacheHandle miss_handle;
+    EXPECT_FALSE(meta_cache.lookup_deletion_vector("/path/index", 20, &miss_handle));
+}
+
+TEST(FileMetaCacheTest, Disabled) {
+    FileMetaCache meta_cache(1024 * 1024 * 1024, 0);
+    ObjLRUCache::CacheHandle handle;
+    EXPECT_FALSE(meta_cache.lookup_orc_file_tail("/path/file.orc", 100, &handle));
+}
+
+} // namespace doris
@@ -27,13 +27,16 @@
 #include <cerrno>
 #include <cstdlib>
 #include <filesystem>
+#include <memory>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "cpp/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/io_common.h"
 #include "util/slice.h"
 
 namespace doris {
@@ -135,6 +138,94 @@ TEST_F(LocalFileSystemTest, WriteRead) {
     }
 }
 
+TEST_F(LocalFileSystemTest, DirectRead) {
+    auto fname = fmt::format("{}/direct", test_dir);
+    std::string content(3 * 1024 * 1024 + 123, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i * 31 + i / 4096);
+    }
+    ASSERT_TRUE(save_string_file(fname, content).ok());
+
+    bool enable_direct_read = config::enable_local_direct_read;
+    config::enable_local_direct_read = true;
+    io::IOContext io_ctx;
+    io_ctx.reader_type = ReaderType::READER_BASE_COMPACTION;
+    io::FileReaderSPtr file_reader;
+    auto st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+
+    // small reads are served by the read ahead window
+    std::vector<char> buf(64 * 1024 + 7);
+    size_t offset = 5;
+    for (int i = 0; i < 20; ++i) {
+        size_t bytes_read = 0;
+        st = file_reader->read_at(offset, Slice(buf.data(), buf.size()), &bytes_read, &io_ctx);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(buf.size(), bytes_read);
+        ASSERT_EQ(content.substr(offset, buf.size()), std::string(buf.data(), buf.size()));
+        offset += buf.size();
+    }
+
+    // a large aligned read skips the window
+    constexpr size_t ALIGNMENT = 4096;
+    std::unique_ptr<char, decltype(&free)> aligned_buf(
+            static_cast<char*>(std::aligned_alloc(ALIGNMENT, 2 * 1024 * 1024)), &free);
+    size_t bytes_read = 0;
+    st = file_reader->read_at(ALIGNMENT, Slice(aligned_buf.get(), 2 * 1024 * 1024), &bytes_read,
+                              &io_ctx);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(2 * 1024 * 1024, bytes_read);
+    ASSERT_EQ(content.substr(ALIGNMENT, bytes_read), std::string(aligned_buf.get(), bytes_read));
+
+    // the tail of the file
+    offset = content.size() - 1000;
+    st = file_reader->read_at(offset, Slice(buf.data(), buf.size()), &bytes_read, &io_ctx);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(1000, bytes_read);
+    ASSERT_EQ(content.substr(offset), std::string(buf.data(), bytes_read));
+
+    st = file_reader->close();
+    ASSERT_TRUE(st.ok()) << st;
+    config::enable_local_direct_read = enable_direct_read;
+}
+
+TEST_F(LocalFileSystemTest, LocalDiskIOStats) {
+    auto fname = fmt::format("{}/stats", test_dir);
+    std::string content(10000, 'a');
+    ASSERT_TRUE(save_string_file(fname, content).ok());
+
+    io::FileCacheStatistics stats;
+    io::IOContext io_ctx;
+    io_ctx.file_cache_stats = &stats;
+    io::FileReaderSPtr file_reader;
+    auto st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+    std::vector<char> buf(4000);
+    size_t bytes_read = 0;
+    for (size_t offset : {0, 8000}) {
+        st = file_reader->read_at(offset, Slice(buf.data(), buf.size()), &bytes_read, &io_ctx);
+        ASSERT_TRUE(st.ok()) << st;
+    }
+    EXPECT_EQ(2, stats.num_local_disk_io_total);
+    EXPECT_EQ(6000, stats.bytes_read_from_local_disk);
+    EXPECT_GT(stats.local_disk_io_timer, 0);
+    int64_t num_ios = 0;
+    for (int64_t count : stats.local_disk_io_latency.counts) {
+        num_ios += count;
+    }
+    EXPECT_EQ(2, num_ios);
+    EXPECT_EQ(0, stats.bytes_read_from_remote);
+
+    io::IOLatencyHistogram histogram;
+    histogram.add(50'000);
+    histogram.add(100'000);
+    histogram.add(20'000'000);
+    histogram.add(5'000'000'000);
+    EXPECT_EQ((std::array<int64_t, io::IOLatencyHistogram::NUM_BUCKETS> {1, 1, 0, 1, 0, 1}),
+              histogram.counts);
+    ASSERT_TRUE(file_reader->close().ok());
+}
+
 TEST_F(LocalFileSystemTest, Exist) {
     auto fname = fmt::format("{}/abc", test_dir);
     ASSERT_FALSE(check_exist(fname));
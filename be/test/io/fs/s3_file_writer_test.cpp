@@ -1495,4 +1495,31 @@ TEST_F(S3FileWriterTest, test_empty_file) {
     EXPECT_TRUE(index_file_writer->close().ok());
 }
 
+TEST_F(S3FileWriterTest, file_buffer_pool) {
+    auto max_bytes = config::s3_file_buffer_pool_max_bytes;
+    config::s3_file_buffer_pool_max_bytes = 2 * 1024 * 1024;
+    auto* pool = io::FileBufferPool::instance();
+    const size_t size = 1024 * 1024;
+    char* first = pool->allocate(size);
+    char* second = pool->allocate(size);
+    char* third = pool->allocate(size);
+    pool->deallocate(first, size);
+    pool->deallocate(second, size);
+    // the pool is full
+    pool->deallocate(third, size);
+    EXPECT_EQ(2 * size, pool->cached_bytes());
+    char* reused = pool->allocate(size);
+    EXPECT_TRUE(reused == first || reused == second);
+    EXPECT_EQ(size, pool->cached_bytes());
+    pool->deallocate(reused, size);
+
+    // the buffers of a new size replace the pooled buffers
+    char* larger = pool->allocate(2 * size);
+    pool->deallocate(larger, 2 * size);
+    EXPECT_EQ(2 * size, pool->cached_bytes());
+    EXPECT_EQ(larger, pool->allocate(2 * size));
+    pool->deallocate(larger, 2 * size);
+    config::s3_file_buffer_pool_max_bytes = max_bytes;
+}
+
 } // namespace doris
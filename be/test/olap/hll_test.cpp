@@ -20,7 +20,10 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
+#include "util/coding.h"
 #include "util/hash_util.hpp"
 #include "util/slice.h"
 
@@ -194,6 +197,54 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, SparseRegisters) {
+    HyperLogLog sparse_hll;
+    for (int i = 0; i < 500; ++i) {
+        sparse_hll.update(hash(i));
+    }
+    EXPECT_EQ(HLL_DATA_SPARSE, sparse_hll._type);
+    EXPECT_LT(sparse_hll.memory_consumed(), HLL_REGISTERS_COUNT);
+
+    // the same registers in the full format
+    std::vector<uint8_t> sparse_buf(sparse_hll.max_serialized_size());
+    sparse_buf.resize(sparse_hll.serialize(sparse_buf.data()));
+    EXPECT_EQ(HLL_DATA_SPARSE, sparse_buf[0]);
+    std::vector<uint8_t> full_buf(HLL_REGISTERS_COUNT + 1, 0);
+    full_buf[0] = HLL_DATA_FULL;
+    uint32_t num_registers = decode_fixed32_le(sparse_buf.data() + 1);
+    for (uint32_t i = 0; i < num_registers; ++i) {
+        const uint8_t* reg = sparse_buf.data() + 5 + 3 * i;
+        full_buf[1 + decode_fixed16_le(reg)] = reg[2];
+    }
+    HyperLogLog full_hll(Slice(full_buf.data(), full_buf.size()));
+    EXPECT_EQ(HLL_DATA_FULL, full_hll._type);
+    EXPECT_EQ(full_hll.estimate_cardinality(), sparse_hll.estimate_cardinality());
+    std::vector<uint8_t> buf(full_hll.max_serialized_size());
+    buf.resize(full_hll.serialize(buf.data()));
+    EXPECT_EQ(sparse_buf, buf);
+
+    // merging the sparse registers keeps them sparse
+    HyperLogLog other_hll;
+    for (int i = 500; i < 700; ++i) {
+        other_hll.update(hash(i));
+    }
+    HyperLogLog merged_hll(sparse_hll);
+    merged_hll.merge(other_hll);
+    EXPECT_EQ(HLL_DATA_SPARSE, merged_hll._type);
+    full_hll.merge(other_hll);
+    EXPECT_EQ(full_hll.estimate_cardinality(), merged_hll.estimate_cardinality());
+
+    // too many registers are converted to the full ones
+    for (int i = 700; i < 2000; ++i) {
+        merged_hll.update(hash(i));
+        full_hll.update(hash(i));
+    }
+    EXPECT_EQ(HLL_DATA_FULL, merged_hll._type);
+    EXPECT_EQ(full_hll.estimate_cardinality(), merged_hll.estimate_cardinality());
+    auto cardinality = merged_hll.estimate_cardinality();
+    EXPECT_TRUE(cardinality > 1960 && cardinality < 2040);
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
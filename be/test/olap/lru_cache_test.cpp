@@ -399,6 +399,103 @@ TEST_F(CacheTest, UsageLRUK) {
     ASSERT_EQ(896, cache.get_usage());
 }
 
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(3);
+    cache.set_tiny_lfu_admission(true);
+
+    auto lookup = [&](const CacheKey& key) {
+        uint32_t hash = key.hash(key.data(), key.size(), 0);
+        Cache::Handle* handle = cache.lookup(key, hash);
+        if (handle == nullptr) {
+            return false;
+        }
+        cache.release(handle);
+        return true;
+    };
+
+    CacheKey key1("100");
+    CacheKey key2("200");
+    CacheKey key3("300");
+    insert_number_LRUCache(cache, key1, 100, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key2, 200, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key3, 300, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+    // The frequency of each entry is 2, one insert and one lookup.
+    EXPECT_TRUE(lookup(key1));
+    EXPECT_TRUE(lookup(key2));
+    EXPECT_TRUE(lookup(key3));
+
+    // Cache is full, key4 is not more frequent than key1, the least recently used entry.
+    CacheKey key4("400");
+    insert_number_LRUCache(cache, key4, 400, 1, CachePriority::NORMAL);
+    EXPECT_EQ(1, cache.get_admission_reject_count());
+    insert_number_LRUCache(cache, key4, 400, 1, CachePriority::NORMAL);
+    EXPECT_EQ(2, cache.get_admission_reject_count());
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_TRUE(lookup(key1));
+
+    // key4 is inserted 3 times, more frequent than key2 which is evicted now.
+    insert_number_LRUCache(cache, key4, 400, 1, CachePriority::NORMAL);
+    EXPECT_EQ(2, cache.get_admission_reject_count());
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_FALSE(lookup(key2));
+    EXPECT_TRUE(lookup(key4));
+
+    // Durable entries are always admitted.
+    CacheKey key5("500");
+    insert_number_LRUCache(cache, key5, 500, 1, CachePriority::DURABLE);
+    EXPECT_EQ(2, cache.get_admission_reject_count());
+    EXPECT_TRUE(lookup(key5));
+}
+
+TEST_F(CacheTest, ClockRead) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(3);
+    ASSERT_TRUE(cache.set_clock_read(true));
+
+    auto lookup = [&](const CacheKey& key) {
+        uint32_t hash = key.hash(key.data(), key.size(), 0);
+        Cache::Handle* handle = cache.lookup(key, hash);
+        if (handle == nullptr) {
+            return false;
+        }
+        cache.release(handle);
+        return true;
+    };
+
+    CacheKey key1("100");
+    CacheKey key2("200");
+    CacheKey key3("300");
+    insert_number_LRUCache(cache, key1, 100, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key2, 200, 1, CachePriority::NORMAL);
+    insert_number_LRUCache(cache, key3, 300, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_TRUE(lookup(key1));
+
+    // key1 is visited and gets a second chance, key2 is evicted.
+    CacheKey key4("400");
+    insert_number_LRUCache(cache, key4, 400, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_FALSE(lookup(key2));
+
+    // key3 is in use and is not evicted, key1 is not visited since the last sweep.
+    Cache::Handle* handle3 = cache.lookup(key3, key3.hash(key3.data(), key3.size(), 0));
+    ASSERT_NE(handle3, nullptr);
+    CacheKey key5("500");
+    insert_number_LRUCache(cache, key5, 500, 1, CachePriority::NORMAL);
+    EXPECT_EQ(3, cache.get_usage());
+    EXPECT_FALSE(lookup(key1));
+    EXPECT_TRUE(lookup(key4));
+
+    // The handle is still valid after key3 is erased, and is freed by the release.
+    cache.erase(key3, key3.hash(key3.data(), key3.size(), 0));
+    EXPECT_EQ(2, cache.get_usage());
+    cache.release(handle3);
+    EXPECT_FALSE(lookup(key3));
+    EXPECT_EQ(2, cache.get_element_count());
+}
+
 TEST_F(CacheTest, Prune) {
     LRUCache cache(LRUCacheType::NUMBER);
     cache.set_capacity(5);
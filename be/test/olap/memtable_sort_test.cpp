@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 
 #include "olap/memtable.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
 
 namespace doris {
 
@@ -80,4 +83,38 @@ TEST_F(MemTableSortTest, Tie) {
     EXPECT_FALSE(it3.next());
 }
 
+TEST_F(MemTableSortTest, NormalizedKey) {
+    // null, -3, 5, -3, null, 0, 5, -128
+    auto nested = vectorized::ColumnInt8::create();
+    auto null_map = vectorized::ColumnUInt8::create();
+    std::vector<int8_t> values = {0, -3, 5, -3, 7, 0, 5, -128};
+    std::vector<uint8_t> nulls = {1, 0, 0, 0, 1, 0, 0, 0};
+    for (size_t i = 0; i < values.size(); i++) {
+        nested->insert_value(values[i]);
+        null_map->insert_value(nulls[i]);
+    }
+    auto column = vectorized::ColumnNullable::create(std::move(nested), std::move(null_map));
+
+    DorisVector<std::shared_ptr<RowInBlock>> rows;
+    for (size_t i = 0; i < values.size(); i++) {
+        rows.push_back(std::make_shared<RowInBlock>(i));
+    }
+    // the first row is already sorted
+    auto tie = Tie {1, values.size()};
+    EXPECT_TRUE(sort_one_column_by_normalized_key(rows, tie, *column));
+
+    std::vector<size_t> expected_pos = {0, 4, 7, 1, 3, 5, 2, 6};
+    for (size_t i = 0; i < rows.size(); i++) {
+        EXPECT_EQ(expected_pos[i], rows[i]->_row_pos);
+    }
+    for (size_t i = 2; i < rows.size(); i++) {
+        EXPECT_EQ(column->compare_at(rows[i - 1]->_row_pos, rows[i]->_row_pos, *column, -1) == 0,
+                  tie[i])
+                << i;
+    }
+
+    auto strings = vectorized::ColumnString::create();
+    EXPECT_FALSE(sort_one_column_by_normalized_key(rows, tie, *strings));
+}
+
 } // namespace doris
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/parallel_scan_split_source.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris {
+
+class MockRowsetReader : public RowsetReader {
+public:
+    Status init(RowsetReaderContext* read_context, const RowSetSplits& rs_splits) override {
+        return Status::OK();
+    }
+    Status get_segment_iterators(RowsetReaderContext* read_context,
+                                 std::vector<RowwiseIteratorUPtr>* out_iters,
+                                 bool use_cache) override {
+        return Status::OK();
+    }
+    void reset_read_options() override {}
+    Status next_block(vectorized::Block* block) override { return Status::OK(); }
+    Status next_block_view(vectorized::BlockView* block_view) override { return Status::OK(); }
+    bool delete_flag() override { return false; }
+    Version version() override { return {0, 1}; }
+    RowsetSharedPtr rowset() override { return nullptr; }
+    int64_t filtered_rows() override { return 0; }
+    uint64_t merged_rows() override { return 0; }
+    RowsetTypePB type() const override { return BETA_ROWSET; }
+    int64_t newest_write_timestamp() override { return 0; }
+    void update_profile(RuntimeProfile* profile) override {}
+    RowsetReaderSharedPtr clone() override { return std::make_shared<MockRowsetReader>(); }
+    void set_topn_limit(size_t topn_limit) override {}
+};
+
+class ParallelScanSplitSourceTest : public testing::Test {
+public:
+    void SetUp() override { _target_ms = config::parallel_scan_split_target_ms; }
+    void TearDown() override { config::parallel_scan_split_target_ms = _target_ms; }
+
+private:
+    int32_t _target_ms;
+};
+
+TEST_F(ParallelScanSplitSourceTest, SplitsCoverAllRows) {
+    std::vector<RowsetReaderSharedPtr> rs_readers = {std::make_shared<MockRowsetReader>(),
+                                                     std::make_shared<MockRowsetReader>()};
+    // Segment 1 of the first rowset has no units.
+    std::vector<ParallelScanSplitSource::Unit> units = {
+            {0, 0, 0, 100}, {0, 0, 100, 200}, {0, 2, 0, 100}, {1, 0, 0, 100}, {1, 0, 100, 150}};
+    ParallelScanSplitSource source(rs_readers, {}, units, 1, 100, 300);
+    EXPECT_EQ(550, source.remaining_rows());
+
+    TabletReader::ReadSource read_source;
+    size_t split_rows = 0;
+    // The first split covers half of the max split rows.
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(200, split_rows);
+    ASSERT_EQ(1, read_source.rs_splits.size());
+    EXPECT_EQ(0, read_source.rs_splits[0].segment_offsets.first);
+    EXPECT_EQ(1, read_source.rs_splits[0].segment_offsets.second);
+    EXPECT_EQ(200, read_source.rs_splits[0].segment_row_ranges[0].count());
+
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(200, split_rows);
+    ASSERT_EQ(2, read_source.rs_splits.size());
+    const auto& first = read_source.rs_splits[0];
+    EXPECT_EQ(2, first.segment_offsets.first);
+    EXPECT_EQ(3, first.segment_offsets.second);
+    EXPECT_EQ(100, first.segment_row_ranges[0].count());
+    const auto& second = read_source.rs_splits[1];
+    EXPECT_EQ(0, second.segment_offsets.first);
+    EXPECT_EQ(1, second.segment_offsets.second);
+    EXPECT_EQ(100, second.segment_row_ranges[0].count());
+
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(50, split_rows);
+    EXPECT_EQ(0, source.remaining_rows());
+    EXPECT_FALSE(source.next_split(&read_source, &split_rows));
+}
+
+TEST_F(ParallelScanSplitSourceTest, GapSegmentsHaveEmptyRanges) {
+    std::vector<RowsetReaderSharedPtr> rs_readers = {std::make_shared<MockRowsetReader>()};
+    std::vector<ParallelScanSplitSource::Unit> units = {{0, 0, 0, 10}, {0, 3, 0, 10}};
+    ParallelScanSplitSource source(rs_readers, {}, units, 1, 10, 100);
+    TabletReader::ReadSource read_source;
+    size_t split_rows = 0;
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(20, split_rows);
+    ASSERT_EQ(1, read_source.rs_splits.size());
+    const auto& split = read_source.rs_splits[0];
+    EXPECT_EQ(0, split.segment_offsets.first);
+    EXPECT_EQ(4, split.segment_offsets.second);
+    ASSERT_EQ(4, split.segment_row_ranges.size());
+    EXPECT_EQ(10, split.segment_row_ranges[0].count());
+    EXPECT_TRUE(split.segment_row_ranges[1].is_empty());
+    EXPECT_TRUE(split.segment_row_ranges[2].is_empty());
+    EXPECT_EQ(10, split.segment_row_ranges[3].count());
+}
+
+TEST_F(ParallelScanSplitSourceTest, SplitsSizedByScanSpeed) {
+    config::parallel_scan_split_target_ms = 1;
+    std::vector<RowsetReaderSharedPtr> rs_readers = {std::make_shared<MockRowsetReader>()};
+    std::vector<ParallelScanSplitSource::Unit> units;
+    for (int64_t i = 0; i < 1000; ++i) {
+        units.push_back({0, 0, i * 100, (i + 1) * 100});
+    }
+    ParallelScanSplitSource source(rs_readers, {}, units, 2, 100, 10000);
+    TabletReader::ReadSource read_source;
+    size_t split_rows = 0;
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(5000, split_rows);
+
+    // 1000 rows per ms, a split is read in 1 ms.
+    source.finish_split(split_rows, 5 * 1000 * 1000);
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(1000, split_rows);
+
+    // A selective split is read fast, the next split is capped by the max split rows.
+    source.finish_split(1000 * 1000, 0);
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(10000, split_rows);
+
+    while (source.remaining_rows() / 2 >= 10000) {
+        ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+        EXPECT_EQ(10000, split_rows);
+    }
+    // The rows left are shared by the 2 scanners.
+    size_t remaining = source.remaining_rows();
+    ASSERT_TRUE(source.next_split(&read_source, &split_rows));
+    EXPECT_EQ(remaining / 2, split_rows);
+}
+
+} // namespace doris
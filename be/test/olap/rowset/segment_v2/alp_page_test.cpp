@@ -0,0 +1,206 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class AlpPageTest : public testing::Test {
+public:
+    template <FieldType Type, class ColumnType>
+    void test_encode_decode(const std::vector<typename TypeTraits<Type>::CppType>& src,
+                            size_t* encoded_size) {
+        using CppType = typename TypeTraits<Type>::CppType;
+        PageBuilderOptions builder_options;
+        builder_options.data_page_size = 256 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        ASSERT_TRUE(AlpPageBuilder<Type>::create(&builder_ptr, builder_options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        size_t size = src.size();
+        ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+        ASSERT_EQ(src.size(), size);
+        OwnedSlice page;
+        ASSERT_TRUE(builder->finish(&page).ok());
+        *encoded_size = page.slice().size;
+
+        CppType first_value;
+        ASSERT_TRUE(builder->get_first_value(&first_value).ok());
+        EXPECT_EQ(0, memcmp(&src.front(), &first_value, sizeof(CppType)));
+        CppType last_value;
+        ASSERT_TRUE(builder->get_last_value(&last_value).ok());
+        EXPECT_EQ(0, memcmp(&src.back(), &last_value, sizeof(CppType)));
+
+        PageDecoderOptions decoder_options;
+        AlpPageDecoder<Type> decoder(page.slice(), decoder_options);
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(src.size(), decoder.count());
+        ASSERT_EQ(0, decoder.current_index());
+
+        vectorized::MutableColumnPtr column = ColumnType::create();
+        size_t n = src.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(src.size(), n);
+        const auto& decoded = static_cast<const ColumnType&>(*column).get_data();
+        for (size_t i = 0; i < src.size(); ++i) {
+            ASSERT_EQ(0, memcmp(&src[i], &decoded[i], sizeof(CppType))) << "index " << i;
+        }
+
+        // seek within the page
+        for (size_t pos : {size_t(0), src.size() / 3, src.size() - 1}) {
+            ASSERT_TRUE(decoder.seek_to_position_in_page(pos).ok());
+            EXPECT_EQ(pos, decoder.current_index());
+            vectorized::MutableColumnPtr one = ColumnType::create();
+            n = 1;
+            ASSERT_TRUE(decoder.next_batch(&n, one).ok());
+            ASSERT_EQ(1, n);
+            EXPECT_EQ(0, memcmp(&src[pos], &static_cast<const ColumnType&>(*one).get_data()[0],
+                                sizeof(CppType)));
+        }
+
+        // read by rowids, the last rowid is out of the page
+        const ordinal_t first_ordinal = 1000;
+        std::vector<rowid_t> rowids = {1000, 1001, static_cast<rowid_t>(1000 + src.size() - 1),
+                                       static_cast<rowid_t>(1000 + src.size())};
+        vectorized::MutableColumnPtr selected = ColumnType::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), first_ordinal, &n, selected).ok());
+        ASSERT_EQ(3, n);
+        const auto& selected_data = static_cast<const ColumnType&>(*selected).get_data();
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(0, memcmp(&src[rowids[i] - first_ordinal], &selected_data[i],
+                                sizeof(CppType)));
+        }
+    }
+};
+
+TEST_F(AlpPageTest, TestDecimalDoubles) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> dist(0, 1000000);
+    std::vector<double> src;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(static_cast<double>(dist(rng)) / 100);
+    }
+    size_t encoded_size = 0;
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(
+            src, &encoded_size);
+    // 20 bits per value instead of 64
+    EXPECT_LT(encoded_size, src.size() * sizeof(double) / 2);
+}
+
+TEST_F(AlpPageTest, TestDoubleExceptions) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> dist(-100000, 100000);
+    std::vector<double> src;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(static_cast<double>(dist(rng)) / 1000);
+    }
+    src[10] = std::numeric_limits<double>::quiet_NaN();
+    src[20] = std::numeric_limits<double>::infinity();
+    src[30] = -std::numeric_limits<double>::infinity();
+    src[40] = -0.0;
+    src[50] = M_PI;
+    src[60] = 1e300;
+    src[9999] = std::numeric_limits<double>::denorm_min();
+    size_t encoded_size = 0;
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(
+            src, &encoded_size);
+    EXPECT_LT(encoded_size, src.size() * sizeof(double) / 2);
+}
+
+TEST_F(AlpPageTest, TestRandomDoublesStoredInPlain) {
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<double> src;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(dist(rng));
+    }
+    size_t encoded_size = 0;
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE, vectorized::ColumnFloat64>(
+            src, &encoded_size);
+    EXPECT_EQ(ALP_PAGE_HEADER_SIZE + src.size() * sizeof(double), encoded_size);
+}
+
+TEST_F(AlpPageTest, TestDecimalFloats) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> dist(-5000, 5000);
+    std::vector<float> src;
+    for (int i = 0; i < 10000; ++i) {
+        src.push_back(static_cast<float>(dist(rng)) / 10);
+    }
+    src[100] = std::numeric_limits<float>::quiet_NaN();
+    size_t encoded_size = 0;
+    test_encode_decode<FieldType::OLAP_FIELD_TYPE_FLOAT, vectorized::ColumnFloat32>(
+            src, &encoded_size);
+    EXPECT_LT(encoded_size, src.size() * sizeof(float) / 2);
+}
+
+TEST_F(AlpPageTest, TestEmptyPage) {
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE>::create(&builder_ptr,
+                                                                          builder_options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+    double value;
+    EXPECT_FALSE(builder->get_first_value(&value).ok());
+
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    EXPECT_EQ(0, decoder.count());
+    vectorized::MutableColumnPtr column = vectorized::ColumnFloat64::create();
+    size_t n = 10;
+    ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+    EXPECT_EQ(0, n);
+}
+
+TEST_F(AlpPageTest, TestCorruptedPage) {
+    std::vector<double> src(100, 1.5);
+    PageBuilderOptions builder_options;
+    builder_options.data_page_size = 256 * 1024;
+    PageBuilder* builder_ptr = nullptr;
+    ASSERT_TRUE(AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE>::create(&builder_ptr,
+                                                                          builder_options)
+                        .ok());
+    std::unique_ptr<PageBuilder> builder(builder_ptr);
+    size_t size = src.size();
+    ASSERT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(src.data()), &size).ok());
+    OwnedSlice page;
+    ASSERT_TRUE(builder->finish(&page).ok());
+
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(truncated, PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
@@ -212,5 +212,33 @@ TEST_F(BlockBloomFilterTest, contains) {
     ASSERT_FALSE(bf2->contains(*bf1));
 }
 
+// Test for probing several hashes at once
+TEST_F(BlockBloomFilterTest, test_any_hash) {
+    std::unique_ptr<BloomFilter> bf;
+    EXPECT_TRUE(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf).ok());
+    EXPECT_TRUE(bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64).ok());
+    std::vector<uint64_t> added;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        added.push_back(bf->hash((char*)&i, sizeof(i)));
+        bf->add_hash(added.back());
+    }
+    std::vector<uint64_t> not_added;
+    for (uint32_t i = 1000; i < 2000; ++i) {
+        uint64_t hash = bf->hash((char*)&i, sizeof(i));
+        if (!bf->test_hash(hash)) {
+            not_added.push_back(hash);
+        }
+    }
+    EXPECT_FALSE(not_added.empty());
+    EXPECT_FALSE(bf->test_any_hash(not_added.data(), not_added.size()));
+    EXPECT_FALSE(bf->test_any_hash(nullptr, 0));
+    for (uint64_t hash : added) {
+        EXPECT_TRUE(bf->test_hash(hash));
+        not_added.push_back(hash);
+        EXPECT_TRUE(bf->test_any_hash(not_added.data(), not_added.size()));
+        not_added.pop_back();
+    }
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "olap/rowset/segment_v2/options.h"
+#include "vec/columns/column_string.h"
+
+namespace doris {
+namespace segment_v2 {
+
+class FsstPageTest : public testing::Test {
+public:
+    static constexpr FieldType TYPE = FieldType::OLAP_FIELD_TYPE_VARCHAR;
+
+    OwnedSlice build_page(const std::vector<std::string>& strings) {
+        PageBuilderOptions options;
+        options.data_page_size = 1024 * 1024;
+        PageBuilder* builder_ptr = nullptr;
+        EXPECT_TRUE(FsstPageBuilder<TYPE>::create(&builder_ptr, options).ok());
+        std::unique_ptr<PageBuilder> builder(builder_ptr);
+        std::vector<Slice> values(strings.begin(), strings.end());
+        size_t count = values.size();
+        EXPECT_TRUE(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+        EXPECT_EQ(values.size(), count);
+        OwnedSlice page;
+        EXPECT_TRUE(builder->finish(&page).ok());
+
+        Slice first;
+        EXPECT_TRUE(builder->get_first_value(&first).ok());
+        EXPECT_EQ(strings.front(), first.to_string());
+        Slice last;
+        EXPECT_TRUE(builder->get_last_value(&last).ok());
+        EXPECT_EQ(strings.back(), last.to_string());
+        return page;
+    }
+
+    void check_page(const Slice& page, const std::vector<std::string>& strings) {
+        FsstPageDecoder<TYPE> decoder(page, PageDecoderOptions());
+        ASSERT_TRUE(decoder.init().ok());
+        ASSERT_EQ(strings.size(), decoder.count());
+
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        size_t n = strings.size() / 2;
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        n = strings.size();
+        ASSERT_TRUE(decoder.next_batch(&n, column).ok());
+        ASSERT_EQ(strings.size() - strings.size() / 2, n);
+        ASSERT_EQ(strings.size(), column->size());
+        for (size_t i = 0; i < strings.size(); ++i) {
+            ASSERT_EQ(strings[i], column->get_data_at(i).to_string()) << "index " << i;
+        }
+
+        const ordinal_t first_ordinal = 100;
+        std::vector<rowid_t> rowids = {101, 105, static_cast<rowid_t>(100 + strings.size() - 1),
+                                       static_cast<rowid_t>(100 + strings.size())};
+        vectorized::MutableColumnPtr selected = vectorized::ColumnString::create();
+        n = rowids.size();
+        ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), first_ordinal, &n, selected).ok());
+        ASSERT_EQ(3, n);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(strings[rowids[i] - first_ordinal], selected->get_data_at(i).to_string());
+        }
+
+        const std::string& target = strings[strings.size() / 3];
+        std::string prefix = target.substr(0, target.size() / 2);
+        std::vector<uint8_t> equal_matches(strings.size());
+        std::vector<uint8_t> prefix_matches(strings.size());
+        ASSERT_TRUE(decoder.seek_to_position_in_page(0).ok());
+        n = strings.size();
+        ASSERT_TRUE(decoder.next_batch_equal(Slice(target), &n, equal_matches.data()).ok());
+        ASSERT_EQ(strings.size(), n);
+        ASSERT_TRUE(decoder.seek_to_position_in_page(0).ok());
+        ASSERT_TRUE(decoder.next_batch_prefix(Slice(prefix), &n, prefix_matches.data()).ok());
+        ASSERT_EQ(strings.size(), n);
+        for (size_t i = 0; i < strings.size(); ++i) {
+            EXPECT_EQ(strings[i] == target, equal_matches[i]) << "index " << i;
+            EXPECT_EQ(strings[i].starts_with(prefix), prefix_matches[i]) << "index " << i;
+        }
+    }
+};
+
+TEST_F(FsstPageTest, TestUrls) {
+    std::mt19937 rng(42);
+    std::vector<std::string> strings;
+    for (int i = 0; i < 5000; ++i) {
+        strings.push_back("https://www.example.com/item/" + std::to_string(rng() % 2000) +
+                          "?from=search&page=" + std::to_string(rng() % 10));
+    }
+    strings.emplace_back("");
+    OwnedSlice page = build_page(strings);
+    size_t raw_size = 0;
+    for (const auto& s : strings) {
+        raw_size += s.size();
+    }
+    EXPECT_LT(page.slice().size, raw_size / 2);
+    check_page(page.slice(), strings);
+}
+
+TEST_F(FsstPageTest, TestRandomBytesStoredUncompressed) {
+    std::mt19937 rng(42);
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i) {
+        std::string s(16, '\0');
+        for (auto& c : s) {
+            c = static_cast<char>(rng());
+        }
+        strings.push_back(std::move(s));
+    }
+    OwnedSlice page = build_page(strings);
+    // the strings, the offsets, an empty symbol table and the trailer
+    EXPECT_EQ(16 * 1000 + 4 * 1000 + 1 + FSST_PAGE_TRAILER_SIZE, page.slice().size);
+    check_page(page.slice(), strings);
+}
+
+TEST_F(FsstPageTest, TestCorruptedPage) {
+    std::vector<std::string> strings(100, "corrupted page");
+    OwnedSlice page = build_page(strings);
+    FsstPageDecoder<TYPE> decoder(Slice(page.slice().data, page.slice().size - 1),
+                                  PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace segment_v2
+} // namespace doris
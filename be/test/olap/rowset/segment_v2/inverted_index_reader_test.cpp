@@ -38,6 +38,7 @@
 #include "olap/tablet_schema.h"
 #include "olap/tablet_schema_helper.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
 
 namespace doris::segment_v2 {
@@ -460,6 +461,10 @@ public:
     void test_query_cache() {
         std::string_view rowset_id = "test_read_rowset_4";
         int seg_id = 0;
+        // Admit every result, the query below may take less than the admission threshold.
+        auto admission_min_us = config::inverted_index_query_cache_admission_min_us;
+        config::inverted_index_query_cache_admission_min_us = 0;
+        Defer defer([&] { config::inverted_index_query_cache_admission_min_us = admission_min_us; });
 
         // Prepare data
         std::vector<Slice> values = {Slice("apple"), Slice("banana"), Slice("cherry")};
@@ -3390,6 +3395,31 @@ TEST_F(InvertedIndexReaderTest, QueryCache) {
     test_query_cache();
 }
 
+// The results cheaper than the admission threshold are not cached
+TEST_F(InvertedIndexReaderTest, QueryCacheAdmission) {
+    auto admission_min_us = config::inverted_index_query_cache_admission_min_us;
+    config::inverted_index_query_cache_admission_min_us = 100;
+    Defer defer([&] { config::inverted_index_query_cache_admission_min_us = admission_min_us; });
+
+    auto* cache = InvertedIndexQueryCache::instance();
+    auto bitmap = std::make_shared<roaring::Roaring>();
+    bitmap->addRange(0, 1000);
+    InvertedIndexQueryCache::CacheKey cheap_key {"admission_test", "c1",
+                                                 InvertedIndexQueryType::EQUAL_QUERY, "cheap"};
+    InvertedIndexQueryCache::CacheKey costly_key {"admission_test", "c1",
+                                                  InvertedIndexQueryType::EQUAL_QUERY, "costly"};
+    {
+        InvertedIndexQueryCacheHandle handle;
+        cache->insert(cheap_key, bitmap, &handle, 99 * 1000);
+        InvertedIndexQueryCacheHandle costly_handle;
+        cache->insert(costly_key, bitmap, &costly_handle, 100 * 1000);
+    }
+    InvertedIndexQueryCacheHandle handle;
+    EXPECT_FALSE(cache->lookup(cheap_key, &handle));
+    EXPECT_TRUE(cache->lookup(costly_key, &handle));
+    EXPECT_EQ(1000, handle.get_bitmap()->cardinality());
+}
+
 // Searcher cache test
 TEST_F(InvertedIndexReaderTest, SearcherCache) {
     test_searcher_cache();
@@ -20,7 +20,9 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 
@@ -94,4 +96,55 @@ TEST_F(ShortKeyIndexTest, builder) {
     }
 }
 
+TEST_F(ShortKeyIndexTest, seek_with_equal_prefixes) {
+    // keys sharing the first 8 bytes, keys shorter than 8 bytes and bytes above 0x7F
+    std::vector<std::string> keys;
+    for (int i = 0; i < 300; ++i) {
+        std::string key = "prefix__" + std::to_string(1000 + i);
+        if (i % 3 == 0) {
+            key = std::string(1, static_cast<char>(0x80 + i / 3)) + key;
+        } else if (i % 3 == 1) {
+            key = key.substr(0, i % 8);
+        }
+        keys.push_back(key);
+    }
+    auto comparator = [](const std::string& lhs, const std::string& rhs) {
+        return Slice(lhs).compare(Slice(rhs)) < 0;
+    };
+    std::sort(keys.begin(), keys.end(), comparator);
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    ShortKeyIndexBuilder builder(0, 1024);
+    for (const auto& key : keys) {
+        EXPECT_TRUE(builder.add_item(key).ok());
+    }
+    std::vector<Slice> slices;
+    segment_v2::PageFooterPB footer;
+    EXPECT_TRUE(builder.finalize(1024 * 1024, &slices, &footer).ok());
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+    ShortKeyIndexDecoder decoder;
+    EXPECT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+
+    std::vector<std::string> targets = keys;
+    targets.emplace_back("");
+    targets.emplace_back("prefix_");
+    targets.emplace_back("prefix__");
+    targets.emplace_back("prefix__1");
+    targets.emplace_back("prefix__9");
+    targets.emplace_back(std::string("prefix\0", 7));
+    targets.emplace_back(std::string(10, static_cast<char>(0xFF)));
+    for (const auto& key : keys) {
+        targets.push_back(key + "0");
+    }
+    for (const auto& target : targets) {
+        auto expected_lower = std::lower_bound(keys.begin(), keys.end(), target, comparator);
+        auto expected_upper = std::upper_bound(keys.begin(), keys.end(), target, comparator);
+        EXPECT_EQ(expected_lower - keys.begin(), decoder.lower_bound(target).ordinal());
+        EXPECT_EQ(expected_upper - keys.begin(), decoder.upper_bound(target).ordinal());
+    }
+}
+
 } // namespace doris
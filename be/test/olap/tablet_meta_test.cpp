@@ -346,6 +346,9 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
         ASSERT_EQ(bm->cardinality(), 1005);
     }
 
+    // The cached aggregation bitmaps are accounted to the delete bitmap
+    ASSERT_GT(dbmp->get_agg_cache_size(), 0);
+
     // Check data is not messed-up
     ASSERT_TRUE(dbmp->contains({RowsetId {2, 0, 1, 1}, 1, 2}, 1104));
     ASSERT_FALSE(dbmp->contains({RowsetId {2, 0, 1, 1}, 1, 2}, 1103));
@@ -228,14 +228,14 @@ TEST_F(AggregatedDataVariantsTest, TestNumericKeys) {
     // Test int8 key
     _variants->init(types, HashKeyType::int8_key);
     auto value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt8, AggData<vectorized::UInt8>>>(
+            vectorized::MethodOneNumber<vectorized::UInt8, FixedKeyAggData<vectorized::UInt8>>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
     // Test int16 key
     _variants->init(types, HashKeyType::int16_key);
     value = std::holds_alternative<
-            vectorized::MethodOneNumber<vectorized::UInt16, AggData<vectorized::UInt16>>>(
+            vectorized::MethodOneNumber<vectorized::UInt16, FixedKeyAggData<vectorized::UInt16>>>(
             _variants->method_variant);
     ASSERT_TRUE(value);
 
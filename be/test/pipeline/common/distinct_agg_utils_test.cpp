@@ -20,6 +20,7 @@
 #include <gtest/gtest.h>
 
 #include "common/status.h"
+#include "testutil/column_helper.h"
 #include "vec/common/uint128.h"
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/data_types/data_type_nullable.h"
@@ -205,6 +206,67 @@ TEST_F(DistinctAggUtilsTest, TestDistinctDataVariantsInitFixedKeys) {
                HashKeyType::fixed256);
 }
 
+// The final distinct finds the keys of its frozen hash table once it spills.
+TEST_F(DistinctAggUtilsTest, TestDistinctDataVariantsFind) {
+    auto find_keys = [](DistinctDataVariants& variants, const vectorized::ColumnPtr& column,
+                        bool emplace) {
+        std::vector<bool> found;
+        std::visit(vectorized::Overload {[&](std::monostate& arg) {},
+                                         [&](auto& agg_method) {
+                                             using HashMethodType =
+                                                     std::decay_t<decltype(agg_method)>;
+                                             vectorized::ColumnRawPtrs key_columns {column.get()};
+                                             typename HashMethodType::State state(key_columns);
+                                             const auto rows = (uint32_t)column->size();
+                                             agg_method.init_serialized_keys(key_columns, rows);
+                                             if (emplace) {
+                                                 agg_method.lazy_emplace_batch(
+                                                         state, rows,
+                                                         [&](const auto& ctor, auto& key,
+                                                             auto& origin) { ctor(key); },
+                                                         [&]() {}, [&](size_t, auto*) {});
+                                                 return;
+                                             }
+                                             agg_method.find_batch(
+                                                     state, rows,
+                                                     [&](size_t, const auto& find_result) {
+                                                         found.push_back(find_result.is_found());
+                                                     });
+                                         }},
+                   variants.method_variant);
+        return found;
+    };
+
+    {
+        DistinctDataVariants variants;
+        variants.init({std::make_shared<vectorized::DataTypeInt32>()}, HashKeyType::int32_key);
+        find_keys(variants, vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>(
+                                    {1, 2, 3}),
+                  true);
+        auto found = find_keys(
+                variants,
+                vectorized::ColumnHelper::create_column<vectorized::DataTypeInt32>({2, 4, 1}),
+                false);
+        EXPECT_EQ(found, std::vector<bool>({true, false, true}));
+    }
+
+    {
+        DistinctDataVariants variants;
+        variants.init({vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt8>())},
+                      HashKeyType::int8_key);
+        find_keys(variants,
+                  vectorized::ColumnHelper::create_nullable_column<vectorized::DataTypeInt8>(
+                          {1, 0}, {0, 1}),
+                  true);
+        auto found = find_keys(
+                variants,
+                vectorized::ColumnHelper::create_nullable_column<vectorized::DataTypeInt8>(
+                        {0, 1, 2}, {1, 0, 0}),
+                false);
+        EXPECT_EQ(found, std::vector<bool>({true, true, false}));
+    }
+}
+
 // Test error handling for invalid hash key type
 TEST_F(DistinctAggUtilsTest, TestInvalidHashKeyType) {
     DistinctDataVariants variants;
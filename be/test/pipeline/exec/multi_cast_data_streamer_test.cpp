@@ -207,6 +207,31 @@ TEST_F(MultiCastDataStreamerTest, NormTest) {
     }
 }
 
+TEST_F(MultiCastDataStreamerTest, LastReaderTakesBlock) {
+    using namespace vectorized;
+
+    Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 3});
+    const auto* column = block.get_by_position(0).column.get();
+    EXPECT_TRUE(multi_cast_data_streamer->push(&state, &block, true).ok());
+    EXPECT_GT(multi_cast_data_streamer->_cumulative_mem_size, 0);
+
+    for (int id = 0; id < cast_sender_count; id++) {
+        Block output;
+        bool eos = false;
+        EXPECT_TRUE(multi_cast_data_streamer->pull(&state, id, &output, &eos).ok());
+        EXPECT_TRUE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                output, ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+        if (id + 1 < cast_sender_count) {
+            EXPECT_NE(output.get_by_position(0).column.get(), column);
+        } else {
+            EXPECT_EQ(output.get_by_position(0).column.get(), column);
+        }
+    }
+    EXPECT_EQ(multi_cast_data_streamer->_multi_cast_blocks.size(), 0);
+    EXPECT_EQ(multi_cast_data_streamer->_cumulative_mem_size, 0);
+}
+
 TEST_F(MultiCastDataStreamerTest, MultiTest) {
     using namespace vectorized;
 
@@ -120,6 +120,30 @@ TEST_F(QueryCacheTest, insert_and_lookup) {
     }
 }
 
+TEST_F(QueryCacheTest, lookup_older_version) {
+    std::unique_ptr<QueryCache> query_cache {QueryCache::create_global_cache(1024 * 1024 * 1024)};
+    std::string cache_key = "be ut";
+    {
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3});
+        query_cache->insert(cache_key, 42, result, {1}, 1);
+    }
+    QueryCacheHandle handle;
+    EXPECT_FALSE(query_cache->lookup(cache_key, 43, &handle));
+    EXPECT_FALSE(query_cache->lookup(cache_key, 42, &handle, true));
+    EXPECT_FALSE(query_cache->lookup(cache_key, 41, &handle, true));
+    EXPECT_TRUE(query_cache->lookup(cache_key, 43, &handle, true));
+    EXPECT_EQ(handle.get_cache_version(), 42);
+
+    auto reuse = std::make_shared<QueryCache::IncrementalReuse>(42);
+    query_cache->register_incremental_reuse("instance", reuse);
+    EXPECT_EQ(query_cache->find_incremental_reuse("instance"), reuse);
+    EXPECT_EQ(query_cache->find_incremental_reuse("other"), nullptr);
+    query_cache->unregister_incremental_reuse("instance");
+    EXPECT_EQ(query_cache->find_incremental_reuse("instance"), nullptr);
+}
+
 // ./run-be-ut.sh --run --filter=DataQueueTest.*
 
 } // namespace doris::pipeline
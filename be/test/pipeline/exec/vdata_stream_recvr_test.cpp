@@ -150,6 +150,51 @@ TEST_F(DataStreamRecvrTest, TestSender) {
     sender->close();
 }
 
+TEST_F(DataStreamRecvrTest, TestCoalesceBlocks) {
+    config::enable_exchange_receiver_coalesce_blocks = true;
+    Defer reset_config([&]() { config::enable_exchange_receiver_coalesce_blocks = false; });
+    _mock_state = std::make_unique<MockRuntimeState>();
+    _mock_state->batsh_size = 6;
+    _mock_counter = std::make_unique<RuntimeProfile::HighWaterMarkCounter>(TUnit::UNIT, 0, "test");
+    _mock_profile = std::make_unique<RuntimeProfile>("test");
+    recvr = std::make_shared<MockVDataStreamRecvr>(_mock_state.get(), _mock_counter.get(),
+                                                   _mock_profile.get(), 1, false);
+
+    auto* sender = recvr->sender_queues().back();
+    auto source_dep = std::make_shared<Dependency>(0, 0, "test", false);
+    sender->set_dependency(source_dep);
+    for (auto values : std::vector<std::vector<int32_t>> {{1, 2}, {3, 4}, {5, 6, 7}}) {
+        auto block = ColumnHelper::create_block<DataTypeInt32>(values);
+        sender->add_block(&block, false);
+    }
+    EXPECT_EQ(sender->_block_queue.size(), 3);
+
+    {
+        // The first two blocks are merged, the third one would exceed the batch size.
+        Block block;
+        bool eos = false;
+        auto st = sender->get_batch(&block, &eos);
+        EXPECT_TRUE(st) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt32>({1, 2, 3, 4})));
+        EXPECT_EQ(sender->_block_queue.size(), 1);
+    }
+    {
+        Block block;
+        bool eos = false;
+        auto st = sender->get_batch(&block, &eos);
+        EXPECT_TRUE(st) << st.msg();
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt32>({5, 6, 7})));
+        EXPECT_EQ(sender->_block_queue.size(), 0);
+    }
+    EXPECT_EQ(recvr->_coalesced_blocks_counter->value(), 1);
+    EXPECT_EQ(sender->_recvr->_memory_used_counter->value(), 0);
+    sender->decrement_senders(1);
+    sender->close();
+}
+
 TEST_F(DataStreamRecvrTest, TestSenderClose) {
     create_recvr(3, false);
     EXPECT_EQ(recvr->sender_queues().size(), 1);
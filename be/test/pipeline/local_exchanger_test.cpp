@@ -18,6 +18,8 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "common/status.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/exchange_source_operator.h"
@@ -25,8 +27,10 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "thrift_builder.h"
+#include "util/defer_op.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/exprs/vslot_ref.h"
@@ -1263,4 +1267,226 @@ TEST_F(LocalExchangerTest, TestShuffleExchangerWrongMap) {
                         .is<ErrorCode::INTERNAL_ERROR>());
     }
 }
+
+TEST_F(LocalExchangerTest, ShuffleExchangerSkewRebalance) {
+    int num_sink = 1;
+    int num_sources = 2;
+    int num_partitions = 2;
+    int free_block_limit = 0;
+    std::map<int, int> shuffle_idx_to_instance_idx;
+    for (int i = 0; i < num_partitions; i++) {
+        shuffle_idx_to_instance_idx[i] = i;
+    }
+    config::local_exchange_buffer_mem_limit = 1024 * 1024;
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_partitions);
+    shared_state->exchanger = ShuffleExchanger::create_unique(num_sink, num_sources, num_partitions,
+                                                              free_block_limit);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+
+    auto* exchanger = (ShuffleExchanger*)shared_state->exchanger.get();
+    // Rebalance as soon as any data is processed.
+    exchanger->enable_skew_rebalance(1, 1);
+    EXPECT_TRUE(exchanger->skew_rebalance_enabled());
+
+    auto texpr = TExprNodeBuilder(TExprNodeType::SLOT_REF,
+                                  TTypeDescBuilder()
+                                          .set_types(TTypeNodeBuilder()
+                                                             .set_type(TTypeNodeType::SCALAR)
+                                                             .set_scalar_type(TPrimitiveType::INT)
+                                                             .build())
+                                          .build(),
+                                  0)
+                         .set_slot_ref(TSlotRefBuilder(0, 0).build())
+                         .build();
+    std::unique_ptr<LocalExchangeSinkLocalState> sink_local_state(
+            new LocalExchangeSinkLocalState(nullptr, nullptr));
+    sink_local_state->_exchanger = exchanger;
+    sink_local_state->_compute_hash_value_timer = ADD_TIMER(profile, "ComputeHashValueTime");
+    sink_local_state->_distribute_timer = ADD_TIMER(profile, "DistributeDataTime");
+    sink_local_state->_split_hot_partition_rows_counter =
+            ADD_COUNTER(profile, "SplitHotPartitionRows", TUnit::UNIT);
+    sink_local_state->_partitioner.reset(
+            new vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>(num_partitions));
+    auto slot = doris::vectorized::VSlotRef::create_shared(texpr);
+    slot->_column_id = 0;
+    ((vectorized::Crc32HashPartitioner<vectorized::ShuffleChannelIds>*)
+             sink_local_state->_partitioner.get())
+            ->_partition_expr_ctxs.push_back(
+                    std::make_shared<doris::vectorized::VExprContext>(slot));
+    sink_local_state->_channel_id = 0;
+    sink_local_state->_shared_state = shared_state.get();
+    sink_local_state->_dependency = sink_dep.get();
+    sink_local_state->_memory_used_counter =
+            profile->AddHighWaterMarkCounter("SinkMemoryUsage", TUnit::BYTES, "", 1);
+
+    std::vector<std::unique_ptr<LocalExchangeSourceLocalState>> local_states(num_sources);
+    for (size_t i = 0; i < num_sources; i++) {
+        local_states[i].reset(new LocalExchangeSourceLocalState(nullptr, nullptr));
+        local_states[i]->_exchanger = exchanger;
+        local_states[i]->_get_block_failed_counter =
+                ADD_TIMER(profile, "_get_block_failed_counter" + std::to_string(i));
+        local_states[i]->_copy_data_timer =
+                ADD_TIMER(profile, "_copy_data_timer" + std::to_string(i));
+        local_states[i]->_channel_id = i;
+        local_states[i]->_shared_state = shared_state.get();
+        local_states[i]->_dependency = shared_state->get_dep_by_channel_id(i).front().get();
+        local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+        shared_state->mem_counters[i] = local_states[i]->_memory_used_counter;
+    }
+
+    // All rows have the same key, so a plain shuffle would send them to one source only.
+    const auto num_blocks = 2;
+    for (size_t j = 0; j < num_blocks; j++) {
+        vectorized::Block in_block;
+        vectorized::DataTypePtr int_type = std::make_shared<vectorized::DataTypeInt32>();
+        auto int_col0 = vectorized::ColumnInt32::create();
+        int_col0->insert_many_vals(1, 10);
+        in_block.insert({std::move(int_col0), int_type, "test_int_col0"});
+        EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                  {sink_local_state->_compute_hash_value_timer,
+                                   sink_local_state->_distribute_timer, nullptr},
+                                  {&sink_local_state->_channel_id,
+                                   sink_local_state->_partitioner.get(), sink_local_state.get(),
+                                   &shuffle_idx_to_instance_idx}),
+                  Status::OK());
+    }
+    EXPECT_EQ(sink_local_state->_split_hot_partition_rows_counter->value(), 20);
+
+    size_t total_rows = 0;
+    for (size_t i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].data_queue.size_approx(), num_blocks);
+        bool eos = false;
+        vectorized::Block block;
+        EXPECT_EQ(exchanger->get_block(
+                          _runtime_state.get(), &block, &eos,
+                          {nullptr, nullptr, local_states[i]->_copy_data_timer},
+                          {cast_set<int>(local_states[i]->_channel_id), local_states[i].get()}),
+                  Status::OK());
+        EXPECT_EQ(block.rows(), 10);
+        total_rows += block.rows();
+    }
+    EXPECT_EQ(total_rows, 20);
+}
+
+TEST_F(LocalExchangerTest, PassthroughExchangerRingMatrix) {
+    int num_sink = 3;
+    int num_sources = 2;
+    int free_block_limit = 0;
+    config::local_exchange_buffer_mem_limit = 1024 * 1024;
+    config::enable_local_exchange_ring_matrix = true;
+    // Ring of size 1 makes the second block of a sender and source pair go to the shared queue.
+    config::local_exchange_ring_capacity = 1;
+    Defer defer {[]() {
+        config::enable_local_exchange_ring_matrix = false;
+        config::local_exchange_ring_capacity = 16;
+    }};
+
+    std::vector<std::unique_ptr<LocalExchangeSinkLocalState>> sink_local_states(num_sink);
+    std::vector<std::unique_ptr<LocalExchangeSourceLocalState>> local_states(num_sources);
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto shared_state = LocalExchangeSharedState::create_shared(num_sources);
+    shared_state->exchanger =
+            PassthroughExchanger::create_unique(num_sink, num_sources, free_block_limit);
+    auto sink_dep = std::make_shared<Dependency>(0, 0, "LOCAL_EXCHANGE_SINK_DEPENDENCY", true);
+    sink_dep->set_shared_state(shared_state.get());
+    shared_state->sink_deps.push_back(sink_dep);
+    shared_state->create_source_dependencies(num_sources, 0, 0, "TEST");
+
+    auto* exchanger = (PassthroughExchanger*)shared_state->exchanger.get();
+    for (size_t i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].rings.size(), num_sink);
+    }
+    for (size_t i = 0; i < num_sink; i++) {
+        sink_local_states[i].reset(new LocalExchangeSinkLocalState(nullptr, nullptr));
+        sink_local_states[i]->_exchanger = exchanger;
+        sink_local_states[i]->_compute_hash_value_timer =
+                ADD_TIMER(profile, "ComputeHashValueTime" + std::to_string(i));
+        sink_local_states[i]->_distribute_timer =
+                ADD_TIMER(profile, "distribute_timer" + std::to_string(i));
+        sink_local_states[i]->_channel_id = 0;
+        sink_local_states[i]->_sender_id = i;
+        sink_local_states[i]->_shared_state = shared_state.get();
+        sink_local_states[i]->_dependency = sink_dep.get();
+        sink_local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "SinkMemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+    }
+    for (size_t i = 0; i < num_sources; i++) {
+        local_states[i].reset(new LocalExchangeSourceLocalState(nullptr, nullptr));
+        local_states[i]->_exchanger = exchanger;
+        local_states[i]->_get_block_failed_counter =
+                ADD_TIMER(profile, "_get_block_failed_counter" + std::to_string(i));
+        local_states[i]->_copy_data_timer =
+                ADD_TIMER(profile, "_copy_data_timer" + std::to_string(i));
+        local_states[i]->_channel_id = i;
+        local_states[i]->_shared_state = shared_state.get();
+        local_states[i]->_dependency = shared_state->get_dep_by_channel_id(i).front().get();
+        local_states[i]->_memory_used_counter = profile->AddHighWaterMarkCounter(
+                "MemoryUsage" + std::to_string(i), TUnit::BYTES, "", 1);
+        shared_state->mem_counters[i] = local_states[i]->_memory_used_counter;
+    }
+
+    auto sink_block = [&](size_t sender) {
+        vectorized::Block in_block;
+        vectorized::DataTypePtr int_type = std::make_shared<vectorized::DataTypeInt32>();
+        auto int_col0 = vectorized::ColumnInt32::create();
+        int_col0->insert_many_vals(cast_set<int>(sender), 10);
+        in_block.insert({std::move(int_col0), int_type, "test_int_col0"});
+        EXPECT_EQ(exchanger->sink(_runtime_state.get(), &in_block, false,
+                                  {sink_local_states[sender]->_compute_hash_value_timer,
+                                   sink_local_states[sender]->_distribute_timer, nullptr},
+                                  {&sink_local_states[sender]->_channel_id, nullptr,
+                                   sink_local_states[sender].get(), nullptr}),
+                  Status::OK());
+    };
+    // Each sender pushes 4 blocks, 2 blocks for each source.
+    const auto num_blocks = 4;
+    for (size_t i = 0; i < num_sink; i++) {
+        for (size_t j = 0; j < num_blocks; j++) {
+            sink_block(i);
+        }
+    }
+    for (size_t i = 0; i < num_sources; i++) {
+        EXPECT_EQ(exchanger->_data_queue[i].size_approx(), num_sink * num_blocks / num_sources);
+        EXPECT_EQ(exchanger->_data_queue[i].data_queue.size_approx(), num_sink);
+        EXPECT_EQ(local_states[i]->_dependency->ready(), true);
+    }
+
+    for (size_t i = 0; i < num_sources; i++) {
+        std::set<int> senders;
+        for (size_t j = 0; j <= num_sink * num_blocks / num_sources; j++) {
+            bool eos = false;
+            vectorized::Block block;
+            EXPECT_EQ(exchanger->get_block(
+                              _runtime_state.get(), &block, &eos,
+                              {nullptr, nullptr, local_states[i]->_copy_data_timer},
+                              {cast_set<int>(local_states[i]->_channel_id), local_states[i].get()}),
+                      Status::OK());
+            EXPECT_EQ(eos, false);
+            if (j == num_sink * num_blocks / num_sources) {
+                // All rings and the shared queue are empty, so the source is blocked.
+                EXPECT_EQ(block.rows(), 0);
+                EXPECT_EQ(local_states[i]->_dependency->ready(), false);
+            } else {
+                EXPECT_EQ(block.rows(), 10);
+                const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                        *block.get_by_position(0).column);
+                senders.insert(column.get_element(0));
+            }
+        }
+        EXPECT_EQ(senders.size(), num_sink);
+    }
+    EXPECT_EQ(shared_state->mem_usage, 0);
+
+    // A new block wakes up the blocked source.
+    sink_block(0);
+    EXPECT_EQ(local_states[0]->_dependency->ready(), true);
+    EXPECT_EQ(local_states[1]->_dependency->ready(), false);
+}
+
 } // namespace doris::pipeline
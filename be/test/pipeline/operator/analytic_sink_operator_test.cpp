@@ -239,6 +239,36 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction) {
     std::cout << "######### AggFunction with sum test end #########" << std::endl;
 }
 
+TEST_F(AnalyticSinkOperatorTest, RevocableMemSize) {
+    Initialize(10);
+    create_operator(false, 1, "sum", {std::make_shared<DataTypeInt64>()});
+    sink->_agg_expr_ctxs.resize(1);
+    sink->_agg_expr_ctxs[0] =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    create_local_state();
+    // The whole partition is buffered until eos, so all of the input blocks could be spilled.
+    for (int i = 0; i < 2; ++i) {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>(_data_vals);
+        auto st = sink->sink(state.get(), &block, false);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+    EXPECT_EQ(sink_local_state->_output_block_index, 0);
+    EXPECT_EQ(sink_local_state->_input_block_rows(0), 10);
+    EXPECT_EQ(sink_local_state->_input_block_rows(1), 10);
+    EXPECT_EQ(sink_local_state->revocable_mem_size(),
+              sink_local_state->_input_blocks[0].allocated_bytes() +
+                      sink_local_state->_input_blocks[1].allocated_bytes());
+    EXPECT_GT(sink_local_state->revocable_mem_size(), 0);
+
+    {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+        auto st = sink->sink(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+    EXPECT_EQ(sink_local_state->_output_block_index, 2);
+    EXPECT_EQ(sink_local_state->revocable_mem_size(), 0);
+}
+
 TEST_F(AnalyticSinkOperatorTest, AggFunction2) {
     int batch_size = 2;
     Initialize(batch_size);
@@ -458,6 +488,56 @@ TEST_F(AnalyticSinkOperatorTest, AggFunction4) {
     std::cout << "######### AggFunction with row_number test end #########" << std::endl;
 }
 
+TEST_F(AnalyticSinkOperatorTest, SlidingMaxFunction) {
+    int batch_size = 2;
+    Initialize(batch_size);
+    create_operator(true, 1, "max", {std::make_shared<DataTypeInt64>()});
+    sink->_agg_expr_ctxs.resize(1);
+    sink->_agg_expr_ctxs[0] =
+            MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+    TAnalyticWindow temp_window;
+    temp_window.type = TAnalyticWindowType::ROWS;
+    TAnalyticWindowBoundary window_start;
+    window_start.type = TAnalyticWindowBoundaryType::PRECEDING;
+    window_start.__set_rows_offset_value(1);
+    temp_window.__set_window_start(window_start);
+    TAnalyticWindowBoundary window_end;
+    window_end.type = TAnalyticWindowBoundaryType::FOLLOWING;
+    window_end.__set_rows_offset_value(1);
+    temp_window.__set_window_end(window_end);
+    create_window_type(true, true, temp_window);
+    create_local_state();
+    // rows between 1 preceding and 1 following: _get_next_for_sliding_rows with the queue of max
+    EXPECT_TRUE(sink_local_state->_sliding_extreme_queues[0] != nullptr);
+    EXPECT_TRUE(sink_local_state->_support_incremental_calculate);
+
+    std::vector<int64_t> data_vals {5, 3, 8, 1, 9, 2, 7, 4, 6, 0};
+    std::vector<int64_t> expect_vals {5, 8, 8, 9, 9, 9, 7, 7, 6, 6};
+    for (int i = 0; i < 5; i++) {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>(
+                {data_vals[i * batch_size], data_vals[i * batch_size + 1]});
+        auto st = sink->sink(state.get(), &block, i == 4);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    for (int i = 0; i < 5; i++) {
+        vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>(
+                               {data_vals[i * batch_size], data_vals[i * batch_size + 1]},
+                               {expect_vals[i * batch_size], expect_vals[i * batch_size + 1]})));
+    }
+    vectorized::Block block = ColumnHelper::create_block<DataTypeInt64>({});
+    bool eos = false;
+    auto st = source->get_block(state.get(), &block, &eos);
+    EXPECT_TRUE(st.ok()) << st.msg();
+    EXPECT_EQ(block.rows(), 0);
+    EXPECT_TRUE(eos);
+}
+
 TEST_F(AnalyticSinkOperatorTest, AggFunction5) {
     int batch_size = 2;
     Initialize(batch_size);
@@ -20,6 +20,8 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <numeric>
+#include <set>
 
 #include "common/config.h"
 #include "partitioned_hash_join_test_helper.h"
@@ -32,6 +34,7 @@
 #include "testutil/creators.h"
 #include "testutil/mock/mock_operators.h"
 #include "testutil/mock/mock_runtime_state.h"
+#include "util/defer.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type_number.h"
@@ -503,6 +506,126 @@ TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDisk) {
     ASSERT_EQ(local_state->_shared_state->spilled_streams[test_partition], nullptr);
 }
 
+TEST_F(PartitionedHashJoinProbeOperatorTest, Repartition) {
+    auto [probe_operator, sink_operator] = _helper.create_operators();
+    std::shared_ptr<MockPartitionedHashJoinSharedState> shared_state;
+    auto local_state = _helper.create_probe_local_state(_helper.runtime_state.get(),
+                                                        probe_operator.get(), shared_state);
+    auto* state = _helper.runtime_state.get();
+    constexpr auto fanout = PartitionedHashJoinProbeOperatorX::REPARTITION_FANOUT;
+
+    // Prepare the partitioners of the first repartition level.
+    const auto& eq_cond = probe_operator->_tnode.hash_join_node.eq_join_conjuncts[0];
+    RowDescriptor build_row_desc(state->desc_tbl(), {1}, {false});
+    RowDescriptor probe_row_desc(state->desc_tbl(), {0}, {false});
+    auto build_partitioner = std::make_unique<SpillRePartitionerType>(fanout, 1);
+    ASSERT_TRUE(build_partitioner->init({eq_cond.right}).ok());
+    ASSERT_TRUE(build_partitioner->prepare(state, build_row_desc).ok());
+    ASSERT_TRUE(build_partitioner->open(state).ok());
+    auto probe_partitioner = std::make_unique<SpillRePartitionerType>(fanout, 1);
+    ASSERT_TRUE(probe_partitioner->init({eq_cond.left}).ok());
+    ASSERT_TRUE(probe_partitioner->prepare(state, probe_row_desc).ok());
+    ASSERT_TRUE(probe_partitioner->open(state).ok());
+    probe_operator->_build_repartitioners.emplace_back(std::move(build_partitioner));
+    probe_operator->_probe_repartitioners.emplace_back(std::move(probe_partitioner));
+    probe_operator->_max_repartition_level = 1;
+
+    // Build side of partition 0: 1000 rows on disk and 10 rows in memory.
+    std::vector<int32_t> build_keys(1010);
+    std::iota(build_keys.begin(), build_keys.end(), 1);
+    auto& build_stream = local_state->_shared_state->spilled_streams[0];
+    ASSERT_TRUE(ExecEnv::GetInstance()
+                        ->spill_stream_mgr()
+                        ->register_spill_stream(state, build_stream, print_id(state->query_id()),
+                                                "hash_build", probe_operator->node_id(),
+                                                std::numeric_limits<int32_t>::max(),
+                                                std::numeric_limits<size_t>::max(),
+                                                local_state->operator_profile())
+                        .ok());
+    ASSERT_TRUE(build_stream
+                        ->spill_block(state,
+                                      vectorized::ColumnHelper::create_block<
+                                              vectorized::DataTypeInt32>(std::vector<int32_t>(
+                                              build_keys.begin(), build_keys.begin() + 1000)),
+                                      false)
+                        .ok());
+    ASSERT_TRUE(build_stream->spill_eof().ok());
+    local_state->_shared_state->partitioned_build_blocks[0] =
+            vectorized::MutableBlock::create_unique(
+                    vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(
+                            std::vector<int32_t>(build_keys.begin() + 1000, build_keys.end())));
+
+    // Probe side of partition 0: 100 rows on disk and 3 rows in memory.
+    auto& probe_stream = local_state->_probe_spilling_streams[0];
+    ASSERT_TRUE(ExecEnv::GetInstance()
+                        ->spill_stream_mgr()
+                        ->register_spill_stream(state, probe_stream, print_id(state->query_id()),
+                                                "hash_probe", probe_operator->node_id(),
+                                                std::numeric_limits<int32_t>::max(),
+                                                std::numeric_limits<size_t>::max(),
+                                                local_state->operator_profile())
+                        .ok());
+    ASSERT_TRUE(probe_stream
+                        ->spill_block(state,
+                                      vectorized::ColumnHelper::create_block<
+                                              vectorized::DataTypeInt32>(std::vector<int32_t>(
+                                              build_keys.begin(), build_keys.begin() + 100)),
+                                      false)
+                        .ok());
+    local_state->_probe_blocks[0].emplace_back(
+            vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>({5, 6, 7}));
+
+    const auto old_repartition_bytes = config::spill_hash_join_repartition_bytes;
+    config::spill_hash_join_repartition_bytes = 0;
+    Defer defer {[&]() { config::spill_hash_join_repartition_bytes = old_repartition_bytes; }};
+    ASSERT_TRUE(local_state->_need_to_repartition(0));
+
+    ASSERT_TRUE(local_state->repartition(state, 0).ok());
+    while (local_state->_spill_dependency->_ready.load() == false) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    const auto first_sub_partition = PartitionedHashJoinTestHelper::TEST_PARTITION_COUNT;
+    ASSERT_EQ(local_state->_partition_levels.size(), first_sub_partition + fanout);
+    ASSERT_EQ(local_state->_shared_state->spilled_streams[0], nullptr);
+    ASSERT_EQ(local_state->_shared_state->partitioned_build_blocks[0], nullptr);
+    ASSERT_EQ(local_state->_probe_spilling_streams[0], nullptr);
+    ASSERT_TRUE(local_state->_probe_blocks[0].empty());
+    ASSERT_EQ(local_state->_repartition_partitions->value(), 1);
+
+    // The sub partitions are small enough to stay in memory, and every probe key goes to the
+    // sub partition of the same build key.
+    size_t build_rows = 0;
+    size_t probe_rows = 0;
+    size_t non_empty_partitions = 0;
+    for (uint32_t i = first_sub_partition; i != first_sub_partition + fanout; ++i) {
+        ASSERT_EQ(local_state->_partition_levels[i], 1U);
+        ASSERT_FALSE(local_state->_need_to_repartition(i));
+        ASSERT_EQ(local_state->_shared_state->spilled_streams[i], nullptr);
+        ASSERT_EQ(local_state->_probe_spilling_streams[i], nullptr);
+
+        std::set<int32_t> keys;
+        if (auto& build_block = local_state->_shared_state->partitioned_build_blocks[i]) {
+            const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                    *build_block->get_column_by_position(0));
+            keys.insert(column.get_data().begin(), column.get_data().end());
+            build_rows += build_block->rows();
+            ++non_empty_partitions;
+        }
+        if (auto& probe_block = local_state->_partitioned_blocks[i]) {
+            const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                    *probe_block->get_column_by_position(0));
+            for (auto key : column.get_data()) {
+                ASSERT_TRUE(keys.contains(key)) << key;
+            }
+            probe_rows += probe_block->rows();
+        }
+    }
+    ASSERT_EQ(build_rows, 1010U);
+    ASSERT_EQ(probe_rows, 103U);
+    ASSERT_GT(non_empty_partitions, 1U);
+}
+
 TEST_F(PartitionedHashJoinProbeOperatorTest, RecoverBuildBlocksFromDiskCanceled) {
     // Setup test environment
     auto [probe_operator, sink_operator] = _helper.create_operators();
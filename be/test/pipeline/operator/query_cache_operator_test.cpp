@@ -270,4 +270,88 @@ TEST_F(QueryCacheOperatorTest, test_hit_cache) {
     query_cache_uptr.release();
 }
 
+TEST_F(QueryCacheOperatorTest, test_incremental_reuse) {
+    sink = std::make_unique<CacheSinkOperatorX>();
+    source = std::make_unique<CacheSourceOperatorX>();
+    source->_incremental_reuse = true;
+    EXPECT_TRUE(source->set_child(child_op));
+    child_op->_mock_row_desc.reset(
+            new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt64>()}, &pool});
+    TQueryCacheParam cache_param;
+    cache_param.node_id = 0;
+    cache_param.output_slot_mapping[0] = 0;
+    cache_param.tablet_to_range.insert({42, "test"});
+    cache_param.force_refresh_query_cache = false;
+    cache_param.entry_max_bytes = 1024 * 1024;
+    cache_param.entry_max_rows = 10;
+
+    std::string cache_key;
+    int64_t version = 0;
+    EXPECT_TRUE(QueryCache::build_cache_key(scan_ranges, cache_param, &cache_key, &version));
+    {
+        CacheResult result;
+        result.push_back(std::make_unique<Block>());
+        *result.back() = ColumnHelper::create_block<DataTypeInt64>({1, 2});
+        query_cache->insert(cache_key, version - 10, result, {0}, 1);
+    }
+
+    source->_cache_param = cache_param;
+    create_local_state();
+    ASSERT_NE(source_local_state->_incremental_reuse, nullptr);
+    EXPECT_EQ(source_local_state->_incremental_reuse->base_version, version - 10);
+    auto reuse = query_cache->find_incremental_reuse(source_local_state->_instance_key);
+    ASSERT_EQ(reuse, source_local_state->_incremental_reuse);
+    // the scan reads only the rowsets newer than the entry
+    reuse->accepted = true;
+
+    {
+        auto block = ColumnHelper::create_block<DataTypeInt64>({3, 4});
+        auto st = sink->sink(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>({3, 4})));
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt64>({1, 2})));
+    }
+
+    {
+        Block block;
+        bool eos = false;
+        auto st = source->get_block(state.get(), &block, &eos);
+        EXPECT_TRUE(st.ok()) << st.msg();
+        EXPECT_TRUE(eos);
+    }
+
+    {
+        // The combined result is cached with the new version
+        QueryCacheHandle handle;
+        EXPECT_TRUE(query_cache->lookup(cache_key, version, &handle));
+        size_t rows = 0;
+        for (const auto& block : *handle.get_cache_result()) {
+            rows += block->rows();
+        }
+        EXPECT_EQ(rows, 4);
+    }
+
+    EXPECT_TRUE(source_local_state->close(state.get()).ok());
+    EXPECT_EQ(query_cache->find_incremental_reuse(source_local_state->_instance_key), nullptr);
+    query_cache_uptr.release();
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
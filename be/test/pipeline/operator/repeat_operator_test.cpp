@@ -335,4 +335,60 @@ TEST_F(RepeatOperatorTest, test_with_expr2) {
     EXPECT_TRUE(op->need_more_input_data(state.get()));
 }
 
+TEST_F(RepeatOperatorTest, test_last_repeat_takes_columns) {
+    set_output_slots({std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt64>()),
+                      std::make_shared<DataTypeInt64>(), std::make_shared<DataTypeInt64>()});
+    op->_expr_ctxs = MockSlotRef::create_mock_contexts(
+            {std::make_shared<DataTypeInt64>(), std::make_shared<DataTypeInt64>()});
+    create_local_state();
+
+    *local_state->_child_block = Block {
+            ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3}),
+            ColumnHelper::create_column_with_name<DataTypeInt64>({10, 20, 30}),
+    };
+    EXPECT_TRUE(op->push(state.get(), local_state->_child_block.get(), false));
+    // the evaluated columns are not shared with the child block, like the results of functions
+    for (auto& column : *local_state->_child_block) {
+        column.column = column.column->clone_resized(column.column->size());
+    }
+    const auto* evaluated_column =
+            local_state->_intermediate_block->get_by_position(1).column.get();
+
+    op->_repeat_id_list_size = 2;
+    op->_grouping_list = {{1, 0}};
+    op->_all_slot_ids = {0};
+    op->_output_slots[0]->_id = 0;
+    op->_output_slots[1]->_id = 1;
+    op->_slot_id_set_list.resize(2);
+    op->_slot_id_set_list[1].insert(0);
+
+    {
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(op->pull(state.get(), &block, &eos));
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, Block {
+                               ColumnHelper::create_nullable_column_with_name<DataTypeInt64>(
+                                       {1, 2, 3}, {true, true, true}),
+                               ColumnHelper::create_column_with_name<DataTypeInt64>({10, 20, 30}),
+                               ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 1}),
+                       }));
+        EXPECT_NE(block.get_by_position(1).column.get(), evaluated_column);
+    }
+    {
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(op->pull(state.get(), &block, &eos));
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, Block {
+                               ColumnHelper::create_nullable_column_with_name<DataTypeInt64>(
+                                       {1, 2, 3}, {false, false, false}),
+                               ColumnHelper::create_column_with_name<DataTypeInt64>({10, 20, 30}),
+                               ColumnHelper::create_column_with_name<DataTypeInt64>({0, 0, 0}),
+                       }));
+        EXPECT_EQ(block.get_by_position(1).column.get(), evaluated_column);
+    }
+    EXPECT_TRUE(op->need_more_input_data(state.get()));
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
@@ -554,4 +554,44 @@ TEST_F(ExceptOperatorTest, test_refresh_hash_table) {
         EXPECT_TRUE(block.empty());
     }
 }
+
+TEST_F(ExceptOperatorTest, test_build_with_duplicated_rows) {
+    init_op(2, {std::make_shared<DataTypeInt64>()});
+
+    sink_op->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+    probe_sink_ops[0]->_child_exprs =
+            MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt64>()});
+
+    init_local_state();
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({1, 2, 2, 3});
+        EXPECT_TRUE(sink_op->sink(state.get(), &block, false));
+        EXPECT_TRUE(OperatorHelper::is_block(probe_sink_local_state[0]->dependencies()));
+    }
+
+    {
+        Block block = ColumnHelper::create_block<DataTypeInt64>({3, 4, 1, 4});
+        EXPECT_TRUE(sink_op->sink(state.get(), &block, true));
+        // only the first row of every key is kept
+        EXPECT_EQ(shared_state->build_block.rows(), 4);
+        EXPECT_EQ(shared_state->get_hash_table_size(), 4);
+    }
+
+    {
+        EXPECT_TRUE(OperatorHelper::is_ready(probe_sink_local_state[0]->dependencies()));
+        Block block = ColumnHelper::create_block<DataTypeInt64>({2});
+        EXPECT_TRUE(probe_sink_ops[0]->sink(states[0].get(), &block, true));
+    }
+
+    {
+        EXPECT_TRUE(OperatorHelper::is_ready(source_local_state->dependencies()));
+        Block block;
+        bool eos = false;
+        EXPECT_TRUE(source_op->get_block(state.get(), &block, &eos));
+        EXPECT_TRUE(ColumnHelper::block_equal_with_sort(
+                block, ColumnHelper::create_block<DataTypeInt64>({1, 3, 4})));
+    }
+}
 } // namespace doris::pipeline
\ No newline at end of file
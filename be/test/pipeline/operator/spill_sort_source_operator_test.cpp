@@ -576,4 +576,49 @@ TEST_F(SpillSortSourceOperatorTest, GetBlockWithSpillError) {
     ASSERT_TRUE(st.ok()) << "close failed: " << st.to_string();
 }
 
+TEST_F(SpillSortSourceOperatorTest, ReadSomeColumnsOfSpillStream) {
+    auto [source_operator, sink_operator] = _helper.create_operators();
+    vectorized::SpillStreamSPtr spill_stream;
+    auto st = ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            _helper.runtime_state.get(), spill_stream, print_id(_helper.runtime_state->query_id()),
+            sink_operator->get_name(), sink_operator->node_id(),
+            std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::max(),
+            _helper.operator_profile.get());
+    ASSERT_TRUE(st.ok()) << "register_spill_stream failed: " << st.to_string();
+
+    for (int32_t i = 0; i != 2; ++i) {
+        auto input_block = vectorized::ColumnHelper::create_block<vectorized::DataTypeInt32>(
+                {i, i + 1, i + 2});
+        input_block.insert(
+                vectorized::ColumnHelper::create_column_with_name<vectorized::DataTypeInt64>(
+                        {i * 10, i * 10 + 1, i * 10 + 2}));
+        st = spill_stream->spill_block(_helper.runtime_state.get(), input_block, i == 1);
+        ASSERT_TRUE(st.ok()) << "spill_block failed: " << st.to_string();
+    }
+
+    spill_stream->set_read_counters(_helper.operator_profile.get());
+    spill_stream->reader_->set_read_columns({1});
+    for (int32_t i = 0; i != 2; ++i) {
+        vectorized::Block block;
+        bool eos = false;
+        st = spill_stream->read_next_block_sync(&block, &eos);
+        ASSERT_TRUE(st.ok()) << "read_next_block_sync failed: " << st.to_string();
+        ASSERT_FALSE(eos);
+        ASSERT_EQ(block.columns(), 1);
+        EXPECT_TRUE(vectorized::ColumnHelper::block_equal(
+                block, vectorized::ColumnHelper::create_block<vectorized::DataTypeInt64>(
+                               {i * 10, i * 10 + 1, i * 10 + 2})));
+    }
+
+    // All of the columns are read again after seeking back to the first block.
+    spill_stream->reader_->set_read_columns({});
+    spill_stream->reader_->seek(0);
+    vectorized::Block block;
+    bool eos = false;
+    st = spill_stream->read_next_block_sync(&block, &eos);
+    ASSERT_TRUE(st.ok()) << "read_next_block_sync failed: " << st.to_string();
+    ASSERT_EQ(block.columns(), 2);
+    EXPECT_EQ(block.rows(), 3);
+}
+
 } // namespace doris::pipeline
\ No newline at end of file
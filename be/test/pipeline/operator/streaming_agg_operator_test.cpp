@@ -20,6 +20,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "pipeline/exec/aggregation_sink_operator.h"
 #include "pipeline/exec/aggregation_source_operator.h"
 #include "pipeline/exec/mock_operator.h"
@@ -406,4 +407,79 @@ TEST_F(StreamingAggOperatorTest, test4) {
     { EXPECT_TRUE(local_state->close(state.get()).ok()); }
 }
 
+TEST_F(StreamingAggOperatorTest, test_adaptive_pass_through) {
+    op->_aggregate_evaluators.push_back(vectorized::create_mock_agg_fn_evaluator(
+            pool, MockSlotRef::create_mock_contexts(1, std::make_shared<DataTypeInt64>()), false,
+            false));
+    op->_pool = &pool;
+    op->_needs_finalize = false;
+    op->_is_merge = false;
+
+    EXPECT_TRUE(op->set_child(child_op));
+
+    EXPECT_TRUE(op->prepare(state.get()).ok());
+    op->_probe_expr_ctxs = MockSlotRef::create_mock_contexts(0, std::make_shared<DataTypeInt64>());
+
+    {
+        auto local_state = std::make_unique<MockStreamingAggLocalState>(state.get(), op.get());
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+
+        EXPECT_TRUE(local_state->init(state.get(), info).ok());
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state));
+    }
+
+    {
+        local_state =
+                static_cast<MockStreamingAggLocalState*>(state->get_local_state(op->operator_id()));
+        EXPECT_TRUE(local_state->open(state.get()).ok());
+    }
+
+    const auto window_rows = config::streaming_agg_reduction_window_rows;
+    const auto min_reduction_ratio = config::streaming_agg_min_reduction_ratio;
+    const auto probe_rows = config::streaming_agg_pass_through_probe_rows;
+    config::streaming_agg_reduction_window_rows = 6;
+    config::streaming_agg_min_reduction_ratio = 1.5;
+    config::streaming_agg_pass_through_probe_rows = 6;
+
+    {
+        // Every row creates a new group, so the window has no reduction at all.
+        vectorized::Block block {
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 2, 3, 4, 5, 6}),
+                ColumnHelper::create_column_with_name<DataTypeInt64>({1, 1, 100, 100, 100, 1000})};
+        auto st = op->push(state.get(), &block, true);
+        EXPECT_TRUE(st.ok()) << st.msg();
+
+        EXPECT_EQ(local_state->_get_hash_table_size(), 6);
+        EXPECT_TRUE(local_state->_adaptive_pass_through);
+        EXPECT_EQ(local_state->_adaptive_timeline, "agg->pass@6(1.00)");
+    }
+
+    {
+        EXPECT_TRUE(local_state->_should_pass_through_by_reduction(6));
+        EXPECT_EQ(local_state->_adaptive_pass_through_rows_counter->value(), 6);
+        // The probe rows are passed through, aggregate a window again.
+        EXPECT_FALSE(local_state->_should_pass_through_by_reduction(6));
+        EXPECT_FALSE(local_state->_adaptive_pass_through);
+        EXPECT_EQ(local_state->_adaptive_switch_counter->value(), 2);
+        EXPECT_EQ(local_state->_adaptive_timeline, "agg->pass@6(1.00), pass->agg@6");
+    }
+
+    {
+        // No new group is created by the window, keep aggregating.
+        local_state->_update_reduction_window(6);
+        EXPECT_FALSE(local_state->_adaptive_pass_through);
+    }
+
+    config::streaming_agg_reduction_window_rows = window_rows;
+    config::streaming_agg_min_reduction_ratio = min_reduction_ratio;
+    config::streaming_agg_pass_through_probe_rows = probe_rows;
+
+    { EXPECT_TRUE(local_state->close(state.get()).ok()); }
+}
+
 } // namespace doris::pipeline
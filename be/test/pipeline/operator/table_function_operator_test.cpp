@@ -86,6 +86,24 @@ public:
     }
 };
 
+// Every row has 2 results, which can be expanded by many rows at once.
+class MockBatchTableFunction : public MockTableFunction {
+public:
+    void process_row(size_t row_idx) override {
+        TableFunction::process_row(row_idx);
+        _cur_size = 2;
+    }
+    bool support_get_values_of_rows() const override { return true; }
+    size_t get_values_of_rows(MutableColumnPtr& column, size_t row_idx, size_t end_row,
+                              size_t max_step, std::vector<uint32_t>& child_rows) override {
+        for (; row_idx < end_row && child_rows.size() + 2 <= max_step; ++row_idx) {
+            column->insert_many_defaults(2);
+            child_rows.insert(child_rows.end(), 2, static_cast<uint32_t>(row_idx));
+        }
+        return row_idx;
+    }
+};
+
 struct MockTableFunctionLocalState : TableFunctionLocalState {
     MockTableFunctionLocalState(RuntimeState* state, OperatorXBase* parent)
             : TableFunctionLocalState(state, parent) {}
@@ -356,4 +374,62 @@ TEST_F(TableFunctionOperatorTest, single_two_eos_test) {
     }
 }
 
-} // namespace doris::pipeline
\ No newline at end of file
+TEST_F(TableFunctionOperatorTest, expand_child_rows_test) {
+    {
+        op->_vfn_ctxs =
+                MockSlotRef::create_mock_contexts(DataTypes {std::make_shared<DataTypeInt32>()});
+        auto fn = std::make_shared<MockBatchTableFunction>();
+        fns.push_back(fn);
+        op->_fns.push_back(fn.get());
+        op->_output_slot_ids.push_back(true);
+        child_op->_mock_row_desc.reset(
+                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt32>()}, &pool});
+        op->_mock_row_descriptor.reset(
+                new MockRowDescriptor {{std::make_shared<vectorized::DataTypeInt32>(),
+                                        std::make_shared<vectorized::DataTypeInt32>()},
+                                       &pool});
+        op->_fn_num = 1;
+        EXPECT_TRUE(op->prepare(state.get()));
+
+        local_state_uptr = std::make_unique<MockTableFunctionLocalState>(state.get(), op.get());
+        local_state = local_state_uptr.get();
+        LocalStateInfo info {.parent_profile = &profile,
+                             .scan_ranges = {},
+                             .shared_state = nullptr,
+                             .shared_state_map = {},
+                             .task_idx = 0};
+        EXPECT_TRUE(local_state->init(state.get(), info));
+        state->resize_op_id_to_local_state(-100);
+        state->emplace_local_state(op->operator_id(), std::move(local_state_uptr));
+        EXPECT_TRUE(local_state->open(state.get()));
+    }
+
+    state->batsh_size = 5;
+    {
+        *local_state->_child_block = ColumnHelper::create_block<DataTypeInt32>({1, 2, 3});
+        local_state->_child_eos = true;
+        auto st = op->push(state.get(), local_state->_child_block.get(), true);
+        EXPECT_TRUE(st) << st.msg();
+    }
+    {
+        // the first 2 rows are expanded at once, the last one does not fit and is split.
+        Block block;
+        bool eos = false;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st) << st.msg();
+        EXPECT_FALSE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(block, ColumnHelper::create_block<DataTypeInt32>(
+                                                             {1, 1, 2, 2, 3}, {0, 0, 0, 0, 0})));
+    }
+    {
+        Block block;
+        bool eos = false;
+        auto st = op->pull(state.get(), &block, &eos);
+        EXPECT_TRUE(st) << st.msg();
+        EXPECT_TRUE(eos);
+        EXPECT_TRUE(ColumnHelper::block_equal(
+                block, ColumnHelper::create_block<DataTypeInt32>({3}, {0})));
+    }
+}
+
+} // namespace doris::pipeline
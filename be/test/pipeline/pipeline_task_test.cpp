@@ -18,6 +18,9 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <set>
+#include <thread>
+
 #include "common/status.h"
 #include "dummy_task_queue.h"
 #include "pipeline/dependency.h"
@@ -1033,4 +1036,65 @@ TEST_F(PipelineTaskTest, TEST_INJECT_SHARED_STATE) {
     }
 }
 
+TEST_F(PipelineTaskTest, TEST_LOCK_FREE_TASK_QUEUE) {
+    auto num_instances = 1;
+    auto pip_id = 0;
+    auto pip = std::make_shared<Pipeline>(pip_id, num_instances, num_instances);
+    {
+        OperatorPtr source_op;
+        source_op.reset(new DummyOperator());
+        EXPECT_TRUE(pip->add_operator(source_op, num_instances).ok());
+
+        int op_id = 1;
+        int node_id = 2;
+        int dest_id = 3;
+        DataSinkOperatorPtr sink_op;
+        sink_op.reset(new DummySinkOperatorX(op_id, node_id, dest_id));
+        EXPECT_TRUE(pip->set_sink(sink_op).ok());
+    }
+    auto profile = std::make_shared<RuntimeProfile>("Pipeline : " + std::to_string(pip_id));
+    std::map<int,
+             std::pair<std::shared_ptr<BasicSharedState>, std::vector<std::shared_ptr<Dependency>>>>
+            shared_state_map;
+    std::vector<PipelineTaskSPtr> tasks;
+    for (int task_id = 0; task_id < 3; task_id++) {
+        tasks.push_back(std::make_shared<PipelineTask>(pip, task_id, _runtime_state.get(),
+                                                       _context, profile.get(), shared_state_map,
+                                                       task_id));
+    }
+    // The task which has run for a long time goes to a lower level.
+    tasks[2]->inc_runtime_ns(5'000'000'000ULL);
+
+    PriorityTaskQueue queue(true);
+    EXPECT_EQ(queue.try_take(false), nullptr);
+    for (auto& task : tasks) {
+        EXPECT_TRUE(queue.push(task).ok());
+    }
+    EXPECT_EQ(queue._total_task_size, 3);
+
+    std::set<PipelineTask*> taken;
+    for (int i = 0; i < 3; i++) {
+        auto task = i == 1 ? queue.try_take(true) : queue.take(1);
+        EXPECT_NE(task, nullptr);
+        taken.insert(task.get());
+    }
+    EXPECT_EQ(taken.size(), 3);
+    EXPECT_EQ(tasks[2]->get_queue_level(), 2);
+    EXPECT_EQ(queue._total_task_size, 0);
+    // Timeout without any task.
+    EXPECT_EQ(queue.take(1), nullptr);
+
+    // A sleeping worker is woken up by a task pushed by another thread.
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_TRUE(queue.push(tasks[0]).ok());
+    });
+    EXPECT_EQ(queue.take(0), tasks[0]);
+    producer.join();
+
+    queue.close();
+    EXPECT_FALSE(queue.push(tasks[1]).ok());
+    EXPECT_EQ(queue.take(1), nullptr);
+}
+
 } // namespace doris::pipeline
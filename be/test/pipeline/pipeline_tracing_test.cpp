@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace doris::pipeline {
+
+class PipelineTracingTest : public testing::Test {
+public:
+    void SetUp() override {
+        _log_dir = std::filesystem::temp_directory_path() / "pipeline_tracing_test";
+        std::filesystem::remove_all(_log_dir);
+        std::filesystem::create_directories(_log_dir);
+        _ctx._log_dir = _log_dir;
+    }
+    void TearDown() override { std::filesystem::remove_all(_log_dir); }
+
+protected:
+    std::string _read_file(const std::filesystem::path& path) {
+        std::ifstream file(path);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    std::filesystem::path _log_dir;
+    PipelineTracerContext _ctx;
+};
+
+TEST_F(PipelineTracingTest, ChangeRecordParams) {
+    EXPECT_FALSE(_ctx.enabled());
+    EXPECT_TRUE(_ctx.change_record_params({{"type", "per_query"}}).ok());
+    EXPECT_TRUE(_ctx.enabled());
+    EXPECT_EQ(_ctx._dump_format, PipelineTracerContext::RecordFormat::Text);
+    EXPECT_TRUE(_ctx.change_record_params({{"format", "chrome"}}).ok());
+    EXPECT_EQ(_ctx._dump_format, PipelineTracerContext::RecordFormat::ChromeTrace);
+    EXPECT_TRUE(_ctx.change_record_params({{"format", "text"}}).ok());
+    EXPECT_EQ(_ctx._dump_format, PipelineTracerContext::RecordFormat::Text);
+    EXPECT_TRUE(_ctx.change_record_params({{"format", "Perfetto"}}).ok());
+    EXPECT_EQ(_ctx._dump_format, PipelineTracerContext::RecordFormat::ChromeTrace);
+    EXPECT_FALSE(_ctx.change_record_params({{"format", "unknown"}}).ok());
+    EXPECT_TRUE(_ctx.change_record_params({{"type", "disable"}}).ok());
+    EXPECT_FALSE(_ctx.enabled());
+    // Nothing is recorded if tracing is disabled.
+    EXPECT_EQ(_ctx.record_flow_start(TUniqueId(), "dep"), 0);
+}
+
+TEST_F(PipelineTracingTest, DumpTextPerQuery) {
+    EXPECT_TRUE(_ctx.change_record_params({{"type", "per_query"}}).ok());
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 2;
+    _ctx.record({query_id, "task0(pipeline0)", 3, 100, 10, 20});
+    _ctx.end_query(query_id, 7);
+
+    auto content = _read_file(_log_dir / fmt::format("query{}", doris::to_string(query_id)));
+    EXPECT_EQ(content,
+              fmt::format("{}|task0(pipeline0)|3|100|10|20|7\n", doris::to_string(query_id)));
+}
+
+TEST_F(PipelineTracingTest, DumpChromeTracePerQuery) {
+    EXPECT_TRUE(_ctx.change_record_params({{"type", "per_query"}, {"format", "chrome"}}).ok());
+    TUniqueId query_id;
+    query_id.hi = 3;
+    query_id.lo = 4;
+
+    // A dependency wakes up a task which then runs on worker 2, and an RPC sent by the task.
+    auto wake_up_flow_id = _ctx.record_flow_start(query_id, "DATA_DEPENDENCY");
+    EXPECT_GT(wake_up_flow_id, 0);
+    _ctx.record({query_id, "task1(pipeline0)", 2, 200, 30, 50, wake_up_flow_id});
+    auto rpc_flow_id = _ctx.record_flow_start(query_id, "TransmitData");
+    EXPECT_NE(rpc_flow_id, wake_up_flow_id);
+    _ctx.record_flow_end(query_id, "TransmitDataCallback", rpc_flow_id);
+    _ctx.end_query(query_id, 9);
+
+    auto content = _read_file(_log_dir / fmt::format("query{}.json", doris::to_string(query_id)));
+    rapidjson::Document doc;
+    doc.Parse(content.c_str());
+    ASSERT_FALSE(doc.HasParseError()) << content;
+    ASSERT_TRUE(doc.HasMember("traceEvents"));
+    const auto& events = doc["traceEvents"];
+    ASSERT_TRUE(events.IsArray());
+
+    std::map<std::string, int> phase_count;
+    bool has_task = false;
+    bool has_worker_name = false;
+    for (const auto& event : events.GetArray()) {
+        EXPECT_EQ(event["pid"].GetUint64(), 9);
+        std::string phase = event["ph"].GetString();
+        phase_count[phase]++;
+        if (phase == "X" && std::string(event["name"].GetString()) == "task1(pipeline0)") {
+            has_task = true;
+            EXPECT_EQ(event["tid"].GetUint64(), 200);
+            EXPECT_EQ(event["ts"].GetUint64(), 30);
+            EXPECT_EQ(event["dur"].GetUint64(), 20);
+        }
+        if (phase == "M" && event["tid"].GetUint64() == 200) {
+            has_worker_name =
+                    std::string(event["args"]["name"].GetString()) == "pipeline_worker_2";
+        }
+    }
+    EXPECT_TRUE(has_task);
+    EXPECT_TRUE(has_worker_name);
+    // 1 task slice and 3 tiny slices for the flow points.
+    EXPECT_EQ(phase_count["X"], 4);
+    EXPECT_EQ(phase_count["s"], 2);
+    EXPECT_EQ(phase_count["f"], 2);
+}
+
+} // namespace doris::pipeline
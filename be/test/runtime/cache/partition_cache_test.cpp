@@ -280,6 +280,46 @@ TEST_F(PartitionCacheTest, fetch_data_overdue) {
     clear();
 }
 
+TEST_F(PartitionCacheTest, fetch_before_overdue_partition) {
+    init_default();
+    init_batch_data(1, 1, 3, CacheType::PARTITION_CACHE);
+
+    // only the latest partition is newer than the cache
+    set_sql_key(_fetch_request->mutable_sql_key(), 1, 1);
+    for (int i = 1; i <= 3; i++) {
+        PCacheParam* p = _fetch_request->add_params();
+        p->set_partition_key(i);
+        p->set_last_version(i == 3 ? 4 : i);
+        p->set_last_version_time(i == 3 ? 4 : i);
+    }
+    _cache->fetch(_fetch_request, _fetch_result);
+    EXPECT_TRUE(_fetch_result->status() == PCacheStatus::CACHE_OK);
+    EXPECT_EQ(_fetch_result->values_size(), 2);
+    EXPECT_EQ(_fetch_result->values(0).param().partition_key(), 1);
+    EXPECT_EQ(_fetch_result->values(1).param().partition_key(), 2);
+
+    // the recomputed partition replaces the overdue one
+    PUpdateCacheRequest up_req;
+    PCacheResponse up_res;
+    set_sql_key(up_req.mutable_sql_key(), 1, 1);
+    PCacheValue* value = up_req.add_values();
+    value->mutable_param()->set_partition_key(3);
+    value->mutable_param()->set_last_version(4);
+    value->mutable_param()->set_last_version_time(4);
+    value->set_data_size(16);
+    value->add_rows("0123456789abcdef");
+    up_req.set_cache_type(CacheType::PARTITION_CACHE);
+    _cache->update(&up_req, &up_res);
+    EXPECT_TRUE(up_res.status() == PCacheStatus::CACHE_OK);
+    EXPECT_EQ(_cache->get_cache_size(), 3 * 16);
+
+    _fetch_result->Clear();
+    _cache->fetch(_fetch_request, _fetch_result);
+    EXPECT_TRUE(_fetch_result->status() == PCacheStatus::CACHE_OK);
+    EXPECT_EQ(_fetch_result->values_size(), 3);
+    clear();
+}
+
 TEST_F(PartitionCacheTest, prune_data) {
     init(1, 1);
     init_batch_data(LOOP_LESS_OR_MORE(10, 129), 1, 1024,
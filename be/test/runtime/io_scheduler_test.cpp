@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_management/io_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+
+class IOSchedulerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _max_reads = config::io_scheduler_max_concurrent_local_reads;
+        config::io_scheduler_max_concurrent_local_reads = 1;
+    }
+
+    void TearDown() override {
+        for (auto& t : _threads) {
+            t.join();
+        }
+        config::io_scheduler_max_concurrent_local_reads = _max_reads;
+    }
+
+    // Starts a read which waits in the scheduler, it reads 300 bytes once granted.
+    void start_read(IOScheduler* scheduler, uint64_t group_id, uint64_t weight,
+                    int64_t deadline_ms = 0) {
+        size_t waiting = scheduler->waiting();
+        _threads.emplace_back([this, scheduler, group_id, weight, deadline_ms]() {
+            scheduler->acquire(group_id, weight, deadline_ms);
+            {
+                std::lock_guard<std::mutex> l(_lock);
+                _granted.push_back(group_id);
+            }
+            scheduler->release(group_id, 300);
+        });
+        while (scheduler->waiting() == waiting) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    void wait_for_reads(IOScheduler* scheduler) {
+        for (auto& t : _threads) {
+            t.join();
+        }
+        _threads.clear();
+        EXPECT_EQ(0, scheduler->running());
+        EXPECT_EQ(0, scheduler->waiting());
+    }
+
+protected:
+    int32_t _max_reads;
+    std::mutex _lock;
+    std::vector<uint64_t> _granted;
+    std::vector<std::thread> _threads;
+};
+
+TEST_F(IOSchedulerTest, GroupsShareByWeight) {
+    IOScheduler scheduler(false);
+    // Group 1 has read 30 bytes.
+    scheduler.acquire(1, 1, 0);
+    scheduler.release(1, 30);
+
+    scheduler.acquire(0, 1, 0);
+    EXPECT_EQ(1, scheduler.running());
+    for (int i = 0; i < 3; ++i) {
+        start_read(&scheduler, 1, 1);
+    }
+    for (int i = 0; i < 3; ++i) {
+        start_read(&scheduler, 2, 3);
+    }
+    EXPECT_EQ(6, scheduler.waiting());
+    scheduler.release(0, 0);
+    wait_for_reads(&scheduler);
+    // A read of group 1 costs 3 times as much as a read of group 2.
+    std::vector<uint64_t> expected = {2, 1, 2, 2, 1, 1};
+    EXPECT_EQ(expected, _granted);
+}
+
+TEST_F(IOSchedulerTest, NearDeadlineGoesFirst) {
+    IOScheduler scheduler(false);
+    scheduler.acquire(0, 1, 0);
+    start_read(&scheduler, 1, 1000);
+    start_read(&scheduler, 1, 1000);
+    // Times out in 1s, within io_scheduler_deadline_slack_ms.
+    start_read(&scheduler, 2, 1, MonotonicMillis() + 1000);
+    scheduler.release(0, 0);
+    wait_for_reads(&scheduler);
+    std::vector<uint64_t> expected = {2, 1, 1};
+    EXPECT_EQ(expected, _granted);
+}
+
+TEST_F(IOSchedulerTest, DisabledNeverWaits) {
+    config::io_scheduler_max_concurrent_local_reads = 0;
+    EXPECT_EQ(nullptr, IOScheduler::local("/data"));
+    IOScheduler scheduler(false);
+    for (int i = 0; i < 100; ++i) {
+        scheduler.acquire(1, 1, 0);
+    }
+    EXPECT_EQ(100, scheduler.running());
+    EXPECT_EQ(0, scheduler.waiting());
+    for (int i = 0; i < 100; ++i) {
+        scheduler.release(1, 1);
+    }
+}
+
+} // namespace doris
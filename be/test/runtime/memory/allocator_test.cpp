@@ -22,6 +22,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "vec/common/allocator_fwd.h"
 
@@ -59,4 +60,20 @@ TEST(AllocatorTest, TestNormal) {
     test_normal();
 }
 
+TEST(AllocatorTest, TestHugePage) {
+    const bool enable_huge_page = config::enable_huge_page_for_large_alloc;
+    config::enable_huge_page_for_large_alloc = true;
+    const size_t size = config::huge_page_alloc_threshold_bytes;
+    Allocator<true, false, false> allocator;
+    auto* ptr = reinterpret_cast<char*>(allocator.alloc(size));
+    // Aligned to the huge page and still zero filled.
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % (2UL << 20), 0);
+    EXPECT_EQ(ptr[0], 0);
+    EXPECT_EQ(ptr[size - 1], 0);
+    ptr = reinterpret_cast<char*>(allocator.realloc(ptr, size, size * 2));
+    EXPECT_NE(nullptr, ptr);
+    allocator.free(ptr, size * 2);
+    config::enable_huge_page_for_large_alloc = enable_huge_page;
+}
+
 } // namespace doris
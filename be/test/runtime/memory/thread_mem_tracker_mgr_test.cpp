@@ -548,4 +548,56 @@ TEST_F(ThreadMemTrackerMgrTest, ReserveMemoryFailed) {
     }
 }
 
+TEST_F(ThreadMemTrackerMgrTest, AdaptiveConsumeBatch) {
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    std::shared_ptr<MemTrackerLimiter> t = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-AdaptiveConsumeBatch");
+    std::shared_ptr<ResourceContext> rc = ResourceContext::create_shared();
+    rc->memory_context()->set_mem_tracker(t);
+    const int64_t min_bytes = config::mem_tracker_consume_min_size_bytes;
+
+    thread_context->attach_task(rc);
+    auto* mgr = thread_context->thread_mem_tracker_mgr.get();
+    EXPECT_EQ(mgr->consume_batch_bytes(), 0);
+    mgr->consume(min_bytes);
+    EXPECT_EQ(t->consumption(), min_bytes);
+    // Far from the limit, the batch grows.
+    EXPECT_EQ(mgr->consume_batch_bytes(), min_bytes * 2);
+    mgr->consume(min_bytes);
+    EXPECT_EQ(t->consumption(), min_bytes);
+    mgr->consume(min_bytes);
+    EXPECT_EQ(t->consumption(), min_bytes * 3);
+
+    // Near the limit, the batch is reset to the min.
+    t->set_limit(min_bytes * 4);
+    mgr->consume(min_bytes * 4);
+    EXPECT_EQ(mgr->consume_batch_bytes(), 0);
+    mgr->consume(-min_bytes * 7);
+    EXPECT_EQ(t->consumption(), 0);
+    thread_context->detach_task();
+}
+
+TEST_F(ThreadMemTrackerMgrTest, CheckLimitLease) {
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    std::shared_ptr<MemTrackerLimiter> t = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::QUERY, "UT-CheckLimitLease", 1024L * 1024 * 1024);
+    std::shared_ptr<ResourceContext> rc = ResourceContext::create_shared();
+    rc->memory_context()->set_mem_tracker(t);
+
+    thread_context->attach_task(rc);
+    auto* mgr = thread_context->thread_mem_tracker_mgr.get();
+    EXPECT_TRUE(mgr->check_limit(1024).ok());
+    EXPECT_EQ(mgr->_limit_check_lease, config::mem_tracker_limit_check_lease_bytes);
+    EXPECT_TRUE(mgr->check_limit(1024).ok());
+    EXPECT_EQ(mgr->_limit_check_lease, config::mem_tracker_limit_check_lease_bytes - 1024);
+
+    // The checks beyond the lease still fail on the limiter.
+    EXPECT_FALSE(mgr->check_limit(2048L * 1024 * 1024).ok());
+    t->set_limit(1024);
+    EXPECT_TRUE(mgr->check_limit(1024).ok()); // within the lease
+    mgr->_limit_check_lease = 0;
+    EXPECT_FALSE(mgr->check_limit(2048).ok());
+    thread_context->detach_task();
+}
+
 } // end namespace doris
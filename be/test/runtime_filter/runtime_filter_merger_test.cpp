@@ -137,6 +137,32 @@ TEST_F(RuntimeFilterMergerTest, invalid_merge) {
     ASSERT_EQ(st.code(), ErrorCode::INTERNAL_ERROR);
 }
 
+TEST_F(RuntimeFilterMergerTest, merge_from_combined) {
+    std::shared_ptr<RuntimeFilterMerger> merger;
+    auto desc = TRuntimeFilterDescBuilder().build();
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(RuntimeFilterMerger::create(_query_ctx.get(), &desc, &merger));
+    merger->set_expected_producer_num(3);
+
+    std::shared_ptr<RuntimeFilterProducer> producer;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            _runtime_states[0]->register_producer_runtime_filter(desc, &producer));
+    producer->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::READY);
+    std::shared_ptr<RuntimeFilterProducer> producer2;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            _runtime_states[1]->register_producer_runtime_filter(desc, &producer2));
+    producer2->set_wrapper_state_and_ready_to_publish(RuntimeFilterWrapper::State::DISABLED);
+
+    // Two filters combined before reaching the merger count as two producers.
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(producer->merge(producer2.get()));
+    ASSERT_EQ(producer->_wrapper->_state, RuntimeFilterWrapper::State::DISABLED);
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(merger->merge_from(producer.get(), 2));
+    ASSERT_FALSE(merger->ready());
+    ASSERT_EQ(merger->_received_producer_num, 2);
+
+    auto st = merger->merge_from(producer2.get(), 2);
+    ASSERT_EQ(st.code(), ErrorCode::INTERNAL_ERROR);
+}
+
 TEST_F(RuntimeFilterMergerTest, merge_from_ready_and_disabled) {
     test_merge_from(RuntimeFilterWrapper::State::READY, RuntimeFilterWrapper::State::READY,
                     RuntimeFilterWrapper::State::DISABLED, RuntimeFilterWrapper::State::DISABLED);
@@ -167,4 +167,51 @@ TEST_F(RuntimeFilterProducerHelperTest, broadcast) {
     FAIL_IF_ERROR_OR_CATCH_EXCEPTION(helper2.publish(_runtime_states[1].get()));
 }
 
+TEST_F(RuntimeFilterProducerHelperTest, size_by_ndv) {
+    vectorized::VExprContextSPtr ctx;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(vectorized::VExpr::create_expr_tree(
+            TRuntimeFilterDescBuilder::get_default_expr(), ctx));
+    ctx->_last_result_column_id = 0;
+    vectorized::VExprContextSPtrs build_expr_ctxs = {ctx};
+
+    // 10000 build rows with 100 distinct keys.
+    vectorized::Block block;
+    auto column = vectorized::ColumnInt32::create();
+    for (int i = 0; i < 10000; i++) {
+        column->insert(vectorized::Field::create_field<TYPE_INT>(i % 100));
+    }
+    block.insert({std::move(column), std::make_shared<vectorized::DataTypeInt32>(), "col1"});
+
+    auto bloom_helper = RuntimeFilterProducerHelper(true, true);
+    std::vector<TRuntimeFilterDesc> bloom_descs = {TRuntimeFilterDescBuilder()
+                                                           .set_type(TRuntimeFilterType::BLOOM)
+                                                           .set_build_bf_by_runtime_size(true)
+                                                           .build()};
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            bloom_helper.init(_runtime_states[0].get(), build_expr_ctxs, bloom_descs));
+    ASSERT_NE(bloom_helper._build_key_ndvs[0], nullptr);
+    // Fall back to the rows before the sketch sees all the rows.
+    ASSERT_EQ(bloom_helper._filter_size(0, 10001), 10001U);
+    bloom_helper.update_ndv(block);
+    ASSERT_EQ(bloom_helper._filter_size(0, 10001), 100U);
+
+    // The choice between in filter and bloom filter does not change.
+    auto in_or_bloom_helper = RuntimeFilterProducerHelper(true, true);
+    std::vector<TRuntimeFilterDesc> in_or_bloom_descs = {
+            TRuntimeFilterDescBuilder().set_build_bf_by_runtime_size(true).build()};
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(in_or_bloom_helper.init(_runtime_states[0].get(),
+                                                             build_expr_ctxs, in_or_bloom_descs));
+    in_or_bloom_helper.update_ndv(block);
+    const auto max_in_num =
+            static_cast<uint64_t>(in_or_bloom_helper._producers[0]->wrapper()->max_in_num());
+    ASSERT_LT(max_in_num, 10000U);
+    ASSERT_EQ(in_or_bloom_helper._filter_size(0, 10001), std::max<uint64_t>(100, max_in_num + 1));
+
+    std::map<int, std::shared_ptr<RuntimeFilterWrapper>> runtime_filters;
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(
+            bloom_helper.build(_runtime_states[0].get(), &block, false, runtime_filters));
+    ASSERT_EQ(bloom_helper._bloom_filter_infos.size(), 1U);
+    FAIL_IF_ERROR_OR_CATCH_EXCEPTION(bloom_helper.publish(_runtime_states[0].get()));
+}
+
 } // namespace doris
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime_filter/runtime_filter_wait_history.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "pipeline/thrift_builder.h"
+
+namespace doris {
+
+TEST(RuntimeFilterWaitHistoryTest, digest) {
+    auto desc = TRuntimeFilterDescBuilder().add_planId_to_target_expr(0).build();
+    auto probe_expr = desc.planId_to_target_expr[0];
+    uint64_t digest = RuntimeFilterWaitHistory::digest(desc, probe_expr);
+    EXPECT_EQ(digest, RuntimeFilterWaitHistory::digest(desc, probe_expr));
+
+    desc.__set_type(TRuntimeFilterType::MIN_MAX);
+    EXPECT_NE(digest, RuntimeFilterWaitHistory::digest(desc, probe_expr));
+}
+
+TEST(RuntimeFilterWaitHistoryTest, usual_latency) {
+    RuntimeFilterWaitHistory history;
+    const uint64_t digest = 1;
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+
+    for (int i = 0; i < RuntimeFilterWaitHistory::MIN_LATENCY_SAMPLES; ++i) {
+        EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+        history.record_ready(digest, 100, false);
+    }
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 200);
+    // never longer than the configured wait
+    EXPECT_EQ(history.wait_time_ms(digest, 150), 150);
+
+    // quick filters are still waited on for a while
+    for (int i = 0; i < 10; ++i) {
+        history.record_ready(digest, 0, false);
+    }
+    EXPECT_EQ(history.wait_time_ms(digest, 1000),
+              config::runtime_filter_adaptive_min_wait_time_ms);
+}
+
+TEST(RuntimeFilterWaitHistoryTest, useless_filters) {
+    RuntimeFilterWaitHistory history;
+    const uint64_t digest = 2;
+    const int64_t input_rows = config::runtime_filter_adaptive_min_input_rows;
+
+    // a filter not recorded as ready is ignored
+    history.record_selectivity(digest, input_rows, 0);
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+
+    history.record_ready(digest, 2000, true);
+    history.record_ready(digest, 2000, false);
+    history.record_selectivity(digest, input_rows, input_rows / 100);
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+    // too few rows to tell
+    history.record_selectivity(digest, input_rows - 1, 0);
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+    history.record_ready(digest, 2000, true);
+    EXPECT_EQ(history.wait_time_ms(digest, 0), 0);
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 0);
+
+    // a useful filter is waited on again
+    history.record_selectivity(digest, input_rows, input_rows / 2);
+    EXPECT_EQ(history.wait_time_ms(digest, 1000), 1000);
+}
+
+} // namespace doris
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/arrow/block_convertor.h"
+
+#include <arrow/memory_pool.h>
+#include <arrow/record_batch.h>
+#include <arrow/type.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "util/arrow/row_batch.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris {
+
+static vectorized::Block create_block() {
+    auto int_column = vectorized::ColumnInt32::create();
+    auto nullable_int_column = vectorized::ColumnNullable::create(
+            vectorized::ColumnInt64::create(), vectorized::ColumnUInt8::create());
+    auto string_column = vectorized::ColumnString::create();
+    auto double_column = vectorized::ColumnFloat64::create();
+    for (int i = 0; i < 100; ++i) {
+        int_column->insert_value(i);
+        if (i % 3 == 0) {
+            nullable_int_column->insert_default();
+        } else {
+            nullable_int_column->insert(vectorized::Field::create_field<TYPE_BIGINT>(i * 10L));
+        }
+        std::string str(i % 7, 'a' + i % 26);
+        string_column->insert_data(str.data(), str.size());
+        double_column->insert_value(i * 0.5);
+    }
+    vectorized::Block block;
+    block.insert({std::move(int_column), std::make_shared<vectorized::DataTypeInt32>(), "i"});
+    block.insert({std::move(nullable_int_column),
+                  vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt64>()), "n"});
+    block.insert({std::move(string_column), std::make_shared<vectorized::DataTypeString>(), "s"});
+    block.insert({std::move(double_column), std::make_shared<vectorized::DataTypeFloat64>(), "d"});
+    return block;
+}
+
+TEST(BlockConvertorTest, ZeroCopy) {
+    cctz::time_zone timezone_obj;
+    std::shared_ptr<arrow::RecordBatch> copied;
+    std::shared_ptr<arrow::RecordBatch> shared;
+    {
+        auto block = create_block();
+        std::shared_ptr<arrow::Schema> schema;
+        ASSERT_TRUE(get_arrow_schema_from_block(block, &schema, "UTC").ok());
+        ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &copied,
+                                           timezone_obj)
+                            .ok());
+        ASSERT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &shared,
+                                           timezone_obj, true, true)
+                            .ok());
+        const auto& int_data =
+                assert_cast<const vectorized::ColumnInt32&>(*block.get_by_position(0).column)
+                        .get_data();
+        EXPECT_EQ(reinterpret_cast<const uint8_t*>(int_data.data()),
+                  shared->column(0)->data()->buffers[1]->data());
+    }
+    // The shared arrays keep the columns alive after the block is destroyed.
+    ASSERT_TRUE(shared->ValidateFull().ok());
+    EXPECT_TRUE(shared->Equals(*copied));
+    EXPECT_EQ(copied->column(1)->null_count(), shared->column(1)->null_count());
+}
+
+} // namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/fsst_coding.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+class FsstCodingTest : public testing::Test {};
+
+TEST_F(FsstCodingTest, CompressAndDecompress) {
+    std::mt19937 rng(42);
+    std::vector<std::string> strings;
+    for (int i = 0; i < 2000; ++i) {
+        strings.push_back("https://doris.apache.org/docs/" + std::to_string(rng() % 10000) +
+                          "?lang=en&user_agent=Mozilla");
+    }
+    strings.emplace_back("");
+    const char binary[] = "\xff\x00\x01 not in the sample";
+    strings.emplace_back(binary, sizeof(binary) - 1);
+    std::vector<Slice> values(strings.begin(), strings.end());
+
+    FsstSymbolTable table;
+    table.build(values.data(), values.size());
+    EXPECT_GT(table.symbol_num(), 0);
+
+    faststring serialized;
+    table.serialize(&serialized);
+    FsstSymbolTable deserialized;
+    size_t table_size = 0;
+    ASSERT_TRUE(deserialized.deserialize(serialized.data(), serialized.size(), &table_size));
+    EXPECT_EQ(serialized.size(), table_size);
+
+    size_t raw_size = 0;
+    size_t compressed_size = 0;
+    std::vector<uint8_t> decompressed;
+    for (const Slice& value : values) {
+        faststring compressed;
+        table.compress(value, &compressed);
+        faststring compressed_again;
+        deserialized.compress(value, &compressed_again);
+        // equal strings are compressed to equal bytes
+        ASSERT_EQ(compressed.ToString(), compressed_again.ToString());
+
+        decompressed.resize(FsstSymbolTable::decompress_bound(compressed.size()));
+        size_t size = deserialized.decompress(compressed.data(), compressed.size(),
+                                              decompressed.data());
+        ASSERT_EQ(value.to_string(), std::string(reinterpret_cast<char*>(decompressed.data()), size));
+        raw_size += value.size;
+        compressed_size += compressed.size();
+    }
+    EXPECT_LT(compressed_size, raw_size / 2);
+}
+
+TEST_F(FsstCodingTest, BrokenSymbolTable) {
+    FsstSymbolTable table;
+    size_t size = 0;
+    EXPECT_FALSE(table.deserialize(nullptr, 0, &size));
+    // a symbol longer than 8 bytes
+    uint8_t too_long[] = {1, 9, 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i'};
+    EXPECT_FALSE(table.deserialize(too_long, sizeof(too_long), &size));
+    // the symbol bytes are truncated
+    uint8_t truncated[] = {2, 1, 2, 'a', 'b'};
+    EXPECT_FALSE(table.deserialize(truncated, sizeof(truncated), &size));
+}
+
+} // namespace doris
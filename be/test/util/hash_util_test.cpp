@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/hash_util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace doris {
+
+TEST(HashUtilTest, zlib_crc_hash_small) {
+    std::mt19937 rng(42);
+    std::vector<uint8_t> buf(64);
+    for (int i = 0; i < 10000; ++i) {
+        for (auto& byte : buf) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        auto bytes = static_cast<uint32_t>(rng() % buf.size());
+        uint32_t hash = rng();
+        EXPECT_EQ(HashUtil::zlib_crc_hash(buf.data(), bytes, hash),
+                  HashUtil::zlib_crc_hash_small(buf.data(), bytes, hash));
+    }
+    int64_t value = -1;
+    EXPECT_EQ(HashUtil::zlib_crc_hash(&value, sizeof(value), 0),
+              HashUtil::zlib_crc_hash_small(&value, sizeof(value), 0));
+}
+
+} // namespace doris
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/instrumented_mutex.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <shared_mutex>
+#include <thread>
+
+namespace doris {
+
+TEST(InstrumentedMutexTest, SameNameSharesStats) {
+    InstrumentedMutex a("instrumented_mutex_test_shared_name");
+    InstrumentedSharedMutex b("instrumented_mutex_test_shared_name");
+    EXPECT_EQ(a._stats, b._stats);
+    EXPECT_EQ(a._stats, LockContentionStats::get("instrumented_mutex_test_shared_name"));
+}
+
+TEST(InstrumentedMutexTest, RecordWaitAndHold) {
+    auto old_interval = config::lock_contention_hold_sample_interval;
+    config::lock_contention_hold_sample_interval = 1;
+    InstrumentedMutex mutex("instrumented_mutex_test_wait");
+    {
+        std::lock_guard lock(mutex);
+        EXPECT_FALSE(mutex.try_lock());
+    }
+    EXPECT_EQ(0, mutex._stats->_wait_us.count());
+    EXPECT_EQ(1, mutex._stats->_hold_us.count());
+
+    std::unique_lock lock(mutex);
+    std::thread waiter([&]() { std::lock_guard waiter_lock(mutex); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    lock.unlock();
+    waiter.join();
+    EXPECT_EQ(1, mutex._stats->_wait_us.count());
+    EXPECT_EQ(3, mutex._stats->_hold_us.count());
+    config::lock_contention_hold_sample_interval = old_interval;
+}
+
+TEST(InstrumentedMutexTest, SharedLock) {
+    InstrumentedSharedMutex mutex("instrumented_mutex_test_shared");
+    {
+        std::shared_lock reader1(mutex);
+        std::shared_lock reader2(mutex);
+        EXPECT_FALSE(mutex.try_lock());
+    }
+    std::unique_lock writer(mutex);
+    EXPECT_FALSE(mutex.try_lock_shared());
+    writer.unlock();
+    EXPECT_TRUE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+    EXPECT_EQ(0, mutex._stats->_wait_us.count());
+}
+
+} // namespace doris
@@ -101,4 +101,19 @@ TEST_F(KeyUtilTest, encode) {
     }
 }
 
+TEST_F(KeyUtilTest, key_range_is_not_in_segment) {
+    KeyBoundsPB key_bounds;
+    key_bounds.set_min_key("c");
+    key_bounds.set_max_key("f");
+    EXPECT_TRUE(key_range_is_not_in_segment("a", "b", key_bounds, false));
+    EXPECT_TRUE(key_range_is_not_in_segment("g", "h", key_bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("a", "c", key_bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("f", "h", key_bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("d", "e", key_bounds, false));
+    EXPECT_FALSE(key_range_is_not_in_segment("a", "h", key_bounds, false));
+    // the truncated max key "f" may be the prefix of the real max key
+    EXPECT_FALSE(key_range_is_not_in_segment("fa", "h", key_bounds, true));
+    EXPECT_TRUE(key_range_is_not_in_segment("fa", "h", key_bounds, false));
+}
+
 } // namespace doris
@@ -418,4 +418,41 @@ TEST_F(TestRle, TestSkip) {
     encoder.Flush();
 }
 
+TEST_F(TestRle, TestBatchDecoderSkipValues) {
+    const int bit_width = 5;
+    std::vector<uint32_t> values;
+    srand(42);
+    // Literal runs and repeated runs.
+    for (int i = 0; i < 100; ++i) {
+        int run_length = rand() % 2 == 0 ? 1 : rand() % 100;
+        uint32_t value = rand() % (1 << bit_width);
+        for (int j = 0; j < run_length; ++j) {
+            values.push_back(run_length == 1 ? rand() % (1 << bit_width) : value);
+        }
+    }
+    faststring buffer;
+    RleEncoder<uint32_t> encoder(&buffer, bit_width);
+    for (uint32_t value : values) {
+        encoder.Put(value);
+    }
+    int encoded_len = encoder.Flush();
+
+    RleBatchDecoder<uint32_t> decoder(buffer.data(), encoded_len, bit_width);
+    std::vector<uint32_t> decoded;
+    size_t pos = 0;
+    while (pos < values.size()) {
+        uint32_t num = std::min<uint32_t>(rand() % 70 + 1, values.size() - pos);
+        if (rand() % 2 == 0) {
+            EXPECT_EQ(num, decoder.SkipValues(num));
+        } else {
+            decoded.resize(num);
+            ASSERT_EQ(num, decoder.GetBatch(decoded.data(), num));
+            for (uint32_t i = 0; i < num; ++i) {
+                ASSERT_EQ(values[pos + i], decoded[i]) << "position " << pos + i;
+            }
+        }
+        pos += num;
+    }
+}
+
 } // namespace doris
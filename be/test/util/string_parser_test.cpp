@@ -23,6 +23,7 @@
 #include <boost/lexical_cast.hpp>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <string>
 
 #include "gtest/gtest_pred_impl.h"
@@ -299,6 +300,35 @@ TEST(StringToInt, Int8_Exhaustive) {
     }
 }
 
+TEST(StringToInt, PlainInt) {
+    // The plain integers are parsed to the same values as string_to_int.
+    for (const std::string str : {"0", "-0", "+7", "42", "-2147483648", "12345678",
+                                  "1234567890123456", "-9999999999999999", "0000000000000001"}) {
+        int64_t plain = 0;
+        EXPECT_TRUE(StringParser::try_parse_plain_int(str.data(), str.size(), &plain)) << str;
+        StringParser::ParseResult result;
+        EXPECT_EQ(StringParser::string_to_int<int64_t>(str.data(), str.size(), &result), plain);
+        EXPECT_EQ(result, StringParser::PARSE_SUCCESS);
+    }
+    // The other strings are left to string_to_int.
+    for (const std::string str : {"", "-", "+-1", " 1", "1 ", "1.5", "1e3", "12a", "9/", "0:",
+                                  "12345678901234567"}) {
+        int64_t plain = 0;
+        EXPECT_FALSE(StringParser::try_parse_plain_int(str.data(), str.size(), &plain)) << str;
+    }
+
+    char buffer[8];
+    for (int i = -300; i <= 300; ++i) {
+        snprintf(buffer, 8, "%d", i);
+        int8_t plain = 0;
+        bool parsed = StringParser::try_parse_plain_int(buffer, strlen(buffer), &plain);
+        EXPECT_EQ(parsed, i >= -128 && i <= 127) << buffer;
+        if (parsed) {
+            EXPECT_EQ(plain, i);
+        }
+    }
+}
+
 TEST(StringToIntWithBase, Basic) {
     test_int_value<int8_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
     test_int_value<int16_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <random>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "testutil/test_util.h"
@@ -177,6 +178,41 @@ TEST_F(TDigestTest, MergeTest) {
     digest2.add(std::vector<const TDigest*> {&digest1});
 }
 
+TEST_F(TDigestTest, SerializeAndMerge) {
+    TDigest digest(1000);
+    std::uniform_real_distribution<> reals(0.0, 1.0);
+    std::random_device gen;
+    for (int i = 0; i < 20000; ++i) {
+        digest.add(reals(gen));
+    }
+    // keep some centroids unprocessed
+    digest.compress();
+    for (int i = 0; i < 100; ++i) {
+        digest.add(reals(gen));
+    }
+
+    std::vector<uint8_t> buf(digest.serialized_size());
+    EXPECT_EQ(buf.size(), digest.serialize(buf.data()));
+    TDigest read_digest;
+    read_digest.unserialize(buf.data());
+    EXPECT_EQ(digest.processed().size(), read_digest.processed().size());
+    EXPECT_EQ(digest.unprocessed().size(), read_digest.unprocessed().size());
+    for (auto q : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        EXPECT_EQ(digest.quantileProcessed(q), read_digest.quantileProcessed(q));
+    }
+
+    TDigest merged(1000);
+    TDigest serialized_merged(1000);
+    for (int i = 0; i < 3; ++i) {
+        merged.merge(&read_digest);
+        serialized_merged.merge_serialized(buf.data());
+    }
+    EXPECT_EQ(merged.totalWeight(), serialized_merged.totalWeight());
+    for (auto q : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        EXPECT_EQ(merged.quantile(q), serialized_merged.quantile(q));
+    }
+}
+
 TEST_F(TDigestTest, TestSorted) {
     TDigest digest(1000);
     std::uniform_real_distribution<> reals(0.0, 1.0);
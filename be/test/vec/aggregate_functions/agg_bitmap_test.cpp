@@ -244,6 +244,50 @@ TEST(AggBitmapTest, bitmap_union_count_test) {
     agg_function->destroy(place);
 }
 
+TEST(AggBitmapTest, bitmap_union_merge_roaring_test) {
+    Arena arena;
+    auto data_type = std::make_shared<DataTypeBitMap>();
+    // Overlapping bitmaps [i * 10, i * 10 + 50), more than one batch of pending unions.
+    auto column_bitmap = data_type->create_column();
+    for (uint64_t i = 0; i < 100; i++) {
+        BitmapValue bitmap_value;
+        for (uint64_t v = i * 10; v < i * 10 + 50; v++) {
+            bitmap_value.add(v);
+        }
+        bitmap_value.add(1000000 + i);
+        assert_cast<ColumnBitmap&>(*column_bitmap).insert_value(bitmap_value);
+    }
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_bitmap(factory);
+    for (std::string function_name : {"bitmap_union", "bitmap_union_count"}) {
+        auto agg_function = factory.get(function_name, {data_type}, false, -1);
+        agg_function->set_version(3);
+        std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+        AggregateDataPtr place = memory.get();
+        agg_function->create(place);
+        agg_function->deserialize_and_merge_from_column(place, *column_bitmap, arena);
+
+        if (function_name == "bitmap_union") {
+            ColumnBitmap ans;
+            agg_function->insert_result_into(place, ans);
+            EXPECT_EQ(ans.get_element(0).cardinality(), 1040 + 100);
+            EXPECT_TRUE(ans.get_element(0).contains(1000099));
+        } else {
+            ColumnInt64 ans;
+            agg_function->insert_result_into(place, ans);
+            agg_function->insert_result_into(place, ans);
+            EXPECT_EQ(ans.get_element(0), 1040 + 100);
+            EXPECT_EQ(ans.get_element(1), 1040 + 100);
+        }
+        agg_function->destroy(place);
+    }
+    // the merged bitmaps are shared, not modified
+    for (size_t i = 0; i < 100; i++) {
+        EXPECT_EQ(assert_cast<ColumnBitmap&>(*column_bitmap).get_element(i).cardinality(), 51);
+    }
+}
+
 template <PrimitiveType T>
 void validate_bitmap_union_int_test() {
     Arena arena;
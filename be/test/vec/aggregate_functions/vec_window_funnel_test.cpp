@@ -22,10 +22,12 @@
 
 #include <memory>
 #include <ostream>
+#include <random>
 
 #include "gtest/gtest_pred_impl.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/aggregate_functions/aggregate_function_window_funnel.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/common/string_buffer.hpp"
@@ -430,4 +432,75 @@ TEST_F(VWindowFunnelTest, testMax4ReverseSortedMerge) {
     }
 }
 
+TEST_F(VWindowFunnelTest, testStreamingMatchesScan) {
+    using State = WindowFunnelState<TYPE_DATETIMEV2, UInt64>;
+    const int num_events = 4;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> step(0, 3);
+    std::uniform_int_distribution<int> has_event(0, 3);
+    for (int round = 0; round < 200; round++) {
+        State state(num_events);
+        state.window = round % 10;
+        uint16_t second = 0;
+        for (int row = 0; row < 40; row++) {
+            second += step(gen);
+            DateV2Value<DateTimeV2ValueType> time_value;
+            time_value.unchecked_set_time(2022, 2, 28, 0, second / 60, second % 60);
+            state.events_list.dt.push_back(
+                    binary_cast<DateV2Value<DateTimeV2ValueType>, UInt64>(time_value));
+            for (int i = 0; i < num_events; i++) {
+                state.events_list.event_columns_data[i].push_back(has_event(gen) == 0);
+            }
+        }
+        EXPECT_EQ(state._get_internal<WindowFunnelMode::DEFAULT>(),
+                  state._get_streaming<WindowFunnelMode::DEFAULT>());
+        EXPECT_EQ(state._get_internal<WindowFunnelMode::DEDUPLICATION>(),
+                  state._get_streaming<WindowFunnelMode::DEDUPLICATION>());
+        EXPECT_EQ(state._get_internal<WindowFunnelMode::FIXED>(),
+                  state._get_streaming<WindowFunnelMode::FIXED>());
+    }
+}
+
+TEST_F(VWindowFunnelTest, testSkipRowsWithoutEvents) {
+    auto column_mode = ColumnString::create();
+    auto column_timestamp = ColumnDateTime::create();
+    auto column_window = ColumnInt64::create();
+    MutableColumnPtr column_events[4];
+    for (auto& column_event : column_events) {
+        column_event = ColumnUInt8::create();
+    }
+    // the rows without events between the funnel steps, in the reverse time order
+    for (int i = 7; i >= 0; i--) {
+        column_mode->insert(vectorized::Field::create_field<TYPE_STRING>("default"));
+        VecDateTimeValue time_value;
+        time_value.unchecked_set_time(2022, 2, 28, 0, 0, i);
+        column_timestamp->insert_data((char*)&time_value, 0);
+        column_window->insert(vectorized::Field::create_field<TYPE_BIGINT>(10));
+        for (int event = 0; event < 4; event++) {
+            column_events[event]->insert(
+                    vectorized::Field::create_field<TYPE_BOOLEAN>(i == event * 2));
+        }
+    }
+
+    std::unique_ptr<char[]> memory(new char[agg_function->size_of_data()]);
+    AggregateDataPtr place = memory.get();
+    agg_function->create(place);
+    const IColumn* column[7] = {column_window.get(),    column_mode.get(),
+                                column_timestamp.get(), column_events[0].get(),
+                                column_events[1].get(), column_events[2].get(),
+                                column_events[3].get()};
+    for (int i = 0; i < 8; i++) {
+        agg_function->add(place, column, i, arena);
+    }
+    const auto& state = *reinterpret_cast<WindowFunnelState<TYPE_DATETIME, Int64>*>(place);
+    EXPECT_EQ(state.events_list.size(), 4);
+    EXPECT_FALSE(state.events_sorted);
+
+    ColumnInt32 column_result;
+    agg_function->insert_result_into(place, column_result);
+    EXPECT_EQ(column_result.get_data()[0], 4);
+    EXPECT_TRUE(state.events_sorted);
+    agg_function->destroy(place);
+}
+
 } // namespace doris::vectorized
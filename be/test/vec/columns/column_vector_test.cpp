@@ -22,7 +22,9 @@
 #include <cstdint>
 
 #include "vec/columns/column.h"
+#include "vec/columns/column_vector.h"
 #include "vec/columns/common_column_test.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_factory.hpp"
@@ -526,4 +528,45 @@ TEST_F(ColumnVectorTest, ScalaTypeInt32Test2erase) {
     }
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+// The filtered values of masks of all densities, in the blocks of the SIMD masks and the tail.
+template <PrimitiveType T>
+static void check_filter_densities() {
+    using ColumnType = ColumnVector<T>;
+    using ValueType = typename ColumnType::value_type;
+    const size_t rows = 1000;
+    auto column = ColumnType::create();
+    for (size_t i = 0; i < rows; ++i) {
+        column->insert_value(static_cast<ValueType>(i * 7 + 3));
+    }
+    for (size_t density : {0, 1, 3, 16, 29, 32}) {
+        IColumn::Filter filter(rows);
+        std::vector<ValueType> expected;
+        for (size_t i = 0; i < rows; ++i) {
+            filter[i] = (i * 13 + i / 32) % 32 < density;
+            if (filter[i]) {
+                expected.push_back(column->get_data()[i]);
+            }
+        }
+        auto filtered = column->filter(filter, -1);
+        const auto& filtered_data = assert_cast<const ColumnType&>(*filtered).get_data();
+        ASSERT_EQ(filtered_data.size(), expected.size()) << density;
+        auto in_place = column->clone();
+        ASSERT_EQ(in_place->filter(filter), expected.size()) << density;
+        const auto& in_place_data = assert_cast<const ColumnType&>(*in_place).get_data();
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(filtered_data[i], expected[i]) << density << " " << i;
+            EXPECT_EQ(in_place_data[i], expected[i]) << density << " " << i;
+        }
+    }
+}
+
+TEST(ColumnVectorFilterTest, filter_densities) {
+    check_filter_densities<TYPE_BOOLEAN>();
+    check_filter_densities<TYPE_SMALLINT>();
+    check_filter_densities<TYPE_INT>();
+    check_filter_densities<TYPE_FLOAT>();
+    check_filter_densities<TYPE_BIGINT>();
+    check_filter_densities<TYPE_LARGEINT>();
+}
+
+} // namespace doris::vectorized
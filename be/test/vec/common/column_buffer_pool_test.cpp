@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/column_buffer_pool.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "vec/common/allocator.h"
+#include "vec/common/allocator_fwd.h"
+#include "vec/common/pod_array.h"
+
+namespace doris::vectorized {
+
+class ColumnBufferPoolTest : public testing::Test {
+protected:
+    void SetUp() override {
+        _pool_bytes = config::column_buffer_pool_bytes_per_task;
+        config::column_buffer_pool_bytes_per_task = 16 * ColumnBufferPool::MIN_BUFFER_SIZE;
+    }
+
+    void TearDown() override { config::column_buffer_pool_bytes_per_task = _pool_bytes; }
+
+    Allocator<false, false, false, DefaultMemoryAllocator, true> _allocator;
+    int64_t _pool_bytes = 0;
+};
+
+TEST_F(ColumnBufferPoolTest, ReuseFreedBuffer) {
+    const size_t size = 2 * ColumnBufferPool::MIN_BUFFER_SIZE;
+    ColumnBufferPool::Scope scope;
+    void* buf = _allocator.alloc(size);
+    _allocator.free(buf, size);
+    EXPECT_EQ(_allocator.alloc(size), buf);
+    // Only the buffer of exactly the same size is reused.
+    void* other_buf = _allocator.alloc(size + 1);
+    EXPECT_NE(other_buf, buf);
+    _allocator.free(other_buf, size + 1);
+    _allocator.free(buf, size);
+}
+
+TEST_F(ColumnBufferPoolTest, ReuseBufferOfPODArray) {
+    ColumnBufferPool::Scope scope;
+    const UInt8* data = nullptr;
+    {
+        PaddedPODArray<UInt8> column;
+        column.resize(3 * ColumnBufferPool::MIN_BUFFER_SIZE);
+        data = column.data();
+    }
+    PaddedPODArray<UInt8> column;
+    column.resize(3 * ColumnBufferPool::MIN_BUFFER_SIZE);
+    EXPECT_EQ(column.data(), data);
+}
+
+TEST_F(ColumnBufferPoolTest, SmallBufferIsNotPooled) {
+    ColumnBufferPool::Scope scope;
+    void* buf = _allocator.alloc(ColumnBufferPool::MIN_BUFFER_SIZE / 2);
+    EXPECT_FALSE(ColumnBufferPool::try_put(buf, ColumnBufferPool::MIN_BUFFER_SIZE / 2));
+    _allocator.free(buf, ColumnBufferPool::MIN_BUFFER_SIZE / 2);
+    EXPECT_EQ(ColumnBufferPool::try_get(ColumnBufferPool::MIN_BUFFER_SIZE / 2), nullptr);
+}
+
+TEST_F(ColumnBufferPoolTest, PoolIsBoundedByCapacity) {
+    const auto capacity = static_cast<size_t>(config::column_buffer_pool_bytes_per_task);
+    ColumnBufferPool::Scope scope;
+    void* buf = _allocator.alloc(capacity);
+    void* other_buf = _allocator.alloc(capacity);
+    _allocator.free(buf, capacity);
+    // The pool is full, the buffer is freed.
+    _allocator.free(other_buf, capacity);
+    EXPECT_EQ(ColumnBufferPool::try_get(capacity), buf);
+    EXPECT_EQ(ColumnBufferPool::try_get(capacity), nullptr);
+    _allocator.free(buf, capacity);
+}
+
+TEST_F(ColumnBufferPoolTest, NothingIsPooledOutOfScope) {
+    const size_t size = 2 * ColumnBufferPool::MIN_BUFFER_SIZE;
+    {
+        ColumnBufferPool::Scope scope;
+        _allocator.free(_allocator.alloc(size), size);
+    }
+    void* buf = _allocator.alloc(size);
+    EXPECT_FALSE(ColumnBufferPool::try_put(buf, size));
+    _allocator.free(buf, size);
+
+    config::column_buffer_pool_bytes_per_task = 0;
+    ColumnBufferPool::Scope scope;
+    EXPECT_FALSE(ColumnBufferPool::try_put(buf, size));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "util/defer_op.h"
+
+namespace doris {
+
+class JoinHashTableTest : public testing::Test {
+protected:
+    using HashTable = JoinHashTable<int64_t>;
+
+    void build(HashTable& hash_table, const std::vector<int64_t>& keys) {
+        auto num_elem = static_cast<uint32_t>(keys.size());
+        hash_table.prepare_build<TJoinOp::INNER_JOIN>(num_elem, 4096, false);
+        bucket_nums.resize(num_elem);
+        for (uint32_t i = 0; i < num_elem; i++) {
+            bucket_nums[i] = hash_table.hash(keys[i]) & (hash_table.get_bucket_size() - 1);
+        }
+        hash_table.build(keys.data(), bucket_nums.data(), num_elem, false);
+    }
+
+    std::vector<uint32_t> bucket_nums;
+};
+
+TEST_F(JoinHashTableTest, CachePartitionedBuild) {
+    std::vector<int64_t> keys(100000);
+    for (size_t i = 0; i < keys.size(); i++) {
+        // Every key appears twice to have chains longer than one.
+        keys[i] = static_cast<int64_t>(i / 2);
+    }
+
+    HashTable plain_table;
+    build(plain_table, keys);
+    EXPECT_EQ(plain_table.num_cache_partitions(), 0);
+
+    auto old_cache_bytes = config::hash_join_cache_partition_bytes;
+    Defer reset_config([&]() { config::hash_join_cache_partition_bytes = old_cache_bytes; });
+    config::hash_join_cache_partition_bytes = 4096;
+    HashTable partitioned_table;
+    build(partitioned_table, keys);
+    EXPECT_GT(partitioned_table.num_cache_partitions(), 1);
+
+    // The partitioned build makes the same bucket chains.
+    EXPECT_EQ(plain_table.first, partitioned_table.first);
+    EXPECT_EQ(plain_table.next, partitioned_table.next);
+
+    DorisVector<uint32_t> probe_buckets(bucket_nums.begin(), bucket_nums.end());
+    DorisVector<uint32_t> probe_idxs(probe_buckets);
+    plain_table.pre_build_idxs(probe_buckets);
+    partitioned_table.pre_build_idxs(probe_idxs);
+    EXPECT_EQ(probe_buckets, probe_idxs);
+}
+
+TEST_F(JoinHashTableTest, HashTags) {
+    using StringHashTable = JoinHashTable<StringRef>;
+    static_assert(StringHashTable::has_hash_tags);
+    static_assert(!HashTable::has_hash_tags);
+
+    // The first row is not from the build side.
+    std::vector<std::string> build_values {"", "apple", "banana", "cherry", "apple"};
+    std::vector<StringRef> build_keys;
+    for (const auto& value : build_values) {
+        build_keys.emplace_back(value);
+    }
+    auto num_elem = static_cast<uint32_t>(build_keys.size());
+    StringHashTable hash_table;
+    hash_table.prepare_build<TJoinOp::INNER_JOIN>(num_elem, 4096, false);
+    // All rows share one bucket, only the tags and the keys tell the rows apart.
+    std::vector<uint32_t> build_buckets(num_elem, 0);
+    std::vector<uint8_t> build_tags;
+    for (const auto& key : build_keys) {
+        build_tags.push_back(StringHashTable::hash_tag(hash_table.hash(key)));
+    }
+    hash_table.build(build_keys.data(), build_buckets.data(), num_elem, false, build_tags.data());
+
+    std::vector<std::string> probe_values {"apple", "durian", "cherry"};
+    std::vector<StringRef> probe_keys;
+    std::vector<uint8_t> probe_tags;
+    for (const auto& value : probe_values) {
+        probe_keys.emplace_back(value);
+        probe_tags.push_back(StringHashTable::hash_tag(hash_table.hash(probe_keys.back())));
+    }
+    DorisVector<uint32_t> probe_buckets(probe_keys.size(), 0);
+    hash_table.pre_build_idxs(probe_buckets);
+
+    std::vector<uint32_t> probe_idxs(16);
+    std::vector<uint32_t> build_idxs(16);
+    bool probe_visited = false;
+    auto [probe_idx, build_idx, matched_cnt] = hash_table.find_batch<TJoinOp::INNER_JOIN>(
+            probe_keys.data(), probe_tags.data(), probe_buckets.data(), 0, 0,
+            static_cast<int>(probe_keys.size()), probe_idxs.data(), probe_visited,
+            build_idxs.data(), nullptr, false, false, false);
+    EXPECT_EQ(probe_idx, 3);
+    EXPECT_EQ(build_idx, 0U);
+    ASSERT_EQ(matched_cnt, 3U);
+    // The rows of the bucket chain are in reverse order of insertion.
+    EXPECT_EQ(probe_idxs[0], 0);
+    EXPECT_EQ(build_idxs[0], 4);
+    EXPECT_EQ(probe_idxs[1], 0);
+    EXPECT_EQ(build_idxs[1], 1);
+    EXPECT_EQ(probe_idxs[2], 2);
+    EXPECT_EQ(build_idxs[2], 3);
+}
+
+} // namespace doris
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/radix_sort.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "vec/columns/column_vector.h"
+#include "vec/core/types.h"
+
+namespace doris::vectorized {
+
+template <typename T>
+void check_radix_sort_permutation(const std::vector<T>& keys, bool reverse) {
+    IColumn::Permutation res;
+    radix_sort_permutation(keys.data(), keys.size(), reverse, res);
+
+    std::vector<size_t> expected(keys.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::stable_sort(expected.begin(), expected.end(), [&](size_t a, size_t b) {
+        return reverse ? keys[a] > keys[b] : keys[a] < keys[b];
+    });
+    ASSERT_EQ(res.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(res[i], expected[i]) << i;
+    }
+}
+
+TEST(RadixSortTest, SortPermutation) {
+    std::mt19937_64 rng(42);
+    std::vector<Int32> int32_keys(1000);
+    for (auto& key : int32_keys) {
+        key = static_cast<Int32>(rng());
+    }
+    // Equal keys must keep the order of their rows.
+    std::vector<Int64> int64_keys(1000);
+    for (auto& key : int64_keys) {
+        key = static_cast<Int64>(rng() % 50) - 25;
+    }
+    std::vector<UInt8> uint8_keys(1000);
+    for (auto& key : uint8_keys) {
+        key = static_cast<UInt8>(rng());
+    }
+    for (bool reverse : {false, true}) {
+        check_radix_sort_permutation(int32_keys, reverse);
+        check_radix_sort_permutation(int64_keys, reverse);
+        check_radix_sort_permutation(uint8_keys, reverse);
+        check_radix_sort_permutation(std::vector<Int16> {3, -1, 0, -32768, 32767, -1}, reverse);
+        check_radix_sort_permutation(std::vector<UInt64> {}, reverse);
+    }
+}
+
+TEST(RadixSortTest, ColumnVectorGetPermutation) {
+    auto column = ColumnInt64::create();
+    for (Int64 i = 0; i < 1000; ++i) {
+        column->insert_value((i * 7919) % 1000 - 500);
+    }
+    for (bool reverse : {false, true}) {
+        IColumn::Permutation perm;
+        column->get_permutation(reverse, 0, 1, perm);
+        ASSERT_EQ(perm.size(), column->size());
+        for (size_t i = 1; i < perm.size(); ++i) {
+            const auto prev = column->get_element(perm[i - 1]);
+            const auto curr = column->get_element(perm[i]);
+            EXPECT_TRUE(reverse ? prev >= curr : prev <= curr) << i;
+        }
+    }
+}
+
+} // namespace doris::vectorized
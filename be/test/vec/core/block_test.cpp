@@ -17,6 +17,7 @@
 
 #include "vec/core/block.h"
 
+#include <butil/iobuf.h>
 #include <concurrentqueue.h>
 #include <gen_cpp/Descriptors_types.h>
 #include <gen_cpp/Metrics_types.h>
@@ -36,11 +37,14 @@
 #include "common/config.h"
 #include "common/object_pool.h"
 #include "gen_cpp/data.pb.h"
+#include "gen_cpp/internal_service.pb.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptor_helper.h"
 #include "runtime/descriptors.h"
 #include "testutil/column_helper.h"
 #include "util/bitmap_value.h"
+#include "util/proto_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_complex.h"
@@ -716,6 +720,107 @@ TEST(BlockTest, SerializeAndDeserializeBlock) {
     serialize_and_deserialize_test_one();
 }
 
+TEST(BlockTest, DeserializeFromAttachment) {
+    auto vec = vectorized::ColumnInt32::create();
+    auto& data = vec->get_data();
+    for (int i = 0; i < 8192; ++i) {
+        data.push_back(i);
+    }
+    vectorized::DataTypePtr data_type(std::make_shared<vectorized::DataTypeInt32>());
+    vectorized::ColumnWithTypeAndName type_and_name(vec->get_ptr(), data_type, "test_int");
+    vectorized::Block block({type_and_name});
+
+    for (auto compression_type : {segment_v2::CompressionTypePB::NO_COMPRESSION,
+                                  segment_v2::CompressionTypePB::LZ4}) {
+        PTransmitDataParams request;
+        block_to_pb(block, request.add_blocks(), compression_type);
+        block_to_pb(block, request.mutable_block(), compression_type);
+        butil::IOBuf attachment;
+        ASSERT_TRUE(request_embed_column_values_in_attachment(&request, &attachment).ok());
+        EXPECT_TRUE(request.blocks(0).column_values().empty());
+        EXPECT_TRUE(request.block().column_values().empty());
+
+        // The attachment references the column values directly, and data received from the
+        // socket is spread over many small buffers, both must be deserialized.
+        butil::IOBuf received;
+        received.append(attachment.to_string());
+        for (auto* buf : {&attachment, &received}) {
+            std::vector<butil::IOBuf> column_values;
+            ASSERT_TRUE(attachment_extract_column_values(request, buf, &column_values).ok());
+            ASSERT_EQ(column_values.size(), 2);
+            EXPECT_TRUE(buf->empty());
+
+            vectorized::Block block2;
+            ASSERT_TRUE(block2.deserialize(request.blocks(0), column_values[0]).ok());
+            EXPECT_EQ(block.dump_data(), block2.dump_data());
+            vectorized::Block block3;
+            ASSERT_TRUE(block3.deserialize(request.block(), column_values[1]).ok());
+            EXPECT_EQ(block.dump_data(), block3.dump_data());
+        }
+
+        std::vector<butil::IOBuf> column_values;
+        EXPECT_FALSE(attachment_extract_column_values(request, &received, &column_values).ok());
+    }
+}
+
+TEST(BlockTest, SerializeColumnFrames) {
+    // Each int column is larger than a frame, the string columns share one.
+    vectorized::Block block;
+    for (int col = 0; col < 4; ++col) {
+        auto ints = vectorized::ColumnInt32::create();
+        auto strings = vectorized::ColumnString::create();
+        for (int i = 0; i < 100000; ++i) {
+            ints->insert_value(i * (col + 1));
+            std::string str = std::to_string(i % 100);
+            strings->insert_data(str.data(), str.size());
+        }
+        block.insert({std::move(ints), std::make_shared<vectorized::DataTypeInt32>(),
+                      "int_" + std::to_string(col)});
+        block.insert({std::move(strings), std::make_shared<vectorized::DataTypeString>(),
+                      "string_" + std::to_string(col)});
+    }
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_TRUE(ThreadPoolBuilder("BlockTest").set_max_threads(3).build(&pool).ok());
+    for (int be_exec_version : {USE_CONST_SERDE, COLUMN_COMPRESSION_FRAMES}) {
+        for (auto* compression_pool : {static_cast<ThreadPool*>(nullptr), pool.get()}) {
+            PBlock pblock;
+            size_t uncompressed_bytes = 0;
+            size_t compressed_bytes = 0;
+            ASSERT_TRUE(block.serialize(be_exec_version, &pblock, &uncompressed_bytes,
+                                        &compressed_bytes, segment_v2::CompressionTypePB::LZ4,
+                                        false, compression_pool)
+                                .ok());
+            EXPECT_TRUE(pblock.compressed());
+            EXPECT_EQ(compressed_bytes, pblock.column_values().size());
+            EXPECT_LT(compressed_bytes, uncompressed_bytes);
+
+            vectorized::Block block2;
+            ASSERT_TRUE(block2.deserialize(pblock).ok());
+            EXPECT_EQ(block.dump_data(0, 100), block2.dump_data(0, 100));
+            for (size_t i = 0; i < block.columns(); ++i) {
+                EXPECT_EQ(block.get_by_position(i).name, block2.get_by_position(i).name);
+                for (size_t row = 0; row < block.rows(); row += 997) {
+                    EXPECT_EQ(block.get_by_position(i).column->compare_at(
+                                      row, row, *block2.get_by_position(i).column, 1),
+                              0);
+                }
+            }
+        }
+    }
+
+    // The truncated frames are rejected instead of being read out of bounds.
+    PBlock pblock;
+    size_t uncompressed_bytes = 0;
+    size_t compressed_bytes = 0;
+    ASSERT_TRUE(block.serialize(COLUMN_COMPRESSION_FRAMES, &pblock, &uncompressed_bytes,
+                                &compressed_bytes, segment_v2::CompressionTypePB::LZ4)
+                        .ok());
+    pblock.mutable_column_values()->resize(pblock.column_values().size() / 2);
+    vectorized::Block block2;
+    EXPECT_FALSE(block2.deserialize(pblock).ok());
+}
+
 TEST(BlockTest, dump_data) {
     auto vec = vectorized::ColumnInt32::create();
     auto& int32_data = vec->get_data();
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// The strings equal in their prefixes, shorter or longer than the prefixes, and with zero bytes.
+static const std::vector<std::string> STRINGS = {
+        "",         std::string(1, '\0'), "a",         std::string("a\0", 2),
+        "ab",       "abcdefgh",           "abcdefg",   std::string("abcdefgh\0", 9),
+        "abcdefgi", "abcdefghij",         "abcdefghi", "b",
+        "\xff",     "abcdefghij",         "zzzzzzzzzzzzzzzzzzzz"};
+
+static ColumnString::MutablePtr create_column() {
+    auto column = ColumnString::create();
+    for (const auto& str : STRINGS) {
+        column->insert_data(str.data(), str.size());
+    }
+    return column;
+}
+
+TEST(SortBlockTest, PrefixedStringRefCompareLikeColumn) {
+    auto column = create_column();
+    for (size_t lhs = 0; lhs < STRINGS.size(); ++lhs) {
+        for (size_t rhs = 0; rhs < STRINGS.size(); ++rhs) {
+            const int expected = column->compare_at(lhs, rhs, *column, 1);
+            const int actual = PrefixedStringRef(column->get_data_at(lhs))
+                                       .compare(PrefixedStringRef(column->get_data_at(rhs)));
+            EXPECT_EQ(expected > 0, actual > 0) << lhs << " " << rhs;
+            EXPECT_EQ(expected < 0, actual < 0) << lhs << " " << rhs;
+        }
+    }
+}
+
+TEST(SortBlockTest, SortStringColumn) {
+    for (int direction : {1, -1}) {
+        // The strings are sorted by the column sorter only when there are several sort columns.
+        auto int_column = ColumnInt32::create();
+        for (size_t i = 0; i < STRINGS.size(); ++i) {
+            int_column->insert_value(static_cast<Int32>(i));
+        }
+        Block block;
+        block.insert({create_column(), std::make_shared<DataTypeString>(), "s"});
+        block.insert({std::move(int_column), std::make_shared<DataTypeInt32>(), "i"});
+        Block sorted = block.clone_empty();
+        sort_block(block, sorted,
+                   {SortColumnDescription(0, direction, 1), SortColumnDescription(1, 1, 1)});
+
+        const auto& column = *sorted.get_by_position(0).column;
+        ASSERT_EQ(column.size(), STRINGS.size());
+        for (size_t i = 1; i < column.size(); ++i) {
+            EXPECT_LE(direction * column.compare_at(i - 1, i, column, 1), 0) << i;
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_normalized_keys.h"
+
+#include <gtest/gtest.h>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+
+namespace doris::vectorized {
+
+class NormalizedSortKeysTest : public testing::Test {
+protected:
+    void SetUp() override {
+        auto nullable_column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+        auto int64_column = ColumnInt64::create();
+        const std::vector<Int32> int32_vals {3, -1, 0, 3, -2147483648, 2147483647, 7, -1};
+        const std::vector<Int64> int64_vals {5, 5, -9, 2, 0, 1, 8, -3};
+        for (size_t i = 0; i < int32_vals.size(); ++i) {
+            if (i % 3 == 2) {
+                nullable_column->insert_default();
+            } else {
+                nullable_column->insert_data(reinterpret_cast<const char*>(&int32_vals[i]),
+                                             sizeof(Int32));
+            }
+            int64_column->insert_value(int64_vals[i]);
+        }
+        _nullable_column = std::move(nullable_column);
+        _int64_column = std::move(int64_column);
+    }
+
+    // The sign of the normalized comparison must be the same as the column by column one.
+    void check_order(const SortDescription& description) {
+        ColumnRawPtrs sort_columns {_nullable_column.get(), _int64_column.get()};
+        NormalizedSortKeys keys;
+        ASSERT_TRUE(keys.encode(sort_columns, description));
+        EXPECT_EQ(keys.key_width(), 1 + sizeof(Int32) + 1 + sizeof(Int64));
+
+        const size_t rows = _int64_column->size();
+        for (size_t lhs = 0; lhs < rows; ++lhs) {
+            for (size_t rhs = 0; rhs < rows; ++rhs) {
+                int expected = 0;
+                for (size_t i = 0; i < sort_columns.size() && expected == 0; ++i) {
+                    expected = description[i].direction *
+                               sort_columns[i]->compare_at(lhs, rhs, *sort_columns[i],
+                                                           description[i].nulls_direction);
+                }
+                const int actual = keys.compare_at(lhs, rhs, keys);
+                EXPECT_EQ(expected > 0, actual > 0) << lhs << " " << rhs;
+                EXPECT_EQ(expected < 0, actual < 0) << lhs << " " << rhs;
+            }
+        }
+    }
+
+    ColumnPtr _nullable_column;
+    ColumnPtr _int64_column;
+};
+
+TEST_F(NormalizedSortKeysTest, CompareLikeColumns) {
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            SortDescription description {{0, direction, nulls_direction},
+                                         {1, -direction, nulls_direction}};
+            check_order(description);
+        }
+    }
+}
+
+TEST_F(NormalizedSortKeysTest, SortPermutation) {
+    SortDescription description {{0, 1, 1}, {1, -1, 1}};
+    ColumnRawPtrs sort_columns {_nullable_column.get(), _int64_column.get()};
+    NormalizedSortKeys keys;
+    ASSERT_TRUE(keys.encode(sort_columns, description));
+
+    IColumn::Permutation perm(_int64_column->size());
+    for (size_t i = 0; i < perm.size(); ++i) {
+        perm[i] = i;
+    }
+    keys.sort_permutation(perm, 0);
+    for (size_t i = 1; i < perm.size(); ++i) {
+        EXPECT_LE(keys.compare_at(perm[i - 1], perm[i], keys), 0);
+    }
+}
+
+TEST_F(NormalizedSortKeysTest, StringColumnIsNotEncoded) {
+    auto string_column = ColumnString::create();
+    string_column->insert_data("a", 1);
+    auto int64_column = ColumnInt64::create();
+    int64_column->insert_value(1);
+    ColumnRawPtrs sort_columns {int64_column.get(), string_column.get()};
+
+    NormalizedSortKeys keys;
+    EXPECT_FALSE(keys.encode(sort_columns, SortDescription {{0, 1, 1}, {1, 1, 1}}));
+    EXPECT_TRUE(keys.empty());
+}
+
+} // namespace doris::vectorized
@@ -33,6 +33,7 @@
 #include "runtime/define_primitive_type.h"
 #include "testutil/test_util.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
 #include "vec/common/assert_cast.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
@@ -262,6 +263,49 @@ TEST_F(DataTypeStringTest, ser_deser) {
     test_func(dt_str, *column_str32, USE_CONST_SERDE);
     test_func(dt_str, *column_str32, AGGREGATION_2_1_VERSION);
 }
+
+TEST_F(DataTypeStringTest, ser_deser_dictionary) {
+    auto ser_deser = [](const IColumn& column, int be_exec_version, size_t* serialized_bytes) {
+        std::string column_values;
+        column_values.resize(dt_str.get_uncompressed_serialized_bytes(column, be_exec_version));
+        char* buf = dt_str.serialize(column, column_values.data(), be_exec_version);
+        *serialized_bytes = buf - column_values.data();
+        EXPECT_LE(*serialized_bytes, column_values.size());
+        column_values.resize(*serialized_bytes + STREAMVBYTE_PADDING);
+
+        MutableColumnPtr deser_column = dt_str.create_column();
+        const char* end = dt_str.deserialize(column_values.data(), &deser_column, be_exec_version);
+        EXPECT_EQ(end - column_values.data(), *serialized_bytes);
+        EXPECT_EQ(deser_column->size(), column.size());
+        for (size_t i = 0; i != column.size(); ++i) {
+            EXPECT_EQ(deser_column->get_data_at(i), column.get_data_at(i));
+        }
+    };
+
+    // uint8 and uint16 codes, and too many values for the dictionary
+    for (size_t num_values : {3, 1000, 2000}) {
+        auto column = ColumnString::create();
+        for (size_t i = 0; i != 4096; ++i) {
+            auto value = "value_" + std::to_string(i * 7 % num_values);
+            column->insert_data(value.data(), value.size());
+        }
+        size_t dictionary_bytes = 0;
+        size_t plain_bytes = 0;
+        ser_deser(*column, STRING_DICTIONARY_SERDE, &dictionary_bytes);
+        ser_deser(*column, USE_CONST_SERDE, &plain_bytes);
+        if (num_values * 4 <= column->size()) {
+            EXPECT_LT(dictionary_bytes, plain_bytes);
+        } else {
+            EXPECT_EQ(dictionary_bytes, plain_bytes + 1);
+        }
+    }
+
+    // few rows and const columns stay plain
+    size_t bytes = 0;
+    ser_deser(*column_str32, STRING_DICTIONARY_SERDE, &bytes);
+    auto const_column = ColumnConst::create(column_str32->clone_resized(1), 1000);
+    ser_deser(*const_column, STRING_DICTIONARY_SERDE, &bytes);
+}
 TEST_F(DataTypeStringTest, simple_func_test) {
     auto test_func = [](auto& dt) {
         EXPECT_FALSE(dt.have_subtypes());
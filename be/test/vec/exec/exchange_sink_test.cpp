@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "pipeline/exec/exchange_sink_buffer.h"
+#include "util/proto_util.h"
 
 namespace doris::vectorized {
 using namespace pipeline;
@@ -235,4 +236,71 @@ TEST_F(ExchangeSInkTest, test_queue_size) {
     }
 }
 
+TEST_F(ExchangeSInkTest, test_broadcast_followers) {
+    {
+        auto state = create_runtime_state();
+        auto buffer = create_buffer(state);
+        buffer->set_broadcast_followers(dest_ins_id_1,
+                                        {dest_fragment_ins_id_2, dest_fragment_ins_id_3});
+
+        auto sink1 = create_sink(state, buffer);
+        auto sink2 = create_sink(state, buffer);
+        auto sink3 = create_sink(state, buffer);
+        for (auto* sink : {&sink1, &sink2, &sink3}) {
+            EXPECT_EQ(sink->add_block(dest_ins_id_1, true), Status::OK());
+            EXPECT_EQ(sink->add_block(dest_ins_id_2, true), Status::OK());
+            EXPECT_EQ(sink->add_block(dest_ins_id_3, true), Status::OK());
+        }
+
+        // Nothing is sent to the followers, the requests to the leader list them.
+        EXPECT_TRUE(done_map[dest_ins_id_2].empty());
+        EXPECT_TRUE(done_map[dest_ins_id_3].empty());
+        ASSERT_FALSE(done_map[dest_ins_id_1].empty());
+        {
+            butil::IOBuf attachment = done_map[dest_ins_id_1].front()->cntl_->request_attachment();
+            std::vector<TUniqueId> fanout_instances;
+            EXPECT_TRUE(attachment_extract_fanout_instances(&attachment, &fanout_instances).ok());
+            ASSERT_EQ(fanout_instances.size(), 2);
+            EXPECT_EQ(fanout_instances[0], dest_fragment_ins_id_2);
+            EXPECT_EQ(fanout_instances[1], dest_fragment_ins_id_3);
+            EXPECT_TRUE(attachment.empty());
+        }
+
+        pop_block(dest_ins_id_1, PopState::accept);
+        pop_block(dest_ins_id_1, PopState::accept);
+        pop_block(dest_ins_id_1, PopState::accept);
+
+        // The eos of the leader ends the followers as well.
+        for (const auto& [id, instance] : buffer->_rpc_instances) {
+            EXPECT_EQ(instance->running_sink_count, 0) << "id : " << id;
+            EXPECT_EQ(instance->rpc_channel_is_turn_off, true) << "id : " << id;
+        }
+        clear_all_done();
+    }
+}
+
+TEST(ExchangeSinkBufferTest, choose_compression_type) {
+    using segment_v2::CompressionTypePB;
+    constexpr int64_t MB = 1024 * 1024;
+    const auto fast = config::exchange_adaptive_compression_fast_link_mb_per_sec * MB;
+    const auto slow = config::exchange_adaptive_compression_slow_link_mb_per_sec * MB;
+    const auto ratio = config::exchange_adaptive_compression_min_ratio;
+
+    // Fast link: keep LZ4 only if data is compressible enough.
+    EXPECT_EQ(pipeline::ExchangeSinkBuffer::choose_compression_type(fast, ratio,
+                                                                     CompressionTypePB::ZSTD),
+              CompressionTypePB::LZ4);
+    EXPECT_EQ(pipeline::ExchangeSinkBuffer::choose_compression_type(fast, ratio / 2,
+                                                                     CompressionTypePB::ZSTD),
+              CompressionTypePB::NO_COMPRESSION);
+    // Slow link: spend cpu on the strongest codec.
+    EXPECT_EQ(pipeline::ExchangeSinkBuffer::choose_compression_type(slow, 1.0,
+                                                                     CompressionTypePB::LZ4),
+              CompressionTypePB::ZSTD);
+    // In between: session default.
+    EXPECT_EQ(pipeline::ExchangeSinkBuffer::choose_compression_type((fast + slow) / 2, ratio,
+                                                                     CompressionTypePB::SNAPPY),
+              CompressionTypePB::SNAPPY);
+}
+
 } // namespace doris::vectorized
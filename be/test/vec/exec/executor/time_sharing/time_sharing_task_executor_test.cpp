@@ -922,5 +922,54 @@ TEST_F(TimeSharingTaskExecutorTest,
     executor.stop();
 }
 
+TEST_F(TimeSharingTaskExecutorTest, test_workload_group_weighted_split_queue) {
+    std::shared_ptr<TestingTicker> ticker = std::make_shared<TestingTicker>();
+    auto split_queue = std::make_shared<MultilevelSplitQueue>(2);
+
+    auto create_handle = [&](const std::string& name, uint64_t group_id, uint64_t weight) {
+        auto handle = std::make_shared<TimeSharingTaskHandle>(
+                TaskId(name), split_queue, []() { return 0.0; }, 1, std::chrono::milliseconds(1),
+                std::nullopt);
+        handle->set_workload_group(group_id, [weight]() { return weight; }, nullptr);
+        return handle;
+    };
+    auto etl_handle = create_handle("etl", 1, 1024);
+    auto dashboard_handle = create_handle("dashboard", 2, 3072);
+
+    auto global_controller = std::make_shared<PhaseController>(0);
+    auto create_split = [&](std::shared_ptr<TimeSharingTaskHandle> handle, int split_id) {
+        auto runner = std::make_shared<TestingSplitRunner>(
+                "split", ticker, global_controller, std::make_shared<PhaseController>(0),
+                std::make_shared<PhaseController>(0), 1, 1);
+        return std::make_shared<PrioritizedSplitRunner>(handle, split_id, runner, ticker);
+    };
+
+    auto etl_split = create_split(etl_handle, 0);
+    auto dashboard_split = create_split(dashboard_handle, 0);
+    split_queue->offer(etl_split);
+    split_queue->offer(dashboard_split);
+    EXPECT_EQ(split_queue->size(), 2);
+
+    // Both groups are scheduled for the same time, the group with the larger weight has
+    // the smaller virtual time and is served first.
+    etl_handle->add_scheduled_nanos(3'000'000);
+    dashboard_handle->add_scheduled_nanos(3'000'000);
+    EXPECT_DOUBLE_EQ(split_queue->group_vruntime(1), 3'000'000.0 / 1024);
+    EXPECT_DOUBLE_EQ(split_queue->group_vruntime(2), 3'000'000.0 / 3072);
+    EXPECT_EQ(split_queue->take(), dashboard_split);
+    EXPECT_EQ(split_queue->take(), etl_split);
+    EXPECT_EQ(split_queue->take(), nullptr);
+
+    // An idle group does not keep its credit, it restarts from the vruntime of active groups.
+    split_queue->offer(etl_split);
+    split_queue->offer(dashboard_split);
+    EXPECT_DOUBLE_EQ(split_queue->group_vruntime(2), 3'000'000.0 / 1024);
+
+    split_queue->remove(etl_split);
+    EXPECT_EQ(split_queue->size(), 1);
+    EXPECT_EQ(split_queue->take(), dashboard_split);
+    EXPECT_EQ(split_queue->size(), 0);
+}
+
 } // namespace vectorized
 } // namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "vec/exec/format/csv/csv_reader.h"
+
+namespace doris::vectorized {
+
+class PlainCsvTextFieldSplitterTest : public testing::Test {
+protected:
+    static std::vector<std::string> split(const std::string& input, char delimiter,
+                                          bool trim_tailing_space = false) {
+        PlainCsvTextFieldSplitter splitter(trim_tailing_space, false, std::string(1, delimiter));
+        std::vector<Slice> splitted_values;
+        splitter.do_split(Slice(input.data(), input.size()), &splitted_values);
+        std::vector<std::string> fields;
+        for (const auto& value : splitted_values) {
+            fields.emplace_back(value.data, value.size);
+        }
+        return fields;
+    }
+
+    static std::vector<std::string> expected_split(const std::string& input, char delimiter) {
+        std::vector<std::string> fields;
+        size_t start = 0;
+        for (size_t i = 0; i < input.size(); ++i) {
+            if (input[i] == delimiter) {
+                fields.push_back(input.substr(start, i - start));
+                start = i + 1;
+            }
+        }
+        fields.push_back(input.substr(start));
+        return fields;
+    }
+};
+
+TEST_F(PlainCsvTextFieldSplitterTest, ShortLines) {
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}), split("a,b,c", ','));
+    EXPECT_EQ(std::vector<std::string>({""}), split("", ','));
+    EXPECT_EQ(std::vector<std::string>({"", ""}), split(",", ','));
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}), split("a  ,b ", ',', true));
+}
+
+// The lines are longer than a vector of bytes, the separators are at the vector boundaries.
+TEST_F(PlainCsvTextFieldSplitterTest, LongLines) {
+    std::string line(100, 'x');
+    for (size_t pos : {0, 15, 16, 31, 32, 33, 63, 64, 99}) {
+        line[pos] = '|';
+    }
+    EXPECT_EQ(expected_split(line, '|'), split(line, '|'));
+    std::string no_separator(70, 'y');
+    EXPECT_EQ(std::vector<std::string>({no_separator}), split(no_separator, '|'));
+    std::string all_separators(70, '\t');
+    EXPECT_EQ(std::vector<std::string>(71, ""), split(all_separators, '\t'));
+
+    std::mt19937 rng(42);
+    for (int i = 0; i < 100; ++i) {
+        std::string random_line(rng() % 300, 'a');
+        for (auto& c : random_line) {
+            // The bytes with the high bit are not separators.
+            c = "ab,\xff"[rng() % 4];
+        }
+        EXPECT_EQ(expected_split(random_line, ','), split(random_line, ','));
+    }
+}
+
+} // namespace doris::vectorized
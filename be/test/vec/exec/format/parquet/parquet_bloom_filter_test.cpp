@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/parquet_bloom_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace doris::vectorized {
+
+// Inserts the hash the same way as the parquet writers.
+static void insert_hash(std::string* bitset, uint64_t hash) {
+    static constexpr uint32_t SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                         0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+    uint64_t num_blocks = bitset->size() / 32;
+    uint64_t block_index = ((hash >> 32) * num_blocks) >> 32;
+    auto* block = reinterpret_cast<uint32_t*>(bitset->data()) + block_index * 8;
+    auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < 8; ++i) {
+        block[i] |= uint32_t(1) << ((key * SALT[i]) >> 27);
+    }
+}
+
+TEST(ParquetBloomFilterTest, Hash) {
+    // XXH64 with seed 0
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, ParquetBloomFilter::hash("", 0));
+}
+
+TEST(ParquetBloomFilterTest, TestHash) {
+    std::string bitset(1024, '\0');
+    for (int32_t v = 0; v < 10; ++v) {
+        insert_hash(&bitset, ParquetBloomFilter::hash(&v, sizeof(v)));
+    }
+    std::string str = "doris";
+    insert_hash(&bitset, ParquetBloomFilter::hash(str.data(), str.size()));
+
+    ParquetBloomFilter bloom_filter(bitset);
+    for (int32_t v = 0; v < 10; ++v) {
+        EXPECT_TRUE(bloom_filter.test_hash(ParquetBloomFilter::hash(&v, sizeof(v))));
+    }
+    EXPECT_TRUE(bloom_filter.test_hash(ParquetBloomFilter::hash(str.data(), str.size())));
+
+    int positives = 0;
+    for (int32_t v = 10; v < 10000; ++v) {
+        positives += bloom_filter.test_hash(ParquetBloomFilter::hash(&v, sizeof(v)));
+    }
+    EXPECT_LT(positives, 10);
+}
+
+TEST(ParquetBloomFilterTest, EmptyBitset) {
+    std::string bitset;
+    ParquetBloomFilter bloom_filter(bitset);
+    EXPECT_TRUE(bloom_filter.test_hash(0));
+}
+
+} // namespace doris::vectorized
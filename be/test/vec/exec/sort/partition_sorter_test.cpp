@@ -195,4 +195,29 @@ TEST_F(PartitionSorterTest, test_partition_sorter_RANK) {
     sorter->reset_sorter_state(&_state);
 }
 
+TEST_F(PartitionSorterTest, test_partition_sorter_cut_sorted_block) {
+    SortCursorCmp previous_row;
+    auto sorted_block_of = [&](TopNAlgorithm::type top_n_algorithm, int64_t inner_limit) {
+        sorter = PartitionSorter::create_unique(
+                sort_exec_exprs, -1, 0, &pool, is_asc_order, nulls_first, *row_desc, nullptr,
+                nullptr, false, inner_limit, top_n_algorithm, &previous_row);
+        sorter->init_profile(&_profile);
+        Block block = ColumnHelper::create_block<DataTypeInt64>({5, 3, 1, 3, 4, 3, 2, 6, 4});
+        EXPECT_TRUE(sorter->append_block(&block).ok());
+        const auto& sorted_blocks = sorter->_state->get_sorted_block();
+        EXPECT_EQ(sorted_blocks.size(), 1);
+        return sorted_blocks[0];
+    };
+    // row_number() sorts only the first rows, rank() keeps the ties of the last row,
+    // and dense_rank() keeps the rows of the first distinct values.
+    EXPECT_TRUE(ColumnHelper::block_equal(*sorted_block_of(TopNAlgorithm::ROW_NUMBER, 3),
+                                          ColumnHelper::create_block<DataTypeInt64>({1, 2, 3})));
+    EXPECT_TRUE(ColumnHelper::block_equal(*sorted_block_of(TopNAlgorithm::RANK, 3),
+                                          ColumnHelper::create_block<DataTypeInt64>(
+                                                  {1, 2, 3, 3, 3})));
+    EXPECT_TRUE(ColumnHelper::block_equal(*sorted_block_of(TopNAlgorithm::DENSE_RANK, 4),
+                                          ColumnHelper::create_block<DataTypeInt64>(
+                                                  {1, 2, 3, 3, 3, 4, 4})));
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -46,6 +46,8 @@
 #include "vec/core/field.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_factory.hpp"
+#include "vec/data_types/data_type_number.h"
+#include "vec/exprs/vcommon_subexpr_ref.h"
 #include "vec/exprs/vexpr_context.h"
 #include "vec/exprs/vliteral.h"
 #include "vec/runtime/time_value.h"
@@ -172,6 +174,55 @@ TEST(TEST_VEXPR, ABSTEST2) {
     ASSERT_TRUE(state.ok());
 }
 
+TEST(TEST_VEXPR, COMMON_SUBEXPR_TEST) {
+    using namespace doris;
+    std::vector<doris::SchemaScanner::ColumnDesc> column_descs = {
+            {"k1", TYPE_INT, sizeof(int32_t), false}};
+    ObjectPool object_pool;
+    doris::TupleDescriptor* tuple_desc = create_tuple_desc(&object_pool, column_descs);
+    RowDescriptor row_desc(tuple_desc, false);
+    // abs(k1)
+    std::string expr_json =
+            R"|({"1":{"lst":["rec",2,{"1":{"i32":20},"2":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":6}}}}]}}},"4":{"i32":1},"20":{"i32":-1},"26":{"rec":{"1":{"rec":{"2":{"str":"abs"}}},"2":{"i32":0},"3":{"lst":["rec",1,{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":5}}}}]}}]},"4":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":6}}}}]}}},"5":{"tf":0},"7":{"str":"abs(INT)"},"9":{"rec":{"1":{"str":"_ZN5doris13MathFunctions3absEPN9doris_udf15FunctionContextERKNS1_6IntValE"}}},"11":{"i64":0}}}},{"1":{"i32":16},"2":{"rec":{"1":{"lst":["rec",1,{"1":{"i32":0},"2":{"rec":{"1":{"i32":5}}}}]}}},"4":{"i32":0},"15":{"rec":{"1":{"i32":0},"2":{"i32":0}}},"20":{"i32":-1},"23":{"i32":-1}}]}})|";
+    TExpr exprx = apache::thrift::from_json_string<TExpr>(expr_json);
+
+    vectorized::VExprContextSPtrs contexts;
+    ASSERT_TRUE(vectorized::VExpr::create_expr_trees({exprx, exprx}, contexts).ok());
+    EXPECT_EQ(1, vectorized::VCommonSubexprRef::rewrite(contexts));
+    for (const auto& context : contexts) {
+        EXPECT_NE(nullptr, dynamic_cast<vectorized::VCommonSubexprRef*>(context->root().get()));
+    }
+
+    doris::RuntimeState runtime_stat;
+    DescriptorTbl desc_tbl;
+    desc_tbl._slot_desc_map[0] = tuple_desc->slots()[0];
+    runtime_stat.set_desc_tbl(&desc_tbl);
+    ASSERT_TRUE(vectorized::VExpr::prepare(contexts, &runtime_stat, row_desc).ok());
+    ASSERT_TRUE(vectorized::VExpr::open(contexts, &runtime_stat).ok());
+    vectorized::VCommonSubexprRef::share_results(contexts);
+
+    auto column = vectorized::ColumnInt32::create();
+    column->insert_value(-1);
+    column->insert_value(2);
+    vectorized::Block block;
+    block.insert({std::move(column), std::make_shared<vectorized::DataTypeInt32>(), "k1"});
+    int first = -1;
+    int second = -1;
+    ASSERT_TRUE(contexts[0]->execute(&block, &first).ok());
+    ASSERT_TRUE(contexts[1]->execute(&block, &second).ok());
+    // abs(k1) is executed once.
+    EXPECT_EQ(2, block.columns());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, block.get_by_position(first).column->get_int(0));
+
+    // The results are not reused on another block.
+    vectorized::VCommonSubexprRef::reset_results(contexts);
+    vectorized::Block other_block;
+    other_block.insert(block.get_by_position(0));
+    ASSERT_TRUE(contexts[0]->execute(&other_block, &first).ok());
+    EXPECT_EQ(2, other_block.columns());
+}
+
 namespace doris {
 template <PrimitiveType T>
 struct literal_traits {};
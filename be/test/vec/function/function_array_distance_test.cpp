@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/functions/array/function_array_distance.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/core/block.h"
+
+namespace doris::vectorized {
+
+static ColumnPtr create_array_column(const std::vector<std::vector<double>>& rows) {
+    auto data = ColumnFloat64::create();
+    auto offsets = ColumnArray::ColumnOffsets::create();
+    for (const auto& row : rows) {
+        for (double v : row) {
+            data->insert_value(v);
+        }
+        offsets->insert_value(data->size());
+    }
+    return ColumnArray::create(std::move(data), std::move(offsets));
+}
+
+// The constant query vector is compared with every row without being expanded.
+TEST(function_array_distance_test, const_query_vector) {
+    auto type = std::make_shared<DataTypeArray>(std::make_shared<DataTypeFloat64>());
+    ColumnPtr embeddings = create_array_column({{0, 0}, {3, 4}, {6, 8}});
+    ColumnPtr query = ColumnConst::create(create_array_column({{3, 0}}), 3);
+
+    for (bool query_first : {false, true}) {
+        Block block;
+        block.insert({query_first ? query : embeddings, type, "c0"});
+        block.insert({query_first ? embeddings : query, type, "c1"});
+        block.insert({nullptr, make_nullable(std::make_shared<DataTypeFloat64>()), "result"});
+        FunctionArrayDistance<L2Distance> function;
+        ASSERT_TRUE(function.execute_impl(nullptr, block, {0, 1}, 2, 3).ok());
+
+        const auto& result = assert_cast<const ColumnNullable&>(*block.get_by_position(2).column);
+        const auto& distances = assert_cast<const ColumnFloat64&>(result.get_nested_column());
+        ASSERT_EQ(3, result.size());
+        EXPECT_DOUBLE_EQ(3, distances.get_element(0));
+        EXPECT_DOUBLE_EQ(4, distances.get_element(1));
+        EXPECT_DOUBLE_EQ(std::sqrt(73), distances.get_element(2));
+        EXPECT_FALSE(result.has_null());
+    }
+}
+
+TEST(function_array_distance_test, different_dimensions) {
+    auto type = std::make_shared<DataTypeArray>(std::make_shared<DataTypeFloat64>());
+    Block block;
+    block.insert({create_array_column({{1, 2}, {1, 2, 3}}), type, "c0"});
+    block.insert({ColumnConst::create(create_array_column({{1, 2}}), 2), type, "c1"});
+    block.insert({nullptr, make_nullable(std::make_shared<DataTypeFloat64>()), "result"});
+    FunctionArrayDistance<CosineDistance> function;
+    EXPECT_FALSE(function.execute_impl(nullptr, block, {0, 1}, 2, 2).ok());
+}
+
+} // namespace doris::vectorized
@@ -17,9 +17,13 @@
 
 #include "vec/functions/function_convert_tz.h"
 
+#include <cctz/civil_time.h>
+#include <cctz/time_zone.h>
 #include <gtest/gtest.h>
 #include <stdint.h>
 
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
@@ -56,4 +60,29 @@ TEST(FunctionConvertTZTest, test_no_open_but_execute_const) {
     EXPECT_EQ(st.ok(), true) << st.msg();
 }
 
+TEST(FunctionConvertTZTest, test_offset_cache) {
+    for (const auto& [from_name, to_name] :
+         std::vector<std::pair<std::string, std::string>> {{"America/New_York", "Asia/Shanghai"},
+                                                           {"Europe/London", "America/Los_Angeles"},
+                                                           {"Australia/Lord_Howe", "UTC"}}) {
+        cctz::time_zone from_tz;
+        cctz::time_zone to_tz;
+        ASSERT_TRUE(cctz::load_time_zone(from_name, &from_tz));
+        ASSERT_TRUE(cctz::load_time_zone(to_name, &to_tz));
+        ConvertTzOffsetCache offset_cache(from_tz, to_tz);
+        // Every 17 minutes of 3 years, which cross the DST transitions of both zones.
+        size_t num_cached = 0;
+        for (cctz::civil_second local(2020, 1, 1); local < cctz::civil_second(2023, 1, 1);
+             local += 17 * 60) {
+            cctz::civil_second converted;
+            if (offset_cache.convert(local, &converted)) {
+                EXPECT_EQ(converted, cctz::convert(cctz::convert(local, from_tz), to_tz))
+                        << from_name << " " << local;
+                ++num_cached;
+            }
+        }
+        EXPECT_GT(num_cached, 0);
+    }
+}
+
 } // namespace doris::vectorized
@@ -317,6 +317,52 @@ TEST(VGeoFunctionsTest, function_geo_st_contains) {
     }
 }
 
+TEST(VGeoFunctionsTest, function_geo_st_contains_const_shape) {
+    std::string func_name = "st_contains";
+
+    auto encode_wkt = [](const std::string& wkt) {
+        GeoParseStatus status;
+        std::unique_ptr<GeoShape> shape(GeoShape::from_wkt(wkt.data(), wkt.size(), &status));
+        EXPECT_TRUE(status == GEO_PARSE_OK);
+        std::string buf;
+        shape->encode_to(&buf);
+        return buf;
+    };
+    auto encode_point = [](double x, double y) {
+        GeoPoint point;
+        EXPECT_TRUE(point.from_coord(x, y) == GEO_PARSE_OK);
+        std::string buf;
+        point.encode_to(&buf);
+        return buf;
+    };
+
+    std::string polygon = encode_wkt("POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+    std::string multi_polygon = encode_wkt(
+            "MULTIPOLYGON (((0 0, 10 0, 10 10, 0 10, 0 0)), ((20 20, 30 20, 30 30, 20 30, 20 "
+            "20)))");
+    std::string circle;
+    GeoCircle geo_circle;
+    EXPECT_TRUE(geo_circle.init(5, 5, 10000) == GEO_PARSE_OK);
+    geo_circle.encode_to(&circle);
+
+    InputTypeSet input_types = {Consted {PrimitiveType::TYPE_VARCHAR},
+                                PrimitiveType::TYPE_VARCHAR};
+    // The points inside of the shapes, near them and far from them.
+    for (const auto& [shape, expected] : std::vector<std::pair<std::string, std::vector<int>>> {
+                 {polygon, {1, 0, 0, 0, 0}},
+                 {multi_polygon, {1, 0, 1, 0, 0}},
+                 {circle, {1, 0, 0, 0, 0}}}) {
+        std::vector<std::string> points = {encode_point(5, 5), encode_point(10.5, 5),
+                                           encode_point(25, 25), encode_point(50, 50),
+                                           encode_point(-120, -60)};
+        for (size_t i = 0; i < points.size(); ++i) {
+            DataSet data_set = {{{shape, points[i]}, (uint8_t)expected[i]}};
+            static_cast<void>(
+                    check_function<DataTypeUInt8, true>(func_name, input_types, data_set));
+        }
+    }
+}
+
 TEST(VGeoFunctionsTest, function_geo_st_circle) {
     std::string func_name = "st_circle";
     {
@@ -327,6 +327,33 @@ TEST(FunctionJsonbTEST, JsonbExtractTest) {
     static_cast<void>(check_function<DataTypeJsonb, true>(func_name, input_types, data_set));
 }
 
+TEST(FunctionJsonbTEST, JsonbExtractConstPathsTest) {
+    std::string func_name = "jsonb_extract";
+    // the members of the root object are looked up by hash for 4 constant paths
+    InputTypeSet input_types = {PrimitiveType::TYPE_JSONB, Consted {PrimitiveType::TYPE_VARCHAR},
+                                Consted {PrimitiveType::TYPE_VARCHAR},
+                                Consted {PrimitiveType::TYPE_VARCHAR},
+                                Consted {PrimitiveType::TYPE_VARCHAR}};
+
+    std::vector<DataSet> data_sets = {
+            {{{STRING(R"({"k1":1, "k2":"a", "k3":[1, 2], "k4":{"x":true}})"), STRING("$.k1"),
+               STRING("$.k3[1]"), STRING("$.k4.x"), STRING("$.k5")},
+              STRING("[1,2,true]")}},
+            {{{STRING(R"({"k1":1, "k2":"a"})"), STRING("$.k2"), STRING("$.k1"), STRING("$[0].k1"),
+               STRING("$.*")},
+              STRING(R"(["a",1,1,1,"a"])")}},
+            {{{STRING(R"({"k1":1})"), STRING("$.k2"), STRING("$.k3"), STRING("$.k4"),
+               STRING("$.k5")},
+              Null()}},
+            {{{STRING("[1, 2]"), STRING("$.k1"), STRING("$[1]"), STRING("$.k3"), STRING("$.k4")},
+              STRING("[2]")}},
+            {{{Null(), STRING("$.k1"), STRING("$.k2"), STRING("$.k3"), STRING("$.k4")}, Null()}},
+    };
+    for (const auto& data_set : data_sets) {
+        static_cast<void>(check_function<DataTypeJsonb, true>(func_name, input_types, data_set));
+    }
+}
+
 TEST(FunctionJsonbTEST, JsonbCastToOtherTest) {
     std::string func_name = "CAST";
     InputTypeSet input_types = {Nullable {PrimitiveType::TYPE_JSONB},
@@ -25,6 +25,7 @@
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
+#include "vec/functions/like.h"
 
 namespace doris::vectorized {
 
@@ -307,4 +308,19 @@ TEST(FunctionLikeTest, regexp_replace_one) {
     }
 }
 
+TEST(FunctionLikeTest, multi_pattern_matcher) {
+    auto matcher = MultiPatternMatcher::create({"%abc%", "x_z"}, {"^[0-9]+$"});
+    ASSERT_NE(matcher, nullptr);
+    auto values = ColumnString::create();
+    for (const std::string value : {"zabcz", "xyz", "xyyz", "123", "12a", "", "ab"}) {
+        values->insert_data(value.data(), value.size());
+    }
+    ColumnUInt8::Container result(values->size(), 0);
+    ASSERT_TRUE(matcher->match(*values, result).ok());
+    EXPECT_EQ(result, ColumnUInt8::Container({1, 1, 0, 1, 0, 0, 0}));
+
+    // hyperscan does not support back references
+    EXPECT_EQ(MultiPatternMatcher::create({"%abc%"}, {"(a)\\1"}), nullptr);
+}
+
 } // namespace doris::vectorized
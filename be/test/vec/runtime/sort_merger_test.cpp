@@ -17,8 +17,12 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "testutil/column_helper.h"
 #include "testutil/mock/mock_slot_ref.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/runtime/vsorted_run_merger.h"
@@ -470,10 +474,10 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
             child_block_suppliers.push_back(block_supplier);
         }
         EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
-        EXPECT_EQ(merger->_priority_queue.size(), 1);
-        EXPECT_EQ(merger->_priority_queue.top()->pos, 0);
-        EXPECT_EQ(merger->_priority_queue.top()->rows, 1);
-        EXPECT_EQ(merger->_priority_queue.top()->block_ptr()->rows(), 1);
+        EXPECT_EQ(merger->_loser_tree.size(), 1);
+        EXPECT_EQ(merger->_loser_tree.top()->pos, 0);
+        EXPECT_EQ(merger->_loser_tree.top()->rows, 1);
+        EXPECT_EQ(merger->_loser_tree.top()->block_ptr()->rows(), 1);
     }
     {
         vectorized::Block block;
@@ -485,4 +489,55 @@ TEST(SortMergerTest, TEST_SINGLE_STREAM) {
     }
 }
 
+TEST(SortMergerTest, TEST_MANY_STREAMS) {
+    /**
+     * in: 37 streams, stream c: [([1000 + c, 1040 + c, 1080 + c, 1120 + c], eos = false),
+     *                            ([2000 + c, ...], eos = false), ([3000 + c, ...], eos = false),
+     *                            ([], eos = true)]
+     *     offset = 0, limit = -1, ASC
+     * out: all of the 444 rows in ascending order
+     */
+    const int num_children = 37;
+    const int batch_size = 64;
+    const int num_round = 4;
+    std::vector<int> round(num_children, 0);
+
+    auto profile = std::make_shared<RuntimeProfile>("");
+    auto ordering_expr = MockSlotRef::create_mock_contexts(std::make_shared<DataTypeInt64>());
+    std::unique_ptr<VSortedRunMerger> merger(new VSortedRunMerger(
+            ordering_expr, {true}, {false}, batch_size, -1, 0, profile.get()));
+    {
+        std::vector<vectorized::BlockSupplier> child_block_suppliers;
+        for (int child_idx = 0; child_idx < num_children; child_idx++) {
+            child_block_suppliers.emplace_back(
+                    [round_vec = &round, id = child_idx](vectorized::Block* block, bool* eos) {
+                        const int current_round = ++((*round_vec)[id]);
+                        *eos = current_round == num_round;
+                        if (*eos) {
+                            return Status::OK();
+                        }
+                        const Int64 base = current_round * 1000 + id;
+                        *block = ColumnHelper::create_block<DataTypeInt64>(
+                                {base, base + 40, base + 80, base + 120});
+                        return Status::OK();
+                    });
+        }
+        EXPECT_TRUE(merger->prepare(child_block_suppliers).ok());
+    }
+
+    std::vector<Int64> merged;
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        EXPECT_TRUE(merger->get_next(&block, &eos).ok());
+        if (block.rows() == 0) {
+            continue;
+        }
+        const auto& column = assert_cast<const ColumnInt64&>(*block.get_by_position(0).column);
+        merged.insert(merged.end(), column.get_data().begin(), column.get_data().end());
+    }
+    EXPECT_EQ(merged.size(), static_cast<size_t>(num_children * (num_round - 1) * 4));
+    EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()));
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -307,6 +307,9 @@ extern bvar::LatencyRecorder g_bvar_txn_kv_batch_get;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_get_count_normalized;
+extern bvar::Adder<int64_t> g_bvar_txn_kv_batched_read_version_requests;
+extern bvar::Adder<int64_t> g_bvar_tablet_index_cache_hit;
+extern bvar::Adder<int64_t> g_bvar_tablet_index_cache_miss;
 
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_put_conflict_counter;
 extern bvar::Adder<int64_t> g_bvar_delete_bitmap_lock_txn_remove_conflict_by_fail_counter;
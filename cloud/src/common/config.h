@@ -44,6 +44,13 @@ CONF_mInt64(idempotent_request_replay_delay_range_ms, "5000");
 CONF_mString(idempotent_request_replay_exclusion, "GetTabletStatsRequest,GetVersionRequest");
 
 CONF_Int64(fdb_txn_timeout_ms, "10000");
+// Whether the transactions created concurrently share the read versions fetched from fdb, which
+// reduces the get-read-version requests under high concurrency.
+CONF_mBool(enable_txn_kv_read_version_batching, "false");
+// The max number of the tablet indexes cached in meta-service, 0 to disable the cache.
+CONF_mInt64(tablet_index_cache_capacity, "0");
+// Seconds a cached tablet index is valid for.
+CONF_mInt64(tablet_index_cache_ttl_seconds, "60");
 CONF_Int64(brpc_max_body_size, "3147483648");
 CONF_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
 
@@ -95,6 +102,11 @@ CONF_Bool(enable_checker, "false");
 // The parallelism for parallel recycle operation
 // s3_producer_pool recycle_tablet_pool, delete single object in this pool
 CONF_Int32(recycle_pool_parallelism, "40");
+// The max number of the objects deleted by a batch delete request of the recycler, the batches
+// of a rowset or tablet are issued concurrently in the s3 accessor worker pool
+CONF_mInt64(recycler_delete_objects_batch_size, "1000");
+// The max batch delete requests sent to a storage vault per second, 0 for unlimited
+CONF_Int64(recycler_delete_objects_per_second_per_vault, "0");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
 // Currently only used for recycler test
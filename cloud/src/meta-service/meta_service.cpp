@@ -61,6 +61,7 @@
 #include "meta-service/meta_service_helper.h"
 #include "meta-service/meta_service_schema.h"
 #include "meta-service/meta_service_tablet_stats.h"
+#include "meta-service/tablet_index_cache.h"
 #include "meta-store/blob_message.h"
 #include "meta-store/codec.h"
 #include "meta-store/keys.h"
@@ -185,6 +186,9 @@ void get_tablet_idx(MetaServiceCode& code, std::string& msg, Transaction* txn,
                     const std::string& instance_id, int64_t tablet_id, TabletIndexPB& tablet_idx) {
     std::string key, val;
     meta_tablet_idx_key({instance_id, tablet_id}, &key);
+    if (TabletIndexCache::instance()->get(key, &tablet_idx)) {
+        return;
+    }
     TxnErrorCode err = txn->get(key, &val);
     if (err != TxnErrorCode::TXN_OK) {
         if (err == TxnErrorCode::TXN_KEY_NOT_FOUND) {
@@ -208,6 +212,7 @@ void get_tablet_idx(MetaServiceCode& code, std::string& msg, Transaction* txn,
                      << " idx_pb_tablet_id=" << tablet_idx.tablet_id() << " key=" << hex(key);
         return;
     }
+    TabletIndexCache::instance()->put(key, tablet_idx);
 }
 
 void MetaServiceImpl::get_version(::google::protobuf::RpcController* controller,
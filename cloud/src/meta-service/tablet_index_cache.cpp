@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "meta-service/tablet_index_cache.h"
+
+#include <chrono>
+
+#include "common/bvars.h"
+#include "common/config.h"
+
+namespace doris::cloud {
+
+static int64_t now_ms() {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+TabletIndexCache* TabletIndexCache::instance() {
+    static TabletIndexCache cache;
+    return &cache;
+}
+
+bool TabletIndexCache::get(const std::string& key, TabletIndexPB* tablet_idx) {
+    if (config::tablet_index_cache_capacity <= 0) {
+        return false;
+    }
+    Shard& s = shard(key);
+    std::lock_guard lock(s.mutex);
+    auto it = s.index.find(key);
+    if (it == s.index.end()) {
+        g_bvar_tablet_index_cache_miss << 1;
+        return false;
+    }
+    if (it->second->second.expiration_ms <= now_ms()) {
+        s.lru.erase(it->second);
+        s.index.erase(it);
+        g_bvar_tablet_index_cache_miss << 1;
+        return false;
+    }
+    s.lru.splice(s.lru.begin(), s.lru, it->second);
+    *tablet_idx = it->second->second.tablet_idx;
+    g_bvar_tablet_index_cache_hit << 1;
+    return true;
+}
+
+void TabletIndexCache::put(const std::string& key, const TabletIndexPB& tablet_idx) {
+    int64_t capacity = config::tablet_index_cache_capacity / NUM_SHARDS;
+    if (capacity <= 0) {
+        return;
+    }
+    Entry entry {tablet_idx, now_ms() + config::tablet_index_cache_ttl_seconds * 1000};
+    Shard& s = shard(key);
+    std::lock_guard lock(s.mutex);
+    if (auto it = s.index.find(key); it != s.index.end()) {
+        it->second->second = std::move(entry);
+        s.lru.splice(s.lru.begin(), s.lru, it->second);
+        return;
+    }
+    s.lru.emplace_front(key, std::move(entry));
+    s.index.emplace(key, s.lru.begin());
+    while (s.index.size() > static_cast<size_t>(capacity)) {
+        s.index.erase(s.lru.back().first);
+        s.lru.pop_back();
+    }
+}
+
+void TabletIndexCache::erase(const std::string& key) {
+    Shard& s = shard(key);
+    std::lock_guard lock(s.mutex);
+    if (auto it = s.index.find(key); it != s.index.end()) {
+        s.lru.erase(it->second);
+        s.index.erase(it);
+    }
+}
+
+void TabletIndexCache::clear() {
+    for (auto& s : shards_) {
+        std::lock_guard lock(s.mutex);
+        s.lru.clear();
+        s.index.clear();
+    }
+}
+
+} // namespace doris::cloud
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/cloud.pb.h>
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace doris::cloud {
+
+// A read-through cache of the tablet indexes (tablet_id -> db_id, table_id, index_id,
+// partition_id), which are read by almost every request of loads and queries.
+//
+// A tablet index is written once when the tablet is created and removed only after the tablet is
+// recycled, so a cached entry is valid until it expires. Missing keys are never cached.
+class TabletIndexCache {
+public:
+    static TabletIndexCache* instance();
+
+    // Returns true and fills `tablet_idx` if a valid entry of `key` is cached.
+    bool get(const std::string& key, TabletIndexPB* tablet_idx);
+
+    void put(const std::string& key, const TabletIndexPB& tablet_idx);
+
+    void erase(const std::string& key);
+
+    void clear();
+
+private:
+    static constexpr size_t NUM_SHARDS = 16;
+
+    struct Entry {
+        TabletIndexPB tablet_idx;
+        int64_t expiration_ms;
+    };
+    using LruList = std::list<std::pair<std::string, Entry>>;
+
+    struct Shard {
+        std::mutex mutex;
+        // The most recently used entries are in the front
+        LruList lru;
+        std::unordered_map<std::string, LruList::iterator> index;
+    };
+
+    Shard& shard(const std::string& key) {
+        return shards_[std::hash<std::string> {}(key) % NUM_SHARDS];
+    }
+
+    std::array<Shard, NUM_SHARDS> shards_;
+};
+
+} // namespace doris::cloud
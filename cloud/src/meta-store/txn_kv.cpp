@@ -83,6 +83,7 @@ int FdbTxnKv::init() {
         LOG(WARNING) << "failed to init database";
         return ret;
     }
+    read_version_batcher_ = std::make_shared<fdb::ReadVersionBatcher>(database_);
     return 0;
 }
 
@@ -92,6 +93,16 @@ TxnErrorCode FdbTxnKv::create_txn(std::unique_ptr<Transaction>* txn) {
     auto ret = t->init();
     if (ret != TxnErrorCode::TXN_OK) {
         LOG(WARNING) << "failed to init txn, ret=" << ret;
+        return ret;
+    }
+    if (config::enable_txn_kv_read_version_batching) {
+        int64_t version = 0;
+        ret = read_version_batcher_->get(&version);
+        if (ret != TxnErrorCode::TXN_OK) {
+            LOG(WARNING) << "failed to get batched read version, ret=" << ret;
+            return ret;
+        }
+        t->set_read_version(version);
     }
     return ret;
 }
@@ -351,6 +362,10 @@ TxnErrorCode Transaction::enable_access_system_keys() {
     return TxnErrorCode::TXN_OK;
 }
 
+void Transaction::set_read_version(int64_t version) {
+    fdb_transaction_set_read_version(txn_, version);
+}
+
 void Transaction::put(std::string_view key, std::string_view val) {
     StopWatch sw;
     fdb_transaction_set(txn_, (uint8_t*)key.data(), key.size(), (uint8_t*)val.data(), val.size());
@@ -634,6 +649,37 @@ TxnErrorCode Transaction::get_read_version(int64_t* version) {
     return TxnErrorCode::TXN_OK;
 }
 
+TxnErrorCode ReadVersionBatcher::get(int64_t* version) {
+    std::unique_lock lock(mutex_);
+    // The request in flight may have been issued before this call, so it is not enough.
+    uint64_t target = generation_ + (in_flight_ ? 2 : 1);
+    while (generation_ < target) {
+        if (in_flight_) {
+            cond_.wait(lock);
+            continue;
+        }
+        in_flight_ = true;
+        lock.unlock();
+        int64_t fetched = 0;
+        TxnErrorCode code = fetch(&fetched);
+        lock.lock();
+        version_ = fetched;
+        code_ = code;
+        in_flight_ = false;
+        ++generation_;
+        g_bvar_txn_kv_batched_read_version_requests << 1;
+        cond_.notify_all();
+    }
+    *version = version_;
+    return code_;
+}
+
+TxnErrorCode ReadVersionBatcher::fetch(int64_t* version) {
+    Transaction txn(db_);
+    RETURN_IF_ERROR(txn.init());
+    return txn.get_read_version(version);
+}
+
 TxnErrorCode Transaction::get_committed_version(int64_t* version) {
     StopWatch sw;
     auto err = fdb_transaction_get_committed_version(txn_, version);
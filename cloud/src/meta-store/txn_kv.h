@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
 #include <foundationdb/fdb_c.h>
 #include <foundationdb/fdb_c_options.g.h>
 
@@ -426,6 +428,7 @@ namespace fdb {
 class Database;
 class Transaction;
 class Network;
+class ReadVersionBatcher;
 } // namespace fdb
 
 class FdbTxnKv : public TxnKv {
@@ -457,6 +460,7 @@ public:
 private:
     std::shared_ptr<fdb::Network> network_;
     std::shared_ptr<fdb::Database> database_;
+    std::shared_ptr<fdb::ReadVersionBatcher> read_version_batcher_;
 };
 
 namespace fdb {
@@ -514,6 +518,36 @@ private:
     FDBDatabaseOption opt_;
 };
 
+/**
+ * Shares the read versions among the transactions created concurrently, so that a single
+ * get-read-version request serves all the transactions waiting for it.
+ *
+ * A read version requested after a transaction is created reflects all the commits done before
+ * it, the same as the one the transaction would fetch itself, so the transactions arriving while
+ * a request is in flight wait for the next one.
+ */
+class ReadVersionBatcher {
+public:
+    ReadVersionBatcher(std::shared_ptr<Database> db) : db_(std::move(db)) {}
+
+    /**
+     * @return TXN_OK for success, otherwise the error of the shared request
+     */
+    TxnErrorCode get(int64_t* version);
+
+private:
+    TxnErrorCode fetch(int64_t* version);
+
+    std::shared_ptr<Database> db_;
+    bthread::Mutex mutex_;
+    bthread::ConditionVariable cond_;
+    bool in_flight_ = false;
+    // Number of the finished requests
+    uint64_t generation_ = 0;
+    int64_t version_ = 0;
+    TxnErrorCode code_ = TxnErrorCode::TXN_OK;
+};
+
 class RangeGetIterator : public cloud::RangeGetIterator {
 public:
     /**
@@ -630,6 +664,11 @@ public:
     TxnErrorCode init();
     TxnErrorCode enable_access_system_keys();
 
+    /**
+     * Use `version` as the read version instead of fetching one on the first read.
+     */
+    void set_read_version(int64_t version);
+
     void put(std::string_view key, std::string_view val) override;
 
     using cloud::Transaction::get;
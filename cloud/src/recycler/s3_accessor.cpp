@@ -25,6 +25,7 @@
 #include <aws/s3/S3Client.h>
 #include <aws/sts/STSClient.h>
 #include <bvar/reducer.h>
+#include <bvar/window.h>
 #include <gen_cpp/cloud.pb.h>
 
 #include <algorithm>
@@ -53,6 +54,7 @@
 #include "recycler/obj_storage_client.h"
 #include "recycler/s3_obj_client.h"
 #include "recycler/storage_vault_accessor.h"
+#include "recycler/sync_executor.h"
 
 namespace doris::cloud {
 namespace s3_bvar {
@@ -72,6 +74,11 @@ bvar::Adder<int64_t> get_rate_limit_ns("get_rate_limit_ns");
 bvar::Adder<int64_t> get_rate_limit_exceed_req_num("get_rate_limit_exceed_req_num");
 bvar::Adder<int64_t> put_rate_limit_ns("put_rate_limit_ns");
 bvar::Adder<int64_t> put_rate_limit_exceed_req_num("put_rate_limit_exceed_req_num");
+bvar::Adder<int64_t> delete_rate_limit_ns("delete_rate_limit_ns");
+bvar::Adder<int64_t> delete_rate_limit_exceed_req_num("delete_rate_limit_exceed_req_num");
+bvar::Adder<int64_t> s3_deleted_objects("s3_deleted_objects");
+bvar::PerSecond<bvar::Adder<int64_t>> s3_deleted_objects_per_second("s3_deleted_objects_per_second",
+                                                                    &s3_deleted_objects);
 
 AccessorRateLimiter::AccessorRateLimiter()
         : _rate_limiters(
@@ -318,6 +325,12 @@ int S3Accessor::init() {
                 std::make_shared<SimpleThreadPool>(config::recycle_pool_parallelism, "s3_accessor");
         worker_pool->start();
     });
+    if (config::recycler_delete_objects_per_second_per_vault > 0) {
+        auto qps = static_cast<size_t>(config::recycler_delete_objects_per_second_per_vault);
+        delete_rate_limiter_ = std::make_unique<S3RateLimiterHolder>(
+                qps, qps, 0,
+                metric_func_factory(delete_rate_limit_ns, delete_rate_limit_exceed_req_num));
+    }
     S3Environment::getInstance();
     switch (conf_.provider) {
     case S3Conf::AZURE: {
@@ -436,8 +449,50 @@ int S3Accessor::delete_files(const std::vector<std::string>& paths) {
         keys.emplace_back(get_key(path));
     }
 
-    return obj_client_->delete_objects(conf_.bucket, std::move(keys), {.executor = worker_pool})
-            .ret;
+    auto delete_batch = [this](std::vector<std::string> batch) {
+        if (delete_rate_limiter_ != nullptr) {
+            delete_rate_limiter_->add(1);
+        }
+        size_t num_keys = batch.size();
+        int ret = obj_client_->delete_objects(conf_.bucket, std::move(batch),
+                                              {.executor = worker_pool})
+                          .ret;
+        if (ret == 0) {
+            s3_deleted_objects << num_keys;
+        }
+        return ret;
+    };
+    auto batch_size =
+            static_cast<size_t>(std::max<int64_t>(1, config::recycler_delete_objects_batch_size));
+    if (keys.size() <= batch_size) {
+        return delete_batch(std::move(keys));
+    }
+
+    // Issue the batches concurrently in the worker pool, whose tasks never call this function, so
+    // waiting for them can not deadlock.
+    SyncExecutor<int> concurrent_delete_executor(
+            worker_pool, fmt::format("delete {} files under {}", keys.size(), uri_),
+            [](const int& ret) { return ret != 0; });
+    for (size_t begin = 0; begin < keys.size(); begin += batch_size) {
+        size_t end = std::min(begin + batch_size, keys.size());
+        std::vector<std::string> batch(std::make_move_iterator(keys.begin() + begin),
+                                       std::make_move_iterator(keys.begin() + end));
+        concurrent_delete_executor.add([&delete_batch, batch = std::move(batch)]() mutable {
+            return delete_batch(std::move(batch));
+        });
+    }
+
+    bool finished = true;
+    std::vector<int> rets = concurrent_delete_executor.when_all(&finished);
+    if (!finished) {
+        return -1;
+    }
+    for (int ret : rets) {
+        if (ret != 0) {
+            return ret;
+        }
+    }
+    return 0;
 }
 
 int S3Accessor::delete_file(const std::string& path) {
@@ -153,6 +153,8 @@ protected:
     S3Conf conf_;
     std::shared_ptr<ObjStorageClient> obj_client_;
     std::string _ca_cert_file_path;
+    // Limits the batch delete requests sent to the vault, nullptr if not limited
+    std::unique_ptr<S3RateLimiterHolder> delete_rate_limiter_;
 };
 
 class GcsAccessor final : public S3Accessor {
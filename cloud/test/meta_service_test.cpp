@@ -38,6 +38,7 @@
 #include "common/util.h"
 #include "cpp/sync_point.h"
 #include "meta-service/meta_service_helper.h"
+#include "meta-service/tablet_index_cache.h"
 #include "meta-store/keys.h"
 #include "meta-store/mem_txn_kv.h"
 #include "meta-store/txn_kv_error.h"
@@ -10763,4 +10764,56 @@ TEST(MetaServiceTest, RestoreJobTest) {
     }
 }
 
+TEST(MetaServiceTest, TabletIndexCacheTest) {
+    auto* cache = TabletIndexCache::instance();
+    cache->clear();
+    auto capacity = config::tablet_index_cache_capacity;
+    auto ttl = config::tablet_index_cache_ttl_seconds;
+    DORIS_CLOUD_DEFER {
+        config::tablet_index_cache_capacity = capacity;
+        config::tablet_index_cache_ttl_seconds = ttl;
+        cache->clear();
+    };
+
+    TabletIndexPB idx;
+    idx.set_table_id(1);
+    idx.set_index_id(2);
+    idx.set_partition_id(3);
+    idx.set_tablet_id(4);
+    std::string key = meta_tablet_idx_key({"test_instance", 4});
+
+    // Disabled
+    config::tablet_index_cache_capacity = 0;
+    cache->put(key, idx);
+    TabletIndexPB res;
+    ASSERT_FALSE(cache->get(key, &res));
+
+    config::tablet_index_cache_capacity = 1024;
+    config::tablet_index_cache_ttl_seconds = 60;
+    cache->put(key, idx);
+    ASSERT_TRUE(cache->get(key, &res));
+    ASSERT_EQ(res.partition_id(), 3);
+    ASSERT_EQ(res.tablet_id(), 4);
+    cache->erase(key);
+    ASSERT_FALSE(cache->get(key, &res));
+
+    // Expired
+    config::tablet_index_cache_ttl_seconds = 0;
+    cache->put(key, idx);
+    ASSERT_FALSE(cache->get(key, &res));
+
+    // Evicted by the capacity
+    config::tablet_index_cache_ttl_seconds = 60;
+    for (int64_t tablet_id = 0; tablet_id < 4096; ++tablet_id) {
+        idx.set_tablet_id(tablet_id);
+        cache->put(meta_tablet_idx_key({"test_instance", tablet_id}), idx);
+    }
+    int num_cached = 0;
+    for (int64_t tablet_id = 0; tablet_id < 4096; ++tablet_id) {
+        num_cached += cache->get(meta_tablet_idx_key({"test_instance", tablet_id}), &res);
+    }
+    ASSERT_LE(num_cached, 1024);
+    ASSERT_TRUE(cache->get(meta_tablet_idx_key({"test_instance", 4095}), &res));
+}
+
 } // namespace doris::cloud
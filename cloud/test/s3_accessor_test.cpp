@@ -140,7 +140,11 @@ void test_s3_accessor(S3Accessor& accessor) {
         to_delete_files.push_back(std::move(files.back()));
         files.pop_back();
     }
+    // Deleted by concurrent batches
+    auto batch_size = config::recycler_delete_objects_batch_size;
+    config::recycler_delete_objects_batch_size = 2;
     ret = accessor.delete_files(to_delete_files);
+    config::recycler_delete_objects_batch_size = batch_size;
     ASSERT_EQ(ret, 0);
 
     ret = accessor.list_all(&iter);